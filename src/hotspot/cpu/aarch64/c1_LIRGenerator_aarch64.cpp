@@ -1290,6 +1290,11 @@ void LIRGenerator::do_CheckCast(CheckCast* x) {
     stub = new DeoptimizeStub(info_for_exception,
                               Deoptimization::Reason_class_check,
                               Deoptimization::Action_none);
+  } else if (x->is_profiled_receiver_check()) {
+    assert(patching_info == NULL, "can't patch this");
+    stub = new DeoptimizeStub(info_for_exception,
+                              Deoptimization::Reason_profiled_receiver_check,
+                              Deoptimization::Action_make_not_entrant);
   } else {
     stub = new SimpleExceptionStub(Runtime1::throw_class_cast_exception_id, obj.result(), info_for_exception);
   }
@@ -36,8 +36,10 @@
 #include "oops/objArrayKlass.hpp"
 #include "oops/oop.inline.hpp"
 #include "prims/methodHandles.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/frame.inline.hpp"
 #include "runtime/handles.inline.hpp"
+#include "runtime/icache.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/stubCodeGenerator.hpp"
 #include "runtime/stubRoutines.hpp"
@@ -2389,6 +2391,100 @@ class StubGenerator: public StubCodeGenerator {
     return start;
   }
 
+#ifdef LINUX
+  // LSE versions of the stubs used by Atomic::PlatformAdd,
+  // Atomic::PlatformXchg and Atomic::PlatformCmpxchg. The default
+  // versions, using exclusive loads and stores, are in
+  // atomic_linux_aarch64.s.
+  //
+  // For memory_order_conservative the atomic instructions with both
+  // acquire and release semantics (ldaddal, swpal, casal) need no
+  // leading barrier: they are barrier-ordered-before any later access.
+  // A later access may still be reordered with their store, so they
+  // need a trailing full barrier.
+
+  // The argument registers of the stubs: the address in c_rarg0, the
+  // operands in c_rarg1 and c_rarg2. The result goes to r0.
+  void gen_atomic_result(Assembler::operand_size size, Register prev) {
+    if (size == Assembler::xword) {
+      __ mov(r0, prev);
+    } else {
+      __ ubfx(r0, prev, 0, 8 << size);
+    }
+    __ ret(lr);
+  }
+
+  address gen_ldaddal_entry(Assembler::operand_size size) {
+    Register prev = r2, addr = c_rarg0, incr = c_rarg1;
+    __ align(32);
+    address entry = __ pc();
+    __ ldaddal(size, incr, prev, addr);
+    __ membar(Assembler::StoreStore|Assembler::StoreLoad);
+    gen_atomic_result(size, prev);
+    return entry;
+  }
+
+  address gen_swpal_entry(Assembler::operand_size size) {
+    Register prev = r2, addr = c_rarg0, incr = c_rarg1;
+    __ align(32);
+    address entry = __ pc();
+    __ swpal(size, incr, prev, addr);
+    __ membar(Assembler::StoreStore|Assembler::StoreLoad);
+    gen_atomic_result(size, prev);
+    return entry;
+  }
+
+  address gen_cas_entry(Assembler::operand_size size, atomic_memory_order order) {
+    Register prev = r3, ptr = c_rarg0, compare_val = c_rarg1, exchange_val = c_rarg2;
+    bool const ordered = (order != memory_order_relaxed);
+    __ align(32);
+    address entry = __ pc();
+    __ mov(prev, compare_val);
+    __ lse_cas(prev, exchange_val, ptr, size, ordered, ordered, /*not_pair*/ true);
+    if (order == memory_order_conservative) {
+      __ membar(Assembler::StoreStore|Assembler::StoreLoad);
+    }
+    gen_atomic_result(size, prev);
+    return entry;
+  }
+
+  void generate_atomic_entry_points() {
+    if (!UseLSE) {
+      return;
+    }
+
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", "atomic entry points");
+    address first_entry = __ pc();
+
+    address fetch_add_4 = gen_ldaddal_entry(Assembler::word);
+    address fetch_add_8 = gen_ldaddal_entry(Assembler::xword);
+    address xchg_4 = gen_swpal_entry(Assembler::word);
+    address xchg_8 = gen_swpal_entry(Assembler::xword);
+    address cmpxchg_1 = gen_cas_entry(Assembler::byte, memory_order_conservative);
+    address cmpxchg_4 = gen_cas_entry(Assembler::word, memory_order_conservative);
+    address cmpxchg_8 = gen_cas_entry(Assembler::xword, memory_order_conservative);
+    address cmpxchg_1_relaxed = gen_cas_entry(Assembler::byte, memory_order_relaxed);
+    address cmpxchg_4_relaxed = gen_cas_entry(Assembler::word, memory_order_relaxed);
+    address cmpxchg_8_relaxed = gen_cas_entry(Assembler::xword, memory_order_relaxed);
+
+    // Other threads call the atomic stubs concurrently, so only publish
+    // the new entry points once the code is visible.
+    ICache::invalidate_range(first_entry, __ pc() - first_entry);
+
+    aarch64_atomic_fetch_add_4_impl = CAST_TO_FN_PTR(aarch64_atomic_stub_t, fetch_add_4);
+    aarch64_atomic_fetch_add_8_impl = CAST_TO_FN_PTR(aarch64_atomic_stub_t, fetch_add_8);
+    aarch64_atomic_xchg_4_impl = CAST_TO_FN_PTR(aarch64_atomic_stub_t, xchg_4);
+    aarch64_atomic_xchg_8_impl = CAST_TO_FN_PTR(aarch64_atomic_stub_t, xchg_8);
+    aarch64_atomic_cmpxchg_1_impl = CAST_TO_FN_PTR(aarch64_atomic_stub_t, cmpxchg_1);
+    aarch64_atomic_cmpxchg_4_impl = CAST_TO_FN_PTR(aarch64_atomic_stub_t, cmpxchg_4);
+    aarch64_atomic_cmpxchg_8_impl = CAST_TO_FN_PTR(aarch64_atomic_stub_t, cmpxchg_8);
+    aarch64_atomic_cmpxchg_1_relaxed_impl = CAST_TO_FN_PTR(aarch64_atomic_stub_t, cmpxchg_1_relaxed);
+    aarch64_atomic_cmpxchg_4_relaxed_impl = CAST_TO_FN_PTR(aarch64_atomic_stub_t, cmpxchg_4_relaxed);
+    aarch64_atomic_cmpxchg_8_relaxed_impl = CAST_TO_FN_PTR(aarch64_atomic_stub_t, cmpxchg_8_relaxed);
+  }
+#endif // LINUX
+
   void generate_arraycopy_stubs() {
     address entry;
     address entry_jbyte_arraycopy;
@@ -3246,6 +3342,147 @@ class StubGenerator: public StubCodeGenerator {
     return start;
   }
 
+  /**
+   *  Polynomial hash h = 31 * h + a[i] over an array range.
+   *
+   *  Input:
+   *    c_rarg0   - ary     address of the first element
+   *    c_rarg1   - cnt     number of elements
+   *    c_rarg2   - result  initial hash value
+   *
+   *  Output:
+   *       c_rarg0   - int hash
+   */
+  address generate_arrays_hashcode(BasicType eltype, const char* name) {
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", name);
+    address start = __ pc();
+
+    Label L_vector_loop, L_scalar, L_scalar_loop, L_done, L_powers;
+
+    // Aliases
+    Register ary    = c_rarg0;
+    Register cnt    = c_rarg1;
+    Register result = c_rarg2;
+    Register tmp    = c_rarg3;
+    Register pow    = r4;
+    Register mul    = r5;
+    Register count  = r6;
+    FloatRegister vacc0  = v0;
+    FloatRegister vacc1  = v1;
+    FloatRegister vnext0 = v2;
+    FloatRegister vnext1 = v3;
+    FloatRegister vmul   = v4;
+    FloatRegister vcoef0 = v5;
+    FloatRegister vcoef1 = v6;
+
+    const int lanes = 8;
+    const int elsize = type2aelembytes(eltype);
+
+    __ cmpw(cnt, lanes);
+    __ br(Assembler::LT, L_scalar);
+
+    // Each lane accumulates every 8th element:
+    //   acc = acc * 31^8 + a[i .. i+8)
+    // which is folded into the hash afterwards as
+    //   h = h * 31^n + sum(acc[j] * 31^(7-j))
+    __ adr(tmp, L_powers);
+    __ ld1(vcoef0, vcoef1, __ T4S, __ post(tmp, 2 * 4 * BytesPerInt));
+    __ ld1r(vmul, __ T4S, Address(tmp));
+    __ ldrw(mul, Address(tmp));
+    __ eor(vacc0, __ T16B, vacc0, vacc0);
+    __ eor(vacc1, __ T16B, vacc1, vacc1);
+    __ movw(pow, 1);
+    __ andw(count, cnt, -lanes);
+    __ subw(cnt, cnt, count);
+
+    __ bind(L_vector_loop);
+    switch (eltype) {
+    case T_BOOLEAN:
+      __ ldrd(vnext0, __ post(ary, lanes * elsize));
+      __ ushll(vnext0, __ T8H, vnext0, __ T8B, 0);
+      __ ushll2(vnext1, __ T4S, vnext0, __ T8H, 0);
+      __ ushll(vnext0, __ T4S, vnext0, __ T4H, 0);
+      break;
+    case T_BYTE:
+      __ ldrd(vnext0, __ post(ary, lanes * elsize));
+      __ sshll(vnext0, __ T8H, vnext0, __ T8B, 0);
+      __ sshll2(vnext1, __ T4S, vnext0, __ T8H, 0);
+      __ sshll(vnext0, __ T4S, vnext0, __ T4H, 0);
+      break;
+    case T_CHAR:
+      __ ld1(vnext0, __ T8H, __ post(ary, lanes * elsize));
+      __ ushll2(vnext1, __ T4S, vnext0, __ T8H, 0);
+      __ ushll(vnext0, __ T4S, vnext0, __ T4H, 0);
+      break;
+    case T_INT:
+      __ ld1(vnext0, vnext1, __ T4S, __ post(ary, lanes * elsize));
+      break;
+    default:
+      ShouldNotReachHere();
+    }
+    __ mulv(vacc0, __ T4S, vacc0, vmul);
+    __ mulv(vacc1, __ T4S, vacc1, vmul);
+    __ addv(vacc0, __ T4S, vacc0, vnext0);
+    __ addv(vacc1, __ T4S, vacc1, vnext1);
+    __ mulw(pow, pow, mul);
+    __ subsw(count, count, lanes);
+    __ br(Assembler::GT, L_vector_loop);
+
+    // Fold the lanes into the hash
+    __ mulw(result, result, pow);
+    __ mulv(vacc0, __ T4S, vacc0, vcoef0);
+    __ mlav(vacc0, __ T4S, vacc1, vcoef1);
+    __ addv(vacc0, __ T4S, vacc0);
+    __ umov(tmp, vacc0, __ S, 0);
+    __ addw(result, result, tmp);
+
+    // Remaining elements one at a time
+    __ bind(L_scalar);
+    __ cbzw(cnt, L_done);
+    __ movw(mul, 31);
+    __ bind(L_scalar_loop);
+    switch (eltype) {
+    case T_BOOLEAN:
+      __ ldrb(tmp, __ post(ary, elsize));
+      break;
+    case T_BYTE:
+      __ ldrsbw(tmp, __ post(ary, elsize));
+      break;
+    case T_CHAR:
+      __ ldrh(tmp, __ post(ary, elsize));
+      break;
+    case T_INT:
+      __ ldrw(tmp, __ post(ary, elsize));
+      break;
+    default:
+      ShouldNotReachHere();
+    }
+    __ maddw(result, result, mul, tmp);
+    __ subsw(cnt, cnt, 1);
+    __ br(Assembler::GT, L_scalar_loop);
+
+    __ bind(L_done);
+    __ movw(r0, result);
+    __ ret(lr);
+
+    // Multipliers 31^7, ..., 31^1, 31^0 followed by 31^8
+    __ align(wordSize);
+    __ bind(L_powers);
+    juint power = 1;
+    juint powers[lanes];
+    for (int i = lanes - 1; i >= 0; i--) {
+      powers[i] = power;
+      power *= 31;
+    }
+    for (int i = 0; i < lanes; i++) {
+      __ emit_int32(powers[i]);
+    }
+    __ emit_int32(power);
+
+    return start;
+  }
+
   /***
    *  Arguments:
    *
@@ -5782,6 +6019,10 @@ class StubGenerator: public StubCodeGenerator {
     StubRoutines::_data_cache_writeback = generate_data_cache_writeback();
     StubRoutines::_data_cache_writeback_sync = generate_data_cache_writeback_sync();
 
+#ifdef LINUX
+    generate_atomic_entry_points();
+#endif // LINUX
+
     if (UseAESIntrinsics) {
       StubRoutines::_aescrypt_encryptBlock = generate_aescrypt_encryptBlock();
       StubRoutines::_aescrypt_decryptBlock = generate_aescrypt_decryptBlock();
@@ -5803,6 +6044,13 @@ class StubGenerator: public StubCodeGenerator {
       StubRoutines::_updateBytesAdler32 = generate_updateBytesAdler32();
     }
 
+    if (UseVectorizedHashCodeIntrinsic) {
+      StubRoutines::_jbyte_hashcode  = generate_arrays_hashcode(T_BYTE,    "jbyte_hashcode");
+      StubRoutines::_jubyte_hashcode = generate_arrays_hashcode(T_BOOLEAN, "jubyte_hashcode");
+      StubRoutines::_jchar_hashcode  = generate_arrays_hashcode(T_CHAR,    "jchar_hashcode");
+      StubRoutines::_jint_hashcode   = generate_arrays_hashcode(T_INT,     "jint_hashcode");
+    }
+
     // Safefetch stubs.
     generate_safefetch("SafeFetch32", sizeof(int),     &StubRoutines::_safefetch32_entry,
                                                        &StubRoutines::_safefetch32_fault_pc,
@@ -5830,3 +6078,26 @@ void StubGenerator_generate(CodeBuffer* code, bool all) {
   }
   StubGenerator g(code, all);
 }
+
+#ifdef LINUX
+// Define the pointers to the atomic stubs and initialize them to the
+// default implementations in atomic_linux_aarch64.s.
+#define DEFAULT_ATOMIC_OP(OPNAME, SIZE, RELAXED)                              \
+  extern "C" uint64_t aarch64_atomic_ ## OPNAME ## _ ## SIZE ## RELAXED ## _default_impl \
+    (volatile void *ptr, uint64_t arg1, uint64_t arg2);                       \
+  aarch64_atomic_stub_t aarch64_atomic_ ## OPNAME ## _ ## SIZE ## RELAXED ## _impl \
+    = aarch64_atomic_ ## OPNAME ## _ ## SIZE ## RELAXED ## _default_impl;
+
+DEFAULT_ATOMIC_OP(fetch_add, 4, )
+DEFAULT_ATOMIC_OP(fetch_add, 8, )
+DEFAULT_ATOMIC_OP(xchg, 4, )
+DEFAULT_ATOMIC_OP(xchg, 8, )
+DEFAULT_ATOMIC_OP(cmpxchg, 1, )
+DEFAULT_ATOMIC_OP(cmpxchg, 4, )
+DEFAULT_ATOMIC_OP(cmpxchg, 8, )
+DEFAULT_ATOMIC_OP(cmpxchg, 1, _relaxed)
+DEFAULT_ATOMIC_OP(cmpxchg, 4, _relaxed)
+DEFAULT_ATOMIC_OP(cmpxchg, 8, _relaxed)
+
+#undef DEFAULT_ATOMIC_OP
+#endif // LINUX
@@ -839,6 +839,11 @@ void TemplateTable::caload()
   __ access_load_at(T_CHAR, IN_HEAP | IS_ARRAY, r0, Address(r0, r1, Address::uxtw(1)), noreg, noreg);
 }
 
+void TemplateTable::fast_iload2_if_icmp(Condition cc)
+{
+  __ call_Unimplemented();
+}
+
 // iload followed by caload frequent pair
 void TemplateTable::fast_icaload()
 {
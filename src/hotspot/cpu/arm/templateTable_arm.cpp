@@ -905,6 +905,12 @@ void TemplateTable::caload() {
 }
 
 
+void TemplateTable::fast_iload2_if_icmp(Condition cc) {
+  transition(vtos, vtos);
+  __ stop("fast_iload2_if_icmp is not used on ARM");
+}
+
+
 // iload followed by caload frequent pair
 void TemplateTable::fast_icaload() {
   transition(vtos, itos);
@@ -715,6 +715,11 @@ void TemplateTable::caload() {
   __ lhz(R17_tos, arrayOopDesc::base_offset_in_bytes(T_CHAR), Rload_addr);
 }
 
+void TemplateTable::fast_iload2_if_icmp(Condition cc) {
+  transition(vtos, vtos);
+  __ stop("fast_iload2_if_icmp not used on ppc64");
+}
+
 // Iload followed by caload frequent pair.
 void TemplateTable::fast_icaload() {
   transition(vtos, itos);
@@ -882,6 +882,11 @@ void TemplateTable::caload() {
             Address(Z_tmp_2, index, arrayOopDesc::base_offset_in_bytes(T_CHAR)));
 }
 
+void TemplateTable::fast_iload2_if_icmp(Condition cc) {
+  transition(vtos, vtos);
+  __ stop("fast_iload2_if_icmp not used on linuxs390x");
+}
+
 // Iload followed by caload frequent pair.
 void TemplateTable::fast_icaload() {
   transition(vtos, itos);
@@ -719,6 +719,11 @@ void TemplateTable::caload() {
   __ lduh(O3, arrayOopDesc::base_offset_in_bytes(T_CHAR), Otos_i);
 }
 
+void TemplateTable::fast_iload2_if_icmp(Condition cc) {
+  transition(vtos, vtos);
+  __ stop("fast_iload2_if_icmp not used on sparc");
+}
+
 void TemplateTable::fast_icaload() {
   transition(vtos, itos);
   // Otos_i: index
@@ -1623,14 +1623,15 @@ void LIR_Assembler::emit_alloc_array(LIR_OpAllocArray* op) {
 
 void LIR_Assembler::type_profile_helper(Register mdo,
                                         ciMethodData *md, ciProfileData *data,
-                                        Register recv, Label* update_done) {
+                                        Register recv, Label* update_done,
+                                        int increment) {
   for (uint i = 0; i < ReceiverTypeData::row_limit(); i++) {
     Label next_test;
     // See if the receiver is receiver[n].
     __ cmpptr(recv, Address(mdo, md->byte_offset_of_slot(data, ReceiverTypeData::receiver_offset(i))));
     __ jccb(Assembler::notEqual, next_test);
     Address data_addr(mdo, md->byte_offset_of_slot(data, ReceiverTypeData::receiver_count_offset(i)));
-    __ addptr(data_addr, DataLayout::counter_increment);
+    __ addptr(data_addr, increment);
     __ jmp(*update_done);
     __ bind(next_test);
   }
@@ -1642,7 +1643,7 @@ void LIR_Assembler::type_profile_helper(Register mdo,
     __ cmpptr(recv_addr, (intptr_t)NULL_WORD);
     __ jccb(Assembler::notEqual, next_test);
     __ movptr(recv_addr, recv);
-    __ movptr(Address(mdo, md->byte_offset_of_slot(data, ReceiverTypeData::receiver_count_offset(i))), DataLayout::counter_increment);
+    __ movptr(Address(mdo, md->byte_offset_of_slot(data, ReceiverTypeData::receiver_count_offset(i))), increment);
     __ jmp(*update_done);
     __ bind(next_test);
   }
@@ -1793,7 +1794,7 @@ void LIR_Assembler::emit_typecheck_helper(LIR_OpTypeCheck *op, Label* success, L
     __ bind(profile_cast_success);
     __ mov_metadata(mdo, md->constant_encoding());
     __ load_klass(recv, obj);
-    type_profile_helper(mdo, md, data, recv, success);
+    type_profile_helper(mdo, md, data, recv, success, DataLayout::counter_increment);
     __ jmp(*success);
 
     __ bind(profile_cast_failure);
@@ -1875,7 +1876,7 @@ void LIR_Assembler::emit_opTypeCheck(LIR_OpTypeCheck* op) {
       __ bind(profile_cast_success);
       __ mov_metadata(mdo, md->constant_encoding());
       __ load_klass(recv, value);
-      type_profile_helper(mdo, md, data, recv, &done);
+      type_profile_helper(mdo, md, data, recv, &done, DataLayout::counter_increment);
       __ jmpb(done);
 
       __ bind(profile_cast_failure);
@@ -3568,12 +3569,26 @@ void LIR_Assembler::emit_profile_call(LIR_OpProfileCall* op) {
         }
       }
     } else {
-      __ load_klass(recv, recv);
       Label update_done;
-      type_profile_helper(mdo, md, data, recv, &update_done);
+      int increment = DataLayout::counter_increment;
+#ifdef _LP64
+      if (C1ProfileReceiverSampleRate > 1) {
+        // Only every C1ProfileReceiverSampleRate-th call of this thread
+        // updates the profile, by C1ProfileReceiverSampleRate, so the
+        // counts keep their expected values while the shared MDO cache
+        // lines are written much less often.
+        Address countdown_addr(r15_thread, JavaThread::profile_sample_countdown_offset());
+        __ decrementl(countdown_addr);
+        __ jcc(Assembler::greater, update_done);
+        __ movl(countdown_addr, (int32_t)C1ProfileReceiverSampleRate);
+        increment *= (int)C1ProfileReceiverSampleRate;
+      }
+#endif // _LP64
+      __ load_klass(recv, recv);
+      type_profile_helper(mdo, md, data, recv, &update_done, increment);
       // Receiver did not match any saved receiver and there is no empty row for it.
       // Increment total counter to indicate polymorphic case.
-      __ addptr(counter_addr, DataLayout::counter_increment);
+      __ addptr(counter_addr, increment);
 
       __ bind(update_done);
     }
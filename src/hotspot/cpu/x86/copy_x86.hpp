@@ -55,7 +55,17 @@ static void pd_fill_to_bytes(void* to, size_t count, jubyte value) {
 }
 
 static void pd_zero_to_words(HeapWord* tohw, size_t count) {
-  pd_fill_to_words(tohw, count, 0);
+  // Large blocks, such as new large arrays and humongous regions, are
+  // zeroed with memset. The C library uses rep stos and, above its own
+  // threshold, non-temporal stores, which avoids evicting the working set
+  // from the cache. As on s390 we rely on memset storing aligned words
+  // whole. Small blocks are not worth the call.
+  const size_t memset_threshold_words = 4 * K / HeapWordSize;
+  if (count >= memset_threshold_words) {
+    (void)memset(tohw, 0, count * HeapWordSize);
+  } else {
+    pd_fill_to_words(tohw, count, 0);
+  }
 }
 
 static void pd_zero_to_bytes(void* to, size_t count) {
@@ -191,6 +191,12 @@ define_pd_global(bool, ThreadLocalHandshakes, false);
   experimental(bool, UseRTMXendForLockBusy, true,                           \
           "Use RTM Xend instead of Xabort when lock busy")                  \
                                                                             \
+  experimental(bool, CriticalJNINativesWithoutTransition, false,            \
+          "Call critical JNI natives in the _thread_in_Java state, "        \
+          "without a thread state transition, safepoint poll or array "     \
+          "pinning. Only safe for short leaf functions that never block. "  \
+          "Not supported with Shenandoah and ZGC")                          \
+                                                                            \
   /* assembler */                                                           \
   product(bool, UseCountLeadingZerosInstruction, false,                     \
           "Use count leading zeros instruction")                            \
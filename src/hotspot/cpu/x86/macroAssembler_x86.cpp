@@ -4393,6 +4393,116 @@ void MacroAssembler::lookup_interface_method(Register recv_klass,
   }
 }
 
+#ifdef _LP64
+// The itable stub used to scan the itable twice: once for the REFC subtype
+// check and once for the DECC method lookup. Both are done here in one pass;
+// when REFC and DECC are the same interface (the common case) only the DECC
+// record is searched for.
+void MacroAssembler::lookup_interface_method_stub(Register recv_klass,
+                                                  Register holder_klass,
+                                                  Register resolved_klass,
+                                                  Register method_result,
+                                                  Register scan_temp,
+                                                  Register temp_reg,
+                                                  int itable_index,
+                                                  Label& L_no_such_interface) {
+  assert_different_registers(recv_klass, method_result, holder_klass, resolved_klass, scan_temp, temp_reg);
+  Register temp_itbl_klass = method_result;
+
+  int vtable_base = in_bytes(Klass::vtable_start_offset());
+  int itentry_off = itableMethodEntry::method_offset_in_bytes();
+  int scan_step   = itableOffsetEntry::size() * wordSize;
+  int vte_size    = vtableEntry::size_in_bytes();
+  int ioffset     = itableOffsetEntry::interface_offset_in_bytes();
+  int ooffset     = itableOffsetEntry::offset_offset_in_bytes();
+  Address::ScaleFactor times_vte_scale = Address::times_ptr;
+  assert(vte_size == wordSize, "else adjust times_vte_scale");
+
+  Label L_loop_scan_resolved_entry, L_resolved_found, L_holder_found;
+
+  // temp_itbl_klass = recv_klass.itable[0]
+  // scan_temp = &recv_klass.itable[0] + step
+  movl(scan_temp, Address(recv_klass, Klass::vtable_length_offset()));
+  movptr(temp_itbl_klass, Address(recv_klass, scan_temp, times_vte_scale, vtable_base + ioffset));
+  lea(scan_temp, Address(recv_klass, scan_temp, times_vte_scale, vtable_base + ioffset + scan_step));
+  xorptr(temp_reg, temp_reg);
+
+  // Initial checks:
+  //   - if (holder_klass != resolved_klass), go to "scan for resolved"
+  //   - if (itable[0] == 0), no such interface
+  //   - if (itable[0] == holder_klass), shortcut to "holder found"
+  cmpptr(holder_klass, resolved_klass);
+  jccb(Assembler::notEqual, L_loop_scan_resolved_entry);
+  testptr(temp_itbl_klass, temp_itbl_klass);
+  jcc(Assembler::zero, L_no_such_interface);
+  cmpptr(holder_klass, temp_itbl_klass);
+  jccb(Assembler::equal, L_holder_found);
+
+  // Loop: look for the holder_klass record in the itable
+  //   do {
+  //     tmp = itable[index];
+  //     index += step;
+  //     if (tmp == holder_klass) {
+  //       goto L_holder_found; // Found!
+  //     }
+  //   } while (tmp != 0);
+  //   goto L_no_such_interface // Not found.
+  Label L_scan_holder;
+  bind(L_scan_holder);
+    movptr(temp_itbl_klass, Address(scan_temp, 0));
+    addptr(scan_temp, scan_step);
+    cmpptr(holder_klass, temp_itbl_klass);
+    jccb(Assembler::equal, L_holder_found);
+    testptr(temp_itbl_klass, temp_itbl_klass);
+    jccb(Assembler::notZero, L_scan_holder);
+
+  jmp(L_no_such_interface);
+
+  // Loop: look for the resolved_klass record in the itable, remembering
+  // the holder_klass offset if its record is met on the way
+  //   do {
+  //     tmp = itable[index];
+  //     index += step;
+  //     if (tmp == holder_klass) {
+  //       holder_offset = itable[index - step].offset;
+  //     }
+  //     if (tmp == resolved_klass) {
+  //       goto L_resolved_found;  // Found!
+  //     }
+  //   } while (tmp != 0);
+  //   goto L_no_such_interface // Not found.
+  Label L_loop_scan_resolved;
+  bind(L_loop_scan_resolved);
+    movptr(temp_itbl_klass, Address(scan_temp, 0));
+    addptr(scan_temp, scan_step);
+    bind(L_loop_scan_resolved_entry);
+    cmpptr(holder_klass, temp_itbl_klass);
+    cmovl(Assembler::equal, temp_reg, Address(scan_temp, ooffset - ioffset - scan_step));
+    cmpptr(resolved_klass, temp_itbl_klass);
+    jccb(Assembler::equal, L_resolved_found);
+    testptr(temp_itbl_klass, temp_itbl_klass);
+    jccb(Assembler::notZero, L_loop_scan_resolved);
+
+  jmp(L_no_such_interface);
+
+  Label L_ready;
+
+  // See if the holder_klass record was already met. If not, scan on for it.
+  bind(L_resolved_found);
+  testptr(temp_reg, temp_reg);
+  jccb(Assembler::zero, L_scan_holder);
+  jmpb(L_ready);
+
+  bind(L_holder_found);
+  movl(temp_reg, Address(scan_temp, ooffset - ioffset - scan_step));
+
+  // Finally, temp_reg contains the holder_klass itable offset.
+  bind(L_ready);
+  assert(itableMethodEntry::size() * wordSize == wordSize, "adjust the scaling in the code below");
+  movptr(method_result, Address(recv_klass, temp_reg, Address::times_1, itable_index * wordSize + itentry_off));
+}
+#endif // _LP64
+
 
 // virtual method calling
 void MacroAssembler::lookup_virtual_method(Register recv_klass,
@@ -6348,6 +6458,135 @@ void MacroAssembler::string_indexof(Register str1, Register str2,
 
 } // string_indexof
 
+#ifdef _LP64
+// A 32 byte block of candidate positions is filtered by comparing it with the
+// first character of the substring and the block shifted by the substring
+// length with its last character. Only the positions where both characters
+// match are compared with the rest of the substring.
+void MacroAssembler::string_indexof_avx2(Register str1, Register str2,
+                                         Register cnt1, Register cnt2, Register result,
+                                         XMMRegister vec1, XMMRegister vec2,
+                                         XMMRegister vec3, XMMRegister vec4,
+                                         Register tmp, Register tmp2, Register tmp3, Register tmp4) {
+  assert(UseAVX >= 2, "AVX2 intrinsics are required");
+  assert_different_registers(str1, str2, cnt1, cnt2, result, tmp, tmp2, tmp3, tmp4);
+  //
+  // Note, inline_string_indexOf() generates checks:
+  // if (substr.count > string.count) return -1;
+  // if (substr.count == 0) return 0;
+  //
+  const int stride = 32;
+
+  Label AVX2_SEARCH, DONE;
+
+  movl(tmp, cnt1);
+  subl(tmp, cnt2);
+  cmpl(tmp, stride - 1);
+  jcc(Assembler::greaterEqual, AVX2_SEARCH);
+  // Less than 32 candidate positions.
+  string_indexof(str1, str2, cnt1, cnt2, -1, result, vec1, tmp, StrIntrinsicNode::LL);
+  jmp(DONE);
+
+  bind(AVX2_SEARCH);
+  {
+    ShortBranchVerifier sbv(this);
+    Label SCAN_BLOCK, NEXT_BLOCK, CHECK_CANDIDATE, COMPARE_4_LOOP,
+          COMPARE_SHORT, COMPARE_1, NEXT_CANDIDATE, FOUND, NOT_FOUND;
+
+    // cnt1 - position of the last full block of candidates
+    // cnt2 - offset of the last character of the substring
+    subl(tmp, stride - 1);
+    movl(cnt1, tmp);
+    subl(cnt2, 1);
+    vpbroadcastb(vec1, Address(str2, 0), Assembler::AVX_256bit);
+    vpbroadcastb(vec2, Address(str2, cnt2, Address::times_1), Assembler::AVX_256bit);
+    xorl(result, result);
+
+    bind(SCAN_BLOCK);
+    lea(tmp3, Address(str1, cnt2, Address::times_1));
+    vmovdqu(vec3, Address(str1, result, Address::times_1));
+    vmovdqu(vec4, Address(tmp3, result, Address::times_1));
+    vpcmpeqb(vec3, vec3, vec1, Assembler::AVX_256bit);
+    vpcmpeqb(vec4, vec4, vec2, Assembler::AVX_256bit);
+    vpand(vec3, vec3, vec4, Assembler::AVX_256bit);
+    vpmovmskb(tmp, vec3);
+    testl(tmp, tmp);
+    jcc(Assembler::notZero, CHECK_CANDIDATE);
+
+    bind(NEXT_BLOCK);
+    addl(result, stride);
+    cmpl(result, cnt1);
+    jccb(Assembler::lessEqual, SCAN_BLOCK);
+    // Scan the remaining positions with a last block which overlaps
+    // the previous one, its positions were already rejected.
+    lea(tmp, Address(cnt1, stride));
+    cmpl(result, tmp);
+    jccb(Assembler::equal, NOT_FOUND);
+    movl(result, cnt1);
+    jmpb(SCAN_BLOCK);
+
+    // Compare the characters between the first and the last one.
+    bind(CHECK_CANDIDATE);
+    bsfl(tmp2, tmp);
+    addl(tmp2, result);
+    lea(tmp2, Address(str1, tmp2, Address::times_1));
+    cmpl(cnt2, 5);
+    jccb(Assembler::less, COMPARE_SHORT);
+    movl(tmp3, cnt2);
+
+    bind(COMPARE_4_LOOP);
+    subl(tmp3, 4);
+    movl(tmp4, Address(str2, tmp3, Address::times_1));
+    cmpl(tmp4, Address(tmp2, tmp3, Address::times_1));
+    jccb(Assembler::notEqual, NEXT_CANDIDATE);
+    cmpl(tmp3, 5);
+    jccb(Assembler::greaterEqual, COMPARE_4_LOOP);
+    // Compare the leftover characters with an overlapping load.
+    movl(tmp4, Address(str2, 1));
+    cmpl(tmp4, Address(tmp2, 1));
+    jccb(Assembler::notEqual, NEXT_CANDIDATE);
+    jmpb(FOUND);
+
+    bind(COMPARE_SHORT); // up to 3 characters between the first and the last
+    cmpl(cnt2, 2);
+    jccb(Assembler::less, FOUND);
+    jccb(Assembler::equal, COMPARE_1);
+    load_unsigned_short(tmp3, Address(str2, 1));
+    load_unsigned_short(tmp4, Address(tmp2, 1));
+    cmpl(tmp3, tmp4);
+    jccb(Assembler::notEqual, NEXT_CANDIDATE);
+    load_unsigned_short(tmp3, Address(str2, cnt2, Address::times_1, -2));
+    load_unsigned_short(tmp4, Address(tmp2, cnt2, Address::times_1, -2));
+    cmpl(tmp3, tmp4);
+    jccb(Assembler::equal, FOUND);
+    jmpb(NEXT_CANDIDATE);
+
+    bind(COMPARE_1);
+    load_unsigned_byte(tmp3, Address(str2, 1));
+    load_unsigned_byte(tmp4, Address(tmp2, 1));
+    cmpl(tmp3, tmp4);
+    jccb(Assembler::equal, FOUND);
+
+    bind(NEXT_CANDIDATE);
+    // Clear the lowest candidate bit.
+    movl(tmp3, tmp);
+    subl(tmp3, 1);
+    andl(tmp, tmp3);
+    jcc(Assembler::notZero, CHECK_CANDIDATE);
+    jmp(NEXT_BLOCK);
+
+    bind(NOT_FOUND);
+    movl(result, -1);
+    jmpb(DONE);
+
+    bind(FOUND);
+    subptr(tmp2, str1);
+    movl(result, tmp2);
+  }
+  bind(DONE);
+} // string_indexof_avx2
+#endif // _LP64
+
 void MacroAssembler::string_indexof_char(Register str1, Register cnt1, Register ch, Register result,
                                          XMMRegister vec1, XMMRegister vec2, XMMRegister vec3, Register tmp) {
   ShortBranchVerifier sbv(this);
@@ -545,6 +545,20 @@ class MacroAssembler: public Assembler {
                                Label& no_such_interface,
                                bool return_method = true);
 
+#ifdef _LP64
+  // Combined itable dispatch for the itable stubs: checks that recv_klass
+  // implements resolved_klass (REFC) and selects the method of holder_klass
+  // (DECC) at itable_index, in a single scan of the itable.
+  void lookup_interface_method_stub(Register recv_klass,
+                                    Register holder_klass,
+                                    Register resolved_klass,
+                                    Register method_result,
+                                    Register scan_temp,
+                                    Register temp_reg,
+                                    int itable_index,
+                                    Label& L_no_such_interface);
+#endif // _LP64
+
   // virtual method calling
   void lookup_virtual_method(Register recv_klass,
                              RegisterOrConstant vtable_index,
@@ -1674,6 +1688,16 @@ public:
                       XMMRegister vec, Register tmp,
                       int ae);
 
+#ifdef _LP64
+  // IndexOf for Latin1 strings with AVX2 first and last character filtering.
+  // Strings with less than 32 candidate positions use string_indexof.
+  void string_indexof_avx2(Register str1, Register str2,
+                           Register cnt1, Register cnt2, Register result,
+                           XMMRegister vec1, XMMRegister vec2,
+                           XMMRegister vec3, XMMRegister vec4,
+                           Register tmp, Register tmp2, Register tmp3, Register tmp4);
+#endif
+
   // IndexOf for constant substrings with size >= 8 elements
   // which don't need to be loaded through stack.
   void string_indexofC8(Register str1, Register str2,
@@ -1649,6 +1649,11 @@ nmethod* SharedRuntime::generate_native_wrapper(MacroAssembler* masm,
   }
   assert(native_func != NULL, "must have function");
 
+  // A critical native that stays in the _thread_in_Java state behaves like a
+  // runtime leaf call: no safepoint can happen until it returns, so the array
+  // arguments need neither pinning nor a GC locker check.
+  const bool critical_in_java = is_critical_native && CriticalJNINativesWithoutTransition;
+
   // An OopMap for lock (and class if static)
   OopMapSet *oop_maps = new OopMapSet();
 
@@ -1935,7 +1940,7 @@ nmethod* SharedRuntime::generate_native_wrapper(MacroAssembler* masm,
 
    __ get_thread(thread);
 
-  if (is_critical_native && !Universe::heap()->supports_object_pinning()) {
+  if (is_critical_native && !critical_in_java && !Universe::heap()->supports_object_pinning()) {
     check_needs_gc_for_critical_native(masm, thread, stack_slots, total_c_args, total_in_args,
                                        oop_handle_offset, oop_maps, in_regs, in_sig_bt);
   }
@@ -1990,7 +1995,7 @@ nmethod* SharedRuntime::generate_native_wrapper(MacroAssembler* masm,
       case T_ARRAY:
         if (is_critical_native) {
           VMRegPair in_arg = in_regs[i];
-          if (Universe::heap()->supports_object_pinning()) {
+          if (!critical_in_java && Universe::heap()->supports_object_pinning()) {
             // gen_pin_object handles save and restore
             // of any clobbered registers
             gen_pin_object(masm, thread, in_arg);
@@ -2172,7 +2177,9 @@ nmethod* SharedRuntime::generate_native_wrapper(MacroAssembler* masm,
   }
 
   // Now set thread in native
-  __ movl(Address(thread, JavaThread::thread_state_offset()), _thread_in_native);
+  if (!critical_in_java) {
+    __ movl(Address(thread, JavaThread::thread_state_offset()), _thread_in_native);
+  }
 
   __ call(RuntimeAddress(native_func));
 
@@ -2223,20 +2230,6 @@ nmethod* SharedRuntime::generate_native_wrapper(MacroAssembler* masm,
     restore_native_result(masm, ret_type, stack_slots);
   }
 
-  // Switch thread to "native transition" state before reading the synchronization state.
-  // This additional state is necessary because reading and testing the synchronization
-  // state is not atomic w.r.t. GC, as this scenario demonstrates:
-  //     Java thread A, in _thread_in_native state, loads _not_synchronized and is preempted.
-  //     VM thread changes sync state to synchronizing and suspends threads for GC.
-  //     Thread A is resumed to finish this native method, but doesn't block here since it
-  //     didn't see any synchronization is progress, and escapes.
-  __ movl(Address(thread, JavaThread::thread_state_offset()), _thread_in_native_trans);
-
-  // Force this write out before the read below
-  __ membar(Assembler::Membar_mask_bits(
-            Assembler::LoadLoad | Assembler::LoadStore |
-            Assembler::StoreLoad | Assembler::StoreStore));
-
   if (AlwaysRestoreFPU) {
     // Make sure the control word is correct.
     __ fldcw(ExternalAddress(StubRoutines::addr_fpu_cntrl_wrd_std()));
@@ -2244,47 +2237,63 @@ nmethod* SharedRuntime::generate_native_wrapper(MacroAssembler* masm,
 
   Label after_transition;
 
-  // check for safepoint operation in progress and/or pending suspend requests
-  { Label Continue, slow_path;
-
-    __ safepoint_poll(slow_path, thread, noreg);
+  if (!critical_in_java) {
+    // Switch thread to "native transition" state before reading the synchronization state.
+    // This additional state is necessary because reading and testing the synchronization
+    // state is not atomic w.r.t. GC, as this scenario demonstrates:
+    //     Java thread A, in _thread_in_native state, loads _not_synchronized and is preempted.
+    //     VM thread changes sync state to synchronizing and suspends threads for GC.
+    //     Thread A is resumed to finish this native method, but doesn't block here since it
+    //     didn't see any synchronization is progress, and escapes.
+    __ movl(Address(thread, JavaThread::thread_state_offset()), _thread_in_native_trans);
+
+    // Force this write out before the read below
+    __ membar(Assembler::Membar_mask_bits(
+              Assembler::LoadLoad | Assembler::LoadStore |
+              Assembler::StoreLoad | Assembler::StoreStore));
+
+    // check for safepoint operation in progress and/or pending suspend requests
+    { Label Continue, slow_path;
+
+      __ safepoint_poll(slow_path, thread, noreg);
+
+      __ cmpl(Address(thread, JavaThread::suspend_flags_offset()), 0);
+      __ jcc(Assembler::equal, Continue);
+      __ bind(slow_path);
+
+      // Don't use call_VM as it will see a possible pending exception and forward it
+      // and never return here preventing us from clearing _last_native_pc down below.
+      // Also can't use call_VM_leaf either as it will check to see if rsi & rdi are
+      // preserved and correspond to the bcp/locals pointers. So we do a runtime call
+      // by hand.
+      //
+      __ vzeroupper();
 
-    __ cmpl(Address(thread, JavaThread::suspend_flags_offset()), 0);
-    __ jcc(Assembler::equal, Continue);
-    __ bind(slow_path);
-
-    // Don't use call_VM as it will see a possible pending exception and forward it
-    // and never return here preventing us from clearing _last_native_pc down below.
-    // Also can't use call_VM_leaf either as it will check to see if rsi & rdi are
-    // preserved and correspond to the bcp/locals pointers. So we do a runtime call
-    // by hand.
-    //
-    __ vzeroupper();
+      save_native_result(masm, ret_type, stack_slots);
+      __ push(thread);
+      if (!is_critical_native) {
+        __ call(RuntimeAddress(CAST_FROM_FN_PTR(address,
+                                                JavaThread::check_special_condition_for_native_trans)));
+      } else {
+        __ call(RuntimeAddress(CAST_FROM_FN_PTR(address,
+                                                JavaThread::check_special_condition_for_native_trans_and_transition)));
+      }
+      __ increment(rsp, wordSize);
+      // Restore any method result value
+      restore_native_result(masm, ret_type, stack_slots);
 
-    save_native_result(masm, ret_type, stack_slots);
-    __ push(thread);
-    if (!is_critical_native) {
-      __ call(RuntimeAddress(CAST_FROM_FN_PTR(address,
-                                              JavaThread::check_special_condition_for_native_trans)));
-    } else {
-      __ call(RuntimeAddress(CAST_FROM_FN_PTR(address,
-                                              JavaThread::check_special_condition_for_native_trans_and_transition)));
-    }
-    __ increment(rsp, wordSize);
-    // Restore any method result value
-    restore_native_result(masm, ret_type, stack_slots);
+      if (is_critical_native) {
+        // The call above performed the transition to thread_in_Java so
+        // skip the transition logic below.
+        __ jmpb(after_transition);
+      }
 
-    if (is_critical_native) {
-      // The call above performed the transition to thread_in_Java so
-      // skip the transition logic below.
-      __ jmpb(after_transition);
+      __ bind(Continue);
     }
 
-    __ bind(Continue);
+    // change thread state
+    __ movl(Address(thread, JavaThread::thread_state_offset()), _thread_in_Java);
   }
-
-  // change thread state
-  __ movl(Address(thread, JavaThread::thread_state_offset()), _thread_in_Java);
   __ bind(after_transition);
 
   Label reguard;
@@ -1955,6 +1955,11 @@ nmethod* SharedRuntime::generate_native_wrapper(MacroAssembler* masm,
   }
   assert(native_func != NULL, "must have function");
 
+  // A critical native that stays in the _thread_in_Java state behaves like a
+  // runtime leaf call: no safepoint can happen until it returns, so the array
+  // arguments need neither pinning nor a GC locker check.
+  const bool critical_in_java = is_critical_native && CriticalJNINativesWithoutTransition;
+
   // An OopMap for lock (and class if static)
   OopMapSet *oop_maps = new OopMapSet();
   intptr_t start = (intptr_t)__ pc();
@@ -2231,7 +2236,7 @@ nmethod* SharedRuntime::generate_native_wrapper(MacroAssembler* masm,
 
   const Register oop_handle_reg = r14;
 
-  if (is_critical_native && !Universe::heap()->supports_object_pinning()) {
+  if (is_critical_native && !critical_in_java && !Universe::heap()->supports_object_pinning()) {
     check_needs_gc_for_critical_native(masm, stack_slots, total_c_args, total_in_args,
                                        oop_handle_offset, oop_maps, in_regs, in_sig_bt);
   }
@@ -2341,7 +2346,7 @@ nmethod* SharedRuntime::generate_native_wrapper(MacroAssembler* masm,
       case T_ARRAY:
         if (is_critical_native) {
           // pin before unpack
-          if (Universe::heap()->supports_object_pinning()) {
+          if (!critical_in_java && Universe::heap()->supports_object_pinning()) {
             save_args(masm, total_c_args, 0, out_regs);
             gen_pin_object(masm, in_regs[i]);
             pinned_args.append(i);
@@ -2545,7 +2550,9 @@ nmethod* SharedRuntime::generate_native_wrapper(MacroAssembler* masm,
   }
 
   // Now set thread in native
-  __ movl(Address(r15_thread, JavaThread::thread_state_offset()), _thread_in_native);
+  if (!critical_in_java) {
+    __ movl(Address(r15_thread, JavaThread::thread_state_offset()), _thread_in_native);
+  }
 
   __ call(RuntimeAddress(native_func));
 
@@ -2589,66 +2596,68 @@ nmethod* SharedRuntime::generate_native_wrapper(MacroAssembler* masm,
     restore_native_result(masm, ret_type, stack_slots);
   }
 
-  // Switch thread to "native transition" state before reading the synchronization state.
-  // This additional state is necessary because reading and testing the synchronization
-  // state is not atomic w.r.t. GC, as this scenario demonstrates:
-  //     Java thread A, in _thread_in_native state, loads _not_synchronized and is preempted.
-  //     VM thread changes sync state to synchronizing and suspends threads for GC.
-  //     Thread A is resumed to finish this native method, but doesn't block here since it
-  //     didn't see any synchronization is progress, and escapes.
-  __ movl(Address(r15_thread, JavaThread::thread_state_offset()), _thread_in_native_trans);
-
-  // Force this write out before the read below
-  __ membar(Assembler::Membar_mask_bits(
-              Assembler::LoadLoad | Assembler::LoadStore |
-              Assembler::StoreLoad | Assembler::StoreStore));
-
   Label after_transition;
 
-  // check for safepoint operation in progress and/or pending suspend requests
-  {
-    Label Continue;
-    Label slow_path;
-
-    __ safepoint_poll(slow_path, r15_thread, rscratch1);
-
-    __ cmpl(Address(r15_thread, JavaThread::suspend_flags_offset()), 0);
-    __ jcc(Assembler::equal, Continue);
-    __ bind(slow_path);
+  if (!critical_in_java) {
+    // Switch thread to "native transition" state before reading the synchronization state.
+    // This additional state is necessary because reading and testing the synchronization
+    // state is not atomic w.r.t. GC, as this scenario demonstrates:
+    //     Java thread A, in _thread_in_native state, loads _not_synchronized and is preempted.
+    //     VM thread changes sync state to synchronizing and suspends threads for GC.
+    //     Thread A is resumed to finish this native method, but doesn't block here since it
+    //     didn't see any synchronization is progress, and escapes.
+    __ movl(Address(r15_thread, JavaThread::thread_state_offset()), _thread_in_native_trans);
+
+    // Force this write out before the read below
+    __ membar(Assembler::Membar_mask_bits(
+                Assembler::LoadLoad | Assembler::LoadStore |
+                Assembler::StoreLoad | Assembler::StoreStore));
+
+    // check for safepoint operation in progress and/or pending suspend requests
+    {
+      Label Continue;
+      Label slow_path;
+
+      __ safepoint_poll(slow_path, r15_thread, rscratch1);
+
+      __ cmpl(Address(r15_thread, JavaThread::suspend_flags_offset()), 0);
+      __ jcc(Assembler::equal, Continue);
+      __ bind(slow_path);
+
+      // Don't use call_VM as it will see a possible pending exception and forward it
+      // and never return here preventing us from clearing _last_native_pc down below.
+      // Also can't use call_VM_leaf either as it will check to see if rsi & rdi are
+      // preserved and correspond to the bcp/locals pointers. So we do a runtime call
+      // by hand.
+      //
+      __ vzeroupper();
+      save_native_result(masm, ret_type, stack_slots);
+      __ mov(c_rarg0, r15_thread);
+      __ mov(r12, rsp); // remember sp
+      __ subptr(rsp, frame::arg_reg_save_area_bytes); // windows
+      __ andptr(rsp, -16); // align stack as required by ABI
+      if (!is_critical_native) {
+        __ call(RuntimeAddress(CAST_FROM_FN_PTR(address, JavaThread::check_special_condition_for_native_trans)));
+      } else {
+        __ call(RuntimeAddress(CAST_FROM_FN_PTR(address, JavaThread::check_special_condition_for_native_trans_and_transition)));
+      }
+      __ mov(rsp, r12); // restore sp
+      __ reinit_heapbase();
+      // Restore any method result value
+      restore_native_result(masm, ret_type, stack_slots);
 
-    // Don't use call_VM as it will see a possible pending exception and forward it
-    // and never return here preventing us from clearing _last_native_pc down below.
-    // Also can't use call_VM_leaf either as it will check to see if rsi & rdi are
-    // preserved and correspond to the bcp/locals pointers. So we do a runtime call
-    // by hand.
-    //
-    __ vzeroupper();
-    save_native_result(masm, ret_type, stack_slots);
-    __ mov(c_rarg0, r15_thread);
-    __ mov(r12, rsp); // remember sp
-    __ subptr(rsp, frame::arg_reg_save_area_bytes); // windows
-    __ andptr(rsp, -16); // align stack as required by ABI
-    if (!is_critical_native) {
-      __ call(RuntimeAddress(CAST_FROM_FN_PTR(address, JavaThread::check_special_condition_for_native_trans)));
-    } else {
-      __ call(RuntimeAddress(CAST_FROM_FN_PTR(address, JavaThread::check_special_condition_for_native_trans_and_transition)));
-    }
-    __ mov(rsp, r12); // restore sp
-    __ reinit_heapbase();
-    // Restore any method result value
-    restore_native_result(masm, ret_type, stack_slots);
+      if (is_critical_native) {
+        // The call above performed the transition to thread_in_Java so
+        // skip the transition logic below.
+        __ jmpb(after_transition);
+      }
 
-    if (is_critical_native) {
-      // The call above performed the transition to thread_in_Java so
-      // skip the transition logic below.
-      __ jmpb(after_transition);
+      __ bind(Continue);
     }
 
-    __ bind(Continue);
+    // change thread state
+    __ movl(Address(r15_thread, JavaThread::thread_state_offset()), _thread_in_Java);
   }
-
-  // change thread state
-  __ movl(Address(r15_thread, JavaThread::thread_state_offset()), _thread_in_Java);
   __ bind(after_transition);
 
   Label reguard;
@@ -3751,6 +3760,18 @@ do {                                                            \
            : "r"(A), "a"(B) : "cc");                            \
  } while(0)
 
+// Add the triple-precision accumulator U0, U1, U2 into T0, T1, T2.
+#define ACC_ADD(U0, U1, U2, T0, T1, T2)                         \
+do {                                                            \
+  __asm__ ("add %3, %0; adc %4, %1; adc %5, %2"                 \
+           : "+r"(T0), "+r"(T1), "+r"(T2)                       \
+           : "r"(U0), "r"(U1), "g"(U2) : "cc");                 \
+ } while(0)
+
+// The inner loops below accumulate the a*b and m*n products into
+// separate accumulators, so the two add-with-carry chains can execute
+// in parallel; the accumulators are combined at the end of each column.
+
 // Fast Montgomery multiplication.  The derivation of the algorithm is
 // in  A Cryptographic Library for the Motorola DSP56000,
 // Dusse and Kaliski, Proc. EUROCRYPT 90, pp. 230-237.
@@ -3764,11 +3785,13 @@ montgomery_multiply(unsigned long a[], unsigned long b[], unsigned long n[],
   assert(inv * n[0] == -1UL, "broken inverse in Montgomery multiply");
 
   for (i = 0; i < len; i++) {
+    unsigned long u0 = 0, u1 = 0, u2 = 0;
     int j;
     for (j = 0; j < i; j++) {
       MACC(a[j], b[i-j], t0, t1, t2);
-      MACC(m[j], n[i-j], t0, t1, t2);
+      MACC(m[j], n[i-j], u0, u1, u2);
     }
+    ACC_ADD(u0, u1, u2, t0, t1, t2);
     MACC(a[i], b[0], t0, t1, t2);
     m[i] = t0 * inv;
     MACC(m[i], n[0], t0, t1, t2);
@@ -3779,11 +3802,13 @@ montgomery_multiply(unsigned long a[], unsigned long b[], unsigned long n[],
   }
 
   for (i = len; i < 2*len; i++) {
+    unsigned long u0 = 0, u1 = 0, u2 = 0;
     int j;
     for (j = i-len+1; j < len; j++) {
       MACC(a[j], b[i-j], t0, t1, t2);
-      MACC(m[j], n[i-j], t0, t1, t2);
+      MACC(m[j], n[i-j], u0, u1, u2);
     }
+    ACC_ADD(u0, u1, u2, t0, t1, t2);
     m[i-len] = t0;
     t0 = t1; t1 = t2; t2 = 0;
   }
@@ -3806,18 +3831,20 @@ montgomery_square(unsigned long a[], unsigned long n[],
   assert(inv * n[0] == -1UL, "broken inverse in Montgomery multiply");
 
   for (i = 0; i < len; i++) {
+    unsigned long u0 = 0, u1 = 0, u2 = 0;
     int j;
     int end = (i+1)/2;
     for (j = 0; j < end; j++) {
       MACC2(a[j], a[i-j], t0, t1, t2);
-      MACC(m[j], n[i-j], t0, t1, t2);
+      MACC(m[j], n[i-j], u0, u1, u2);
     }
     if ((i & 1) == 0) {
       MACC(a[j], a[j], t0, t1, t2);
     }
     for (; j < i; j++) {
-      MACC(m[j], n[i-j], t0, t1, t2);
+      MACC(m[j], n[i-j], u0, u1, u2);
     }
+    ACC_ADD(u0, u1, u2, t0, t1, t2);
     m[i] = t0 * inv;
     MACC(m[i], n[0], t0, t1, t2);
 
@@ -3827,19 +3854,21 @@ montgomery_square(unsigned long a[], unsigned long n[],
   }
 
   for (i = len; i < 2*len; i++) {
+    unsigned long u0 = 0, u1 = 0, u2 = 0;
     int start = i-len+1;
     int end = start + (len - start)/2;
     int j;
     for (j = start; j < end; j++) {
       MACC2(a[j], a[i-j], t0, t1, t2);
-      MACC(m[j], n[i-j], t0, t1, t2);
+      MACC(m[j], n[i-j], u0, u1, u2);
     }
     if ((i & 1) == 0) {
       MACC(a[j], a[j], t0, t1, t2);
     }
     for (; j < len; j++) {
-      MACC(m[j], n[i-j], t0, t1, t2);
+      MACC(m[j], n[i-j], u0, u1, u2);
     }
+    ACC_ADD(u0, u1, u2, t0, t1, t2);
     m[i-len] = t0;
     t0 = t1; t1 = t2; t2 = 0;
   }
@@ -2625,6 +2625,204 @@ class StubGenerator: public StubCodeGenerator {
     return start;
   }
 
+  // Store the low bytes of rax to [to, end) in units of 'size' bytes.
+  void generate_unsafe_setmemory_loop(Register to, Register end, int size, Label& L_exit) {
+    Label L_loop;
+    __ BIND(L_loop);
+    __ cmpptr(to, end);
+    __ jcc(Assembler::aboveEqual, L_exit);
+    switch (size) {
+      case 1: __ movb(Address(to, 0), rax); break;
+      case 2: __ movw(Address(to, 0), rax); break;
+      case 4: __ movl(Address(to, 0), rax); break;
+      case 8: __ movq(Address(to, 0), rax); break;
+      default: ShouldNotReachHere();
+    }
+    __ addptr(to, size);
+    __ jmp(L_loop);
+  }
+
+  //
+  //  Generate 'unsafe' set memory stub, for Unsafe.setMemory
+  //
+  //  Input:
+  //    c_rarg0   - destination address
+  //    c_rarg1   - byte count, can be zero
+  //    c_rarg2   - byte value
+  //
+  // Like Copy::fill_to_memory_atomic, the stores are done in the largest
+  // units the alignment of the address and of the count allow.
+  //
+  address generate_unsafe_setmemory(const char *name) {
+    Label L_long_aligned, L_int_aligned, L_short_aligned, L_exit;
+
+    const Register to    = c_rarg0;  // destination address
+    const Register size  = c_rarg1;  // byte count (size_t)
+    const Register value = c_rarg2;  // byte value
+    const Register end   = r10;
+    const Register bits  = r11;
+
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", name);
+    address start = __ pc();
+
+    __ enter(); // required for proper stackwalking of RuntimeStub frame
+
+    // Replicate the byte value into every byte of rax
+    __ movzbl(rax, value);
+    __ mov64(bits, 0x0101010101010101);
+    __ imulq(rax, bits);
+
+    __ lea(end, Address(to, size, Address::times_1));
+    __ mov(bits, to);
+    __ orptr(bits, size);
+
+    {
+      UnsafeCopyMemoryMark ucmm(this, true, true);
+      __ testb(bits, BytesPerLong-1);
+      __ jcc(Assembler::zero, L_long_aligned);
+      __ testb(bits, BytesPerInt-1);
+      __ jcc(Assembler::zero, L_int_aligned);
+      __ testb(bits, BytesPerShort-1);
+      __ jcc(Assembler::zero, L_short_aligned);
+      generate_unsafe_setmemory_loop(to, end, 1, L_exit);
+
+      __ BIND(L_short_aligned);
+      generate_unsafe_setmemory_loop(to, end, BytesPerShort, L_exit);
+
+      __ BIND(L_int_aligned);
+      generate_unsafe_setmemory_loop(to, end, BytesPerInt, L_exit);
+
+      __ BIND(L_long_aligned);
+      generate_unsafe_setmemory_loop(to, end, BytesPerLong, L_exit);
+
+      __ BIND(L_exit);
+    }
+
+    __ leave(); // required for proper stackwalking of RuntimeStub frame
+    __ ret(0);
+
+    return start;
+  }
+
+  // Copy and byte swap the elements of 'size' bytes between [from, from + count)
+  // and [to, to + count), forward or backward, using rax and r10 as temps.
+  void generate_unsafe_copyswap_loop(Register from, Register to, Register count,
+                                     int size, bool forward, Label& L_exit) {
+    const Register index = r10;
+    Label L_loop;
+
+    if (forward) {
+      __ xorptr(index, index);
+    } else {
+      __ mov(index, count);
+    }
+    __ BIND(L_loop);
+    if (forward) {
+      __ cmpptr(index, count);
+      __ jcc(Assembler::aboveEqual, L_exit);
+    } else {
+      __ testptr(index, index);
+      __ jcc(Assembler::zero, L_exit);
+      __ subptr(index, size);
+    }
+    Address src(from, index, Address::times_1);
+    Address dst(to, index, Address::times_1);
+    switch (size) {
+      case 2:
+        __ movzwl(rax, src);
+        __ bswapl(rax);
+        __ shrl(rax, 16);
+        __ movw(dst, rax);
+        break;
+      case 4:
+        __ movl(rax, src);
+        __ bswapl(rax);
+        __ movl(dst, rax);
+        break;
+      case 8:
+        __ movq(rax, src);
+        __ bswapq(rax);
+        __ movq(dst, rax);
+        break;
+      default:
+        ShouldNotReachHere();
+    }
+    if (forward) {
+      __ addptr(index, size);
+    }
+    __ jmp(L_loop);
+  }
+
+  //
+  //  Generate 'unsafe' copy swap stub, for Unsafe.copySwapMemory
+  //
+  //  Input:
+  //    c_rarg0   - source address
+  //    c_rarg1   - destination address
+  //    c_rarg2   - byte count, a multiple of the element size, can be zero
+  //    c_rarg3   - element size, 2, 4 or 8
+  //
+  // Like Copy::conjoint_swap, copies backward if the destination overlaps
+  // the source from above, and each element is copied atomically.
+  //
+  address generate_unsafe_copyswap(const char *name) {
+    Label L_forward, L_forward_2, L_forward_4;
+    Label L_backward, L_backward_2, L_backward_4;
+    Label L_exit;
+
+    const Register from      = c_rarg0;  // source address
+    const Register to        = c_rarg1;  // destination address
+    const Register count     = c_rarg2;  // byte count (size_t)
+    const Register elem_size = c_rarg3;  // element size (size_t)
+
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", name);
+    address start = __ pc();
+
+    __ enter(); // required for proper stackwalking of RuntimeStub frame
+
+    {
+      UnsafeCopyMemoryMark ucmm(this, true, true);
+
+      // Copy forward if to <= from || to >= from + count
+      __ cmpptr(to, from);
+      __ jcc(Assembler::belowEqual, L_forward);
+      __ lea(rax, Address(from, count, Address::times_1));
+      __ cmpptr(to, rax);
+      __ jcc(Assembler::below, L_backward);
+
+      __ BIND(L_forward);
+      __ cmpptr(elem_size, 2);
+      __ jcc(Assembler::equal, L_forward_2);
+      __ cmpptr(elem_size, 4);
+      __ jcc(Assembler::equal, L_forward_4);
+      generate_unsafe_copyswap_loop(from, to, count, 8, true, L_exit);
+      __ BIND(L_forward_2);
+      generate_unsafe_copyswap_loop(from, to, count, 2, true, L_exit);
+      __ BIND(L_forward_4);
+      generate_unsafe_copyswap_loop(from, to, count, 4, true, L_exit);
+
+      __ BIND(L_backward);
+      __ cmpptr(elem_size, 2);
+      __ jcc(Assembler::equal, L_backward_2);
+      __ cmpptr(elem_size, 4);
+      __ jcc(Assembler::equal, L_backward_4);
+      generate_unsafe_copyswap_loop(from, to, count, 8, false, L_exit);
+      __ BIND(L_backward_2);
+      generate_unsafe_copyswap_loop(from, to, count, 2, false, L_exit);
+      __ BIND(L_backward_4);
+      generate_unsafe_copyswap_loop(from, to, count, 4, false, L_exit);
+
+      __ BIND(L_exit);
+    }
+
+    __ leave(); // required for proper stackwalking of RuntimeStub frame
+    __ ret(0);
+
+    return start;
+  }
+
   // Perform range checks on the proposed arraycopy.
   // Kills temp, but nothing else.
   // Also, clean the sign bits of src_pos and dst_pos.
@@ -3068,6 +3266,8 @@ class StubGenerator: public StubCodeGenerator {
                                                               entry_jshort_arraycopy,
                                                               entry_jint_arraycopy,
                                                               entry_jlong_arraycopy);
+    StubRoutines::_unsafe_setmemory    = generate_unsafe_setmemory("unsafe_setmemory");
+    StubRoutines::_unsafe_copyswap     = generate_unsafe_copyswap("unsafe_copyswap");
     StubRoutines::_generic_arraycopy   = generate_generic_copy("generic_arraycopy",
                                                                entry_jbyte_arraycopy,
                                                                entry_jshort_arraycopy,
@@ -5342,6 +5542,177 @@ address generate_avx_ghash_processBlocks() {
     return start;
   }
 
+  /**
+   *  Arguments:
+   *
+   * Inputs:
+   *   c_rarg0   - int adler
+   *   c_rarg1   - byte* buff
+   *   c_rarg2   - int len
+   *
+   * Ouput:
+   *       rax   - int adler result
+   */
+  address generate_updateBytesAdler32() {
+    assert(UseAdler32Intrinsics, "need SSE4.1 instructions");
+
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", "updateBytesAdler32");
+
+    // Weights of the 16 bytes of a block in s2, as words: 16, 15, ..., 1
+    address ascale_table = __ pc();
+    __ emit_data64(0x000d000e000f0010, relocInfo::none);
+    __ emit_data64(0x0009000a000b000c, relocInfo::none);
+    __ emit_data64(0x0005000600070008, relocInfo::none);
+    __ emit_data64(0x0001000200030004, relocInfo::none);
+
+    address start = __ pc();
+
+    Label L_nmax, L_nmax_loop, L_tail, L_by16_loop, L_by1, L_by1_loop, L_do_mod, L_combine;
+
+    // Win64: rcx, rdx, r8, r9 (c_rarg0, c_rarg1, ...)
+    // Unix:  rdi, rsi, rdx, rcx, r8, r9 (c_rarg0, c_rarg1, ...)
+    // The arguments are first moved out of the way of divl, which uses rax and rdx.
+    const Register len   = r9;
+    const Register buff  = r11;
+    const Register s1    = r8;
+    const Register s2    = rcx;
+    const Register count = r10;
+    const Register base  = rbx;
+
+    const XMMRegister xbytes_lo = xmm0;
+    const XMMRegister xbytes_hi = xmm1;
+    const XMMRegister xscale_lo = xmm2;
+    const XMMRegister xscale_hi = xmm3;
+    const XMMRegister xsum      = xmm4;
+
+    // Largest n such that 255n(n+1)/2 + (n+1)(BASE-1) <= 2^32-1
+    const int BASE = 0xfff1;
+    const int NMAX = 0x15B0;
+    assert(NMAX % 16 == 0, "blocks of 16 bytes");
+
+    BLOCK_COMMENT("Entry:");
+    __ enter(); // required for proper stackwalking of RuntimeStub frame
+    __ push(base);
+
+    __ movl(len, c_rarg2);
+    __ movptr(buff, c_rarg1);
+    __ movl(rax, c_rarg0);
+
+    // s1 is the lower 16 bits of adler, s2 the upper 16 bits
+    __ movl(s2, rax);
+    __ shrl(s2, 16);
+    __ movl(s1, rax);
+    __ andl(s1, 0xffff);
+    __ movl(base, BASE);
+
+    __ movdqu(xscale_lo, ExternalAddress(ascale_table), rax);
+    __ movdqu(xscale_hi, ExternalAddress(ascale_table + 16), rax);
+
+    __ bind(L_nmax);
+    __ cmpl(len, NMAX);
+    __ jcc(Assembler::below, L_tail);
+    __ subl(len, NMAX);
+    __ movl(count, NMAX / 16);
+
+    __ bind(L_nmax_loop);
+    updateBytesAdler32_by16(s1, s2, buff, xbytes_lo, xbytes_hi, xscale_lo, xscale_hi, xsum);
+    __ decrementl(count);
+    __ jcc(Assembler::notZero, L_nmax_loop);
+
+    updateBytesAdler32_mod(s1, base);
+    updateBytesAdler32_mod(s2, base);
+    __ jmp(L_nmax);
+
+    // Less than NMAX bytes are left, so the sums cannot overflow
+    __ bind(L_tail);
+    __ testl(len, len);
+    __ jcc(Assembler::zero, L_combine);
+
+    __ bind(L_by16_loop);
+    __ cmpl(len, 16);
+    __ jcc(Assembler::below, L_by1);
+    updateBytesAdler32_by16(s1, s2, buff, xbytes_lo, xbytes_hi, xscale_lo, xscale_hi, xsum);
+    __ subl(len, 16);
+    __ jmp(L_by16_loop);
+
+    __ bind(L_by1);
+    __ testl(len, len);
+    __ jcc(Assembler::zero, L_do_mod);
+
+    __ bind(L_by1_loop);
+    __ movzbl(rax, Address(buff, 0));
+    __ addl(s1, rax);
+    __ addl(s2, s1);
+    __ incrementq(buff);
+    __ decrementl(len);
+    __ jcc(Assembler::notZero, L_by1_loop);
+
+    __ bind(L_do_mod);
+    updateBytesAdler32_mod(s1, base);
+    updateBytesAdler32_mod(s2, base);
+
+    // adler = s1 | (s2 << 16)
+    __ bind(L_combine);
+    __ shll(s2, 16);
+    __ orl(s1, s2);
+    __ movl(rax, s1);
+
+    __ pop(base);
+    __ vzeroupper();
+    __ leave(); // required for proper stackwalking of RuntimeStub frame
+    __ ret(0);
+
+    return start;
+  }
+
+  // Updates s1 and s2 for the next 16 bytes of buff. With b1, ..., b16 the
+  // bytes of the block this is:
+  //   s2 = s2 + s1 * 16 + (b1 * 16 + b2 * 15 + ... + b16 * 1)
+  //   s1 = s1 + b1 + b2 + ... + b16
+  void updateBytesAdler32_by16(Register s1, Register s2, Register buff,
+                               XMMRegister xbytes_lo, XMMRegister xbytes_hi,
+                               XMMRegister xscale_lo, XMMRegister xscale_hi,
+                               XMMRegister xsum) {
+    __ pmovzxbw(xbytes_lo, Address(buff, 0));
+    __ pmovzxbw(xbytes_hi, Address(buff, 8));
+
+    // xsum = b1 + ... + b16, at most 16 * 255 so it fits a word
+    __ movdqu(xsum, xbytes_lo);
+    __ paddw(xsum, xbytes_hi);
+    __ phaddw(xsum, xsum);
+    __ phaddw(xsum, xsum);
+    __ phaddw(xsum, xsum);
+
+    // xbytes_lo = b1 * 16 + ... + b16 * 1
+    __ pmaddwd(xbytes_lo, xscale_lo);
+    __ pmaddwd(xbytes_hi, xscale_hi);
+    __ paddd(xbytes_lo, xbytes_hi);
+    __ phaddd(xbytes_lo, xbytes_lo);
+    __ phaddd(xbytes_lo, xbytes_lo);
+
+    // s2 += s1 * 16, with s1 from before this block
+    __ movl(rax, s1);
+    __ shll(rax, 4);
+    __ addl(s2, rax);
+
+    __ movdl(rax, xsum);
+    __ andl(rax, 0xffff);
+    __ addl(s1, rax);
+    __ movdl(rax, xbytes_lo);
+    __ addl(s2, rax);
+
+    __ addptr(buff, 16);
+  }
+
+  // s = s % base, using rax and rdx
+  void updateBytesAdler32_mod(Register s, Register base) {
+    __ movl(rax, s);
+    __ xorl(rdx, rdx);
+    __ divl(base);
+    __ movl(s, rdx);
+  }
+
   /**
   *  Arguments:
   *
@@ -5517,6 +5888,170 @@ address generate_avx_ghash_processBlocks() {
     return start;
   }
 
+  // Multipliers of the vectorized polynomial hash: 31^(lanes-1), ..., 31^1, 31^0,
+  // followed by 31^lanes.
+  address generate_arrays_hashcode_powers(int lanes) {
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", "arrays_hashcode_powers");
+    address start = __ pc();
+
+    juint powers[17];
+    assert(lanes < (int)ARRAY_SIZE(powers), "too many lanes");
+    powers[lanes - 1] = 1;
+    for (int i = lanes - 2; i >= 0; i--) {
+      powers[i] = powers[i + 1] * 31;
+    }
+    powers[lanes] = powers[0] * 31;
+    for (int i = 0; i < lanes; i += 2) {
+      __ emit_data64(((jlong)powers[i + 1] << 32) | powers[i], relocInfo::none);
+    }
+    __ emit_data64(powers[lanes], relocInfo::none);
+
+    return start;
+  }
+
+  /**
+   *  Polynomial hash h = 31 * h + a[i] over an array range.
+   *
+   *  Input:
+   *    c_rarg0   - ary     address of the first element
+   *    c_rarg1   - cnt     number of elements
+   *    c_rarg2   - result  initial hash value
+   *
+   *  Output:
+   *        rax   - int hash
+   */
+  address generate_arrays_hashcode(BasicType eltype, const char* name, address powers, int lanes) {
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", name);
+    address start = __ pc();
+
+    const Register ary    = c_rarg0;
+    const Register cnt    = c_rarg1;
+    const Register tmp    = c_rarg2;
+    const Register result = rax;
+    const Register index  = r10;
+    const Register pow    = r11;
+
+    const XMMRegister vacc  = xmm0;
+    const XMMRegister vnext = xmm1;
+    const XMMRegister vmul  = xmm2;
+    const XMMRegister vcoef = xmm3;
+    const XMMRegister vtmp  = xmm4;
+
+    const int vlen = (lanes == 16) ? Assembler::AVX_512bit : Assembler::AVX_256bit;
+    const Address::ScaleFactor scale = Address::times(type2aelembytes(eltype));
+    juint vector_power = 1;
+    for (int i = 0; i < lanes; i++) {
+      vector_power *= 31;
+    }
+
+    Label L_vector_loop, L_scalar, L_scalar_loop, L_done;
+
+    BLOCK_COMMENT("Entry:");
+    __ enter();
+
+    __ movl(result, c_rarg2);
+    __ xorl(index, index);
+    __ cmpl(cnt, lanes);
+    __ jcc(Assembler::less, L_scalar);
+
+    // Each lane accumulates every lanes-th element:
+    //   acc = acc * 31^lanes + a[i .. i+lanes)
+    // which is folded into the hash afterwards as
+    //   h = h * 31^n + sum(acc[j] * 31^(lanes-1-j))
+    __ lea(tmp, ExternalAddress(powers));
+    if (vlen == Assembler::AVX_512bit) {
+      __ evmovdqul(vcoef, Address(tmp, 0), vlen);
+    } else {
+      __ vmovdqu(vcoef, Address(tmp, 0));
+    }
+    __ vpbroadcastd(vmul, Address(tmp, lanes * BytesPerInt), vlen);
+    __ vpxor(vacc, vacc, vacc, vlen);
+    __ movl(pow, 1);
+    __ movl(tmp, cnt);
+    __ andl(tmp, -lanes);
+
+    __ align(OptoLoopAlignment);
+    __ bind(L_vector_loop);
+    switch (eltype) {
+    case T_BOOLEAN:
+      __ vpmovzxbd(vnext, Address(ary, index, scale), vlen);
+      break;
+    case T_BYTE:
+      __ vpmovsxbd(vnext, Address(ary, index, scale), vlen);
+      break;
+    case T_CHAR:
+      __ vpmovzxwd(vnext, Address(ary, index, scale), vlen);
+      break;
+    case T_INT:
+      if (vlen == Assembler::AVX_512bit) {
+        __ evmovdqul(vnext, Address(ary, index, scale), vlen);
+      } else {
+        __ vmovdqu(vnext, Address(ary, index, scale));
+      }
+      break;
+    default:
+      ShouldNotReachHere();
+    }
+    __ vpmulld(vacc, vacc, vmul, vlen);
+    __ vpaddd(vacc, vacc, vnext, vlen);
+    __ imull(pow, pow, (jint)vector_power);
+    __ addl(index, lanes);
+    __ cmpl(index, tmp);
+    __ jcc(Assembler::less, L_vector_loop);
+
+    // Fold the lanes into the hash
+    __ imull(result, pow);
+    __ vpmulld(vacc, vacc, vcoef, vlen);
+    if (vlen == Assembler::AVX_512bit) {
+      __ vextracti64x4_high(vtmp, vacc);
+      __ vpaddd(vacc, vacc, vtmp, Assembler::AVX_256bit);
+    }
+    __ vextracti128_high(vtmp, vacc);
+    __ vpaddd(vacc, vacc, vtmp, Assembler::AVX_128bit);
+    __ vpshufd(vtmp, vacc, 0x4E, Assembler::AVX_128bit);
+    __ vpaddd(vacc, vacc, vtmp, Assembler::AVX_128bit);
+    __ vpshufd(vtmp, vacc, 0xB1, Assembler::AVX_128bit);
+    __ vpaddd(vacc, vacc, vtmp, Assembler::AVX_128bit);
+    __ movdl(tmp, vacc);
+    __ addl(result, tmp);
+
+    // Remaining elements one at a time
+    __ bind(L_scalar);
+    __ cmpl(index, cnt);
+    __ jcc(Assembler::greaterEqual, L_done);
+    __ bind(L_scalar_loop);
+    switch (eltype) {
+    case T_BOOLEAN:
+      __ movzbl(tmp, Address(ary, index, scale));
+      break;
+    case T_BYTE:
+      __ movsbl(tmp, Address(ary, index, scale));
+      break;
+    case T_CHAR:
+      __ movzwl(tmp, Address(ary, index, scale));
+      break;
+    case T_INT:
+      __ movl(tmp, Address(ary, index, scale));
+      break;
+    default:
+      ShouldNotReachHere();
+    }
+    __ imull(result, result, 31);
+    __ addl(result, tmp);
+    __ incrementl(index);
+    __ cmpl(index, cnt);
+    __ jcc(Assembler::less, L_scalar_loop);
+
+    __ bind(L_done);
+    __ vzeroupper();
+    __ leave();
+    __ ret(0);
+
+    return start;
+  }
+
 /**
    *  Arguments:
    *
@@ -6268,6 +6803,11 @@ address generate_avx_ghash_processBlocks() {
       StubRoutines::_sha512_implCompressMB = generate_sha512_implCompress(true, "sha512_implCompressMB");
     }
 
+    // Generate Adler32 intrinsics code
+    if (UseAdler32Intrinsics) {
+      StubRoutines::_updateBytesAdler32 = generate_updateBytesAdler32();
+    }
+
     // Generate GHASH intrinsics code
     if (UseGHASHIntrinsics) {
     StubRoutines::x86::_ghash_long_swap_mask_addr = generate_ghash_long_swap_mask();
@@ -6329,6 +6869,15 @@ address generate_avx_ghash_processBlocks() {
     if (UseVectorizedMismatchIntrinsic) {
       StubRoutines::_vectorizedMismatch = generate_vectorizedMismatch();
     }
+
+    if (UseVectorizedHashCodeIntrinsic) {
+      const int lanes = (UseAVX > 2) ? 16 : 8;
+      address powers = generate_arrays_hashcode_powers(lanes);
+      StubRoutines::_jbyte_hashcode  = generate_arrays_hashcode(T_BYTE,    "jbyte_hashcode",  powers, lanes);
+      StubRoutines::_jubyte_hashcode = generate_arrays_hashcode(T_BOOLEAN, "jubyte_hashcode", powers, lanes);
+      StubRoutines::_jchar_hashcode  = generate_arrays_hashcode(T_CHAR,    "jchar_hashcode",  powers, lanes);
+      StubRoutines::_jint_hashcode   = generate_arrays_hashcode(T_INT,     "jint_hashcode",   powers, lanes);
+    }
   }
 
  public:
@@ -6341,7 +6890,7 @@ address generate_avx_ghash_processBlocks() {
   }
 }; // end class declaration
 
-#define UCM_TABLE_MAX_ENTRIES 16
+#define UCM_TABLE_MAX_ENTRIES 18
 void StubGenerator_generate(CodeBuffer* code, bool all) {
   if (UnsafeCopyMemory::_table == NULL) {
     UnsafeCopyMemory::create_table(UCM_TABLE_MAX_ENTRIES);
@@ -623,7 +623,7 @@ void TemplateTable::nofast_iload() {
 void TemplateTable::iload_internal(RewriteControl rc) {
   transition(vtos, itos);
   if (RewriteFrequentPairs && rc == may_rewrite) {
-    Label rewrite, done;
+    Label rewrite, done, not_pair;
     const Register bc = LP64_ONLY(c_rarg3) NOT_LP64(rcx);
     LP64_ONLY(assert(rbx != bc, "register damaged"));
 
@@ -638,9 +638,21 @@ void TemplateTable::iload_internal(RewriteControl rc) {
     __ jcc(Assembler::equal, done);
 
     __ cmpl(rbx, Bytecodes::_fast_iload);
+    __ jccb(Assembler::notEqual, not_pair);
+
+    // if the pair is followed by _if_icmp<cond>, rewrite to
+    // _fast_iload2_if_icmp<cond>, else to _fast_iload2
+    __ load_unsigned_byte(rbx,
+                          at_bcp(2 * Bytecodes::length_for(Bytecodes::_iload)));
     __ movl(bc, Bytecodes::_fast_iload2);
+    __ subl(rbx, Bytecodes::_if_icmpeq);
+    __ cmpl(rbx, Bytecodes::_if_icmple - Bytecodes::_if_icmpeq);
+    __ jccb(Assembler::above, rewrite);
+    __ addl(rbx, Bytecodes::_fast_iload2_if_icmpeq);
+    __ movl(bc, rbx);
+    __ jmpb(rewrite);
 
-    __ jccb(Assembler::equal, rewrite);
+    __ bind(not_pair);
 
     // if _caload, rewrite to fast_icaload
     __ cmpl(rbx, Bytecodes::_caload);
@@ -671,6 +683,26 @@ void TemplateTable::fast_iload2() {
   __ movl(rax, iaddress(rbx));
 }
 
+// iload, iload, if_icmp<cond> fused into one template. The bcp is
+// stepped to the if_icmp before branching so that branch(), the
+// profile and any call into the VM see the bcp of the if_icmp.
+void TemplateTable::fast_iload2_if_icmp(Condition cc) {
+  transition(vtos, vtos);
+  locals_index(rbx);
+  __ movl(rdx, iaddress(rbx));
+  locals_index(rbx, 3);
+  __ movl(rax, iaddress(rbx));
+  __ addptr(rbcp, 2 * Bytecodes::length_for(Bytecodes::_iload));
+  // assume branch is more often taken than not (loops use backward branches)
+  Label not_taken;
+  __ cmpl(rdx, rax);
+  __ jcc(j_not(cc), not_taken);
+  branch(false, false);
+  __ bind(not_taken);
+  __ profile_not_taken_branch(rax);
+  __ dispatch_next(vtos, Bytecodes::length_for(Bytecodes::_if_icmpeq));
+}
+
 void TemplateTable::fast_iload() {
   transition(vtos, itos);
   locals_index(rbx);
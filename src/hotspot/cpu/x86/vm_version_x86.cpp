@@ -946,10 +946,23 @@ void VM_Version::get_processor_features() {
     FLAG_SET_DEFAULT(UseSHA, false);
   }
 
+#ifdef _LP64
+  if (supports_sse4_1()) {
+    if (FLAG_IS_DEFAULT(UseAdler32Intrinsics)) {
+      FLAG_SET_DEFAULT(UseAdler32Intrinsics, true);
+    }
+  } else if (UseAdler32Intrinsics) {
+    if (!FLAG_IS_DEFAULT(UseAdler32Intrinsics)) {
+      warning("Adler32 intrinsics require SSE4.1 instructions (not available on this CPU)");
+    }
+    FLAG_SET_DEFAULT(UseAdler32Intrinsics, false);
+  }
+#else
   if (UseAdler32Intrinsics) {
     warning("Adler32Intrinsics not available on this CPU.");
     FLAG_SET_DEFAULT(UseAdler32Intrinsics, false);
   }
+#endif
 
   if (!supports_rtm() && UseRTMLocking) {
     // Can't continue because UseRTMLocking affects UseBiasedLocking flag
@@ -1383,6 +1396,25 @@ void VM_Version::get_processor_features() {
   }
 #endif // _LP64
 
+#ifdef _LP64
+  if (UseAVX >= 2) {
+    if (FLAG_IS_DEFAULT(UseVectorizedHashCodeIntrinsic)) {
+      UseVectorizedHashCodeIntrinsic = true;
+    }
+  } else if (UseVectorizedHashCodeIntrinsic) {
+    if (!FLAG_IS_DEFAULT(UseVectorizedHashCodeIntrinsic))
+      warning("vectorizedHashCode intrinsics are not available on this CPU");
+    FLAG_SET_DEFAULT(UseVectorizedHashCodeIntrinsic, false);
+  }
+#else
+  if (UseVectorizedHashCodeIntrinsic) {
+    if (!FLAG_IS_DEFAULT(UseVectorizedHashCodeIntrinsic)) {
+      warning("vectorizedHashCode intrinsic is not available in 32-bit VM");
+    }
+    FLAG_SET_DEFAULT(UseVectorizedHashCodeIntrinsic, false);
+  }
+#endif // _LP64
+
   // Use count leading zeros count instruction if available.
   if (supports_lzcnt()) {
     if (FLAG_IS_DEFAULT(UseCountLeadingZerosInstruction)) {
@@ -1547,6 +1579,17 @@ void VM_Version::get_processor_features() {
     FLAG_SET_DEFAULT(UseUnalignedAccesses, true);
   }
 
+  // Critical natives called without a transition get raw pointers into
+  // unpinned arrays. This relies on objects only moving at a safepoint,
+  // which does not hold for collectors that relocate objects concurrently.
+  if (CriticalJNINativesWithoutTransition && (UseShenandoahGC || UseZGC)) {
+    if (!FLAG_IS_DEFAULT(CriticalJNINativesWithoutTransition)) {
+      warning("CriticalJNINativesWithoutTransition is not supported with collectors "
+              "that move objects concurrently");
+    }
+    FLAG_SET_DEFAULT(CriticalJNINativesWithoutTransition, false);
+  }
+
 #ifndef PRODUCT
   if (log_is_enabled(Info, os, cpu)) {
     LogStream ls(Log(os, cpu)::info());
@@ -170,12 +170,14 @@ VtableStub* VtableStubs::create_itable_stub(int itable_index) {
   //  rax: CompiledICHolder
   //  j_rarg0: Receiver
 
-  // Most registers are in use; we'll use rax, rbx, r10, r11
+  // Most registers are in use; we'll use rax, rbx, r10, r11, r13, r14
   // (various calling sequences use r[cd]x, r[sd]i, r[89]; stay away from them)
   const Register recv_klass_reg     = r10;
   const Register holder_klass_reg   = rax; // declaring interface klass (DECC)
-  const Register resolved_klass_reg = rbx; // resolved interface klass (REFC)
+  const Register resolved_klass_reg = r14; // resolved interface klass (REFC)
   const Register temp_reg           = r11;
+  const Register temp_reg2          = r13;
+  const Register method             = rbx;
 
   const Register icholder_reg = rax;
   __ movptr(resolved_klass_reg, Address(icholder_reg, CompiledICHolder::holder_klass_offset()));
@@ -190,37 +192,26 @@ VtableStub* VtableStubs::create_itable_stub(int itable_index) {
 
   start_pc = __ pc();
 
-  // Receiver subtype check against REFC.
-  // Destroys recv_klass_reg value.
-  __ lookup_interface_method(// inputs: rec. class, interface
-                             recv_klass_reg, resolved_klass_reg, noreg,
-                             // outputs:  scan temp. reg1, scan temp. reg2
-                             recv_klass_reg, temp_reg,
-                             L_no_such_interface,
-                             /*return_method=*/false);
-
-  const ptrdiff_t  typecheckSize = __ pc() - start_pc;
-  start_pc = __ pc();
-
-  // Get selected method from declaring class and itable index
-  const Register method = rbx;
-  __ load_klass(recv_klass_reg, j_rarg0);   // restore recv_klass_reg
-  __ lookup_interface_method(// inputs: rec. class, interface, itable index
-                             recv_klass_reg, holder_klass_reg, itable_index,
-                             // outputs: method, scan temp. reg
-                             method, temp_reg,
-                             L_no_such_interface);
+  // Receiver subtype check against REFC and selection of the method
+  // from DECC and itable index, in a single pass over the itable.
+  __ lookup_interface_method_stub(recv_klass_reg, // input
+                                  holder_klass_reg, // input
+                                  resolved_klass_reg, // input
+                                  method, // output
+                                  temp_reg,
+                                  temp_reg2,
+                                  itable_index,
+                                  L_no_such_interface);
 
   const ptrdiff_t  lookupSize = __ pc() - start_pc;
 
   // We expect we need index_dependent_slop extra bytes. Reason:
-  // The emitted code in lookup_interface_method changes when itable_index exceeds 15.
-  // For linux, a very narrow estimate would be 112, but Solaris requires some more space (130).
+  // The emitted code in lookup_interface_method_stub changes when itable_index exceeds 15.
   const ptrdiff_t estimate = 136;
-  const ptrdiff_t codesize = typecheckSize + lookupSize + index_dependent_slop;
+  const ptrdiff_t codesize = lookupSize + index_dependent_slop;
   slop_delta  = (int)(estimate - codesize);
   slop_bytes += slop_delta;
-  assert(slop_delta >= 0, "itable #%d: Code size estimate (%d) for lookup_interface_method too small, required: %d", itable_index, (int)estimate, (int)codesize);
+  assert(slop_delta >= 0, "itable #%d: Code size estimate (%d) for lookup_interface_method_stub too small, required: %d", itable_index, (int)estimate, (int)codesize);
 
   // If we take a trap while this arg is on the stack we will not
   // be able to walk the stack properly. This is not an issue except
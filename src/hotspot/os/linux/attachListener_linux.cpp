@@ -27,6 +27,7 @@
 #include "memory/allocation.inline.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/os.inline.hpp"
+#include "runtime/safepoint.hpp"
 #include "services/attachListener.hpp"
 #include "services/dtraceAttacher.hpp"
 
@@ -113,7 +114,14 @@ class LinuxAttachOperation: public AttachOperation {
   // the connection to the client
   int _socket;
 
+  // true once the result code has been sent ahead of the result data
+  bool _streaming;
+
+  // true once sending streamed output to the client failed
+  bool _stream_failed;
+
  public:
+  bool stream(bufferedStream* st);
   void complete(jint res, bufferedStream* st);
 
   void set_socket(int s)                                { _socket = s; }
@@ -121,6 +129,8 @@ class LinuxAttachOperation: public AttachOperation {
 
   LinuxAttachOperation(char* name) : AttachOperation(name) {
     set_socket(-1);
+    _streaming = false;
+    _stream_failed = false;
   }
 };
 
@@ -405,6 +415,29 @@ int LinuxAttachListener::write_fully(int s, char* buf, int len) {
 // if there are operations that involves a very big reply then it the
 // socket could be made non-blocking and a timeout could be used.
 
+// Send the output buffered so far, preceded by JNI_OK as the operation
+// result the first time. Once output has been streamed, a later failure of
+// the operation is only reported in its output. Output that cannot be sent
+// is dropped.
+
+bool LinuxAttachOperation::stream(bufferedStream* st) {
+  JavaThread* thread = JavaThread::current();
+  assert(thread->thread_state() == _thread_in_vm, "must be in the VM");
+  assert(!SafepointSynchronize::is_at_safepoint(), "must not block a safepoint");
+  ThreadBlockInVM tbivm(thread);
+
+  if (!_streaming) {
+    _streaming = true;
+    char msg[32];
+    sprintf(msg, "%d\n", JNI_OK);
+    _stream_failed = LinuxAttachListener::write_fully(this->socket(), msg, strlen(msg)) != 0;
+  }
+  if (!_stream_failed) {
+    _stream_failed = LinuxAttachListener::write_fully(this->socket(), (char*) st->base(), st->size()) != 0;
+  }
+  return true;
+}
+
 void LinuxAttachOperation::complete(jint result, bufferedStream* st) {
   JavaThread* thread = JavaThread::current();
   ThreadBlockInVM tbivm(thread);
@@ -413,10 +446,13 @@ void LinuxAttachOperation::complete(jint result, bufferedStream* st) {
   // cleared by handle_special_suspend_equivalent_condition() or
   // java_suspend_self() via check_and_wait_while_suspended()
 
-  // write operation result
-  char msg[32];
-  sprintf(msg, "%d\n", result);
-  int rc = LinuxAttachListener::write_fully(this->socket(), msg, strlen(msg));
+  // write operation result, unless it was sent with streamed result data
+  int rc = _stream_failed ? -1 : 0;
+  if (!_streaming) {
+    char msg[32];
+    sprintf(msg, "%d\n", result);
+    rc = LinuxAttachListener::write_fully(this->socket(), msg, strlen(msg));
+  }
 
   // write any result data
   if (rc == 0) {
@@ -67,6 +67,10 @@
           " of quotas (if set), when true. Otherwise, use the CPU"      \
           " shares value, provided it is less than quota.")             \
                                                                         \
+  product(bool, PerfDataUseMemfd, false,                                \
+          "Keep the PerfData shared memory in an anonymous memfd instead "\
+          "of a hsperfdata file in the temporary directory")            \
+                                                                        \
   product(bool, AdjustStackSizeForTLS, false,                           \
           "Increase the thread stack size to include space for glibc "  \
           "static thread-local storage (TLS) if true")                  \
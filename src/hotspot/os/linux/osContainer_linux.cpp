@@ -725,3 +725,50 @@ int OSContainer::cpu_shares() {
 
   return shares;
 }
+
+/* cpu_nr_periods
+ *
+ * Return the number of CFS enforcement periods that have
+ * elapsed for the container, from cpu.stat
+ *
+ * return:
+ *    number of elapsed periods
+ *    OSCONTAINER_ERROR for not supported
+ */
+jlong OSContainer::cpu_nr_periods() {
+  const char* format = "%s " JLONG_FORMAT;
+  GET_CONTAINER_INFO_LINE(jlong, cpu, "/cpu.stat", "nr_periods",
+                          "CPU Periods is: " JLONG_FORMAT, format, periods);
+  return periods;
+}
+
+/* cpu_nr_throttled
+ *
+ * Return the number of CFS periods in which the container
+ * exhausted its quota and was throttled, from cpu.stat
+ *
+ * return:
+ *    number of throttled periods
+ *    OSCONTAINER_ERROR for not supported
+ */
+jlong OSContainer::cpu_nr_throttled() {
+  const char* format = "%s " JLONG_FORMAT;
+  GET_CONTAINER_INFO_LINE(jlong, cpu, "/cpu.stat", "nr_throttled",
+                          "CPU Throttled Periods is: " JLONG_FORMAT, format, throttled);
+  return throttled;
+}
+
+/* cpu_throttled_time
+ *
+ * Return the total time the container has been throttled, from cpu.stat
+ *
+ * return:
+ *    throttled time in nanoseconds
+ *    OSCONTAINER_ERROR for not supported
+ */
+jlong OSContainer::cpu_throttled_time() {
+  const char* format = "%s " JLONG_FORMAT;
+  GET_CONTAINER_INFO_LINE(jlong, cpu, "/cpu.stat", "throttled_time",
+                          "CPU Throttled Time is: " JLONG_FORMAT, format, throttled_time);
+  return throttled_time;
+}
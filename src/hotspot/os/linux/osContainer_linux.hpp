@@ -65,6 +65,10 @@ class OSContainer: AllStatic {
 
   static int cpu_shares();
 
+  static jlong cpu_nr_periods();
+  static jlong cpu_nr_throttled();
+  static jlong cpu_throttled_time();
+
 };
 
 inline bool OSContainer::is_containerized() {
@@ -2354,7 +2354,31 @@ void os::Linux::print_container_info(outputStream* st) {
     st->print("%s\n", i == OSCONTAINER_ERROR ? "not supported" : "no shares");
   }
 
-  jlong j = OSContainer::memory_limit_in_bytes();
+  jlong j = OSContainer::cpu_nr_periods();
+  st->print("cpu_nr_periods: ");
+  if (j >= 0) {
+    st->print(JLONG_FORMAT "\n", j);
+  } else {
+    st->print("not supported\n");
+  }
+
+  j = OSContainer::cpu_nr_throttled();
+  st->print("cpu_nr_throttled: ");
+  if (j >= 0) {
+    st->print(JLONG_FORMAT "\n", j);
+  } else {
+    st->print("not supported\n");
+  }
+
+  j = OSContainer::cpu_throttled_time();
+  st->print("cpu_throttled_time: ");
+  if (j >= 0) {
+    st->print(JLONG_FORMAT " ns\n", j);
+  } else {
+    st->print("not supported\n");
+  }
+
+  j = OSContainer::memory_limit_in_bytes();
   st->print("memory_limit_in_bytes: ");
   if (j > 0) {
     st->print(JLONG_FORMAT "\n", j);
@@ -2956,6 +2980,34 @@ void os::pd_realign_memory(char *addr, size_t bytes, size_t alignment_hint) {
   }
 }
 
+// Define MADV_POPULATE_WRITE here so we can build HotSpot on old systems.
+#ifndef MADV_POPULATE_WRITE
+  #define MADV_POPULATE_WRITE 23
+#endif
+
+// Cleared once the kernel rejects MADV_POPULATE_WRITE (before Linux 5.14).
+static volatile bool populate_write_supported = true;
+
+bool os::pd_pretouch_memory(void* start, void* end, size_t page_size) {
+  if (!populate_write_supported) {
+    return false;
+  }
+  char* first = align_down((char*)start, vm_page_size());
+  if (first >= (char*)end) {
+    return true;
+  }
+  // Faulting in the whole range with one system call avoids taking a
+  // page fault for every page, and lets the kernel allocate transparent
+  // huge pages for aligned parts of the range directly.
+  if (::madvise(first, (char*)end - first, MADV_POPULATE_WRITE) == 0) {
+    return true;
+  }
+  if (errno == EINVAL) {
+    populate_write_supported = false;
+  }
+  return false;
+}
+
 void os::pd_free_memory(char *addr, size_t bytes, size_t alignment_hint) {
   // This method works by doing an mmap over an existing mmaping and effectively discarding
   // the existing pages. However it won't work for SHM-based large pages that cannot be
@@ -44,6 +44,15 @@
 # include <sys/stat.h>
 # include <signal.h>
 # include <pwd.h>
+# include <syscall.h>
+
+#ifndef MFD_CLOEXEC
+#define MFD_CLOEXEC 0x0001U
+#endif
+
+// name of the memfd backing store, as shown by /proc/<pid>/fd
+#define PERFDATA_MEMFD_NAME "hsperfdata"
+#define PERFDATA_MEMFD_LINK "/memfd:" PERFDATA_MEMFD_NAME " (deleted)"
 
 static char* backing_store_file_name = NULL;  // name of the backing store
                                               // file, if successfully created.
@@ -1054,6 +1063,68 @@ static char* mmap_create_shared(size_t size) {
   return mapAddress;
 }
 
+// create an anonymous shared memory region backed by a memfd. returns the
+// address of the memory region on success or NULL on failure.
+//
+// The region has no file system name, so its pages are never written back
+// to the disk holding the temporary directory. The descriptor is kept open
+// for the life of the process: monitoring applications find the region by
+// looking for the memfd in /proc/<pid>/fd.
+//
+static char* memfd_create_shared(size_t size) {
+#ifdef SYS_memfd_create
+  int result;
+  int fd = (int)::syscall(SYS_memfd_create, PERFDATA_MEMFD_NAME, MFD_CLOEXEC);
+  if (fd == OS_ERR) {
+    if (PrintMiscellaneous && Verbose) {
+      warning("memfd_create failed - %s\n", os::strerror(errno));
+    }
+    return NULL;
+  }
+
+  assert(((size > 0) && (size % os::vm_page_size() == 0)),
+         "unexpected PerfMemory region size");
+
+  // memfds are created with permissions 0777; restrict them like the
+  // backing store file.
+  RESTARTABLE(::fchmod(fd, S_IRUSR|S_IWUSR), result);
+  if (result != OS_ERR) {
+    RESTARTABLE(::ftruncate(fd, (off_t)size), result);
+  }
+  if (result != OS_ERR) {
+    // Allocate the pages up front, we'd get random SIGBUS crashes on
+    // memory accesses if the tmpfs limit is reached later.
+    result = posix_fallocate(fd, 0, (off_t)size) == 0 ? 0 : OS_ERR;
+  }
+  if (result == OS_ERR) {
+    if (PrintMiscellaneous && Verbose) {
+      warning("could not size memfd shared memory: %s\n", os::strerror(errno));
+    }
+    ::close(fd);
+    return NULL;
+  }
+
+  char* mapAddress = (char*)::mmap((char*)0, size, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+  if (mapAddress == MAP_FAILED) {
+    if (PrintMiscellaneous && Verbose) {
+      warning("mmap failed -  %s\n", os::strerror(errno));
+    }
+    ::close(fd);
+    return NULL;
+  }
+
+  // clear the shared memory region
+  (void)::memset((void*) mapAddress, 0, size);
+
+  // it does not go through os api, the operation has to record from here
+  MemTracker::record_virtual_memory_reserve_and_commit((address)mapAddress, size, CURRENT_PC, mtInternal);
+
+  return mapAddress;
+#else
+  return NULL;
+#endif
+}
+
 // release a named shared memory region
 //
 static void unmap_shared(char* addr, size_t bytes) {
@@ -1064,6 +1135,14 @@ static void unmap_shared(char* addr, size_t bytes) {
 //
 static char* create_shared_memory(size_t size) {
 
+  if (PerfDataUseMemfd) {
+    char* mapAddress = memfd_create_shared(size);
+    if (mapAddress != NULL) {
+      return mapAddress;
+    }
+    // fall back to a backing store file in the temporary directory
+  }
+
   // create the shared memory region.
   return mmap_create_shared(size);
 }
@@ -1114,14 +1193,97 @@ static size_t sharedmem_filesize(int fd, TRAPS) {
   return (size_t)statbuf.st_size;
 }
 
-// attach to a named shared memory region.
+// open the memfd backing store of the JVM indicated by the given vmid.
+// returns the file descriptor for the open memfd or -1 if the JVM does not
+// keep its PerfData memory in a memfd.
 //
-static void mmap_attach_shared(const char* user, int vmid, PerfMemory::PerfMemoryMode mode, char** addr, size_t* sizep, TRAPS) {
+// The /proc/<vmid>/fd links are only accessible to processes allowed to
+// ptrace the target, so they are not subject to the symlink checks of the
+// backing store files.
+//
+static int open_memfd_backing_store(int vmid, int oflags) {
+  char fddir[32];
+  jio_snprintf(fddir, sizeof(fddir), "/proc/%d/fd", vmid);
+
+  DIR* dirp = os::opendir(fddir);
+  if (dirp == NULL) {
+    return OS_ERR;
+  }
+
+  int fd = OS_ERR;
+  struct dirent* entry;
+  while (fd == OS_ERR && (entry = os::readdir(dirp)) != NULL) {
+    if (entry->d_name[0] == '.') {
+      continue;
+    }
+
+    char path[64];
+    char link[64];
+    jio_snprintf(path, sizeof(path), "%s/%s", fddir, entry->d_name);
+    ssize_t len = ::readlink(path, link, sizeof(link) - 1);
+    if (len <= 0) {
+      continue;
+    }
+    link[len] = '\0';
+
+    if (strcmp(link, PERFDATA_MEMFD_LINK) == 0) {
+      RESTARTABLE(os::open(path, oflags & ~O_NOFOLLOW, 0), fd);
+    }
+  }
+  os::closedir(dirp);
+
+  return fd;
+}
+
+// map the shared memory region open on the given file descriptor
+// and close the descriptor.
+//
+static void mmap_attach_fd(int fd, int vmid, int mmap_prot, char** addr, size_t* sizep, TRAPS) {
 
   char* mapAddress;
   int result;
-  int fd;
   size_t size = 0;
+
+  if (*sizep == 0) {
+    size = sharedmem_filesize(fd, THREAD);
+    if (HAS_PENDING_EXCEPTION) {
+      ::close(fd);
+      return;
+    }
+  } else {
+    size = *sizep;
+  }
+
+  assert(size > 0, "unexpected size <= 0");
+
+  mapAddress = (char*)::mmap((char*)0, size, mmap_prot, MAP_SHARED, fd, 0);
+
+  result = ::close(fd);
+  assert(result != OS_ERR, "could not close file");
+
+  if (mapAddress == MAP_FAILED) {
+    if (PrintMiscellaneous && Verbose) {
+      warning("mmap failed: %s\n", os::strerror(errno));
+    }
+    THROW_MSG(vmSymbols::java_lang_OutOfMemoryError(),
+              "Could not map PerfMemory");
+  }
+
+  // it does not go through os api, the operation has to record from here
+  MemTracker::record_virtual_memory_reserve_and_commit((address)mapAddress, size, CURRENT_PC, mtInternal);
+
+  *addr = mapAddress;
+  *sizep = size;
+
+  log_debug(perf, memops)("mapped " SIZE_FORMAT " bytes for vmid %d at "
+                          INTPTR_FORMAT, size, vmid, p2i((void*)mapAddress));
+}
+
+// attach to a named shared memory region.
+//
+static void mmap_attach_shared(const char* user, int vmid, PerfMemory::PerfMemoryMode mode, char** addr, size_t* sizep, TRAPS) {
+
+  int fd;
   const char* luser = NULL;
 
   int mmap_prot;
@@ -1149,6 +1311,13 @@ static void mmap_attach_shared(const char* user, int vmid, PerfMemory::PerfMemor
               "Illegal access mode");
   }
 
+  // a JVM running with -XX:+PerfDataUseMemfd has no backing store file
+  fd = open_memfd_backing_store(vmid, file_flags);
+  if (fd != OS_ERR) {
+    mmap_attach_fd(fd, vmid, mmap_prot, addr, sizep, THREAD);
+    return;
+  }
+
   // determine if vmid is for a containerized process
   int nspid = get_namespace_pid(vmid);
 
@@ -1204,35 +1373,7 @@ static void mmap_attach_shared(const char* user, int vmid, PerfMemory::PerfMemor
     return;
   }
 
-  if (*sizep == 0) {
-    size = sharedmem_filesize(fd, CHECK);
-  } else {
-    size = *sizep;
-  }
-
-  assert(size > 0, "unexpected size <= 0");
-
-  mapAddress = (char*)::mmap((char*)0, size, mmap_prot, MAP_SHARED, fd, 0);
-
-  result = ::close(fd);
-  assert(result != OS_ERR, "could not close file");
-
-  if (mapAddress == MAP_FAILED) {
-    if (PrintMiscellaneous && Verbose) {
-      warning("mmap failed: %s\n", os::strerror(errno));
-    }
-    THROW_MSG(vmSymbols::java_lang_OutOfMemoryError(),
-              "Could not map PerfMemory");
-  }
-
-  // it does not go through os api, the operation has to record from here
-  MemTracker::record_virtual_memory_reserve_and_commit((address)mapAddress, size, CURRENT_PC, mtInternal);
-
-  *addr = mapAddress;
-  *sizep = size;
-
-  log_debug(perf, memops)("mapped " SIZE_FORMAT " bytes for vmid %d at "
-                          INTPTR_FORMAT, size, vmid, p2i((void*)mapAddress));
+  mmap_attach_fd(fd, vmid, mmap_prot, addr, sizep, THREAD);
 }
 
 // create the PerfData memory region
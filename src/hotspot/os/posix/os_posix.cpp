@@ -481,6 +481,16 @@ bool os::get_host_name(char* buf, size_t buflen) {
   return true;
 }
 
+bool os::page_faults(jlong* minor, jlong* major) {
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return false;
+  }
+  *minor = (jlong)usage.ru_minflt;
+  *major = (jlong)usage.ru_majflt;
+  return true;
+}
+
 bool os::has_allocatable_memory_limit(julong* limit) {
   struct rlimit rlim;
   int getrlimit_res = getrlimit(RLIMIT_AS, &rlim);
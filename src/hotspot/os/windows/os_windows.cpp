@@ -3426,6 +3426,7 @@ bool os::unguard_memory(char* addr, size_t bytes) {
 }
 
 void os::pd_realign_memory(char *addr, size_t bytes, size_t alignment_hint) { }
+bool os::pd_pretouch_memory(void* start, void* end, size_t page_size) { return false; }
 void os::pd_free_memory(char *addr, size_t bytes, size_t alignment_hint) { }
 void os::numa_make_global(char *addr, size_t bytes)    { }
 void os::numa_make_local(char *addr, size_t bytes, int lgrp_hint)    { }
@@ -4429,6 +4430,18 @@ int os::loadavg(double loadavg[], int nelem) {
   return -1;
 }
 
+// The page fault count of Windows includes the soft faults, and there is no
+// separate count of the faults that needed disk I/O.
+bool os::page_faults(jlong* minor, jlong* major) {
+  PROCESS_MEMORY_COUNTERS pmc;
+  if (GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc)) == 0) {
+    return false;
+  }
+  *minor = (jlong)pmc.PageFaultCount;
+  *major = 0;
+  return true;
+}
+
 
 // DontYieldALot=false by default: dutifully perform all yields as requested by JVM_Yield()
 bool os::dont_yield() {
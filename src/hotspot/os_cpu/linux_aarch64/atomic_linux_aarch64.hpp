@@ -32,49 +32,113 @@
 // Note that memory_order_conservative requires a full barrier after atomic stores.
 // See https://patchwork.kernel.org/patch/3575821/
 
+// The read-modify-write operations call out to stubs. When the CPU has
+// the LSE atomic instructions, StubGenerator::generate_atomic_entry_points()
+// replaces the default implementations in atomic_linux_aarch64.s, which use
+// exclusive loads and stores, with stubs using these instructions. This
+// way the VM gets the LSE atomics without being built for them.
+
+typedef uint64_t (*aarch64_atomic_stub_t)(volatile void *ptr, uint64_t arg1, uint64_t arg2);
+
+extern aarch64_atomic_stub_t aarch64_atomic_fetch_add_4_impl;
+extern aarch64_atomic_stub_t aarch64_atomic_fetch_add_8_impl;
+extern aarch64_atomic_stub_t aarch64_atomic_xchg_4_impl;
+extern aarch64_atomic_stub_t aarch64_atomic_xchg_8_impl;
+extern aarch64_atomic_stub_t aarch64_atomic_cmpxchg_1_impl;
+extern aarch64_atomic_stub_t aarch64_atomic_cmpxchg_4_impl;
+extern aarch64_atomic_stub_t aarch64_atomic_cmpxchg_8_impl;
+extern aarch64_atomic_stub_t aarch64_atomic_cmpxchg_1_relaxed_impl;
+extern aarch64_atomic_stub_t aarch64_atomic_cmpxchg_4_relaxed_impl;
+extern aarch64_atomic_stub_t aarch64_atomic_cmpxchg_8_relaxed_impl;
+
+template <typename D, typename T1>
+inline D atomic_fastcall(aarch64_atomic_stub_t stub, volatile D *dest, T1 arg1) {
+  return (D)(*stub)(dest, (uint64_t)arg1, 0);
+}
+
+template <typename D, typename T1, typename T2>
+inline D atomic_fastcall(aarch64_atomic_stub_t stub, volatile D *dest, T1 arg1, T2 arg2) {
+  return (D)(*stub)(dest, (uint64_t)arg1, (uint64_t)arg2);
+}
+
 template<size_t byte_size>
 struct Atomic::PlatformAdd
-  : Atomic::AddAndFetch<Atomic::PlatformAdd<byte_size> >
+  : Atomic::FetchAndAdd<Atomic::PlatformAdd<byte_size> >
 {
   template<typename D, typename I>
-  D add_and_fetch(D volatile* dest, I add_value, atomic_memory_order order) const {
-    D res = __atomic_add_fetch(dest, add_value, __ATOMIC_RELEASE);
-    FULL_MEM_BARRIER;
-    return res;
-  }
+  D fetch_and_add(D volatile* dest, I add_value, atomic_memory_order order) const;
 };
 
-template<size_t byte_size>
+template<>
+template<typename D, typename I>
+inline D Atomic::PlatformAdd<4>::fetch_and_add(D volatile* dest, I add_value,
+                                               atomic_memory_order order) const {
+  STATIC_ASSERT(4 == sizeof(I));
+  STATIC_ASSERT(4 == sizeof(D));
+  return atomic_fastcall(aarch64_atomic_fetch_add_4_impl, dest, add_value);
+}
+
+template<>
+template<typename D, typename I>
+inline D Atomic::PlatformAdd<8>::fetch_and_add(D volatile* dest, I add_value,
+                                               atomic_memory_order order) const {
+  STATIC_ASSERT(8 == sizeof(I));
+  STATIC_ASSERT(8 == sizeof(D));
+  return atomic_fastcall(aarch64_atomic_fetch_add_8_impl, dest, add_value);
+}
+
+template<>
 template<typename T>
-inline T Atomic::PlatformXchg<byte_size>::operator()(T volatile* dest,
-                                                     T exchange_value,
-                                                     atomic_memory_order order) const {
-  STATIC_ASSERT(byte_size == sizeof(T));
-  T res = __atomic_exchange_n(dest, exchange_value, __ATOMIC_RELEASE);
-  FULL_MEM_BARRIER;
-  return res;
+inline T Atomic::PlatformXchg<4>::operator()(T volatile* dest,
+                                             T exchange_value,
+                                             atomic_memory_order order) const {
+  STATIC_ASSERT(4 == sizeof(T));
+  return atomic_fastcall(aarch64_atomic_xchg_4_impl, dest, exchange_value);
 }
 
-template<size_t byte_size>
+template<>
+template<typename T>
+inline T Atomic::PlatformXchg<8>::operator()(T volatile* dest,
+                                             T exchange_value,
+                                             atomic_memory_order order) const {
+  STATIC_ASSERT(8 == sizeof(T));
+  return atomic_fastcall(aarch64_atomic_xchg_8_impl, dest, exchange_value);
+}
+
+template<>
+template<typename T>
+inline T Atomic::PlatformCmpxchg<1>::operator()(T volatile* dest,
+                                                T compare_value,
+                                                T exchange_value,
+                                                atomic_memory_order order) const {
+  STATIC_ASSERT(1 == sizeof(T));
+  aarch64_atomic_stub_t stub = (order == memory_order_relaxed) ?
+    aarch64_atomic_cmpxchg_1_relaxed_impl : aarch64_atomic_cmpxchg_1_impl;
+  return atomic_fastcall(stub, dest, compare_value, exchange_value);
+}
+
+template<>
+template<typename T>
+inline T Atomic::PlatformCmpxchg<4>::operator()(T volatile* dest,
+                                                T compare_value,
+                                                T exchange_value,
+                                                atomic_memory_order order) const {
+  STATIC_ASSERT(4 == sizeof(T));
+  aarch64_atomic_stub_t stub = (order == memory_order_relaxed) ?
+    aarch64_atomic_cmpxchg_4_relaxed_impl : aarch64_atomic_cmpxchg_4_impl;
+  return atomic_fastcall(stub, dest, compare_value, exchange_value);
+}
+
+template<>
 template<typename T>
-inline T Atomic::PlatformCmpxchg<byte_size>::operator()(T volatile* dest,
-                                                        T compare_value,
-                                                        T exchange_value,
-                                                        atomic_memory_order order) const {
-  STATIC_ASSERT(byte_size == sizeof(T));
-  if (order == memory_order_relaxed) {
-    T value = compare_value;
-    __atomic_compare_exchange(dest, &value, &exchange_value, /*weak*/false,
-                              __ATOMIC_RELAXED, __ATOMIC_RELAXED);
-    return value;
-  } else {
-    T value = compare_value;
-    FULL_MEM_BARRIER;
-    __atomic_compare_exchange(dest, &value, &exchange_value, /*weak*/false,
-                              __ATOMIC_RELAXED, __ATOMIC_RELAXED);
-    FULL_MEM_BARRIER;
-    return value;
-  }
+inline T Atomic::PlatformCmpxchg<8>::operator()(T volatile* dest,
+                                                T compare_value,
+                                                T exchange_value,
+                                                atomic_memory_order order) const {
+  STATIC_ASSERT(8 == sizeof(T));
+  aarch64_atomic_stub_t stub = (order == memory_order_relaxed) ?
+    aarch64_atomic_cmpxchg_8_relaxed_impl : aarch64_atomic_cmpxchg_8_impl;
+  return atomic_fastcall(stub, dest, compare_value, exchange_value);
 }
 
 template<size_t byte_size>
@@ -827,6 +827,30 @@ bool AOTCodeHeap::load_klass_data(InstanceKlass* ik, Thread* thread) {
   // Initialize global symbols of the DSO to the corresponding VM symbol values.
   link_global_lib_symbols();
 
+  if (AOTLazyLoading) {
+    // Looking up and publishing the compiled methods is the expensive part;
+    // defer it until the class is actually used (see load_pending_methods()).
+    ik->set_has_pending_aot_methods(true);
+    return true;
+  }
+  load_klass_methods(ik, klass_data, thread);
+  return true;
+}
+
+void AOTCodeHeap::load_pending_methods(InstanceKlass* ik, Thread* thread) {
+  AOTKlassData* klass_data = find_klass(ik);
+  if (klass_data == NULL || ik->has_been_redefined()) {
+    return;
+  }
+  AOTClass* aot_class = &_classes[klass_data->_class_id];
+  if (aot_class->_classloader != ik->class_loader_data()) {
+    return; // the class was not accepted from this library
+  }
+  load_klass_methods(ik, klass_data, thread);
+}
+
+void AOTCodeHeap::load_klass_methods(InstanceKlass* ik, AOTKlassData* klass_data, Thread* thread) {
+  ResourceMark rm;
   int methods_offset = klass_data->_compiled_methods_offset;
   if (methods_offset >= 0) {
     address methods_cnt_adr = _methods_offsets + methods_offset;
@@ -858,7 +882,6 @@ bool AOTCodeHeap::load_klass_data(InstanceKlass* ik, Thread* thread) {
       publish_aot(mh, method_data, code_id);
     }
   }
-  return true;
 }
 
 AOTCompiledMethod* AOTCodeHeap::next_in_use_at(int start) const {
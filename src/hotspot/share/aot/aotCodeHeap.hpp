@@ -222,7 +222,7 @@ class AOTCodeHeap : public CodeHeap {
   void link_global_lib_symbols();
   void link_primitive_array_klasses();
   void publish_aot(const methodHandle& mh, AOTMethodData* method_data, int code_id);
-
+  void load_klass_methods(InstanceKlass* ik, AOTKlassData* klass_data, Thread* thread);
 
   AOTCompiledMethod* next_in_use_at(int index) const;
 
@@ -241,6 +241,7 @@ public:
 
   AOTKlassData* find_klass(InstanceKlass* ik);
   bool load_klass_data(InstanceKlass* ik, Thread* thread);
+  void load_pending_methods(InstanceKlass* ik, Thread* thread);
   Klass* get_klass_from_got(const char* klass_name, int klass_len, const Method* method);
 
   bool is_dependent_method(Klass* dependee, AOTCompiledMethod* aot);
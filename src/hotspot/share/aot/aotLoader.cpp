@@ -56,6 +56,17 @@ void AOTLoader::load_for_klass(InstanceKlass* ik, Thread* thread) {
   }
 }
 
+// With AOTLazyLoading, publish the compiled methods of a class loaded by
+// load_for_klass() the first time it is used. Only one thread does it.
+void AOTLoader::load_pending_methods(InstanceKlass* ik, Thread* thread) {
+  assert(UseAOT && AOTLazyLoading, "called only for lazy AOT loading");
+  if (ik->claim_pending_aot_methods()) {
+    FOR_ALL_AOT_HEAPS(heap) {
+      (*heap)->load_pending_methods(ik, thread);
+    }
+  }
+}
+
 uint64_t AOTLoader::get_saved_fingerprint(InstanceKlass* ik) {
   assert(UseAOT, "called only when AOT is enabled");
   if (ik->is_unsafe_anonymous()) {
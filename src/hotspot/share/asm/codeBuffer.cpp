@@ -543,6 +543,9 @@ static void append_oop_references(GrowableArray<oop>* oops, Klass* k) {
 }
 
 void CodeBuffer::finalize_oop_references(const methodHandle& mh) {
+  if (_oop_references_finalized) {
+    return;
+  }
   NoSafepointVerifier nsv;
 
   GrowableArray<oop> oops;
@@ -608,6 +611,7 @@ void CodeBuffer::finalize_oop_references(const methodHandle& mh) {
   for (int i = 0; i < oops.length(); i++) {
     oop_recorder()->find_index((jobject)thread->handle_area()->allocate_handle(oops.at(i)));
   }
+  _oop_references_finalized = true;
 }
 
 
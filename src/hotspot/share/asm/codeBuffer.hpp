@@ -385,6 +385,7 @@ class CodeBuffer: public StackObj {
   bool         _collect_comments;      // Indicate if we need to collect block comments at all.
   OopRecorder  _default_oop_recorder;  // override with initialize_oop_recorder
   Arena*       _overflow_arena;
+  bool         _oop_references_finalized; // finalize_oop_references() has run
 
   address      _last_insn;      // used to merge consecutive memory barriers, loads or stores.
 
@@ -404,6 +405,7 @@ class CodeBuffer: public StackObj {
     _oop_recorder    = NULL;
     _decode_begin    = NULL;
     _overflow_arena  = NULL;
+    _oop_references_finalized = false;
     _code_strings    = CodeStrings();
     _last_insn       = NULL;
 #if INCLUDE_AOT
@@ -569,7 +571,9 @@ class CodeBuffer: public StackObj {
   bool insts_contains(address pc) const  { return _insts.contains(pc); }
   bool insts_contains2(address pc) const { return _insts.contains2(pc); }
 
-  // Record any extra oops required to keep embedded metadata alive
+  // Record any extra oops required to keep embedded metadata alive.
+  // Only the first call does any work, so a compiler may do it early,
+  // before taking the locks held while the nmethod is created.
   void finalize_oop_references(const methodHandle& method);
 
   // Allocated size in all sections, when aligned and concatenated
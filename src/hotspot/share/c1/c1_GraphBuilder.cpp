@@ -1816,6 +1816,30 @@ Values* GraphBuilder::collect_args_for_profiling(Values* args, ciMethod* target,
 }
 
 
+// Return the receiver class of a call site if its profile saw only one
+// receiver class, speculation is enabled and did not fail before.
+ciInstanceKlass* GraphBuilder::profiled_receiver_klass() {
+  if (!C1InlineProfiledReceiver || PatchALot ||
+      compilation()->env()->comp_level() == CompLevel_full_profile) {
+    return NULL;
+  }
+  ciMethodData* root_md = compilation()->method()->method_data_or_null();
+  if (root_md != NULL && root_md->trap_count(Deoptimization::Reason_profiled_receiver_check) > 0) {
+    return NULL;
+  }
+  ciCallProfile profile = method()->call_profile_at_bci(bci());
+  if (profile.morphism() != 1 || !profile.has_receiver(0)) {
+    return NULL;
+  }
+  ciKlass* receiver = profile.receiver(0);
+  if (!receiver->is_loaded() || !receiver->is_instance_klass() ||
+      receiver->as_instance_klass()->is_interface() ||
+      !receiver->as_instance_klass()->is_initialized()) {
+    return NULL;
+  }
+  return receiver->as_instance_klass();
+}
+
 void GraphBuilder::invoke(Bytecodes::Code code) {
   bool will_link;
   ciSignature* declared_signature = NULL;
@@ -1985,6 +2009,28 @@ void GraphBuilder::invoke(Bytecodes::Code code) {
         }
       }
     }
+
+    if (cha_monomorphic_target == NULL && exact_target == NULL && better_receiver == NULL &&
+        receiver != NULL && (code == Bytecodes::_invokevirtual || code == Bytecodes::_invokeinterface)) {
+      // Bind the call to the method of the only receiver class seen by
+      // the profile and check the receiver's class, deoptimizing on
+      // failure. Code at the full profile level collects the profiles
+      // for C2, so it keeps the virtual call.
+      ciInstanceKlass* profiled_klass = profiled_receiver_klass();
+      if (profiled_klass != NULL) {
+        ciMethod* profiled_target = target->resolve_invoke(calling_klass, profiled_klass);
+        if (profiled_target != NULL && profiled_target->is_loaded() && !profiled_target->is_abstract()) {
+          CheckCast* c = new CheckCast(profiled_klass, receiver, copy_state_before());
+          c->set_profiled_receiver_check();
+          c->set_direct_compare(true);
+          better_receiver = append_split(c);
+          exact_target = profiled_target;
+          target = profiled_target;
+          klass = profiled_target->holder();
+          code = Bytecodes::_invokespecial;
+        }
+      }
+    }
   }
 
   if (cha_monomorphic_target != NULL) {
@@ -255,6 +255,7 @@ class GraphBuilder {
   void method_return(Value x, bool ignore_return = false);
   void call_register_finalizer();
   void access_field(Bytecodes::Code code);
+  ciInstanceKlass* profiled_receiver_klass();
   void invoke(Bytecodes::Code code);
   void new_instance(int klass_index);
   void new_type_array();
@@ -373,6 +373,7 @@ class Instruction: public CompilationResourceObj {
     NeedsPatchingFlag,
     ThrowIncompatibleClassChangeErrorFlag,
     InvokeSpecialReceiverCheckFlag,
+    ProfiledReceiverCheckFlag,
     ProfileMDOFlag,
     IsLinkedInBlockFlag,
     NeedsRangeCheckFlag,
@@ -1462,9 +1463,17 @@ LEAF(CheckCast, TypeCheck)
   bool is_invokespecial_receiver_check() const {
     return check_flag(InvokeSpecialReceiverCheckFlag);
   }
+  // Speculative check of the receiver against its profiled class,
+  // which deoptimizes and invalidates the code on failure.
+  void set_profiled_receiver_check() {
+    set_flag(ProfiledReceiverCheckFlag, true);
+  }
+  bool is_profiled_receiver_check() const {
+    return check_flag(ProfiledReceiverCheckFlag);
+  }
 
   virtual bool needs_exception_state() const {
-    return !is_invokespecial_receiver_check();
+    return !is_invokespecial_receiver_check() && !is_profiled_receiver_check();
   }
 
   ciType* declared_type() const;
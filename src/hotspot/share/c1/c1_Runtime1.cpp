@@ -746,6 +746,13 @@ JRT_ENTRY(void, Runtime1::deoptimize(JavaThread* thread, jint trap_request))
         if (trap_mdo != NULL) {
           trap_mdo->inc_tenure_traps();
         }
+      } else if (reason == Deoptimization::Reason_profiled_receiver_check) {
+        // A profiled receiver check failed. Record it so that the
+        // recompiled code does not speculate on the receiver again.
+        MethodData* trap_mdo = Deoptimization::get_method_data(thread, method, true /*create_if_missing*/);
+        if (trap_mdo != NULL) {
+          trap_mdo->inc_trap_count(reason);
+        }
       }
     }
   }
@@ -374,10 +374,15 @@ void LoopInvariantCodeMotion::process_block(BlockBegin* block) {
 
     if (cur->as_Constant() != NULL) {
       cur_invariant = !cur->can_trap();
-    } else if (cur->as_ArithmeticOp() != NULL || cur->as_LogicOp() != NULL || cur->as_ShiftOp() != NULL) {
+    } else if (cur->as_ArithmeticOp() != NULL || cur->as_LogicOp() != NULL || cur->as_ShiftOp() != NULL ||
+               cur->as_CompareOp() != NULL) {
       assert(cur->as_Op2() != NULL, "must be Op2");
       Op2* op2 = (Op2*)cur;
       cur_invariant = !op2->can_trap() && is_invariant(op2->x()) && is_invariant(op2->y());
+    } else if (cur->as_Convert() != NULL) {
+      cur_invariant = is_invariant(cur->as_Convert()->value());
+    } else if (cur->as_NegateOp() != NULL) {
+      cur_invariant = is_invariant(cur->as_NegateOp()->x());
     } else if (cur->as_LoadField() != NULL) {
       LoadField* lf = (LoadField*)cur;
       // deoptimizes on NullPointerException
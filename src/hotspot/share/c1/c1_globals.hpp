@@ -159,6 +159,17 @@
   product(bool, InlineSynchronizedMethods, true,                            \
           "Inline synchronized methods")                                    \
                                                                             \
+  diagnostic(intx, C1ProfileReceiverSampleRate, 1,                          \
+          "Update the receiver type profile of virtual calls in tier 3 "    \
+          "code only once every this many calls per thread, weighting "     \
+          "each update accordingly (x86_64 only)")                          \
+          range(1, 1024)                                                    \
+                                                                            \
+  diagnostic(bool, C1InlineProfiledReceiver, true,                          \
+          "Bind virtual and interface calls whose receiver profile is "     \
+          "monomorphic to the profiled receiver's method behind a "        \
+          "deoptimizing receiver class check, at the non-profiling levels") \
+                                                                            \
   diagnostic(bool, InlineNIOCheckIndex, true,                               \
           "Intrinsify java.nio.Buffer.checkIndex")                          \
                                                                             \
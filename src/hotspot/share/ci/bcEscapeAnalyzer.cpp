@@ -314,7 +314,7 @@ void BCEscapeAnalyzer::invoke(StateInfo &state, Bytecodes::Code code, ciMethod*
 
   if (inline_target != NULL && !is_recursive_call(inline_target)) {
     // analyze callee
-    BCEscapeAnalyzer analyzer(inline_target, this);
+    BCEscapeAnalyzer* analyzer = inline_target->get_bcea(this);
 
     // adjust escape state of actual parameters
     bool must_record_dependencies = false;
@@ -326,19 +326,19 @@ void BCEscapeAnalyzer::invoke(StateInfo &state, Bytecodes::Code code, ciMethod*
         continue;
       for (int j = 0; j < _arg_size; j++) {
         if (arg.contains(j)) {
-          _arg_modified[j] |= analyzer._arg_modified[i];
+          _arg_modified[j] |= analyzer->_arg_modified[i];
         }
       }
       if (!(is_arg_stack(arg) || allocated)) {
         // arguments have already been recognized as escaping
-      } else if (analyzer.is_arg_stack(i) && !analyzer.is_arg_returned(i)) {
+      } else if (analyzer->is_arg_stack(i) && !analyzer->is_arg_returned(i)) {
         set_method_escape(arg);
         must_record_dependencies = true;
       } else {
         set_global_escape(arg);
       }
     }
-    _unknown_modified = _unknown_modified || analyzer.has_non_arg_side_affects();
+    _unknown_modified = _unknown_modified || analyzer->has_non_arg_side_affects();
 
     // record dependencies if at least one parameter retained stack-allocatable
     if (must_record_dependencies) {
@@ -347,7 +347,7 @@ void BCEscapeAnalyzer::invoke(StateInfo &state, Bytecodes::Code code, ciMethod*
         _dependencies.append(actual_recv);
         _dependencies.append(inline_target);
       }
-      _dependencies.appendAll(analyzer.dependencies());
+      _dependencies.appendAll(analyzer->dependencies());
     }
   } else {
     TRACE_BCEA(1, tty->print_cr("[EA] virtual method %s is not monomorphic.",
@@ -1351,10 +1351,16 @@ bool ciMethod::is_unboxing_method() const {
   return false;
 }
 
-BCEscapeAnalyzer  *ciMethod::get_bcea() {
+// Escape analysis of this method, either for the compilation itself or,
+// with a parent, as a callee of another analyzed method.  The result is
+// kept for the whole compilation: one computed at a smaller depth had
+// more budget for its own callees, so it is at least as precise and also
+// answers the requests at greater depths.
+BCEscapeAnalyzer  *ciMethod::get_bcea(BCEscapeAnalyzer* parent) {
 #ifdef COMPILER2
-  if (_bcea == NULL) {
-    _bcea = new (CURRENT_ENV->arena()) BCEscapeAnalyzer(this, NULL);
+  int level = (parent == NULL) ? 0 : parent->level() + 1;
+  if (_bcea == NULL || _bcea->level() > level) {
+    _bcea = new (CURRENT_ENV->arena()) BCEscapeAnalyzer(this, parent);
   }
   return _bcea;
 #else // COMPILER2
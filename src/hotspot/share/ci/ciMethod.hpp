@@ -211,7 +211,7 @@ class ciMethod : public ciMetadata {
     address bcp = code() + bci;
     return Bytecodes::code_at(NULL, bcp);
   }
-  BCEscapeAnalyzer  *get_bcea();
+  BCEscapeAnalyzer  *get_bcea(BCEscapeAnalyzer* parent = NULL);
   ciMethodBlocks    *get_method_blocks();
 
   bool    has_linenumber_table() const;          // length unknown until decompression
@@ -57,15 +57,12 @@
 // which ensures that for each oop, at most one ciObject is created.
 // This invariant allows more efficient implementation of ciObject.
 //
-// Implementation note: the oop->ciObject mapping is represented as
-// a table stored in an array.  Even though objects are moved
-// by the garbage collector, the compactor preserves their relative
-// order; address comparison of oops (in perm space) is safe so long
-// as we prohibit GC during our comparisons.  We currently use binary
-// search to find the oop in the table, and inserting a new oop
-// into the table may be costly.  If this cost ends up being
-// problematic the underlying data structure can be switched to some
-// sort of balanced binary tree.
+// Implementation note: the Metadata->ciMetadata mapping is represented
+// as an array in creation order, indexed by an open hash table keyed by
+// the Metadata address.  Metadata does not move, so the addresses are
+// stable for the whole compilation.  A large compilation creates
+// thousands of ciMetadata; a lookup and an insertion cost O(1), where
+// the sorted array used before paid O(n) for each insertion.
 
 GrowableArray<ciMetadata*>* ciObjectFactory::_shared_ci_metadata = NULL;
 ciSymbol*                 ciObjectFactory::_shared_ci_symbols[vmSymbols::SID_LIMIT];
@@ -85,12 +82,13 @@ ciObjectFactory::ciObjectFactory(Arena* arena,
 
   _next_ident = _shared_ident_limit;
   _arena = arena;
-  _ci_metadata = new (arena) GrowableArray<ciMetadata*>(arena, expected_size, 0, NULL);
+  int shared_count = _shared_ci_metadata != NULL ? _shared_ci_metadata->length() : 0;
+  init_metadata_table(expected_size + shared_count);
 
   // If the shared ci objects exist append them to this factory's objects
 
-  if (_shared_ci_metadata != NULL) {
-    _ci_metadata->appendAll(_shared_ci_metadata);
+  for (int i = 0; i < shared_count; i++) {
+    add_metadata(_shared_ci_metadata->at(i));
   }
 
   _unloaded_methods = new (arena) GrowableArray<ciMethod*>(arena, 4, 0, NULL);
@@ -145,7 +143,7 @@ void ciObjectFactory::init_shared_objects() {
 #endif
   }
 
-  _ci_metadata = new (_arena) GrowableArray<ciMetadata*>(_arena, 64, 0, NULL);
+  init_metadata_table(64);
 
   for (int i = T_BOOLEAN; i <= T_CONFLICT; i++) {
     BasicType t = (BasicType)i;
@@ -260,11 +258,54 @@ ciObject* ciObjectFactory::get(oop key) {
   return new_object;
 }
 
-int ciObjectFactory::metadata_compare(Metadata* const& key, ciMetadata* const& elt) {
-  Metadata* value = elt->constant_encoding();
-  if (key < value)      return -1;
-  else if (key > value) return 1;
-  else                  return 0;
+// ------------------------------------------------------------------
+// ciObjectFactory::init_metadata_table
+void ciObjectFactory::init_metadata_table(int expected_size) {
+  _ci_metadata = new (_arena) GrowableArray<ciMetadata*>(_arena, expected_size, 0, NULL);
+  // Keep the load factor at or below one half.
+  _metadata_table_size = 16;
+  while (_metadata_table_size < 2 * expected_size) {
+    _metadata_table_size *= 2;
+  }
+  _metadata_table = NEW_ARENA_ARRAY(_arena, ciMetadata*, _metadata_table_size);
+  memset(_metadata_table, 0, _metadata_table_size * sizeof(ciMetadata*));
+}
+
+// ------------------------------------------------------------------
+// ciObjectFactory::find_metadata_slot
+//
+// Return the slot holding the ciMetadata for key, or the empty slot
+// where it would be added.
+ciMetadata** ciObjectFactory::find_metadata_slot(Metadata* key) {
+  uintptr_t bits = (uintptr_t)key >> LogBytesPerWord;
+  uint hash = (uint)(bits ^ (bits >> 11) ^ (bits >> 23));
+  uint mask = (uint)_metadata_table_size - 1;
+  for (uint i = hash & mask; ; i = (i + 1) & mask) {
+    ciMetadata** slot = &_metadata_table[i];
+    if (*slot == NULL || (*slot)->constant_encoding() == key) {
+      return slot;
+    }
+  }
+}
+
+// ------------------------------------------------------------------
+// ciObjectFactory::add_metadata
+void ciObjectFactory::add_metadata(ciMetadata* obj) {
+  if (2 * (_ci_metadata->length() + 1) > _metadata_table_size) {
+    // Grow the table; the old one stays in the arena until the
+    // compilation ends.
+    _metadata_table_size *= 2;
+    _metadata_table = NEW_ARENA_ARRAY(_arena, ciMetadata*, _metadata_table_size);
+    memset(_metadata_table, 0, _metadata_table_size * sizeof(ciMetadata*));
+    for (int i = 0; i < _ci_metadata->length(); i++) {
+      ciMetadata* old = _ci_metadata->at(i);
+      *find_metadata_slot(old->constant_encoding()) = old;
+    }
+  }
+  ciMetadata** slot = find_metadata_slot(obj->constant_encoding());
+  assert(*slot == NULL, "no double insert");
+  *slot = obj;
+  _ci_metadata->append(obj);
 }
 
 // ------------------------------------------------------------------
@@ -275,13 +316,11 @@ int ciObjectFactory::metadata_compare(Metadata* const& key, ciMetadata* const& e
 ciMetadata* ciObjectFactory::cached_metadata(Metadata* key) {
   ASSERT_IN_VM;
 
-  bool found = false;
-  int index = _ci_metadata->find_sorted<Metadata*, ciObjectFactory::metadata_compare>(key, found);
-
-  if (!found) {
+  ciMetadata* obj = *find_metadata_slot(key);
+  if (obj == NULL) {
     return NULL;
   }
-  return _ci_metadata->at(index)->as_metadata();
+  return obj->as_metadata();
 }
 
 
@@ -296,44 +335,26 @@ ciMetadata* ciObjectFactory::get_metadata(Metadata* key) {
 
 #ifdef ASSERT
   if (CIObjectFactoryVerify) {
-    Metadata* last = NULL;
-    for (int j = 0; j< _ci_metadata->length(); j++) {
-      Metadata* o = _ci_metadata->at(j)->constant_encoding();
-      assert(last < o, "out of order");
-      last = o;
+    for (int j = 0; j < _ci_metadata->length(); j++) {
+      ciMetadata* obj = _ci_metadata->at(j);
+      assert(*find_metadata_slot(obj->constant_encoding()) == obj, "bad lookup");
     }
   }
 #endif // ASSERT
-  int len = _ci_metadata->length();
-  bool found = false;
-  int index = _ci_metadata->find_sorted<Metadata*, ciObjectFactory::metadata_compare>(key, found);
-#ifdef ASSERT
-  if (CIObjectFactoryVerify) {
-    for (int i=0; i<_ci_metadata->length(); i++) {
-      if (_ci_metadata->at(i)->constant_encoding() == key) {
-        assert(index == i, " bad lookup");
-      }
-    }
-  }
-#endif
-
-  if (!found) {
+  ciMetadata* obj = *find_metadata_slot(key);
+  if (obj == NULL) {
     // The ciMetadata does not yet exist. Create it and insert it
     // into the cache.
     ciMetadata* new_object = create_new_metadata(key);
     init_ident_of(new_object);
     assert(new_object->is_metadata(), "must be");
 
-    if (len != _ci_metadata->length()) {
-      // creating the new object has recursively entered new objects
-      // into the table.  We need to recompute our index.
-      index = _ci_metadata->find_sorted<Metadata*, ciObjectFactory::metadata_compare>(key, found);
-    }
-    assert(!found, "no double insert");
-    _ci_metadata->insert_before(index, new_object);
+    // Creating the new object may have recursively entered new objects
+    // into the table and grown it, so the slot is looked up again.
+    add_metadata(new_object);
     return new_object;
   }
-  return _ci_metadata->at(index)->as_metadata();
+  return obj->as_metadata();
 }
 
 // ------------------------------------------------------------------
@@ -46,7 +46,9 @@ private:
   static int                       _shared_ident_limit;
 
   Arena*                    _arena;
-  GrowableArray<ciMetadata*>*        _ci_metadata;
+  GrowableArray<ciMetadata*>*        _ci_metadata;    // in creation order
+  ciMetadata**              _metadata_table;       // open hash table over _ci_metadata
+  int                       _metadata_table_size;  // a power of two
   GrowableArray<ciMethod*>* _unloaded_methods;
   GrowableArray<ciKlass*>* _unloaded_klasses;
   GrowableArray<ciInstance*>* _unloaded_instances;
@@ -68,7 +70,9 @@ private:
   NonPermObject* _non_perm_bucket[NON_PERM_BUCKETS];
   int _non_perm_count;
 
-  static int metadata_compare(Metadata* const& key, ciMetadata* const& elt);
+  void init_metadata_table(int expected_size);
+  ciMetadata** find_metadata_slot(Metadata* key);
+  void add_metadata(ciMetadata* obj);
 
   ciObject* create_new_object(oop o);
   ciMetadata* create_new_metadata(Metadata* o);
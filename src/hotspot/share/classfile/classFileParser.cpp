@@ -59,6 +59,7 @@
 #include "prims/jvmtiExport.hpp"
 #include "prims/jvmtiThreadState.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/fieldType.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/javaCalls.hpp"
 #include "runtime/os.hpp"
@@ -3787,6 +3788,41 @@ static void print_field_layout(const Symbol* name,
 }
 #endif
 
+// Allocate fields of the given allocation type that are not laid out yet
+// into a gap of less than BytesPerLong bytes, at their natural alignment.
+// free_mask has one bit set for each free byte of the gap and is updated.
+// Returns the number of fields allocated, at most max_count.
+static unsigned int allocate_fields_in_gap(Array<u2>* fields,
+                                           ConstantPool* cp,
+                                           FieldAllocationType atype,
+                                           int size,
+                                           unsigned int max_count,
+                                           int gap_offset,
+                                           int gap_size,
+                                           uint* free_mask) {
+  assert(gap_size < BytesPerLong, "gap too large: %d", gap_size);
+  const uint field_mask = right_n_bits(size);
+  unsigned int count = 0;
+  for (int offset = align_up(gap_offset, size);
+       count < max_count && offset + size <= gap_offset + gap_size;
+       offset += size) {
+    const uint mask = field_mask << (offset - gap_offset);
+    if ((*free_mask & mask) != mask) continue;
+
+    // Contended instance fields are laid out separately
+    AllFieldStream fs(fields, cp);
+    while (fs.is_offset_set() || (FieldAllocationType) fs.allocation_type() != atype ||
+           (fs.is_contended() && !fs.access_flags().is_static())) {
+      fs.next();
+      assert(!fs.done(), "counted field of type %d not found", atype);
+    }
+    fs.set_offset(offset);
+    *free_mask &= ~mask;
+    count++;
+  }
+  return count;
+}
+
 // Values needed for oopmap and InstanceKlass creation
 class ClassFileParser::FieldLayoutInfo : public ResourceObj {
  public:
@@ -3929,6 +3965,66 @@ void ClassFileParser::layout_fields(ConstantPool* cp,
     compact_fields   = false; // Don't compact fields
   }
 
+  // Allocate static fields into the alignment gap before the static
+  // long/double fields, and shift the regions of the smaller fields.
+  if (compact_fields && CompactFieldsInSuperGaps &&
+      next_static_double_offset != next_static_oop_offset + fac->count[STATIC_OOP] * heapOopSize) {
+    const int gap_offset = next_static_oop_offset + fac->count[STATIC_OOP] * heapOopSize;
+    const int gap_size = next_static_double_offset - gap_offset;
+    uint free_mask = right_n_bits(gap_size);
+    const unsigned int words = allocate_fields_in_gap(_fields, cp, STATIC_WORD, BytesPerInt,
+                                                      fac->count[STATIC_WORD],
+                                                      gap_offset, gap_size, &free_mask);
+    const unsigned int shorts = allocate_fields_in_gap(_fields, cp, STATIC_SHORT, BytesPerShort,
+                                                       fac->count[STATIC_SHORT],
+                                                       gap_offset, gap_size, &free_mask);
+    allocate_fields_in_gap(_fields, cp, STATIC_BYTE, 1, fac->count[STATIC_BYTE],
+                           gap_offset, gap_size, &free_mask);
+    next_static_short_offset -= words * BytesPerInt;
+    next_static_byte_offset  -= words * BytesPerInt + shorts * BytesPerShort;
+  }
+
+  // Allocate instance fields into the gaps left in the field layout of the
+  // superclasses, e.g. the padding after their trailing byte, short or int
+  // fields. Gaps of BytesPerLong or more only come from @Contended padding
+  // and are kept. Oops are not allocated into the gaps, so their oop map
+  // blocks stay contiguous.
+  if (compact_fields && CompactFieldsInSuperGaps && super_has_nonstatic_fields &&
+      !is_contended_class) {
+    const int fields_start = instanceOopDesc::base_offset_in_bytes();
+    ResourceBitMap used(nonstatic_fields_start - fields_start);
+    bool super_is_contended = false;
+    for (const InstanceKlass* k = _super_klass; k != NULL; k = k->java_super()) {
+      super_is_contended |= k->is_contended();
+      for (AllFieldStream fs(k->fields(), k->constants()); !fs.done(); fs.next()) {
+        if (fs.access_flags().is_static()) continue;
+        const BasicType type = FieldType::basic_type(fs.signature());
+        const int size = is_reference_type(type) ? heapOopSize : type2aelembytes(type);
+        used.set_range(fs.offset() - fields_start, fs.offset() - fields_start + size);
+      }
+    }
+
+    BitMap::idx_t gap_start = super_is_contended ? used.size() : used.get_next_zero_offset(0);
+    while (gap_start < used.size()) {
+      const BitMap::idx_t gap_end = used.get_next_one_offset(gap_start);
+      const int gap_size = (int)(gap_end - gap_start);
+      if (gap_size < BytesPerLong) {
+        const int gap_offset = fields_start + (int)gap_start;
+        uint free_mask = right_n_bits(gap_size);
+        nonstatic_word_count  -= allocate_fields_in_gap(_fields, cp, NONSTATIC_WORD, BytesPerInt,
+                                                        nonstatic_word_count,
+                                                        gap_offset, gap_size, &free_mask);
+        nonstatic_short_count -= allocate_fields_in_gap(_fields, cp, NONSTATIC_SHORT, BytesPerShort,
+                                                        nonstatic_short_count,
+                                                        gap_offset, gap_size, &free_mask);
+        nonstatic_byte_count  -= allocate_fields_in_gap(_fields, cp, NONSTATIC_BYTE, 1,
+                                                        nonstatic_byte_count,
+                                                        gap_offset, gap_size, &free_mask);
+      }
+      gap_start = used.get_next_zero_offset(gap_end);
+    }
+  }
+
   int next_nonstatic_oop_offset = 0;
   int next_nonstatic_double_offset = 0;
 
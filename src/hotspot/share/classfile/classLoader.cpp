@@ -92,6 +92,7 @@ static FindEntry_t       FindEntry          = NULL;
 static ReadEntry_t       ReadEntry          = NULL;
 static GetNextEntry_t    GetNextEntry       = NULL;
 static Crc32_t           Crc32              = NULL;
+static void*             ZipLibraryHandle   = NULL;
 
 // Entry points for jimage.dll for loading jimage file entries
 
@@ -402,9 +403,12 @@ ClassFileStream* ClassPathImageEntry::open_stream(const char* name, TRAPS) {
 //
 ClassFileStream* ClassPathImageEntry::open_stream_for_loader(const char* name, ClassLoaderData* loader_data, TRAPS) {
   jlong size;
-  JImageLocationRef location = (*JImageFindResource)(_jimage, "", get_jimage_version_string(), name, &size);
+  JImageLocationRef location = 0;
 
-  if (location == 0) {
+  // Classes in the runtime image are stored under the name of their module,
+  // so look there first. The lookup without a module name hardly ever
+  // succeeds and is only done when the module lookup did not.
+  {
     ResourceMark rm;
     const char* pkg_name = ClassLoader::package_from_name(name);
 
@@ -427,6 +431,9 @@ ClassFileStream* ClassPathImageEntry::open_stream_for_loader(const char* name, C
       }
     }
   }
+  if (location == 0) {
+    location = (*JImageFindResource)(_jimage, "", get_jimage_version_string(), name, &size);
+  }
   if (location != 0) {
     if (UsePerfData) {
       ClassLoader::perf_sys_classfile_bytes_read()->inc(size);
@@ -1001,6 +1008,11 @@ void ClassLoader::load_zip_library() {
   ReadEntry = CAST_TO_FN_PTR(ReadEntry_t, dll_lookup(handle, "ZIP_ReadEntry", path));
   GetNextEntry = CAST_TO_FN_PTR(GetNextEntry_t, dll_lookup(handle, "ZIP_GetNextEntry", path));
   Crc32 = CAST_TO_FN_PTR(Crc32_t, dll_lookup(handle, "ZIP_CRC32", path));
+  ZipLibraryHandle = handle;
+}
+
+void* ClassLoader::zip_library_handle() {
+  return ZipLibraryHandle;
 }
 
 void ClassLoader::load_jimage_library() {
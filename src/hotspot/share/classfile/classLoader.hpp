@@ -255,6 +255,9 @@ class ClassLoader: AllStatic {
   static void load_jimage_library();
 
  public:
+  // Handle of the zip library, for looking up optional entry points.
+  static void* zip_library_handle();
+
   static ClassPathEntry* create_class_path_entry(const char *path, const struct stat* st,
                                                  bool throw_exception,
                                                  bool is_boot_append,
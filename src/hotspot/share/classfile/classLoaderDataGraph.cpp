@@ -30,14 +30,18 @@
 #include "classfile/moduleEntry.hpp"
 #include "classfile/packageEntry.hpp"
 #include "code/dependencyContext.hpp"
+#include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/gcCause.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/allocation.inline.hpp"
 #include "memory/metaspace.hpp"
 #include "memory/resourceArea.hpp"
+#include "memory/universe.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/mutex.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/safepoint.hpp"
 #include "runtime/safepointVerifiers.hpp"
 #include "utilities/growableArray.hpp"
@@ -188,6 +192,7 @@ ClassLoaderData* ClassLoaderDataGraph::_unloading = NULL;
 
 bool ClassLoaderDataGraph::_should_clean_deallocate_lists = false;
 bool ClassLoaderDataGraph::_safepoint_cleanup_needed = false;
+volatile bool ClassLoaderDataGraph::_should_purge = false;
 bool ClassLoaderDataGraph::_metaspace_oom = false;
 
 // Add a new class loader data node to the list.  Assign the newly created
@@ -500,6 +505,14 @@ bool ClassLoaderDataGraph::do_unloading() {
   // Indicate whether safepoint cleanup is needed.
   _safepoint_cleanup_needed = true;
 
+  // A purge left to the ServiceThread by the previous pause has not run yet.
+  // Finish it before adding more dead CLDs, so they are reported only once
+  // by classes_unloading_do().
+  if (_unloading != NULL && SafepointSynchronize::is_at_safepoint()) {
+    Atomic::release_store(&_should_purge, false);
+    purge();
+  }
+
   ClassLoaderData* data = _head;
   ClassLoaderData* prev = NULL;
   bool seen_dead_loader = false;
@@ -578,6 +591,33 @@ void ClassLoaderDataGraph::purge() {
   DependencyContext::purge_dependency_contexts();
 }
 
+void ClassLoaderDataGraph::purge_or_defer() {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
+  GCCause::Cause cause = Universe::heap()->gc_cause();
+  // A collection triggered by metaspace exhaustion must free the metadata
+  // before the failed allocation is retried.
+  if (!ConcurrentClassLoaderDataPurge ||
+      _unloading == NULL ||
+      cause == GCCause::_metadata_GC_threshold ||
+      cause == GCCause::_metadata_GC_clear_soft_refs) {
+    purge();
+    return;
+  }
+  // The dead CLDs are no longer reachable from _head, so deleting them and
+  // returning their metaspace can happen outside of the pause, as it does
+  // for the concurrent collectors.
+  MutexLocker ml(Service_lock, Mutex::_no_safepoint_check_flag);
+  Atomic::release_store(&_should_purge, true);
+  Service_lock->notify_all();
+}
+
+void ClassLoaderDataGraph::do_deferred_purge() {
+  // Runs in the ServiceThread, which cannot reach a safepoint while it is
+  // purging, so this does not overlap with do_unloading().
+  Atomic::release_store(&_should_purge, false);
+  purge();
+}
+
 int ClassLoaderDataGraph::resize_dictionaries() {
   assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint!");
   int resized = 0;
@@ -27,6 +27,7 @@
 
 #include "classfile/classLoaderData.hpp"
 #include "memory/allocation.hpp"
+#include "runtime/atomic.hpp"
 #include "utilities/growableArray.hpp"
 #include "utilities/macros.hpp"
 
@@ -49,6 +50,10 @@ class ClassLoaderDataGraph : public AllStatic {
   static bool _should_clean_deallocate_lists;
   static bool _safepoint_cleanup_needed;
 
+  // Set if the purging of the unloaded CLDs has been handed over to the
+  // ServiceThread (ConcurrentClassLoaderDataPurge).
+  static volatile bool _should_purge;
+
   // OOM has been seen in metaspace allocation. Used to prevent some
   // allocations until class unloading
   static bool _metaspace_oom;
@@ -63,6 +68,12 @@ class ClassLoaderDataGraph : public AllStatic {
   static ClassLoaderData* find_or_create(Handle class_loader);
   static void clean_module_and_package_info();
   static void purge();
+  // Called by the stop-the-world collectors at the end of a pause with class
+  // unloading. Purges right away or leaves it to the ServiceThread.
+  static void purge_or_defer();
+  // ServiceThread support for ConcurrentClassLoaderDataPurge.
+  static bool has_purge_work() { return Atomic::load_acquire(&_should_purge); }
+  static void do_deferred_purge();
   static void clear_claimed_marks();
   static void clear_claimed_marks(int claim);
   // Iteration through CLDG inside a safepoint; GC support
@@ -34,6 +34,7 @@
 #include "memory/resourceArea.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/safepoint.hpp"
 #include "runtime/safepointVerifiers.hpp"
 #include "utilities/hashtable.inline.hpp"
 
@@ -93,8 +94,8 @@ void Dictionary::free_entry(DictionaryEntry* entry) {
 
 const int _resize_load_trigger = 5;       // load factor that will trigger the resize
 const double _resize_factor    = 2.0;     // by how much we will resize using current number of entries
-const int _resize_max_size     = 40423;   // the max dictionary size allowed
-const int _primelist[] = {107, 1009, 2017, 4049, 5051, 10103, 20201, _resize_max_size};
+const int _resize_max_size     = 161717;  // the max dictionary size allowed
+const int _primelist[] = {107, 1009, 2017, 4049, 5051, 10103, 20201, 40423, 80849, _resize_max_size};
 const int _prime_array_size = sizeof(_primelist)/sizeof(int);
 
 // Calculate next "good" dictionary size based on requested count
@@ -146,17 +147,19 @@ bool Dictionary::resize_if_needed() {
   return (desired_size != 0);
 }
 
+// The pd_set is read without a lock: entries are published with a release
+// store after they are fully initialized, and the entries that
+// clean_cached_protection_domains() unlinks are only deleted after a
+// handshake with all threads, so a concurrent reader never sees a deleted
+// entry.
 bool DictionaryEntry::contains_protection_domain(oop protection_domain) const {
-  // Lock the pd_set list.  This lock cannot safepoint since the caller holds
-  // a Dictionary entry, which can be moved if the Dictionary is resized.
-  MutexLocker ml(ProtectionDomainSet_lock, Mutex::_no_safepoint_check_flag);
 #ifdef ASSERT
   if (protection_domain == instance_klass()->protection_domain()) {
     // Ensure this doesn't show up in the pd_set (invariant)
     bool in_pd_set = false;
-    for (ProtectionDomainEntry* current = pd_set();
+    for (ProtectionDomainEntry* current = pd_set_acquire();
                                 current != NULL;
-                                current = current->next()) {
+                                current = current->next_acquire()) {
       if (current->object_no_keepalive() == protection_domain) {
         in_pd_set = true;
         break;
@@ -174,9 +177,9 @@ bool DictionaryEntry::contains_protection_domain(oop protection_domain) const {
     return true;
   }
 
-  for (ProtectionDomainEntry* current = pd_set();
+  for (ProtectionDomainEntry* current = pd_set_acquire();
                               current != NULL;
-                              current = current->next()) {
+                              current = current->next_acquire()) {
     if (current->object_no_keepalive() == protection_domain) return true;
   }
   return false;
@@ -187,12 +190,12 @@ void DictionaryEntry::add_protection_domain(Dictionary* dict, Handle protection_
   assert_locked_or_safepoint(SystemDictionary_lock);
   if (!contains_protection_domain(protection_domain())) {
     ProtectionDomainCacheEntry* entry = SystemDictionary::cache_get(protection_domain);
-    // The pd_set in the dictionary entry is protected by a low level lock.
-    // With concurrent PD table cleanup, these links could be broken.
+    // Writers of the pd_set in the dictionary entry are serialized by a low
+    // level lock, since it is also changed by concurrent PD table cleanup.
     MutexLocker ml(ProtectionDomainSet_lock, Mutex::_no_safepoint_check_flag);
     ProtectionDomainEntry* new_head =
                 new ProtectionDomainEntry(entry, pd_set());
-    set_pd_set(new_head);
+    release_set_pd_set(new_head);
   }
   LogTarget(Trace, protectiondomain) lt;
   if (lt.is_enabled()) {
@@ -319,6 +322,14 @@ InstanceKlass* Dictionary::find_class(int index, unsigned int hash,
   return (entry != NULL) ? entry->instance_klass() : NULL;
 }
 
+InstanceKlass* Dictionary::find_class_lock_free(unsigned int hash, Symbol* name) {
+  NoSafepointVerifier nsv;
+
+  int index = hash_to_index(hash);
+  DictionaryEntry* entry = get_entry(index, hash, name);
+  return (entry != NULL) ? entry->instance_klass() : NULL;
+}
+
 
 void Dictionary::add_protection_domain(int index, unsigned int hash,
                                        InstanceKlass* klass,
@@ -351,8 +362,10 @@ bool Dictionary::is_valid_protection_domain(unsigned int hash,
 }
 
 // During class loading we may have cached a protection domain that has
-// since been unreferenced, so this entry should be cleared.
-void Dictionary::clean_cached_protection_domains() {
+// since been unreferenced, so this entry should be cleared. The unlinked
+// entries may still be seen by concurrent readers and are added to the
+// delete_list instead of being deleted.
+void Dictionary::clean_cached_protection_domains(GrowableArray<ProtectionDomainEntry*>* delete_list) {
   assert_locked_or_safepoint(SystemDictionary_lock);
 
   if (loader_data()->is_the_null_class_loader_data()) {
@@ -382,14 +395,13 @@ void Dictionary::clean_cached_protection_domains() {
             ls.cr();
           }
           if (probe->pd_set() == current) {
-            probe->set_pd_set(current->next());
+            probe->release_set_pd_set(current->next());
           } else {
             assert(prev != NULL, "should be set by alive entry");
-            prev->set_next(current->next());
+            prev->release_set_next(current->next());
           }
-          ProtectionDomainEntry* to_delete = current;
+          delete_list->push(current);
           current = current->next();
-          delete to_delete;
         } else {
           prev = current;
           current = current->next();
@@ -449,13 +461,27 @@ void SymbolPropertyTable::methods_do(void f(Method*)) {
   for (int index = 0; index < table_size(); index++) {
     for (SymbolPropertyEntry* p = bucket(index); p != NULL; p = p->next()) {
       Method* prop = p->method();
-      if (prop != NULL) {
+      // Shared invokers belong to loaded classes and are walked with them.
+      if (prop != NULL && prop->is_method_handle_intrinsic()) {
         f((Method*)prop);
       }
     }
   }
 }
 
+void SymbolPropertyTable::clear_shared_invokers() {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
+  for (int index = 0; index < table_size(); index++) {
+    for (SymbolPropertyEntry* p = bucket(index); p != NULL; p = p->next()) {
+      Method* prop = p->method();
+      if (prop != NULL && !prop->is_method_handle_intrinsic()) {
+        p->set_method(NULL);
+        p->set_method_type(NULL);
+      }
+    }
+  }
+}
+
 void DictionaryEntry::verify_protection_domain_set() {
   MutexLocker ml(ProtectionDomainSet_lock, Mutex::_no_safepoint_check_flag);
   for (ProtectionDomainEntry* current = pd_set(); // accessed at a safepoint
@@ -29,6 +29,8 @@
 #include "classfile/systemDictionary.hpp"
 #include "oops/instanceKlass.hpp"
 #include "oops/oop.hpp"
+#include "runtime/atomic.hpp"
+#include "utilities/growableArray.hpp"
 #include "utilities/hashtable.hpp"
 #include "utilities/ostream.hpp"
 
@@ -62,13 +64,16 @@ public:
   void add_klass(unsigned int hash, Symbol* class_name, InstanceKlass* obj);
 
   InstanceKlass* find_class(int index, unsigned int hash, Symbol* name);
+  // Lookup without SystemDictionary_lock, ignoring protection domains.
+  // Entries are only added with release semantics and removed at a safepoint.
+  InstanceKlass* find_class_lock_free(unsigned int hash, Symbol* name);
 
   void classes_do(void f(InstanceKlass*));
   void classes_do(void f(InstanceKlass*, TRAPS), TRAPS);
   void all_entries_do(KlassClosure* closure);
   void classes_do(MetaspaceClosure* it);
 
-  void clean_cached_protection_domains();
+  void clean_cached_protection_domains(GrowableArray<ProtectionDomainEntry*>* delete_list);
 
   // Protection domains
   InstanceKlass* find(unsigned int hash, Symbol* name, Handle protection_domain);
@@ -153,6 +158,10 @@ class DictionaryEntry : public HashtableEntry<InstanceKlass*, mtClass> {
   ProtectionDomainEntry* pd_set() const            { return _pd_set; }
   void set_pd_set(ProtectionDomainEntry* new_head) {  _pd_set = new_head; }
 
+  // The pd_set is read without a lock, see contains_protection_domain().
+  ProtectionDomainEntry* pd_set_acquire() const    { return Atomic::load_acquire(&_pd_set); }
+  void release_set_pd_set(ProtectionDomainEntry* new_head) { Atomic::release_store(&_pd_set, new_head); }
+
   // Tells whether the initiating class' protection domain can access the klass in this entry
   bool is_valid_protection_domain(Handle protection_domain) {
     if (!ProtectionDomainVerification) return true;
@@ -180,7 +189,7 @@ class SymbolPropertyEntry : public HashtableEntry<Symbol*, mtSymbol> {
  private:
   intptr_t _symbol_mode;  // secondary key
   Method*   _method;
-  oop       _method_type;
+  oop       _method_type;   // or the appendix of a shared invoker
 
  public:
   Symbol* symbol() const            { return literal(); }
@@ -191,6 +200,10 @@ class SymbolPropertyEntry : public HashtableEntry<Symbol*, mtSymbol> {
   Method*        method() const     { return _method; }
   void set_method(Method* p)        { _method = p; }
 
+  // Shared invokers are published to lock-free lookups.
+  Method* method_acquire() const    { return Atomic::load_acquire(&_method); }
+  void release_set_method(Method* p) { Atomic::release_store(&_method, p); }
+
   oop      method_type() const      { return _method_type; }
   oop*     method_type_addr()       { return &_method_type; }
   void set_method_type(oop p)       { _method_type = p; }
@@ -223,7 +236,8 @@ class SymbolPropertyEntry : public HashtableEntry<Symbol*, mtSymbol> {
 
 // A system-internal mapping of symbols to pointers, both managed
 // and unmanaged.  Used to record the auto-generation of each method
-// MethodHandle.invoke(S)T, for all signatures (S)T.
+// MethodHandle.invoke(S)T, for all signatures (S)T, and the invokers
+// linked for them that are shared by all class loaders.
 class SymbolPropertyTable : public Hashtable<Symbol*, mtSymbol> {
   friend class VMStructs;
 private:
@@ -279,6 +293,9 @@ public:
 
   void methods_do(void f(Method*));
 
+  // Forget the invokers shared across class loaders
+  void clear_shared_invokers();
+
   void verify();
 
   SymbolPropertyEntry* bucket(int i) {
@@ -2036,7 +2036,8 @@ class BacktraceBuilder: public StackObj {
     trace_next_offset    = java_lang_Throwable::trace_next_offset,
     trace_hidden_offset  = java_lang_Throwable::trace_hidden_offset,
     trace_size           = java_lang_Throwable::trace_size,
-    trace_chunk_size     = java_lang_Throwable::trace_chunk_size
+    trace_chunk_size     = java_lang_Throwable::trace_chunk_size,
+    trace_max_chunk_size = java_lang_Throwable::trace_max_chunk_size
   };
 
   // get info out of chunks
@@ -2095,19 +2096,27 @@ class BacktraceBuilder: public StackObj {
     objArrayHandle old_head(THREAD, _head);
     PauseNoSafepointVerifier pnsv(&_nsv);
 
+    // Most backtraces fit into the first chunk. Deep stacks get chunks of
+    // growing size, so that they do not need five allocations for every
+    // trace_chunk_size frames.
+    int chunk_size = trace_chunk_size;
+    if (_methods != NULL) {
+      chunk_size = MIN2(_methods->length() * 2, (int)trace_max_chunk_size);
+    }
+
     objArrayOop head = oopFactory::new_objectArray(trace_size, CHECK);
     objArrayHandle new_head(THREAD, head);
 
-    typeArrayOop methods = oopFactory::new_shortArray(trace_chunk_size, CHECK);
+    typeArrayOop methods = oopFactory::new_shortArray(chunk_size, CHECK);
     typeArrayHandle new_methods(THREAD, methods);
 
-    typeArrayOop bcis = oopFactory::new_intArray(trace_chunk_size, CHECK);
+    typeArrayOop bcis = oopFactory::new_intArray(chunk_size, CHECK);
     typeArrayHandle new_bcis(THREAD, bcis);
 
-    objArrayOop mirrors = oopFactory::new_objectArray(trace_chunk_size, CHECK);
+    objArrayOop mirrors = oopFactory::new_objectArray(chunk_size, CHECK);
     objArrayHandle new_mirrors(THREAD, mirrors);
 
-    typeArrayOop names = oopFactory::new_symbolArray(trace_chunk_size, CHECK);
+    typeArrayOop names = oopFactory::new_symbolArray(chunk_size, CHECK);
     typeArrayHandle new_names(THREAD, names);
 
     if (!old_head.is_null()) {
@@ -2137,7 +2146,7 @@ class BacktraceBuilder: public StackObj {
     // to a 0 even if it could be recorded.
     if (bci == SynchronizationEntryBCI) bci = 0;
 
-    if (_index >= trace_chunk_size) {
+    if (_index >= _methods->length()) {
       methodHandle mhandle(THREAD, method);
       expand(CHECK);
       method = mhandle();
@@ -2217,7 +2226,8 @@ class BacktraceIterator : public StackObj {
                         _names->symbol_at(_index));
     _index++;
 
-    if (_index >= java_lang_Throwable::trace_chunk_size) {
+    // Chunks after the first one are larger; see BacktraceBuilder::expand.
+    if (_index >= _methods->length()) {
       int next_offset = java_lang_Throwable::trace_next_offset;
       // Get next chunk
       objArrayHandle result (thread, objArrayOop(_result->obj_at(next_offset)));
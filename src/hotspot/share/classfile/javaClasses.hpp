@@ -535,7 +535,8 @@ class java_lang_Throwable: AllStatic {
     trace_next_offset    = 4,
     trace_hidden_offset  = 5,
     trace_size           = 6,
-    trace_chunk_size     = 32
+    trace_chunk_size     = 32,  // size of the first chunk of a backtrace
+    trace_max_chunk_size = 256  // later chunks double in size up to this
   };
 
   static int backtrace_offset;
@@ -33,6 +33,7 @@
 #include "memory/resourceArea.hpp"
 #include "oops/oop.inline.hpp"
 #include "oops/weakHandle.inline.hpp"
+#include "runtime/handshake.hpp"
 #include "utilities/hashtable.inline.hpp"
 
 unsigned int ProtectionDomainCacheTable::compute_hash(Handle protection_domain) {
@@ -57,24 +58,53 @@ void ProtectionDomainCacheTable::trigger_cleanup() {
 }
 
 class CleanProtectionDomainEntries : public CLDClosure {
+  GrowableArray<ProtectionDomainEntry*>* _delete_list;
+ public:
+  CleanProtectionDomainEntries(GrowableArray<ProtectionDomainEntry*>* delete_list) :
+    _delete_list(delete_list) {}
+
   void do_cld(ClassLoaderData* data) {
     Dictionary* dictionary = data->dictionary();
     if (dictionary != NULL) {
-      dictionary->clean_cached_protection_domains();
+      dictionary->clean_cached_protection_domains(_delete_list);
     }
   }
 };
 
+// Handshake with all threads, so that none of them is still walking a
+// pd_set that contained one of the unlinked entries.
+class HandshakeForPD : public ThreadClosure {
+ public:
+  void do_thread(Thread* thread) {
+    log_trace(protectiondomain)("HandshakeForPD::do_thread: thread=" INTPTR_FORMAT, p2i(thread));
+  }
+};
+
 void ProtectionDomainCacheTable::unlink() {
   {
-    // First clean cached pd lists in loaded CLDs
-    // It's unlikely, but some loaded classes in a dictionary might
-    // point to a protection_domain that has been unloaded.
-    // The dictionary pd_set points at entries in the ProtectionDomainCacheTable.
-    MutexLocker ml(ClassLoaderDataGraph_lock);
-    MutexLocker mldict(SystemDictionary_lock);  // need both.
-    CleanProtectionDomainEntries clean;
-    ClassLoaderDataGraph::loaded_cld_do(&clean);
+    ResourceMark rm;
+    GrowableArray<ProtectionDomainEntry*> delete_list;
+    {
+      // First clean cached pd lists in loaded CLDs
+      // It's unlikely, but some loaded classes in a dictionary might
+      // point to a protection_domain that has been unloaded.
+      // The dictionary pd_set points at entries in the ProtectionDomainCacheTable.
+      MutexLocker ml(ClassLoaderDataGraph_lock);
+      MutexLocker mldict(SystemDictionary_lock);  // need both.
+      CleanProtectionDomainEntries clean(&delete_list);
+      ClassLoaderDataGraph::loaded_cld_do(&clean);
+    }
+
+    // The pd_set entries are read without a lock, and the readers also look
+    // at the ProtectionDomainCacheEntry they point to, so both are only
+    // deleted once no thread can see the unlinked entries anymore.
+    if (delete_list.length() != 0) {
+      HandshakeForPD hs_pd;
+      Handshake::execute(&hs_pd);
+      for (int i = 0; i < delete_list.length(); i++) {
+        delete delete_list.at(i);
+      }
+    }
   }
 
   MutexLocker ml(SystemDictionary_lock);
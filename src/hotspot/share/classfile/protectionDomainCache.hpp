@@ -28,6 +28,7 @@
 #include "oops/oop.hpp"
 #include "oops/weakHandle.hpp"
 #include "memory/iterator.hpp"
+#include "runtime/atomic.hpp"
 #include "utilities/hashtable.hpp"
 
 // This class caches the approved protection domains that can access loaded classes.
@@ -117,6 +118,8 @@ class ProtectionDomainEntry :public CHeapObj<mtClass> {
 
   ProtectionDomainEntry* next() { return _next; }
   void set_next(ProtectionDomainEntry* entry) { _next = entry; }
+  ProtectionDomainEntry* next_acquire() { return Atomic::load_acquire(&_next); }
+  void release_set_next(ProtectionDomainEntry* entry) { Atomic::release_store(&_next, entry); }
   oop object();
   oop object_no_keepalive();
 };
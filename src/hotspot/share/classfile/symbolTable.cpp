@@ -177,10 +177,17 @@ void SymbolTable::create_table ()  {
 
 void SymbolTable::delete_symbol(Symbol* sym) {
   if (sym->refcount() == PERM_REFCOUNT) {
-    MutexLocker ml(SymbolArena_lock, Mutex::_no_safepoint_check_flag); // Protect arena
     // Deleting permanent symbol should not occur very often (insert race condition),
     // so log it.
     log_trace_symboltable_helper(sym, "Freeing permanent symbol");
+    Thread* thread = Thread::current();
+    char* end_of_sym = (char*)sym + sym->size() * wordSize;
+    if (end_of_sym == thread->symbol_region_top()) {
+      // The symbol was the last one allocated from this thread's region.
+      thread->set_symbol_region((char*)sym, thread->symbol_region_end());
+      return;
+    }
+    MutexLocker ml(SymbolArena_lock, Mutex::_no_safepoint_check_flag); // Protect arena
     if (!arena()->Afree(sym, sym->size())) {
       log_trace_symboltable_helper(sym, "Leaked permanent symbol");
     }
@@ -228,13 +235,36 @@ Symbol* SymbolTable::allocate_symbol(const char* name, int len, bool c_heap) {
     sym = new (len) Symbol((const u1*)name, len, 1);
     assert(sym != NULL, "new should call vm_exit_out_of_memory if C_HEAP is exhausted");
   } else {
-    // Allocate to global arena
-    MutexLocker ml(SymbolArena_lock, Mutex::_no_safepoint_check_flag); // Protect arena
-    sym = new (len, arena()) Symbol((const u1*)name, len, PERM_REFCOUNT);
+    sym = allocate_permanent_symbol(name, len);
   }
   return sym;
 }
 
+// Permanent symbols are bump allocated from a region of the global arena
+// that belongs to the allocating thread, so that threads loading classes
+// in parallel only take SymbolArena_lock once per region instead of once
+// per symbol. Large symbols are allocated from the arena directly. The
+// unused rest of a region is lost when the thread takes a new region or
+// exits.
+Symbol* SymbolTable::allocate_permanent_symbol(const char* name, int len) {
+  size_t alloc_size = Symbol::size(len) * wordSize;
+  Thread* thread = Thread::current();
+  char* top = thread->symbol_region_top();
+  if (pointer_delta(thread->symbol_region_end(), top, 1) < alloc_size) {
+    if (alloc_size > symbol_alloc_region_size / 4) {
+      MutexLocker ml(SymbolArena_lock, Mutex::_no_safepoint_check_flag); // Protect arena
+      return new (len, arena()) Symbol((const u1*)name, len, PERM_REFCOUNT);
+    }
+    {
+      MutexLocker ml(SymbolArena_lock, Mutex::_no_safepoint_check_flag); // Protect arena
+      top = (char*)arena()->Amalloc_4(symbol_alloc_region_size);
+    }
+    thread->set_symbol_region(top, top + symbol_alloc_region_size);
+  }
+  thread->set_symbol_region(top + alloc_size, thread->symbol_region_end());
+  return ::new (top) Symbol((const u1*)name, len, PERM_REFCOUNT);
+}
+
 class SymbolsDo : StackObj {
   SymbolClosure *_cl;
 public:
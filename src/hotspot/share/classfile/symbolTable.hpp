@@ -144,6 +144,7 @@ class SymbolTable : public AllStatic {
   // Arena for permanent symbols (null class loader) that are never unloaded
   static Arena*  _arena;
   static Arena* arena() { return _arena; }  // called for statistics
+  static Symbol* allocate_permanent_symbol(const char* name, int len);
 
   static void print_table_statistics(outputStream* st, const char* table_name);
 
@@ -158,7 +159,9 @@ public:
   enum {
     symbol_alloc_batch_size = 8,
     // Pick initial size based on java -version size measurements
-    symbol_alloc_arena_size = 360*K // TODO (revisit)
+    symbol_alloc_arena_size = 360*K, // TODO (revisit)
+    // Size of the per-thread regions of the arena for permanent symbols
+    symbol_alloc_region_size = 4*K
   };
 
   static void create_table();
@@ -2221,6 +2221,16 @@ bool SystemDictionary::add_loader_constraint(Symbol* class_name,
   Dictionary* dictionary2 = loader_data2->dictionary();
   unsigned int d_hash2 = dictionary2->compute_hash(constraint_name);
 
+  // Most checks are between loaders that both already resolved the name to
+  // the same class, e.g. through delegation to a common parent.  That needs
+  // no constraint, and since a dictionary entry is never replaced, it can be
+  // decided without contending for SystemDictionary_lock.
+  InstanceKlass* loaded1 = dictionary1->find_class_lock_free(d_hash1, constraint_name);
+  if (loaded1 != NULL &&
+      loaded1 == dictionary2->find_class_lock_free(d_hash2, constraint_name)) {
+    return true;
+  }
+
   {
     MutexLocker mu_s(SystemDictionary_lock, THREAD);
     InstanceKlass* klass1 = find_class(d_hash1, constraint_name, dictionary1);
@@ -2421,6 +2431,26 @@ Method* SystemDictionary::find_method_handle_invoker(Klass* klass,
                                                      Handle *appendix_result,
                                                      TRAPS) {
   assert(THREAD->can_call_java() ,"");
+
+  // The invoker of MethodHandle.invoke and invokeExact depends only on the
+  // name and the MethodType, so once linked for a signature whose MethodType
+  // is cached it can be handed to any call site without asking Java again.
+  // The name symbol is the secondary key; it never collides with the
+  // intrinsic ids used by the other entries of the table.
+  bool can_be_shared = ShareMethodHandleInvokers &&
+                       klass == SystemDictionary::MethodHandle_klass();
+  intptr_t invoker_mode = (intptr_t)name;
+  unsigned int hash  = invoke_method_table()->compute_hash(signature, invoker_mode);
+  int          index = invoke_method_table()->hash_to_index(hash);
+  if (can_be_shared) {
+    SymbolPropertyEntry* spe = invoke_method_table()->find_entry(index, hash, signature, invoker_mode);
+    Method* m = (spe != NULL) ? spe->method_acquire() : NULL;
+    if (m != NULL) {
+      (*appendix_result) = Handle(THREAD, spe->method_type());
+      return m;
+    }
+  }
+
   Handle method_type =
     SystemDictionary::find_method_handle_type(signature, accessing_klass, CHECK_NULL);
 
@@ -2450,7 +2480,37 @@ Method* SystemDictionary::find_method_handle_invoker(Klass* klass,
                          vmSymbols::linkMethod_signature(),
                          &args, CHECK_NULL);
   Handle mname(THREAD, (oop) result.get_jobject());
-  return unpack_method_and_appendix(mname, accessing_klass, appendix_box, appendix_result, THREAD);
+  Method* m = unpack_method_and_appendix(mname, accessing_klass, appendix_box, appendix_result, CHECK_NULL);
+
+  // Only share invokers of the pre-generated LambdaForm holder classes; they
+  // are boot classes and never unloaded, while spun LambdaForms may be.
+  InstanceKlass* holder = m->method_holder();
+  if (can_be_shared &&
+      holder->class_loader_data()->is_the_null_class_loader_data() &&
+      !holder->is_unsafe_anonymous()) {
+    vmIntrinsics::ID null_iid = vmIntrinsics::_none;
+    unsigned int mt_hash  = invoke_method_table()->compute_hash(signature, null_iid);
+    int          mt_index = invoke_method_table()->hash_to_index(mt_hash);
+    MutexLocker ml(SystemDictionary_lock, THREAD);
+    SymbolPropertyEntry* mt_spe = invoke_method_table()->find_entry(mt_index, mt_hash, signature, null_iid);
+    // Do not cache m if a redefinition made it old since it was linked.
+    if (mt_spe != NULL && mt_spe->method_type() == method_type() && !m->is_old()) {
+      SymbolPropertyEntry* spe = invoke_method_table()->find_entry(index, hash, signature, invoker_mode);
+      if (spe == NULL) {
+        spe = invoke_method_table()->add_entry(index, hash, signature, invoker_mode);
+      }
+      // Publish the appendix before the method; lookups do not take the lock.
+      spe->set_method_type(appendix_result->is_null() ? (oop)NULL : (*appendix_result)());
+      spe->release_set_method(m);
+    }
+  }
+  return m;
+}
+
+void SystemDictionary::clear_method_handle_invokers() {
+  // Shared invokers are not walked with the metadata of their holders, so
+  // redefinition could free them while still cached.
+  invoke_method_table()->clear_shared_invokers();
 }
 
 // Decide if we can globally cache a lookup of this class, to be returned to any client that asks.
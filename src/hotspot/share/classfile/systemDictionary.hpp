@@ -470,6 +470,8 @@ public:
                                             Klass* accessing_klass,
                                             Handle *appendix_result,
                                             TRAPS);
+  // drop the invokers shared by find_method_handle_invoker (at a safepoint)
+  static void clear_method_handle_invokers();
   // for a given signature, find the internal MethodHandle method (linkTo* or invokeBasic)
   // (does not ask Java, since this is a low-level intrinsic defined by the JVM)
   static Method* find_method_handle_intrinsic(vmIntrinsics::ID iid,
@@ -105,8 +105,20 @@ bool VerificationType::is_reference_assignable_from(
       }
     }
 
-    return resolve_and_check_assignability(klass, name(), from.name(),
-          from_field_is_protected, from.is_array(), from.is_object(), THREAD);
+    assignability_table_type* table = context->assignability_table();
+    if (table == NULL) {
+      return resolve_and_check_assignability(klass, name(), from.name(),
+            from_field_is_protected, from.is_array(), from.is_object(), THREAD);
+    }
+    assignability_check check(name(), from.name(), from_field_is_protected);
+    bool* cached = table->get(check);
+    if (cached != NULL) {
+      return *cached;
+    }
+    bool result = resolve_and_check_assignability(klass, name(), from.name(),
+          from_field_is_protected, from.is_array(), from.is_object(), CHECK_false);
+    table->put(check, result);
+    return result;
   } else if (is_array() && from.is_array()) {
     VerificationType comp_this = get_component(context, CHECK_false);
     VerificationType comp_from = from.get_component(context, CHECK_false);
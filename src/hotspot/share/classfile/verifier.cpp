@@ -583,7 +583,7 @@ void ErrorContext::stackmap_details(outputStream* ss, const Method* method) cons
 ClassVerifier::ClassVerifier(
     InstanceKlass* klass, TRAPS)
     : _thread(THREAD), _previous_symbol(NULL), _symbols(NULL), _exception_type(NULL),
-      _message(NULL), _method_signatures_table(NULL), _klass(klass) {
+      _message(NULL), _method_signatures_table(NULL), _assignability_table(NULL), _klass(klass) {
   _this_type = VerificationType::reference_type(klass->name());
 }
 
@@ -617,6 +617,9 @@ void ClassVerifier::verify_class(TRAPS) {
   method_signatures_table_type method_signatures_table;
   set_method_signatures_table(&method_signatures_table);
 
+  assignability_table_type assignability_table;
+  _assignability_table = &assignability_table;
+
   Array<Method*>* methods = _klass->methods();
   int num_methods = methods->length();
 
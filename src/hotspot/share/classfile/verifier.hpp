@@ -274,6 +274,34 @@ typedef ResourceHashtable<int, sig_as_verification_types*,
                           primitive_hash<int>, primitive_equals<int>, 1007>
                           method_signatures_table_type;
 
+// Key of the results of the assignability checks between two class types
+// that had to resolve the classes, so that a check that is repeated while
+// verifying a class does not go through the system dictionary again.
+class assignability_check {
+ public:
+  Symbol* _target_name;
+  Symbol* _from_name;
+  bool    _from_field_is_protected;
+
+  assignability_check(Symbol* target_name, Symbol* from_name, bool from_field_is_protected) :
+    _target_name(target_name), _from_name(from_name),
+    _from_field_is_protected(from_field_is_protected) {
+  }
+
+  static unsigned hash(const assignability_check& c) {
+    return c._target_name->identity_hash() * 31 + c._from_name->identity_hash();
+  }
+
+  static bool equals(const assignability_check& a, const assignability_check& b) {
+    return a._target_name == b._target_name && a._from_name == b._from_name &&
+           a._from_field_is_protected == b._from_field_is_protected;
+  }
+};
+
+typedef ResourceHashtable<assignability_check, bool,
+                          assignability_check::hash, assignability_check::equals, 256>
+                          assignability_table_type;
+
 // A new instance of this class is created for each class being verified
 class ClassVerifier : public StackObj {
  private:
@@ -286,6 +314,7 @@ class ClassVerifier : public StackObj {
   char* _message;
 
   method_signatures_table_type* _method_signatures_table;
+  assignability_table_type* _assignability_table;
 
   ErrorContext _error_context;  // contains information about an error
 
@@ -445,6 +474,10 @@ class ClassVerifier : public StackObj {
     _method_signatures_table = method_signatures_table;
   }
 
+  assignability_table_type* assignability_table() const {
+    return _assignability_table;
+  }
+
   int change_sig_to_verificationType(
     SignatureStream* sig_type, VerificationType* inference_type);
 
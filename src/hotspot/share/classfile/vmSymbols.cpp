@@ -772,13 +772,24 @@ bool vmIntrinsics::is_disabled_by_flags(vmIntrinsics::ID id) {
   case vmIntrinsics::_vectorizedMismatch:
     if (!UseVectorizedMismatchIntrinsic) return true;
     break;
+  case vmIntrinsics::_hashCodeB:
+  case vmIntrinsics::_hashCodeC:
+  case vmIntrinsics::_hashCodeI:
+  case vmIntrinsics::_hashCodeL:
+  case vmIntrinsics::_hashCodeU:
+    if (!UseVectorizedHashCodeIntrinsic) return true;
+    break;
   case vmIntrinsics::_updateBytesAdler32:
   case vmIntrinsics::_updateByteBufferAdler32:
     if (!UseAdler32Intrinsics) return true;
     break;
   case vmIntrinsics::_copyMemory:
+  case vmIntrinsics::_copySwapMemory:
     if (!InlineArrayCopy || !InlineUnsafeOps) return true;
     break;
+  case vmIntrinsics::_setMemory:
+    if (!InlineUnsafeOps) return true;
+    break;
 #ifdef COMPILER1
   case vmIntrinsics::_checkIndex:
     if (!InlineNIOCheckIndex) return true;
@@ -96,6 +96,7 @@
   template(java_lang_reflect_Array,                   "java/lang/reflect/Array")                  \
   template(java_lang_StringBuffer,                    "java/lang/StringBuffer")                   \
   template(java_lang_StringBuilder,                   "java/lang/StringBuilder")                  \
+  template(java_lang_StringConcatHelper,              "java/lang/StringConcatHelper")             \
   template(java_lang_CharSequence,                    "java/lang/CharSequence")                   \
   template(java_lang_SecurityManager,                 "java/lang/SecurityManager")                \
   template(java_security_AccessControlContext,        "java/security/AccessControlContext")       \
@@ -912,6 +913,12 @@
    do_signature(equalsC_signature,                               "([C[C)Z")                                             \
   do_intrinsic(_equalsB,                  java_util_Arrays,       equals_name,    equalsB_signature,             F_S)   \
    do_signature(equalsB_signature,                               "([B[B)Z")                                             \
+  do_intrinsic(_hashCodeB,                java_util_Arrays,       hashCode_name,  hashCodeB_signature,           F_S)   \
+   do_signature(hashCodeB_signature,                             "([B)I")                                               \
+  do_intrinsic(_hashCodeC,                java_util_Arrays,       hashCode_name,  hashCodeC_signature,           F_S)   \
+   do_signature(hashCodeC_signature,                             "([C)I")                                               \
+  do_intrinsic(_hashCodeI,                java_util_Arrays,       hashCode_name,  hashCodeI_signature,           F_S)   \
+   do_signature(hashCodeI_signature,                             "([I)I")                                               \
                                                                                                                         \
   do_intrinsic(_compressStringC,          java_lang_StringUTF16,  compress_name, encodeISOArray_signature,       F_S)   \
    do_name(     compress_name,                                   "compress")                                            \
@@ -953,6 +960,8 @@
    do_signature(indexOfChar_signature,                           "([BIII)I")                                            \
   do_intrinsic(_equalsL,                  java_lang_StringLatin1,equals_name, equalsB_signature,                 F_S)   \
   do_intrinsic(_equalsU,                  java_lang_StringUTF16, equals_name, equalsB_signature,                 F_S)   \
+  do_intrinsic(_hashCodeL,                java_lang_StringLatin1,hashCode_name, hashCodeB_signature,             F_S)   \
+  do_intrinsic(_hashCodeU,                java_lang_StringUTF16, hashCode_name, hashCodeB_signature,             F_S)   \
                                                                                                                         \
   do_intrinsic(_isDigit,                  java_lang_CharacterDataLatin1, isDigit_name,      int_bool_signature,  F_R)   \
    do_name(     isDigit_name,                                           "isDigit")                                      \
@@ -1113,6 +1122,12 @@
   do_intrinsic(_copyMemory,               jdk_internal_misc_Unsafe,     copyMemory_name, copyMemory_signature,         F_RN)     \
    do_name(     copyMemory_name,                                        "copyMemory0")                                           \
    do_signature(copyMemory_signature,                                   "(Ljava/lang/Object;JLjava/lang/Object;JJ)V")            \
+  do_intrinsic(_copySwapMemory,           jdk_internal_misc_Unsafe,     copySwapMemory_name, copySwapMemory_signature, F_RN)     \
+   do_name(     copySwapMemory_name,                                    "copySwapMemory0")                                       \
+   do_signature(copySwapMemory_signature,                               "(Ljava/lang/Object;JLjava/lang/Object;JJJ)V")           \
+  do_intrinsic(_setMemory,                jdk_internal_misc_Unsafe,     setMemory_name, setMemory_signature,           F_RN)     \
+   do_name(     setMemory_name,                                         "setMemory0")                                            \
+   do_signature(setMemory_signature,                                    "(Ljava/lang/Object;JJB)V")                              \
   do_intrinsic(_loadFence,                jdk_internal_misc_Unsafe,     loadFence_name, loadFence_signature,           F_RN)     \
    do_name(     loadFence_name,                                         "loadFence")                                             \
    do_alias(    loadFence_signature,                                    void_method_signature)                                   \
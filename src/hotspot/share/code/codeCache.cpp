@@ -991,7 +991,26 @@ void CodeCache::cleanup_inline_caches() {
 // Keeps track of time spent for checking dependencies
 NOT_PRODUCT(static elapsedTimer dependentCheckTime;)
 
+// True if any of the contexts involved in the change has dependent nmethods.
+// Dependents are only added while holding the Compile_lock, which the caller
+// of a KlassDepChange holds, so the answer cannot go from false to true
+// while the change is processed.
+static bool has_dependent_nmethods(KlassDepChange& changes) {
+  for (DepChange::ContextStream str(changes); str.next(); ) {
+    if (InstanceKlass::cast(str.klass())->has_dependent_nmethods()) {
+      return true;
+    }
+  }
+  return false;
+}
+
 int CodeCache::mark_for_deoptimization(KlassDepChange& changes) {
+  // Loading a class whose supertypes have no dependents is the common case;
+  // leave early, without contending on the CodeCache_lock.
+  if (!has_dependent_nmethods(changes) NOT_PRODUCT(&& !VerifyDependencies)) {
+    return 0;
+  }
+
   MutexLocker mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
   int number_of_marked_CodeBlobs = 0;
 
@@ -27,6 +27,7 @@
 #include "code/codeHeapState.hpp"
 #include "compiler/compileBroker.hpp"
 #include "runtime/sweeper.hpp"
+#include "runtime/timer.hpp"
 
 // -------------------------
 // |  General Description  |
@@ -1111,6 +1112,16 @@ void CodeHeapState::aggregate(outputStream* out, CodeHeap* heap, size_t granular
       ast->print_cr("Building TopSizeList iterations = %ld", total_iterations);
       ast->cr();
 
+      julong searches = heap->freelist_searches();
+      ast->print_cr("freelist searches               = " JULONG_FORMAT ", free blocks visited = " JULONG_FORMAT " (%.1f per search)",
+                    searches, heap->freelist_search_steps(),
+                    (searches == 0) ? 0.0 : (double)heap->freelist_search_steps() / (double)searches);
+      ast->print_cr("freelist search time            = %.3f ms total, %.3f us average, %.3f us max",
+                    TimeHelper::counter_to_millis(heap->freelist_search_ticks()),
+                    (searches == 0) ? 0.0 : 1000.0 * TimeHelper::counter_to_millis(heap->freelist_search_ticks()) / (double)searches,
+                    1000.0 * TimeHelper::counter_to_millis(heap->freelist_search_max_ticks()));
+      ast->cr();
+
       int             reset_val = NMethodSweeper::hotness_counter_reset_val();
       double reverse_free_ratio = (res_size > size) ? (double)res_size/(double)(res_size-size) : (double)res_size;
       printBox(ast, '-', "Method hotness information at time of this analysis", NULL);
@@ -118,6 +118,7 @@ class DependencyContext : public StackObj {
   static void init();
 
   int  mark_dependent_nmethods(DepChange& changes);
+  bool has_dependent_nmethods() { return dependencies() != NULL; }
   void add_dependent_nmethod(nmethod* nm);
   void remove_dependent_nmethod(nmethod* nm);
   int  remove_all_dependents();
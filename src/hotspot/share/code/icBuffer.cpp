@@ -42,6 +42,7 @@
 DEF_STUB_INTERFACE(ICStub);
 
 StubQueue* InlineCacheBuffer::_buffer    = NULL;
+volatile bool InlineCacheBuffer::_grow_requested = false;
 
 CompiledICHolder* InlineCacheBuffer::_pending_released = NULL;
 int InlineCacheBuffer::_pending_count = 0;
@@ -155,9 +156,12 @@ void InlineCacheBuffer::refill_ic_stubs() {
   verifier->request_remembered();
 #endif
   // we ran out of inline cache buffer space; must enter safepoint.
-  // We do this by forcing a safepoint
+  // We do this by forcing a safepoint, and ask for a larger buffer
+  // to be installed there so that the next refill comes later.
   EXCEPTION_MARK;
 
+  _grow_requested = true;
+
   VM_ICBufferFull ibf;
   VMThread::execute(&ibf);
   // We could potential get an async. exception at this point.
@@ -177,10 +181,39 @@ void InlineCacheBuffer::update_inline_caches() {
     }
     buffer()->remove_all();
   }
+  if (_grow_requested) {
+    _grow_requested = false;
+    grow_buffer();
+  }
   release_pending_icholders();
 }
 
 
+// Replace the empty buffer with one twice as large, up to
+// InlineCacheBufferMaxSize. Only done at a safepoint, after all
+// stubs have been removed, so no inline cache refers to the old buffer.
+void InlineCacheBuffer::grow_buffer() {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at a safepoint");
+  assert(is_empty(), "all ICStubs must have been removed");
+  const uintx old_size = (uintx)buffer()->total_space() + 1;
+  const uintx new_size = MIN2(old_size * 2, InlineCacheBufferMaxSize);
+  if (new_size <= old_size) {
+    return;
+  }
+  // The StubQueue constructor exits the VM if the code cache is full;
+  // keep the current buffer when there is no room for a larger one.
+  if (CodeCache::unallocated_capacity(CodeBlobType::NonNMethod) < 2 * new_size) {
+    return;
+  }
+  StubQueue* old_buffer = _buffer;
+  _buffer = new StubQueue(old_buffer->stub_interface(), (int)new_size, InlineCacheBuffer_lock, "InlineCacheBuffer");
+  delete old_buffer;
+  if (TraceICBuffer) {
+    tty->print_cr("[grew inline cache buffer from " UINTX_FORMAT " to " UINTX_FORMAT " bytes]", old_size, new_size);
+  }
+}
+
+
 bool InlineCacheBuffer::contains(address instruction_address) {
   return buffer()->contains(instruction_address);
 }
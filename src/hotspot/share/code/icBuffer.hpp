@@ -140,6 +140,7 @@ class InlineCacheBuffer: public AllStatic {
   static int ic_stub_code_size();
 
   static StubQueue* _buffer;
+  static volatile bool _grow_requested;
 
   static CompiledICHolder* _pending_released;
   static int _pending_count;
@@ -147,6 +148,7 @@ class InlineCacheBuffer: public AllStatic {
   static StubQueue* buffer()                         { return _buffer;         }
 
   static ICStub* new_ic_stub();
+  static void    grow_buffer();
 
   // Machine-dependent implementation of ICBuffer
   static void    assemble_ic_buffer_code(address code_begin, void* cached_value, address entry_point);
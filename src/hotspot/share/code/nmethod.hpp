@@ -259,8 +259,9 @@ class nmethod : public CompiledMethod {
   // The _hotness_counter indicates the hotness of a method. The higher
   // the value the hotter the method. The hotness counter of a nmethod is
   // set to [(ReservedCodeCacheSize / (1024 * 1024)) * 2] each time the method
-  // is active while stack scanning (mark_active_nmethods()). The hotness
-  // counter is decreased (by 1) while sweeping.
+  // is active while stack scanning (mark_active_nmethods()), or when it is
+  // entered for the first time after the GC armed its entry barrier. The
+  // hotness counter is decreased (by 1) while sweeping.
   int _hotness_counter;
 
   // Local state used to keep track of whether unloading is happening or not
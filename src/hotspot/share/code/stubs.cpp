@@ -82,11 +82,12 @@ StubQueue::StubQueue(StubInterface* stub_interface, int buffer_size,
 
 
 StubQueue::~StubQueue() {
-  // Note: Currently StubQueues are never destroyed so nothing needs to be done here.
-  //       If we want to implement the destructor, we need to release the BufferBlob
-  //       allocated in the constructor (i.e., we need to keep it around or look it
-  //       up via CodeCache::find_blob(...).
-  Unimplemented();
+  // The stub interface is not owned by the queue; only the BufferBlob
+  // allocated in the constructor is released.
+  assert(number_of_stubs() == 0, "cannot destroy a queue with live stubs");
+  CodeBlob* blob = CodeCache::find_blob_unsafe((void*)_stub_buffer);
+  assert(blob != NULL && blob->is_buffer_blob(), "stub buffer must be a BufferBlob");
+  BufferBlob::free((BufferBlob*)blob);
 }
 
 void StubQueue::deallocate_unused_tail() {
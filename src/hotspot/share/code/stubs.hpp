@@ -177,6 +177,8 @@ class StubQueue: public CHeapObj<mtCode> {
             const char* name);
   ~StubQueue();
 
+  StubInterface* stub_interface() const          { return _stub_interface; }
+
   // General queue info
   bool  is_empty() const                         { return _queue_begin == _queue_end; }
   int   total_space() const                      { return _buffer_size - 1; }
@@ -114,6 +114,10 @@
 bool CompileBroker::_initialized = false;
 volatile bool CompileBroker::_should_block = false;
 volatile int  CompileBroker::_print_compilation_warning = 0;
+
+jlong CompileBroker::_compiler_cpu_time = 0;
+jlong CompileBroker::_cpu_budget_window_start = 0;
+jlong CompileBroker::_cpu_budget_window_cpu_time = 0;
 volatile jint CompileBroker::_should_compile_new_jobs = run_compilation;
 
 // The installed compiler(s)
@@ -406,6 +410,7 @@ void CompileQueue::free_all() {
     CompileTask::free(current);
   }
   _first = NULL;
+  clear_candidates();
 
   // Wake up all threads that block on the queue.
   MethodCompileQueue_lock->notify_all();
@@ -470,11 +475,38 @@ CompileTask* CompileQueue::get() {
     save_hot_method = methodHandle(thread, task->hot_method());
 
     remove(task);
+
+    EventCompilationQueueWait event;
+    if (event.should_commit()) {
+      event.set_method(task->method());
+      event.set_compileId(task->compile_id());
+      event.set_compileLevel(task->comp_level());
+      event.set_isOsr(task->osr_bci() != InvocationEntryBci);
+      event.set_queueTime(TimeHelper::counter_to_millis(os::elapsed_counter() - task->time_queued()));
+      event.set_queueSize(_size);
+      event.commit();
+    }
   }
   purge_stale_tasks(); // may temporarily release MCQ lock
   return task;
 }
 
+void CompileQueue::set_candidates(CompileTask** tasks, int count, jlong time) {
+  assert(MethodCompileQueue_lock->owned_by_self(), "must own lock");
+  assert(count <= max_candidates, "too many candidates");
+  for (int i = 0; i < count; i++) {
+    _candidates[i] = tasks[i];
+  }
+  _candidate_count = count;
+  _scanned_last = _last;
+  _scan_time = time;
+}
+
+CompileTask* CompileQueue::first_unscanned() const {
+  assert(_scan_time != 0, "no scan");
+  return _scanned_last == NULL ? _first : _scanned_last->next();
+}
+
 // Clean & deallocate stale compile tasks.
 // Temporarily releases MethodCompileQueue lock.
 void CompileQueue::purge_stale_tasks() {
@@ -500,6 +532,22 @@ void CompileQueue::purge_stale_tasks() {
 
 void CompileQueue::remove(CompileTask* task) {
   assert(MethodCompileQueue_lock->owned_by_self(), "must own lock");
+  if (_scan_time != 0) {
+    // Keep the selection cache consistent. The tasks before the last
+    // scanned one stay scanned; a removed candidate is dropped.
+    if (task == _scanned_last) {
+      _scanned_last = task->prev();
+    }
+    for (int i = 0; i < _candidate_count; i++) {
+      if (_candidates[i] == task) {
+        _candidate_count--;
+        for (int j = i; j < _candidate_count; j++) {
+          _candidates[j] = _candidates[j + 1];
+        }
+        break;
+      }
+    }
+  }
   if (task->prev() != NULL) {
     task->prev()->set_next(task->next());
   } else {
@@ -920,7 +968,44 @@ void CompileBroker::init_compiler_sweeper_threads() {
   }
 }
 
+void CompileBroker::add_compiler_cpu_time(jlong cpu_time) {
+  MutexLocker mu(CompileThread_lock);
+  _compiler_cpu_time += cpu_time;
+}
+
+// The compiler threads may use CompilerCPUBudget percent of the CPUs available
+// to the process within each window of CompilerCPUBudgetWindow ms. The active
+// processor count follows the CPU quota of a container. CPU time used beyond
+// the budget of a window is carried over to the next one, since a single
+// compilation may take longer than a window.
+bool CompileBroker::over_cpu_budget() {
+  if (CompilerCPUBudget == 0) {
+    return false;
+  }
+  MutexLocker mu(CompileThread_lock);
+  const jlong now = os::javaTimeNanos();
+  const jlong window = (jlong)CompilerCPUBudgetWindow * NANOSECS_PER_MILLISEC;
+  const jlong elapsed = now - _cpu_budget_window_start;
+  const jlong used = _compiler_cpu_time - _cpu_budget_window_cpu_time;
+  const jlong budget = MIN2(elapsed, window) / 100 * os::active_processor_count() * (jlong)CompilerCPUBudget;
+  if (elapsed >= window) {
+    _cpu_budget_window_start = now;
+    _cpu_budget_window_cpu_time = _compiler_cpu_time - MAX2(used - budget, (jlong)0);
+    return _cpu_budget_window_cpu_time != _compiler_cpu_time;
+  }
+  return used > budget;
+}
+
+void CompileBroker::wait_for_cpu_budget(JavaThread* thread) {
+  while (over_cpu_budget() && !is_compilation_disabled_forever()) {
+    ThreadBlockInVM tbivm(thread);
+    os::naked_short_sleep(10);
+  }
+}
+
 void CompileBroker::possibly_add_compiler_threads(Thread* THREAD) {
+  // Adding threads does not help when the compilations are throttled.
+  if (over_cpu_budget()) return;
 
   julong available_memory = os::available_memory();
   // If SegmentedCodeCache is off, both values refer to the single heap (with type CodeBlobType::All).
@@ -1816,6 +1901,9 @@ void CompileBroker::compiler_thread_loop() {
     // We need this HandleMark to avoid leaking VM handles.
     HandleMark hm(thread);
 
+    // Leave the CPU to the application while the compiler threads are over budget.
+    wait_for_cpu_budget(thread);
+
     CompileTask* task = queue->get();
     if (task == NULL) {
       if (UseDynamicNumberOfCompilerThreads) {
@@ -1848,7 +1936,12 @@ void CompileBroker::compiler_thread_loop() {
       if (method()->number_of_breakpoints() == 0) {
         // Compile the method.
         if ((UseCompiler || AlwaysCompileLoopMethods) && CompileBroker::should_compile_new_jobs()) {
+          const bool measure_cpu_time = CompilerCPUBudget > 0 && os::is_thread_cpu_time_supported();
+          const jlong start_cpu_time = measure_cpu_time ? os::current_thread_cpu_time() : 0;
           invoke_compiler_on_method(task);
+          if (measure_cpu_time) {
+            add_compiler_cpu_time(os::current_thread_cpu_time() - start_cpu_time);
+          }
           thread->start_idle_timer();
         } else {
           // After compilation is disabled, remove remaining methods from queue
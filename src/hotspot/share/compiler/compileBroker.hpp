@@ -79,6 +79,11 @@ class CompilerCounters : public CHeapObj<mtCompiler> {
 //
 // A list of CompileTasks.
 class CompileQueue : public CHeapObj<mtCompiler> {
+ public:
+  // Number of the hottest tasks kept between full scans of the queue,
+  // see TieredThresholdPolicy::select_task().
+  static const int max_candidates = 8;
+
  private:
   const char* _name;
 
@@ -89,6 +94,12 @@ class CompileQueue : public CHeapObj<mtCompiler> {
 
   int _size;
 
+  // Selection cache, valid if _scan_time != 0
+  CompileTask* _candidates[max_candidates]; // hottest tasks found by the last full scan
+  int          _candidate_count;
+  CompileTask* _scanned_last;               // last task seen by the scan, later tasks were added since
+  jlong        _scan_time;                  // time of the last full scan
+
   void purge_stale_tasks();
  public:
   CompileQueue(const char* name) {
@@ -97,6 +108,9 @@ class CompileQueue : public CHeapObj<mtCompiler> {
     _last = NULL;
     _size = 0;
     _first_stale = NULL;
+    _candidate_count = 0;
+    _scanned_last = NULL;
+    _scan_time = 0;
   }
 
   const char*  name() const                      { return _name; }
@@ -112,6 +126,14 @@ class CompileQueue : public CHeapObj<mtCompiler> {
   bool         is_empty() const                  { return _first == NULL; }
   int          size()     const                  { return _size;          }
 
+  // Selection cache support
+  void         set_candidates(CompileTask** tasks, int count, jlong time);
+  void         clear_candidates()                { _candidate_count = 0; _scanned_last = NULL; _scan_time = 0; }
+  jlong        scan_time() const                 { return _scan_time; }
+  int          candidate_count() const           { return _candidate_count; }
+  CompileTask* candidate_at(int i) const         { assert(i < _candidate_count, "oob"); return _candidates[i]; }
+  CompileTask* first_unscanned() const;
+
 
   // Redefine Classes support
   void mark_on_stack();
@@ -226,10 +248,19 @@ class CompileBroker: AllStatic {
 
   static volatile int _print_compilation_warning;
 
+  // CPU time (in ns) used by the compiler threads and the window it is
+  // checked against CompilerCPUBudget in, protected by CompileThread_lock.
+  static jlong _compiler_cpu_time;
+  static jlong _cpu_budget_window_start;
+  static jlong _cpu_budget_window_cpu_time;
+
   static Handle create_thread_oop(const char* name, TRAPS);
   static JavaThread* make_thread(jobject thread_oop, CompileQueue* queue, AbstractCompiler* comp, Thread* THREAD);
   static void init_compiler_sweeper_threads();
   static void possibly_add_compiler_threads(Thread* THREAD);
+  static void add_compiler_cpu_time(jlong cpu_time);
+  static bool over_cpu_budget();
+  static void wait_for_cpu_budget(JavaThread* thread);
   static bool compilation_is_prohibited(const methodHandle& method, int osr_bci, int comp_level, bool excluded);
 
   static CompileTask* create_compile_task(CompileQueue*       queue,
@@ -0,0 +1,382 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "classfile/classLoaderDataGraph.hpp"
+#include "classfile/symbolTable.hpp"
+#include "compiler/compilerDefinitions.hpp"
+#include "compiler/profileSnapshot.hpp"
+#include "interpreter/invocationCounter.hpp"
+#include "logging/log.hpp"
+#include "memory/allocation.inline.hpp"
+#include "memory/resourceArea.hpp"
+#include "oops/method.inline.hpp"
+#include "oops/methodData.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/handles.inline.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/thread.hpp"
+#include "utilities/growableArray.hpp"
+#include "utilities/ostream.hpp"
+
+// Counts recorded for one ProfileData cell of a MethodData.
+struct ProfileSnapshotRecord {
+  int  _bci;
+  int  _tag;
+  uint _count1;  // count or taken
+  uint _count2;  // not taken
+};
+
+class ProfileSnapshotEntry : public CHeapObj<mtCompiler> {
+ public:
+  Symbol*                _klass_name;
+  Symbol*                _name;
+  Symbol*                _signature;
+  int                    _invocation_count;
+  int                    _backedge_count;
+  int                    _record_count;
+  ProfileSnapshotRecord* _records;
+  volatile int           _seeded;
+  ProfileSnapshotEntry*  _next;
+
+  static unsigned hash(Symbol* klass_name, Symbol* name, Symbol* signature) {
+    return (klass_name->identity_hash() * 31 + name->identity_hash()) * 31 + signature->identity_hash();
+  }
+
+  bool matches(Method* m) const {
+    return m->name() == _name && m->signature() == _signature && m->klass_name() == _klass_name;
+  }
+};
+
+static const int profile_snapshot_table_size = 1009;
+
+ProfileSnapshotEntry** ProfileSnapshot::_table = NULL;
+volatile int           ProfileSnapshot::_pending = 0;
+
+ProfileSnapshotEntry* ProfileSnapshot::lookup(Method* m) {
+  unsigned index = ProfileSnapshotEntry::hash(m->klass_name(), m->name(), m->signature()) % profile_snapshot_table_size;
+  for (ProfileSnapshotEntry* e = _table[index]; e != NULL; e = e->_next) {
+    if (e->matches(m)) {
+      return e;
+    }
+  }
+  return NULL;
+}
+
+void ProfileSnapshot::add(ProfileSnapshotEntry* entry) {
+  unsigned index = ProfileSnapshotEntry::hash(entry->_klass_name, entry->_name, entry->_signature) % profile_snapshot_table_size;
+  entry->_next = _table[index];
+  _table[index] = entry;
+  _pending++;
+}
+
+// Tokenizer for one line of the snapshot file.
+class ProfileSnapshotLine : public StackObj {
+ private:
+  char* _pos;
+
+ public:
+  ProfileSnapshotLine(char* line) : _pos(line) {}
+
+  char* next_token() {
+    while (*_pos == ' ' || *_pos == '\t') {
+      _pos++;
+    }
+    if (*_pos == '\0') {
+      return NULL;
+    }
+    char* token = _pos;
+    while (*_pos != ' ' && *_pos != '\t' && *_pos != '\0') {
+      _pos++;
+    }
+    if (*_pos != '\0') {
+      *_pos++ = '\0';
+    }
+    return token;
+  }
+
+  static bool parse_int(const char* token, int* value) {
+    int read;
+    return token != NULL && sscanf(token, "%i%n", value, &read) == 1 && token[read] == '\0';
+  }
+
+  bool next_int(int* value) {
+    return parse_int(next_token(), value);
+  }
+
+  bool next_symbol(Symbol** value) {
+    char* token = next_token();
+    if (token == NULL || strchr(token, '\\') != NULL) {
+      // Names that needed escaping are not recorded
+      return false;
+    }
+    *value = SymbolTable::new_symbol(token);
+    return true;
+  }
+};
+
+// Releases the symbols of an entry that could not be parsed.
+static void release_symbols(Symbol* klass_name, Symbol* name, Symbol* signature) {
+  if (klass_name != NULL) klass_name->decrement_refcount();
+  if (name != NULL)       name->decrement_refcount();
+  if (signature != NULL)  signature->decrement_refcount();
+}
+
+bool ProfileSnapshot::parse(char* buffer) {
+  ProfileSnapshotLine line(buffer);
+  char* command = line.next_token();
+  if (command == NULL || command[0] == '#') {
+    return true;
+  }
+  if (strcmp(command, "method") != 0) {
+    return false;
+  }
+
+  Symbol* klass_name = NULL;
+  Symbol* name = NULL;
+  Symbol* signature = NULL;
+  int invocation_count;
+  int backedge_count;
+  if (!line.next_symbol(&klass_name) || !line.next_symbol(&name) || !line.next_symbol(&signature) ||
+      !line.next_int(&invocation_count) || !line.next_int(&backedge_count)) {
+    release_symbols(klass_name, name, signature);
+    return false;
+  }
+
+  ResourceMark rm;
+  GrowableArray<ProfileSnapshotRecord> records;
+  ProfileSnapshotRecord r;
+  int count1;
+  int count2;
+  char* token;
+  while ((token = line.next_token()) != NULL) {
+    if (!ProfileSnapshotLine::parse_int(token, &r._bci) ||
+        !line.next_int(&r._tag) || !line.next_int(&count1) || !line.next_int(&count2)) {
+      release_symbols(klass_name, name, signature);
+      return false;
+    }
+    r._count1 = (uint)count1;
+    r._count2 = (uint)count2;
+    records.append(r);
+  }
+
+  ProfileSnapshotEntry* entry = new ProfileSnapshotEntry();
+  entry->_klass_name = klass_name;
+  entry->_name = name;
+  entry->_signature = signature;
+  entry->_invocation_count = invocation_count;
+  entry->_backedge_count = backedge_count;
+  entry->_record_count = records.length();
+  entry->_records = NEW_C_HEAP_ARRAY(ProfileSnapshotRecord, records.length(), mtCompiler);
+  for (int i = 0; i < records.length(); i++) {
+    entry->_records[i] = records.at(i);
+  }
+  entry->_seeded = 0;
+  add(entry);
+  return true;
+}
+
+void ProfileSnapshot::initialize() {
+  if (ProfileSnapshotReplayFile == NULL || !TieredCompilation) {
+    return;
+  }
+  FILE* stream = fopen(ProfileSnapshotReplayFile, "rt");
+  if (stream == NULL) {
+    log_warning(jit, compilation)("Could not open profile snapshot %s", ProfileSnapshotReplayFile);
+    return;
+  }
+
+  _table = NEW_C_HEAP_ARRAY(ProfileSnapshotEntry*, profile_snapshot_table_size, mtCompiler);
+  for (int i = 0; i < profile_snapshot_table_size; i++) {
+    _table[i] = NULL;
+  }
+
+  ResourceMark rm;
+  int length = 256;
+  char* buffer = NEW_RESOURCE_ARRAY(char, length);
+  int line_number = 0;
+  int c = getc(stream);
+  while (c != EOF) {
+    int pos = 0;
+    while (c != EOF && c != '\n') {
+      if (pos + 1 >= length) {
+        buffer = REALLOC_RESOURCE_ARRAY(char, buffer, length, length * 2);
+        length *= 2;
+      }
+      if (c != '\r') {
+        buffer[pos++] = (char)c;
+      }
+      c = getc(stream);
+    }
+    buffer[pos] = '\0';
+    line_number++;
+    if (!parse(buffer)) {
+      log_warning(jit, compilation)("Ignoring malformed entry at %s:%d", ProfileSnapshotReplayFile, line_number);
+    }
+    if (c != EOF) {
+      c = getc(stream);
+    }
+  }
+  fclose(stream);
+
+  log_info(jit, compilation)("Loaded %d method profiles from %s", _pending, ProfileSnapshotReplayFile);
+}
+
+static int profile_tag(ProfileData* data) {
+  return ((DataLayout*)data->dp())->tag();
+}
+
+static void seed_counter(InvocationCounter* counter, int count) {
+  int seeded = MIN2(counter->count() + count, (int)InvocationCounter::count_limit - 1);
+  counter->set(counter->state(), seeded);
+}
+
+void ProfileSnapshot::seed(const methodHandle& mh, JavaThread* THREAD) {
+  ProfileSnapshotEntry* entry = lookup(mh());
+  if (entry == NULL || Atomic::cmpxchg(&entry->_seeded, 0, 1) != 0) {
+    return;
+  }
+  Atomic::dec(&_pending);
+
+  MethodCounters* mcs = mh->get_method_counters(CHECK_AND_CLEAR);
+  if (mcs == NULL) {
+    return;
+  }
+  seed_counter(mcs->invocation_counter(), entry->_invocation_count);
+  seed_counter(mcs->backedge_counter(), entry->_backedge_count);
+
+  if (entry->_record_count == 0 || mh->is_native()) {
+    return;
+  }
+  if (mh->method_data() == NULL) {
+    Method::build_interpreter_method_data(mh, CHECK_AND_CLEAR);
+  }
+  MethodData* mdo = mh->method_data();
+  if (mdo == NULL) {
+    return;
+  }
+
+  ResourceMark rm(THREAD);
+  int seeded = 0;
+  for (int i = 0; i < entry->_record_count; i++) {
+    ProfileSnapshotRecord* r = &entry->_records[i];
+    ProfileData* data = mdo->bci_to_data(r->_bci);
+    if (data == NULL || profile_tag(data) != r->_tag) {
+      // The method changed since the snapshot was taken
+      continue;
+    }
+    if (data->is_BranchData()) {
+      BranchData* branch = data->as_BranchData();
+      branch->set_taken(branch->taken() + r->_count1);
+      branch->set_not_taken(branch->not_taken() + r->_count2);
+    } else if (data->is_JumpData()) {
+      JumpData* jump = data->as_JumpData();
+      jump->set_taken(jump->taken() + r->_count1);
+    } else if (data->is_CounterData()) {
+      CounterData* counter = data->as_CounterData();
+      counter->set_count(counter->count() + r->_count1);
+    }
+    seeded++;
+  }
+
+  if (log_is_enabled(Debug, jit, compilation)) {
+    ResourceMark rm(THREAD);
+    log_debug(jit, compilation)("Seeded profile of %s (%d of %d records)",
+                                mh->name_and_sig_as_C_string(), seeded, entry->_record_count);
+  }
+}
+
+// Returns the counts to record for the given ProfileData. Receiver and
+// argument type profiles refer to classes of this run and are skipped.
+static bool snapshot_counts(ProfileData* data, uint* count1, uint* count2) {
+  if (data->is_BranchData()) {
+    *count1 = data->as_BranchData()->taken();
+    *count2 = data->as_BranchData()->not_taken();
+  } else if (data->is_JumpData()) {
+    *count1 = data->as_JumpData()->taken();
+    *count2 = 0;
+  } else if (data->is_CounterData() && !data->is_ReceiverTypeData() && !data->is_RetData()) {
+    *count1 = data->as_CounterData()->count();
+    *count2 = 0;
+  } else {
+    return false;
+  }
+  return *count1 != 0 || *count2 != 0;
+}
+
+static outputStream* _dump_stream = NULL;
+static int           _dump_count = 0;
+
+void ProfileSnapshot::dump_method(Method* m) {
+  MethodData* mdo = m->method_data();
+  if (mdo == NULL || m->highest_comp_level() < CompLevel_full_profile) {
+    // Only methods that were compiled with profiling are hot enough
+    return;
+  }
+
+  ResourceMark rm;
+  const char* klass_name = m->klass_name()->as_quoted_ascii();
+  const char* name = m->name()->as_quoted_ascii();
+  const char* signature = m->signature()->as_quoted_ascii();
+  if (strpbrk(klass_name, " \\") != NULL || strpbrk(name, " \\") != NULL || strpbrk(signature, " \\") != NULL) {
+    return;
+  }
+
+  outputStream* st = _dump_stream;
+  st->print("method %s %s %s %d %d", klass_name, name, signature, m->invocation_count(), m->backedge_count());
+  for (ProfileData* data = mdo->first_data(); mdo->is_valid(data); data = mdo->next_data(data)) {
+    uint count1;
+    uint count2;
+    if (snapshot_counts(data, &count1, &count2)) {
+      st->print(" %d %d %u %u", data->bci(), profile_tag(data), count1, count2);
+    }
+  }
+  st->cr();
+  _dump_count++;
+}
+
+bool ProfileSnapshot::dump(const char* filename, outputStream* st) {
+  fileStream fs(filename, "w");
+  if (!fs.is_open()) {
+    st->print_cr("Could not open profile snapshot %s", filename);
+    return false;
+  }
+
+  fs.print_cr("# method <klass> <name> <signature> <invocations> <backedges> [<bci> <tag> <count1> <count2>]*");
+  int count;
+  {
+    MutexLocker ml(ClassLoaderDataGraph_lock);
+    _dump_stream = &fs;
+    _dump_count = 0;
+    ClassLoaderDataGraph::methods_do(dump_method);
+    count = _dump_count;
+    _dump_stream = NULL;
+  }
+  st->print_cr("Dumped %d method profiles to %s", count, filename);
+  return true;
+}
+
+void profileSnapshot_init() {
+  ProfileSnapshot::initialize();
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_COMPILER_PROFILESNAPSHOT_HPP
+#define SHARE_COMPILER_PROFILESNAPSHOT_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class JavaThread;
+class Method;
+class methodHandle;
+class outputStream;
+class ProfileSnapshotEntry;
+
+// A profile snapshot records the counters and the branch profiles of the
+// methods that were hot in one run, in a text format similar to the
+// ciReplay data files:
+//
+//   method <klass> <name> <signature> <invocations> <backedges> [<bci> <tag> <count1> <count2>]*
+//
+// A later run loads the snapshot at startup (ProfileSnapshotReplayFile).
+// The first time the tiered policy sees an interpreter event for a recorded
+// method, the recorded counters and branch profiles are copied into the
+// MethodCounters and the MethodData, so the method is queued for compilation
+// right away instead of being profiled in the interpreter from scratch.
+//
+// Type profiles are not recorded since they refer to Klass pointers of the
+// previous run; they are collected again by the profiled tier.
+class ProfileSnapshot : AllStatic {
+ private:
+  static ProfileSnapshotEntry** _table;
+  static volatile int           _pending;
+
+  static ProfileSnapshotEntry* lookup(Method* m);
+  static void add(ProfileSnapshotEntry* entry);
+  static bool parse(char* buffer);
+  static void dump_method(Method* m);
+
+ public:
+  // Load the snapshot named by ProfileSnapshotReplayFile, if any.
+  static void initialize();
+
+  // Write the profiles of the hot methods to the given file.
+  static bool dump(const char* filename, outputStream* st);
+
+  // True if some of the loaded profiles have not been applied yet.
+  static bool has_pending() { return _pending > 0; }
+
+  // Apply the recorded profile of the method, if there is one that has not
+  // been applied yet.
+  static void seed(const methodHandle& mh, JavaThread* THREAD);
+};
+
+#endif // SHARE_COMPILER_PROFILESNAPSHOT_HPP
@@ -23,8 +23,10 @@
  */
 
 #include "precompiled.hpp"
+#include "aot/aotLoader.hpp"
 #include "compiler/compileBroker.hpp"
 #include "compiler/compilerOracle.hpp"
+#include "compiler/profileSnapshot.hpp"
 #include "compiler/tieredThresholdPolicy.hpp"
 #include "memory/resourceArea.hpp"
 #include "runtime/arguments.hpp"
@@ -327,43 +329,115 @@ void TieredThresholdPolicy::handle_counter_overflow(Method* method) {
   }
 }
 
+// Insert the task into the array of the hottest tasks, which is kept
+// sorted by compare_methods().
+void TieredThresholdPolicy::add_candidate(CompileTask** candidates, int& count, CompileTask* task) {
+  int i = count;
+  if (count == CompileQueue::max_candidates) {
+    if (!compare_methods(task->method(), candidates[count - 1]->method())) {
+      return;
+    }
+    i--;
+  } else {
+    count++;
+  }
+  for (; i > 0 && compare_methods(task->method(), candidates[i - 1]->method()); i--) {
+    candidates[i] = candidates[i - 1];
+  }
+  candidates[i] = task;
+}
+
+// Select the hottest task among the candidates of the last full scan and the
+// tasks added to the queue since. Returns NULL if the queue must be scanned
+// again, e.g. since a task has to be removed.
+CompileTask* TieredThresholdPolicy::select_candidate_task(CompileQueue* compile_queue, jlong t) {
+  CompileTask* max_task = NULL;
+  for (int i = 0; i < compile_queue->candidate_count(); i++) {
+    CompileTask* task = compile_queue->candidate_at(i);
+    if (!select_candidate(task, max_task, t)) {
+      return NULL;
+    }
+  }
+  for (CompileTask* task = compile_queue->first_unscanned(); task != NULL; task = task->next()) {
+    if (!select_candidate(task, max_task, t)) {
+      return NULL;
+    }
+  }
+  return max_task;
+}
+
+bool TieredThresholdPolicy::select_candidate(CompileTask* task, CompileTask*& max_task, jlong t) {
+  Method* method = task->method();
+  if (task->is_unloaded() || task->is_blocking() ||
+      (task->can_become_stale() && is_stale(t, TieredCompileTaskTimeout, method) && !is_old(method))) {
+    return false;
+  }
+  update_rate(t, method);
+  if (max_task == NULL || compare_methods(method, max_task->method())) {
+    max_task = task;
+  }
+  return true;
+}
+
 // Called with the queue locked and with at least one element
 CompileTask* TieredThresholdPolicy::select_task(CompileQueue* compile_queue) {
   CompileTask *max_blocking_task = NULL;
   CompileTask *max_task = NULL;
   Method* max_method = NULL;
   jlong t = os::javaTimeMillis();
-  // Iterate through the queue and find a method with a maximum rate.
-  for (CompileTask* task = compile_queue->first(); task != NULL;) {
-    CompileTask* next_task = task->next();
-    Method* method = task->method();
-    // If a method was unloaded or has been stale for some time, remove it from the queue.
-    // Blocking tasks and tasks submitted from whitebox API don't become stale
-    if (task->is_unloaded() || (task->can_become_stale() && is_stale(t, TieredCompileTaskTimeout, method) && !is_old(method))) {
-      if (!task->is_unloaded()) {
-        if (PrintTieredEvents) {
-          print_event(REMOVE_FROM_QUEUE, method, method, task->osr_bci(), (CompLevel) task->comp_level());
+
+  // Scanning long queues on every selection is expensive during warmup.
+  // Between full scans, only the hottest tasks found by the last scan
+  // and new tasks are considered.
+  bool use_candidates = TieredCompileTaskRescanInterval > 0 &&
+                        compile_queue->size() > 4 * CompileQueue::max_candidates;
+  if (use_candidates && compile_queue->scan_time() != 0 &&
+      t - compile_queue->scan_time() < TieredCompileTaskRescanInterval) {
+    max_task = select_candidate_task(compile_queue, t);
+  }
+  if (max_task != NULL) {
+    max_method = max_task->method();
+  } else {
+    CompileTask* candidates[CompileQueue::max_candidates];
+    int candidate_count = 0;
+    compile_queue->clear_candidates();
+    // Iterate through the queue and find a method with a maximum rate.
+    for (CompileTask* task = compile_queue->first(); task != NULL;) {
+      CompileTask* next_task = task->next();
+      Method* method = task->method();
+      // If a method was unloaded or has been stale for some time, remove it from the queue.
+      // Blocking tasks and tasks submitted from whitebox API don't become stale
+      if (task->is_unloaded() || (task->can_become_stale() && is_stale(t, TieredCompileTaskTimeout, method) && !is_old(method))) {
+        if (!task->is_unloaded()) {
+          if (PrintTieredEvents) {
+            print_event(REMOVE_FROM_QUEUE, method, method, task->osr_bci(), (CompLevel) task->comp_level());
+          }
+          method->clear_queued_for_compilation();
         }
-        method->clear_queued_for_compilation();
+        compile_queue->remove_and_mark_stale(task);
+        task = next_task;
+        continue;
+      }
+      update_rate(t, method);
+      if (max_task == NULL || compare_methods(method, max_method)) {
+        // Select a method with the highest rate
+        max_task = task;
+        max_method = method;
       }
-      compile_queue->remove_and_mark_stale(task);
-      task = next_task;
-      continue;
-    }
-    update_rate(t, method);
-    if (max_task == NULL || compare_methods(method, max_method)) {
-      // Select a method with the highest rate
-      max_task = task;
-      max_method = method;
-    }
 
-    if (task->is_blocking()) {
-      if (max_blocking_task == NULL || compare_methods(method, max_blocking_task->method())) {
-        max_blocking_task = task;
+      if (task->is_blocking()) {
+        if (max_blocking_task == NULL || compare_methods(method, max_blocking_task->method())) {
+          max_blocking_task = task;
+        }
+      } else if (use_candidates) {
+        add_candidate(candidates, candidate_count, task);
       }
-    }
 
-    task = next_task;
+      task = next_task;
+    }
+    if (use_candidates && max_blocking_task == NULL) {
+      compile_queue->set_candidates(candidates, candidate_count, t);
+    }
   }
 
   if (max_blocking_task != NULL) {
@@ -430,6 +504,16 @@ nmethod* TieredThresholdPolicy::event(const methodHandle& method, const methodHa
     handle_counter_overflow(inlinee());
   }
 
+  if (comp_level == CompLevel_none && method->method_holder()->has_pending_aot_methods()) {
+    // Publish the AOT code of the holder on first use
+    AOTLoader::load_pending_methods(method->method_holder(), thread);
+  }
+
+  if (comp_level == CompLevel_none && ProfileSnapshot::has_pending()) {
+    // Start from the profile recorded by an earlier run, if there is one
+    ProfileSnapshot::seed(method, thread);
+  }
+
   if (PrintTieredEvents) {
     print_event(bci == InvocationEntryBci ? CALL : LOOP, method(), inlinee(), bci, comp_level);
   }
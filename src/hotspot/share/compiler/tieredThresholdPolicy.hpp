@@ -197,6 +197,10 @@ class TieredThresholdPolicy : public CompilationPolicy {
   inline double weight(Method* method);
   // Apply heuristics and return true if x should be compiled before y
   inline bool compare_methods(Method* x, Method* y);
+  // Compile queue selection cache support (see select_task()).
+  void add_candidate(CompileTask** candidates, int& count, CompileTask* task);
+  CompileTask* select_candidate_task(CompileQueue* compile_queue, jlong t);
+  bool select_candidate(CompileTask* task, CompileTask*& max_task, jlong t);
   // Compute event rate for a given method. The rate is the number of event (invocations + backedges)
   // per millisecond.
   inline void update_rate(jlong t, Method* m);
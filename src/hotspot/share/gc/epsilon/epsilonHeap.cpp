@@ -22,17 +22,46 @@
  */
 
 #include "precompiled.hpp"
+#include "aot/aotLoader.hpp"
+#include "classfile/classLoaderDataGraph.hpp"
+#include "classfile/systemDictionary.hpp"
+#include "code/codeCache.hpp"
+#include "compiler/oopMap.hpp"
 #include "gc/epsilon/epsilonHeap.hpp"
 #include "gc/epsilon/epsilonMemoryPool.hpp"
 #include "gc/epsilon/epsilonThreadLocalData.hpp"
 #include "gc/shared/gcArguments.hpp"
+#include "gc/shared/gcId.hpp"
+#include "gc/shared/gcLocker.hpp"
+#include "gc/shared/gcTraceTime.inline.hpp"
+#include "gc/shared/gcVMOperations.hpp"
+#include "gc/shared/isGCActiveMark.hpp"
 #include "gc/shared/locationPrinter.inline.hpp"
+#include "gc/shared/markBitMap.inline.hpp"
+#include "gc/shared/preservedMarks.inline.hpp"
+#include "gc/shared/weakProcessor.hpp"
 #include "memory/allocation.hpp"
 #include "memory/allocation.inline.hpp"
+#include "memory/iterator.inline.hpp"
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
+#include "oops/access.inline.hpp"
+#include "oops/compressedOops.inline.hpp"
+#include "oops/oop.inline.hpp"
+#include "prims/jvmtiExport.hpp"
 #include "runtime/atomic.hpp"
+#include "runtime/biasedLocking.hpp"
 #include "runtime/globals.hpp"
+#include "runtime/handles.inline.hpp"
+#include "runtime/safepoint.hpp"
+#include "runtime/synchronizer.hpp"
+#include "runtime/thread.hpp"
+#include "runtime/vmThread.hpp"
+#include "services/management.hpp"
+#include "services/memTracker.hpp"
+#include "services/memoryService.hpp"
+#include "utilities/copy.hpp"
+#include "utilities/stack.inline.hpp"
 
 jint EpsilonHeap::initialize() {
   size_t align = HeapAlignment;
@@ -62,6 +91,21 @@ jint EpsilonHeap::initialize() {
   _last_counter_update = 0;
   _last_heap_print = 0;
 
+  // Reserve the marking bitmap. It is only committed for the duration of
+  // a collection, so it takes no memory as long as no GC happens.
+  if (EpsilonSlidingGC) {
+    size_t bitmap_page_size = UseLargePages ? os::large_page_size() : (size_t) os::vm_page_size();
+    size_t bitmap_size = align_up(MarkBitMap::compute_size(heap_rs.size()), bitmap_page_size);
+    ReservedSpace bitmap_rs(bitmap_size, bitmap_page_size);
+    if (!bitmap_rs.is_reserved()) {
+      vm_shutdown_during_initialization("Could not reserve space for Epsilon marking bitmap");
+      return JNI_ENOMEM;
+    }
+    MemTracker::record_virtual_memory_type(bitmap_rs.base(), mtGC);
+    _bitmap_region = MemRegion((HeapWord*) bitmap_rs.base(), bitmap_rs.size() / HeapWordSize);
+    _bitmap.initialize(reserved_region, _bitmap_region);
+  }
+
   // Install barrier set
   BarrierSet::set_barrier_set(new EpsilonBarrierSet());
 
@@ -85,6 +129,11 @@ jint EpsilonHeap::initialize() {
     log_info(gc)("Not using TLAB allocation");
   }
 
+  if (EpsilonSlidingGC) {
+    log_info(gc)("Sliding GC enabled; marking bitmap: " SIZE_FORMAT "K reserved",
+                 _bitmap_region.byte_size() / K);
+  }
+
   return JNI_OK;
 }
 
@@ -241,7 +290,7 @@ HeapWord* EpsilonHeap::allocate_new_tlab(size_t min_size,
   }
 
   // All prepared, let's do it!
-  HeapWord* res = allocate_work(size);
+  HeapWord* res = allocate_or_collect_work(size);
 
   if (res != NULL) {
     // Allocation successful
@@ -265,7 +314,22 @@ HeapWord* EpsilonHeap::allocate_new_tlab(size_t min_size,
 
 HeapWord* EpsilonHeap::mem_allocate(size_t size, bool *gc_overhead_limit_was_exceeded) {
   *gc_overhead_limit_was_exceeded = false;
-  return allocate_work(size);
+  return allocate_or_collect_work(size);
+}
+
+HeapWord* EpsilonHeap::allocate_or_collect_work(size_t size) {
+  HeapWord* res = allocate_work(size);
+  if (res == NULL && EpsilonSlidingGC && Thread::current()->is_Java_thread()) {
+    vmentry_collect(GCCause::_allocation_failure);
+    res = allocate_work(size);
+    if (res == NULL && GCLocker::is_active_and_needs_gc() && !JavaThread::current()->in_critical()) {
+      // The collection was postponed by a JNI critical region. Wait for the
+      // collection the last thread leaving the region runs, and retry.
+      GCLocker::stall_until_clear();
+      res = allocate_work(size);
+    }
+  }
+  return res;
 }
 
 void EpsilonHeap::collect(GCCause::Cause cause) {
@@ -282,7 +346,15 @@ void EpsilonHeap::collect(GCCause::Cause cause) {
       print_metaspace_info();
       break;
     default:
-      log_info(gc)("GC request for \"%s\" is ignored", GCCause::to_string(cause));
+      if (EpsilonSlidingGC) {
+        if (SafepointSynchronize::is_at_safepoint()) {
+          entry_collect(cause);
+        } else {
+          vmentry_collect(cause);
+        }
+      } else {
+        log_info(gc)("GC request for \"%s\" is ignored", GCCause::to_string(cause));
+      }
   }
   _monitoring_support->update_counters();
 }
@@ -295,6 +367,27 @@ void EpsilonHeap::object_iterate(ObjectClosure *cl) {
   _space->object_iterate(cl);
 }
 
+class EpsilonVerifyObjectClosure : public ObjectClosure {
+public:
+  void do_object(oop obj) {
+    oopDesc::verify(obj);
+  }
+};
+
+void EpsilonHeap::prepare_for_verify() {
+  if (EpsilonSlidingGC && SafepointSynchronize::is_at_safepoint()) {
+    ensure_parsability(false);
+  }
+}
+
+void EpsilonHeap::verify(VerifyOption option) {
+  // The heap can only be walked when it has been made parsable at a safepoint
+  if (EpsilonSlidingGC && SafepointSynchronize::is_at_safepoint()) {
+    EpsilonVerifyObjectClosure cl;
+    object_iterate(&cl);
+  }
+}
+
 void EpsilonHeap::print_on(outputStream *st) const {
   st->print_cr("Epsilon Heap");
 
@@ -350,3 +443,300 @@ void EpsilonHeap::print_metaspace_info() const {
     log_info(gc, metaspace)("Metaspace: no reliable data");
   }
 }
+
+// ------------------ EXPERIMENTAL SLIDING MARK-COMPACT -----------------------
+//
+// With EpsilonSlidingGC, the heap is collected at a safepoint when it is
+// exhausted. This is a single-threaded LISP2-style mark-compact:
+//
+//   1. Mark all objects reachable from the roots in the marking bitmap;
+//   2. Walk the marked objects in address order, and store their new
+//      (slid down) addresses as forwarding pointers in the mark words,
+//      preserving the mark words that carry information;
+//   3. Adjust all references in the marked objects and in the roots;
+//   4. Copy the objects to their new locations, and retract the top.
+//
+// There is no reference processing and no class unloading: everything that
+// is reachable from any root, including weak roots, is retained. The barrier
+// set stays the same, which keeps the mutator costs at the Epsilon level.
+
+typedef Stack<oop, mtGC> EpsilonMarkStack;
+
+class EpsilonScanOopClosure : public BasicOopIterateClosure {
+private:
+  EpsilonMarkStack* const _stack;
+  MarkBitMap* const _bitmap;
+
+  template <class T>
+  void do_oop_work(T* p) {
+    T o = RawAccess<>::oop_load(p);
+    if (!CompressedOops::is_null(o)) {
+      oop obj = CompressedOops::decode_not_null(o);
+      // Single-threaded, non-atomic check-and-set is enough
+      if (!_bitmap->is_marked(obj)) {
+        _bitmap->mark((HeapWord*) obj);
+        _stack->push(obj);
+      }
+    }
+  }
+
+public:
+  EpsilonScanOopClosure(EpsilonMarkStack* stack, MarkBitMap* bitmap) :
+                        _stack(stack), _bitmap(bitmap) {}
+  virtual void do_oop(oop* p)       { do_oop_work(p); }
+  virtual void do_oop(narrowOop* p) { do_oop_work(p); }
+};
+
+class EpsilonCalcNewLocationObjectClosure : public ObjectClosure {
+private:
+  HeapWord* _compact_point;
+  PreservedMarks* const _preserved_marks;
+
+public:
+  EpsilonCalcNewLocationObjectClosure(HeapWord* start, PreservedMarks* pm) :
+                                      _compact_point(start),
+                                      _preserved_marks(pm) {}
+
+  void do_object(oop obj) {
+    // Objects that stay in place, which is the case for the dense prefix
+    // of the heap, are not forwarded at all.
+    if ((HeapWord*) obj != _compact_point) {
+      markWord mark = obj->mark_raw();
+      if (mark.must_be_preserved(obj->klass())) {
+        _preserved_marks->push(obj, mark);
+      }
+      obj->forward_to(oop(_compact_point));
+    }
+    _compact_point += obj->size();
+  }
+
+  HeapWord* compact_point() const { return _compact_point; }
+};
+
+class EpsilonAdjustPointersOopClosure : public BasicOopIterateClosure {
+private:
+  template <class T>
+  void do_oop_work(T* p) {
+    T o = RawAccess<>::oop_load(p);
+    if (!CompressedOops::is_null(o)) {
+      oop obj = CompressedOops::decode_not_null(o);
+      if (obj->is_forwarded()) {
+        oop fwd = obj->forwardee();
+        assert(fwd != NULL, "just checking");
+        RawAccess<>::oop_store(p, fwd);
+      }
+    }
+  }
+
+public:
+  virtual void do_oop(oop* p)       { do_oop_work(p); }
+  virtual void do_oop(narrowOop* p) { do_oop_work(p); }
+};
+
+class EpsilonAdjustPointersObjectClosure : public ObjectClosure {
+private:
+  EpsilonAdjustPointersOopClosure _cl;
+public:
+  void do_object(oop obj) {
+    obj->oop_iterate(&_cl);
+  }
+};
+
+class EpsilonMoveObjectsObjectClosure : public ObjectClosure {
+private:
+  size_t _moved;
+public:
+  EpsilonMoveObjectsObjectClosure() : ObjectClosure(), _moved(0) {}
+
+  void do_object(oop obj) {
+    // Objects are visited in address order and only ever slide down,
+    // so the source of every copy is still intact at this point.
+    if (obj->is_forwarded()) {
+      oop fwd = obj->forwardee();
+      assert(fwd != NULL, "just checking");
+      Copy::aligned_conjoint_words((HeapWord*) obj, (HeapWord*) fwd, obj->size());
+      fwd->init_mark_raw();
+      _moved++;
+    }
+  }
+
+  size_t moved() const { return _moved; }
+};
+
+class VM_EpsilonCollect : public VM_GC_Operation {
+public:
+  VM_EpsilonCollect(uint gc_count_before, GCCause::Cause cause) :
+                    VM_GC_Operation(gc_count_before, cause) {}
+
+  virtual VMOp_Type type() const { return VMOp_EpsilonCollect; }
+  virtual void doit() {
+    EpsilonHeap::heap()->entry_collect(_gc_cause);
+  }
+};
+
+void EpsilonHeap::vmentry_collect(GCCause::Cause cause) {
+  uint gc_count_before;
+  {
+    MutexLocker ml(Heap_lock);
+    gc_count_before = total_collections();
+  }
+
+  // Concurrent allocation failures coalesce into a single collection
+  VM_EpsilonCollect op(gc_count_before, cause);
+  VMThread::execute(&op);
+}
+
+void EpsilonHeap::process_roots(OopClosure* cl) {
+  // The entire code cache is walked below, so the thread stacks do not
+  // need to report their nmethods.
+  CLDToOopClosure clds(cl, ClassLoaderData::_claim_none);
+  CodeBlobToOopClosure blobs(cl, CodeBlobToOopClosure::FixRelocations);
+
+  ClassLoaderDataGraph::cld_do(&clds);
+  CodeCache::blobs_do(&blobs);
+  Threads::oops_do(cl, NULL);
+  Universe::oops_do(cl);
+  JNIHandles::oops_do(cl);
+  ObjectSynchronizer::oops_do(cl);
+  Management::oops_do(cl);
+  JvmtiExport::oops_do(cl);
+  AOT_ONLY(AOTLoader::oops_do(cl);)
+  SystemDictionary::oops_do(cl);
+
+  // No reference processing: weak roots are treated as strong
+  WeakProcessor::oops_do(cl);
+}
+
+void EpsilonHeap::walk_bitmap(ObjectClosure* cl) {
+  HeapWord* const limit = _space->top();
+  HeapWord* addr = _bitmap.get_next_marked_addr(_space->bottom(), limit);
+  while (addr < limit) {
+    oop obj = oop(addr);
+    assert(_bitmap.is_marked(obj), "sanity");
+    cl->do_object(obj);
+    addr += 1;
+    if (addr < limit) {
+      addr = _bitmap.get_next_marked_addr(addr, limit);
+    }
+  }
+}
+
+void EpsilonHeap::entry_collect(GCCause::Cause cause) {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at a safepoint");
+  assert(EpsilonSlidingGC, "should only be called with sliding GC enabled");
+
+  if (GCLocker::check_active_before_gc()) {
+    // The last thread leaving the critical region would request the GC again
+    log_info(gc)("GC request for \"%s\" is postponed: JNI critical region is active",
+                 GCCause::to_string(cause));
+    return;
+  }
+
+  GCIdMark gc_id_mark;
+  GCTraceTime(Info, gc) tm("Pause Full", NULL, cause, true);
+  SvcGCMarker sgcm(SvcGCMarker::FULL);
+  IsGCActiveMark active_gc_mark;
+  TraceMemoryManagerStats tms(&_memory_manager, cause);
+
+  size_t used_before = used();
+  size_t live_objects = 0;
+  size_t moved_objects = 0;
+  size_t preserved = 0;
+
+  // The bitmap is committed for the duration of the GC only. Freshly
+  // committed memory is zeroed, so there is no need to clear it.
+  if (!os::commit_memory((char*) _bitmap_region.start(), _bitmap_region.byte_size(), false)) {
+    log_warning(gc)("Could not commit native memory for marking bitmap, GC failed");
+    return;
+  }
+
+  increment_total_collections(true /* full */);
+
+  // Retire the TLABs, their memory is going to be reused
+  ensure_parsability(true);
+
+  if (VerifyBeforeGC) {
+    HandleMark hm;  // Discard invalid handles created during verification
+    Universe::verify("Before GC");
+  }
+
+  BiasedLocking::preserve_marks();
+#if COMPILER2_OR_JVMCI
+  DerivedPointerTable::clear();
+#endif
+
+  {
+    GCTraceTime(Info, gc, phases) tm("Phase 1: Mark live objects", NULL);
+    EpsilonMarkStack stack;
+    EpsilonScanOopClosure cl(&stack, &_bitmap);
+    process_roots(&cl);
+    while (!stack.is_empty()) {
+      oop obj = stack.pop();
+      obj->oop_iterate(&cl);
+      live_objects++;
+    }
+#if COMPILER2_OR_JVMCI
+    // Derived pointers are only discovered during marking
+    DerivedPointerTable::set_active(false);
+#endif
+  }
+
+  PreservedMarks preserved_marks;
+  HeapWord* new_top;
+
+  {
+    GCTraceTime(Info, gc, phases) tm("Phase 2: Compute new object addresses", NULL);
+    EpsilonCalcNewLocationObjectClosure cl(_space->bottom(), &preserved_marks);
+    walk_bitmap(&cl);
+    // The top cannot be retracted yet, the heap objects between the new
+    // and the old top are still referenced.
+    new_top = cl.compact_point();
+    preserved = preserved_marks.size();
+  }
+
+  {
+    GCTraceTime(Info, gc, phases) tm("Phase 3: Adjust pointers", NULL);
+    EpsilonAdjustPointersObjectClosure cl;
+    walk_bitmap(&cl);
+    EpsilonAdjustPointersOopClosure cli;
+    process_roots(&cli);
+    preserved_marks.adjust_during_full_gc();
+  }
+
+  {
+    GCTraceTime(Info, gc, phases) tm("Phase 4: Move objects", NULL);
+    EpsilonMoveObjectsObjectClosure cl;
+    walk_bitmap(&cl);
+    moved_objects = cl.moved();
+    _space->set_top(new_top);
+  }
+
+  preserved_marks.restore();
+#if COMPILER2_OR_JVMCI
+  DerivedPointerTable::update_pointers();
+#endif
+  BiasedLocking::restore_marks();
+
+  if (VerifyAfterGC) {
+    HandleMark hm;  // Discard invalid handles created during verification
+    Universe::verify("After GC");
+  }
+
+  if (!os::uncommit_memory((char*) _bitmap_region.start(), _bitmap_region.byte_size())) {
+    log_warning(gc)("Could not uncommit native memory for marking bitmap");
+    _bitmap.clear();
+  }
+
+  // Restart the occupancy steps from the compacted heap
+  _last_counter_update = used();
+  _last_heap_print = used();
+  _monitoring_support->update_counters();
+
+  log_info(gc)("Sliding GC: " SIZE_FORMAT "%s->" SIZE_FORMAT "%s, " SIZE_FORMAT " live objects, "
+               SIZE_FORMAT " moved, " SIZE_FORMAT " marks preserved",
+               byte_size_in_proper_unit(used_before), proper_unit_for_byte_size(used_before),
+               byte_size_in_proper_unit(used()),      proper_unit_for_byte_size(used()),
+               live_objects, moved_objects, preserved);
+  print_heap_info(used());
+  print_metaspace_info();
+}
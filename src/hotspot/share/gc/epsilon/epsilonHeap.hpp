@@ -25,6 +25,7 @@
 #define SHARE_GC_EPSILON_EPSILONHEAP_HPP
 
 #include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/markBitMap.hpp"
 #include "gc/shared/softRefPolicy.hpp"
 #include "gc/shared/space.hpp"
 #include "gc/epsilon/epsilonMonitoringSupport.hpp"
@@ -46,6 +47,8 @@ private:
   int64_t _decay_time_ns;
   volatile size_t _last_counter_update;
   volatile size_t _last_heap_print;
+  MarkBitMap _bitmap;
+  MemRegion _bitmap_region;
 
 public:
   static EpsilonHeap* heap();
@@ -87,6 +90,7 @@ public:
 
   // Allocation
   HeapWord* allocate_work(size_t size);
+  HeapWord* allocate_or_collect_work(size_t size);
   virtual HeapWord* mem_allocate(size_t size, bool* gc_overhead_limit_was_exceeded);
   virtual HeapWord* allocate_new_tlab(size_t min_size,
                                       size_t requested_size,
@@ -102,11 +106,16 @@ public:
   virtual void collect(GCCause::Cause cause);
   virtual void do_full_collection(bool clear_all_soft_refs);
 
+  // Sliding mark-compact, only used with EpsilonSlidingGC
+  void vmentry_collect(GCCause::Cause cause);
+  void entry_collect(GCCause::Cause cause);
+
   // Heap walking support
   virtual void object_iterate(ObjectClosure* cl);
 
-  // Object pinning support: every object is implicitly pinned
-  virtual bool supports_object_pinning() const           { return true; }
+  // Object pinning support: every object is implicitly pinned, unless
+  // the sliding GC can move it, in which case GCLocker is used instead
+  virtual bool supports_object_pinning() const           { return !EpsilonSlidingGC; }
   virtual oop pin_object(JavaThread* thread, oop obj)    { return obj; }
   virtual void unpin_object(JavaThread* thread, oop obj) { }
 
@@ -124,9 +133,9 @@ public:
   virtual void flush_nmethod(nmethod* nm) {}
   virtual void verify_nmethod(nmethod* nm) {}
 
-  // No heap verification
-  virtual void prepare_for_verify() {}
-  virtual void verify(VerifyOption option) {}
+  // Heap verification, only done when the sliding GC can move objects
+  virtual void prepare_for_verify();
+  virtual void verify(VerifyOption option);
 
   virtual jlong millis_since_last_gc() {
     // Report time since the VM start
@@ -144,6 +153,9 @@ private:
   void print_heap_info(size_t used) const;
   void print_metaspace_info() const;
 
+  void process_roots(OopClosure* cl);
+  void walk_bitmap(ObjectClosure* cl);
+
 };
 
 #endif // SHARE_GC_EPSILON_EPSILONHEAP_HPP
@@ -92,6 +92,12 @@
   experimental(size_t, EpsilonMinHeapExpand, 128 * M,                       \
           "Min expansion step for heap. Larger value improves performance " \
           "at the potential expense of memory waste.")                      \
-          range(1, max_intx)
+          range(1, max_intx)                                                \
+                                                                            \
+  experimental(bool, EpsilonSlidingGC, false,                               \
+          "Run a single-threaded sliding mark-compact at a safepoint when " \
+          "the heap is exhausted, or on explicit GC requests, instead of "  \
+          "failing with OutOfMemoryError. All objects reachable from the "  \
+          "roots, including weakly reachable ones, are retained.")
 
 #endif // SHARE_GC_EPSILON_EPSILON_GLOBALS_HPP
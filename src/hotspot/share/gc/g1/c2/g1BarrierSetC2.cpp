@@ -298,36 +298,60 @@ void G1BarrierSetC2::pre_barrier(GraphKit* kit,
  *
  * In the case of slow allocation the allocation code must handle the barrier
  * as part of the allocation in the case the allocated object is not located
- * in the nursery; this would happen for humongous objects.
+ * in the nursery; this would happen for humongous objects. The runtime then
+ * defers a card mark covering the whole object until the next safepoint or
+ * slow path allocation, so any store to the object before either of those,
+ * at any offset, needs no barrier of its own.
+ *
+ * The control path from the store is walked back to the allocation through
+ * tests, diamonds, memory barriers and leaf calls, all of which can not
+ * safepoint. Anything else (a call, an allocation, a loop head) ends the
+ * search.
  *
  * Returns true if the post barrier can be removed
  */
 bool G1BarrierSetC2::g1_can_remove_post_barrier(GraphKit* kit,
                                                 PhaseTransform* phase, Node* store,
                                                 Node* adr) const {
-  intptr_t      offset = 0;
-  Node*         base   = AddPNode::Ideal_base_and_offset(adr, phase, offset);
+  Node*         base   = adr->is_AddP() ? adr->in(AddPNode::Base) : adr;
   AllocateNode* alloc  = AllocateNode::Ideal_allocation(base, phase);
 
-  if (offset == Type::OffsetBot) {
-    return false; // cannot unalias unless there are precise offsets
-  }
-
   if (alloc == NULL) {
      return false; // No allocation found
   }
 
   // Start search from Store node
-  Node* mem = store->in(MemNode::Control);
-  if (mem->is_Proj() && mem->in(0)->is_Initialize()) {
-
-    InitializeNode* st_init = mem->in(0)->as_Initialize();
-    AllocateNode*  st_alloc = st_init->allocation();
-
-    // Make sure we are looking at the same allocation
-    if (alloc == st_alloc) {
-      return true;
+  Node* ctrl = store->in(MemNode::Control);
+  for (int cnt = 0; cnt < 50 && ctrl != NULL; cnt++) {
+    if (ctrl->is_Proj() && ctrl->in(0)->is_Initialize()) {
+      InitializeNode* st_init = ctrl->in(0)->as_Initialize();
+      AllocateNode*  st_alloc = st_init->allocation();
+
+      // Make sure we are looking at the same allocation; any other
+      // allocation may have safepointed.
+      return alloc == st_alloc;
+    }
+    if (ctrl->is_Proj()) {
+      Node* n = ctrl->in(0);
+      if (n->is_If() || n->is_MemBar() || n->is_CallLeaf()) {
+        ctrl = n->in(0);
+        continue;
+      }
+    } else if (ctrl->is_Region()) {
+      Node* copy = ctrl->as_Region()->is_copy();
+      if (copy != NULL) {
+        ctrl = copy;
+        continue;
+      }
+      // A simple diamond: both paths start at the same test.
+      if (ctrl->req() == 3 && ctrl->in(1) != NULL && ctrl->in(2) != NULL &&
+          ctrl->in(1)->is_IfProj() && ctrl->in(2)->is_IfProj() &&
+          ctrl->in(1)->in(0) == ctrl->in(2)->in(0)) {
+        ctrl = ctrl->in(1)->in(0)->in(0);
+        continue;
+      }
     }
+    break;
   }
 
   return false;
@@ -33,6 +33,7 @@
 #include "gc/g1/heapRegion.inline.hpp"
 #include "gc/g1/heapRegionSet.inline.hpp"
 #include "gc/g1/heapRegionType.hpp"
+#include "logging/log.hpp"
 #include "utilities/align.hpp"
 
 G1Allocator::G1Allocator(G1CollectedHeap* heap) :
@@ -299,10 +300,14 @@ G1PLABAllocator::G1PLABAllocator(G1Allocator* allocator) :
   _survivor_alignment_bytes(calc_survivor_alignment_bytes()) {
   for (region_type_t state = 0; state < G1HeapRegionAttr::Num; state++) {
     _direct_allocated[state] = 0;
+    _num_plab_fills[state] = 0;
+    _num_direct_allocations[state] = 0;
+    _cur_desired_plab_size[state] = _g1h->desired_plab_sz(state);
+    _plab_fill_counter[state] = G1PLABRefillsBeforeResize;
     uint length = alloc_buffers_length(state);
     _alloc_buffers[state] = NEW_C_HEAP_ARRAY(PLAB*, length, mtGC);
     for (uint node_index = 0; node_index < length; node_index++) {
-      _alloc_buffers[state][node_index] = new PLAB(_g1h->desired_plab_sz(state));
+      _alloc_buffers[state][node_index] = new PLAB(_cur_desired_plab_size[state]);
     }
   }
 }
@@ -317,6 +322,18 @@ G1PLABAllocator::~G1PLABAllocator() {
   }
 }
 
+void G1PLABAllocator::notify_plab_refill(region_type_t dest) {
+  _num_plab_fills[dest]++;
+  if (_plab_fill_counter[dest] == 0) {
+    // Resizing during the pause is disabled.
+    return;
+  }
+  if (--_plab_fill_counter[dest] == 0) {
+    _cur_desired_plab_size[dest] = MIN2(_cur_desired_plab_size[dest] * 2, PLAB::max_size());
+    _plab_fill_counter[dest] = G1PLABRefillsBeforeResize;
+  }
+}
+
 bool G1PLABAllocator::may_throw_away_buffer(size_t const allocation_word_sz, size_t const buffer_size) const {
   return (allocation_word_sz * 100 < buffer_size * ParallelGCBufferWastePct);
 }
@@ -325,7 +342,7 @@ HeapWord* G1PLABAllocator::allocate_direct_or_new_plab(G1HeapRegionAttr dest,
                                                        size_t word_sz,
                                                        bool* plab_refill_failed,
                                                        uint node_index) {
-  size_t plab_word_size = _g1h->desired_plab_sz(dest);
+  size_t plab_word_size = plab_size(dest.type());
   size_t required_in_plab = PLAB::size_required_for_allocation(word_sz);
 
   // Only get a new PLAB if the allocation fits and it would not waste more than
@@ -349,6 +366,7 @@ HeapWord* G1PLABAllocator::allocate_direct_or_new_plab(G1HeapRegionAttr dest,
 
     if (buf != NULL) {
       alloc_buf->set_buf(buf, actual_plab_size);
+      notify_plab_refill(dest.type());
 
       HeapWord* const obj = alloc_buf->allocate(word_sz);
       assert(obj != NULL, "PLAB should have been big enough, tried to allocate "
@@ -363,6 +381,7 @@ HeapWord* G1PLABAllocator::allocate_direct_or_new_plab(G1HeapRegionAttr dest,
   HeapWord* result = _allocator->par_allocate_during_gc(dest, word_sz, node_index);
   if (result != NULL) {
     _direct_allocated[dest.type()] += word_sz;
+    _num_direct_allocations[dest.type()]++;
   }
   return result;
 }
@@ -381,7 +400,21 @@ void G1PLABAllocator::flush_and_retire_stats() {
       }
     }
     stats->add_direct_allocated(_direct_allocated[state]);
+    stats->add_num_plab_filled(_num_plab_fills[state]);
+    stats->add_num_direct_allocated(_num_direct_allocations[state]);
+    log_trace(gc, plab)("%s worker PLAB allocation: "
+                        "refills: " SIZE_FORMAT ", "
+                        "direct allocations: " SIZE_FORMAT " (" SIZE_FORMAT "B), "
+                        "PLAB size: " SIZE_FORMAT "B (desired " SIZE_FORMAT "B)",
+                        stats->description(),
+                        _num_plab_fills[state],
+                        _num_direct_allocations[state],
+                        _direct_allocated[state] * HeapWordSize,
+                        _cur_desired_plab_size[state] * HeapWordSize,
+                        _g1h->desired_plab_sz(state) * HeapWordSize);
     _direct_allocated[state] = 0;
+    _num_plab_fills[state] = 0;
+    _num_direct_allocations[state] = 0;
   }
 }
 
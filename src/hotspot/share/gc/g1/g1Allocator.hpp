@@ -159,6 +159,20 @@ private:
   // Number of words allocated directly (not counting PLAB allocation).
   size_t _direct_allocated[G1HeapRegionAttr::Num];
 
+  // Number of PLAB refills and of direct allocations so far.
+  size_t _num_plab_fills[G1HeapRegionAttr::Num];
+  size_t _num_direct_allocations[G1HeapRegionAttr::Num];
+
+  // The PLAB size of this worker. Starts with the desired PLAB size averaged
+  // over all workers, and is doubled every G1PLABRefillsBeforeResize refills
+  // so that workers copying many more objects than the average do not refill
+  // their PLABs too often.
+  size_t _cur_desired_plab_size[G1HeapRegionAttr::Num];
+  // Number of refills left until the next PLAB size increase.
+  size_t _plab_fill_counter[G1HeapRegionAttr::Num];
+
+  void notify_plab_refill(region_type_t dest);
+
   void flush_and_retire_stats();
   inline PLAB* alloc_buffer(G1HeapRegionAttr dest, uint node_index) const;
   inline PLAB* alloc_buffer(region_type_t dest, uint node_index) const;
@@ -180,6 +194,8 @@ public:
   size_t waste() const;
   size_t undo_waste() const;
 
+  size_t plab_size(region_type_t dest) const { return _cur_desired_plab_size[dest]; }
+
   // Allocate word_sz words in dest, either directly into the regions or by
   // allocating a new PLAB. Returns the address of the allocated memory, NULL if
   // not successful. Plab_refill_failed indicates whether an attempt to refill the
@@ -165,6 +165,17 @@ void G1Arguments::initialize() {
     FLAG_SET_ERGO(GCDrainStackTargetSize, MIN2(GCDrainStackTargetSize, (uintx)TASKQUEUE_SIZE / 4));
   }
 
+  // Committing memory while the service thread may uncommit other regions
+  // must not pretouch with the work gang, and the heterogeneous region
+  // manager selects the regions to uncommit by memory type.
+  if (G1UncommitConcurrently && (AlwaysPreTouch || is_heterogeneous_heap())) {
+    if (!FLAG_IS_DEFAULT(G1UncommitConcurrently)) {
+      log_warning(gc, ergo)("G1UncommitConcurrently is not supported with %s, disabling it",
+                            AlwaysPreTouch ? "AlwaysPreTouch" : "AllocateOldGenAt");
+    }
+    FLAG_SET_ERGO(G1UncommitConcurrently, false);
+  }
+
 #ifdef COMPILER2
   // Enable loop strip mining to offer better pause time guarantees
   if (FLAG_IS_DEFAULT(UseCountedLoopSafepoints)) {
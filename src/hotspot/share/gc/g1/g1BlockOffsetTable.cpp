@@ -411,6 +411,24 @@ HeapWord* G1BlockOffsetTablePart::initialize_threshold() {
   return _next_offset_threshold;
 }
 
+void G1BlockOffsetTablePart::update_for_block(HeapWord* blk_start, HeapWord* blk_end) {
+  size_t index = _bot->index_for(blk_start);
+  HeapWord* threshold = _bot->address_for_index(index);
+  if (threshold < blk_start) {
+    index++;
+    threshold += BOTConstants::N_words;
+  }
+  if (blk_end > threshold) {
+    alloc_block_work(&threshold, &index, blk_start, blk_end);
+  }
+}
+
+void G1BlockOffsetTablePart::set_threshold_after(HeapWord* addr) {
+  assert(addr > _hr->bottom(), "must cover a block");
+  _next_offset_index = _bot->index_for(addr - 1) + 1;
+  _next_offset_threshold = _bot->address_for_index(_next_offset_index);
+}
+
 void G1BlockOffsetTablePart::set_for_starts_humongous(HeapWord* obj_top, size_t fill_size) {
   // The first BOT entry should have offset 0.
   reset_bot();
@@ -223,6 +223,13 @@ public:
     alloc_block(blk, blk+size);
   }
 
+  // Update the entries covered by the given block, independently of the
+  // threshold. Concurrent updates for disjoint blocks are safe.
+  void update_for_block(HeapWord* blk_start, HeapWord* blk_end);
+  // Set the threshold to the first card boundary at or after addr, after
+  // the blocks below addr have been recorded with update_for_block().
+  void set_threshold_after(HeapWord* addr);
+
   void set_for_starts_humongous(HeapWord* obj_top, size_t fill_size);
   void set_object_can_span(bool can_span) NOT_DEBUG_RETURN;
 
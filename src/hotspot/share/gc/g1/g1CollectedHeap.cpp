@@ -382,6 +382,9 @@ HeapWord* G1CollectedHeap::humongous_obj_allocate(size_t word_size) {
       _hrm->allocate_free_regions_starting_at(first, obj_regions);
     } else {
       // Policy: Potentially trigger a defragmentation GC.
+      log_debug(gc, ergo, heap)("Humongous allocation request failed. Allocation request: " SIZE_FORMAT " regions, "
+                                "free regions: %u, longest contiguous free regions: %u",
+                                (size_t)obj_regions, num_free_regions(), _hrm->max_contiguous_empty_length());
     }
   }
 
@@ -2347,6 +2350,30 @@ void G1CollectedHeap::object_iterate(ObjectClosure* cl) {
   heap_region_iterate(&blk);
 }
 
+class G1ParallelObjectIterator : public ParallelObjectIterator {
+private:
+  G1CollectedHeap*  _heap;
+  HeapRegionClaimer _claimer;
+
+public:
+  G1ParallelObjectIterator(uint thread_num) :
+      _heap(G1CollectedHeap::heap()),
+      _claimer(thread_num) {}
+
+  virtual void object_iterate(ObjectClosure* cl, uint worker_id) {
+    _heap->object_iterate_parallel(cl, worker_id, &_claimer);
+  }
+};
+
+ParallelObjectIterator* G1CollectedHeap::parallel_object_iterator(uint thread_num) {
+  return new G1ParallelObjectIterator(thread_num);
+}
+
+void G1CollectedHeap::object_iterate_parallel(ObjectClosure* cl, uint worker_id, HeapRegionClaimer* claimer) {
+  IterateObjectClosureRegionClosure blk(cl);
+  heap_region_par_iterate_from_worker_offset(&blk, claimer, worker_id);
+}
+
 void G1CollectedHeap::heap_region_iterate(HeapRegionClosure* cl) const {
   _hrm->iterate(cl);
 }
@@ -2439,6 +2466,21 @@ void G1CollectedHeap::verify(VerifyOption vo) {
   _verifier->verify(vo);
 }
 
+bool G1CollectedHeap::can_pin_object(oop obj) const {
+  return G1PinHumongousObjects && heap_region_containing(obj)->is_humongous();
+}
+
+oop G1CollectedHeap::pin_object(JavaThread* thread, oop obj) {
+  assert(can_pin_object(obj), "only humongous objects can be pinned");
+  // Humongous objects stay in place; the JNI handle of the critical region
+  // keeps this one alive, also for eager reclaim.
+  return obj;
+}
+
+void G1CollectedHeap::unpin_object(JavaThread* thread, oop obj) {
+  assert(can_pin_object(obj), "only humongous objects can be pinned");
+}
+
 bool G1CollectedHeap::supports_concurrent_phase_control() const {
   return true;
 }
@@ -2645,6 +2687,7 @@ G1EvacSummary G1CollectedHeap::create_g1_evac_summary(G1EvacStats* stats) {
   return G1EvacSummary(stats->allocated(), stats->wasted(), stats->undo_wasted(),
                        stats->unused(), stats->used(), stats->region_end_waste(),
                        stats->regions_filled(), stats->direct_allocated(),
+                       stats->num_plab_filled(), stats->num_direct_allocated(),
                        stats->failure_used(), stats->failure_waste());
 }
 
@@ -2837,6 +2880,15 @@ void G1CollectedHeap::print_taskqueue_stats() const {
   DEBUG_ONLY(totals.verify());
 }
 
+void G1CollectedHeap::trace_taskqueue_stats() const {
+  TaskQueueStats totals;
+  const uint n = num_task_queues();
+  for (uint i = 0; i < n; ++i) {
+    totals += task_queue(i)->stats;
+  }
+  _gc_tracer_stw->report_task_queue_stats("Evacuation", n, totals);
+}
+
 void G1CollectedHeap::reset_taskqueue_stats() {
   const uint n = num_task_queues();
   for (uint i = 0; i < n; ++i) {
@@ -2892,6 +2944,7 @@ void G1CollectedHeap::start_new_collection_set() {
 void G1CollectedHeap::calculate_collection_set(G1EvacuationInfo& evacuation_info, double target_pause_time_ms) {
 
   _collection_set.finalize_initial_collection_set(target_pause_time_ms, &_survivor);
+  policy()->record_collection_set_finalized();
   evacuation_info.set_collectionset_regions(collection_set()->region_length() +
                                             collection_set()->optional_region_length());
 
@@ -3129,6 +3182,7 @@ bool G1CollectedHeap::do_collection_pause_at_safepoint(double target_pause_time_
     _verifier->verify_region_sets_optional();
 
     TASKQUEUE_STATS_ONLY(print_taskqueue_stats());
+    TASKQUEUE_STATS_ONLY(trace_taskqueue_stats());
     TASKQUEUE_STATS_ONLY(reset_taskqueue_stats());
 
     print_heap_after_gc();
@@ -3163,8 +3217,17 @@ bool G1CollectedHeap::do_collection_pause_at_safepoint(double target_pause_time_
 }
 
 void G1CollectedHeap::remove_self_forwarding_pointers(G1RedirtyCardsQueueSet* rdcqs) {
-  G1ParRemoveSelfForwardPtrsTask rsfp_task(rdcqs);
-  workers()->run_task(&rsfp_task);
+  G1EvacFailedRegions failed_regions;
+
+  // Usually only a few regions fail evacuation, size the phases by their chunks.
+  uint const num_workers = WorkerPolicy::calc_workers_for_work(workers()->active_workers(),
+                                                               failed_regions.num_chunks(), 1);
+
+  G1ParClearEvacuatedMarksTask clear_task(&failed_regions);
+  workers()->run_task(&clear_task, num_workers);
+
+  G1ParRemoveSelfForwardPtrsTask rsfp_task(rdcqs, &failed_regions);
+  workers()->run_task(&rsfp_task, num_workers);
 }
 
 void G1CollectedHeap::restore_after_evac_failure(G1RedirtyCardsQueueSet* rdcqs) {
@@ -3184,6 +3247,10 @@ void G1CollectedHeap::preserve_mark_during_evac_failure(uint worker_id, oop obj,
 
   _evacuation_failed_info_array[worker_id].register_copy_failure(obj->size());
   _preserved_marks_set.get(worker_id)->push_if_necessary(obj, m);
+  // Record the object for the removal of the self-forwarding pointers. The
+  // object may already be marked from the last marking if it is in an old
+  // region.
+  _cm->par_mark_in_prev_bitmap(obj);
 }
 
 bool G1ParEvacuateFollowersClosure::offer_termination() {
@@ -3298,8 +3365,15 @@ class G1RedirtyLoggedCardsTask : public AbstractGangTask {
 void G1CollectedHeap::redirty_logged_cards(G1RedirtyCardsQueueSet* rdcqs) {
   double redirty_logged_cards_start = os::elapsedTime();
 
+  // Redirtying a card is cheap, give every worker a good number of them.
+  const size_t cards_per_worker = 16 * K;
+  uint const num_workers = WorkerPolicy::calc_workers_for_work(workers()->active_workers(),
+                                                               rdcqs->entry_count(), cards_per_worker);
+
   G1RedirtyLoggedCardsTask redirty_task(rdcqs, this);
-  workers()->run_task(&redirty_task);
+  log_debug(gc, ergo)("Running %s using %u workers for " SIZE_FORMAT " cards",
+                      redirty_task.name(), num_workers, rdcqs->entry_count());
+  workers()->run_task(&redirty_task, num_workers);
 
   G1DirtyCardQueueSet& dcq = G1BarrierSet::dirty_card_queue_set();
   dcq.merge_bufferlists(rdcqs);
@@ -3637,12 +3711,7 @@ class G1PrepareEvacuationTask : public AbstractGangTask {
       // structures don't support efficiently performing the needed
       // additional tests or scrubbing of the mark stack.
       //
-      // However, we presently only nominate is_typeArray() objects.
-      // A humongous object containing references induces remembered
-      // set entries on other regions.  In order to reclaim such an
-      // object, those remembered sets would need to be cleaned up.
-      //
-      // We also treat is_typeArray() objects specially, allowing them
+      // We treat is_typeArray() objects specially, allowing them
       // to be reclaimed even if allocated before the start of
       // concurrent mark.  For this we rely on mark stack insertion to
       // exclude is_typeArray() objects, preventing reclaiming an object
@@ -3651,9 +3720,30 @@ class G1PrepareEvacuationTask : public AbstractGangTask {
       // Frequent allocation and drop of large binary blobs is an
       // important use case for eager reclaim, and this special handling
       // may reduce needed headroom.
+      //
+      // Object arrays are nominated outside of concurrent marking, or
+      // if allocated after its start.  A humongous object containing
+      // references induces remembered set entries on other regions,
+      // which become stale when the object is reclaimed.  They need
+      // not be cleaned up: remembered set scanning is limited to the
+      // scan top of regions that are old or humongous at the start of
+      // a pause, and scanning a card of such a region that has been
+      // reused is just unnecessary work.  The object array klass is
+      // kept alive by its element klass, so unloading is not an issue
+      // either.
+
+      if (!_g1h->is_potential_eager_reclaim_candidate(region)) {
+        return false;
+      }
+
+      if (obj->is_typeArray()) {
+        return true;
+      }
 
-      return obj->is_typeArray() &&
-             _g1h->is_potential_eager_reclaim_candidate(region);
+      return G1EagerReclaimHumongousObjArrays &&
+             obj->is_objArray() &&
+             (!_g1h->collector_state()->mark_or_rebuild_in_progress() ||
+              region->next_top_at_mark_start() == region->bottom());
     }
 
   public:
@@ -4454,10 +4544,9 @@ class G1FreeHumongousRegionClosure : public HeapRegionClosure {
     // are completely up-to-date wrt to references to the humongous object.
     //
     // Other implementation considerations:
-    // - never consider object arrays at this time because they would pose
-    // considerable effort for cleaning up the the remembered sets. This is
-    // required because stale remembered sets might reference locations that
-    // are currently allocated into.
+    // - object arrays are only candidates if they have not been allocated
+    // before the start of a concurrent mark that is still in progress, see
+    // G1PrepareRegionsClosure::humongous_region_is_candidate().
     uint region_idx = r->hrm_index();
     if (!g1h->is_humongous_reclaim_candidate(region_idx) ||
         !r->rem_set()->is_empty()) {
@@ -4474,8 +4563,8 @@ class G1FreeHumongousRegionClosure : public HeapRegionClosure {
       return false;
     }
 
-    guarantee(obj->is_typeArray(),
-              "Only eagerly reclaiming type arrays is supported, but the object "
+    guarantee(obj->is_typeArray() || obj->is_objArray(),
+              "Only eagerly reclaiming arrays is supported, but the object "
               PTR_FORMAT " is not.", p2i(r->bottom()));
 
     log_debug(gc, humongous)("Dead humongous region %u object size " SIZE_FORMAT " start " PTR_FORMAT " with remset " SIZE_FORMAT " code roots " SIZE_FORMAT " is marked %d reclaim candidate %d type array %d",
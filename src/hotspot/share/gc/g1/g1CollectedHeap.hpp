@@ -744,6 +744,7 @@ private:
   #if TASKQUEUE_STATS
   static void print_taskqueue_stats_hdr(outputStream* const st);
   void print_taskqueue_stats() const;
+  void trace_taskqueue_stats() const;
   void reset_taskqueue_stats();
   #endif // TASKQUEUE_STATS
 
@@ -1170,6 +1171,11 @@ public:
   // Iterate over all objects, calling "cl.do_object" on each.
   virtual void object_iterate(ObjectClosure* cl);
 
+  virtual ParallelObjectIterator* parallel_object_iterator(uint thread_num);
+
+  // Iterate over all objects in the regions claimed by this worker.
+  void object_iterate_parallel(ObjectClosure* cl, uint worker_id, HeapRegionClaimer* claimer);
+
   // Iterate over heap regions, in address order, terminating the
   // iteration early if the "do_heap_region" method returns "true".
   void heap_region_iterate(HeapRegionClosure* blk) const;
@@ -1421,6 +1427,12 @@ public:
 
   virtual WorkGang* get_safepoint_workers() { return _workers; }
 
+  // G1 never moves humongous objects, so JNI critical regions on them
+  // need not hold off collections.
+  virtual bool can_pin_object(oop obj) const;
+  virtual oop pin_object(JavaThread* thread, oop obj);
+  virtual void unpin_object(JavaThread* thread, oop obj);
+
   // The methods below are here for convenience and dispatch the
   // appropriate method depending on value of the given VerifyOption
   // parameter. The values for that parameter, and their meanings,
@@ -1202,12 +1202,6 @@ void G1ConcurrentMark::remark() {
       reclaim_empty_regions();
     }
 
-    // Clean out dead classes
-    if (ClassUnloadingWithConcurrentMark) {
-      GCTraceTime(Debug, gc, phases) debug("Purge Metaspace", _gc_timer_cm);
-      ClassLoaderDataGraph::purge();
-    }
-
     _g1h->resize_heap_if_necessary();
 
     compute_new_sizes();
@@ -1337,6 +1331,15 @@ void G1ConcurrentMark::reclaim_empty_regions() {
   }
 }
 
+void G1ConcurrentMark::purge_class_loader_data() {
+  // Unloaded class loader data is no longer reachable after Remark, so
+  // deleting it does not need to be done in a pause. Joining the STS
+  // keeps a Full GC, which does its own unloading and purging, from
+  // running at the same time.
+  SuspendibleThreadSetJoiner sts_join;
+  ClassLoaderDataGraph::purge();
+}
+
 void G1ConcurrentMark::compute_new_sizes() {
   MetaspaceGC::compute_new_size();
 
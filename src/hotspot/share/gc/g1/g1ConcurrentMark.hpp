@@ -568,10 +568,17 @@ public:
 
   void remark();
 
+  // Delete the class loader data and metaspace of the classes unloaded
+  // during Remark, concurrently to the application.
+  void purge_class_loader_data();
+
   void cleanup();
   // Mark in the previous bitmap. Caution: the prev bitmap is usually read-only, so use
   // this carefully.
   inline void mark_in_prev_bitmap(oop p);
+  // Same as above, but may be called concurrently by multiple threads.
+  inline void par_mark_in_prev_bitmap(oop p);
+  inline void clear_in_prev_bitmap(HeapWord* addr);
 
   // Clears marks for all objects in the given range, for the prev or
   // next bitmaps.  Caution: the previous bitmap is usually
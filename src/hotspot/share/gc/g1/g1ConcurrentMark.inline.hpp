@@ -274,6 +274,14 @@ inline void G1ConcurrentMark::mark_in_prev_bitmap(oop p) {
  _prev_mark_bitmap->mark((HeapWord*) p);
 }
 
+inline void G1ConcurrentMark::par_mark_in_prev_bitmap(oop p) {
+  _prev_mark_bitmap->par_mark(p);
+}
+
+inline void G1ConcurrentMark::clear_in_prev_bitmap(HeapWord* addr) {
+  _prev_mark_bitmap->clear(addr);
+}
+
 bool G1ConcurrentMark::is_marked_in_prev_bitmap(oop p) const {
   assert(p != NULL && oopDesc::is_oop(p), "expected an oop");
   return _prev_mark_bitmap->is_marked((HeapWord*)p);
@@ -60,6 +60,7 @@ STATIC_ASSERT(ConcurrentGCPhaseManager::UNCONSTRAINED_PHASE <
   expander(PRECLEAN,, "Concurrent Preclean")                               \
   expander(BEFORE_REMARK,, NULL)                                           \
   expander(REMARK,, NULL)                                                  \
+  expander(PURGE_CLASS_LOADER_DATA,, "Concurrent Purge Class Loader Data") \
   expander(REBUILD_REMEMBERED_SETS,, "Concurrent Rebuild Remembered Sets") \
   expander(CLEANUP_FOR_NEXT_MARK,, "Concurrent Cleanup for Next Mark")     \
   /* */
@@ -362,6 +363,11 @@ void G1ConcurrentMarkThread::run_service() {
         }
       }
 
+      if (!_cm->has_aborted() && ClassUnloadingWithConcurrentMark) {
+        G1ConcPhase p(G1ConcurrentPhase::PURGE_CLASS_LOADER_DATA, this);
+        _cm->purge_class_loader_data();
+      }
+
       if (!_cm->has_aborted()) {
         G1ConcPhase p(G1ConcurrentPhase::REBUILD_REMEMBERED_SETS, this);
         _cm->rebuild_rem_set_concurrently();
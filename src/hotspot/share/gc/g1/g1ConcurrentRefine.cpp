@@ -223,7 +223,8 @@ G1ConcurrentRefine::G1ConcurrentRefine(size_t green_zone,
   _green_zone(green_zone),
   _yellow_zone(yellow_zone),
   _red_zone(red_zone),
-  _min_yellow_zone_size(min_yellow_zone_size)
+  _min_yellow_zone_size(min_yellow_zone_size),
+  _num_threads_wanted(max_num_threads())
 {
   assert_zone_constraints_gyr(green_zone, yellow_zone, red_zone);
 }
@@ -345,6 +346,14 @@ static size_t calc_new_green_zone(size_t green,
   return green;
 }
 
+static size_t calc_predicted_green_zone(double goal_ms,
+                                        double predicted_card_time_ms) {
+  // Leave as many cards to the pause as are predicted to be scanned
+  // within the goal time. Limit to max_green_zone.
+  double green = goal_ms / predicted_card_time_ms;
+  return static_cast<size_t>(MIN2(green, static_cast<double>(max_green_zone)));
+}
+
 static size_t calc_new_yellow_zone(size_t green, size_t min_yellow_size) {
   size_t size = green * 2;
   size = MAX2(size, min_yellow_size);
@@ -357,19 +366,26 @@ static size_t calc_new_red_zone(size_t green, size_t yellow) {
 
 void G1ConcurrentRefine::update_zones(double logged_cards_scan_time,
                                       size_t processed_logged_cards,
-                                      double goal_ms) {
+                                      double goal_ms,
+                                      double predicted_card_time_ms) {
   log_trace( CTRL_TAGS )("Updating Refinement Zones: "
                          "logged cards scan time: %.3fms, "
                          "processed cards: " SIZE_FORMAT ", "
-                         "goal time: %.3fms",
+                         "goal time: %.3fms, "
+                         "predicted card time: %.6fms",
                          logged_cards_scan_time,
                          processed_logged_cards,
-                         goal_ms);
+                         goal_ms,
+                         predicted_card_time_ms);
 
-  _green_zone = calc_new_green_zone(_green_zone,
-                                    logged_cards_scan_time,
-                                    processed_logged_cards,
-                                    goal_ms);
+  if (predicted_card_time_ms > 0.0) {
+    _green_zone = calc_predicted_green_zone(goal_ms, predicted_card_time_ms);
+  } else {
+    _green_zone = calc_new_green_zone(_green_zone,
+                                      logged_cards_scan_time,
+                                      processed_logged_cards,
+                                      goal_ms);
+  }
   _yellow_zone = calc_new_yellow_zone(_green_zone, _min_yellow_zone_size);
   _red_zone = calc_new_red_zone(_green_zone, _yellow_zone);
 
@@ -383,11 +399,16 @@ void G1ConcurrentRefine::update_zones(double logged_cards_scan_time,
 
 void G1ConcurrentRefine::adjust(double logged_cards_scan_time,
                                 size_t processed_logged_cards,
-                                double goal_ms) {
+                                double goal_ms,
+                                double predicted_card_time_ms,
+                                uint num_threads_wanted) {
   G1DirtyCardQueueSet& dcqs = G1BarrierSet::dirty_card_queue_set();
 
   if (G1UseAdaptiveConcRefinement) {
-    update_zones(logged_cards_scan_time, processed_logged_cards, goal_ms);
+    update_zones(logged_cards_scan_time, processed_logged_cards, goal_ms, predicted_card_time_ms);
+
+    _num_threads_wanted = clamp(num_threads_wanted, 1u, MAX2(max_num_threads(), 1u));
+    LOG_ZONES("Refinement threads wanted: %u", _num_threads_wanted);
 
     // Change the barrier params
     if (max_num_threads() == 0) {
@@ -443,6 +464,13 @@ uint G1ConcurrentRefine::worker_id_offset() {
 }
 
 void G1ConcurrentRefine::maybe_activate_more_threads(uint worker_id, size_t num_cur_buffers) {
+  // Threads beyond the wanted number would mostly take CPU time away from
+  // the mutators, so they are only activated when the mutators are about
+  // to start refining cards themselves.
+  if ((worker_id + 1) >= _num_threads_wanted && num_cur_buffers < red_zone()) {
+    return;
+  }
+
   if (num_cur_buffers > activation_threshold(worker_id + 1)) {
     _thread_control.maybe_activate_next(worker_id);
   }
@@ -93,6 +93,10 @@ class G1ConcurrentRefine : public CHeapObj<mtGC> {
   size_t _red_zone;
   size_t _min_yellow_zone_size;
 
+  // The number of refinement threads expected to keep up with the
+  // mutators. More threads are only activated in the red zone.
+  uint _num_threads_wanted;
+
   G1ConcurrentRefine(size_t green_zone,
                      size_t yellow_zone,
                      size_t red_zone,
@@ -101,7 +105,8 @@ class G1ConcurrentRefine : public CHeapObj<mtGC> {
   // Update green/yellow/red zone values based on how well goals are being met.
   void update_zones(double logged_cards_scan_time,
                     size_t processed_logged_cards,
-                    double goal_ms);
+                    double goal_ms,
+                    double predicted_card_time_ms);
 
   static uint worker_id_offset();
   void maybe_activate_more_threads(uint worker_id, size_t num_cur_cards);
@@ -117,7 +122,15 @@ public:
   void stop();
 
   // Adjust refinement thresholds based on work done during the pause and the goal time.
-  void adjust(double logged_cards_scan_time, size_t processed_logged_cards, double goal_ms);
+  // If predicted_card_time_ms is non-zero, the green zone is set to the number of
+  // logged cards predicted to be scanned within the goal time. Otherwise it is
+  // moved towards meeting the goal by a fixed factor. At most num_threads_wanted
+  // threads are activated as long as the number of cards is below the red zone.
+  void adjust(double logged_cards_scan_time,
+              size_t processed_logged_cards,
+              double goal_ms,
+              double predicted_card_time_ms,
+              uint num_threads_wanted);
 
   struct RefinementStats {
     Tickspan _time;
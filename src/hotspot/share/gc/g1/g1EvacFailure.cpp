@@ -26,6 +26,7 @@
 #include "gc/g1/g1CollectedHeap.inline.hpp"
 #include "gc/g1/g1CollectorState.hpp"
 #include "gc/g1/g1ConcurrentMark.inline.hpp"
+#include "gc/g1/g1ConcurrentMarkBitMap.inline.hpp"
 #include "gc/g1/g1EvacFailure.hpp"
 #include "gc/g1/g1HeapVerifier.hpp"
 #include "gc/g1/g1OopClosures.inline.hpp"
@@ -36,6 +37,7 @@
 #include "oops/access.inline.hpp"
 #include "oops/compressedOops.inline.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/atomic.hpp"
 
 class UpdateLogBuffersDeferred : public BasicOopIterateClosure {
 private:
@@ -73,110 +75,40 @@ public:
   }
 };
 
-class RemoveSelfForwardPtrObjClosure: public ObjectClosure {
+// Removes the self-forwarding pointers of the objects of a chunk of a region
+// that failed evacuation. Only the self-forwarded objects are kept marked in
+// the prev bitmap, so the chunk can be processed by walking the bitmap
+// without looking at the dead or evacuated objects.
+// The BOT is updated per block, independently of the other chunks. Each chunk
+// processes the objects starting in it, and fills the gap following each of
+// them with dead objects, up to the next self-forwarded object. The gap at
+// the bottom of the region is filled by the first chunk.
+class RemoveSelfForwardPtrsInChunkClosure : public StackObj {
   G1CollectedHeap* _g1h;
   G1ConcurrentMark* _cm;
-  HeapRegion* _hr;
-  size_t _marked_bytes;
   UpdateLogBuffersDeferred* _log_buffer_cl;
   bool _during_initial_mark;
   uint _worker_id;
-  HeapWord* _last_forwarded_object_end;
 
-public:
-  RemoveSelfForwardPtrObjClosure(HeapRegion* hr,
-                                 UpdateLogBuffersDeferred* log_buffer_cl,
-                                 bool during_initial_mark,
-                                 uint worker_id) :
-    _g1h(G1CollectedHeap::heap()),
-    _cm(_g1h->concurrent_mark()),
-    _hr(hr),
-    _marked_bytes(0),
-    _log_buffer_cl(log_buffer_cl),
-    _during_initial_mark(during_initial_mark),
-    _worker_id(worker_id),
-    _last_forwarded_object_end(hr->bottom()) { }
-
-  size_t marked_bytes() { return _marked_bytes; }
-
-  // Iterate over the live objects in the region to find self-forwarded objects
-  // that need to be kept live. We need to update the remembered sets of these
-  // objects. Further update the BOT and marks.
-  // We can coalesce and overwrite the remaining heap contents with dummy objects
-  // as they have either been dead or evacuated (which are unreferenced now, i.e.
-  // dead too) already.
-  void do_object(oop obj) {
-    HeapWord* obj_addr = (HeapWord*) obj;
-    assert(_hr->is_in(obj_addr), "sanity");
-
-    if (obj->is_forwarded() && obj->forwardee() == obj) {
-      // The object failed to move.
-
-      zap_dead_objects(_last_forwarded_object_end, obj_addr);
-      // We consider all objects that we find self-forwarded to be
-      // live. What we'll do is that we'll update the prev marking
-      // info so that they are all under PTAMS and explicitly marked.
-      if (!_cm->is_marked_in_prev_bitmap(obj)) {
-        _cm->mark_in_prev_bitmap(obj);
-      }
-      if (_during_initial_mark) {
-        // For the next marking info we'll only mark the
-        // self-forwarded objects explicitly if we are during
-        // initial-mark (since, normally, we only mark objects pointed
-        // to by roots if we succeed in copying them). By marking all
-        // self-forwarded objects we ensure that we mark any that are
-        // still pointed to be roots. During concurrent marking, and
-        // after initial-mark, we don't need to mark any objects
-        // explicitly and all objects in the CSet are considered
-        // (implicitly) live. So, we won't mark them explicitly and
-        // we'll leave them over NTAMS.
-        _cm->mark_in_next_bitmap(_worker_id, _hr, obj);
-      }
-      size_t obj_size = obj->size();
-
-      _marked_bytes += (obj_size * HeapWordSize);
-      PreservedMarks::init_forwarded_mark(obj);
-
-      // While we were processing RSet buffers during the collection,
-      // we actually didn't scan any cards on the collection set,
-      // since we didn't want to update remembered sets with entries
-      // that point into the collection set, given that live objects
-      // from the collection set are about to move and such entries
-      // will be stale very soon.
-      // This change also dealt with a reliability issue which
-      // involved scanning a card in the collection set and coming
-      // across an array that was being chunked and looking malformed.
-      // The problem is that, if evacuation fails, we might have
-      // remembered set entries missing given that we skipped cards on
-      // the collection set. So, we'll recreate such entries now.
-      obj->oop_iterate(_log_buffer_cl);
-
-      HeapWord* obj_end = obj_addr + obj_size;
-      _last_forwarded_object_end = obj_end;
-      _hr->cross_threshold(obj_addr, obj_end);
-    }
-  }
-
-  // Fill the memory area from start to end with filler objects, and update the BOT
-  // and the mark bitmap accordingly.
-  void zap_dead_objects(HeapWord* start, HeapWord* end) {
+  // Fill the memory area from start to end with filler objects, and update
+  // the BOT accordingly.
+  void zap_dead_objects(HeapRegion* hr, HeapWord* start, HeapWord* end) {
     if (start == end) {
       return;
     }
 
     size_t gap_size = pointer_delta(end, start);
-    MemRegion mr(start, gap_size);
     if (gap_size >= CollectedHeap::min_fill_size()) {
       CollectedHeap::fill_with_objects(start, gap_size);
 
       HeapWord* end_first_obj = start + ((oop)start)->size();
-      _hr->cross_threshold(start, end_first_obj);
+      hr->update_bot_for_block(start, end_first_obj);
       // Fill_with_objects() may have created multiple (i.e. two)
       // objects, as the max_fill_size() is half a region.
       // After updating the BOT for the first object, also update the
       // BOT for the second object to make the BOT complete.
       if (end_first_obj != end) {
-        _hr->cross_threshold(end_first_obj, end);
+        hr->update_bot_for_block(end_first_obj, end);
 #ifdef ASSERT
         size_t size_second_obj = ((oop)end_first_obj)->size();
         HeapWord* end_of_second_obj = end_first_obj + size_second_obj;
@@ -187,77 +119,216 @@ public:
 #endif
       }
     }
-    _cm->clear_range_in_prev_bitmap(mr);
   }
 
-  void zap_remainder() {
-    zap_dead_objects(_last_forwarded_object_end, _hr->top());
+  // Handle an object that failed to move and return its size. We update
+  // the remembered sets of these objects, the BOT and the next marks.
+  size_t handle_self_forwarded(HeapRegion* hr, oop obj) {
+    assert(obj->is_forwarded() && obj->forwardee() == obj, "Object " PTR_FORMAT " must be self-forwarded", p2i(obj));
+
+    if (_during_initial_mark) {
+      // For the next marking info we'll only mark the
+      // self-forwarded objects explicitly if we are during
+      // initial-mark (since, normally, we only mark objects pointed
+      // to by roots if we succeed in copying them). By marking all
+      // self-forwarded objects we ensure that we mark any that are
+      // still pointed to be roots. During concurrent marking, and
+      // after initial-mark, we don't need to mark any objects
+      // explicitly and all objects in the CSet are considered
+      // (implicitly) live. So, we won't mark them explicitly and
+      // we'll leave them over NTAMS.
+      _cm->mark_in_next_bitmap(_worker_id, hr, obj);
+    }
+    size_t obj_size = obj->size();
+
+    PreservedMarks::init_forwarded_mark(obj);
+
+    // While we were processing RSet buffers during the collection,
+    // we actually didn't scan any cards on the collection set,
+    // since we didn't want to update remembered sets with entries
+    // that point into the collection set, given that live objects
+    // from the collection set are about to move and such entries
+    // will be stale very soon.
+    // This change also dealt with a reliability issue which
+    // involved scanning a card in the collection set and coming
+    // across an array that was being chunked and looking malformed.
+    // The problem is that, if evacuation fails, we might have
+    // remembered set entries missing given that we skipped cards on
+    // the collection set. So, we'll recreate such entries now.
+    obj->oop_iterate(_log_buffer_cl);
+
+    HeapWord* obj_addr = (HeapWord*)obj;
+    hr->update_bot_for_block(obj_addr, obj_addr + obj_size);
+    return obj_size;
   }
-};
-
-class RemoveSelfForwardPtrHRClosure: public HeapRegionClosure {
-  G1CollectedHeap* _g1h;
-  uint _worker_id;
-
-  G1RedirtyCardsQueue _rdcq;
-  UpdateLogBuffersDeferred _log_buffer_cl;
 
 public:
-  RemoveSelfForwardPtrHRClosure(G1RedirtyCardsQueueSet* rdcqs, uint worker_id) :
+  RemoveSelfForwardPtrsInChunkClosure(UpdateLogBuffersDeferred* log_buffer_cl,
+                                      bool during_initial_mark,
+                                      uint worker_id) :
     _g1h(G1CollectedHeap::heap()),
-    _worker_id(worker_id),
-    _rdcq(rdcqs),
-    _log_buffer_cl(&_rdcq) {
-  }
+    _cm(_g1h->concurrent_mark()),
+    _log_buffer_cl(log_buffer_cl),
+    _during_initial_mark(during_initial_mark),
+    _worker_id(worker_id) { }
 
-  size_t remove_self_forward_ptr_by_walking_hr(HeapRegion* hr,
-                                               bool during_initial_mark) {
-    RemoveSelfForwardPtrObjClosure rspc(hr,
-                                        &_log_buffer_cl,
-                                        during_initial_mark,
-                                        _worker_id);
-    hr->object_iterate(&rspc);
-    // Need to zap the remainder area of the processed region.
-    rspc.zap_remainder();
-
-    return rspc.marked_bytes();
-  }
+  // Returns the number of live words in the chunk.
+  size_t process_chunk(HeapRegion* hr, MemRegion chunk) {
+    const G1CMBitMap* const bitmap = _cm->prev_mark_bitmap();
+    HeapWord* const top = hr->top();
+
+    HeapWord* cur = bitmap->get_next_marked_addr(chunk.start(), chunk.end());
+    if (chunk.start() == hr->bottom()) {
+      zap_dead_objects(hr, hr->bottom(), bitmap->get_next_marked_addr(hr->bottom(), top));
+    }
+
+    size_t live_words = 0;
+    while (cur < chunk.end()) {
+      size_t obj_size = handle_self_forwarded(hr, oop(cur));
+      live_words += obj_size;
 
-  bool do_heap_region(HeapRegion *hr) {
-    assert(!hr->is_pinned(), "Unexpected pinned region at index %u", hr->hrm_index());
-    assert(hr->in_collection_set(), "bad CS");
+      HeapWord* obj_end = cur + obj_size;
+      cur = bitmap->get_next_marked_addr(obj_end, top);
+      zap_dead_objects(hr, obj_end, cur);
+    }
+    return live_words;
+  }
+};
 
-    if (hr->evacuation_failed()) {
-      hr->clear_index_in_opt_cset();
+G1EvacFailedRegions::G1EvacFailedRegions() :
+  _regions(NULL),
+  _num_regions(0),
+  _chunks_per_region((uint)MAX2(HeapRegion::GrainWords / ChunkWords, (size_t)1)),
+  _live_words(NULL),
+  _pending_chunks(NULL) {
+
+  STATIC_ASSERT(ChunkWords % BitsPerWord == 0);
+
+  G1CollectedHeap* g1h = G1CollectedHeap::heap();
+  size_t max_regions = g1h->collection_set()->increment_length();
+  _regions = NEW_C_HEAP_ARRAY(HeapRegion*, max_regions, mtGC);
+  _live_words = NEW_C_HEAP_ARRAY(size_t, max_regions, mtGC);
+  _pending_chunks = NEW_C_HEAP_ARRAY(uint, max_regions, mtGC);
+
+  class CollectClosure : public HeapRegionClosure {
+    G1EvacFailedRegions* _failed;
+    bool _during_initial_mark;
+    bool _during_conc_mark;
+
+  public:
+    CollectClosure(G1EvacFailedRegions* failed) :
+      _failed(failed),
+      _during_initial_mark(G1CollectedHeap::heap()->collector_state()->in_initial_mark_gc()),
+      _during_conc_mark(G1CollectedHeap::heap()->collector_state()->mark_or_rebuild_in_progress()) { }
+
+    bool do_heap_region(HeapRegion* hr) {
+      assert(!hr->is_pinned(), "Unexpected pinned region at index %u", hr->hrm_index());
+      assert(hr->in_collection_set(), "bad CS");
+
+      if (hr->evacuation_failed()) {
+        hr->clear_index_in_opt_cset();
+        hr->note_self_forwarding_removal_start(_during_initial_mark,
+                                               _during_conc_mark);
+        hr->reset_bot();
+
+        uint i = _failed->_num_regions++;
+        _failed->_regions[i] = hr;
+        _failed->_live_words[i] = 0;
+        _failed->_pending_chunks[i] = _failed->_chunks_per_region;
+      }
+      return false;
+    }
+  } cl(this);
 
-      bool during_initial_mark = _g1h->collector_state()->in_initial_mark_gc();
-      bool during_conc_mark = _g1h->collector_state()->mark_or_rebuild_in_progress();
+  g1h->collection_set_iterate_increment_from(&cl, NULL, 0);
+}
 
-      hr->note_self_forwarding_removal_start(during_initial_mark,
-                                               during_conc_mark);
-      _g1h->verifier()->check_bitmaps("Self-Forwarding Ptr Removal", hr);
+G1EvacFailedRegions::~G1EvacFailedRegions() {
+  FREE_C_HEAP_ARRAY(HeapRegion*, _regions);
+  FREE_C_HEAP_ARRAY(size_t, _live_words);
+  FREE_C_HEAP_ARRAY(uint, _pending_chunks);
+}
 
-      hr->reset_bot();
+HeapRegion* G1EvacFailedRegions::region_for_chunk(uint chunk) const {
+  assert(chunk < num_chunks(), "Chunk %u out of bounds", chunk);
+  return _regions[chunk / _chunks_per_region];
+}
 
-      size_t live_bytes = remove_self_forward_ptr_by_walking_hr(hr, during_initial_mark);
+MemRegion G1EvacFailedRegions::chunk_range(uint chunk) const {
+  HeapRegion* hr = region_for_chunk(chunk);
+  HeapWord* start = hr->bottom() + (size_t)(chunk % _chunks_per_region) * ChunkWords;
+  HeapWord* end = MIN2(start + ChunkWords, hr->top());
+  return MemRegion(start, MAX2(start, end));
+}
 
-      hr->rem_set()->clean_strong_code_roots(hr);
-      hr->rem_set()->clear_locked(true);
+bool G1EvacFailedRegions::complete_chunk(uint chunk, size_t live_words, size_t* region_live_words) {
+  uint i = chunk / _chunks_per_region;
+  Atomic::add(&_live_words[i], live_words);
+  if (Atomic::sub(&_pending_chunks[i], 1u) > 0) {
+    return false;
+  }
+  // All other chunks of the region are complete, so this is the final value.
+  *region_live_words = Atomic::load(&_live_words[i]);
+  return true;
+}
 
-      hr->note_self_forwarding_removal_end(live_bytes);
+G1ParClearEvacuatedMarksTask::G1ParClearEvacuatedMarksTask(G1EvacFailedRegions* regions) :
+  AbstractGangTask("G1 Clear Evacuated Marks"),
+  _regions(regions),
+  _next_chunk(0) { }
+
+void G1ParClearEvacuatedMarksTask::work(uint worker_id) {
+  G1ConcurrentMark* cm = G1CollectedHeap::heap()->concurrent_mark();
+  const G1CMBitMap* const bitmap = cm->prev_mark_bitmap();
+
+  for (uint chunk = Atomic::add(&_next_chunk, 1u) - 1;
+       chunk < _regions->num_chunks();
+       chunk = Atomic::add(&_next_chunk, 1u) - 1) {
+    MemRegion mr = _regions->chunk_range(chunk);
+    HeapWord* cur = bitmap->get_next_marked_addr(mr.start(), mr.end());
+    while (cur < mr.end()) {
+      oop obj = oop(cur);
+      // Anything not self-forwarded has either been evacuated or is dead
+      // since the marking that set the mark.
+      if (!obj->is_forwarded() || obj->forwardee() != obj) {
+        cm->clear_in_prev_bitmap(cur);
+      }
+      cur = bitmap->get_next_marked_addr(cur + 1, mr.end());
     }
-    return false;
   }
-};
+}
 
-G1ParRemoveSelfForwardPtrsTask::G1ParRemoveSelfForwardPtrsTask(G1RedirtyCardsQueueSet* rdcqs) :
+G1ParRemoveSelfForwardPtrsTask::G1ParRemoveSelfForwardPtrsTask(G1RedirtyCardsQueueSet* rdcqs,
+                                                               G1EvacFailedRegions* regions) :
   AbstractGangTask("G1 Remove Self-forwarding Pointers"),
   _g1h(G1CollectedHeap::heap()),
   _rdcqs(rdcqs),
-  _hrclaimer(_g1h->workers()->active_workers()) { }
+  _regions(regions),
+  _next_chunk(0) { }
 
 void G1ParRemoveSelfForwardPtrsTask::work(uint worker_id) {
-  RemoveSelfForwardPtrHRClosure rsfp_cl(_rdcqs, worker_id);
+  G1RedirtyCardsQueue rdcq(_rdcqs);
+  UpdateLogBuffersDeferred log_buffer_cl(&rdcq);
+  RemoveSelfForwardPtrsInChunkClosure cl(&log_buffer_cl,
+                                         _g1h->collector_state()->in_initial_mark_gc(),
+                                         worker_id);
+
+  for (uint chunk = Atomic::add(&_next_chunk, 1u) - 1;
+       chunk < _regions->num_chunks();
+       chunk = Atomic::add(&_next_chunk, 1u) - 1) {
+    HeapRegion* hr = _regions->region_for_chunk(chunk);
+    MemRegion mr = _regions->chunk_range(chunk);
+
+    size_t live_words = mr.is_empty() ? 0 : cl.process_chunk(hr, mr);
+    size_t region_live_words;
+    if (_regions->complete_chunk(chunk, live_words, &region_live_words)) {
+      // Last chunk of the region, finish the region.
+      hr->rem_set()->clean_strong_code_roots(hr);
+      hr->rem_set()->clear_locked(true);
 
-  _g1h->collection_set_iterate_increment_from(&rsfp_cl, &_hrclaimer, worker_id);
+      hr->complete_bot_update();
+      hr->note_self_forwarding_removal_end(region_live_words * HeapWordSize);
+      _g1h->verifier()->check_bitmaps("Self-Forwarding Ptr Removal", hr);
+    }
+  }
 }
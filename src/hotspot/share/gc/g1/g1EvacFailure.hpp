@@ -28,21 +28,79 @@
 #include "gc/g1/g1OopClosures.hpp"
 #include "gc/g1/heapRegionManager.hpp"
 #include "gc/shared/workgroup.hpp"
+#include "memory/allocation.hpp"
+#include "memory/memRegion.hpp"
 #include "utilities/globalDefinitions.hpp"
 
 class G1CollectedHeap;
 class G1RedirtyCardsQueueSet;
+class HeapRegion;
+
+// The regions of the current collection set increment that failed
+// evacuation, split into chunks of ChunkWords words so that the work of
+// removing self-forwarding pointers from a few large regions can be shared
+// by all workers.
+//
+// The objects that failed to move have been marked in the prev bitmap when
+// they were self-forwarded.
+class G1EvacFailedRegions : public StackObj {
+  HeapRegion** _regions;
+  uint         _num_regions;
+  uint         _chunks_per_region;
+
+  // Per region: the live words found so far, and the number of chunks not
+  // completely processed yet.
+  volatile size_t* _live_words;
+  volatile uint*   _pending_chunks;
+
+public:
+  // Chunks cover a multiple of the words covered by a bitmap word, so that
+  // workers never write to the same bitmap word.
+  static const size_t ChunkWords = 32 * K;
+
+  // Collects the regions that failed evacuation and prepares them for
+  // the removal of the self-forwarding pointers.
+  G1EvacFailedRegions();
+  ~G1EvacFailedRegions();
+
+  uint num_chunks() const { return _num_regions * _chunks_per_region; }
+
+  HeapRegion* region_for_chunk(uint chunk) const;
+  // The part of the used area of the region covered by the chunk; the
+  // returned region is empty if the chunk is above top.
+  MemRegion chunk_range(uint chunk) const;
+
+  // Records the live words found in the chunk. Returns true and the total
+  // number of live words of its region if this was the last chunk of the
+  // region to complete.
+  bool complete_chunk(uint chunk, size_t live_words, size_t* region_live_words);
+};
+
+// Task to clear the marks of all objects that did not fail evacuation from
+// the prev bitmap of the failed regions, leaving only the self-forwarded
+// objects marked.
+class G1ParClearEvacuatedMarksTask: public AbstractGangTask {
+  G1EvacFailedRegions* _regions;
+  volatile uint _next_chunk;
+
+public:
+  G1ParClearEvacuatedMarksTask(G1EvacFailedRegions* regions);
+
+  void work(uint worker_id);
+};
 
 // Task to fixup self-forwarding pointers
 // installed as a result of an evacuation failure.
+// Requires G1ParClearEvacuatedMarksTask to have completed.
 class G1ParRemoveSelfForwardPtrsTask: public AbstractGangTask {
 protected:
   G1CollectedHeap* _g1h;
   G1RedirtyCardsQueueSet* _rdcqs;
-  HeapRegionClaimer _hrclaimer;
+  G1EvacFailedRegions* _regions;
+  volatile uint _next_chunk;
 
 public:
-  G1ParRemoveSelfForwardPtrsTask(G1RedirtyCardsQueueSet* rdcqs);
+  G1ParRemoveSelfForwardPtrsTask(G1RedirtyCardsQueueSet* rdcqs, G1EvacFailedRegions* regions);
 
   void work(uint worker_id);
 };
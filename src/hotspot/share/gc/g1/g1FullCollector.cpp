@@ -107,6 +107,14 @@ G1FullCollector::G1FullCollector(G1CollectedHeap* heap, bool explicit_gc, bool c
     _heap(heap),
     _scope(heap->g1mm(), explicit_gc, clear_soft_refs),
     _num_workers(calc_active_workers()),
+    _live_stats(NULL),
+    // A last-ditch collection compacts all regions it can. Regions left in
+    // place would keep young regions in dram on a heterogeneous heap.
+    _region_compaction_threshold((!G1FullGCSkipCompactingLiveRegions ||
+                                  clear_soft_refs ||
+                                  heap->is_heterogeneous_heap()) ?
+                                 HeapRegion::GrainWords :
+                                 HeapRegion::GrainWords * (100 - MarkSweepDeadRatio) / 100),
     _oop_queue_set(_num_workers),
     _array_queue_set(_num_workers),
     _preserved_marks_set(true),
@@ -118,10 +126,14 @@ G1FullCollector::G1FullCollector(G1CollectedHeap* heap, bool explicit_gc, bool c
   assert(SafepointSynchronize::is_at_safepoint(), "must be at a safepoint");
 
   _preserved_marks_set.init(_num_workers);
+  _live_stats = NEW_C_HEAP_ARRAY(G1RegionMarkStats, heap->max_regions(), mtGC);
+  for (uint i = 0; i < heap->max_regions(); i++) {
+    _live_stats[i].clear();
+  }
   _markers = NEW_C_HEAP_ARRAY(G1FullGCMarker*, _num_workers, mtGC);
   _compaction_points = NEW_C_HEAP_ARRAY(G1FullGCCompactionPoint*, _num_workers, mtGC);
   for (uint i = 0; i < _num_workers; i++) {
-    _markers[i] = new G1FullGCMarker(i, _preserved_marks_set.get(i), mark_bitmap());
+    _markers[i] = new G1FullGCMarker(i, _preserved_marks_set.get(i), mark_bitmap(), _live_stats);
     _compaction_points[i] = new G1FullGCCompactionPoint();
     _oop_queue_set.register_queue(i, marker(i)->oop_stack());
     _array_queue_set.register_queue(i, marker(i)->objarray_stack());
@@ -135,6 +147,7 @@ G1FullCollector::~G1FullCollector() {
   }
   FREE_C_HEAP_ARRAY(G1FullGCMarker*, _markers);
   FREE_C_HEAP_ARRAY(G1FullGCCompactionPoint*, _compaction_points);
+  FREE_C_HEAP_ARRAY(G1RegionMarkStats, _live_stats);
 }
 
 void G1FullCollector::prepare_collection() {
@@ -210,6 +223,11 @@ void G1FullCollector::phase1_mark_live_objects() {
     reference_processing.execute(scope()->timer(), scope()->tracer());
   }
 
+  // Marking is complete, publish the live words of all regions.
+  for (uint i = 0; i < workers(); i++) {
+    marker(i)->flush_mark_stats_cache();
+  }
+
   // Weak oops cleanup.
   {
     GCTraceTime(Debug, gc, phases) debug("Phase 1: Weak Processing", scope()->timer());
@@ -29,6 +29,8 @@
 #include "gc/g1/g1FullGCMarker.hpp"
 #include "gc/g1/g1FullGCOopClosures.hpp"
 #include "gc/g1/g1FullGCScope.hpp"
+#include "gc/g1/g1RegionMarkStatsCache.hpp"
+#include "gc/g1/heapRegion.hpp"
 #include "gc/shared/preservedMarks.hpp"
 #include "gc/shared/referenceProcessor.hpp"
 #include "gc/shared/taskqueue.hpp"
@@ -57,6 +59,10 @@ class G1FullCollector : StackObj {
   G1CollectedHeap*          _heap;
   G1FullGCScope             _scope;
   uint                      _num_workers;
+  // Live words per region found by the marking, and the number of live
+  // words above which a region is not compacted.
+  G1RegionMarkStats*        _live_stats;
+  size_t                    _region_compaction_threshold;
   G1FullGCMarker**          _markers;
   G1FullGCCompactionPoint** _compaction_points;
   OopQueueSet               _oop_queue_set;
@@ -89,6 +95,16 @@ public:
   G1FullGCCompactionPoint* serial_compaction_point() { return &_serial_compaction_point; }
   G1CMBitMap*              mark_bitmap();
   ReferenceProcessor*      reference_processor();
+  G1RegionMarkStats*       live_stats() { return _live_stats; }
+
+  // Regions that are almost completely live are not worth compacting. Their
+  // objects stay in place, only their pointers are adjusted, and the dead
+  // space between them is filled with dummy objects. Only used with
+  // G1FullGCSkipCompactingLiveRegions.
+  bool is_skip_compacting(HeapRegion* hr) const {
+    return !hr->is_pinned() &&
+           _live_stats[hr->hrm_index()]._live_words > _region_compaction_threshold;
+  }
 
 private:
   void phase1_mark_live_objects();
@@ -34,12 +34,41 @@
 #include "oops/oop.inline.hpp"
 #include "utilities/ticks.hpp"
 
-class G1ResetHumongousClosure : public HeapRegionClosure {
+class G1ResetSkipCompactingClosure : public HeapRegionClosure {
+  G1FullCollector* _collector;
   G1CMBitMap* _bitmap;
 
+  // The live objects of a region that is not compacted stay in place. Fill
+  // the dead space between them and rebuild the block offset table.
+  void reset_skip_compacting(HeapRegion* hr) {
+    HeapWord* threshold = hr->initialize_threshold();
+    HeapWord* cur = hr->bottom();
+    HeapWord* const limit = hr->top();
+    while (cur < limit) {
+      HeapWord* next_live = _bitmap->get_next_marked_addr(cur, limit);
+      if (next_live > cur) {
+        CollectedHeap::fill_with_objects(cur, pointer_delta(next_live, cur));
+        if (next_live > threshold) {
+          threshold = hr->cross_threshold(cur, next_live);
+        }
+        cur = next_live;
+      }
+      if (cur < limit) {
+        HeapWord* obj_end = cur + oop(cur)->size();
+        if (obj_end > threshold) {
+          threshold = hr->cross_threshold(cur, obj_end);
+        }
+        cur = obj_end;
+      }
+    }
+    _bitmap->clear_region(hr);
+    hr->complete_compaction();
+  }
+
 public:
-  G1ResetHumongousClosure(G1CMBitMap* bitmap) :
-      _bitmap(bitmap) { }
+  G1ResetSkipCompactingClosure(G1FullCollector* collector) :
+      _collector(collector),
+      _bitmap(collector->mark_bitmap()) { }
 
   bool do_heap_region(HeapRegion* current) {
     if (current->is_humongous()) {
@@ -54,6 +83,8 @@ public:
         }
       }
       current->reset_humongous_during_compaction();
+    } else if (!current->is_pinned() && _collector->is_skip_compacting(current)) {
+      reset_skip_compacting(current);
     }
     return false;
   }
@@ -96,7 +127,7 @@ void G1FullGCCompactTask::work(uint worker_id) {
     compact_region(*it);
   }
 
-  G1ResetHumongousClosure hc(collector()->mark_bitmap());
+  G1ResetSkipCompactingClosure hc(collector());
   G1CollectedHeap::heap()->heap_region_par_iterate_from_worker_offset(&hc, &_claimer, worker_id);
   log_task("Compaction task", worker_id, start);
 }
@@ -26,6 +26,7 @@
 #define SHARE_GC_G1_G1FULLGCMARKER_HPP
 
 #include "gc/g1/g1FullGCOopClosures.hpp"
+#include "gc/g1/g1RegionMarkStatsCache.hpp"
 #include "gc/shared/preservedMarks.hpp"
 #include "gc/shared/taskqueue.hpp"
 #include "memory/iterator.hpp"
@@ -54,6 +55,11 @@ class G1FullGCMarker : public CHeapObj<mtGC> {
   ObjArrayTaskQueue  _objarray_stack;
   PreservedMarks*    _preserved_stack;
 
+  // Live words of the marked objects per region. The number of cache
+  // entries is the same as used by the concurrent mark tasks.
+  static const uint RegionMarkStatsCacheSize = 1024;
+  G1RegionMarkStatsCache _mark_stats_cache;
+
   // Marking closures
   G1MarkAndPushClosure _mark_closure;
   G1VerifyOopClosure   _verify_closure;
@@ -71,7 +77,10 @@ class G1FullGCMarker : public CHeapObj<mtGC> {
   inline void follow_array(objArrayOop array);
   inline void follow_array_chunk(objArrayOop array, int index);
 public:
-  G1FullGCMarker(uint worker_id, PreservedMarks* preserved_stack, G1CMBitMap* bitmap);
+  G1FullGCMarker(uint worker_id,
+                 PreservedMarks* preserved_stack,
+                 G1CMBitMap* bitmap,
+                 G1RegionMarkStats* mark_stats);
   ~G1FullGCMarker();
 
   // Stack getters
@@ -89,6 +98,9 @@ public:
                         ObjArrayTaskQueueSet* array_stacks,
                         ParallelTaskTerminator* terminator);
 
+  // Add the live words cached by this marker to the global statistics.
+  void flush_mark_stats_cache();
+
   // Closure getters
   CLDToOopClosure*      cld_closure()   { return &_cld_closure; }
   G1MarkAndPushClosure* mark_closure()  { return &_mark_closure; }
@@ -26,6 +26,7 @@
 #define SHARE_GC_G1_G1FULLGCMARKER_INLINE_HPP
 
 #include "gc/g1/g1Allocator.inline.hpp"
+#include "gc/g1/g1CollectedHeap.inline.hpp"
 #include "gc/g1/g1ConcurrentMarkBitMap.inline.hpp"
 #include "gc/g1/g1FullGCMarker.hpp"
 #include "gc/g1/g1FullGCOopClosures.inline.hpp"
@@ -49,6 +50,8 @@ inline bool G1FullGCMarker::mark_object(oop obj) {
     return false;
   }
 
+  _mark_stats_cache.add_live_words(G1CollectedHeap::heap()->addr_to_region((HeapWord*)obj), obj->size());
+
   // Marked by us, preserve if needed.
   markWord mark = obj->mark_raw();
   if (obj->mark_must_be_preserved(mark) &&
@@ -50,7 +50,11 @@ bool G1FullGCPrepareTask::G1CalculatePointersClosure::do_heap_region(HeapRegion*
       free_humongous_region(hr);
     }
   } else if (!hr->is_pinned()) {
-    prepare_for_compaction(hr);
+    if (_collector->is_skip_compacting(hr)) {
+      prepare_for_skip_compacting(hr);
+    } else {
+      prepare_for_compaction(hr);
+    }
   }
 
   // Reset data structures not valid after Full GC.
@@ -78,7 +82,7 @@ bool G1FullGCPrepareTask::has_freed_regions() {
 void G1FullGCPrepareTask::work(uint worker_id) {
   Ticks start = Ticks::now();
   G1FullGCCompactionPoint* compaction_point = collector()->compaction_point(worker_id);
-  G1CalculatePointersClosure closure(collector()->mark_bitmap(), compaction_point);
+  G1CalculatePointersClosure closure(collector(), compaction_point);
   G1CollectedHeap::heap()->heap_region_par_iterate_from_start(&closure, &_hrclaimer);
 
   // Update humongous region sets
@@ -92,10 +96,11 @@ void G1FullGCPrepareTask::work(uint worker_id) {
   log_task("Prepare compaction task", worker_id, start);
 }
 
-G1FullGCPrepareTask::G1CalculatePointersClosure::G1CalculatePointersClosure(G1CMBitMap* bitmap,
+G1FullGCPrepareTask::G1CalculatePointersClosure::G1CalculatePointersClosure(G1FullCollector* collector,
                                                                             G1FullGCCompactionPoint* cp) :
     _g1h(G1CollectedHeap::heap()),
-    _bitmap(bitmap),
+    _collector(collector),
+    _bitmap(collector->mark_bitmap()),
     _cp(cp),
     _humongous_regions_removed(0) { }
 
@@ -129,6 +134,16 @@ size_t G1FullGCPrepareTask::G1PrepareCompactLiveClosure::apply(oop object) {
   return size;
 }
 
+size_t G1FullGCPrepareTask::G1PrepareSkipCompactingClosure::apply(oop object) {
+  if (object->forwardee() != NULL) {
+    // The object does not move, but its mark-word looks like a forwarding
+    // pointer. The mark has already been preserved during marking.
+    object->init_mark_raw();
+  }
+  assert(object->forwardee() == NULL, "should be forwarded to NULL");
+  return object->size();
+}
+
 size_t G1FullGCPrepareTask::G1RePrepareClosure::apply(oop obj) {
   // We only re-prepare objects forwarded within the current region, so
   // skip objects that are already forwarded to another region.
@@ -161,6 +176,17 @@ void G1FullGCPrepareTask::G1CalculatePointersClosure::prepare_for_compaction(Hea
   prepare_for_compaction_work(_cp, hr);
 }
 
+void G1FullGCPrepareTask::G1CalculatePointersClosure::prepare_for_skip_compacting(HeapRegion* hr) {
+  // The region is not added to any compaction queue, so nothing is
+  // compacted into it either. All its live objects stay where they are.
+  G1PrepareSkipCompactingClosure prepare_skip;
+  log_debug(gc, region)("Skip compacting region %u (%s), " SIZE_FORMAT " live words",
+                        hr->hrm_index(), hr->get_short_type_str(),
+                        _collector->live_stats()[hr->hrm_index()]._live_words);
+  hr->set_compaction_top(hr->top());
+  hr->apply_to_marked_objects(_bitmap, &prepare_skip);
+}
+
 void G1FullGCPrepareTask::prepare_serial_compaction() {
   GCTraceTime(Debug, gc, phases) debug("Phase 2: Prepare Serial Compaction", collector()->scope()->timer());
   // At this point we know that no regions were completely freed by
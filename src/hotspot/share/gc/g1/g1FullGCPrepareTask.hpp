@@ -52,17 +52,19 @@ protected:
   class G1CalculatePointersClosure : public HeapRegionClosure {
   protected:
     G1CollectedHeap* _g1h;
+    G1FullCollector* _collector;
     G1CMBitMap* _bitmap;
     G1FullGCCompactionPoint* _cp;
     uint _humongous_regions_removed;
 
     virtual void prepare_for_compaction(HeapRegion* hr);
     void prepare_for_compaction_work(G1FullGCCompactionPoint* cp, HeapRegion* hr);
+    void prepare_for_skip_compacting(HeapRegion* hr);
     void free_humongous_region(HeapRegion* hr);
     void reset_region_metadata(HeapRegion* hr);
 
   public:
-    G1CalculatePointersClosure(G1CMBitMap* bitmap,
+    G1CalculatePointersClosure(G1FullCollector* collector,
                                G1FullGCCompactionPoint* cp);
 
     void update_sets();
@@ -78,6 +80,12 @@ protected:
     size_t apply(oop object);
   };
 
+  // Leaves the objects of a region that is not compacted in place.
+  class G1PrepareSkipCompactingClosure : public StackObj {
+  public:
+    size_t apply(oop object);
+  };
+
   class G1RePrepareClosure : public StackObj {
     G1FullGCCompactionPoint* _cp;
     HeapRegion* _current;
@@ -28,6 +28,7 @@
 #include "gc/g1/g1HotCardCache.hpp"
 #include "gc/g1/g1ParScanThreadState.inline.hpp"
 #include "gc/g1/g1StringDedup.hpp"
+#include "gc/shared/gcId.hpp"
 #include "gc/shared/gcTimer.hpp"
 #include "gc/shared/workerDataArray.inline.hpp"
 #include "memory/resourceArea.hpp"
@@ -268,6 +269,13 @@ void G1GCPhaseTimes::note_gc_end() {
       ASSERT_PHASE_UNINITIALIZED(Termination);
     }
   }
+
+  const uint gc_id = GCId::current();
+  for (int i = 0; i < GCParPhasesSentinel; i++) {
+    if (_gc_par_phases[i] != NULL) {
+      _gc_par_phases[i]->send_worker_events(gc_id, phase_name((GCParPhases)i));
+    }
+  }
 }
 
 #undef ASSERT_PHASE_UNINITIALIZED
@@ -605,9 +613,9 @@ const char* G1GCPhaseTimes::phase_name(GCParPhases phase) {
   return names[phase];
 }
 
-G1EvacPhaseWithTrimTimeTracker::G1EvacPhaseWithTrimTimeTracker(G1ParScanThreadState* pss, Tickspan& total_time, Tickspan& trim_time) :
+G1EvacPhaseWithTrimTimeTracker::G1EvacPhaseWithTrimTimeTracker(G1ParScanThreadState* pss, FastTickspan& total_time, FastTickspan& trim_time) :
   _pss(pss),
-  _start(Ticks::now()),
+  _start(FastTicks::now()),
   _total_time(total_time),
   _trim_time(trim_time),
   _stopped(false) {
@@ -623,7 +631,7 @@ G1EvacPhaseWithTrimTimeTracker::~G1EvacPhaseWithTrimTimeTracker() {
 
 void G1EvacPhaseWithTrimTimeTracker::stop() {
   assert(!_stopped, "Should only be called once");
-  _total_time += (Ticks::now() - _start) - _pss->trim_ticks();
+  _total_time += (FastTicks::now() - _start) - _pss->trim_ticks();
   _trim_time += _pss->trim_ticks();
   _pss->reset_trim_ticks();
   _stopped = true;
@@ -632,16 +640,16 @@ void G1EvacPhaseWithTrimTimeTracker::stop() {
 G1GCParPhaseTimesTracker::G1GCParPhaseTimesTracker(G1GCPhaseTimes* phase_times, G1GCPhaseTimes::GCParPhases phase, uint worker_id, bool must_record) :
   _start_time(), _phase(phase), _phase_times(phase_times), _worker_id(worker_id), _event(), _must_record(must_record) {
   if (_phase_times != NULL) {
-    _start_time = Ticks::now();
+    _start_time = FastTicks::now();
   }
 }
 
 G1GCParPhaseTimesTracker::~G1GCParPhaseTimesTracker() {
   if (_phase_times != NULL) {
     if (_must_record) {
-      _phase_times->record_time_secs(_phase, _worker_id, (Ticks::now() - _start_time).seconds());
+      _phase_times->record_time_secs(_phase, _worker_id, (FastTicks::now() - _start_time).seconds());
     } else {
-      _phase_times->record_or_add_time_secs(_phase, _worker_id, (Ticks::now() - _start_time).seconds());
+      _phase_times->record_or_add_time_secs(_phase, _worker_id, (FastTicks::now() - _start_time).seconds());
     }
     _event.commit(GCId::current(), _worker_id, G1GCPhaseTimes::phase_name(_phase));
   }
@@ -456,14 +456,14 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
 
 class G1EvacPhaseWithTrimTimeTracker : public StackObj {
   G1ParScanThreadState* _pss;
-  Ticks _start;
+  FastTicks _start;
 
-  Tickspan& _total_time;
-  Tickspan& _trim_time;
+  FastTickspan& _total_time;
+  FastTickspan& _trim_time;
 
   bool _stopped;
 public:
-  G1EvacPhaseWithTrimTimeTracker(G1ParScanThreadState* pss, Tickspan& total_time, Tickspan& trim_time);
+  G1EvacPhaseWithTrimTimeTracker(G1ParScanThreadState* pss, FastTickspan& total_time, FastTickspan& trim_time);
   ~G1EvacPhaseWithTrimTimeTracker();
 
   void stop();
@@ -471,7 +471,7 @@ public:
 
 class G1GCParPhaseTimesTracker : public CHeapObj<mtGC> {
 protected:
-  Ticks _start_time;
+  FastTicks _start_time;
   G1GCPhaseTimes::GCParPhases _phase;
   G1GCPhaseTimes* _phase_times;
   uint _worker_id;
@@ -484,8 +484,8 @@ public:
 };
 
 class G1EvacPhaseTimesTracker : public G1GCParPhaseTimesTracker {
-  Tickspan _total_time;
-  Tickspan _trim_time;
+  FastTickspan _total_time;
+  FastTickspan _trim_time;
 
   G1EvacPhaseWithTrimTimeTracker _trim_tracker;
 public:
@@ -24,6 +24,7 @@
 
 #include "precompiled.hpp"
 #include "gc/g1/g1CollectedHeap.hpp"
+#include "gc/g1/g1CollectionSet.hpp"
 #include "gc/g1/g1HeterogeneousHeapPolicy.hpp"
 #include "gc/g1/g1Policy.hpp"
 #include "gc/g1/heterogeneousHeapRegionManager.hpp"
@@ -41,6 +42,8 @@ void G1HeterogeneousHeapPolicy::init(G1CollectedHeap* g1h, G1CollectionSet* coll
 // After a collection pause, young list target length is updated. So we need to make sure we have enough regions in dram for young gen.
 void G1HeterogeneousHeapPolicy::record_collection_pause_end(double pause_time_ms) {
   G1Policy::record_collection_pause_end(pause_time_ms);
+  _manager->clear_old_gc_alloc_memory();
+  _manager->decay_access_temperature();
   _manager->adjust_dram_regions((uint)young_list_target_length(), G1CollectedHeap::heap()->workers());
 }
 
@@ -50,6 +53,35 @@ void G1HeterogeneousHeapPolicy::record_full_collection_end() {
   _manager->adjust_dram_regions((uint)young_list_target_length(), G1CollectedHeap::heap()->workers());
 }
 
+class G1CountHotOldRegionsClosure : public HeapRegionClosure {
+  HeterogeneousHeapRegionManager* _manager;
+public:
+  uint _num_old;
+  uint _num_hot;
+
+  G1CountHotOldRegionsClosure(HeterogeneousHeapRegionManager* manager) :
+    _manager(manager), _num_old(0), _num_hot(0) {}
+
+  bool do_heap_region(HeapRegion* r) {
+    if (r->is_old()) {
+      _num_old++;
+      if (_manager->is_hot(r->hrm_index())) {
+        _num_hot++;
+      }
+    }
+    return false;
+  }
+};
+
+void G1HeterogeneousHeapPolicy::record_collection_set_finalized() {
+  if (G1HotOldRegionThreshold == 0) {
+    return;
+  }
+  G1CountHotOldRegionsClosure cl(_manager);
+  G1CollectedHeap::heap()->collection_set()->iterate(&cl);
+  _manager->select_old_gc_alloc_memory(cl._num_old, cl._num_hot);
+}
+
 bool G1HeterogeneousHeapPolicy::force_upgrade_to_full() {
   if (_manager->has_borrowed_regions()) {
     return true;
@@ -43,5 +43,8 @@ public:
   virtual void record_full_collection_end();
 
   virtual bool force_upgrade_to_full();
+
+  // Choose whether the old objects of this pause go to dram or nv-dimm.
+  virtual void record_collection_set_finalized();
 };
 #endif // SHARE_GC_G1_G1HETEROGENEOUSHEAPPOLICY_HPP
@@ -122,10 +122,18 @@ bool G1AdaptiveIHOPControl::have_enough_data_for_prediction() const {
          ((size_t)_allocation_rate_s.num() >= G1AdaptiveIHOPNumInitialSamples);
 }
 
+double G1AdaptiveIHOPControl::predict_allocation_rate() const {
+  // The prediction is based on a decaying average and needs a few samples
+  // to follow a sudden increase of the allocation rate. Use the most recent
+  // rate if it is higher, so that marking is not started too late when the
+  // application enters a burst of old gen allocation.
+  return MAX2(get_new_prediction(&_allocation_rate_s), _allocation_rate_s.last());
+}
+
 size_t G1AdaptiveIHOPControl::get_conc_mark_start_threshold() {
   if (have_enough_data_for_prediction()) {
     double pred_marking_time = get_new_prediction(&_marking_times_s);
-    double pred_promotion_rate = get_new_prediction(&_allocation_rate_s);
+    double pred_promotion_rate = predict_allocation_rate();
     size_t pred_promotion_size = (size_t)(pred_marking_time * pred_promotion_rate);
 
     size_t predicted_needed_bytes_during_marking =
@@ -172,7 +180,7 @@ void G1AdaptiveIHOPControl::print() {
                       actual_target,
                       G1CollectedHeap::heap()->used(),
                       _last_unrestrained_young_size,
-                      get_new_prediction(&_allocation_rate_s),
+                      predict_allocation_rate(),
                       get_new_prediction(&_marking_times_s) * 1000.0,
                       have_enough_data_for_prediction() ? "true" : "false");
 }
@@ -183,7 +191,7 @@ void G1AdaptiveIHOPControl::send_trace_event(G1NewTracer* tracer) {
                                           actual_target_threshold(),
                                           G1CollectedHeap::heap()->used(),
                                           _last_unrestrained_young_size,
-                                          get_new_prediction(&_allocation_rate_s),
+                                          predict_allocation_rate(),
                                           get_new_prediction(&_marking_times_s),
                                           have_enough_data_for_prediction());
 }
@@ -125,6 +125,8 @@ class G1AdaptiveIHOPControl : public G1IHOPControl {
 
   // Get a new prediction bounded below by zero from the given sequence.
   double get_new_prediction(TruncatedSeq const* seq) const;
+  // Get the predicted old gen allocation rate.
+  double predict_allocation_rate() const;
 
   bool have_enough_data_for_prediction() const;
 
@@ -29,6 +29,8 @@
 #include "gc/g1/g1MemoryPool.hpp"
 #include "gc/shared/hSpaceCounters.hpp"
 #include "memory/metaspaceCounters.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/orderAccess.hpp"
 #include "services/memoryPool.hpp"
 
 class G1GenerationCounters : public GenerationCounters {
@@ -110,7 +112,8 @@ G1MonitoringSupport::G1MonitoringSupport(G1CollectedHeap* g1h) :
   _eden_space_used(0),
   _survivor_space_committed(0),
   _survivor_space_used(0),
-  _old_gen_used(0) {
+  _old_gen_used(0),
+  _sizes_version(0) {
 
   recalculate_sizes();
 
@@ -202,9 +205,29 @@ void G1MonitoringSupport::initialize_serviceability() {
   _incremental_memory_manager.add_pool(_old_gen_pool, false /* always_affected_by_gc */);
 }
 
+uint G1MonitoringSupport::begin_read_sizes() const {
+  uint version;
+  while (((version = Atomic::load_acquire(&_sizes_version)) & 1) != 0) {
+    SpinPause();
+  }
+  return version;
+}
+
+bool G1MonitoringSupport::end_read_sizes(uint version) const {
+  OrderAccess::loadload();
+  return Atomic::load(&_sizes_version) == version;
+}
+
 MemoryUsage G1MonitoringSupport::memory_usage() {
-  MutexLocker x(MonitoringSupport_lock, Mutex::_no_safepoint_check_flag);
-  return MemoryUsage(InitialHeapSize, _overall_used, _overall_committed, _g1h->max_capacity());
+  size_t used;
+  size_t committed;
+  uint version;
+  do {
+    version = begin_read_sizes();
+    used = _overall_used;
+    committed = _overall_committed;
+  } while (!end_read_sizes(version));
+  return MemoryUsage(InitialHeapSize, used, committed, _g1h->max_capacity());
 }
 
 GrowableArray<GCMemoryManager*> G1MonitoringSupport::memory_managers() {
@@ -226,6 +249,8 @@ void G1MonitoringSupport::recalculate_sizes() {
   assert_heap_locked_or_at_safepoint(true);
 
   MutexLocker x(MonitoringSupport_lock, Mutex::_no_safepoint_check_flag);
+  // Make the version odd for the duration of the update.
+  Atomic::inc(&_sizes_version);
   // Recalculate all the sizes from scratch.
 
   // This never includes used bytes of current allocating heap region.
@@ -285,6 +310,8 @@ void G1MonitoringSupport::recalculate_sizes() {
   assert(_old_gen_used <= _old_gen_committed, "Old gen used bytes(" SIZE_FORMAT
          ") should be less than or equal to old gen committed(" SIZE_FORMAT ")",
          _old_gen_used, _old_gen_committed);
+
+  Atomic::release_store(&_sizes_version, _sizes_version + 1);
 }
 
 void G1MonitoringSupport::update_sizes() {
@@ -317,30 +344,42 @@ void G1MonitoringSupport::update_eden_size() {
 }
 
 MemoryUsage G1MonitoringSupport::eden_space_memory_usage(size_t initial_size, size_t max_size) {
-  MutexLocker x(MonitoringSupport_lock, Mutex::_no_safepoint_check_flag);
-
-  return MemoryUsage(initial_size,
-                     _eden_space_used,
-                     _eden_space_committed,
-                     max_size);
+  size_t used;
+  size_t committed;
+  uint version;
+  do {
+    version = begin_read_sizes();
+    used = _eden_space_used;
+    committed = _eden_space_committed;
+  } while (!end_read_sizes(version));
+
+  return MemoryUsage(initial_size, used, committed, max_size);
 }
 
 MemoryUsage G1MonitoringSupport::survivor_space_memory_usage(size_t initial_size, size_t max_size) {
-  MutexLocker x(MonitoringSupport_lock, Mutex::_no_safepoint_check_flag);
-
-  return MemoryUsage(initial_size,
-                     _survivor_space_used,
-                     _survivor_space_committed,
-                     max_size);
+  size_t used;
+  size_t committed;
+  uint version;
+  do {
+    version = begin_read_sizes();
+    used = _survivor_space_used;
+    committed = _survivor_space_committed;
+  } while (!end_read_sizes(version));
+
+  return MemoryUsage(initial_size, used, committed, max_size);
 }
 
 MemoryUsage G1MonitoringSupport::old_gen_memory_usage(size_t initial_size, size_t max_size) {
-  MutexLocker x(MonitoringSupport_lock, Mutex::_no_safepoint_check_flag);
-
-  return MemoryUsage(initial_size,
-                     _old_gen_used,
-                     _old_gen_committed,
-                     max_size);
+  size_t used;
+  size_t committed;
+  uint version;
+  do {
+    version = begin_read_sizes();
+    used = _old_gen_used;
+    committed = _old_gen_committed;
+  } while (!end_read_sizes(version));
+
+  return MemoryUsage(initial_size, used, committed, max_size);
 }
 
 G1MonitoringScope::G1MonitoringScope(G1MonitoringSupport* g1mm, bool full_gc, bool all_memory_pools_affected) :
@@ -174,6 +174,15 @@ class G1MonitoringSupport : public CHeapObj<mtGC> {
 
   size_t _old_gen_used;
 
+  // The sizes above are published with a sequence lock so that readers of
+  // the MemoryUsage snapshots never block. The version is odd while
+  // recalculate_sizes() is writing; writers are still serialized by the
+  // MonitoringSupport_lock.
+  volatile uint _sizes_version;
+
+  uint begin_read_sizes() const;
+  bool end_read_sizes(uint version) const;
+
   // Recalculate all the sizes.
   void recalculate_sizes();
 
@@ -68,7 +68,7 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
   uint const _stack_trim_upper_threshold;
   uint const _stack_trim_lower_threshold;
 
-  Tickspan _trim_ticks;
+  FastTickspan _trim_ticks;
   // Map from young-age-index (0 == not young, 1 is youngest) to
   // surviving words. base is what we get back from the malloc call
   size_t* _surviving_young_words_base;
@@ -229,7 +229,7 @@ public:
   void trim_queue();
   void trim_queue_partially();
 
-  Tickspan trim_ticks() const;
+  FastTickspan trim_ticks() const;
   void reset_trim_ticks();
 
   inline void steal_and_trim_queue(RefToScanQueueSet *task_queues);
@@ -189,19 +189,19 @@ inline void G1ParScanThreadState::trim_queue_partially() {
     return;
   }
 
-  const Ticks start = Ticks::now();
+  const FastTicks start = FastTicks::now();
   do {
     trim_queue_to_threshold(_stack_trim_lower_threshold);
   } while (!is_partially_trimmed());
-  _trim_ticks += Ticks::now() - start;
+  _trim_ticks += FastTicks::now() - start;
 }
 
-inline Tickspan G1ParScanThreadState::trim_ticks() const {
+inline FastTickspan G1ParScanThreadState::trim_ticks() const {
   return _trim_ticks;
 }
 
 inline void G1ParScanThreadState::reset_trim_ticks() {
-  _trim_ticks = Tickspan();
+  _trim_ticks = FastTickspan();
 }
 
 template <typename T>
@@ -77,6 +77,7 @@ G1Policy::G1Policy(STWGCTimer* gc_timer) :
   _total_concurrent_refinement_time(),
   _bytes_allocated_in_old_since_last_gc(0),
   _initial_mark_to_mixed(),
+  _mixed_gc_count(0),
   _collection_set(NULL),
   _g1h(NULL),
   _phase_times(new G1GCPhaseTimes(gc_timer, ParallelGCThreads)),
@@ -702,6 +703,7 @@ void G1Policy::record_collection_pause_end(double pause_time_ms) {
   } else if (!this_pause_was_young_only) {
     // This is a mixed GC. Here we decide whether to continue doing more
     // mixed GCs or not.
+    _mixed_gc_count++;
     if (!next_gc_should_be_mixed("continue mixed GCs",
                                  "do not continue mixed GCs")) {
       collector_state()->set_in_young_only_phase(true);
@@ -848,9 +850,25 @@ void G1Policy::record_collection_pause_end(double pause_time_ms) {
   log_debug(gc, ergo, refine)("Concurrent refinement times: Logged Cards Scan time goal: %1.2fms Logged Cards Scan time: %1.2fms HCC time: %1.2fms",
                               scan_logged_cards_time_goal_ms, logged_cards_time, merge_hcc_time_ms);
 
+  // Predict the cost of a logged card in the pause, which is merged into
+  // the card table and then scanned.
+  double const predicted_card_time_ms = _analytics->predict_card_merge_time_ms(1, true /* for_young_gc */) +
+                                        _analytics->predict_card_scan_time_ms(1, true /* for_young_gc */);
+
+  // Predict the number of refinement threads needed to refine cards as fast
+  // as the mutators log them. The concurrent refine rate is per thread.
+  uint num_threads_wanted = G1ConcurrentRefine::max_num_threads();
+  double const refine_rate_ms = _analytics->predict_concurrent_refine_rate_ms();
+  if (refine_rate_ms > 0.0) {
+    double const threads = ceil(_analytics->predict_logged_cards_rate_ms() / refine_rate_ms);
+    num_threads_wanted = (uint)MIN2(threads, (double)num_threads_wanted);
+  }
+
   _g1h->concurrent_refine()->adjust(logged_cards_time,
                                     phase_times()->sum_thread_work_items(G1GCPhaseTimes::MergeLB, G1GCPhaseTimes::MergeLBDirtyCards),
-                                    scan_logged_cards_time_goal_ms);
+                                    scan_logged_cards_time_goal_ms,
+                                    predicted_card_time_ms,
+                                    num_threads_wanted);
 }
 
 G1IHOPControl* G1Policy::create_ihop_control(const G1Predictions* predictor){
@@ -1106,6 +1124,7 @@ void G1Policy::decide_on_conc_mark_initiation() {
 void G1Policy::record_concurrent_mark_cleanup_end() {
   G1CollectionSetCandidates* candidates = G1CollectionSetChooser::build(_g1h->workers(), _g1h->num_regions());
   _collection_set->set_candidates(candidates);
+  _mixed_gc_count = 0;
 
   bool mixed_gc_pending = next_gc_should_be_mixed("request mixed gcs", "request young-only gcs");
   if (!mixed_gc_pending) {
@@ -1233,12 +1252,15 @@ uint G1Policy::calc_min_old_cset_length() const {
   // sure we go through the available old regions in no more than the
   // maximum desired number of mixed GCs.
   //
-  // The calculation is based on the number of marked regions we added
-  // to the CSet candidates in the first place, not how many remain, so
-  // that the result is the same during all mixed GCs that follow a cycle.
-
-  const size_t region_num = _collection_set->candidates()->num_regions();
-  const size_t gc_num = (size_t) MAX2(G1MixedGCCountTarget, (uintx) 1);
+  // The calculation spreads the candidate regions that remain over the
+  // mixed GCs that remain of the desired number. As long as every mixed
+  // GC adds exactly the minimum, the result is the same during all mixed
+  // GCs that follow a cycle. If earlier mixed GCs could afford to add more
+  // old regions, the later ones are planned to need fewer of them.
+
+  const size_t region_num = _collection_set->candidates()->num_remaining();
+  const size_t gc_target = (size_t) MAX2(G1MixedGCCountTarget, (uintx) 1);
+  const size_t gc_num = gc_target - MIN2((size_t) _mixed_gc_count, gc_target - 1);
   size_t result = region_num / gc_num;
   // emulate ceiling
   if (result * gc_num < region_num) {
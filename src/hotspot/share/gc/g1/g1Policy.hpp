@@ -112,6 +112,10 @@ class G1Policy: public CHeapObj<mtGC> {
 
   G1InitialMarkToMixedTimeTracker _initial_mark_to_mixed;
 
+  // The number of mixed GCs done since the collection set candidates
+  // of the current cycle were chosen.
+  uint _mixed_gc_count;
+
   bool should_update_surv_rate_group_predictors() {
     return collector_state()->in_young_only_phase() && !collector_state()->mark_or_rebuild_in_progress();
   }
@@ -450,6 +454,9 @@ public:
   virtual bool force_upgrade_to_full() {
     return false;
   }
+
+  // Called once the initial collection set of a pause is known.
+  virtual void record_collection_set_finalized() {}
 };
 
 #endif // SHARE_GC_G1_G1POLICY_HPP
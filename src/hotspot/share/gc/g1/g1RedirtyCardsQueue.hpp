@@ -116,6 +116,9 @@ public:
   // precondition: Must not be concurrent with buffer collection.
   BufferNode* all_completed_buffers() const;
   G1BufferNodeList take_all_completed_buffers();
+
+  // The number of cards in the completed buffers.
+  size_t entry_count() const { return _entry_count; }
 };
 
 #endif // SHARE_GC_G1_G1REDIRTYCARDSQUEUE_HPP
@@ -72,6 +72,12 @@ class G1RegionToSpaceMapper : public CHeapObj<mtGC> {
     return _commit_map.at(idx);
   }
 
+  // Notify the listener that the memory of the regions is reused as if it
+  // had just been committed, without committing it again.
+  void signal_mapping_changed(uint start_idx, size_t num_regions) {
+    fire_on_commit(start_idx, num_regions, false);
+  }
+
   void commit_and_set_special();
   virtual void commit_regions(uint start_idx, size_t num_regions = 1, WorkGang* pretouch_workers = NULL) = 0;
   virtual void uncommit_regions(uint start_idx, size_t num_regions = 1) = 0;
@@ -40,6 +40,7 @@
 #include "gc/g1/heapRegion.inline.hpp"
 #include "gc/g1/heapRegionManager.inline.hpp"
 #include "gc/g1/heapRegionRemSet.inline.hpp"
+#include "gc/g1/heterogeneousHeapRegionManager.hpp"
 #include "gc/g1/sparsePRT.hpp"
 #include "gc/shared/gcTraceTime.inline.hpp"
 #include "gc/shared/ptrQueue.hpp"
@@ -629,8 +630,8 @@ class G1ScanHRForRegionClosure : public HeapRegionClosure {
   size_t _blocks_scanned;
   size_t _chunks_claimed;
 
-  Tickspan _rem_set_root_scan_time;
-  Tickspan _rem_set_trim_partially_time;
+  FastTickspan _rem_set_root_scan_time;
+  FastTickspan _rem_set_trim_partially_time;
 
   // The address to which this thread already scanned (walked the heap) up to during
   // card scanning (exclusive).
@@ -750,8 +751,8 @@ public:
     return false;
   }
 
-  Tickspan rem_set_root_scan_time() const { return _rem_set_root_scan_time; }
-  Tickspan rem_set_trim_partially_time() const { return _rem_set_trim_partially_time; }
+  FastTickspan rem_set_root_scan_time() const { return _rem_set_root_scan_time; }
+  FastTickspan rem_set_trim_partially_time() const { return _rem_set_trim_partially_time; }
 
   size_t cards_scanned() const { return _cards_scanned; }
   size_t blocks_scanned() const { return _blocks_scanned; }
@@ -789,11 +790,11 @@ class G1ScanCollectionSetRegionClosure : public HeapRegionClosure {
   size_t _opt_refs_scanned;
   size_t _opt_refs_memory_used;
 
-  Tickspan _strong_code_root_scan_time;
-  Tickspan _strong_code_trim_partially_time;
+  FastTickspan _strong_code_root_scan_time;
+  FastTickspan _strong_code_trim_partially_time;
 
-  Tickspan _rem_set_opt_root_scan_time;
-  Tickspan _rem_set_opt_trim_partially_time;
+  FastTickspan _rem_set_opt_root_scan_time;
+  FastTickspan _rem_set_opt_trim_partially_time;
 
   void scan_opt_rem_set_roots(HeapRegion* r) {
     EventGCPhaseParallel event;
@@ -849,11 +850,11 @@ public:
     return false;
   }
 
-  Tickspan strong_code_root_scan_time() const { return _strong_code_root_scan_time;  }
-  Tickspan strong_code_root_trim_partially_time() const { return _strong_code_trim_partially_time; }
+  FastTickspan strong_code_root_scan_time() const { return _strong_code_root_scan_time;  }
+  FastTickspan strong_code_root_trim_partially_time() const { return _strong_code_trim_partially_time; }
 
-  Tickspan rem_set_opt_root_scan_time() const { return _rem_set_opt_root_scan_time; }
-  Tickspan rem_set_opt_trim_partially_time() const { return _rem_set_opt_trim_partially_time; }
+  FastTickspan rem_set_opt_root_scan_time() const { return _rem_set_opt_root_scan_time; }
+  FastTickspan rem_set_opt_trim_partially_time() const { return _rem_set_opt_trim_partially_time; }
 
   size_t opt_refs_scanned() const { return _opt_refs_scanned; }
   size_t opt_refs_memory_used() const { return _opt_refs_memory_used; }
@@ -1378,6 +1379,10 @@ void G1RemSet::refine_card_concurrently(CardValue* const card_ptr,
   HeapWord* start = _ct->addr_for(card_ptr);
   // And find the region containing it.
   HeapRegion* r = _g1h->heap_region_containing(start);
+  if (G1HotOldRegionThreshold > 0 && _g1h->is_heterogeneous_heap()) {
+    // Mutator writes into the region, sample them as its access temperature.
+    HeterogeneousHeapRegionManager::manager()->record_access(r->hrm_index());
+  }
   // This reload of the top is safe even though it happens after the full
   // fence, because top is stable for old, archive and unfiltered humongous
   // regions, so it must return the same value as the previous load when
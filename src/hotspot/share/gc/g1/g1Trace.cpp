@@ -179,6 +179,8 @@ create_g1_evacstats(unsigned gcid, const G1EvacSummary& summary) {
   s.set_regionEndWaste(summary.region_end_waste() * HeapWordSize);
   s.set_regionsRefilled(summary.regions_filled());
   s.set_directAllocated(summary.direct_allocated() * HeapWordSize);
+  s.set_numPlabsFilled(summary.num_plab_filled());
+  s.set_numDirectAllocated(summary.num_direct_allocated());
   s.set_failureUsed(summary.failure_used() * HeapWordSize);
   s.set_failureWaste(summary.failure_waste() * HeapWordSize);
   return s;
@@ -98,6 +98,42 @@ void G1YoungRemSetSamplingThread::check_for_periodic_gc(){
   }
 }
 
+// Uncommit the memory of the regions removed from the heap by the last
+// shrinking in chunks of G1UncommitChunkSize, pausing between the chunks so
+// that a pause that wants to expand the heap again is not held up for long.
+void G1YoungRemSetSamplingThread::uncommit_inactive_regions() {
+  HeapRegionManager* hrm = G1CollectedHeap::heap()->hrm();
+  if (!hrm->has_inactive_regions()) {
+    return;
+  }
+
+  const uint chunk_regions = MAX2((uint)(G1UncommitChunkSize / HeapRegion::GrainBytes), 1u);
+  const double start_ms = os::elapsedTime() * MILLIUNITS;
+  double uncommit_ms = 0.0;
+  uint num_uncommitted = 0;
+
+  while (!should_terminate()) {
+    double chunk_start_ms = os::elapsedTime() * MILLIUNITS;
+    uint num_regions = hrm->uncommit_inactive_regions(chunk_regions);
+    uncommit_ms += os::elapsedTime() * MILLIUNITS - chunk_start_ms;
+    num_uncommitted += num_regions;
+
+    if (num_regions == 0 ||
+        !hrm->has_inactive_regions() ||
+        (os::elapsedTime() * MILLIUNITS - start_ms) > G1ConcRefinementServiceIntervalMillis) {
+      break;
+    }
+
+    MonitorLocker ml(&_monitor, Mutex::_no_safepoint_check_flag);
+    if (!should_terminate()) {
+      ml.wait(10);
+    }
+  }
+
+  log_debug(gc, heap)("Uncommitted %u regions (" SIZE_FORMAT "M) in %1.3fms",
+                      num_uncommitted, (num_uncommitted * HeapRegion::GrainBytes) / M, uncommit_ms);
+}
+
 void G1YoungRemSetSamplingThread::run_service() {
   double vtime_start = os::elapsedVTime();
 
@@ -119,6 +155,8 @@ void G1YoungRemSetSamplingThread::run_service() {
 
     check_for_periodic_gc();
 
+    uncommit_inactive_regions();
+
     sleep_before_next_cycle();
   }
 }
@@ -51,6 +51,7 @@ private:
 
   void run_service();
   void check_for_periodic_gc();
+  void uncommit_inactive_regions();
 
   void stop_service();
 
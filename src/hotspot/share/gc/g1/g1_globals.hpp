@@ -181,6 +181,24 @@
           range(0, max_jint/wordSize)                                       \
           constraint(G1RSetSparseRegionEntriesConstraintFunc,AfterErgo)     \
                                                                             \
+  develop(intx, G1RSetMediumRegionEntriesFactor, 8,                         \
+          "Ratio of the number of entries per region in the medium "        \
+          "sparse table to G1RSetSparseRegionEntries.")                     \
+          range(1, max_jint/wordSize)                                       \
+                                                                            \
+  experimental(intx, G1RSetMediumRegionEntries, 0,                          \
+          "Max number of entries per region in the medium sparse table "    \
+          "used before keeping a bitmap for the region. Values not larger " \
+          "than G1RSetSparseRegionEntries disable the medium table. "       \
+          "Will be set ergonomically by default.")                          \
+          range(0, max_jint/wordSize)                                       \
+                                                                            \
+  experimental(uintx, G1PLABRefillsBeforeResize, 10,                        \
+          "Number of PLAB refills of a GC worker for a destination after "  \
+          "which the worker doubles its PLAB size for that destination "    \
+          "for the rest of the pause. 0 disables resizing during a pause.") \
+          range(0, max_uintx)                                               \
+                                                                            \
   develop(intx, G1MaxVerifyFailures, -1,                                    \
           "The maximum number of verification failures to print.  "         \
           "-1 means print all.")                                            \
@@ -252,6 +270,14 @@
           "Try to reclaim dead large objects that have a few stale "        \
           "references at every young GC.")                                  \
                                                                             \
+  experimental(bool, G1EagerReclaimHumongousObjArrays, true,                \
+          "Try to reclaim dead large object arrays at every young GC, "     \
+          "not only large primitive arrays.")                               \
+                                                                            \
+  experimental(bool, G1PinHumongousObjects, true,                           \
+          "Let JNI critical regions on humongous objects pin them in place "\
+          "instead of blocking garbage collections with the GCLocker")      \
+                                                                            \
   experimental(size_t, G1RebuildRemSetChunkSize, 256 * K,                   \
           "Chunk size used for rebuilding the remembered set.")             \
           range(4 * K, 32 * M)                                              \
@@ -316,6 +342,17 @@
           "disables this check.")                                           \
           range(0.0, (double)max_uintx)                                     \
                                                                             \
+  product(bool, G1UncommitConcurrently, false,                              \
+          "Uncommit the memory of regions removed from the heap in the "    \
+          "G1 service thread instead of in the pause shrinking the heap. "  \
+          "Not supported with AlwaysPreTouch or AllocateOldGenAt.")         \
+                                                                            \
+  experimental(size_t, G1UncommitChunkSize, 16*M,                           \
+          "Amount of memory uncommitted at a time by the G1 service "       \
+          "thread. The thread pauses briefly between chunks to limit "      \
+          "the uncommit rate.")                                             \
+          range(1, max_uintx)                                               \
+                                                                            \
   experimental(uintx, G1YoungExpansionBufferPercent, 10,                    \
                "When heterogenous heap is enabled by AllocateOldGenAt "     \
                "option, after every GC, young gen is re-sized which "       \
@@ -324,6 +361,26 @@
                "absorb small changes in young gen length. This flag takes " \
                "the buffer size as an percentage of young gen length")      \
                range(0, 100)                                                \
+                                                                            \
+  experimental(uintx, G1HotOldRegionThreshold, 0,                           \
+               "When heterogenous heap is enabled by AllocateOldGenAt "     \
+               "option, old regions whose count of refined cards reaches "  \
+               "this value are hot. The count halves at every pause. "      \
+               "Pauses that mostly evacuate hot old regions copy the old "  \
+               "objects into dram instead of nv-dimm. 0 disables this.")    \
+                                                                            \
+  experimental(uintx, G1HotOldDramPercent, 10,                              \
+               "When heterogenous heap is enabled by AllocateOldGenAt "     \
+               "option, the maximum part of the maximum heap size, in "     \
+               "percent, that old regions may take in dram. See "           \
+               "G1HotOldRegionThreshold.")                                  \
+               range(0, 100)                                                \
+                                                                            \
+  experimental(bool, G1FullGCSkipCompactingLiveRegions, false,              \
+               "Let full GC leave regions in place whose live data is "     \
+               "more than (100 - MarkSweepDeadRatio) percent of the "       \
+               "region, unless soft references are cleared. Not used "      \
+               "with AllocateOldGenAt.")                                    \
 
 
 #endif // SHARE_GC_G1_G1_GLOBALS_HPP
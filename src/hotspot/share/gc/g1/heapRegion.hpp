@@ -194,6 +194,17 @@ public:
     _bot_part.reset_bot();
   }
 
+  // Update the BOT for the given block without requiring the blocks to be
+  // processed in address order. Used by parallel workers handling disjoint
+  // parts of a region that failed evacuation; complete_bot_update() must be
+  // called once they are done.
+  void update_bot_for_block(HeapWord* start, HeapWord* end) {
+    _bot_part.update_for_block(start, end);
+  }
+  void complete_bot_update() {
+    _bot_part.set_threshold_after(top());
+  }
+
 private:
   // The remembered set for this region.
   HeapRegionRemSet* _rem_set;
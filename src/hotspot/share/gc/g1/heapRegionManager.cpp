@@ -34,6 +34,7 @@
 #include "logging/logStream.hpp"
 #include "memory/allocation.hpp"
 #include "runtime/atomic.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/orderAccess.hpp"
 #include "utilities/bitMap.inline.hpp"
 
@@ -64,7 +65,9 @@ HeapRegionManager::HeapRegionManager() :
   _cardtable_mapper(NULL),
   _card_counts_mapper(NULL),
   _available_map(mtGC),
+  _inactive_map(mtGC),
   _num_committed(0),
+  _num_inactive(0),
   _allocated_heapregions_length(0),
   _regions(), _heap_mapper(NULL),
   _prev_bitmap_mapper(NULL),
@@ -101,6 +104,7 @@ void HeapRegionManager::initialize(G1RegionToSpaceMapper* heap_storage,
   _regions.initialize(reserved.start(), reserved.end(), HeapRegion::GrainBytes);
 
   _available_map.initialize(_regions.length());
+  _inactive_map.initialize(_regions.length());
 }
 
 bool HeapRegionManager::is_available(uint region) const {
@@ -167,7 +171,7 @@ void HeapRegionManager::commit_regions(uint index, size_t num_regions, WorkGang*
   _card_counts_mapper->commit_regions(index, num_regions, pretouch_gang);
 }
 
-void HeapRegionManager::uncommit_regions(uint start, size_t num_regions) {
+void HeapRegionManager::deactivate_regions(uint start, size_t num_regions) {
   guarantee(num_regions >= 1, "Need to specify at least one region to uncommit, tried to uncommit zero regions at %u", start);
   guarantee(_num_committed >= num_regions, "pre-condition");
 
@@ -187,6 +191,18 @@ void HeapRegionManager::uncommit_regions(uint start, size_t num_regions) {
   _num_committed -= (uint)num_regions;
 
   _available_map.par_clear_range(start, start + num_regions, BitMap::unknown_range);
+}
+
+void HeapRegionManager::uncommit_regions(uint start, size_t num_regions) {
+  deactivate_regions(start, num_regions);
+
+  MutexLocker ml(G1UncommitConcurrently ? G1Uncommit_lock : NULL, Mutex::_no_safepoint_check_flag);
+  uncommit_memory(start, num_regions);
+}
+
+void HeapRegionManager::uncommit_memory(uint start, size_t num_regions) {
+  assert(!G1UncommitConcurrently || G1Uncommit_lock->owned_by_self(), "must hold G1Uncommit_lock");
+
   _heap_mapper->uncommit_regions(start, num_regions);
 
   // Also uncommit auxiliary data
@@ -199,9 +215,49 @@ void HeapRegionManager::uncommit_regions(uint start, size_t num_regions) {
   _card_counts_mapper->uncommit_regions(start, num_regions);
 }
 
+void HeapRegionManager::commit_or_reactivate_regions(uint start, uint num_regions, WorkGang* pretouch_gang) {
+  if (!G1UncommitConcurrently) {
+    commit_regions(start, num_regions, pretouch_gang);
+    return;
+  }
+
+  // The service thread may concurrently uncommit regions that share pages of
+  // the auxiliary data with these. G1Arguments disables concurrent uncommit
+  // with AlwaysPreTouch, so the work gang is never used under the lock.
+  assert(!AlwaysPreTouch, "must be");
+  MutexLocker ml(G1Uncommit_lock, Mutex::_no_safepoint_check_flag);
+
+  const uint end = start + num_regions;
+  uint cur = start;
+  while (cur < end) {
+    uint next;
+    if (_inactive_map.at(cur)) {
+      // The memory of inactive regions is still committed. Only reset the
+      // auxiliary data as if the memory had just been committed.
+      next = (uint)_inactive_map.get_next_zero_offset(cur, end);
+      uint num = next - cur;
+      _inactive_map.clear_range(cur, next);
+      _num_inactive -= num;
+      _num_committed += num;
+      log_trace(gc, heap)("Reactivated inactive regions [%u, %u)", cur, next);
+
+      _heap_mapper->signal_mapping_changed(cur, num);
+      _prev_bitmap_mapper->signal_mapping_changed(cur, num);
+      _next_bitmap_mapper->signal_mapping_changed(cur, num);
+      _bot_mapper->signal_mapping_changed(cur, num);
+      _cardtable_mapper->signal_mapping_changed(cur, num);
+      _card_counts_mapper->signal_mapping_changed(cur, num);
+    } else {
+      next = (uint)_inactive_map.get_next_one_offset(cur, end);
+      commit_regions(cur, next - cur, pretouch_gang);
+    }
+    cur = next;
+  }
+}
+
 void HeapRegionManager::make_regions_available(uint start, uint num_regions, WorkGang* pretouch_gang) {
   guarantee(num_regions > 0, "No point in calling this for zero regions");
-  commit_regions(start, num_regions, pretouch_gang);
+  commit_or_reactivate_regions(start, num_regions, pretouch_gang);
   for (uint i = start; i < start + num_regions; i++) {
     if (_regions.get_by_index(i) == NULL) {
       HeapRegion* new_hr = new_heap_region(i);
@@ -301,24 +357,35 @@ bool HeapRegionManager::is_on_preferred_index(uint region_index, uint preferred_
 }
 
 uint HeapRegionManager::find_contiguous(size_t num, bool empty_only) {
-  uint found = 0;
-  size_t length_found = 0;
-  uint cur = 0;
-
-  while (length_found < num && cur < max_length()) {
-    HeapRegion* hr = _regions.get_by_index(cur);
-    if ((!empty_only && !is_available(cur)) || (is_available(cur) && hr != NULL && hr->is_empty())) {
+  uint found = G1_NO_HRM_INDEX;
+  size_t best_length = SIZE_MAX;
+  uint start = 0;
+  size_t length = 0;
+
+  for (uint cur = 0; cur <= max_length(); cur++) {
+    HeapRegion* hr = cur < max_length() ? _regions.get_by_index(cur) : NULL;
+    if (cur < max_length() &&
+        ((!empty_only && !is_available(cur)) || (is_available(cur) && hr != NULL && hr->is_empty()))) {
       // This region is a potential candidate for allocation into.
-      length_found++;
-    } else {
-      // This region is not a candidate. The next region is the next possible one.
-      found = cur + 1;
-      length_found = 0;
+      length++;
+      continue;
     }
-    cur++;
+
+    // This region ends the current sequence of candidates.
+    if (length >= num && length < best_length) {
+      found = start;
+      best_length = length;
+      if (length == num) {
+        // Exact fit, cannot do better.
+        break;
+      }
+    }
+    // The next region is the next possible start.
+    start = cur + 1;
+    length = 0;
   }
 
-  if (length_found == num) {
+  if (found != G1_NO_HRM_INDEX) {
     for (uint i = found; i < (found + num); i++) {
       HeapRegion* hr = _regions.get_by_index(i);
       // sanity check
@@ -332,6 +399,23 @@ uint HeapRegionManager::find_contiguous(size_t num, bool empty_only) {
   }
 }
 
+uint HeapRegionManager::max_contiguous_empty_length() const {
+  uint max_length_found = 0;
+  uint length = 0;
+
+  for (uint cur = 0; cur < max_length(); cur++) {
+    HeapRegion* hr = _regions.get_by_index(cur);
+    if (is_available(cur) && hr != NULL && hr->is_empty()) {
+      length++;
+      max_length_found = MAX2(max_length_found, length);
+    } else {
+      length = 0;
+    }
+  }
+
+  return max_length_found;
+}
+
 HeapRegion* HeapRegionManager::next_region_in_heap(const HeapRegion* r) const {
   guarantee(r != NULL, "Start region must be a valid region");
   guarantee(is_available(r->hrm_index()), "Trying to iterate starting from region %u which is not in the heap", r->hrm_index());
@@ -508,7 +592,33 @@ void HeapRegionManager::shrink_at(uint index, size_t num_regions) {
     assert(at(i)->is_free(), "Expected free region at index %u", i);
   }
 #endif
-  uncommit_regions(index, num_regions);
+  if (!G1UncommitConcurrently) {
+    uncommit_regions(index, num_regions);
+    return;
+  }
+
+  deactivate_regions(index, num_regions);
+
+  MutexLocker ml(G1Uncommit_lock, Mutex::_no_safepoint_check_flag);
+  _inactive_map.set_range(index, index + num_regions);
+  _num_inactive += (uint)num_regions;
+}
+
+uint HeapRegionManager::uncommit_inactive_regions(uint limit) {
+  MutexLocker ml(G1Uncommit_lock, Mutex::_no_safepoint_check_flag);
+  if (_num_inactive == 0) {
+    return 0;
+  }
+
+  uint start = (uint)_inactive_map.get_next_one_offset(0);
+  uint end = (uint)_inactive_map.get_next_zero_offset(start);
+  uint num_regions = MIN2(end - start, limit);
+
+  _inactive_map.clear_range(start, start + num_regions);
+  _num_inactive -= num_regions;
+  uncommit_memory(start, num_regions);
+
+  return num_regions;
 }
 
 uint HeapRegionManager::find_empty_from_idx_reverse(uint start_idx, uint* res_idx) const {
@@ -557,6 +667,7 @@ void HeapRegionManager::verify() {
       continue;
     }
     num_committed++;
+    guarantee(!_inactive_map.at(i), "invariant: i: %u is both available and inactive", i);
     HeapRegion* hr = _regions.get_by_index(i);
     guarantee(hr != NULL, "invariant: i: %u", i);
     guarantee(!prev_committed || hr->bottom() == prev_end,
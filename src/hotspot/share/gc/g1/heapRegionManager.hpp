@@ -66,6 +66,14 @@ class G1HeapRegionTable : public G1BiasedMappedArray<HeapRegion*> {
 //   number of regions+1 for which we have HeapRegions.
 // * max_length() returns the maximum number of regions the heap can have.
 //
+// With G1UncommitConcurrently, shrinking the heap only deactivates the
+// regions: they are no longer available, but their memory stays committed
+// until the G1 service thread uncommits it, a chunk at a time. Expanding
+// the heap reuses inactive regions without committing them again.
+// G1Uncommit_lock serializes the commit and uncommit of memory between the
+// two. Pauses may have to wait for the service thread to finish the chunk it
+// is uncommitting, which G1UncommitChunkSize bounds.
+//
 
 class HeapRegionManager: public CHeapObj<mtGC> {
   friend class VMStructs;
@@ -79,9 +87,17 @@ class HeapRegionManager: public CHeapObj<mtGC> {
   // for allocation.
   CHeapBitMap _available_map;
 
+  // Each bit in this bitmap indicates that the corresponding region has been
+  // removed from the heap, but its memory has not been uncommitted yet.
+  // Protected by G1Uncommit_lock.
+  CHeapBitMap _inactive_map;
+
    // The number of regions committed in the heap.
   uint _num_committed;
 
+  // The number of inactive regions.
+  volatile uint _num_inactive;
+
   // Internal only. The highest heap region +1 we allocated a HeapRegion instance for.
   uint _allocated_heapregions_length;
 
@@ -90,6 +106,13 @@ class HeapRegionManager: public CHeapObj<mtGC> {
 
   // Pass down commit calls to the VirtualSpace.
   void commit_regions(uint index, size_t num_regions = 1, WorkGang* pretouch_gang = NULL);
+  // Pass down uncommit calls to the VirtualSpace.
+  void uncommit_memory(uint index, size_t num_regions);
+
+  // Commit the given regions, or reactivate those of them that are inactive.
+  void commit_or_reactivate_regions(uint index, uint num_regions, WorkGang* pretouch_gang);
+  // Remove the given regions from the heap without uncommitting their memory.
+  void deactivate_regions(uint index, size_t num_regions);
 
   // Notify other data structures about change in the heap layout.
   void update_committed_space(HeapWord* old_end, HeapWord* new_end);
@@ -97,7 +120,10 @@ class HeapRegionManager: public CHeapObj<mtGC> {
   // Find a contiguous set of empty or uncommitted regions of length num and return
   // the index of the first region or G1_NO_HRM_INDEX if the search was unsuccessful.
   // If only_empty is true, only empty regions are considered.
-  // Searches from bottom to top of the heap, doing a first-fit.
+  // Searches from bottom to top of the heap, doing a best-fit: the shortest
+  // sequence that is long enough, the lowest one of them if there are several.
+  // Leaving the longer sequences alone keeps them available for larger
+  // humongous objects.
   uint find_contiguous(size_t num, bool only_empty);
   // Finds the next sequence of unavailable regions starting from start_idx. Returns the
   // length of the sequence found. If this result is zero, no such sequence could be found,
@@ -237,6 +263,9 @@ public:
   // start index of that set, or G1_NO_HRM_INDEX.
   virtual uint find_contiguous_empty_or_unavailable(size_t num) { return find_contiguous(num, false); }
 
+  // Returns the length of the longest sequence of empty regions.
+  uint max_contiguous_empty_length() const;
+
   HeapRegion* next_region_in_heap(const HeapRegion* r) const;
 
   // Find the highest free or uncommitted region in the reserved heap,
@@ -263,6 +292,14 @@ public:
   // empty, and free.
   void shrink_at(uint index, size_t num_regions);
 
+  // Return true if there are regions whose memory still needs to be uncommitted.
+  bool has_inactive_regions() const { return _num_inactive > 0; }
+
+  // Uncommit the memory of at most limit inactive regions. Called
+  // concurrently by the G1 service thread. Returns the number of regions
+  // uncommitted.
+  uint uncommit_inactive_regions(uint limit);
+
   virtual void verify();
 
   // Do some sanity checking.
@@ -75,7 +75,8 @@ OtherRegionsTable::OtherRegionsTable(Mutex* m) :
   _first_all_fine_prts(NULL),
   _last_all_fine_prts(NULL),
   _fine_eviction_start(0),
-  _sparse_table()
+  _sparse_table(),
+  _medium_table(NULL)
 {
   typedef PerRegionTable* PerRegionTablePtr;
 
@@ -194,7 +195,8 @@ void OtherRegionsTable::add_reference(OopOrNarrowOopStar from, uint tid) {
 
       CardIdx_t card_index = card_within_region(from, from_hr);
 
-      if (_sparse_table.add_card(from_hrm_ind, card_index)) {
+      SparsePRT* overflowed = add_card_to_sparse(from_hrm_ind, card_index);
+      if (overflowed == NULL) {
         assert(contains_reference_locked(from), "We just added " PTR_FORMAT " to the Sparse table", p2i(from));
         return;
       }
@@ -223,14 +225,14 @@ void OtherRegionsTable::add_reference(OopOrNarrowOopStar from, uint tid) {
       _n_fine_entries++;
 
       // Transfer from sparse to fine-grain.
-      SparsePRTEntry *sprt_entry = _sparse_table.get_entry(from_hrm_ind);
+      SparsePRTEntry *sprt_entry = overflowed->get_entry(from_hrm_ind);
       assert(sprt_entry != NULL, "There should have been an entry");
       for (int i = 0; i < sprt_entry->num_valid_cards(); i++) {
         CardIdx_t c = sprt_entry->card(i);
         prt->add_card(c);
       }
       // Now we can delete the sparse entry.
-      bool res = _sparse_table.delete_entry(from_hrm_ind);
+      bool res = overflowed->delete_entry(from_hrm_ind);
       assert(res, "It should have been there.");
     }
     assert(prt != NULL && prt->hr() == from_hr, "consequence");
@@ -244,6 +246,40 @@ void OtherRegionsTable::add_reference(OopOrNarrowOopStar from, uint tid) {
   assert(contains_reference(from), "We just added " PTR_FORMAT " to the PRT (%d)", p2i(from), prt->contains_reference(from));
 }
 
+SparsePRT* OtherRegionsTable::add_card_to_sparse(RegionIdx_t region_ind, CardIdx_t card_index) {
+  assert(_m->owned_by_self(), "Precondition");
+  // A region is either in the sparse or in the medium table.
+  if (_medium_table != NULL && _medium_table->get_entry(region_ind) != NULL) {
+    return _medium_table->add_card(region_ind, card_index) ? NULL : _medium_table;
+  }
+
+  if (_sparse_table.add_card(region_ind, card_index)) {
+    return NULL;
+  }
+  if (!use_medium_table()) {
+    return &_sparse_table;
+  }
+
+  if (_medium_table == NULL) {
+    // Once allocated, the table stays for the lifetime of this remembered
+    // set, so that mem_size() can read it without holding _m.
+    Atomic::release_store(&_medium_table, new SparsePRT(G1RSetMediumRegionEntries));
+  }
+  // Transfer from sparse to medium.
+  SparsePRTEntry* sprt_entry = _sparse_table.get_entry(region_ind);
+  assert(sprt_entry != NULL, "There should have been an entry");
+  for (int i = 0; i < sprt_entry->num_valid_cards(); i++) {
+    bool added = _medium_table->add_card(region_ind, sprt_entry->card(i));
+    assert(added, "Medium entry must be larger than the sparse entry");
+  }
+  bool res = _sparse_table.delete_entry(region_ind);
+  assert(res, "It should have been there.");
+
+  bool added = _medium_table->add_card(region_ind, card_index);
+  assert(added, "Medium entry must be larger than the sparse entry");
+  return NULL;
+}
+
 PerRegionTable*
 OtherRegionsTable::find_region_table(size_t ind, HeapRegion* hr) const {
   assert(ind < _max_fine_entries, "Preconditions.");
@@ -356,7 +392,11 @@ size_t OtherRegionsTable::occ_coarse() const {
 }
 
 size_t OtherRegionsTable::occ_sparse() const {
-  return _sparse_table.occupied();
+  size_t sum = _sparse_table.occupied();
+  if (_medium_table != NULL) {
+    sum += _medium_table->occupied();
+  }
+  return sum;
 }
 
 size_t OtherRegionsTable::mem_size() const {
@@ -370,6 +410,10 @@ size_t OtherRegionsTable::mem_size() const {
   sum += (sizeof(PerRegionTable*) * _max_fine_entries);
   sum += (_coarse_map.size_in_words() * HeapWordSize);
   sum += (_sparse_table.mem_size());
+  SparsePRT* medium_table = Atomic::load_acquire(&_medium_table);
+  if (medium_table != NULL) {
+    sum += medium_table->mem_size();
+  }
   sum += sizeof(OtherRegionsTable) - sizeof(_sparse_table); // Avoid double counting above.
   return sum;
 }
@@ -394,6 +438,9 @@ void OtherRegionsTable::clear() {
 
   _first_all_fine_prts = _last_all_fine_prts = NULL;
   _sparse_table.clear();
+  if (_medium_table != NULL) {
+    _medium_table->clear();
+  }
   if (_n_coarse_entries > 0) {
     _coarse_map.clear();
   }
@@ -420,7 +467,8 @@ bool OtherRegionsTable::contains_reference_locked(OopOrNarrowOopStar from) const
 
   } else {
     CardIdx_t card_index = card_within_region(from, hr);
-    return _sparse_table.contains_card(hr_ind, card_index);
+    return _sparse_table.contains_card(hr_ind, card_index) ||
+           (_medium_table != NULL && _medium_table->contains_card(hr_ind, card_index));
   }
 }
 
@@ -450,6 +498,12 @@ void HeapRegionRemSet::setup_remset_size() {
   if (FLAG_IS_DEFAULT(G1RSetRegionEntries)) {
     G1RSetRegionEntries = G1RSetRegionEntriesBase * (region_size_log_mb + 1);
   }
+  if (FLAG_IS_DEFAULT(G1RSetMediumRegionEntries)) {
+    // Keep a medium entry at a quarter of the size of the card bitmap of a
+    // PerRegionTable at most.
+    size_t bitmap_limit = HeapRegion::CardsPerRegion / (BitsPerByte * sizeof(SparsePRTEntry::card_elem_t) * 4);
+    G1RSetMediumRegionEntries = MIN2((size_t)G1RSetSparseRegionEntries * G1RSetMediumRegionEntriesFactor, bitmap_limit);
+  }
   guarantee(G1RSetSparseRegionEntries > 0 && G1RSetRegionEntries > 0 , "Sanity");
 }
 
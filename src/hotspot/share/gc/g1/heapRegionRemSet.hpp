@@ -95,6 +95,14 @@ class OtherRegionsTable {
 
   SparsePRT   _sparse_table;
 
+  // Regions whose cards overflow their entry in the sparse table are moved
+  // to this table of larger entries before they get a PerRegionTable.  A
+  // medium entry needs only a fraction of the memory of a card bitmap, so
+  // most regions with a moderate number of references into this region never
+  // need a bitmap.  Allocated on first use and kept afterwards, so that it
+  // can be read without the lock; NULL if not used yet or disabled.
+  SparsePRT* volatile _medium_table;
+
   // These are static after init.
   static size_t _max_fine_entries;
   static size_t _mod_max_fine_entries_mask;
@@ -116,6 +124,17 @@ class OtherRegionsTable {
 
   bool contains_reference_locked(OopOrNarrowOopStar from) const;
 
+  static bool use_medium_table() {
+    return G1RSetMediumRegionEntries > G1RSetSparseRegionEntries;
+  }
+
+  // Adds the given card to the entry of the given region in the sparse or the
+  // medium table.  Returns NULL if the card is represented afterwards,
+  // otherwise the table whose entry for the region overflowed.  The caller
+  // must then transfer that entry to a PerRegionTable.  Requires the caller
+  // to hold _m.
+  SparsePRT* add_card_to_sparse(RegionIdx_t region_ind, CardIdx_t card_index);
+
   size_t occ_fine() const;
   size_t occ_coarse() const;
   size_t occ_sparse() const;
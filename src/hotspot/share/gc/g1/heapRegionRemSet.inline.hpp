@@ -92,6 +92,13 @@ void OtherRegionsTable::iterate(Closure& cl) {
       cl.next_sparse_prt(cur->r_ind(), cur->cards(), cur->num_valid_cards());
     }
   }
+  if (_medium_table != NULL) {
+    SparsePRTBucketIter iter(_medium_table);
+    SparsePRTEntry* cur;
+    while (iter.has_next(cur)) {
+      cl.next_sparse_prt(cur->r_ind(), cur->cards(), cur->num_valid_cards());
+    }
+  }
 }
 
 #endif // SHARE_VM_GC_G1_HEAPREGIONREMSET_INLINE_HPP
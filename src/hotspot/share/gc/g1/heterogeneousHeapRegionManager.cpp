@@ -29,7 +29,9 @@
 #include "gc/g1/heapRegionManager.inline.hpp"
 #include "gc/g1/heapRegionSet.inline.hpp"
 #include "gc/g1/heterogeneousHeapRegionManager.hpp"
+#include "logging/log.hpp"
 #include "memory/allocation.hpp"
+#include "runtime/atomic.hpp"
 
 
 HeterogeneousHeapRegionManager* HeterogeneousHeapRegionManager::manager() {
@@ -49,6 +51,14 @@ void HeterogeneousHeapRegionManager::initialize(G1RegionToSpaceMapper* heap_stor
                                                 G1RegionToSpaceMapper* card_counts) {
   HeapRegionManager::initialize(heap_storage, prev_bitmap, next_bitmap, bot, cardtable, card_counts);
 
+  if (G1HotOldRegionThreshold > 0) {
+    uint num_slots = (uint)_regions.length();
+    _access_temperature = NEW_C_HEAP_ARRAY(volatile uint, num_slots, mtGC);
+    for (uint i = 0; i < num_slots; i++) {
+      _access_temperature[i] = 0;
+    }
+  }
+
   // We commit bitmap for all regions during initialization and mark the bitmap space as special.
   // This allows regions to be un-committed while concurrent-marking threads are accessing the bitmap concurrently.
   _prev_bitmap_mapper->commit_and_set_special();
@@ -274,9 +284,35 @@ HeapRegion* HeterogeneousHeapRegionManager::allocate_free_region(HeapRegionType
     }
   }
 
+  // Old regions go to dram while the current pause evacuates hot old regions, see select_old_gc_alloc_memory().
+  if (type.is_old() && _old_dram_regions_left > 0) {
+    HeapRegion* hr = allocate_free_region_in(false /* from_nvdimm */);
+    if (hr != NULL) {
+      _old_dram_regions_left--;
+      return hr;
+    }
+  }
+
   // old and humongous regions are allocated from nv-dimm; eden and survivor regions are allocated from dram
   // assumption: dram regions take higher indexes
   bool from_nvdimm = (type.is_old() || type.is_humongous()) ? true : false;
+  HeapRegion* hr = allocate_free_region_in(from_nvdimm);
+
+  // When an old region is requested (which happens during collection pause) and we can't find any empty region
+  // in the set of available regions (which is an evacuation failure scenario), we borrow (or pre-allocate) an unavailable region
+  // from nv-dimm. This region is used to evacuate surviving objects from eden, survivor or old.
+  if(hr == NULL && type.is_old()) {
+    hr = borrow_old_region_for_gc();
+  }
+
+  if (hr != NULL) {
+    assert(hr->next() == NULL, "Single region should not have next");
+    assert(is_available(hr->hrm_index()), "Must be committed");
+  }
+  return hr;
+}
+
+HeapRegion* HeterogeneousHeapRegionManager::allocate_free_region_in(bool from_nvdimm) {
   bool from_head = from_nvdimm;
   HeapRegion* hr = _free_list.remove_region(from_head);
 
@@ -310,19 +346,52 @@ HeapRegion* HeterogeneousHeapRegionManager::allocate_free_region(HeapRegionType
 #ifdef ASSERT
   assert(total_committed_before == total_regions_committed(), "invariant not met");
 #endif
+  return hr;
+}
 
-  // When an old region is requested (which happens during collection pause) and we can't find any empty region
-  // in the set of available regions (which is an evacuation failure scenario), we borrow (or pre-allocate) an unavailable region
-  // from nv-dimm. This region is used to evacuate surviving objects from eden, survivor or old.
-  if(hr == NULL && type.is_old()) {
-    hr = borrow_old_region_for_gc();
+void HeterogeneousHeapRegionManager::record_access(uint index) {
+  assert(_access_temperature != NULL, "Access temperature is not tracked");
+  Atomic::inc(&_access_temperature[index]);
+}
+
+void HeterogeneousHeapRegionManager::decay_access_temperature() {
+  if (_access_temperature == NULL) {
+    return;
+  }
+  for (uint i = 0; i < (uint)_regions.length(); i++) {
+    _access_temperature[i] /= 2;
   }
+}
 
-  if (hr != NULL) {
-    assert(hr->next() == NULL, "Single region should not have next");
-    assert(is_available(hr->hrm_index()), "Must be committed");
+bool HeterogeneousHeapRegionManager::is_hot(uint index) const {
+  return _access_temperature != NULL && _access_temperature[index] >= G1HotOldRegionThreshold;
+}
+
+uint HeterogeneousHeapRegionManager::num_old_regions_in_dram() const {
+  uint count = 0;
+  for (uint i = start_index_of_dram(); i <= end_index_of_dram(); i++) {
+    if (is_available(i) && at(i)->is_old()) {
+      count++;
+    }
   }
-  return hr;
+  return count;
+}
+
+void HeterogeneousHeapRegionManager::select_old_gc_alloc_memory(uint num_old_regions, uint num_hot_regions) {
+  _old_dram_regions_left = 0;
+  if (_access_temperature == NULL || num_hot_regions == 0 || num_hot_regions * 2 < num_old_regions) {
+    return;
+  }
+
+  uint max_old_dram_regions = (uint)(_max_regions * G1HotOldDramPercent / 100);
+  uint old_dram_regions = num_old_regions_in_dram();
+  if (old_dram_regions < max_old_dram_regions) {
+    // Evacuating the hot regions takes at most as many regions as they occupy now.
+    _old_dram_regions_left = MIN2(max_old_dram_regions - old_dram_regions, num_hot_regions);
+  }
+  log_debug(gc, ergo, heap)("Hot old regions: " UINT32_FORMAT " of " UINT32_FORMAT " old collection set regions, "
+                            "up to " UINT32_FORMAT " old regions in dram (" UINT32_FORMAT " already)",
+                            num_hot_regions, num_old_regions, _old_dram_regions_left, old_dram_regions);
 }
 
 uint HeterogeneousHeapRegionManager::find_contiguous_only_empty(size_t num) {
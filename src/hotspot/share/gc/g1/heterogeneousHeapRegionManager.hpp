@@ -37,6 +37,9 @@
 //      3a. If more dram regions are needed (young generation expansion), corresponding number of regions in nv-dimm are un-committed.
 //      3b. When old generation or humongous set grows, and new regions need to be committed to nv-dimm, corresponding number of regions
 //            are un-committed in dram.
+// With G1HotOldRegionThreshold, the number of refined cards per region is sampled as the access temperature of old regions.
+// Pauses whose collection set mostly holds hot old regions copy the old objects into old regions in dram, up to G1HotOldDramPercent
+// of the heap. Other pauses copy them into nv-dimm, which is how cold old regions in dram move back to nv-dimm.
 class HeterogeneousHeapRegionManager : public HeapRegionManager {
   const uint _max_regions;
   uint _max_dram_regions;
@@ -45,6 +48,11 @@ class HeterogeneousHeapRegionManager : public HeapRegionManager {
   uint _total_commited_before_full_gc;
   uint _no_borrowed_regions;
 
+  // Refined card counts per region, see G1HotOldRegionThreshold.
+  volatile uint* _access_temperature;
+  // Number of old regions the current pause may still allocate in dram.
+  uint _old_dram_regions_left;
+
   uint total_regions_committed() const;
   uint num_committed_dram() const;
   uint num_committed_nvdimm() const;
@@ -80,6 +88,11 @@ class HeterogeneousHeapRegionManager : public HeapRegionManager {
   // It borrows a region from the set of unavailable regions in nv-dimm for GC purpose.
   HeapRegion* borrow_old_region_for_gc();
 
+  // Allocate a free region either from nv-dimm or from dram.
+  HeapRegion* allocate_free_region_in(bool from_nvdimm);
+
+  uint num_old_regions_in_dram() const;
+
   uint free_list_dram_length() const;
   uint free_list_nvdimm_length() const;
 
@@ -92,7 +105,8 @@ public:
   // Empty constructor, we'll initialize it with the initialize() method.
   HeterogeneousHeapRegionManager(uint num_regions) : _max_regions(num_regions), _max_dram_regions(0),
                                                      _max_nvdimm_regions(0), _start_index_of_nvdimm(0),
-                                                     _total_commited_before_full_gc(0), _no_borrowed_regions(0)
+                                                     _total_commited_before_full_gc(0), _no_borrowed_regions(0),
+                                                     _access_temperature(NULL), _old_dram_regions_left(0)
   {}
 
   static HeterogeneousHeapRegionManager* manager();
@@ -144,6 +158,18 @@ public:
 
   bool has_borrowed_regions() const;
 
+  // Sample an access to the region with the given index.
+  void record_access(uint index);
+  // Halve the access temperature of all regions.
+  void decay_access_temperature();
+  bool is_hot(uint index) const;
+
+  // Let the current pause allocate old regions in dram if its collection set
+  // mostly holds hot old regions.
+  void select_old_gc_alloc_memory(uint num_old_regions, uint num_hot_regions);
+  // Back to allocating old regions in nv-dimm only.
+  void clear_old_gc_alloc_memory() { _old_dram_regions_left = 0; }
+
   void verify();
 };
 
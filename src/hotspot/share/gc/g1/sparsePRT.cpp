@@ -41,7 +41,6 @@ void SparsePRTEntry::init(RegionIdx_t region_ind) {
   // Choose a large SparsePRTEntry::card_elem_t (e.g. CardIdx_t) if required.
   assert(((size_t)1 << (sizeof(SparsePRTEntry::card_elem_t) * BitsPerByte)) *
          G1CardTable::card_size >= HeapRegionBounds::max_size(), "precondition");
-  assert(G1RSetSparseRegionEntries > 0, "precondition");
   _region_ind = region_ind;
   _next_index = RSHashTable::NullEntry;
   _next_null = 0;
@@ -56,13 +55,13 @@ bool SparsePRTEntry::contains_card(CardIdx_t card_index) const {
   return false;
 }
 
-SparsePRTEntry::AddCardResult SparsePRTEntry::add_card(CardIdx_t card_index) {
+SparsePRTEntry::AddCardResult SparsePRTEntry::add_card(CardIdx_t card_index, int cards_num) {
   for (int i = 0; i < num_valid_cards(); i++) {
     if (card(i) == card_index) {
       return found;
     }
   }
-  if (num_valid_cards() < cards_num() - 1) {
+  if (num_valid_cards() < cards_num - 1) {
     _cards[_next_null] = (card_elem_t)card_index;
     _next_null++;
     return added;
@@ -72,13 +71,12 @@ SparsePRTEntry::AddCardResult SparsePRTEntry::add_card(CardIdx_t card_index) {
 }
 
 void SparsePRTEntry::copy_cards(card_elem_t* cards) const {
-  memcpy(cards, _cards, cards_num() * sizeof(card_elem_t));
+  memcpy(cards, _cards, num_valid_cards() * sizeof(card_elem_t));
 }
 
 void SparsePRTEntry::copy_cards(SparsePRTEntry* e) const {
   copy_cards(e->_cards);
   assert(_next_null >= 0, "invariant");
-  assert(_next_null <= cards_num(), "invariant");
   e->_next_null = _next_null;
 }
 
@@ -86,19 +84,21 @@ void SparsePRTEntry::copy_cards(SparsePRTEntry* e) const {
 
 float RSHashTable::TableOccupancyFactor = 0.5f;
 
-RSHashTable::RSHashTable(size_t capacity) :
+RSHashTable::RSHashTable(size_t capacity, int cards_num) :
   _num_entries(0),
   _capacity(capacity),
   _capacity_mask(capacity-1),
   _occupied_entries(0),
   _occupied_cards(0),
+  _cards_num(cards_num),
   _entries(NULL),
   _buckets(NEW_C_HEAP_ARRAY(int, capacity, mtGC)),
   _free_region(0),
   _free_list(NullEntry)
 {
+  assert(cards_num > 1, "precondition");
   _num_entries = (capacity * TableOccupancyFactor) + 1;
-  _entries = (SparsePRTEntry*)NEW_C_HEAP_ARRAY(char, _num_entries * SparsePRTEntry::size(), mtGC);
+  _entries = (SparsePRTEntry*)NEW_C_HEAP_ARRAY(char, _num_entries * SparsePRTEntry::size(_cards_num), mtGC);
   clear();
 }
 
@@ -117,7 +117,7 @@ void RSHashTable::clear() {
                 "_capacity too large");
 
   // This will put -1 == NullEntry in the key field of all entries.
-  memset((void*)_entries, NullEntry, _num_entries * SparsePRTEntry::size());
+  memset((void*)_entries, NullEntry, _num_entries * SparsePRTEntry::size(_cards_num));
   memset((void*)_buckets, NullEntry, _capacity * sizeof(int));
   _free_list = NullEntry;
   _free_region = 0;
@@ -127,7 +127,7 @@ bool RSHashTable::add_card(RegionIdx_t region_ind, CardIdx_t card_index) {
   SparsePRTEntry* e = entry_for_region_ind_create(region_ind);
   assert(e != NULL && e->r_ind() == region_ind,
          "Postcondition of call above.");
-  SparsePRTEntry::AddCardResult res = e->add_card(card_index);
+  SparsePRTEntry::AddCardResult res = e->add_card(card_index, _cards_num);
   if (res == SparsePRTEntry::added) _occupied_cards++;
   assert(e->num_valid_cards() > 0, "Postcondition");
   return res != SparsePRTEntry::overflow;
@@ -207,6 +207,7 @@ void RSHashTable::free_entry(int fi) {
 
 void RSHashTable::add_entry(SparsePRTEntry* e) {
   assert(e->num_valid_cards() > 0, "Precondition.");
+  assert(e->num_valid_cards() < _cards_num, "Entry must fit.");
   SparsePRTEntry* e2 = entry_for_region_ind_create(e->r_ind());
   e->copy_cards(e2);
   _occupied_cards += e2->num_valid_cards();
@@ -288,13 +289,15 @@ bool RSHashTable::contains_card(RegionIdx_t region_index, CardIdx_t card_index)
 
 size_t RSHashTable::mem_size() const {
   return sizeof(RSHashTable) +
-    _num_entries * (SparsePRTEntry::size() + sizeof(int));
+    _num_entries * (SparsePRTEntry::size(_cards_num) + sizeof(int));
 }
 
 // ----------------------------------------------------------------------
 
-SparsePRT::SparsePRT() :
-  _table(new RSHashTable(InitialCapacity)) {
+SparsePRT::SparsePRT(intx max_entries) :
+  _table(NULL),
+  _cards_num(SparsePRTEntry::cards_num(max_entries)) {
+  _table = new RSHashTable(InitialCapacity, _cards_num);
 }
 
 
@@ -328,7 +331,7 @@ void SparsePRT::clear() {
   // If the entry table is not at initial capacity, just create a new one.
   if (_table->capacity() != InitialCapacity) {
     delete _table;
-    _table = new RSHashTable(InitialCapacity);
+    _table = new RSHashTable(InitialCapacity, _cards_num);
   } else {
     _table->clear();
   }
@@ -336,7 +339,7 @@ void SparsePRT::clear() {
 
 void SparsePRT::expand() {
   RSHashTable* last = _table;
-  _table = new RSHashTable(last->capacity() * 2);
+  _table = new RSHashTable(last->capacity() * 2, _cards_num);
   for (size_t i = 0; i < last->num_entries(); i++) {
     SparsePRTEntry* e = last->entry((int)i);
     if (e->valid_entry()) {
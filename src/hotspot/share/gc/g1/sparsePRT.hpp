@@ -60,11 +60,17 @@ private:
   // Copy the current entry's cards into "cards".
   inline void copy_cards(card_elem_t* cards) const;
 public:
-  // Returns the size of the entry, used for entry allocation.
-  static size_t size() { return sizeof(SparsePRTEntry) + sizeof(card_elem_t) * (cards_num() - card_array_alignment); }
-  // Returns the size of the card array.
+  // Returns the size of an entry with the given card array size, used for
+  // entry allocation.
+  static size_t size(int cards_num) { return sizeof(SparsePRTEntry) + sizeof(card_elem_t) * (cards_num - card_array_alignment); }
+  // Returns the size of the card array for entries holding up to the given
+  // number of cards.
+  static int cards_num(intx max_entries) {
+    return align_up((int)max_entries, (int)card_array_alignment);
+  }
+  // Returns the size of the card array of the default sparse table.
   static int cards_num() {
-    return align_up((int)G1RSetSparseRegionEntries, (int)card_array_alignment);
+    return cards_num(G1RSetSparseRegionEntries);
   }
 
   // Set the region_ind to the given value, and delete all cards.
@@ -87,12 +93,13 @@ public:
   // Requires that the entry not contain the given card index.  If there is
   // space available, add the given card index to the entry and return
   // "true"; otherwise, return "false" to indicate that the entry is full.
+  // The card array of the entry has "cards_num" elements.
   enum AddCardResult {
     overflow,
     found,
     added
   };
-  inline AddCardResult add_card(CardIdx_t card_index);
+  inline AddCardResult add_card(CardIdx_t card_index, int cards_num);
 
   // Copy the current entry's cards into the "_card" array of "e."
   inline void copy_cards(SparsePRTEntry* e) const;
@@ -101,7 +108,7 @@ public:
 
   inline CardIdx_t card(int i) const {
     assert(i >= 0, "must be nonnegative");
-    assert(i < cards_num(), "range checking");
+    assert(i < num_valid_cards(), "range checking");
     return (CardIdx_t)_cards[i];
   }
 };
@@ -121,6 +128,9 @@ class RSHashTable : public CHeapObj<mtGC> {
   size_t _occupied_entries;
   size_t _occupied_cards;
 
+  // Size of the card array of the entries.
+  int    _cards_num;
+
   SparsePRTEntry* _entries;
   int* _buckets;
   int  _free_region;
@@ -140,7 +150,7 @@ class RSHashTable : public CHeapObj<mtGC> {
   void free_entry(int fi);
 
 public:
-  RSHashTable(size_t capacity);
+  RSHashTable(size_t capacity, int cards_num);
   ~RSHashTable();
 
   static const int NullEntry = -1;
@@ -172,10 +182,11 @@ public:
   size_t mem_size() const;
   // The number of SparsePRTEntry instances available.
   size_t num_entries() const { return _num_entries; }
+  int cards_num() const { return _cards_num; }
 
   SparsePRTEntry* entry(int i) const {
     assert(i >= 0 && (size_t)i < _num_entries, "precondition");
-    return (SparsePRTEntry*)((char*)_entries + SparsePRTEntry::size() * i);
+    return (SparsePRTEntry*)((char*)_entries + SparsePRTEntry::size(_cards_num) * i);
   }
 
   void print();
@@ -188,7 +199,7 @@ class RSHashTableIter {
 
   int _tbl_ind;         // [-1, 0.._rsht->_capacity)
   int _bl_ind;          // [-1, 0.._rsht->_capacity)
-  short _card_ind;      // [0..SparsePRTEntry::cards_num())
+  short _card_ind;      // [0.._rsht->cards_num())
   RSHashTable* _rsht;
 
   // If the bucket list pointed to by _bl_ind contains a card, sets
@@ -206,7 +217,7 @@ public:
   RSHashTableIter(RSHashTable* rsht) :
     _tbl_ind(RSHashTable::NullEntry), // So that first increment gets to 0.
     _bl_ind(RSHashTable::NullEntry),
-    _card_ind((SparsePRTEntry::cards_num() - 1)),
+    _card_ind((rsht->cards_num() - 1)),
     _rsht(rsht) {}
 
   bool has_next(size_t& card_index);
@@ -232,18 +243,22 @@ public:
 
 class SparsePRTIter;
 
-class SparsePRT {
+class SparsePRT : public CHeapObj<mtGC> {
   friend class SparsePRTIter;
   friend class SparsePRTBucketIter;
 
   RSHashTable* _table;
+  // Size of the card array of the entries of this table.
+  const int    _cards_num;
 
   static const size_t InitialCapacity = 8;
 
   void expand();
 
 public:
-  SparsePRT();
+  // Create a sparse table whose entries keep up to "max_entries" cards per
+  // region.
+  SparsePRT(intx max_entries = G1RSetSparseRegionEntries);
   ~SparsePRT();
 
   size_t occupied() const { return _table->occupied_cards(); }
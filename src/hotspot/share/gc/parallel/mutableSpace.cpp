@@ -24,6 +24,8 @@
 
 #include "precompiled.hpp"
 #include "gc/parallel/mutableSpace.hpp"
+#include "gc/parallel/parallelScavengeHeap.hpp"
+#include "gc/shared/pretouchTask.hpp"
 #include "gc/shared/spaceDecorator.inline.hpp"
 #include "memory/iterator.inline.hpp"
 #include "memory/universe.hpp"
@@ -61,7 +63,10 @@ void MutableSpace::numa_setup_pages(MemRegion mr, bool clear_space) {
 }
 
 void MutableSpace::pretouch_pages(MemRegion mr) {
-  os::pretouch_memory(mr.start(), mr.end());
+  ParallelScavengeHeap* heap = ParallelScavengeHeap::heap();
+  // Spread the work over the GC workers unless we are one of them already.
+  WorkGang* pretouch_gang = Thread::current()->is_GC_task_thread() ? NULL : &heap->workers();
+  PretouchTask::pretouch("ParallelGC PreTouch", (char*)mr.start(), (char*)mr.end(), heap->page_size(), pretouch_gang);
 }
 
 void MutableSpace::initialize(MemRegion mr,
@@ -72,6 +72,13 @@ jint ParallelScavengeHeap::initialize() {
                        heap_rs.base(),
                        heap_rs.size());
 
+  // The reservation falls back to small pages if large pages can neither be
+  // committed later nor be reserved up front.
+  _page_size = os::vm_page_size();
+  if (UseLargePages && (os::can_commit_large_page_memory() || heap_rs.special())) {
+    _page_size = MIN2(heap_rs.alignment(), os::large_page_size());
+  }
+
   initialize_reserved_region(heap_rs);
 
   PSCardTable* card_table = new PSCardTable(heap_rs.region());
@@ -80,6 +87,10 @@ jint ParallelScavengeHeap::initialize() {
   barrier_set->initialize();
   BarrierSet::set_barrier_set(barrier_set);
 
+  // Set up WorkGang. This is done before the generations are made up so that
+  // the workers can be used to pre-touch the initial heap.
+  _workers.initialize_workers();
+
   // Make up the generations
   // Calculate the maximum size that a generation can grow.  This
   // includes growth into the other generation.  Note that the
@@ -119,9 +130,6 @@ jint ParallelScavengeHeap::initialize() {
     return JNI_ENOMEM;
   }
 
-  // Set up WorkGang
-  _workers.initialize_workers();
-
   return JNI_OK;
 }
 
@@ -532,6 +540,37 @@ void ParallelScavengeHeap::object_iterate(ObjectClosure* cl) {
   old_gen()->object_iterate(cl);
 }
 
+// The young gen spaces have no object start array and are visited by the
+// first worker; all workers claim blocks of the old gen.
+class PSParallelObjectIterator : public ParallelObjectIterator {
+private:
+  ParallelScavengeHeap* _heap;
+  volatile size_t       _claimed_index;
+  size_t                _num_blocks;
+
+public:
+  PSParallelObjectIterator() :
+      _heap(ParallelScavengeHeap::heap()),
+      _claimed_index(0),
+      _num_blocks(ParallelScavengeHeap::old_gen()->num_iterable_blocks()) {}
+
+  virtual void object_iterate(ObjectClosure* cl, uint worker_id) {
+    if (worker_id == 0) {
+      _heap->young_gen()->object_iterate(cl);
+    }
+    PSOldGen* old_gen = _heap->old_gen();
+    for (size_t index = Atomic::add(&_claimed_index, (size_t)1) - 1;
+         index < _num_blocks;
+         index = Atomic::add(&_claimed_index, (size_t)1) - 1) {
+      old_gen->object_iterate_block(cl, index);
+    }
+  }
+};
+
+ParallelObjectIterator* ParallelScavengeHeap::parallel_object_iterator(uint thread_num) {
+  return new PSParallelObjectIterator();
+}
+
 
 HeapWord* ParallelScavengeHeap::block_start(const void* addr) const {
   if (young_gen()->is_in_reserved(addr)) {
@@ -77,6 +77,9 @@ class ParallelScavengeHeap : public CollectedHeap {
 
   WorkGang _workers;
 
+  // The page size the heap has actually been reserved with.
+  size_t _page_size;
+
   virtual void initialize_serviceability();
 
   void trace_heap(GCWhen::Type when, const GCTracer* tracer);
@@ -102,7 +105,8 @@ class ParallelScavengeHeap : public CollectedHeap {
     _workers("GC Thread",
              ParallelGCThreads,
              true /* are_GC_task_threads */,
-             false /* are_ConcurrentGC_threads */) { }
+             false /* are_ConcurrentGC_threads */),
+    _page_size(0) { }
 
   // For use by VM operations
   enum CollectionType {
@@ -137,6 +141,8 @@ class ParallelScavengeHeap : public CollectedHeap {
 
   AdjoiningGenerations* gens() { return _gens; }
 
+  size_t page_size() const { return _page_size; }
+
   // Returns JNI_OK on success
   virtual jint initialize();
 
@@ -213,6 +219,7 @@ class ParallelScavengeHeap : public CollectedHeap {
   size_t unsafe_max_tlab_alloc(Thread* thr) const;
 
   void object_iterate(ObjectClosure* cl);
+  virtual ParallelObjectIterator* parallel_object_iterator(uint thread_num);
 
   HeapWord* block_start(const void* addr) const;
   bool block_is_obj(const HeapWord* addr) const;
@@ -262,6 +269,8 @@ class ParallelScavengeHeap : public CollectedHeap {
   WorkGang& workers() {
     return _workers;
   }
+
+  virtual WorkGang* get_safepoint_workers() { return &_workers; }
 };
 
 // Class that can be used to print information about the
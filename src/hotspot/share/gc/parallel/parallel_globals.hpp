@@ -72,6 +72,11 @@
           "Delay in scheduling GC workers (in milliseconds)")               \
                                                                             \
   product(bool, PSChunkLargeArrays, true,                                   \
-          "Process large arrays in chunks")
+          "Process large arrays in chunks")                                 \
+                                                                            \
+  experimental(bool, PSNUMALocalPromotion, false,                           \
+          "With UseNUMA, bind the fresh pages of old generation promotion " \
+          "LABs to the NUMA node of the promoting GC worker, instead of "   \
+          "interleaving them across the nodes")
 
 #endif // SHARE_GC_PARALLEL_PARALLEL_GLOBALS_HPP
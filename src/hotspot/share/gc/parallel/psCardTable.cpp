@@ -242,9 +242,7 @@ void PSCardTable::scavenge_contents_parallel(ObjectStartArray* start_array,
     CardValue* current_card = worker_start_card;
     while (current_card < worker_end_card) {
       // Find an unclean card.
-      while (current_card < worker_end_card && card_is_clean(*current_card)) {
-        current_card++;
-      }
+      current_card = find_first_non_clean_card(current_card, worker_end_card);
       CardValue* first_unclean_card = current_card;
 
       // Find the end of a run of contiguous unclean cards
@@ -218,16 +218,10 @@ bool PSMarkSweep::invoke_no_policy(bool clear_all_softrefs) {
 
     mark_sweep_phase4();
 
-    restore_marks();
+    restore_marks(&heap->workers());
 
     deallocate_stacks();
 
-    if (ZapUnusedHeapArea) {
-      // Do a complete mangle (top to end) because the usage for
-      // scratch does not maintain a top pointer.
-      young_gen->to_space()->mangle_unused_area_complete();
-    }
-
     eden_empty = young_gen->eden_space()->is_empty();
     if (!eden_empty) {
       eden_empty = absorb_live_data_from_eden(size_policy, young_gen, old_gen);
@@ -250,7 +244,7 @@ bool PSMarkSweep::invoke_no_policy(bool clear_all_softrefs) {
     }
 
     // Delete metaspaces for unloaded class loaders and clean up loader_data graph
-    ClassLoaderDataGraph::purge();
+    ClassLoaderDataGraph::purge_or_defer();
     MetaspaceUtils::verify_metrics();
 
     BiasedLocking::restore_marks();
@@ -477,23 +471,13 @@ bool PSMarkSweep::absorb_live_data_from_eden(PSAdaptiveSizePolicy* size_policy,
 }
 
 void PSMarkSweep::allocate_stacks() {
-  ParallelScavengeHeap* heap = ParallelScavengeHeap::heap();
-  PSYoungGen* young_gen = heap->young_gen();
-
-  MutableSpace* to_space = young_gen->to_space();
-  _preserved_marks = (PreservedMark*)to_space->top();
-  _preserved_count = 0;
-
-  // We want to calculate the size in bytes first.
-  _preserved_count_max  = pointer_delta(to_space->end(), to_space->top(), sizeof(jbyte));
-  // Now divide by the size of a PreservedMark
-  _preserved_count_max /= sizeof(PreservedMark);
+  // One stack per worker, so that the workers can restore them in parallel.
+  allocate_preserved_marks(ParallelScavengeHeap::heap()->workers().total_workers());
 }
 
 
 void PSMarkSweep::deallocate_stacks() {
-  _preserved_mark_stack.clear(true);
-  _preserved_oop_stack.clear(true);
+  deallocate_preserved_marks();
   _marking_stack.clear();
   _objarray_stack.clear(true);
 }
@@ -37,6 +37,7 @@
 #include "logging/log.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/java.hpp"
+#include "runtime/safepoint.hpp"
 #include "utilities/align.hpp"
 
 inline const char* PSOldGen::select_name() {
@@ -47,7 +48,7 @@ PSOldGen::PSOldGen(ReservedSpace rs, size_t alignment,
                    size_t initial_size, size_t min_size, size_t max_size,
                    const char* perf_data_name, int level):
   _name(select_name()), _init_gen_size(initial_size), _min_gen_size(min_size),
-  _max_gen_size(max_size)
+  _max_gen_size(max_size), _numa_untouched_bottom(NULL)
 {
   initialize(rs, alignment, perf_data_name, level);
 }
@@ -56,7 +57,7 @@ PSOldGen::PSOldGen(size_t initial_size,
                    size_t min_size, size_t max_size,
                    const char* perf_data_name, int level):
   _name(select_name()), _init_gen_size(initial_size), _min_gen_size(min_size),
-  _max_gen_size(max_size)
+  _max_gen_size(max_size), _numa_untouched_bottom(NULL)
 {}
 
 void PSOldGen::initialize(ReservedSpace rs, size_t alignment,
@@ -148,6 +149,8 @@ void PSOldGen::initialize_work(const char* perf_data_name, int level) {
                              SpaceDecorator::Clear,
                              SpaceDecorator::Mangle);
 
+  _numa_untouched_bottom = AlwaysPreTouch ? object_space()->end() : object_space()->bottom();
+
 #if INCLUDE_SERIALGC
   _object_mark_sweep = new PSMarkSweepDecorator(_object_space, start_array(), MarkSweepDeadRatio);
 
@@ -339,6 +342,9 @@ void PSOldGen::shrink(size_t bytes) {
     virtual_space()->shrink_by(bytes);
     post_resize();
 
+    // Uncommitted pages are new when committed again.
+    _numa_untouched_bottom = MIN2(_numa_untouched_bottom, object_space()->end());
+
     size_t new_mem_size = virtual_space()->committed_size();
     size_t old_mem_size = new_mem_size + bytes;
     log_debug(gc)("Shrinking %s from " SIZE_FORMAT "K by " SIZE_FORMAT "K to " SIZE_FORMAT "K",
@@ -411,6 +417,24 @@ void PSOldGen::post_resize() {
     "Sanity");
 }
 
+void PSOldGen::update_numa_untouched_bottom() {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
+  // Everything below top has been allocated, and thus touched, before.
+  _numa_untouched_bottom = MAX2(_numa_untouched_bottom, object_space()->top());
+}
+
+void PSOldGen::numa_bias_promotion_lab(MemRegion mr) {
+  assert(UseNUMA && PSNUMALocalPromotion, "Only with NUMA local promotion");
+  // Only whole pages of the LAB are bound, so pages shared with the
+  // neighbouring LABs keep the interleaved placement of the old gen.
+  const size_t page_size = UseLargePages ? virtual_space()->alignment() : os::vm_page_size();
+  HeapWord* const start = align_up(MAX2(mr.start(), _numa_untouched_bottom), page_size);
+  HeapWord* const end = align_down(mr.end(), page_size);
+  if (end > start) {
+    os::numa_make_local((char*)start, pointer_delta(end, start, sizeof(char)), os::numa_get_group_id());
+  }
+}
+
 size_t PSOldGen::gen_size_limit() {
   return _max_gen_size;
 }
@@ -430,6 +454,40 @@ size_t PSOldGen::available_for_contraction() {
   return 0;
 }
 
+size_t PSOldGen::num_iterable_blocks() const {
+  return (object_space()->used_in_bytes() + IterateBlockSize - 1) / IterateBlockSize;
+}
+
+void PSOldGen::object_iterate_block(ObjectClosure* cl, size_t block_index) {
+  size_t block_word_size = IterateBlockSize / HeapWordSize;
+  assert((block_word_size % (ObjectStartArray::block_size)) == 0,
+         "Block size not a multiple of start_array block");
+
+  MutableSpace* space = object_space();
+
+  HeapWord* begin = space->bottom() + block_index * block_word_size;
+  HeapWord* end = MIN2(space->top(), begin + block_word_size);
+
+  if (!start_array()->object_starts_in_range(begin, end)) {
+    return;
+  }
+
+  // Get the object starting at or reaching into this block, and skip it if
+  // it started in the previous block.
+  HeapWord* start = start_array()->object_start(begin);
+  if (start < begin) {
+    start += oop(start)->size();
+  }
+  assert(start >= begin,
+         "Object address" PTR_FORMAT " must be larger or equal to block address at " PTR_FORMAT,
+         p2i(start), p2i(begin));
+
+  // Iterate all objects that start in this block.
+  for (HeapWord* p = start; p < end; p += oop(p)->size()) {
+    cl->do_object(oop(p));
+  }
+}
+
 void PSOldGen::print() const { print_on(tty);}
 void PSOldGen::print_on(outputStream* st) const {
   st->print(" %-15s", name());
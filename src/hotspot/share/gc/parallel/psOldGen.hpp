@@ -59,6 +59,10 @@ class PSOldGen : public CHeapObj<mtGC> {
   const size_t _min_gen_size;
   const size_t _max_gen_size;
 
+  // With PSNUMALocalPromotion, the committed pages at and above this address
+  // have not been touched yet, so their placement can still be chosen.
+  HeapWord*                _numa_untouched_bottom;
+
   // Used when initializing the _name field.
   static inline const char* select_name();
 
@@ -119,6 +123,13 @@ class PSOldGen : public CHeapObj<mtGC> {
 
   void post_resize();
 
+  // Bind the untouched pages of a promotion LAB to the NUMA node of the
+  // current (promoting) thread.
+  void numa_bias_promotion_lab(MemRegion mr);
+  // Called before a scavenge, to account for the pages touched since the
+  // last one.
+  void update_numa_untouched_bottom();
+
  public:
   // Initialize the generation.
   PSOldGen(ReservedSpace rs, size_t alignment,
@@ -195,6 +206,12 @@ class PSOldGen : public CHeapObj<mtGC> {
   void oop_iterate(OopIterateClosure* cl) { object_space()->oop_iterate(cl); }
   void object_iterate(ObjectClosure* cl) { object_space()->object_iterate(cl); }
 
+  // Parallel iteration works on blocks of IterateBlockSize bytes, found
+  // with the object start array.
+  static const size_t IterateBlockSize = 1024 * 1024;
+  size_t num_iterable_blocks() const;
+  void object_iterate_block(ObjectClosure* cl, size_t block_index);
+
   // Debugging - do not use for time critical operations
   virtual void print() const;
   virtual void print_on(outputStream* st) const;
@@ -1058,7 +1058,7 @@ void PSParallelCompact::post_compact()
   }
 
   // Delete metaspaces for unloaded class loaders and clean up loader_data graph
-  ClassLoaderDataGraph::purge();
+  ClassLoaderDataGraph::purge_or_defer();
   MetaspaceUtils::verify_metrics();
 
   heap->prune_scavengable_nmethods();
@@ -2641,6 +2641,47 @@ public:
   }
 };
 
+// Deferred objects are updated after all regions are filled.  Workers claim
+// chunks of regions from each space in turn, so that large objects that cross
+// region boundaries, e.g. big object arrays, are updated in parallel.
+class UpdateDeferredObjectsTask: public AbstractGangTask {
+  static const size_t RegionsPerClaim = 64;
+
+  size_t _beg_region[PSParallelCompact::last_space_id];
+  size_t _end_region[PSParallelCompact::last_space_id];
+  volatile size_t _claimed[PSParallelCompact::last_space_id];
+
+public:
+  UpdateDeferredObjectsTask() : AbstractGangTask("UpdateDeferredObjectsTask") {
+    const ParallelCompactData& sd = PSParallelCompact::summary_data();
+    for (unsigned int id = PSParallelCompact::old_space_id; id < PSParallelCompact::last_space_id; ++id) {
+      PSParallelCompact::SpaceId space_id = PSParallelCompact::SpaceId(id);
+      HeapWord* const beg_addr = PSParallelCompact::dense_prefix(space_id);
+      HeapWord* const end_addr = sd.region_align_up(PSParallelCompact::new_top(space_id));
+      assert(beg_addr >= PSParallelCompact::space(space_id)->bottom(), "dense_prefix not set");
+      _beg_region[id] = sd.addr_to_region_idx(beg_addr);
+      _end_region[id] = sd.addr_to_region_idx(end_addr);
+      _claimed[id] = _beg_region[id];
+    }
+  }
+
+  virtual void work(uint worker_id) {
+    ParCompactionManager* cm = ParCompactionManager::gc_thread_compaction_manager(worker_id);
+
+    for (unsigned int id = PSParallelCompact::old_space_id; id < PSParallelCompact::last_space_id; ++id) {
+      const size_t end = _end_region[id];
+      while (Atomic::load(&_claimed[id]) < end) {
+        const size_t beg = Atomic::add(&_claimed[id], RegionsPerClaim) - RegionsPerClaim;
+        if (beg >= end) {
+          break;
+        }
+        PSParallelCompact::update_deferred_objects(cm, PSParallelCompact::SpaceId(id),
+                                                   beg, MIN2(beg + RegionsPerClaim, end));
+      }
+    }
+  }
+};
+
 void PSParallelCompact::compact() {
   GCTraceTime(Info, gc, phases) tm("Compaction Phase", &_gc_timer);
 
@@ -2674,12 +2715,10 @@ void PSParallelCompact::compact() {
   }
 
   {
-    // Update the deferred objects, if any.  Any compaction manager can be used.
+    // Update the deferred objects, if any.
     GCTraceTime(Trace, gc, phases) tm("Deferred Updates", &_gc_timer);
-    ParCompactionManager* cm = ParCompactionManager::manager_array(0);
-    for (unsigned int id = old_space_id; id < last_space_id; ++id) {
-      update_deferred_objects(cm, SpaceId(id));
-    }
+    UpdateDeferredObjectsTask task;
+    ParallelScavengeHeap::heap()->workers().run_task(&task);
   }
 
   DEBUG_ONLY(write_block_fill_histogram());
@@ -2809,20 +2848,22 @@ PSParallelCompact::SpaceId PSParallelCompact::space_id(HeapWord* addr) {
 }
 
 void PSParallelCompact::update_deferred_objects(ParCompactionManager* cm,
-                                                SpaceId id) {
+                                                SpaceId id,
+                                                size_t beg_region_idx,
+                                                size_t end_region_idx) {
   assert(id < last_space_id, "bad space id");
 
   ParallelCompactData& sd = summary_data();
   const SpaceInfo* const space_info = _space_info + id;
   ObjectStartArray* const start_array = space_info->start_array();
 
-  const MutableSpace* const space = space_info->space();
-  assert(space_info->dense_prefix() >= space->bottom(), "dense_prefix not set");
-  HeapWord* const beg_addr = space_info->dense_prefix();
-  HeapWord* const end_addr = sd.region_align_up(space_info->new_top());
+  assert(beg_region_idx >= sd.addr_to_region_idx(space_info->dense_prefix()), "before dense prefix");
+  assert(end_region_idx <= sd.addr_to_region_idx(sd.region_align_up(space_info->new_top())), "after new top");
 
-  const RegionData* const beg_region = sd.addr_to_region_ptr(beg_addr);
-  const RegionData* const end_region = sd.addr_to_region_ptr(end_addr);
+  // Deferred objects in different regions start in different blocks of the
+  // start array, so concurrent allocate_block() calls do not interfere.
+  const RegionData* const beg_region = sd.region(beg_region_idx);
+  const RegionData* const end_region = sd.region(end_region_idx);
   const RegionData* cur_region;
   for (cur_region = beg_region; cur_region < end_region; ++cur_region) {
     HeapWord* const addr = cur_region->deferred_obj_addr();
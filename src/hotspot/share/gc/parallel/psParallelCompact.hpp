@@ -1190,8 +1190,11 @@ class PSParallelCompact : AllStatic {
   // Fill in the block table for the specified region.
   static void fill_blocks(size_t region_idx);
 
-  // Update the deferred objects in the space.
-  static void update_deferred_objects(ParCompactionManager* cm, SpaceId id);
+  // Update the deferred objects in the regions [beg_region, end_region) of
+  // the space.  Each region has at most one deferred object, so disjoint
+  // region ranges can be updated in parallel.
+  static void update_deferred_objects(ParCompactionManager* cm, SpaceId id,
+                                      size_t beg_region, size_t end_region);
 
   static ParMarkBitMap* mark_bitmap() { return &_mark_bitmap; }
   static ParallelCompactData& summary_data() { return _summary_data; }
@@ -107,6 +107,10 @@ void PSPromotionManager::pre_scavenge() {
   _preserved_marks_set->assert_empty();
   _young_space = heap->young_gen()->to_space();
 
+  if (UseNUMA && PSNUMALocalPromotion) {
+    heap->old_gen()->update_numa_untouched_bottom();
+  }
+
   for(uint i=0; i<ParallelGCThreads+1; i++) {
     manager_array(i)->reset();
   }
@@ -116,6 +120,7 @@ bool PSPromotionManager::post_scavenge(YoungGCTracer& gc_tracer) {
   bool promotion_failure_occurred = false;
 
   TASKQUEUE_STATS_ONLY(print_taskqueue_stats());
+  TASKQUEUE_STATS_ONLY(trace_taskqueue_stats(gc_tracer));
   for (uint i = 0; i < ParallelGCThreads + 1; i++) {
     PSPromotionManager* manager = manager_array(i);
     assert(manager->claimed_stack_depth()->is_empty(), "should be empty");
@@ -177,6 +182,15 @@ PSPromotionManager::print_taskqueue_stats() {
   }
 }
 
+void
+PSPromotionManager::trace_taskqueue_stats(YoungGCTracer& gc_tracer) {
+  TaskQueueStats totals;
+  for (uint i = 0; i < ParallelGCThreads + 1; ++i) {
+    totals += manager_array(i)->_claimed_stack_depth.stats;
+  }
+  gc_tracer.report_task_queue_stats("Scavenge", ParallelGCThreads + 1, totals);
+}
+
 void
 PSPromotionManager::reset_stats() {
   claimed_stack_depth()->stats.reset();
@@ -205,6 +219,8 @@ PSPromotionManager::PSPromotionManager() {
   }
 
   _array_chunk_size = ParGCArrayScanChunk;
+  // large arrays are scanned in up to 8x bigger chunks
+  _max_array_chunk_size = (uint) MIN2((size_t) _array_chunk_size * 8, (size_t) max_jint / 3);
   // let's choose 1.5x the chunk size
   _min_array_size_for_chunking = 3 * _array_chunk_size / 2;
 
@@ -313,6 +329,16 @@ template <class T> void PSPromotionManager::process_array_chunk_work(
   }
 }
 
+// The remainder of a chunked array is pushed back after every chunk, so
+// other workers can steal it. Scanning a very large array in chunks of
+// ParGCArrayScanChunk elements spends most of the time on these pushes and
+// pops. Use bigger chunks while enough of the array is left for every
+// worker to steal a few of them.
+int PSPromotionManager::array_chunk_size(int remaining) const {
+  int const chunk = remaining / (int) (4 * ParallelGCThreads);
+  return clamp(chunk, (int) _array_chunk_size, (int) _max_array_chunk_size);
+}
+
 void PSPromotionManager::process_array_chunk(oop old) {
   assert(PSChunkLargeArrays, "invariant");
   assert(old->is_objArray(), "invariant");
@@ -326,7 +352,7 @@ void PSPromotionManager::process_array_chunk(oop old) {
   int const end = arrayOop(old)->length();
   if (end > (int) _min_array_size_for_chunking) {
     // we'll chunk more
-    start = end - _array_chunk_size;
+    start = end - array_chunk_size(end);
     assert(start > 0, "invariant");
     arrayOop(old)->set_length(start);
     push_depth(mask_chunked_array_oop(old));
@@ -70,6 +70,7 @@ class PSPromotionManager {
 
   void print_local_stats(outputStream* const out, uint i) const;
   static void print_taskqueue_stats();
+  static void trace_taskqueue_stats(YoungGCTracer& gc_tracer);
 
   void reset_stats();
 #endif // TASKQUEUE_STATS
@@ -86,6 +87,7 @@ class PSPromotionManager {
   uint                                _target_stack_size;
 
   uint                                _array_chunk_size;
+  uint                                _max_array_chunk_size;
   uint                                _min_array_size_for_chunking;
 
   PreservedMarks*                     _preserved_marks;
@@ -141,6 +143,7 @@ class PSPromotionManager {
 
   template <class T> void  process_array_chunk_work(oop obj,
                                                     int start, int end);
+  int array_chunk_size(int remaining) const;
   void process_array_chunk(oop old);
 
   template <class T> void push_depth(T* p);
@@ -36,6 +36,7 @@
 #include "memory/iterator.inline.hpp"
 #include "oops/access.inline.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/prefetch.inline.hpp"
 
 inline PSPromotionManager* PSPromotionManager::manager_array(uint index) {
   assert(_manager_array != NULL, "access of NULL manager_array");
@@ -52,16 +53,16 @@ template <class T>
 inline void PSPromotionManager::claim_or_forward_internal_depth(T* p) {
   if (p != NULL) { // XXX: error if p != NULL here
     oop o = RawAccess<IS_NOT_NULL>::oop_load(p);
-    if (o->is_forwarded()) {
-      o = o->forwardee();
-      // Card mark
-      if (PSScavenge::is_obj_in_young(o)) {
-        PSScavenge::card_table()->inline_write_ref_field_gc(p, o);
-      }
-      RawAccess<IS_NOT_NULL>::oop_store(p, o);
-    } else {
-      push_depth(p);
-    }
+    // Checking whether the object is already forwarded would stall on the
+    // cache miss for its header. Prefetch the header instead (for write,
+    // since we might install the forwarding pointer) and push the location;
+    // copy_and_push_safe_barrier() deals with forwarded objects when the
+    // location is popped, and by then the header is likely in the cache.
+    // Since the stack is drained in LIFO order, the children of an object
+    // are usually copied right after it, next to it in the destination.
+    Prefetch::write(o->mark_addr_raw(), 0);
+    Prefetch::read(o->mark_addr_raw(), (HeapWordSize*2));
+    push_depth(p);
   }
 }
 
@@ -228,6 +229,9 @@ inline oop PSPromotionManager::copy_to_survivor_space(oop o) {
               }
 #endif
               _old_lab.initialize(MemRegion(lab_base, OldPLABSize));
+              if (UseNUMA && PSNUMALocalPromotion) {
+                old_gen()->numa_bias_promotion_lab(MemRegion(lab_base, OldPLABSize));
+              }
               // Try the old lab allocation again.
               new_obj = (oop) _old_lab.allocate(new_obj_size);
               promotion_trace_event(new_obj, o, new_obj_size, age, true, &_old_lab);
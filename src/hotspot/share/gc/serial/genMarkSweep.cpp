@@ -103,7 +103,7 @@ void GenMarkSweep::invoke_at_safepoint(ReferenceProcessor* rp, bool clear_all_so
 
   mark_sweep_phase4();
 
-  restore_marks();
+  restore_marks(NULL /* workers */);
 
   // Set saved marks for allocation profiler (and other things? -- dld)
   // (Should this be in general part?)
@@ -149,30 +149,13 @@ void GenMarkSweep::invoke_at_safepoint(ReferenceProcessor* rp, bool clear_all_so
 }
 
 void GenMarkSweep::allocate_stacks() {
-  GenCollectedHeap* gch = GenCollectedHeap::heap();
-  // Scratch request on behalf of old generation; will do no allocation.
-  ScratchBlock* scratch = gch->gather_scratch(gch->old_gen(), 0);
-
-  // $$$ To cut a corner, we'll only use the first scratch block, and then
-  // revert to malloc.
-  if (scratch != NULL) {
-    _preserved_count_max =
-      scratch->num_words * HeapWordSize / sizeof(PreservedMark);
-  } else {
-    _preserved_count_max = 0;
-  }
-
-  _preserved_marks = (PreservedMark*)scratch;
-  _preserved_count = 0;
+  // There are no workers to restore the marks in parallel.
+  allocate_preserved_marks(1);
 }
 
 
 void GenMarkSweep::deallocate_stacks() {
-  GenCollectedHeap* gch = GenCollectedHeap::heap();
-  gch->release_scratch();
-
-  _preserved_mark_stack.clear(true);
-  _preserved_oop_stack.clear(true);
+  deallocate_preserved_marks();
   _marking_stack.clear();
   _objarray_stack.clear(true);
 }
@@ -28,6 +28,7 @@
 #include "gc/shared/collectedHeap.inline.hpp"
 #include "gc/shared/gcTimer.hpp"
 #include "gc/shared/gcTrace.hpp"
+#include "gc/shared/preservedMarks.inline.hpp"
 #include "memory/iterator.inline.hpp"
 #include "memory/universe.hpp"
 #include "oops/access.inline.hpp"
@@ -48,11 +49,8 @@ uint                    MarkSweep::_total_invocations = 0;
 Stack<oop, mtGC>              MarkSweep::_marking_stack;
 Stack<ObjArrayTask, mtGC>     MarkSweep::_objarray_stack;
 
-Stack<oop, mtGC>              MarkSweep::_preserved_oop_stack;
-Stack<markWord, mtGC>         MarkSweep::_preserved_mark_stack;
+PreservedMarksSet*      MarkSweep::_preserved_marks_set = NULL;
 size_t                  MarkSweep::_preserved_count = 0;
-size_t                  MarkSweep::_preserved_count_max = 0;
-PreservedMark*          MarkSweep::_preserved_marks = NULL;
 ReferenceProcessor*     MarkSweep::_ref_processor   = NULL;
 STWGCTimer*             MarkSweep::_gc_timer        = NULL;
 SerialOldTracer*        MarkSweep::_gc_tracer       = NULL;
@@ -143,28 +141,21 @@ template <class T> inline void MarkSweep::follow_root(T* p) {
 void MarkSweep::FollowRootClosure::do_oop(oop* p)       { follow_root(p); }
 void MarkSweep::FollowRootClosure::do_oop(narrowOop* p) { follow_root(p); }
 
-void PreservedMark::adjust_pointer() {
-  MarkSweep::adjust_pointer(&_obj);
+void MarkSweep::allocate_preserved_marks(uint num_stacks) {
+  _preserved_marks_set->init(num_stacks);
+  _preserved_count = 0;
 }
 
-void PreservedMark::restore() {
-  _obj->set_mark_raw(_mark);
+void MarkSweep::deallocate_preserved_marks() {
+  _preserved_marks_set->reclaim();
 }
 
 // We preserve the mark which should be replaced at the end and the location
 // that it will go.  Note that the object that this markWord belongs to isn't
 // currently at that address but it will be after phase4
 void MarkSweep::preserve_mark(oop obj, markWord mark) {
-  // We try to store preserved marks in the to space of the new generation since
-  // this is storage which should be available.  Most of the time this should be
-  // sufficient space for the marks we need to preserve but if it isn't we fall
-  // back to using Stacks to keep track of the overflow.
-  if (_preserved_count < _preserved_count_max) {
-    _preserved_marks[_preserved_count++].init(obj, mark);
-  } else {
-    _preserved_mark_stack.push(mark);
-    _preserved_oop_stack.push(obj);
-  }
+  uint stack = (uint)((_preserved_count++ / preserved_marks_stripe_size) % _preserved_marks_set->num());
+  _preserved_marks_set->get(stack)->push(obj, mark);
 }
 
 void MarkSweep::set_ref_processor(ReferenceProcessor* rp) {
@@ -175,38 +166,15 @@ void MarkSweep::set_ref_processor(ReferenceProcessor* rp) {
 AdjustPointerClosure MarkSweep::adjust_pointer_closure;
 
 void MarkSweep::adjust_marks() {
-  assert( _preserved_oop_stack.size() == _preserved_mark_stack.size(),
-         "inconsistent preserved oop stacks");
-
   // adjust the oops we saved earlier
-  for (size_t i = 0; i < _preserved_count; i++) {
-    _preserved_marks[i].adjust_pointer();
-  }
-
-  // deal with the overflow stack
-  StackIterator<oop, mtGC> iter(_preserved_oop_stack);
-  while (!iter.is_empty()) {
-    oop* p = iter.next_addr();
-    adjust_pointer(p);
+  for (uint i = 0; i < _preserved_marks_set->num(); i++) {
+    _preserved_marks_set->get(i)->adjust_during_full_gc();
   }
 }
 
-void MarkSweep::restore_marks() {
-  assert(_preserved_oop_stack.size() == _preserved_mark_stack.size(),
-         "inconsistent preserved oop stacks");
-  log_trace(gc)("Restoring " SIZE_FORMAT " marks", _preserved_count + _preserved_oop_stack.size());
-
-  // restore the marks we saved earlier
-  for (size_t i = 0; i < _preserved_count; i++) {
-    _preserved_marks[i].restore();
-  }
-
-  // deal with the overflow
-  while (!_preserved_oop_stack.is_empty()) {
-    oop obj       = _preserved_oop_stack.pop();
-    markWord mark = _preserved_mark_stack.pop();
-    obj->set_mark_raw(mark);
-  }
+void MarkSweep::restore_marks(WorkGang* workers) {
+  SharedRestorePreservedMarksTaskExecutor task_executor(workers);
+  _preserved_marks_set->restore(&task_executor);
 }
 
 MarkSweep::IsAliveClosure   MarkSweep::is_alive;
@@ -221,4 +189,5 @@ void MarkSweep::KeepAliveClosure::do_oop(narrowOop* p) { MarkSweep::KeepAliveClo
 void MarkSweep::initialize() {
   MarkSweep::_gc_timer = new (ResourceObj::C_HEAP, mtGC) STWGCTimer();
   MarkSweep::_gc_tracer = new (ResourceObj::C_HEAP, mtGC) SerialOldTracer();
+  MarkSweep::_preserved_marks_set = new PreservedMarksSet(true /* in_c_heap */);
 }
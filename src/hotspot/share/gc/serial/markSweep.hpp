@@ -37,8 +37,10 @@
 
 class ReferenceProcessor;
 class DataLayout;
+class PreservedMarksSet;
 class SerialOldTracer;
 class STWGCTimer;
+class WorkGang;
 
 // MarkSweep takes care of global mark-compact garbage collection for a
 // GenCollectedHeap using a four-phase pointer forwarding algorithm.  All
@@ -48,7 +50,6 @@ class STWGCTimer;
 // Class unloading will only occur when a full gc is invoked.
 
 // declared at end
-class PreservedMark;
 class MarkAndPushClosure;
 class AdjustPointerClosure;
 
@@ -99,12 +100,12 @@ class MarkSweep : AllStatic {
   static Stack<oop, mtGC>                      _marking_stack;
   static Stack<ObjArrayTask, mtGC>             _objarray_stack;
 
-  // Space for storing/restoring mark word
-  static Stack<markWord, mtGC>                 _preserved_mark_stack;
-  static Stack<oop, mtGC>                      _preserved_oop_stack;
+  // Space for storing/restoring mark word. The marks are spread over the
+  // stacks of the set in stripes of preserved_marks_stripe_size entries, so
+  // that workers can restore them in parallel.
+  static PreservedMarksSet*              _preserved_marks_set;
   static size_t                          _preserved_count;
-  static size_t                          _preserved_count_max;
-  static PreservedMark*                  _preserved_marks;
+  static const size_t                    preserved_marks_stripe_size = 1024;
 
   // Reference processing (used in ...follow_contents)
   static ReferenceProcessor*             _ref_processor;
@@ -137,10 +138,17 @@ class MarkSweep : AllStatic {
   static STWGCTimer* gc_timer() { return _gc_timer; }
   static SerialOldTracer* gc_tracer() { return _gc_tracer; }
 
+  // Set up num_stacks stacks for the marks preserved during a collection,
+  // and release them at its end.
+  static void allocate_preserved_marks(uint num_stacks);
+  static void deallocate_preserved_marks();
+
   static void preserve_mark(oop p, markWord mark);
                                 // Save the mark word so it can be restored later
   static void adjust_marks();   // Adjust the pointers in the preserved marks table
-  static void restore_marks();  // Restore the marks that we saved in preserve_mark
+  static void restore_marks(WorkGang* workers);
+                                // Restore the marks that we saved in preserve_mark,
+                                // in parallel if workers is not NULL
 
   static int adjust_pointers(oop obj);
 
@@ -196,19 +204,4 @@ class AdjustPointerClosure: public BasicOopsInGenClosure {
   debug_only(virtual bool should_verify_oops() { return false; })
 };
 
-class PreservedMark {
-private:
-  oop _obj;
-  markWord _mark;
-
-public:
-  void init(oop obj, markWord mark) {
-    _obj = obj;
-    _mark = mark;
-  }
-
-  void adjust_pointer();
-  void restore();
-};
-
 #endif // SHARE_GC_SERIAL_MARKSWEEP_HPP
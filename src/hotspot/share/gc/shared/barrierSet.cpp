@@ -25,6 +25,7 @@
 #include "precompiled.hpp"
 #include "gc/shared/barrierSet.hpp"
 #include "gc/shared/barrierSetAssembler.hpp"
+#include "runtime/java.hpp"
 #include "runtime/thread.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/macros.hpp"
@@ -33,6 +34,12 @@ BarrierSet* BarrierSet::_barrier_set = NULL;
 
 void BarrierSet::set_barrier_set(BarrierSet* barrier_set) {
   assert(_barrier_set == NULL, "Already initialized");
+#ifdef HARDWIRED_BARRIER_SET
+  if (barrier_set->kind() != BarrierSet::HARDWIRED_BARRIER_SET) {
+    vm_exit_during_initialization("The selected GC cannot be used with this VM, it is built "
+                                  "with hardwired barriers for another GC");
+  }
+#endif
   _barrier_set = barrier_set;
 
   // Notify barrier set of the current (main) thread.  Normally the
@@ -43,6 +43,17 @@
   FOR_EACH_ABSTRACT_BARRIER_SET_DO(f) \
   FOR_EACH_CONCRETE_BARRIER_SET_DO(f)
 
+// The barrier set can be hardwired into the build, so that the runtime
+// accesses through the Access API call the accessors of that barrier set
+// directly instead of through function pointers resolved on first use,
+// e.g. with -DHARDWIRED_BARRIER_SET=G1BarrierSet. Such a VM can then only
+// run with the GCs using that barrier set. This is done automatically when
+// the build has no other barrier set than CardTableBarrierSet.
+#if !defined(HARDWIRED_BARRIER_SET) && \
+    !INCLUDE_EPSILONGC && !INCLUDE_G1GC && !INCLUDE_SHENANDOAHGC && !INCLUDE_ZGC
+#define HARDWIRED_BARRIER_SET CardTableBarrierSet
+#endif
+
 // To enable runtime-resolution of GC barriers on primitives, please
 // define SUPPORT_BARRIER_ON_PRIMITIVES.
 #ifdef SUPPORT_BARRIER_ON_PRIMITIVES
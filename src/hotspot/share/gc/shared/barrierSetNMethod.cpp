@@ -28,6 +28,7 @@
 #include "gc/shared/barrierSet.hpp"
 #include "gc/shared/barrierSetNMethod.hpp"
 #include "logging/log.hpp"
+#include "runtime/sweeper.hpp"
 #include "runtime/thread.hpp"
 #include "utilities/debug.hpp"
 
@@ -62,7 +63,9 @@ int BarrierSetNMethod::nmethod_stub_entry_barrier(address* return_address_ptr) {
   assert(!nm->is_osr_method(), "Should not reach here");
   // Called upon first entry after being armed
   bool may_enter = bs_nm->nmethod_entry_barrier(nm);
-  if (!may_enter) {
+  if (may_enter) {
+    NMethodSweeper::record_entry_barrier_hit(nm);
+  } else {
     log_trace(nmethod, barrier)("Deoptimizing nmethod: " PTR_FORMAT, p2i(nm));
     bs_nm->deoptimize(nm, return_address_ptr);
   }
@@ -81,5 +84,9 @@ bool BarrierSetNMethod::nmethod_osr_entry_barrier(nmethod* nm) {
 
   assert(nm->is_osr_method(), "Should not reach here");
   log_trace(nmethod, barrier)("Running osr nmethod entry barrier: " PTR_FORMAT, p2i(nm));
-  return nmethod_entry_barrier(nm);
+  bool may_enter = nmethod_entry_barrier(nm);
+  if (may_enter) {
+    NMethodSweeper::record_entry_barrier_hit(nm);
+  }
+  return may_enter;
 }
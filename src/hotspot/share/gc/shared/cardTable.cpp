@@ -450,6 +450,38 @@ MemRegion CardTable::dirty_card_range_after_reset(MemRegion mr,
   return MemRegion(mr.end(), mr.end());
 }
 
+CardTable::CardValue* CardTable::find_first_non_clean_card(CardValue* start, CardValue* end) {
+  STATIC_ASSERT(clean_card_block_rows == 4);
+  CardValue* cur = start;
+
+  // Check single cards up to the first word boundary
+  while (cur < end && !is_aligned(cur, BytesPerWord)) {
+    if (*cur != clean_card) {
+      return cur;
+    }
+    cur++;
+  }
+
+  // Skip blocks of clean cards
+  while (pointer_delta(end, cur, sizeof(CardValue)) >= clean_card_block_size &&
+         is_clean_card_block(cur)) {
+    cur += clean_card_block_size;
+  }
+
+  // Skip rows of clean cards
+  while (pointer_delta(end, cur, sizeof(CardValue)) >= (size_t)BytesPerWord &&
+         *(intptr_t*)cur == clean_card_row) {
+    cur += BytesPerWord;
+  }
+
+  // Find the non-clean card within the last row
+  while (cur < end && *cur == clean_card) {
+    cur++;
+  }
+
+  return cur;
+}
+
 uintx CardTable::ct_max_alignment_constraint() {
   return card_size * os::vm_page_size();
 }
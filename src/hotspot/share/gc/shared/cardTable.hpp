@@ -114,6 +114,25 @@ protected:
   static const intptr_t clean_card_row = (intptr_t)(-1);
 
 public:
+  // Number of words (rows) of cards checked at once when skipping
+  // ranges of clean cards.
+  static const size_t clean_card_block_rows = 4;
+  static const size_t clean_card_block_size = clean_card_block_rows * BytesPerWord;
+
+  // Returns true if the clean_card_block_size cards starting at the
+  // word aligned "card" are all clean. Since clean cards have all bits
+  // set, the rows can be combined before a single comparison.
+  static bool is_clean_card_block(const CardValue* card) {
+    assert(is_aligned(card, BytesPerWord), "Card must be word aligned");
+    const intptr_t* const rows = (const intptr_t*)card;
+    return (rows[0] & rows[1] & rows[2] & rows[3]) == clean_card_row;
+  }
+
+  // Returns the first card in [start, end) that is not clean, or end if
+  // all cards in the range are clean. Clean ranges are skipped a block of
+  // words at a time.
+  static CardValue* find_first_non_clean_card(CardValue* start, CardValue* end);
+
   CardTable(MemRegion whole_heap, bool conc_scan);
   virtual ~CardTable();
   virtual void initialize();
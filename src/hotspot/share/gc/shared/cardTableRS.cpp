@@ -212,9 +212,14 @@ void ClearNoncleanCardWrapper::do_MemRegion(MemRegion mr) {
         _dirty_card_closure->do_MemRegion(mrd);
       }
 
-      // fast forward through potential continuous whole-word range of clean cards beginning at a word-boundary
+      // fast forward through potential continuous whole-word range of clean cards beginning at a word-boundary,
+      // first a block of words at a time, then a single word at a time
       if (is_word_aligned(cur_entry)) {
         CardValue* cur_row = cur_entry - BytesPerWord;
+        while (cur_row - limit >= (ptrdiff_t)(CardTable::clean_card_block_size - BytesPerWord) &&
+               CardTable::is_clean_card_block(cur_row - (CardTable::clean_card_block_size - BytesPerWord))) {
+          cur_row -= CardTable::clean_card_block_size;
+        }
         while (cur_row >= limit && *((intptr_t*)cur_row) ==  CardTableRS::clean_card_row_val()) {
           cur_row -= BytesPerWord;
         }
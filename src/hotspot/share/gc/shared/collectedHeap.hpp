@@ -69,6 +69,14 @@ class GCMessage : public FormatBuffer<1024> {
 
 class CollectedHeap;
 
+// Iterator over all heap objects that several worker threads can share,
+// each one calling object_iterate() with its own worker id.
+class ParallelObjectIterator : public CHeapObj<mtGC> {
+ public:
+  virtual void object_iterate(ObjectClosure* cl, uint worker_id) = 0;
+  virtual ~ParallelObjectIterator() {}
+};
+
 class GCHeapLog : public EventLogBase<GCMessage> {
  private:
   void log_heap(CollectedHeap* heap, bool before);
@@ -387,6 +395,13 @@ class CollectedHeap : public CHeapObj<mtInternal> {
   // Iterate over all objects, calling "cl.do_object" on each.
   virtual void object_iterate(ObjectClosure* cl) = 0;
 
+  // Returns an iterator that thread_num workers can use to visit all
+  // objects in parallel, or NULL if the heap only supports serial iteration.
+  // The caller owns the returned iterator.
+  virtual ParallelObjectIterator* parallel_object_iterator(uint thread_num) {
+    return NULL;
+  }
+
   // Returns the longest time (in ms) that has elapsed since the last
   // time that any part of the heap was examined by a garbage collection.
   virtual jlong millis_since_last_gc() = 0;
@@ -493,6 +508,12 @@ class CollectedHeap : public CHeapObj<mtInternal> {
   virtual oop pin_object(JavaThread* thread, oop obj);
   virtual void unpin_object(JavaThread* thread, oop obj);
 
+  // True if obj can be pinned with pin_object() instead of locking out
+  // GCs with the GCLocker. A heap that does not support pinning in general
+  // may still pin objects it never moves. The answer must not change
+  // during the lifetime of obj.
+  virtual bool can_pin_object(oop obj) const { return supports_object_pinning(); }
+
   // Deduplicate the string, iff the GC supports string deduplication.
   virtual void deduplicate_string(oop str);
 
@@ -202,6 +202,8 @@ private:
   size_t _region_end_waste; // Number of words wasted due to skipping to the next region.
   uint   _regions_filled;   // Number of regions filled completely.
   size_t _direct_allocated; // Number of words allocated directly into the regions.
+  size_t _num_plab_filled;  // Number of PLABs refilled.
+  size_t _num_direct_allocated; // Number of direct allocations.
 
   // Number of words in live objects remaining in regions that ultimately suffered an
   // evacuation failure. This is used in the regions when the regions are made old regions.
@@ -213,10 +215,11 @@ private:
 public:
   G1EvacSummary(size_t allocated, size_t wasted, size_t undo_wasted, size_t unused,
     size_t used, size_t region_end_waste, uint regions_filled, size_t direct_allocated,
-    size_t failure_used, size_t failure_waste) :
+    size_t num_plab_filled, size_t num_direct_allocated, size_t failure_used, size_t failure_waste) :
     _allocated(allocated), _wasted(wasted), _undo_wasted(undo_wasted), _unused(unused),
     _used(used),  _region_end_waste(region_end_waste), _regions_filled(regions_filled),
-    _direct_allocated(direct_allocated), _failure_used(failure_used), _failure_waste(failure_waste)
+    _direct_allocated(direct_allocated), _num_plab_filled(num_plab_filled),
+    _num_direct_allocated(num_direct_allocated), _failure_used(failure_used), _failure_waste(failure_waste)
   { }
 
   size_t allocated() const { return _allocated; }
@@ -227,6 +230,8 @@ public:
   size_t region_end_waste() const { return _region_end_waste; }
   uint regions_filled() const { return _regions_filled; }
   size_t direct_allocated() const { return _direct_allocated; }
+  size_t num_plab_filled() const { return _num_plab_filled; }
+  size_t num_direct_allocated() const { return _num_direct_allocated; }
   size_t failure_used() const { return _failure_used; }
   size_t failure_waste() const { return _failure_waste; }
 };
@@ -30,6 +30,7 @@
 #include "gc/shared/gcTrace.hpp"
 #include "gc/shared/objectCountEventSender.hpp"
 #include "gc/shared/referenceProcessorStats.hpp"
+#include "gc/shared/taskqueue.hpp"
 #include "memory/heapInspection.hpp"
 #include "memory/resourceArea.hpp"
 #include "runtime/os.hpp"
@@ -66,6 +67,14 @@ void GCTracer::report_gc_reference_stats(const ReferenceProcessorStats& rps) con
   send_reference_stats_event(REF_PHANTOM, rps.phantom_count());
 }
 
+#if TASKQUEUE_STATS
+void GCTracer::report_task_queue_stats(const char* name, uint queues, const TaskQueueStats& stats) const {
+  if (TaskQueueStatistics) {
+    send_task_queue_stats_event(name, queues, stats);
+  }
+}
+#endif // TASKQUEUE_STATS
+
 #if INCLUDE_SERVICES
 class ObjectCountEventSenderClosure : public KlassInfoClosure {
   const double _size_threshold_percentage;
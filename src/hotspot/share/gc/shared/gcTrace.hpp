@@ -40,6 +40,7 @@ class MetaspaceChunkFreeListSummary;
 class MetaspaceSummary;
 class PSHeapSummary;
 class ReferenceProcessorStats;
+class TaskQueueStats;
 class TimePartitions;
 class BoolObjectClosure;
 
@@ -101,6 +102,7 @@ class GCTracer : public ResourceObj {
   void report_gc_heap_summary(GCWhen::Type when, const GCHeapSummary& heap_summary) const;
   void report_metaspace_summary(GCWhen::Type when, const MetaspaceSummary& metaspace_summary) const;
   void report_gc_reference_stats(const ReferenceProcessorStats& rp) const;
+  void report_task_queue_stats(const char* name, uint queues, const TaskQueueStats& stats) const;
   void report_object_count_after_gc(BoolObjectClosure* object_filter) NOT_SERVICES_RETURN;
 
  protected:
@@ -114,6 +116,7 @@ class GCTracer : public ResourceObj {
   void send_meta_space_summary_event(GCWhen::Type when, const MetaspaceSummary& meta_space_summary) const;
   void send_metaspace_chunk_free_list_summary(GCWhen::Type when, Metaspace::MetadataType mdtype, const MetaspaceChunkFreeListSummary& summary) const;
   void send_reference_stats_event(ReferenceType type, size_t count) const;
+  void send_task_queue_stats_event(const char* name, uint queues, const TaskQueueStats& stats) const;
   void send_phase_events(TimePartitions* time_partitions) const;
 };
 
@@ -28,6 +28,7 @@
 #include "gc/shared/gcTimer.hpp"
 #include "gc/shared/gcTrace.hpp"
 #include "gc/shared/gcWhen.hpp"
+#include "gc/shared/taskqueue.hpp"
 #include "jfr/jfrEvents.hpp"
 #include "runtime/os.hpp"
 #include "utilities/macros.hpp"
@@ -60,6 +61,25 @@ void GCTracer::send_reference_stats_event(ReferenceType type, size_t count) cons
   }
 }
 
+#if TASKQUEUE_STATS
+void GCTracer::send_task_queue_stats_event(const char* name, uint queues, const TaskQueueStats& stats) const {
+  EventGCTaskQueueStatistics e;
+  if (e.should_commit()) {
+    e.set_gcId(GCId::current());
+    e.set_name(name);
+    e.set_queues(queues);
+    e.set_pushes(stats.get(TaskQueueStats::push));
+    e.set_pops(stats.get(TaskQueueStats::pop));
+    e.set_slowPops(stats.get(TaskQueueStats::pop_slow));
+    e.set_stealAttempts(stats.get(TaskQueueStats::steal_attempt));
+    e.set_steals(stats.get(TaskQueueStats::steal));
+    e.set_overflowPushes(stats.get(TaskQueueStats::overflow));
+    e.set_maxOverflowLength(stats.get(TaskQueueStats::overflow_max_len));
+    e.commit();
+  }
+}
+#endif // TASKQUEUE_STATS
+
 void GCTracer::send_metaspace_chunk_free_list_summary(GCWhen::Type when, Metaspace::MetadataType mdtype,
                                                       const MetaspaceChunkFreeListSummary& summary) const {
   EventMetaspaceChunkFreeListSummary e;
@@ -343,6 +343,15 @@
   experimental(uintx, WorkStealingSpinToYieldRatio, 10,                     \
           "Ratio of hard spins to calls to yield")                          \
                                                                             \
+  experimental(bool, UseNUMAAwareTaskStealing, false,                       \
+          "Prefer stealing from task queues whose owner last ran on the "   \
+          "same NUMA node as the stealing thread")                          \
+                                                                            \
+  diagnostic(bool, TaskQueueStatistics, trueInDebug,                        \
+          "Count the operations on the GC task queues. The counts are "     \
+          "logged with gc+task+stats=trace and sent as "                    \
+          "GCTaskQueueStatistics events")                                   \
+                                                                            \
   develop(uintx, ObjArrayMarkingStride, 2048,                               \
           "Number of object array elements to push onto the marking stack " \
           "before pushing a continuation entry")                            \
@@ -362,9 +371,20 @@
   product_pd(bool, ResizeTLAB,                                              \
           "Dynamically resize TLAB size for threads")                       \
                                                                             \
+  product(bool, ResizeTLABPromptly, true,                                   \
+          "With ResizeTLAB, also grow the TLAB size of a thread between "   \
+          "GCs when it runs past its expected number of refills before "    \
+          "the expected share of eden was used")                            \
+                                                                            \
   product(bool, ZeroTLAB, false,                                            \
           "Zero out the newly created TLAB")                                \
                                                                             \
+  product(size_t, ArrayZeroingChunkSize, 1*M,                               \
+          "Zero primitive arrays larger than this many bytes in chunks of " \
+          "this size, stopping for safepoints in between (0 means zero "   \
+          "them in one go)")                                                \
+          range(0, max_jint)                                                \
+                                                                            \
   product(bool, TLABStats, true,                                            \
           "Provide more detailed and expensive TLAB statistics.")           \
                                                                             \
@@ -784,7 +804,8 @@
           "Par compact uses a variable scale based on the density of the "  \
           "generation and treats this as the maximum value when the heap "  \
           "is either completely full or completely empty.  Par compact "    \
-          "also has a smaller default value; see arguments.cpp.")           \
+          "also has a smaller default value; see arguments.cpp. "           \
+          "See G1FullGCSkipCompactingLiveRegions for its use by G1.")       \
           range(0, 100)                                                     \
                                                                             \
   product(uint, MarkSweepAlwaysCompactCount,     4,                         \
@@ -29,9 +29,13 @@
 #include "gc/shared/memAllocator.hpp"
 #include "gc/shared/threadLocalAllocBuffer.inline.hpp"
 #include "memory/universe.hpp"
+#include "oops/access.inline.hpp"
+#include "oops/arrayKlass.hpp"
 #include "oops/arrayOop.hpp"
 #include "oops/oop.inline.hpp"
 #include "prims/jvmtiExport.hpp"
+#include "runtime/interfaceSupport.inline.hpp"
+#include "runtime/safepointMechanism.inline.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/thread.inline.hpp"
@@ -409,11 +413,51 @@ MemRegion ObjArrayAllocator::obj_memory_range(oop obj) const {
   return MemRegion(((HeapWord*)obj) + hs, _word_size - hs);
 }
 
+bool ObjArrayAllocator::clear_in_chunks() const {
+  return ArrayZeroingChunkSize != 0 &&
+         _word_size * HeapWordSize > ArrayZeroingChunkSize &&
+         _klass->is_typeArray_klass() &&
+         _thread->is_Java_thread() &&
+         ((JavaThread*)_thread)->thread_state() == _thread_in_vm;
+}
+
+// Zeroing a large array delays safepoints for as long as the zeroing takes.
+// A primitive array is published with only its header cleared instead, and
+// its elements are zeroed in chunks, blocking for a pending safepoint between
+// them. The GCs don't look at the elements of primitive arrays, so the array
+// can be seen by them while it is partially cleared.
+oop ObjArrayAllocator::initialize_in_chunks(HeapWord* mem) const {
+  JavaThread* thread = (JavaThread*)_thread;
+  const size_t hs = arrayOopDesc::header_size(ArrayKlass::cast(_klass)->element_type());
+  const size_t chunk = MAX2(ArrayZeroingChunkSize / HeapWordSize, (size_t)1);
+
+  oopDesc::set_klass_gap(mem, 0);
+  Copy::fill_to_aligned_words(mem + oopDesc::header_size(), hs - oopDesc::header_size());
+  arrayOopDesc::set_length(mem, _length);
+
+  HandleMark hm(thread);
+  Handle array(thread, finish(mem));
+  for (size_t offset = hs; offset < _word_size;) {
+    const size_t words = MIN2(chunk, _word_size - offset);
+    // Resolve the array again since it is only stable until the next thread transition.
+    Copy::fill_to_aligned_words((HeapWord*)Access<>::resolve(array()) + offset, words);
+    offset += words;
+    if (offset < _word_size && SafepointMechanism::should_block(thread)) {
+      // The array may be moved by a GC during the safepoint.
+      ThreadBlockInVM tbivm(thread);
+    }
+  }
+  return array();
+}
+
 oop ObjArrayAllocator::initialize(HeapWord* mem) const {
   // Set array length before setting the _klass field because a
   // non-NULL klass field indicates that the object is parsable by
   // concurrent GC.
   assert(_length >= 0, "length should be non-negative");
+  if (_do_zero && clear_in_chunks()) {
+    return initialize_in_chunks(mem);
+  }
   if (_do_zero) {
     mem_clear(mem);
   }
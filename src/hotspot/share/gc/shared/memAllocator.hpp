@@ -84,6 +84,11 @@ public:
 class ObjArrayAllocator: public MemAllocator {
   const int  _length;
   const bool _do_zero;
+
+  // Large primitive arrays are zeroed in chunks after they are published,
+  // see ArrayZeroingChunkSize.
+  bool clear_in_chunks() const;
+  oop initialize_in_chunks(HeapWord* mem) const;
 protected:
   virtual MemRegion obj_memory_range(oop obj) const;
 
@@ -315,6 +315,20 @@ oop* OopStorage::Block::allocate() {
   }
 }
 
+// Allocate all the free entries of the block, returning their bitmask.
+uintx OopStorage::Block::allocate_all() {
+  // Use CAS loop because release may change bitmask outside of lock.
+  uintx allocated = allocated_bitmask();
+  while (true) {
+    assert(!is_full_bitmask(allocated), "attempt to allocate from full block");
+    uintx fetched = Atomic::cmpxchg(&_allocated_bitmask, allocated, ~uintx(0));
+    if (fetched == allocated) {
+      return ~allocated;         // CAS succeeded; return the taken entries.
+    }
+    allocated = fetched;         // CAS failed; retry with latest value.
+  }
+}
+
 OopStorage::Block* OopStorage::Block::new_block(const OopStorage* owner) {
   // _data must be first member: aligning block => aligning _data.
   STATIC_ASSERT(_data_pos == 0);
@@ -434,6 +448,43 @@ oop* OopStorage::allocate() {
   return result;
 }
 
+size_t OopStorage::allocate(oop** ptrs, size_t size) {
+  assert(size > 0, "precondition");
+  Block* block;
+  uintx taken;
+  {
+    MutexLocker ml(_allocation_mutex, Mutex::_no_safepoint_check_flag);
+    block = block_for_allocation();
+    if (block == NULL) return 0; // Block allocation failed.
+    if (block->is_empty()) {
+      // Transitioning from empty to not empty.
+      log_trace(oopstorage, blocks)("%s: block not empty " PTR_FORMAT, name(), p2i(block));
+    }
+    // Take all the free entries, so the block becomes full and is removed
+    // from consideration by future allocates.  Entries beyond the request
+    // are released below, outside the lock.
+    taken = block->allocate_all();
+    log_trace(oopstorage, blocks)("%s: block full " PTR_FORMAT, name(), p2i(block));
+    _allocation_list.unlink(*block);
+  }
+
+  size_t count = 0;
+  while ((taken != 0) && (count < size)) {
+    unsigned index = count_trailing_zeros(taken);
+    taken ^= block->bitmask_for_index(index);
+    ptrs[count++] = block->get_pointer(index);
+  }
+  Atomic::add(&_allocation_count, count); // release updates outside lock.
+  if (taken != 0) {
+    // Return the surplus.  The block is no longer full, so this records a
+    // deferred update that makes it available for allocation again.
+    block->release_entries(taken, this);
+  }
+  log_trace(oopstorage, ref)("%s: bulk allocated " SIZE_FORMAT " entries from " PTR_FORMAT,
+                             name(), count, p2i(block));
+  return count;
+}
+
 bool OopStorage::try_add_block() {
   assert_lock_strong(_allocation_mutex);
   Block* block;
@@ -459,7 +510,9 @@ bool OopStorage::try_add_block() {
   // deleted.  But we don't bother notifying about the empty block
   // because we're (probably) about to allocate an entry from it.
   _allocation_list.push_back(*block);
-  log_debug(oopstorage, blocks)("%s: new block " PTR_FORMAT, name(), p2i(block));
+  _blocks_added++;
+  log_debug(oopstorage, blocks)("%s: new block " PTR_FORMAT " (added " SIZE_FORMAT ", deleted " SIZE_FORMAT ")",
+                                name(), p2i(block), _blocks_added, _blocks_deleted);
   return true;
 }
 
@@ -741,7 +794,9 @@ OopStorage::OopStorage(const char* name,
   _active_mutex(active_mutex),
   _allocation_count(0),
   _concurrent_iteration_count(0),
-  _needs_cleanup(false)
+  _needs_cleanup(false),
+  _blocks_added(0),
+  _blocks_deleted(0)
 {
   _active_array->increment_refcount();
   assert(_active_mutex->rank() < _allocation_mutex->rank(),
@@ -892,6 +947,9 @@ bool OopStorage::delete_empty_blocks() {
       }
       // Remove block from _allocation_list and delete it.
       _allocation_list.unlink(*block);
+      _blocks_deleted++;
+      log_debug(oopstorage, blocks)("%s: blocks added " SIZE_FORMAT ", deleted " SIZE_FORMAT,
+                                    name(), _blocks_added, _blocks_deleted);
       // Be safepoint-polite while deleting and looping.
       MutexUnlocker ul(_allocation_mutex, Mutex::_no_safepoint_check_flag);
       delete_empty_block(*block);
@@ -963,7 +1021,8 @@ OopStorage::BasicParState::BasicParState(const OopStorage* storage,
   _block_count(0),              // initialized properly below
   _next_block(0),
   _estimated_thread_count(estimated_thread_count),
-  _concurrent(concurrent)
+  _concurrent(concurrent),
+  _max_step(min_max_step)       // initialized properly below
 {
   assert(estimated_thread_count > 0, "estimated thread count must be positive");
   update_concurrent_iteration_count(1);
@@ -972,6 +1031,7 @@ OopStorage::BasicParState::BasicParState(const OopStorage* storage,
   // ensure the count we use was written after the block with that count
   // was fully initialized; see ActiveArray::push.
   _block_count = _active_array->block_count_acquire();
+  _max_step = MAX2(min_max_step, _block_count / (_estimated_thread_count * target_claims_per_thread));
 }
 
 OopStorage::BasicParState::~BasicParState() {
@@ -1002,10 +1062,11 @@ bool OopStorage::BasicParState::claim_next_segment(IterationData* data) {
   // quantity, get delayed, and then end up claiming most or all of
   // the remaining largish amount of work, leaving nothing for other
   // threads to do.  But too small a step can lead to contention
-  // over _next_block, esp. when the work per block is small.
-  size_t max_step = 10;
+  // over _next_block, esp. when the work per block is small.  The maximum
+  // step scales with the storage size, so huge storages (millions of weak
+  // JNI handles, say) don't need hundreds of thousands of claims.
   size_t remaining = _block_count - start;
-  size_t step = MIN2(max_step, 1 + (remaining / _estimated_thread_count));
+  size_t step = MIN2(_max_step, 1 + (remaining / _estimated_thread_count));
   // Atomic::add with possible overshoot.  This can perform better
   // than a CAS loop on some platforms when there is contention.
   // We can cope with the uncertainty by recomputing start/end from
@@ -1049,6 +1110,7 @@ void OopStorage::print_on(outputStream* st) const {
 
   st->print("%s: " SIZE_FORMAT " entries in " SIZE_FORMAT " blocks (%.F%%), " SIZE_FORMAT " bytes",
             name(), allocations, blocks, alloc_percentage, total_memory_usage());
+  st->print(", " SIZE_FORMAT " blocks added, " SIZE_FORMAT " deleted", _blocks_added, _blocks_deleted);
   if (_concurrent_iteration_count > 0) {
     st->print(", concurrent iteration active");
   }
@@ -104,6 +104,15 @@ public:
   // postcondition: *result == NULL.
   oop* allocate();
 
+  // Allocates up to size entries, storing them in ptrs.  Returns the number
+  // of entries allocated, which is between 1 and size unless memory
+  // allocation failed, in which case it is zero.  Possibly faster than
+  // individual calls to allocate(), since all entries come from a single
+  // block taken with one acquisition of _allocation_mutex.
+  // precondition: size > 0.
+  // postcondition: *ptrs[i] == NULL, for i in [0,result).
+  size_t allocate(oop** ptrs, size_t size);
+
   // Deallocates ptr.  No locking.
   // precondition: ptr is a valid allocated entry.
   // precondition: *ptr == NULL.
@@ -236,6 +245,10 @@ private:
 
   volatile bool _needs_cleanup;
 
+  // Block churn statistics, updated with _allocation_mutex held.
+  size_t _blocks_added;
+  size_t _blocks_deleted;
+
   bool try_add_block();
   Block* block_for_allocation();
 
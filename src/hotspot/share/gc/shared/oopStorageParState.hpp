@@ -133,6 +133,12 @@ class OopStorage::BasicParState {
   volatile size_t _next_block;
   uint _estimated_thread_count;
   bool _concurrent;
+  size_t _max_step;
+
+  // Claim sizes grow with the storage so that every thread makes about
+  // target_claims_per_thread claims, but never drop below min_max_step blocks.
+  static const size_t min_max_step = 10;
+  static const size_t target_claims_per_thread = 64;
 
   // Noncopyable.
   BasicParState(const BasicParState&);
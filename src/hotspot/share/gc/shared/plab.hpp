@@ -181,6 +181,8 @@ class PLABStats : public CHeapObj<mtGC> {
 
   virtual ~PLABStats() { }
 
+  const char* description() const { return _description; }
+
   size_t allocated() const { return _allocated; }
   size_t wasted() const { return _wasted; }
   size_t unused() const { return _unused; }
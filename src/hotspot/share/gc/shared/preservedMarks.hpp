@@ -128,8 +128,8 @@ public:
 
   // Iterate over all stacks, restore all preserved marks, and reclaim
   // the memory taken up by the stack segments.
-  // Supported executors: SharedRestorePreservedMarksTaskExecutor (Serial, G1),
-  // PSRestorePreservedMarksTaskExecutor (PS).
+  // Supported executors: SharedRestorePreservedMarksTaskExecutor (Serial,
+  // Parallel and G1, including their full GCs).
   inline void restore(RestorePreservedMarksTaskExecutor* executor);
 
   // Reclaim stack array.
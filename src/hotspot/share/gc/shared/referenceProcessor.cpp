@@ -38,6 +38,7 @@
 #include "memory/universe.hpp"
 #include "oops/access.inline.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/java.hpp"
 
 ReferencePolicy* ReferenceProcessor::_always_clear_soft_ref_policy = NULL;
@@ -514,6 +515,14 @@ size_t ReferenceProcessor::total_reference_count(ReferenceType type) const {
   return total_count(list);
 }
 
+bool AbstractRefProcTaskExecutor::ProcessTask::claim_list(uint num_lists, uint& index) {
+  if (Atomic::load(&_next_list) >= num_lists) {
+    return false;
+  }
+  index = Atomic::add(&_next_list, 1u) - 1;
+  return index < num_lists;
+}
+
 class RefProcPhase1Task : public AbstractRefProcTaskExecutor::ProcessTask {
 public:
   RefProcPhase1Task(ReferenceProcessor&           ref_processor,
@@ -528,29 +537,35 @@ public:
                     VoidClosure& complete_gc)
   {
     RefProcSubPhasesWorkerTimeTracker tt(ReferenceProcessor::SoftRefSubPhase1, _phase_times, worker_id);
-    size_t const removed = _ref_processor.process_soft_ref_reconsider_work(_ref_processor._discoveredSoftRefs[worker_id],
-                                                                           _policy,
-                                                                           &is_alive,
-                                                                           &keep_alive,
-                                                                           &complete_gc);
+    size_t removed = 0;
+    uint i;
+    while (claim_list(_ref_processor.max_num_queues(), i)) {
+      removed += _ref_processor.process_soft_ref_reconsider_work(_ref_processor._discoveredSoftRefs[i],
+                                                                 _policy,
+                                                                 &is_alive,
+                                                                 &keep_alive,
+                                                                 &complete_gc);
+    }
     _phase_times->add_ref_cleared(REF_SOFT, removed);
   }
 private:
   ReferencePolicy* _policy;
 };
 
+// Phase 2 hands out the Soft, Weak and Final lists from a single sequence, in
+// that order, so that the work is rebalanced across the reference types too:
+// workers without Soft lists left go on with Weak lists, and so on, instead of
+// waiting for the worker with the longest list of each type.
 class RefProcPhase2Task: public AbstractRefProcTaskExecutor::ProcessTask {
-  void run_phase2(uint worker_id,
-                  DiscoveredList list[],
-                  BoolObjectClosure& is_alive,
-                  OopClosure& keep_alive,
-                  bool do_enqueue_and_clear,
-                  ReferenceType ref_type) {
-    size_t const removed = _ref_processor.process_soft_weak_final_refs_work(list[worker_id],
-                                                                            &is_alive,
-                                                                            &keep_alive,
-                                                                            do_enqueue_and_clear);
-    _phase_times->add_ref_cleared(ref_type, removed);
+  static const uint NumTypes = 3;
+
+  DiscoveredList* lists(uint type) const {
+    switch (type) {
+      case 0: return _ref_processor._discoveredSoftRefs;
+      case 1: return _ref_processor._discoveredWeakRefs;
+      case 2: return _ref_processor._discoveredFinalRefs;
+      default: ShouldNotReachHere(); return NULL;
+    }
   }
 
 public:
@@ -563,17 +578,34 @@ public:
                     OopClosure& keep_alive,
                     VoidClosure& complete_gc) {
     RefProcWorkerTimeTracker t(_phase_times->phase2_worker_time_sec(), worker_id);
-    {
-      RefProcSubPhasesWorkerTimeTracker tt(ReferenceProcessor::SoftRefSubPhase2, _phase_times, worker_id);
-      run_phase2(worker_id, _ref_processor._discoveredSoftRefs, is_alive, keep_alive, true /* do_enqueue_and_clear */, REF_SOFT);
-    }
-    {
-      RefProcSubPhasesWorkerTimeTracker tt(ReferenceProcessor::WeakRefSubPhase2, _phase_times, worker_id);
-      run_phase2(worker_id, _ref_processor._discoveredWeakRefs, is_alive, keep_alive, true /* do_enqueue_and_clear */, REF_WEAK);
+
+    static const ReferenceProcessor::RefProcSubPhases sub_phases[NumTypes] = {
+      ReferenceProcessor::SoftRefSubPhase2,
+      ReferenceProcessor::WeakRefSubPhase2,
+      ReferenceProcessor::FinalRefSubPhase2
+    };
+    static const ReferenceType ref_types[NumTypes] = { REF_SOFT, REF_WEAK, REF_FINAL };
+
+    const uint num_queues = _ref_processor.max_num_queues();
+    double time_sec[NumTypes] = { 0.0, 0.0, 0.0 };
+    size_t removed[NumTypes] = { 0, 0, 0 };
+
+    uint i;
+    while (claim_list(NumTypes * num_queues, i)) {
+      const uint type = i / num_queues;
+      // Final references are not enqueued and cleared in this phase.
+      const bool do_enqueue_and_clear = (ref_types[type] != REF_FINAL);
+      double start = os::elapsedTime();
+      removed[type] += _ref_processor.process_soft_weak_final_refs_work(lists(type)[i % num_queues],
+                                                                        &is_alive,
+                                                                        &keep_alive,
+                                                                        do_enqueue_and_clear);
+      time_sec[type] += os::elapsedTime() - start;
     }
-    {
-      RefProcSubPhasesWorkerTimeTracker tt(ReferenceProcessor::FinalRefSubPhase2, _phase_times, worker_id);
-      run_phase2(worker_id, _ref_processor._discoveredFinalRefs, is_alive, keep_alive, false /* do_enqueue_and_clear */, REF_FINAL);
+
+    for (uint type = 0; type < NumTypes; type++) {
+      _phase_times->sub_phase_worker_time_sec(sub_phases[type])->set(worker_id, time_sec[type]);
+      _phase_times->add_ref_cleared(ref_types[type], removed[type]);
     }
     // Close the reachable set; needed for collectors which keep_alive_closure do
     // not immediately complete their work.
@@ -593,7 +625,10 @@ public:
                     VoidClosure& complete_gc)
   {
     RefProcSubPhasesWorkerTimeTracker tt(ReferenceProcessor::FinalRefSubPhase3, _phase_times, worker_id);
-    _ref_processor.process_final_keep_alive_work(_ref_processor._discoveredFinalRefs[worker_id], &keep_alive, &complete_gc);
+    uint i;
+    while (claim_list(_ref_processor.max_num_queues(), i)) {
+      _ref_processor.process_final_keep_alive_work(_ref_processor._discoveredFinalRefs[i], &keep_alive, &complete_gc);
+    }
   }
 };
 
@@ -609,10 +644,14 @@ public:
                     VoidClosure& complete_gc)
   {
     RefProcSubPhasesWorkerTimeTracker tt(ReferenceProcessor::PhantomRefSubPhase4, _phase_times, worker_id);
-    size_t const removed = _ref_processor.process_phantom_refs_work(_ref_processor._discoveredPhantomRefs[worker_id],
-                                                                    &is_alive,
-                                                                    &keep_alive,
-                                                                    &complete_gc);
+    size_t removed = 0;
+    uint i;
+    while (claim_list(_ref_processor.max_num_queues(), i)) {
+      removed += _ref_processor.process_phantom_refs_work(_ref_processor._discoveredPhantomRefs[i],
+                                                          &is_alive,
+                                                          &keep_alive,
+                                                          &complete_gc);
+    }
     _phase_times->add_ref_cleared(REF_PHANTOM, removed);
   }
 };
@@ -658,24 +697,11 @@ void ReferenceProcessor::set_active_mt_degree(uint v) {
 
 bool ReferenceProcessor::need_balance_queues(DiscoveredList refs_lists[]) {
   assert(_processing_is_mt, "why balance non-mt processing?");
-  // _num_queues is the processing degree.  Only list entries up to
-  // _num_queues will be processed, so any non-empty lists beyond
-  // that must be redistributed to lists in that range.  Even if not
-  // needed for that, balancing may be desirable to eliminate poor
-  // distribution of references among the lists.
-  if (ParallelRefProcBalancingEnabled) {
-    return true;                // Configuration says do it.
-  } else {
-    // Configuration says don't balance, but if there are non-empty
-    // lists beyond the processing degree, then must ignore the
-    // configuration and balance anyway.
-    for (uint i = _num_queues; i < _max_num_queues; ++i) {
-      if (!refs_lists[i].is_empty()) {
-        return true;            // Must balance despite configuration.
-      }
-    }
-    return false;               // Safe to obey configuration and not balance.
-  }
+  // The processing tasks claim all _max_num_queues lists dynamically, so
+  // non-empty lists beyond the processing degree _num_queues are processed
+  // without redistributing them first.  Balancing is still desirable to
+  // split overly long lists, which cannot be shared between workers.
+  return ParallelRefProcBalancingEnabled;
 }
 
 void ReferenceProcessor::maybe_balance_queues(DiscoveredList refs_lists[]) {
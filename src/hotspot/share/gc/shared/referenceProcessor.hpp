@@ -653,15 +653,24 @@ protected:
   // threads after execution.
   bool                          _marks_oops_alive;
   ReferenceProcessorPhaseTimes* _phase_times;
+  // Index of the next discovered list to hand out to a worker.
+  volatile uint                 _next_list;
 
   ProcessTask(ReferenceProcessor& ref_processor,
               bool marks_oops_alive,
               ReferenceProcessorPhaseTimes* phase_times)
     : _ref_processor(ref_processor),
       _marks_oops_alive(marks_oops_alive),
-      _phase_times(phase_times)
+      _phase_times(phase_times),
+      _next_list(0)
   { }
 
+  // Claim the next of num_lists discovered lists.  Lists are handed out
+  // dynamically instead of one per worker, so that workers that finish early
+  // help with the remaining lists, and non-empty lists beyond the processing
+  // degree are processed without balancing the queues first.
+  bool claim_list(uint num_lists, uint& index);
+
 public:
   virtual void work(uint worker_id,
                     BoolObjectClosure& is_alive,
@@ -172,8 +172,42 @@ inline void SATBMarkQueue::filter() {
   satb_qset()->filter(this);
 }
 
+// Wraps a filter with a small direct-mapped cache of the entries retained
+// so far by one filtering pass.  A mutator updating the same fields over
+// and over records the same previous values many times, but a single
+// entry per object is enough for marking, so repeats are filtered out
+// without consulting the (more expensive) collector filter again.
+template<typename Filter>
+class SATBDuplicateFilter {
+  static const size_t cache_size = 32;
+
+  Filter _filter_out;
+  const void* _cache[cache_size];
+
+public:
+  SATBDuplicateFilter(Filter filter_out) : _filter_out(filter_out) {
+    for (size_t i = 0; i < cache_size; i++) {
+      _cache[i] = NULL;
+    }
+  }
+
+  bool operator()(const void* entry) {
+    size_t slot = (reinterpret_cast<uintptr_t>(entry) >> LogMinObjAlignmentInBytes) & (cache_size - 1);
+    if (_cache[slot] == entry) {
+      return true;
+    }
+    if (_filter_out(entry)) {
+      return true;
+    }
+    _cache[slot] = entry;
+    return false;
+  }
+};
+
 // Removes entries from the buffer that are no longer needed, as
-// determined by filter. If e is a void* entry in the buffer,
+// determined by filter.  Duplicates of retained entries are removed
+// too; the compaction evaluates every entry exactly once, and every
+// entry the filter decides to keep is retained. If e is a void* entry in the buffer,
 // filter_out(e) must be a valid expression whose value is convertible
 // to bool. Entries are removed (filtered out) if the result is true,
 // retained if false.
@@ -186,6 +220,8 @@ inline void SATBMarkQueue::apply_filter(Filter filter_out) {
     return;
   }
 
+  SATBDuplicateFilter<Filter> filter_dup(filter_out);
+
   // Two-fingered compaction toward the end.
   void** src = &buf[this->index()];
   void** dst = &buf[this->capacity()];
@@ -193,10 +229,10 @@ inline void SATBMarkQueue::apply_filter(Filter filter_out) {
   for ( ; src < dst; ++src) {
     // Search low to high for an entry to keep.
     void* entry = *src;
-    if (!filter_out(entry)) {
+    if (!filter_dup(entry)) {
       // Found keeper.  Search high to low for an entry to discard.
       while (src < --dst) {
-        if (filter_out(*dst)) {
+        if (filter_dup(*dst)) {
           *dst = entry;         // Replace discard with keeper.
           break;
         }
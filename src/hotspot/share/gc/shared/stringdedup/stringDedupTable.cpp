@@ -211,6 +211,7 @@ const size_t             StringDedupTable::_max_size = (1 << 24);   // 16777216
 const double             StringDedupTable::_grow_load_factor = 2.0; // Grow table at 200% load
 const double             StringDedupTable::_shrink_load_factor = _grow_load_factor / 3.0; // Shrink table at 67% load
 const double             StringDedupTable::_max_cache_factor = 0.1; // Cache a maximum of 10% of the table size
+const size_t             StringDedupTable::_grow_chunk_size = (1 << 10); // Buckets moved per grow step
 const uintx              StringDedupTable::_rehash_multiple = 60;   // Hash bucket has 60 times more collisions than expected
 const uintx              StringDedupTable::_rehash_threshold = (uintx)(_rehash_multiple * _grow_load_factor);
 
@@ -222,6 +223,10 @@ uintx                    StringDedupTable::_rehash_count = 0;
 StringDedupTable*        StringDedupTable::_resized_table = NULL;
 StringDedupTable*        StringDedupTable::_rehashed_table = NULL;
 volatile size_t          StringDedupTable::_claimed_index = 0;
+volatile size_t          StringDedupTable::_claimed_grown_index = 0;
+
+StringDedupTable*        StringDedupTable::_grown_table = NULL;
+size_t                   StringDedupTable::_grow_index = 0;
 
 StringDedupTable::StringDedupTable(size_t size, jint hash_seed) :
   _size(size),
@@ -392,15 +397,9 @@ bool StringDedupTable::is_rehashing() {
 StringDedupTable* StringDedupTable::prepare_resize() {
   size_t size = _table->_size;
 
-  // Check if the hashtable needs to be resized
-  if (_table->_entries > _table->_grow_threshold) {
-    // Grow table, double the size
-    size *= 2;
-    if (size > _max_size) {
-      // Too big, don't resize
-      return NULL;
-    }
-  } else if (_table->_entries < _table->_shrink_threshold) {
+  // Check if the hashtable needs to be resized. Growing is left to
+  // grow_step(), which does it concurrently.
+  if (_table->_entries < _table->_shrink_threshold) {
     // Shrink table, half the size
     size /= 2;
     if (size < _min_size) {
@@ -462,6 +461,7 @@ void StringDedupTable::unlink_or_oops_do(StringDedupUnlinkOrOopsDoClosure* cl, u
 
   // Number of entries removed during the scan
   uintx removed = 0;
+  uintx removed_grown = 0;
 
   for (;;) {
     // Grab next partition to scan
@@ -473,25 +473,44 @@ void StringDedupTable::unlink_or_oops_do(StringDedupUnlinkOrOopsDoClosure* cl, u
     }
 
     // Scan the partition followed by the sibling partition in the second half of the table
-    removed += unlink_or_oops_do(cl, partition_begin, partition_end, worker_id);
-    removed += unlink_or_oops_do(cl, table_half + partition_begin, table_half + partition_end, worker_id);
+    removed += unlink_or_oops_do(cl, _table, partition_begin, partition_end, worker_id);
+    removed += unlink_or_oops_do(cl, _table, table_half + partition_begin, table_half + partition_end, worker_id);
+  }
+
+  if (_grown_table != NULL) {
+    // A concurrent grow is in progress, the buckets already moved must be
+    // scanned in the grown table. Entries are never moved between the tables
+    // here, so any partitioning will do.
+    size_t grown_partition_size = MIN2(_grown_table->_size, partition_size);
+    for (;;) {
+      size_t partition_begin = claim_grown_table_partition(grown_partition_size);
+      if (partition_begin >= _grown_table->_size) {
+        break;
+      }
+      removed_grown += unlink_or_oops_do(cl, _grown_table, partition_begin, partition_begin + grown_partition_size, worker_id);
+    }
   }
 
   // Delayed update to avoid contention on the table lock
-  if (removed > 0) {
+  if (removed + removed_grown > 0) {
     MutexLocker ml(StringDedupTable_lock, Mutex::_no_safepoint_check_flag);
     _table->_entries -= removed;
-    _entries_removed += removed;
+    if (removed_grown > 0) {
+      _grown_table->_entries -= removed_grown;
+    }
+    _entries_removed += removed + removed_grown;
   }
 }
 
 uintx StringDedupTable::unlink_or_oops_do(StringDedupUnlinkOrOopsDoClosure* cl,
+                                          StringDedupTable* table,
                                           size_t partition_begin,
                                           size_t partition_end,
                                           uint worker_id) {
+  assert(table == _table || !(is_resizing() || is_rehashing()), "Only the active table is resized");
   uintx removed = 0;
   for (size_t bucket = partition_begin; bucket < partition_end; bucket++) {
-    StringDedupEntry** entry = _table->bucket(bucket);
+    StringDedupEntry** entry = table->bucket(bucket);
     while (*entry != NULL) {
       oop* p = (oop*)(*entry)->obj_addr();
       if (cl->is_alive(*p)) {
@@ -517,7 +536,7 @@ uintx StringDedupTable::unlink_or_oops_do(StringDedupUnlinkOrOopsDoClosure* cl,
         }
       } else {
         // Not alive, remove entry from table
-        _table->remove(entry, worker_id);
+        table->remove(entry, worker_id);
         removed++;
       }
     }
@@ -530,7 +549,8 @@ void StringDedupTable::gc_prologue(bool resize_and_rehash_table) {
   assert(!is_resizing() && !is_rehashing(), "Already in progress?");
 
   _claimed_index = 0;
-  if (resize_and_rehash_table) {
+  _claimed_grown_index = 0;
+  if (resize_and_rehash_table && _grown_table == NULL) {
     // If both resize and rehash is needed, only do resize. Rehash of
     // the table will eventually happen if the situation persists.
     _resized_table = StringDedupTable::prepare_resize();
@@ -593,10 +613,67 @@ size_t StringDedupTable::claim_table_partition(size_t partition_size) {
   return Atomic::add(&_claimed_index, partition_size) - partition_size;
 }
 
+size_t StringDedupTable::claim_grown_table_partition(size_t partition_size) {
+  return Atomic::add(&_claimed_grown_index, partition_size) - partition_size;
+}
+
+bool StringDedupTable::grow_step() {
+  MutexLocker ml(StringDedupTable_lock, Mutex::_no_safepoint_check_flag);
+
+  if (_grown_table == NULL) {
+    // Check if the hashtable needs to grow
+    size_t size = _table->_size * 2;
+    if (_table->_entries <= _table->_grow_threshold || size > _max_size) {
+      return false;
+    }
+
+    // Update statistics
+    _resize_count++;
+
+    // Update max cache size
+    _entry_cache->set_max_size(size * _max_cache_factor);
+
+    _grown_table = new StringDedupTable(size, _table->_hash_seed);
+    _grow_index = 0;
+  }
+
+  // Move the next chunk of buckets. Moved entries are accounted in the
+  // grown table so the GC can remove dead entries from either table.
+  size_t end = MIN2(_grow_index + _grow_chunk_size, _table->_size);
+  for (; _grow_index < end; _grow_index++) {
+    StringDedupEntry** entry = _table->bucket(_grow_index);
+    while (*entry != NULL) {
+      _table->transfer(entry, _grown_table);
+      _table->_entries--;
+      _grown_table->_entries++;
+    }
+  }
+
+  if (_grow_index < _table->_size) {
+    return true;
+  }
+
+  // All buckets moved, install the grown table
+  assert(_table->_entries == 0, "All entries should have been moved");
+  _grown_table->_rehash_needed = _grown_table->_rehash_needed || _table->_rehash_needed;
+  delete _table;
+  _table = _grown_table;
+  _grown_table = NULL;
+  _grow_index = 0;
+  return false;
+}
+
 void StringDedupTable::verify() {
-  for (size_t bucket = 0; bucket < _table->_size; bucket++) {
+  verify(_table);
+  if (_grown_table != NULL) {
+    verify(_grown_table);
+  }
+}
+
+void StringDedupTable::verify(StringDedupTable* table) {
+  for (size_t bucket = 0; bucket < table->_size; bucket++) {
     // Verify entries
-    StringDedupEntry** entry = _table->bucket(bucket);
+    StringDedupEntry** entry = table->bucket(bucket);
     while (*entry != NULL) {
       typeArrayOop value = (*entry)->obj();
       guarantee(value != NULL, "Object must not be NULL");
@@ -606,7 +683,7 @@ void StringDedupTable::verify() {
       bool latin1 = (*entry)->latin1();
       unsigned int hash = hash_code(value, latin1);
       guarantee((*entry)->hash() == hash, "Table entry has inorrect hash");
-      guarantee(_table->hash_to_index(hash) == bucket, "Table entry has incorrect index");
+      guarantee(table->hash_to_index(hash) == bucket, "Table entry has incorrect index");
       entry = (*entry)->next_addr();
     }
 
@@ -614,7 +691,7 @@ void StringDedupTable::verify() {
     // We only need to compare entries in the same bucket. If the same oop or an
     // identical array has been inserted more than once into different/incorrect
     // buckets the verification step above will catch that.
-    StringDedupEntry** entry1 = _table->bucket(bucket);
+    StringDedupEntry** entry1 = table->bucket(bucket);
     while (*entry1 != NULL) {
       typeArrayOop value1 = (*entry1)->obj();
       bool latin1_1 = (*entry1)->latin1();
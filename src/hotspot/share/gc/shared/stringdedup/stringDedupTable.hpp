@@ -101,6 +101,11 @@ public:
 // The table is dynamically resized to accommodate the current number of table entries.
 // The table has hash buckets with chains for hash collision. If the average chain
 // length goes above or below given thresholds the table grows or shrinks accordingly.
+// Growing is done concurrently by the deduplication thread, which moves a chunk of
+// buckets at a time into the grown table while holding the StringDedupTable_lock.
+// Until all buckets have been moved, entries whose bucket index in the active table
+// is below _grow_index are found in the grown table. Shrinking is done by the GC
+// workers as part of unlink_or_oops_do().
 //
 // The table is also dynamically rehashed (using a new hash seed) if it becomes severely
 // unbalanced, i.e., a hash chain is significantly longer than average.
@@ -141,6 +146,7 @@ private:
   static const uintx              _rehash_multiple;
   static const uintx              _rehash_threshold;
   static const double             _max_cache_factor;
+  static const size_t             _grow_chunk_size;
 
   // Table statistics, only used for logging.
   static uintx                    _entries_added;
@@ -149,10 +155,15 @@ private:
   static uintx                    _rehash_count;
 
   static volatile size_t          _claimed_index;
+  static volatile size_t          _claimed_grown_index;
 
   static StringDedupTable*        _resized_table;
   static StringDedupTable*        _rehashed_table;
 
+  // Concurrent grow state, protected by the StringDedupTable_lock.
+  static StringDedupTable*        _grown_table;
+  static size_t                   _grow_index;
+
   StringDedupTable(size_t size, jint hash_seed = 0);
   ~StringDedupTable();
 
@@ -184,13 +195,22 @@ private:
   // table entry if no matching character array exists.
   typeArrayOop lookup_or_add_inner(typeArrayOop value, bool latin1, unsigned int hash);
 
+  // Returns the table holding the hash bucket for the given hash code,
+  // which is the grown table if that bucket has already been moved.
+  static StringDedupTable* table_for(unsigned int hash) {
+    if (_grown_table != NULL && _table->hash_to_index(hash) < _grow_index) {
+      return _grown_table;
+    }
+    return _table;
+  }
+
   // Thread safe lookup or add of table entry
   static typeArrayOop lookup_or_add(typeArrayOop value, bool latin1, unsigned int hash) {
     // Protect the table from concurrent access. Also note that this lock
     // acts as a fence for _table, which could have been replaced by a new
     // instance if the table was resized or rehashed.
     MutexLocker ml(StringDedupTable_lock, Mutex::_no_safepoint_check_flag);
-    return _table->lookup_or_add_inner(value, latin1, hash);
+    return table_for(hash)->lookup_or_add_inner(value, latin1, hash);
   }
 
   // Returns true if the hashtable is currently using a Java compatible
@@ -204,11 +224,15 @@ private:
   static unsigned int hash_code(typeArrayOop value, bool latin1);
 
   static uintx unlink_or_oops_do(StringDedupUnlinkOrOopsDoClosure* cl,
+                                 StringDedupTable* table,
                                  size_t partition_begin,
                                  size_t partition_end,
                                  uint worker_id);
 
   static size_t claim_table_partition(size_t partition_size);
+  static size_t claim_grown_table_partition(size_t partition_size);
+
+  static void verify(StringDedupTable* table);
 
   static bool is_resizing();
   static bool is_rehashing();
@@ -245,6 +269,11 @@ public:
   // If the table entry cache has grown too large, delete overflowed entries.
   static void clean_entry_cache();
 
+  // Moves the next chunk of buckets into the grown table, starting a grow if
+  // the table has passed its grow threshold. Must be called by a thread that
+  // blocks safepoints. Returns true if the grow is still in progress.
+  static bool grow_step();
+
   // GC support
   static void gc_prologue(bool resize_and_rehash_table);
   static void gc_epilogue();
@@ -75,6 +75,15 @@ void StringDedupThreadImpl<S>::do_deduplication() {
         }
       }
 
+      // Grow the table if needed, outside of GC pauses
+      while (StringDedupTable::grow_step()) {
+        if (sts_join.should_yield()) {
+          stat.mark_block();
+          sts_join.yield();
+          stat.mark_unblock();
+        }
+      }
+
       stat.mark_done();
 
       total_stat.add(&stat);
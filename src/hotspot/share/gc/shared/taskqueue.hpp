@@ -28,15 +28,15 @@
 #include "memory/allocation.hpp"
 #include "memory/padded.hpp"
 #include "oops/oopsHierarchy.hpp"
+#include "runtime/globals.hpp"
 #include "utilities/ostream.hpp"
 #include "utilities/stack.hpp"
 
-// Simple TaskQueue stats that are collected by default in debug builds.
+// Simple TaskQueue stats. They are compiled into all builds, and collected
+// with TaskQueueStatistics, which is on by default in debug builds.
 
-#if !defined(TASKQUEUE_STATS) && defined(ASSERT)
+#if !defined(TASKQUEUE_STATS)
 #define TASKQUEUE_STATS 1
-#elif !defined(TASKQUEUE_STATS)
-#define TASKQUEUE_STATS 0
 #endif
 
 #if TASKQUEUE_STATS
@@ -62,11 +62,11 @@ public:
 public:
   inline TaskQueueStats()       { reset(); }
 
-  inline void record_push()          { ++_stats[push]; }
-  inline void record_pop()           { ++_stats[pop]; }
-  inline void record_pop_slow()      { record_pop(); ++_stats[pop_slow]; }
-  inline void record_steal_attempt() { ++_stats[steal_attempt]; }
-  inline void record_steal()         { ++_stats[steal]; }
+  inline void record_push()          { if (TaskQueueStatistics) ++_stats[push]; }
+  inline void record_pop()           { if (TaskQueueStatistics) ++_stats[pop]; }
+  inline void record_pop_slow()      { record_pop(); if (TaskQueueStatistics) ++_stats[pop_slow]; }
+  inline void record_steal_attempt() { if (TaskQueueStatistics) ++_stats[steal_attempt]; }
+  inline void record_steal()         { if (TaskQueueStatistics) ++_stats[steal]; }
   inline void record_overflow(size_t new_length);
 
   TaskQueueStats & operator +=(const TaskQueueStats & addend);
@@ -90,6 +90,9 @@ private:
 };
 
 void TaskQueueStats::record_overflow(size_t new_len) {
+  if (!TaskQueueStatistics) {
+    return;
+  }
   ++_stats[overflow];
   if (new_len > _stats[overflow_max_len]) _stats[overflow_max_len] = new_len;
 }
@@ -304,6 +307,11 @@ private:
   volatile E* _elems;
 
   DEFINE_PAD_MINUS_SIZE(1, DEFAULT_CACHE_LINE_SIZE, sizeof(E*));
+  // The NUMA node the queue owner last ran on when stealing. Written by the
+  // owner and read by other threads selecting a victim queue.
+  volatile int _owner_numa_id;
+
+  DEFINE_PAD_MINUS_SIZE(2, DEFAULT_CACHE_LINE_SIZE, sizeof(int));
   // Queue owner local variables. Not to be accessed by other threads.
 
   static const uint InvalidQueueId = uint(-1);
@@ -311,10 +319,19 @@ private:
 
   int _seed; // Current random seed used for selecting a random queue during stealing.
 
-  DEFINE_PAD_MINUS_SIZE(2, DEFAULT_CACHE_LINE_SIZE, sizeof(uint) + sizeof(int));
+  // Number of calls to update_owner_numa_id() until the NUMA node is looked up again.
+  static const uint NumaIdRefreshInterval = 256;
+  uint _numa_id_refresh_count;
+
+  DEFINE_PAD_MINUS_SIZE(3, DEFAULT_CACHE_LINE_SIZE, 2 * sizeof(uint) + sizeof(int));
 public:
   int next_random_queue_id();
 
+  // Publish the NUMA node of the queue owner. To be called by the owner;
+  // the node is only looked up every NumaIdRefreshInterval calls.
+  void update_owner_numa_id();
+  int owner_numa_id() const                  { return _owner_numa_id; }
+
   void set_last_stolen_queue_id(uint id)     { _last_stolen_queue_id = id; }
   uint last_stolen_queue_id() const          { return _last_stolen_queue_id; }
   bool is_last_stolen_queue_id_valid() const { return _last_stolen_queue_id != InvalidQueueId; }
@@ -322,7 +339,8 @@ public:
 };
 
 template<class E, MEMFLAGS F, unsigned int N>
-GenericTaskQueue<E, F, N>::GenericTaskQueue() : _last_stolen_queue_id(InvalidQueueId), _seed(17 /* random number */) {
+GenericTaskQueue<E, F, N>::GenericTaskQueue() :
+  _owner_numa_id(-1), _last_stolen_queue_id(InvalidQueueId), _seed(17 /* random number */), _numa_id_refresh_count(0) {
   assert(sizeof(Age) == sizeof(size_t), "Depends on this.");
 }
 
@@ -386,6 +404,7 @@ private:
   uint _n;
   T** _queues;
 
+  uint select_victim(T* local_queue, uint queue_num, uint excluded);
   bool steal_best_of_2(uint queue_num, E& t);
 
 public:
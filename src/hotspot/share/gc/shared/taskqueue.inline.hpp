@@ -30,6 +30,7 @@
 #include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/orderAccess.hpp"
+#include "runtime/os.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/stack.inline.hpp"
 
@@ -256,6 +257,42 @@ int GenericTaskQueue<E, F, N>::next_random_queue_id() {
   return randomParkAndMiller(&_seed);
 }
 
+template<class E, MEMFLAGS F, unsigned int N>
+inline void GenericTaskQueue<E, F, N>::update_owner_numa_id() {
+  if (_numa_id_refresh_count > 0) {
+    _numa_id_refresh_count--;
+    return;
+  }
+  _numa_id_refresh_count = NumaIdRefreshInterval;
+  int id = os::numa_get_group_id();
+  if (id != _owner_numa_id) {
+    _owner_numa_id = id;
+  }
+}
+
+template<class T, MEMFLAGS F> uint
+GenericTaskQueueSet<T, F>::select_victim(T* local_queue, uint queue_num, uint excluded) {
+  // Number of extra random picks made to find a victim on the same NUMA node
+  const uint numa_retries = 4;
+
+  uint k = queue_num;
+  while (k == queue_num || k == excluded) {
+    k = local_queue->next_random_queue_id() % _n;
+  }
+
+  if (UseNUMAAwareTaskStealing) {
+    const int numa_id = local_queue->owner_numa_id();
+    for (uint i = 0; i < numa_retries && _queues[k]->owner_numa_id() != numa_id; i++) {
+      uint candidate = local_queue->next_random_queue_id() % _n;
+      if (candidate != queue_num && candidate != excluded) {
+        k = candidate;
+      }
+    }
+  }
+
+  return k;
+}
+
 template<class T, MEMFLAGS F> bool
 GenericTaskQueueSet<T, F>::steal_best_of_2(uint queue_num, E& t) {
   if (_n > 2) {
@@ -266,15 +303,10 @@ GenericTaskQueueSet<T, F>::steal_best_of_2(uint queue_num, E& t) {
       k1 = local_queue->last_stolen_queue_id();
       assert(k1 != queue_num, "Should not be the same");
     } else {
-      while (k1 == queue_num) {
-        k1 = local_queue->next_random_queue_id() % _n;
-      }
+      k1 = select_victim(local_queue, queue_num, queue_num);
     }
 
-    uint k2 = queue_num;
-    while (k2 == queue_num || k2 == k1) {
-      k2 = local_queue->next_random_queue_id() % _n;
-    }
+    uint k2 = select_victim(local_queue, queue_num, k1);
     // Sample both and try the larger.
     uint sz1 = _queues[k1]->size();
     uint sz2 = _queues[k2]->size();
@@ -309,6 +341,11 @@ GenericTaskQueueSet<T, F>::steal_best_of_2(uint queue_num, E& t) {
 
 template<class T, MEMFLAGS F> bool
 GenericTaskQueueSet<T, F>::steal(uint queue_num, E& t) {
+  if (UseNUMAAwareTaskStealing) {
+    // Publish the node we are running on, for other threads selecting victims
+    queue(queue_num)->update_owner_numa_id();
+  }
+
   for (uint i = 0; i < 2 * _n; i++) {
     TASKQUEUE_STATS_ONLY(queue(queue_num)->stats.record_steal_attempt());
     if (steal_best_of_2(queue_num, t)) {
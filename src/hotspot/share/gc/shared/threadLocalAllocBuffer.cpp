@@ -25,6 +25,8 @@
 #include "precompiled.hpp"
 #include "gc/shared/collectedHeap.hpp"
 #include "gc/shared/threadLocalAllocBuffer.inline.hpp"
+#include "jfr/jfrEvents.hpp"
+#include "jfr/support/jfrThreadId.hpp"
 #include "logging/log.hpp"
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
@@ -58,6 +60,8 @@ void ThreadLocalAllocBuffer::accumulate_and_reset_statistics(ThreadLocalAllocSta
   print_stats("gc");
 
   if (_number_of_refills > 0) {
+    send_statistics_event();
+
     // Update allocation history if a reasonable amount of eden was allocated.
     bool update_allocation_history = used > 0.5 * capacity;
 
@@ -145,6 +149,47 @@ void ThreadLocalAllocBuffer::resize() {
   set_refill_waste_limit(initial_refill_waste_limit());
 }
 
+// A thread whose allocation matches its history takes _target_refills TLABs
+// while all of eden is used, so its refills keep pace with the eden usage.
+// A thread that has run past its expected number of refills while less
+// than half of the matching share of eden was used allocates at more than
+// twice the expected rate. Instead of waiting for the next GC to resize its
+// TLAB, double the desired size, up to the size the thread would get if it
+// was doing all the allocation in eden.
+void ThreadLocalAllocBuffer::resize_on_refill_burst() {
+  size_t capacity = Universe::heap()->tlab_capacity(thread());
+  size_t used = Universe::heap()->tlab_used(thread());
+  if ((double) _number_of_refills * capacity <= 2.0 * _target_refills * used) {
+    return;
+  }
+
+  capacity /= HeapWordSize;
+  size_t limit = clamp(capacity / _target_refills, min_size(), max_size());
+  size_t new_size = align_object_size(MIN2(desired_size() * 2, limit));
+
+  if (new_size > desired_size()) {
+    log_trace(gc, tlab)("TLAB refill burst: thread: " INTPTR_FORMAT " [id: %2d]"
+                        " refills %d desired_size: " SIZE_FORMAT " -> " SIZE_FORMAT,
+                        p2i(thread()), thread()->osthread()->thread_id(),
+                        _number_of_refills, desired_size(), new_size);
+    set_desired_size(new_size);
+  }
+}
+
+void ThreadLocalAllocBuffer::send_statistics_event() {
+  EventTLABStatistics event;
+  if (event.should_commit()) {
+    event.set_thread(JFR_THREAD_ID(thread()));
+    event.set_refills(_number_of_refills);
+    event.set_slowAllocations(_slow_allocations);
+    event.set_desiredSize(_desired_size * HeapWordSize);
+    event.set_allocated(_allocated_size * HeapWordSize);
+    event.set_gcWaste((u8)_gc_waste * HeapWordSize);
+    event.set_slowRefillWaste((u8)_slow_refill_waste * HeapWordSize);
+    event.commit();
+  }
+}
+
 void ThreadLocalAllocBuffer::reset_statistics() {
   _number_of_refills = 0;
   _fast_refill_waste = 0;
@@ -164,6 +209,13 @@ void ThreadLocalAllocBuffer::fill(HeapWord* start,
 
   initialize(start, top, start + new_size - alignment_reserve());
 
+  // Check for a refill burst once the thread runs past its expected
+  // number of refills, and then again after each further _target_refills.
+  if (ResizeTLAB && ResizeTLABPromptly && _number_of_refills > _target_refills &&
+      (_number_of_refills - 1) % _target_refills == 0) {
+    resize_on_refill_burst();
+  }
+
   // Reset amount of internal fragmentation
   set_refill_waste_limit(initial_refill_waste_limit());
 }
@@ -98,6 +98,12 @@ private:
 
   void accumulate_and_reset_statistics(ThreadLocalAllocStats* stats);
 
+  // Grow the desired size of a thread that needs many more refills than
+  // its allocation history predicted for the eden used so far.
+  void resize_on_refill_burst();
+
+  void send_statistics_event();
+
   void print_stats(const char* tag);
 
   Thread* thread();
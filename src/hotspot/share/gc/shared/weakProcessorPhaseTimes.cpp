@@ -193,7 +193,8 @@ void WeakProcessorPhaseTimes::record_worker_items(uint worker_id,
   phase_data->set_or_add_thread_work_item(worker_id, num_total, TotalItems);
 }
 
-static double elapsed_time_sec(Ticks start_time, Ticks end_time) {
+template <typename T>
+static double elapsed_time_sec(T start_time, T end_time) {
   return (end_time - start_time).seconds();
 }
 
@@ -215,7 +216,7 @@ WeakProcessorPhaseTimeTracker::WeakProcessorPhaseTimeTracker(WeakProcessorPhaseT
   _times(times),
   _phase(phase),
   _worker_id(worker_id),
-  _start_time(Ticks::now())
+  _start_time(FastTicks::now())
 {
   assert_oopstorage_phase(_phase);
   assert(_times == NULL || worker_id < _times->active_workers(),
@@ -227,14 +228,14 @@ WeakProcessorPhaseTimeTracker::WeakProcessorPhaseTimeTracker(WeakProcessorPhaseT
   _times(times),
   _phase(phase),
   _worker_id(0),
-  _start_time(Ticks::now())
+  _start_time(FastTicks::now())
 {
   assert_serial_phase(phase);
 }
 
 WeakProcessorPhaseTimeTracker::~WeakProcessorPhaseTimeTracker() {
   if (_times != NULL) {
-    double time_sec = elapsed_time_sec(_start_time, Ticks::now());
+    double time_sec = elapsed_time_sec(_start_time, FastTicks::now());
     if (is_serial_phase(_phase)) {
       _times->record_phase_time_sec(_phase, time_sec);
     } else {
@@ -108,7 +108,7 @@ private:
   WeakProcessorPhaseTimes* _times;
   WeakProcessorPhase _phase;
   uint _worker_id;
-  Ticks _start_time;
+  FastTicks _start_time;
 
 public:
   // For tracking serial phase times.
@@ -24,6 +24,7 @@
 
 #include "precompiled.hpp"
 #include "gc/shared/workerDataArray.inline.hpp"
+#include "jfr/jfrEvents.hpp"
 #include "utilities/ostream.hpp"
 
 template <>
@@ -89,3 +90,28 @@ void WorkerDataArray<size_t>::WDAPrinter::details(const WorkerDataArray<size_t>*
   }
   out->cr();
 }
+
+template <>
+void WorkerDataArray<double>::send_worker_events(uint gc_id, const char* name) const {
+  if (!EventGCPhaseWorkerTime::is_enabled()) {
+    return;
+  }
+  const WorkerDataArray<size_t>* work_items = _thread_work_items[0];
+  for (uint i = 0; i < _length; ++i) {
+    double value = get(i);
+    if (value == uninitialized()) {
+      continue;
+    }
+    size_t count = 0;
+    if (work_items != NULL && work_items->get(i) != work_items->uninitialized()) {
+      count = work_items->get(i);
+    }
+    EventGCPhaseWorkerTime event;
+    event.set_gcId(gc_id);
+    event.set_gcWorkerId(i);
+    event.set_name(name);
+    event.set_time((s8)(value * NANOSECS_PER_SEC));
+    event.set_workItems(count);
+    event.commit();
+  }
+}
@@ -93,6 +93,10 @@ private:
  public:
   void print_summary_on(outputStream* out, bool print_sum = true) const;
   void print_details_on(outputStream* out) const;
+
+  // Send a GCPhaseWorkerTime event for every worker with a recorded time,
+  // along with the first work item count linked to the phase, if any.
+  void send_worker_events(uint gc_id, const char* name) const;
 };
 
 #endif // SHARE_GC_SHARED_WORKERDATAARRAY_HPP
@@ -201,3 +201,12 @@ uint WorkerPolicy::calc_active_conc_workers(uintx total_workers,
     return no_of_gc_threads;
   }
 }
+
+uint WorkerPolicy::calc_workers_for_work(uint max_workers,
+                                         size_t work_items,
+                                         size_t items_per_worker) {
+  assert(max_workers > 0, "Must have some workers");
+  assert(items_per_worker > 0, "Must give each worker some work");
+  size_t wanted = work_items / items_per_worker + ((work_items % items_per_worker) != 0 ? 1 : 0);
+  return (uint)clamp(wanted, (size_t)1, (size_t)max_workers);
+}
@@ -73,6 +73,13 @@ public:
                                        uintx active_workers,
                                        uintx application_workers);
 
+  // Return number of GC threads to use for a phase of a pause with the given
+  // amount of work. Small phases then do not pay for waking up and
+  // terminating workers that would find nothing to do.
+  static uint calc_workers_for_work(uint max_workers,
+                                    size_t work_items,
+                                    size_t items_per_worker);
+
 };
 
 #endif // SHARE_GC_SHARED_WORKERPOLICY_HPP
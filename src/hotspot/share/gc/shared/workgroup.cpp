@@ -105,6 +105,11 @@ void AbstractWorkGang::threads_do(ThreadClosure* tc) const {
 //
 // Semaphores don't require the worker threads to re-claim the lock when they wake up.
 // This helps lowering the latency when starting and stopping the worker threads.
+//
+// Every worker waits on a semaphore of its own, and a task for 'num_workers' workers
+// wakes up exactly the workers with the lowest ids. Tasks run with few workers then
+// do not make all idle workers contend on a single semaphore, and the same threads,
+// with warm caches, run the small tasks.
 class SemaphoreGangTaskDispatcher : public GangTaskDispatcher {
   // The task currently being dispatched to the GangWorkers.
   AbstractGangTask* _task;
@@ -112,32 +117,47 @@ class SemaphoreGangTaskDispatcher : public GangTaskDispatcher {
   volatile uint _started;
   volatile uint _not_finished;
 
-  // Semaphore used to start the GangWorkers.
-  Semaphore* _start_semaphore;
+  const uint _max_workers;
+  // Semaphores used to start the GangWorkers, one per worker.
+  Semaphore** _start_semaphores;
   // Semaphore used to notify the coordinator that all workers are done.
   Semaphore* _end_semaphore;
 
 public:
-  SemaphoreGangTaskDispatcher() :
+  SemaphoreGangTaskDispatcher(uint max_workers) :
       _task(NULL),
       _started(0),
       _not_finished(0),
-      _start_semaphore(new Semaphore()),
-      _end_semaphore(new Semaphore())
-{ }
+      _max_workers(max_workers),
+      _start_semaphores(NEW_C_HEAP_ARRAY(Semaphore*, max_workers, mtGC)),
+      _end_semaphore(new Semaphore()) {
+    for (uint i = 0; i < _max_workers; i++) {
+      _start_semaphores[i] = new Semaphore();
+    }
+  }
 
   ~SemaphoreGangTaskDispatcher() {
-    delete _start_semaphore;
+    for (uint i = 0; i < _max_workers; i++) {
+      delete _start_semaphores[i];
+    }
+    FREE_C_HEAP_ARRAY(Semaphore*, _start_semaphores);
     delete _end_semaphore;
   }
 
-  void coordinator_execute_on_workers(AbstractGangTask* task, uint num_workers) {
+  void coordinator_execute_on_workers(AbstractGangTask* task, uint num_workers, uint num_created) {
+    assert(num_workers <= _max_workers, "%u workers, but only %u semaphores", num_workers, _max_workers);
+    assert(num_created > 0, "No workers to dispatch to");
+
     // No workers are allowed to read the state variables until they have been signaled.
     _task         = task;
     _not_finished = num_workers;
 
-    // Dispatch 'num_workers' number of tasks.
-    _start_semaphore->signal(num_workers);
+    // Dispatch 'num_workers' number of tasks to the first workers. If some workers
+    // could not be created, the first ones run several of the tasks in turn.
+    uint num_woken = MIN2(num_workers, num_created);
+    for (uint i = 0; i < num_workers; i++) {
+      _start_semaphores[i % num_woken]->signal();
+    }
 
     // Wait for the last worker to signal the coordinator.
     _end_semaphore->wait();
@@ -146,19 +166,18 @@ public:
     assert(_not_finished == 0, "%d not finished workers?", _not_finished);
     _task    = NULL;
     _started = 0;
-
   }
 
-  WorkData worker_wait_for_task() {
+  WorkData worker_wait_for_task(uint thread_id) {
+    assert(thread_id < _max_workers, "Worker thread id %u out of range", thread_id);
+
     // Wait for the coordinator to dispatch a task.
-    _start_semaphore->wait();
+    _start_semaphores[thread_id]->wait();
 
     uint num_started = Atomic::add(&_started, 1u);
 
     // Subtract one to get a zero-indexed worker id.
-    uint worker_id = num_started - 1;
-
-    return WorkData(_task, worker_id);
+    return WorkData(_task, num_started - 1);
   }
 
   void worker_done_with_task() {
@@ -195,7 +214,7 @@ class MutexGangTaskDispatcher : public GangTaskDispatcher {
     delete _monitor;
   }
 
-  void coordinator_execute_on_workers(AbstractGangTask* task, uint num_workers) {
+  void coordinator_execute_on_workers(AbstractGangTask* task, uint num_workers, uint num_created) {
     MonitorLocker ml(_monitor, Mutex::_no_safepoint_check_flag);
 
     _task        = task;
@@ -215,7 +234,7 @@ class MutexGangTaskDispatcher : public GangTaskDispatcher {
     _finished    = 0;
   }
 
-  WorkData worker_wait_for_task() {
+  WorkData worker_wait_for_task(uint /* unused */) {
     MonitorLocker ml(_monitor, Mutex::_no_safepoint_check_flag);
 
     while (_num_workers == 0 || _started == _num_workers) {
@@ -242,9 +261,9 @@ class MutexGangTaskDispatcher : public GangTaskDispatcher {
   }
 };
 
-static GangTaskDispatcher* create_dispatcher() {
+static GangTaskDispatcher* create_dispatcher(uint max_workers) {
   if (UseSemaphoreGCThreadsSynchronization) {
-    return new SemaphoreGangTaskDispatcher();
+    return new SemaphoreGangTaskDispatcher(max_workers);
   }
 
   return new MutexGangTaskDispatcher();
@@ -255,7 +274,7 @@ WorkGang::WorkGang(const char* name,
                    bool  are_GC_task_threads,
                    bool  are_ConcurrentGC_threads) :
     AbstractWorkGang(name, workers, are_GC_task_threads, are_ConcurrentGC_threads),
-    _dispatcher(create_dispatcher())
+    _dispatcher(create_dispatcher(workers))
 { }
 
 WorkGang::~WorkGang() {
@@ -277,7 +296,7 @@ void WorkGang::run_task(AbstractGangTask* task, uint num_workers) {
   guarantee(num_workers > 0, "Trying to execute task %s with zero workers", task->name());
   uint old_num_workers = _active_workers;
   update_active_workers(num_workers);
-  _dispatcher->coordinator_execute_on_workers(task, num_workers);
+  _dispatcher->coordinator_execute_on_workers(task, num_workers, created_workers());
   update_active_workers(old_num_workers);
 }
 
@@ -317,7 +336,7 @@ void AbstractGangWorker::print_on(outputStream* st) const {
 void AbstractGangWorker::print() const { print_on(tty); }
 
 WorkData GangWorker::wait_for_task() {
-  return gang()->dispatcher()->worker_wait_for_task();
+  return gang()->dispatcher()->worker_wait_for_task(id());
 }
 
 void GangWorker::signal_task_done() {
@@ -87,15 +87,15 @@ class GangTaskDispatcher : public CHeapObj<mtGC> {
 
   // Coordinator API.
 
-  // Distributes the task out to num_workers workers.
-  // Returns when the task has been completed by all workers.
-  virtual void coordinator_execute_on_workers(AbstractGangTask* task, uint num_workers) = 0;
+  // Distributes the task out to num_workers workers, of which num_created
+  // have been created. Returns when the task has been completed by all workers.
+  virtual void coordinator_execute_on_workers(AbstractGangTask* task, uint num_workers, uint num_created) = 0;
 
   // Worker API.
 
-  // Waits for a task to become available to the worker.
-  // Returns when the worker has been assigned a task.
-  virtual WorkData worker_wait_for_task() = 0;
+  // Waits for a task to become available to the worker thread with the given
+  // id. Returns when the worker has been assigned a task.
+  virtual WorkData worker_wait_for_task(uint thread_id) = 0;
 
   // Signal to the coordinator that the worker is done with the assigned task.
   virtual void     worker_done_with_task() = 0;
@@ -165,7 +165,7 @@ oop ShenandoahBarrierSet::load_reference_barrier_mutator_work(oop obj, T* load_a
                                       _heap->marking_context() : _heap->complete_marking_context();
 
       ShenandoahHeapRegion* r = _heap->heap_region_containing(obj);
-      assert(r->is_cset(), "sanity");
+      assert(r->is_cset() || r->is_humongous_start(), "sanity");
 
       HeapWord* cur = (HeapWord*)obj + obj->size();
 
@@ -110,7 +110,10 @@ void ShenandoahCollectionSet::update_region_status() {
   for (size_t index = 0; index < _heap->num_regions(); index ++) {
     ShenandoahHeapRegion* r = _heap->get_region(index);
     if (is_in(r)) {
-      r->make_cset();
+      // Humongous moves keep their regions humongous until they get trashed
+      if (!r->is_humongous()) {
+        r->make_cset();
+      }
     } else {
       assert (!r->is_cset(), "should not be cset");
     }
@@ -29,14 +29,22 @@
 #include "gc/shenandoah/shenandoahMarkingContext.inline.hpp"
 #include "gc/shenandoah/shenandoahTraversalGC.hpp"
 #include "logging/logStream.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/orderAccess.hpp"
+#include "runtime/os.hpp"
 
 ShenandoahFreeSet::ShenandoahFreeSet(ShenandoahHeap* heap, size_t max_regions) :
   _heap(heap),
   _mutator_free_bitmap(max_regions, mtGC),
   _collector_free_bitmap(max_regions, mtGC),
-  _max(max_regions)
+  _max(max_regions),
+  _gc_alloc_regions(NULL),
+  _gc_alloc_region_count(0)
 {
+  if (ShenandoahCPULocalGCAllocs) {
+    _gc_alloc_region_count = (uint) os::processor_count();
+    _gc_alloc_regions = NEW_C_HEAP_ARRAY(ShenandoahHeapRegion* volatile, _gc_alloc_region_count, mtGC);
+  }
   clear_internal();
 }
 
@@ -190,6 +198,10 @@ HeapWord* ShenandoahFreeSet::try_allocate_in(ShenandoahHeapRegion* r, Shenandoah
       _heap->marking_context()->capture_top_at_mark_start(r);
       _heap->traversal_gc()->traversal_set()->add_region_check_for_duplicates(r);
       OrderAccess::fence();
+    } else if (req.is_gc_alloc() && _gc_alloc_regions != NULL &&
+               is_collector_free(r->region_number()) && !has_no_alloc_capacity(r)) {
+      // Let the following GC allocations on this CPU go to this region without the lock.
+      install_gc_alloc_region(r);
     }
   }
 
@@ -222,6 +234,55 @@ HeapWord* ShenandoahFreeSet::try_allocate_in(ShenandoahHeapRegion* r, Shenandoah
   return result;
 }
 
+ShenandoahHeapRegion* volatile* ShenandoahFreeSet::gc_alloc_region_slot() const {
+  return &_gc_alloc_regions[os::processor_id() % _gc_alloc_region_count];
+}
+
+void ShenandoahFreeSet::install_gc_alloc_region(ShenandoahHeapRegion* r) {
+  assert_heaplock_owned_by_current_thread();
+
+  ShenandoahHeapRegion* volatile* slot = gc_alloc_region_slot();
+  if (Atomic::load(slot) != NULL) {
+    // The current region only failed a large shared allocation, keep it.
+    return;
+  }
+
+  // Retire the region from the collector view first: from now on, only the
+  // lock-free path allocates in it, until the free set is rebuilt.
+  size_t num = r->region_number();
+  _collector_free_bitmap.clear_bit(num);
+  if (touches_bounds(num)) {
+    adjust_bounds();
+  }
+  assert_bounds();
+
+  Atomic::release_store(slot, r);
+}
+
+HeapWord* ShenandoahFreeSet::par_allocate_gc(ShenandoahAllocRequest& req) {
+  assert(req.is_gc_alloc(), "Only GC allocations can go lock-free");
+
+  if (_gc_alloc_regions == NULL ||
+      req.size() > ShenandoahHeapRegion::humongous_threshold_words() ||
+      _heap->is_concurrent_traversal_in_progress()) {
+    return NULL;
+  }
+
+  ShenandoahHeapRegion* volatile* slot = gc_alloc_region_slot();
+  ShenandoahHeapRegion* r = Atomic::load_acquire(slot);
+  if (r == NULL) {
+    return NULL;
+  }
+
+  HeapWord* result = r->par_allocate_gc(req);
+  if (result == NULL && (req.is_lab_alloc() || has_no_alloc_capacity(r))) {
+    // The region cannot fit even the smallest LAB: clear the slot so that the
+    // next locked allocation installs a fresh region. Losing the race is fine.
+    Atomic::cmpxchg(slot, r, (ShenandoahHeapRegion*)NULL);
+  }
+  return result;
+}
+
 bool ShenandoahFreeSet::touches_bounds(size_t num) const {
   return num == _collector_leftmost || num == _collector_rightmost || num == _mutator_leftmost || num == _mutator_rightmost;
 }
@@ -257,18 +318,33 @@ void ShenandoahFreeSet::adjust_bounds() {
 HeapWord* ShenandoahFreeSet::allocate_contiguous(ShenandoahAllocRequest& req) {
   assert_heaplock_owned_by_current_thread();
 
+  if (req.is_gc_alloc()) {
+    // Humongous moves copy into the evacuation reserve first. It trails the heap,
+    // away from where the mutator looks for contiguous runs. Failing that, steal
+    // the empty regions from the mutator view, like allocate_single() does.
+    HeapWord* result = allocate_contiguous_in(req, true);
+    if (result == NULL) {
+      result = allocate_contiguous_in(req, false);
+    }
+    return result;
+  }
+
+  return allocate_contiguous_in(req, false);
+}
+
+HeapWord* ShenandoahFreeSet::allocate_contiguous_in(ShenandoahAllocRequest& req, bool collector_view) {
   size_t words_size = req.size();
   size_t num = ShenandoahHeapRegion::required_regions(words_size * HeapWordSize);
 
   // No regions left to satisfy allocation, bye.
-  if (num > mutator_count()) {
+  if (num > (collector_view ? collector_count() : mutator_count())) {
     return NULL;
   }
 
   // Find the continuous interval of $num regions, starting from $beg and ending in $end,
   // inclusive. Contiguous allocations are biased to the beginning.
 
-  size_t beg = _mutator_leftmost;
+  size_t beg = collector_view ? _collector_leftmost : _mutator_leftmost;
   size_t end = beg;
 
   while (true) {
@@ -279,7 +355,8 @@ HeapWord* ShenandoahFreeSet::allocate_contiguous(ShenandoahAllocRequest& req) {
 
     // If regions are not adjacent, then current [beg; end] is useless, and we may fast-forward.
     // If region is not completely free, the current [beg; end] is useless, and we may fast-forward.
-    if (!is_mutator_free(end) || !is_empty_or_trash(_heap->get_region(end))) {
+    bool is_free = collector_view ? is_collector_free(end) : is_mutator_free(end);
+    if (!is_free || !is_empty_or_trash(_heap->get_region(end))) {
       end++;
       beg = end;
       continue;
@@ -320,20 +397,29 @@ HeapWord* ShenandoahFreeSet::allocate_contiguous(ShenandoahAllocRequest& req) {
     r->set_top(r->bottom() + used_words);
     r->reset_alloc_metadata_to_shared();
 
-    _mutator_free_bitmap.clear_bit(r->region_number());
+    if (collector_view) {
+      _collector_free_bitmap.clear_bit(r->region_number());
+    } else {
+      _mutator_free_bitmap.clear_bit(r->region_number());
+    }
   }
 
-  // While individual regions report their true use, all humongous regions are
-  // marked used in the free set.
-  increase_used(ShenandoahHeapRegion::region_size_bytes() * num);
+  if (req.is_mutator_alloc()) {
+    // While individual regions report their true use, all humongous regions are
+    // marked used in the free set.
+    increase_used(ShenandoahHeapRegion::region_size_bytes() * num);
 
-  if (remainder != 0) {
-    // Record this remainder as allocation waste
-    _heap->notify_mutator_alloc_words(ShenandoahHeapRegion::region_size_words() - remainder, true);
+    if (remainder != 0) {
+      // Record this remainder as allocation waste
+      _heap->notify_mutator_alloc_words(ShenandoahHeapRegion::region_size_words() - remainder, true);
+    }
+  } else if (!collector_view) {
+    // Stolen from the mutator view, see flip_to_gc()
+    _capacity -= ShenandoahHeapRegion::region_size_bytes() * num;
   }
 
   // Allocated at left/rightmost? Move the bounds appropriately.
-  if (beg == _mutator_leftmost || end == _mutator_rightmost) {
+  if (touches_bounds(beg) || touches_bounds(end)) {
     adjust_bounds();
   }
   assert_bounds();
@@ -413,6 +499,12 @@ void ShenandoahFreeSet::clear_internal() {
   _collector_rightmost = 0;
   _capacity = 0;
   _used = 0;
+
+  // Regions installed in the GC allocation slots are retired until the next
+  // rebuild, which happens at a safepoint, so no lock-free allocation runs here.
+  for (uint i = 0; i < _gc_alloc_region_count; i++) {
+    _gc_alloc_regions[i] = NULL;
+  }
 }
 
 void ShenandoahFreeSet::rebuild() {
@@ -42,6 +42,16 @@ private:
   size_t _capacity;
   size_t _used;
 
+  // Per-CPU collector regions that GC allocations bump into without the heap
+  // lock, see ShenandoahCPULocalGCAllocs. These regions are retired from the
+  // collector view, so the locked path never allocates in them. The slots are
+  // only reset at safepoints, when no lock-free allocation is in flight.
+  ShenandoahHeapRegion* volatile* _gc_alloc_regions;
+  uint _gc_alloc_region_count;
+
+  ShenandoahHeapRegion* volatile* gc_alloc_region_slot() const;
+  void install_gc_alloc_region(ShenandoahHeapRegion* r);
+
   void assert_bounds() const NOT_DEBUG_RETURN;
   void assert_heaplock_owned_by_current_thread() const NOT_DEBUG_RETURN;
   void assert_heaplock_not_owned_by_current_thread() const NOT_DEBUG_RETURN;
@@ -52,6 +62,7 @@ private:
   HeapWord* try_allocate_in(ShenandoahHeapRegion* region, ShenandoahAllocRequest& req, bool& in_new_region);
   HeapWord* allocate_single(ShenandoahAllocRequest& req, bool& in_new_region);
   HeapWord* allocate_contiguous(ShenandoahAllocRequest& req);
+  HeapWord* allocate_contiguous_in(ShenandoahAllocRequest& req, bool collector_view);
 
   void flip_to_gc(ShenandoahHeapRegion* r);
 
@@ -89,6 +100,11 @@ public:
   }
 
   HeapWord* allocate(ShenandoahAllocRequest& req, bool& in_new_region);
+
+  // Try to allocate GC memory in the region of the current CPU without
+  // taking the heap lock. Returns NULL if the caller should take the lock.
+  HeapWord* par_allocate_gc(ShenandoahAllocRequest& req);
+
   size_t unsafe_peek_free() const;
 
   void print_on(outputStream* out) const;
@@ -835,7 +835,10 @@ HeapWord* ShenandoahHeap::allocate_memory(ShenandoahAllocRequest& req) {
 
   } else {
     assert(req.is_gc_alloc(), "Can only accept GC allocs here");
-    result = allocate_memory_under_lock(req, in_new_region);
+    result = _free_set->par_allocate_gc(req);
+    if (result == NULL) {
+      result = allocate_memory_under_lock(req, in_new_region);
+    }
     // Do not call handle_alloc_failure() here, because we cannot block.
     // The allocation failure would be handled by the LRB slowpath with handle_alloc_failure_evac().
   }
@@ -966,6 +969,10 @@ private:
     ShenandoahHeapRegion* r;
     while ((r =_cs->claim_next()) != NULL) {
       assert(r->has_live(), "Region " SIZE_FORMAT " should have been reclaimed early", r->region_number());
+      if (r->is_humongous_continuation()) {
+        // Humongous moves: the object is evacuated from its start region
+        continue;
+      }
       _sh->marked_object_iterate(r, &cl);
 
       if (ShenandoahPacing) {
@@ -1020,6 +1027,8 @@ void ShenandoahHeap::trash_humongous_region_at(ShenandoahHeapRegion* start) {
 
     assert(region->is_humongous(), "expect correct humongous start or continuation");
     assert(!region->is_cset(), "Humongous region should not be in collection set");
+    assert(!collection_set()->is_in(region) || is_full_gc_in_progress(),
+           "Only Full GC trashes a humongous region of a concurrent move");
 
     region->make_trash_immediate();
   }
@@ -2306,7 +2315,7 @@ private:
     while (r != NULL) {
       HeapWord* top_at_start_ur = r->concurrent_iteration_safe_limit();
       assert (top_at_start_ur >= r->bottom(), "sanity");
-      if (r->is_active() && !r->is_cset()) {
+      if (r->is_active() && !_heap->collection_set()->is_in(r)) {
         _heap->marked_object_oop_iterate(r, &cl, top_at_start_ur);
       }
       if (ShenandoahPacing) {
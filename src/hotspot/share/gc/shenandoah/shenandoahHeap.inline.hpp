@@ -250,7 +250,8 @@ inline oop ShenandoahHeap::evacuate_object(oop p, Thread* thread) {
 
   size_t size = p->size();
 
-  assert(!heap_region_containing(p)->is_humongous(), "never evacuate humongous objects");
+  assert(!heap_region_containing(p)->is_humongous() || ShenandoahConcurrentHumongousMoves,
+         "never evacuate humongous objects, unless moving them concurrently");
 
   bool alloc_from_gclab = true;
   HeapWord* copy = NULL;
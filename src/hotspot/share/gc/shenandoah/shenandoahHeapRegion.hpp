@@ -356,6 +356,9 @@ public:
   // Allocation (return NULL if full)
   inline HeapWord* allocate(size_t word_size, ShenandoahAllocRequest::Type type);
 
+  // Allocate GC memory without the heap lock, see ShenandoahCPULocalGCAllocs
+  inline HeapWord* par_allocate_gc(ShenandoahAllocRequest& req);
+
   HeapWord* allocate(size_t word_size) shenandoah_not_implemented_return(NULL)
 
   void clear_live_data();
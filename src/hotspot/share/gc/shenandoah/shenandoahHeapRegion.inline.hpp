@@ -51,6 +51,45 @@ HeapWord* ShenandoahHeapRegion::allocate(size_t size, ShenandoahAllocRequest::Ty
   }
 }
 
+// Lock-free bump allocation for GC allocations. Only used on regions that were
+// retired from the free set into a CPU-local GC allocation slot, so the locked
+// allocation path never allocates in this region concurrently.
+inline HeapWord* ShenandoahHeapRegion::par_allocate_gc(ShenandoahAllocRequest& req) {
+  assert(req.is_gc_alloc(), "Only GC allocations can go lock-free");
+  assert(is_regular(), "Region " SIZE_FORMAT " should have been allocated into under the lock", _region_number);
+
+  HeapWord* volatile* top_ptr = (HeapWord* volatile*) top_addr();
+  while (true) {
+    HeapWord* obj = Atomic::load(top_ptr);
+    size_t free = pointer_delta(end(), obj);
+    size_t size = req.size();
+
+    if (ShenandoahElasticTLAB && req.is_lab_alloc()) {
+      size = MIN2(size, align_down(free, MinObjAlignment));
+      if (size < req.min_size()) {
+        return NULL;
+      }
+    } else if (size > free) {
+      return NULL;
+    }
+
+    if (Atomic::cmpxchg(top_ptr, obj, obj + size) == obj) {
+      // The allocation sequence numbers are only bumped under the lock: the
+      // region keeps the one of the locked allocation that installed it.
+      if (req.type() == ShenandoahAllocRequest::_alloc_gclab) {
+        Atomic::add(&_gclab_allocs, size);
+      } else {
+        Atomic::add(&_shared_allocs, size);
+      }
+      req.set_actual_size(size);
+
+      assert(is_object_aligned(obj + size), "new top breaks alignment: " PTR_FORMAT, p2i(obj + size));
+      assert(is_object_aligned(obj),        "obj is not aligned: "       PTR_FORMAT, p2i(obj));
+      return obj;
+    }
+  }
+}
+
 inline void ShenandoahHeapRegion::adjust_alloc_metadata(ShenandoahAllocRequest::Type type, size_t size) {
   bool is_first_alloc = (top() == bottom());
 
@@ -115,6 +115,78 @@ ShenandoahHeuristics::RegionData* ShenandoahHeuristics::get_region_data_cache(si
   return res;
 }
 
+static bool is_free_after_cycle(ShenandoahHeapRegion* r, ShenandoahCollectionSet* collection_set) {
+  return r->is_empty() || r->is_trash() || collection_set->is_in(r);
+}
+
+void ShenandoahHeuristics::choose_humongous_move(ShenandoahCollectionSet* collection_set) {
+  ShenandoahHeap* heap = ShenandoahHeap::heap();
+  size_t num_regions = heap->num_regions();
+
+  // The copy needs a run of regions that are free during evacuation already.
+  size_t longest_run = 0;
+  size_t run = 0;
+  for (size_t i = 0; i < num_regions; i++) {
+    ShenandoahHeapRegion* r = heap->get_region(i);
+    if (r->is_empty() || r->is_trash()) {
+      run++;
+      longest_run = MAX2(longest_run, run);
+    } else {
+      run = 0;
+    }
+  }
+
+  // Moving an object only pays off if it joins the free regions around it into
+  // a run longer than any the heap has now. Take the one that joins the longest
+  // run, and only one per cycle: this is copying that the mutators may have to
+  // do in the load-reference-barrier.
+  size_t max_cset = (size_t)((1.0 * heap->max_capacity() / 100 * ShenandoahEvacReserve) / ShenandoahEvacWaste);
+  size_t best_start = 0;
+  size_t best_num = 0;
+  size_t best_run = longest_run;
+
+  for (size_t i = 0; i < num_regions; i++) {
+    ShenandoahHeapRegion* r = heap->get_region(i);
+    if (!r->is_humongous_start()) {
+      continue;
+    }
+
+    size_t last = i;
+    while (last + 1 < num_regions && heap->get_region(last + 1)->is_humongous_continuation()) {
+      last++;
+    }
+    size_t num = last - i + 1;
+
+    if (r->has_live() && !r->is_pinned() && num <= longest_run &&
+        collection_set->live_data() + num * ShenandoahHeapRegion::region_size_bytes() <= max_cset) {
+      size_t before = 0;
+      while (before < i && is_free_after_cycle(heap->get_region(i - before - 1), collection_set)) {
+        before++;
+      }
+      size_t after = 0;
+      while (last + after + 1 < num_regions && is_free_after_cycle(heap->get_region(last + after + 1), collection_set)) {
+        after++;
+      }
+
+      size_t joined = before + num + after;
+      if (before + after > 0 && joined > best_run) {
+        best_start = i;
+        best_num = num;
+        best_run = joined;
+      }
+    }
+    i = last;
+  }
+
+  if (best_num > 0) {
+    for (size_t i = best_start; i < best_start + best_num; i++) {
+      collection_set->add_region(heap->get_region(i));
+    }
+    log_info(gc, ergo)("Humongous Move: " SIZE_FORMAT " regions at " SIZE_FORMAT ", joins a free run of " SIZE_FORMAT
+                       " regions, longest now " SIZE_FORMAT, best_num, best_start, best_run, longest_run);
+  }
+}
+
 void ShenandoahHeuristics::choose_collection_set(ShenandoahCollectionSet* collection_set) {
   assert(collection_set->count() == 0, "Must be empty");
 
@@ -197,6 +269,9 @@ void ShenandoahHeuristics::choose_collection_set(ShenandoahCollectionSet* collec
 
   if (immediate_percent <= ShenandoahImmediateThreshold) {
     choose_collection_set_from_regiondata(collection_set, candidates, cand_idx, immediate_garbage + free);
+    if (ShenandoahHumongousMoves && ShenandoahConcurrentHumongousMoves) {
+      choose_humongous_move(collection_set);
+    }
     collection_set->update_region_status();
 
     size_t cset_percent = total_garbage == 0 ? 0 : (collection_set->garbage() * 100 / total_garbage);
@@ -105,6 +105,10 @@ protected:
 
   RegionData* get_region_data_cache(size_t num);
 
+  // Add the humongous object that fragments the free space the most to the
+  // collection set, see ShenandoahConcurrentHumongousMoves.
+  void choose_humongous_move(ShenandoahCollectionSet* set);
+
   virtual void choose_collection_set_from_regiondata(ShenandoahCollectionSet* set,
                                                      RegionData* data, size_t data_size,
                                                      size_t free) = 0;
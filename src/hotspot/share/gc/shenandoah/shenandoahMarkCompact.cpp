@@ -456,6 +456,9 @@ public:
     if (r->is_trash()) {
       r->recycle();
     }
+    // Humongous regions of an abandoned concurrent move are in the collection
+    // set without being in the cset state: the evacuated chain has been trashed
+    // above, and a chain that was not evacuated yet stays humongous.
     if (r->is_cset()) {
       r->make_regular_bypass();
     }
@@ -522,6 +525,10 @@ void ShenandoahMarkCompact::phase2_calculate_target_addresses(ShenandoahHeapRegi
     // This is needed because we are potentially sliding the data through them.
     ShenandoahEnsureHeapActiveClosure ecl;
     heap->heap_region_iterate(&ecl);
+
+    // Drop the collection set of the abandoned cycle, including moved humongous
+    // regions that may now be reused for compaction.
+    heap->collection_set()->clear();
   }
 
   // Compute the new addresses for regular objects
@@ -26,6 +26,8 @@
 #include "gc/shenandoah/shenandoahFreeSet.hpp"
 #include "gc/shenandoah/shenandoahHeap.inline.hpp"
 #include "gc/shenandoah/shenandoahPacer.hpp"
+#include "gc/shenandoah/shenandoahThreadLocalData.hpp"
+#include "jfr/jfrEvents.hpp"
 #include "runtime/atomic.hpp"
 
 /*
@@ -54,15 +56,44 @@
  * we need to multiply the tax by 3. Example: for 10 MB free and 90 MB used, GC would
  * come back with 3*90 MB budget, and thus for each 1 MB of allocation, we have to pay
  * 3*90 / 10 MBs. In the end, we would pay back the entire budget.
+ *
+ * The fixed slack stalls the application early in the cycle even when the allocations
+ * would comfortably fit in the free space. With ShenandoahPacingAdaptive, we forecast
+ * the phase duration from the GC rate measured in the past phases of the same kind,
+ * and the allocations during the phase from the measured allocation rate. Whatever
+ * the forecast says would not be allocated in the phase share of free space is made
+ * non-taxable. If allocations spike above the forecast, the taxable part is smaller,
+ * and the pacing is steeper than with the fixed slack.
  */
 
+ShenandoahPacer::ShenandoahPacer(ShenandoahHeap* heap) :
+        _heap(heap),
+        _progress_history(new TruncatedSeq(5)),
+        _alloc_rate(new TruncatedSeq(10)),
+        _phase(_idle),
+        _phase_start(os::elapsedTime()),
+        _phase_alloc_start(0),
+        _phase_work(0),
+        _epoch(0),
+        _tax_rate(1),
+        _phase_delay(0),
+        _phase_paced_threads(0),
+        _budget(0),
+        _progress(PACING_PROGRESS_UNINIT) {
+  for (int p = 0; p < _num_phases; p++) {
+    _gc_rate[p] = new TruncatedSeq(5);
+  }
+}
+
 void ShenandoahPacer::setup_for_mark() {
   assert(ShenandoahPacing, "Only be here when pacing is enabled");
 
   size_t live = update_and_get_progress_history();
   size_t free = _heap->free_set()->available();
 
-  size_t non_taxable = free * ShenandoahPacingCycleSlack / 100;
+  start_phase(_mark, live);
+
+  size_t non_taxable = non_taxable_for(free, free / 3);
   size_t taxable = free - non_taxable;
 
   double tax = 1.0 * live / taxable; // base tax for available free space
@@ -85,7 +116,9 @@ void ShenandoahPacer::setup_for_evac() {
   size_t used = _heap->collection_set()->used();
   size_t free = _heap->free_set()->available();
 
-  size_t non_taxable = free * ShenandoahPacingCycleSlack / 100;
+  start_phase(_evac, used);
+
+  size_t non_taxable = non_taxable_for(free, free / 2);
   size_t taxable = free - non_taxable;
 
   double tax = 1.0 * used / taxable; // base tax for available free space
@@ -109,7 +142,9 @@ void ShenandoahPacer::setup_for_updaterefs() {
   size_t used = _heap->used();
   size_t free = _heap->free_set()->available();
 
-  size_t non_taxable = free * ShenandoahPacingCycleSlack / 100;
+  start_phase(_updaterefs, used);
+
+  size_t non_taxable = non_taxable_for(free, free);
   size_t taxable = free - non_taxable;
 
   double tax = 1.0 * used / taxable; // base tax for available free space
@@ -138,7 +173,9 @@ void ShenandoahPacer::setup_for_traversal() {
   size_t live = update_and_get_progress_history();
   size_t free = _heap->free_set()->available();
 
-  size_t non_taxable = free * ShenandoahPacingCycleSlack / 100;
+  start_phase(_traversal, live);
+
+  size_t non_taxable = non_taxable_for(free, free);
   size_t taxable = free - non_taxable;
 
   double tax = 1.0 * live / taxable; // base tax for available free space
@@ -169,6 +206,8 @@ void ShenandoahPacer::setup_for_idle() {
   size_t initial = _heap->max_capacity() / 100 * ShenandoahPacingIdleSlack;
   double tax = 1;
 
+  start_phase(_idle, 0);
+
   restart_with(initial, tax);
 
   log_info(gc, ergo)("Pacer for Idle. Initial: " SIZE_FORMAT "%s, Alloc Tax Rate: %.1fx",
@@ -189,11 +228,91 @@ size_t ShenandoahPacer::update_and_get_progress_history() {
   }
 }
 
+const char* ShenandoahPacer::phase_name(Phase phase) {
+  switch (phase) {
+    case _idle:       return "Idle";
+    case _mark:       return "Mark";
+    case _evac:       return "Evacuation";
+    case _updaterefs: return "Update Refs";
+    case _traversal:  return "Traversal";
+    default:
+      ShouldNotReachHere();
+      return "N/A";
+  }
+}
+
+void ShenandoahPacer::start_phase(Phase phase, size_t work) {
+  double now = os::elapsedTime();
+  size_t allocated = _heap->bytes_allocated_since_gc_start();
+
+  // Record the rates seen in the phase that has just ended. Too short phases
+  // are mostly pause time, and would only skew the averages.
+  double elapsed = now - _phase_start;
+  if (elapsed > 0.001) {
+    // Allocation counter is reset at the start of the cycle
+    size_t phase_allocated = (allocated >= _phase_alloc_start) ? (allocated - _phase_alloc_start) : allocated;
+    _alloc_rate->add(phase_allocated / elapsed);
+
+    if (_phase != _idle) {
+      // Marking phases report the actual progress, for others we know the work in advance
+      size_t done = _phase_work;
+      if (_phase == _mark || _phase == _traversal) {
+        done = (size_t)MAX2<intptr_t>(0, Atomic::load(&_progress)) * HeapWordSize;
+      }
+      _gc_rate[_phase]->add(done / elapsed);
+    }
+  }
+
+  _phase = phase;
+  _phase_start = now;
+  _phase_alloc_start = allocated;
+  _phase_work = work;
+}
+
+size_t ShenandoahPacer::non_taxable_for(size_t free, size_t phase_share) const {
+  size_t min = free * ShenandoahPacingCycleSlack / 100;
+
+  TruncatedSeq* gc_rate_seq = _gc_rate[_phase];
+  if (!ShenandoahPacingAdaptive || _alloc_rate->num() == 0 || gc_rate_seq->num() == 0) {
+    return min;
+  }
+
+  // Be conservative: expect faster allocations and slower GC than on average.
+  double alloc_rate = _alloc_rate->avg() + _alloc_rate->sd();
+  double gc_rate = MAX2(gc_rate_seq->avg() - gc_rate_seq->sd(), gc_rate_seq->avg() / 2);
+  if (gc_rate <= 0) {
+    return min;
+  }
+
+  double duration = _phase_work / gc_rate;
+  double expected = alloc_rate * duration * ShenandoahPacingSurcharge;
+
+  // Never trust the forecast to leave all free space non-taxable
+  expected = MAX2(expected, (double)free / 100);
+
+  size_t non_taxable = min;
+  if (expected < phase_share) {
+    non_taxable = MAX2(min, phase_share - (size_t)expected);
+  }
+
+  log_debug(gc, ergo)("Pacer forecast for %s. Alloc Rate: " SIZE_FORMAT "%s/s, GC Rate: " SIZE_FORMAT "%s/s, "
+                      "Expected Duration: %.3fs, Expected Allocs: " SIZE_FORMAT "%s, Non-Taxable: " SIZE_FORMAT "%s",
+                      phase_name(_phase),
+                      byte_size_in_proper_unit((size_t)alloc_rate), proper_unit_for_byte_size((size_t)alloc_rate),
+                      byte_size_in_proper_unit((size_t)gc_rate),    proper_unit_for_byte_size((size_t)gc_rate),
+                      duration,
+                      byte_size_in_proper_unit((size_t)expected),   proper_unit_for_byte_size((size_t)expected),
+                      byte_size_in_proper_unit(non_taxable),        proper_unit_for_byte_size(non_taxable));
+  return non_taxable;
+}
+
 void ShenandoahPacer::restart_with(size_t non_taxable_bytes, double tax_rate) {
   size_t initial = (size_t)(non_taxable_bytes * tax_rate) >> LogHeapWordSize;
   STATIC_ASSERT(sizeof(size_t) <= sizeof(intptr_t));
   Atomic::xchg(&_budget, (intptr_t)initial);
   Atomic::store(&_tax_rate, tax_rate);
+  Atomic::store(&_phase_delay, (size_t)0);
+  Atomic::store(&_phase_paced_threads, (size_t)0);
   Atomic::inc(&_epoch);
 }
 
@@ -248,11 +367,18 @@ void ShenandoahPacer::pace_for_alloc(size_t words) {
     return;
   }
 
-  size_t max = ShenandoahPacingMaxDelay;
+  JavaThread* thread = JavaThread::current();
+  intptr_t epoch = Atomic::load(&_epoch);
+  size_t thread_delay = ShenandoahThreadLocalData::pacing_delay(thread, epoch);
+
+  size_t max = ShenandoahPacingAdaptive ? max_delay_for(thread_delay) : ShenandoahPacingMaxDelay;
   double start = os::elapsedTime();
 
+  EventShenandoahPacingDelay evt;
+
   size_t total = 0;
   size_t cur = 0;
+  bool forced = false;
 
   while (true) {
     // We could instead assist GC, but this would suffice for now.
@@ -265,7 +391,7 @@ void ShenandoahPacer::pace_for_alloc(size_t words) {
     }
     cur = MAX2<size_t>(1, cur);
 
-    JavaThread::current()->sleep(cur);
+    thread->sleep(cur);
 
     double end = os::elapsedTime();
     total = (size_t)((end - start) * 1000);
@@ -274,20 +400,57 @@ void ShenandoahPacer::pace_for_alloc(size_t words) {
       // Spent local time budget to wait for enough GC progress.
       // Breaking out and allocating anyway, which may mean we outpace GC,
       // and start Degenerated GC cycle.
-      _delays.add(total);
 
       // Forcefully claim the budget: it may go negative at this point, and
       // GC should replenish for this and subsequent allocations
       claim_for_alloc(words, true);
+      forced = true;
       break;
     }
 
     if (claim_for_alloc(words, false)) {
       // Acquired enough permit, nice. Can allocate now.
-      _delays.add(total);
       break;
     }
   }
+
+  _delays.add(total);
+  record_delay(epoch, thread_delay, total);
+
+  if (evt.should_commit()) {
+    evt.set_allocationSize(words * HeapWordSize);
+    evt.set_phaseDelay(thread_delay + total);
+    evt.set_forced(forced);
+    evt.commit();
+  }
+}
+
+size_t ShenandoahPacer::max_delay_for(size_t thread_delay) const {
+  // Threads that already took more than the fair share of the delays in this
+  // phase get proportionally shorter stalls, so that the pacing cost is spread
+  // over all allocating threads, instead of piling up on a few unlucky ones.
+  size_t max = ShenandoahPacingMaxDelay;
+  size_t threads = Atomic::load(&_phase_paced_threads);
+  if (thread_delay == 0 || threads == 0) {
+    return max;
+  }
+  size_t fair = Atomic::load(&_phase_delay) / threads;
+  if (thread_delay <= fair) {
+    return max;
+  }
+  return MAX2<size_t>(1, max * fair / thread_delay);
+}
+
+void ShenandoahPacer::record_delay(intptr_t epoch, size_t thread_delay, size_t delay) {
+  if (Atomic::load(&_epoch) != epoch) {
+    // Phase had changed while we were paced, its delay stats are gone.
+    return;
+  }
+  if (thread_delay == 0) {
+    Atomic::inc(&_phase_paced_threads);
+  }
+  Atomic::add(&_phase_delay, delay);
+  ShenandoahThreadLocalData::set_pacing_delay(Thread::current(), epoch, thread_delay + delay);
 }
 
 void ShenandoahPacer::print_on(outputStream* out) const {
@@ -297,6 +460,20 @@ void ShenandoahPacer::print_on(outputStream* out) const {
   out->print_cr("Max pacing delay is set for " UINTX_FORMAT " ms.", ShenandoahPacingMaxDelay);
   out->cr();
 
+  if (ShenandoahPacingAdaptive) {
+    out->print_cr("Adaptive pacing forecasts (rates are averages over the recent phases):");
+    out->print_cr("  %-12s " SIZE_FORMAT_W(8) "%s/s", "Allocation",
+                  byte_size_in_proper_unit((size_t)_alloc_rate->avg()), proper_unit_for_byte_size((size_t)_alloc_rate->avg()));
+    for (int p = _mark; p < _num_phases; p++) {
+      TruncatedSeq* seq = _gc_rate[p];
+      if (seq->num() > 0) {
+        out->print_cr("  %-12s " SIZE_FORMAT_W(8) "%s/s", phase_name((Phase)p),
+                      byte_size_in_proper_unit((size_t)seq->avg()), proper_unit_for_byte_size((size_t)seq->avg()));
+      }
+    }
+    out->cr();
+  }
+
   out->print_cr("Higher delay would prevent application outpacing the GC, but it will hide the GC latencies");
   out->print_cr("from the STW pause times. Pacing affects the individual threads, and so it would also be");
   out->print_cr("invisible to the usual profiling tools, but would add up to end-to-end application latency.");
@@ -37,17 +37,46 @@ class ShenandoahHeap;
  *
  * Currently it implements simple tax-and-spend pacing policy: GC threads provide
  * credit, allocating thread spend the credit, or stall when credit is not available.
+ *
+ * With ShenandoahPacingAdaptive, the pacer also measures the allocation rate and
+ * the GC rate of each phase, and uses their forecasts to size the non-taxable part
+ * of the budget. The stalls are then distributed across the paced threads, so that
+ * the threads that already took more than their share of delay in the current phase
+ * get shorter stalls.
  */
 class ShenandoahPacer : public CHeapObj<mtGC> {
 private:
+  enum Phase {
+    _idle,
+    _mark,
+    _evac,
+    _updaterefs,
+    _traversal,
+    _num_phases
+  };
+
   ShenandoahHeap* _heap;
   BinaryMagnitudeSeq _delays;
   TruncatedSeq* _progress_history;
 
+  // Allocation rate and per-phase GC rate history, in bytes per second
+  TruncatedSeq* _alloc_rate;
+  TruncatedSeq* _gc_rate[_num_phases];
+
+  // Set once per phase, by the thread that sets up the phase
+  Phase  _phase;
+  double _phase_start;
+  size_t _phase_alloc_start;
+  size_t _phase_work;
+
   // Set once per phase
   volatile intptr_t _epoch;
   volatile double _tax_rate;
 
+  // Delays taken by the paced threads in the current phase
+  volatile size_t _phase_delay;
+  volatile size_t _phase_paced_threads;
+
   // Heavily updated, protect from accidental false sharing
   DEFINE_PAD_MINUS_SIZE(0, DEFAULT_CACHE_LINE_SIZE, sizeof(volatile intptr_t));
   volatile intptr_t _budget;
@@ -59,13 +88,7 @@ private:
   DEFINE_PAD_MINUS_SIZE(3, DEFAULT_CACHE_LINE_SIZE, 0);
 
 public:
-  ShenandoahPacer(ShenandoahHeap* heap) :
-          _heap(heap),
-          _progress_history(new TruncatedSeq(5)),
-          _epoch(0),
-          _tax_rate(1),
-          _budget(0),
-          _progress(PACING_PROGRESS_UNINIT) {}
+  ShenandoahPacer(ShenandoahHeap* heap);
 
   void setup_for_idle();
   void setup_for_mark();
@@ -94,6 +117,13 @@ private:
   void restart_with(size_t non_taxable_bytes, double tax_rate);
 
   size_t update_and_get_progress_history();
+
+  void start_phase(Phase phase, size_t work);
+  size_t non_taxable_for(size_t free, size_t phase_share) const;
+  size_t max_delay_for(size_t thread_delay) const;
+  void record_delay(intptr_t epoch, size_t thread_delay, size_t delay);
+
+  static const char* phase_name(Phase phase);
 };
 
 #endif // SHARE_GC_SHENANDOAH_SHENANDOAHPACER_HPP
@@ -23,6 +23,7 @@
 
 #include "precompiled.hpp"
 
+#include "gc/shared/gcId.hpp"
 #include "gc/shared/workerDataArray.inline.hpp"
 #include "gc/shenandoah/shenandoahCollectorPolicy.hpp"
 #include "gc/shenandoah/shenandoahPhaseTimings.hpp"
@@ -97,6 +98,12 @@ void ShenandoahPhaseTimings::record_workers_end(Phase phase) {
     for (uint i = 0; i < GCParPhasesSentinel; i++) {
       double t = _worker_times->average(i);
       _timing_data[phase + i + 1]._secs.add(t);
+
+      const char* name = _phase_names[phase + i + 1];
+      while (*name == ' ') {
+        name++;
+      }
+      _worker_times->send_worker_events(i, name);
     }
   }
 }
@@ -157,6 +164,10 @@ void ShenandoahWorkerTimings::reset(uint i) {
   _gc_par_phases[i]->reset();
 }
 
+void ShenandoahWorkerTimings::send_worker_events(uint i, const char* name) const {
+  _gc_par_phases[i]->send_worker_events(GCId::current_or_undefined(), name);
+}
+
 void ShenandoahWorkerTimings::print() const {
   for (uint i = 0; i < ShenandoahPhaseTimings::GCParPhasesSentinel; i++) {
     _gc_par_phases[i]->print_summary_on(tty);
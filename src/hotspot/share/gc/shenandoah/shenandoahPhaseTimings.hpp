@@ -435,6 +435,7 @@ public:
   double average(uint i) const;
   void reset(uint i);
   void print() const;
+  void send_worker_events(uint i, const char* name) const;
 };
 
 class ShenandoahTerminationTimings : public CHeapObj<mtGC> {
@@ -39,7 +39,9 @@
 #include "memory/iterator.hpp"
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/thread.hpp"
+#include "runtime/vmThread.hpp"
 #include "services/management.hpp"
 
 ShenandoahSerialRoot::ShenandoahSerialRoot(ShenandoahSerialRoot::OopsDo oops_do, ShenandoahPhaseTimings::GCParPhases phase) :
@@ -109,26 +111,55 @@ void ShenandoahSerialWeakRoots::weak_oops_do(OopClosure* cl, uint worker_id) {
   weak_oops_do(&always_true, cl, worker_id);
 }
 
-ShenandoahThreadRoots::ShenandoahThreadRoots(bool is_par) : _is_par(is_par) {
+ShenandoahThreadRoots::ShenandoahThreadRoots(bool is_par) :
+  _is_par(is_par),
+  _java_threads(),
+  _claimed(0) {
+  // The claim token is still used for the VM thread.
   Threads::change_thread_claim_token();
 }
 
+uint ShenandoahThreadRoots::claim() {
+  return Atomic::add(&_claimed, ClaimStride) - ClaimStride;
+}
+
+class ShenandoahThreadOopsDoClosure : public ThreadClosure {
+private:
+  OopClosure* _f;
+  CodeBlobClosure* _cf;
+public:
+  ShenandoahThreadOopsDoClosure(OopClosure* f, CodeBlobClosure* cf) : _f(f), _cf(cf) {}
+  void do_thread(Thread* t) {
+    t->oops_do(_f, _cf);
+  }
+};
+
 void ShenandoahThreadRoots::oops_do(OopClosure* oops_cl, CodeBlobClosure* code_cl, uint worker_id) {
-  ShenandoahWorkerTimings* worker_times = ShenandoahHeap::heap()->phase_timings()->worker_times();
-  ShenandoahWorkerTimingsTracker timer(worker_times, ShenandoahPhaseTimings::ThreadRoots, worker_id);
-  ResourceMark rm;
-  Threads::possibly_parallel_oops_do(_is_par, oops_cl, code_cl);
+  ShenandoahThreadOopsDoClosure tc(oops_cl, code_cl);
+  threads_do(&tc, worker_id);
 }
 
 void ShenandoahThreadRoots::threads_do(ThreadClosure* tc, uint worker_id) {
   ShenandoahWorkerTimings* worker_times = ShenandoahHeap::heap()->phase_timings()->worker_times();
   ShenandoahWorkerTimingsTracker timer(worker_times, ShenandoahPhaseTimings::ThreadRoots, worker_id);
   ResourceMark rm;
-  Threads::possibly_parallel_threads_do(_is_par, tc);
+
+  const uint length = _java_threads.length();
+  for (uint start = claim(); start < length; start = claim()) {
+    const uint end = MIN2(start + ClaimStride, length);
+    for (uint i = start; i < end; i++) {
+      tc->do_thread(_java_threads.list()->thread_at(i));
+    }
+  }
+
+  VMThread* vmt = VMThread::vm_thread();
+  if (vmt->claim_threads_do(_is_par, Threads::thread_claim_token())) {
+    tc->do_thread(vmt);
+  }
 }
 
 ShenandoahThreadRoots::~ShenandoahThreadRoots() {
-  Threads::assert_all_threads_claimed();
+  assert(_claimed >= _java_threads.length(), "All Java threads should have been processed");
 }
 
 ShenandoahStringDedupRoots::ShenandoahStringDedupRoots() {
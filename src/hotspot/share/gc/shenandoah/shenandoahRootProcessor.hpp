@@ -31,6 +31,7 @@
 #include "gc/shenandoah/shenandoahPhaseTimings.hpp"
 #include "gc/shenandoah/shenandoahSharedVariables.hpp"
 #include "memory/iterator.hpp"
+#include "runtime/threadSMR.hpp"
 
 class ShenandoahSerialRoot {
 public:
@@ -168,9 +169,19 @@ public:
   void oops_do(T* cl, uint worker_id = 0);
 };
 
+// Java threads are claimed in chunks of ClaimStride threads from a snapshot
+// of the threads list instead of one at a time with the thread claim token.
+// With thousands of threads, every worker would otherwise walk the whole
+// list and attempt to claim each thread, contending on the claim tokens.
 class ShenandoahThreadRoots {
 private:
-  const bool _is_par;
+  static const uint ClaimStride = 8;
+
+  const bool        _is_par;
+  ThreadsListHandle _java_threads;
+  volatile uint     _claimed;
+
+  uint claim();
 public:
   ShenandoahThreadRoots(bool is_par);
   ~ShenandoahThreadRoots();
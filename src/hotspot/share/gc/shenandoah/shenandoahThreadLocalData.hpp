@@ -45,6 +45,8 @@ private:
   uint  _worker_id;
   bool _force_satb_flush;
   int  _disarmed_value;
+  intptr_t _pacing_epoch;
+  size_t   _pacing_delay;
 
   ShenandoahThreadLocalData() :
     _gc_state(0),
@@ -53,7 +55,9 @@ private:
     _gclab(NULL),
     _gclab_size(0),
     _worker_id(INVALID_WORKER_ID),
-    _force_satb_flush(false) {
+    _force_satb_flush(false),
+    _pacing_epoch(0),
+    _pacing_delay(0) {
   }
 
   ~ShenandoahThreadLocalData() {
@@ -146,6 +150,17 @@ public:
     data(thread)->_disarmed_value = value;
   }
 
+  // Pacing delay the thread took during the given pacer epoch, in milliseconds
+  static size_t pacing_delay(Thread* thread, intptr_t epoch) {
+    ShenandoahThreadLocalData* d = data(thread);
+    return (d->_pacing_epoch == epoch) ? d->_pacing_delay : 0;
+  }
+
+  static void set_pacing_delay(Thread* thread, intptr_t epoch, size_t delay) {
+    data(thread)->_pacing_epoch = epoch;
+    data(thread)->_pacing_delay = delay;
+  }
+
 #ifdef ASSERT
   static void set_evac_allowed(Thread* thread, bool evac_allowed) {
     if (evac_allowed) {
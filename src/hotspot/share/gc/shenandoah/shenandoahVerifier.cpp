@@ -175,14 +175,16 @@ private:
 
       fwd_reg = _heap->heap_region_containing(fwd);
 
-      // Verify that forwardee is not in the dead space:
-      check(ShenandoahAsserts::_safe_oop, obj, !fwd_reg->is_humongous(),
+      // Verify that forwardee is not in the dead space. Only the humongous moves
+      // have humongous forwardees, and those start their own humongous regions:
+      bool humongous_move = obj_reg->is_humongous_start() && fwd_reg->is_humongous_start();
+      check(ShenandoahAsserts::_safe_oop, obj, !fwd_reg->is_humongous() || humongous_move,
              "Should have no humongous forwardees");
 
       HeapWord *fwd_addr = (HeapWord *) fwd;
       check(ShenandoahAsserts::_safe_oop, obj, fwd_addr < fwd_reg->top(),
              "Forwardee start should be within the region");
-      check(ShenandoahAsserts::_safe_oop, obj, (fwd_addr + fwd->size()) <= fwd_reg->top(),
+      check(ShenandoahAsserts::_safe_oop, obj, humongous_move || (fwd_addr + fwd->size()) <= fwd_reg->top(),
              "Forwardee end should be within the region");
 
       oop fwd2 = (oop) ShenandoahForwarding::get_forwardee_raw_unchecked(fwd);
@@ -393,7 +395,7 @@ public:
     verify(r, !r->is_empty() || !r->has_live(),
            "Empty regions should not have live data");
 
-    verify(r, r->is_cset() == _heap->collection_set()->is_in(r),
+    verify(r, r->is_cset() == _heap->collection_set()->is_in(r) || r->is_humongous(),
            "Transitional: region flags and collection set agree");
 
     verify(r, r->is_empty() || r->seqnum_first_alloc() != 0,
@@ -211,6 +211,10 @@
           "Allow mixing mutator and collector allocations in a single "     \
           "region")                                                         \
                                                                             \
+  diagnostic(bool, ShenandoahCPULocalGCAllocs, true,                        \
+          "Give each CPU its own collector region to allocate GCLABs and "  \
+          "shared GC objects in without taking the heap lock")              \
+                                                                            \
   experimental(uintx, ShenandoahAllocSpikeFactor, 5,                        \
           "The amount of heap space to reserve for absorbing the "          \
           "allocation spikes. Larger value wastes more memory in "          \
@@ -281,6 +285,12 @@
           "the beginning of it.")                                           \
           range(1.0, 100.0)                                                 \
                                                                             \
+  experimental(bool, ShenandoahPacingAdaptive, false,                       \
+          "Forecast the allocation rate and the GC rate from the previous " \
+          "phases, and use the forecast to size the non-taxable budget "    \
+          "of the GC phases. Also shorten the pacing delays for threads "   \
+          "that already took more than their share of delay in the phase.") \
+                                                                            \
   experimental(uintx, ShenandoahCriticalFreeThreshold, 1,                   \
           "Percent of heap that needs to be free after recovery cycles, "   \
           "either Degenerated or Full GC. If this much space is not "       \
@@ -303,7 +313,13 @@
           "Allow moving humongous regions. This makes GC more resistant "   \
           "to external fragmentation that may otherwise fail other "        \
           "humongous allocations, at the expense of higher GC copying "     \
-          "costs. Currently affects stop-the-world (full) cycle only.")     \
+          "costs. Concurrent cycles only move them with "                  \
+          "ShenandoahConcurrentHumongousMoves.")                            \
+                                                                            \
+  experimental(bool, ShenandoahConcurrentHumongousMoves, false,             \
+          "Let concurrent cycles evacuate a humongous object when that "    \
+          "joins the free regions around it into a longer run than any "    \
+          "other in the heap. Needs ShenandoahHumongousMoves.")             \
                                                                             \
   diagnostic(bool, ShenandoahOOMDuringEvacALot, false,                      \
           "Simulate OOM during evacuation frequently.")                     \
@@ -84,6 +84,30 @@ bool ZDirector::rule_warmup() const {
   return used >= used_threshold;
 }
 
+size_t ZDirector::free_memory() {
+  // Calculate amount of free memory available to Java threads. Note that
+  // the heap reserve is not available to Java threads and is therefore not
+  // considered part of the free memory.
+  const size_t max_capacity = ZHeap::heap()->soft_max_capacity();
+  const size_t max_reserve = ZHeap::heap()->max_reserve();
+  const size_t used = ZHeap::heap()->used();
+  const size_t free_with_reserve = max_capacity - MIN2(max_capacity, used);
+  return free_with_reserve - MIN2(free_with_reserve, max_reserve);
+}
+
+double ZDirector::max_alloc_rate() {
+  // The allocation rate is a moving average and we multiply that with an
+  // allocation spike tolerance factor to guard against unforeseen phase
+  // changes in the allocate rate. We then add ~3.3 sigma to account for
+  // the allocation rate variance, which means the probability is 1 in 1000
+  // that a sample is outside of the confidence interval.
+  return (ZStatAllocRate::avg() * ZAllocationSpikeTolerance) + (ZStatAllocRate::avg_sd() * one_in_1000);
+}
+
+double ZDirector::time_until_oom() {
+  return free_memory() / (max_alloc_rate() + 1.0); // Plus 1.0B/s to avoid division by zero
+}
+
 bool ZDirector::rule_allocation_rate() const {
   if (!ZStatCycle::is_normalized_duration_trustable()) {
     // Rule disabled
@@ -96,23 +120,11 @@ bool ZDirector::rule_allocation_rate() const {
   // margin based on variations in the allocation rate and unforeseen
   // allocation spikes.
 
-  // Calculate amount of free memory available to Java threads. Note that
-  // the heap reserve is not available to Java threads and is therefore not
-  // considered part of the free memory.
-  const size_t max_capacity = ZHeap::heap()->soft_max_capacity();
-  const size_t max_reserve = ZHeap::heap()->max_reserve();
-  const size_t used = ZHeap::heap()->used();
-  const size_t free_with_reserve = max_capacity - MIN2(max_capacity, used);
-  const size_t free = free_with_reserve - MIN2(free_with_reserve, max_reserve);
-
   // Calculate time until OOM given the max allocation rate and the amount
-  // of free memory. The allocation rate is a moving average and we multiply
-  // that with an allocation spike tolerance factor to guard against unforeseen
-  // phase changes in the allocate rate. We then add ~3.3 sigma to account for
-  // the allocation rate variance, which means the probability is 1 in 1000
-  // that a sample is outside of the confidence interval.
-  const double max_alloc_rate = (ZStatAllocRate::avg() * ZAllocationSpikeTolerance) + (ZStatAllocRate::avg_sd() * one_in_1000);
-  const double time_until_oom = free / (max_alloc_rate + 1.0); // Plus 1.0B/s to avoid division by zero
+  // of free memory.
+  const size_t free = free_memory();
+  const double max_alloc_rate = ZDirector::max_alloc_rate();
+  const double time_until_oom = ZDirector::time_until_oom();
 
   // Calculate max duration of a GC cycle. The duration of GC is a moving
   // average, we add ~3.3 sigma to account for the GC duration variance.
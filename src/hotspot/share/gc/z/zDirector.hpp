@@ -34,6 +34,9 @@ private:
 
   ZMetronome _metronome;
 
+  static size_t free_memory();
+  static double max_alloc_rate();
+
   void sample_allocation_rate() const;
 
   bool rule_timer() const;
@@ -49,6 +52,10 @@ protected:
 
 public:
   ZDirector();
+
+  // Estimated time (in seconds) until the Java threads run out of free
+  // memory, given the max allocation rate.
+  static double time_until_oom();
 };
 
 #endif // SHARE_GC_Z_ZDIRECTOR_HPP
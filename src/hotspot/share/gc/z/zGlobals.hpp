@@ -55,6 +55,10 @@ const uint8_t     ZPageTypeSmall                = 0;
 const uint8_t     ZPageTypeMedium               = 1;
 const uint8_t     ZPageTypeLarge                = 2;
 
+// Page generations
+const uint8_t     ZPageGenerationYoung          = 0;
+const uint8_t     ZPageGenerationOld            = 1;
+
 // Page size shifts
 const size_t      ZPageSizeSmallShift           = ZGranuleSizeShift;
 extern size_t     ZPageSizeMediumShift;
@@ -41,6 +41,7 @@
 #include "memory/iterator.hpp"
 #include "memory/resourceArea.hpp"
 #include "runtime/handshake.hpp"
+#include "runtime/os.hpp"
 #include "runtime/safepoint.hpp"
 #include "runtime/thread.hpp"
 #include "utilities/debug.hpp"
@@ -405,7 +406,7 @@ void ZHeap::select_relocation_set() {
   }
 
   // Update statistics
-  ZStatRelocation::set_at_select_relocation_set(selector.relocating());
+  ZStatRelocation::set_at_select_relocation_set(selector.relocating(), selector.cost());
   ZStatHeap::set_at_select_relocation_set(selector.live(),
                                           selector.garbage(),
                                           reclaimed());
@@ -444,11 +445,13 @@ void ZHeap::relocate_start() {
 
 void ZHeap::relocate() {
   // Relocate relocation set
+  const double start = os::elapsedTime();
   const bool success = _relocate.relocate(&_relocation_set);
+  const double duration = os::elapsedTime() - start;
 
   // Update statistics
   ZStatSample(ZSamplerHeapUsedAfterRelocation, used());
-  ZStatRelocation::set_at_relocate_end(success);
+  ZStatRelocation::set_at_relocate_end(success, duration);
   ZStatHeap::set_at_relocate_end(capacity(), allocated(), reclaimed(),
                                  used(), used_high(), used_low());
 }
@@ -456,8 +459,14 @@ void ZHeap::relocate() {
 void ZHeap::object_iterate(ObjectClosure* cl, bool visit_weaks) {
   assert(SafepointSynchronize::is_at_safepoint(), "Should be at safepoint");
 
-  ZHeapIterator iter;
-  iter.objects_do(cl, visit_weaks);
+  ZHeapIterator iter(1 /* nworkers */, visit_weaks);
+  iter.object_iterate(cl, 0 /* worker_id */);
+}
+
+ParallelObjectIterator* ZHeap::parallel_object_iterator(uint nworkers, bool visit_weaks) {
+  assert(SafepointSynchronize::is_at_safepoint(), "Should be at safepoint");
+
+  return new ZHeapIterator(nworkers, visit_weaks);
 }
 
 void ZHeap::pages_do(ZPageClosure* cl) {
@@ -24,37 +24,65 @@
 #ifndef SHARE_GC_Z_ZHEAPITERATOR_HPP
 #define SHARE_GC_Z_ZHEAPITERATOR_HPP
 
+#include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/taskqueue.hpp"
 #include "gc/z/zGranuleMap.hpp"
-#include "memory/allocation.hpp"
-#include "utilities/stack.hpp"
+#include "gc/z/zLock.hpp"
+#include "gc/z/zRootsIterator.hpp"
+#include "gc/z/zStat.hpp"
 
 class ObjectClosure;
 class ZHeapIteratorBitMap;
+class ZHeapIteratorContext;
 
-class ZHeapIterator : public StackObj {
-  template<bool Concurrent, bool Weak> friend class ZHeapIteratorRootOopClosure;
-  template<bool VisitReferents> friend class ZHeapIteratorOopClosure;
+typedef OverflowTaskQueue<oop, mtGC>                  ZHeapIteratorQueue;
+typedef GenericTaskQueueSet<ZHeapIteratorQueue, mtGC> ZHeapIteratorQueues;
+
+// Visits all reachable objects. Several workers can share an iterator,
+// each one calling object_iterate() with its own worker id. The workers
+// claim the roots, and balance the traversal of the object graph by
+// stealing from each other's queues.
+class ZHeapIterator : public ParallelObjectIterator {
+  friend class ZHeapIteratorContext;
 
 private:
-  typedef ZGranuleMap<ZHeapIteratorBitMap*>         ZVisitMap;
-  typedef ZGranuleMapIterator<ZHeapIteratorBitMap*> ZVisitMapIterator;
-  typedef Stack<oop, mtGC>                          ZVisitStack;
+  typedef ZGranuleMap<ZHeapIteratorBitMap*>         ZHeapIteratorBitMaps;
+  typedef ZGranuleMapIterator<ZHeapIteratorBitMap*> ZHeapIteratorBitMapsIterator;
+
+  const bool                         _visit_weaks;
+  ZStatTimerDisable                  _timer_disable;
+  ZHeapIteratorBitMaps               _bitmaps;
+  ZLock                              _bitmaps_lock;
+  ZHeapIteratorQueues                _queues;
+  ZRootsIterator                     _roots;
+  ZConcurrentRootsIteratorClaimOther _concurrent_roots;
+  ZWeakRootsIterator                 _weak_roots;
+  ZConcurrentWeakRootsIterator       _concurrent_weak_roots;
+  TaskTerminator                     _terminator;
+
+  ZHeapIteratorBitMap* object_bitmap(oop obj);
+  bool mark_object(oop obj);
+
+  template <bool Concurrent, bool Weak, typename RootsIterator>
+  void push_roots(const ZHeapIteratorContext& context, RootsIterator& iter);
+
+  template <bool VisitWeaks>
+  void push_roots(const ZHeapIteratorContext& context);
 
-  ZVisitStack _visit_stack;
-  ZVisitMap   _visit_map;
+  template <bool VisitWeaks>
+  void visit_and_follow(const ZHeapIteratorContext& context, ObjectClosure* cl, oop obj);
 
-  ZHeapIteratorBitMap* object_map(oop obj);
-  void push(oop obj);
+  template <bool VisitWeaks>
+  void drain_and_steal(const ZHeapIteratorContext& context, ObjectClosure* cl);
 
-  template <typename RootsIterator, bool Concurrent, bool Weak> void push_roots();
-  template <bool VisitReferents> void push_fields(oop obj);
-  template <bool VisitReferents> void objects_do(ObjectClosure* cl);
+  template <bool VisitWeaks>
+  void object_iterate_inner(const ZHeapIteratorContext& context, ObjectClosure* cl);
 
 public:
-  ZHeapIterator();
-  ~ZHeapIterator();
+  ZHeapIterator(uint nworkers, bool visit_weaks);
+  virtual ~ZHeapIterator();
 
-  void objects_do(ObjectClosure* cl, bool visit_weaks);
+  virtual void object_iterate(ObjectClosure* cl, uint worker_id);
 };
 
 #endif // SHARE_GC_Z_ZHEAPITERATOR_HPP
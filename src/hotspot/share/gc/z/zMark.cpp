@@ -362,23 +362,99 @@ void ZMark::mark_and_follow(ZMarkCache* cache, ZMarkStackEntry entry) {
   }
 }
 
+// Marking objects in a pointer-chasing heap is bound by the latency of
+// loading the object headers. The prefetch queue delays the processing of
+// popped entries by a few entries, while the headers of the objects they
+// refer to are being prefetched.
+class ZMarkPrefetchQueue : public StackObj {
+private:
+  static const size_t max_distance = 32;
+
+  const size_t    _distance;
+  size_t          _head;
+  size_t          _length;
+  ZMarkStackEntry _entries[max_distance];
+
+public:
+  ZMarkPrefetchQueue() :
+      _distance(ZMarkPrefetchDistance),
+      _head(0),
+      _length(0) {
+    assert(_distance <= max_distance, "Invalid distance");
+  }
+
+  bool is_empty() const {
+    return _length == 0;
+  }
+
+  // Returns true and the oldest entry if the queue overflowed
+  bool push(ZMarkStackEntry entry, ZMarkStackEntry& oldest) {
+    if (_distance == 0) {
+      // Disabled
+      oldest = entry;
+      return true;
+    }
+
+    if (!entry.partial_array()) {
+      // Partial arrays are followed linearly and need no prefetching
+      Prefetch::read((void*)entry.object_address(), 0);
+    }
+
+    const size_t tail = (_head + _length) % _distance;
+    if (_length < _distance) {
+      _entries[tail] = entry;
+      _length++;
+      return false;
+    }
+
+    oldest = _entries[_head];
+    _entries[_head] = entry;
+    _head = (_head + 1) % _distance;
+    return true;
+  }
+
+  bool pop(ZMarkStackEntry& entry) {
+    if (_length == 0) {
+      return false;
+    }
+
+    entry = _entries[_head];
+    _head = (_head + 1) % _distance;
+    _length--;
+    return true;
+  }
+};
+
 template <typename T>
 bool ZMark::drain(ZMarkStripe* stripe, ZMarkThreadLocalStacks* stacks, ZMarkCache* cache, T* timeout) {
+  ZMarkPrefetchQueue queue;
   ZMarkStackEntry entry;
 
-  // Drain stripe stacks
-  while (stacks->pop(&_allocator, &_stripes, stripe, entry)) {
-    mark_and_follow(cache, entry);
+  // Drain stripe stacks. Following the entries in the prefetch
+  // queue can push new entries, so the stacks must be checked
+  // again before the queue has been emptied.
+  for (;;) {
+    if (stacks->pop(&_allocator, &_stripes, stripe, entry)) {
+      if (queue.push(entry, entry)) {
+        mark_and_follow(cache, entry);
+      }
+    } else if (queue.pop(entry)) {
+      mark_and_follow(cache, entry);
+    } else {
+      // Success
+      return true;
+    }
 
     // Check timeout
     if (timeout->has_expired()) {
-      // Timeout
+      // Timeout, follow the remaining prefetched entries
+      while (queue.pop(entry)) {
+        mark_and_follow(cache, entry);
+      }
+
       return false;
     }
   }
-
-  // Success
-  return true;
 }
 
 template <typename T>
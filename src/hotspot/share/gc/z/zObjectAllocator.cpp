@@ -48,11 +48,26 @@ ZObjectAllocator::ZObjectAllocator() :
     _used(0),
     _undone(0),
     _shared_medium_page(NULL),
+    _shared_medium_page_old(NULL),
     _shared_small_page(NULL),
+    _shared_small_page_old(NULL),
     _worker_small_page(NULL) {}
 
-ZPage** ZObjectAllocator::shared_small_page_addr() {
-  return _use_per_cpu_shared_small_pages ? _shared_small_page.addr() : _shared_small_page.addr(0);
+static bool is_old_allocation(ZAllocationFlags flags) {
+  // With generational pages, objects surviving a relocation are
+  // moved into old pages, kept apart from newly allocated objects.
+  return ZGenerationalPages && flags.relocation();
+}
+
+ZPage** ZObjectAllocator::shared_medium_page_addr(ZAllocationFlags flags) {
+  // Shared medium pages are kept per NUMA node, so that both mutators
+  // and relocating workers allocate into memory local to their node.
+  return is_old_allocation(flags) ? _shared_medium_page_old.addr() : _shared_medium_page.addr();
+}
+
+ZPage** ZObjectAllocator::shared_small_page_addr(ZAllocationFlags flags) {
+  ZPerCPU<ZPage*>* const pages = is_old_allocation(flags) ? &_shared_small_page_old : &_shared_small_page;
+  return _use_per_cpu_shared_small_pages ? pages->addr() : pages->addr(0);
 }
 
 ZPage* const* ZObjectAllocator::shared_small_page_addr() const {
@@ -62,6 +77,10 @@ ZPage* const* ZObjectAllocator::shared_small_page_addr() const {
 ZPage* ZObjectAllocator::alloc_page(uint8_t type, size_t size, ZAllocationFlags flags) {
   ZPage* const page = ZHeap::heap()->alloc_page(type, size, flags);
   if (page != NULL) {
+    if (is_old_allocation(flags)) {
+      page->set_generation(ZPageGenerationOld);
+    }
+
     // Increment used bytes
     Atomic::add(_used.addr(), size);
   }
@@ -142,7 +161,7 @@ uintptr_t ZObjectAllocator::alloc_large_object(size_t size, ZAllocationFlags fla
 }
 
 uintptr_t ZObjectAllocator::alloc_medium_object(size_t size, ZAllocationFlags flags) {
-  return alloc_object_in_shared_page(_shared_medium_page.addr(), ZPageTypeMedium, ZPageSizeMedium, size, flags);
+  return alloc_object_in_shared_page(shared_medium_page_addr(flags), ZPageTypeMedium, ZPageSizeMedium, size, flags);
 }
 
 uintptr_t ZObjectAllocator::alloc_small_object_from_nonworker(size_t size, ZAllocationFlags flags) {
@@ -152,7 +171,7 @@ uintptr_t ZObjectAllocator::alloc_small_object_from_nonworker(size_t size, ZAllo
   // Non-worker small page allocation can never use the reserve
   flags.set_no_reserve();
 
-  return alloc_object_in_shared_page(shared_small_page_addr(), ZPageTypeSmall, ZPageSizeSmall, size, flags);
+  return alloc_object_in_shared_page(shared_small_page_addr(flags), ZPageTypeSmall, ZPageSizeSmall, size, flags);
 }
 
 uintptr_t ZObjectAllocator::alloc_small_object_from_worker(size_t size, ZAllocationFlags flags) {
@@ -320,7 +339,9 @@ void ZObjectAllocator::retire_pages() {
   _undone.set_all(0);
 
   // Reset allocation pages
-  _shared_medium_page.set(NULL);
+  _shared_medium_page.set_all(NULL);
+  _shared_medium_page_old.set_all(NULL);
   _shared_small_page.set_all(NULL);
+  _shared_small_page_old.set_all(NULL);
   _worker_small_page.set_all(NULL);
 }
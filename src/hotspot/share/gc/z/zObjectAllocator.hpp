@@ -34,11 +34,14 @@ private:
   const bool         _use_per_cpu_shared_small_pages;
   ZPerCPU<size_t>    _used;
   ZPerCPU<size_t>    _undone;
-  ZContended<ZPage*> _shared_medium_page;
+  ZPerNUMA<ZPage*>   _shared_medium_page;
+  ZPerNUMA<ZPage*>   _shared_medium_page_old;
   ZPerCPU<ZPage*>    _shared_small_page;
+  ZPerCPU<ZPage*>    _shared_small_page_old;
   ZPerWorker<ZPage*> _worker_small_page;
 
-  ZPage** shared_small_page_addr();
+  ZPage** shared_medium_page_addr(ZAllocationFlags flags);
+  ZPage** shared_small_page_addr(ZAllocationFlags flags);
   ZPage* const* shared_small_page_addr() const;
 
   ZPage* alloc_page(uint8_t type, size_t size, ZAllocationFlags flags);
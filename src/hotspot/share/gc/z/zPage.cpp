@@ -32,6 +32,7 @@
 ZPage::ZPage(const ZVirtualMemory& vmem, const ZPhysicalMemory& pmem) :
     _type(type_from_size(vmem.size())),
     _numa_id((uint8_t)-1),
+    _generation(ZPageGenerationYoung),
     _seqnum(0),
     _virtual(vmem),
     _top(start()),
@@ -44,6 +45,7 @@ ZPage::ZPage(const ZVirtualMemory& vmem, const ZPhysicalMemory& pmem) :
 ZPage::ZPage(uint8_t type, const ZVirtualMemory& vmem, const ZPhysicalMemory& pmem) :
     _type(type),
     _numa_id((uint8_t)-1),
+    _generation(ZPageGenerationYoung),
     _seqnum(0),
     _virtual(vmem),
     _top(start()),
@@ -66,6 +68,7 @@ void ZPage::assert_initialized() const {
 
 void ZPage::reset() {
   _seqnum = ZGlobalSeqNum;
+  _generation = ZPageGenerationYoung;
   _top = start();
   _livemap.reset();
   _last_used = 0;
@@ -85,23 +88,25 @@ ZPage* ZPage::split(size_t size) {
 ZPage* ZPage::split(uint8_t type, size_t size) {
   assert(_virtual.size() > size, "Invalid split");
 
-  // Resize this page, keep _numa_id, _seqnum, and _last_used
+  // Resize this page, keep _numa_id, _generation, _seqnum, and _last_used
   const ZVirtualMemory vmem = _virtual.split(size);
   const ZPhysicalMemory pmem = _physical.split(size);
   _type = type_from_size(_virtual.size());
   _top = start();
   _livemap.resize(object_max_count());
 
-  // Create new page, inherit _seqnum and _last_used
+  // Create new page, inherit _generation, _seqnum and _last_used
   ZPage* const page = new ZPage(type, vmem, pmem);
+  page->_generation = _generation;
   page->_seqnum = _seqnum;
   page->_last_used = _last_used;
   return page;
 }
 
 void ZPage::print_on(outputStream* out) const {
-  out->print_cr(" %-6s  " PTR_FORMAT " " PTR_FORMAT " " PTR_FORMAT " %s%s",
+  out->print_cr(" %-6s  " PTR_FORMAT " " PTR_FORMAT " " PTR_FORMAT " %s%s%s",
                 type_to_string(), start(), top(), end(),
+                is_old()         ? " Old"         : "",
                 is_allocating()  ? " Allocating"  : "",
                 is_relocatable() ? " Relocatable" : "");
 }
@@ -37,6 +37,7 @@ class ZPage : public CHeapObj<mtGC> {
 private:
   uint8_t            _type;
   uint8_t            _numa_id;
+  uint8_t            _generation;
   uint32_t           _seqnum;
   ZVirtualMemory     _virtual;
   volatile uintptr_t _top;
@@ -74,6 +75,10 @@ public:
 
   uint8_t numa_id();
 
+  uint8_t generation() const;
+  bool is_old() const;
+  void set_generation(uint8_t generation);
+
   bool is_allocating() const;
   bool is_relocatable() const;
 
@@ -142,6 +142,19 @@ inline uint8_t ZPage::numa_id() {
   return _numa_id;
 }
 
+inline uint8_t ZPage::generation() const {
+  return _generation;
+}
+
+inline bool ZPage::is_old() const {
+  return _generation == ZPageGenerationOld;
+}
+
+inline void ZPage::set_generation(uint8_t generation) {
+  assert(generation == ZPageGenerationYoung || generation == ZPageGenerationOld, "Invalid generation");
+  _generation = generation;
+}
+
 inline bool ZPage::is_allocating() const {
   return _seqnum == ZGlobalSeqNum;
 }
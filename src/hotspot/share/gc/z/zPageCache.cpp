@@ -49,14 +49,16 @@ ZPageCache::ZPageCache() :
     _medium(),
     _large() {}
 
-ZPage* ZPageCache::alloc_small_page() {
+ZPage* ZPageCache::alloc_per_numa_page(ZPerNUMA<ZList<ZPage> >* lists, bool count_hits) {
   const uint32_t numa_id = ZNUMA::id();
   const uint32_t numa_count = ZNUMA::count();
 
   // Try NUMA local page cache
-  ZPage* const l1_page = _small.get(numa_id).remove_first();
+  ZPage* const l1_page = lists->addr(numa_id)->remove_first();
   if (l1_page != NULL) {
-    ZStatInc(ZCounterPageCacheHitL1);
+    if (count_hits) {
+      ZStatInc(ZCounterPageCacheHitL1);
+    }
     return l1_page;
   }
 
@@ -68,9 +70,11 @@ ZPage* ZPageCache::alloc_small_page() {
       remote_numa_id = 0;
     }
 
-    ZPage* const l2_page = _small.get(remote_numa_id).remove_first();
+    ZPage* const l2_page = lists->addr(remote_numa_id)->remove_first();
     if (l2_page != NULL) {
-      ZStatInc(ZCounterPageCacheHitL2);
+      if (count_hits) {
+        ZStatInc(ZCounterPageCacheHitL2);
+      }
       return l2_page;
     }
 
@@ -80,34 +84,47 @@ ZPage* ZPageCache::alloc_small_page() {
   return NULL;
 }
 
-ZPage* ZPageCache::alloc_medium_page() {
-  ZPage* const page = _medium.remove_first();
-  if (page != NULL) {
-    ZStatInc(ZCounterPageCacheHitL1);
-    return page;
-  }
+ZPage* ZPageCache::alloc_small_page() {
+  return alloc_per_numa_page(&_small, true /* count_hits */);
+}
 
-  return NULL;
+ZPage* ZPageCache::alloc_medium_page() {
+  return alloc_per_numa_page(&_medium, true /* count_hits */);
 }
 
 ZPage* ZPageCache::alloc_large_page(size_t size) {
-  // Find a page with the right size
+  const uint32_t numa_id = ZNUMA::id();
+  ZPage* remote_page = NULL;
+
+  // Find a page with the right size, preferably NUMA local
   ZListIterator<ZPage> iter(&_large);
   for (ZPage* page; iter.next(&page);) {
     if (size == page->size()) {
-      // Page found
-      _large.remove(page);
-      ZStatInc(ZCounterPageCacheHitL1);
-      return page;
+      if (page->numa_id() == numa_id) {
+        // NUMA local page found
+        _large.remove(page);
+        ZStatInc(ZCounterPageCacheHitL1);
+        return page;
+      }
+
+      if (remote_page == NULL) {
+        remote_page = page;
+      }
     }
   }
 
-  return NULL;
+  if (remote_page != NULL) {
+    // NUMA remote page found
+    _large.remove(remote_page);
+    ZStatInc(ZCounterPageCacheHitL2);
+  }
+
+  return remote_page;
 }
 
 ZPage* ZPageCache::alloc_oversized_medium_page(size_t size) {
   if (size <= ZPageSizeMedium) {
-    return _medium.remove_first();
+    return alloc_per_numa_page(&_medium, false /* count_hits */);
   }
 
   return NULL;
@@ -183,7 +200,7 @@ void ZPageCache::free_page_inner(ZPage* page) {
   if (type == ZPageTypeSmall) {
     _small.get(page->numa_id()).insert_first(page);
   } else if (type == ZPageTypeMedium) {
-    _medium.insert_first(page);
+    _medium.get(page->numa_id()).insert_first(page);
   } else {
     _large.insert_first(page);
   }
@@ -237,14 +254,14 @@ void ZPageCache::flush_per_numa_lists(ZPageCacheFlushClosure* cl, ZPerNUMA<ZList
 void ZPageCache::flush(ZPageCacheFlushClosure* cl, ZList<ZPage>* to) {
   // Prefer flushing large, then medium and last small pages
   flush_list(cl, &_large, to);
-  flush_list(cl, &_medium, to);
+  flush_per_numa_lists(cl, &_medium, to);
   flush_per_numa_lists(cl, &_small, to);
 }
 
 void ZPageCache::pages_do(ZPageClosure* cl) const {
   // Small
-  ZPerNUMAConstIterator<ZList<ZPage> > iter_numa(&_small);
-  for (const ZList<ZPage>* list; iter_numa.next(&list);) {
+  ZPerNUMAConstIterator<ZList<ZPage> > iter_small_numa(&_small);
+  for (const ZList<ZPage>* list; iter_small_numa.next(&list);) {
     ZListIterator<ZPage> iter_small(list);
     for (ZPage* page; iter_small.next(&page);) {
       cl->do_page(page);
@@ -252,9 +269,12 @@ void ZPageCache::pages_do(ZPageClosure* cl) const {
   }
 
   // Medium
-  ZListIterator<ZPage> iter_medium(&_medium);
-  for (ZPage* page; iter_medium.next(&page);) {
-    cl->do_page(page);
+  ZPerNUMAConstIterator<ZList<ZPage> > iter_medium_numa(&_medium);
+  for (const ZList<ZPage>* list; iter_medium_numa.next(&list);) {
+    ZListIterator<ZPage> iter_medium(list);
+    for (ZPage* page; iter_medium.next(&page);) {
+      cl->do_page(page);
+    }
   }
 
   // Large
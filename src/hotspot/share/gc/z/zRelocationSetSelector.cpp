@@ -23,9 +23,12 @@
 
 #include "precompiled.hpp"
 #include "gc/z/zArray.inline.hpp"
+#include "gc/z/zDirector.hpp"
+#include "gc/z/zHeap.hpp"
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zRelocationSet.hpp"
 #include "gc/z/zRelocationSetSelector.hpp"
+#include "gc/z/zStat.hpp"
 #include "logging/log.hpp"
 #include "runtime/globals.hpp"
 #include "utilities/debug.hpp"
@@ -41,6 +44,7 @@ ZRelocationSetSelectorGroup::ZRelocationSetSelectorGroup(const char* name,
     _sorted_pages(NULL),
     _nselected(0),
     _relocating(0),
+    _cost(0),
     _fragmentation(0) {}
 
 ZRelocationSetSelectorGroup::~ZRelocationSetSelectorGroup() {
@@ -55,11 +59,21 @@ void ZRelocationSetSelectorGroup::register_live_page(ZPage* page, size_t garbage
   }
 }
 
+size_t ZRelocationSetSelectorGroup::cost(const ZPage* page) {
+  // The cost of relocating a page is dominated by copying its live bytes,
+  // but pages with many small objects are relatively more expensive to
+  // relocate than pages with a few large objects.
+  return page->live_bytes() + (size_t)page->live_objects() * object_cost;
+}
+
 void ZRelocationSetSelectorGroup::semi_sort() {
-  // Semi-sort registered pages by live bytes in ascending order
+  // Semi-sort registered pages by relocation cost in ascending order. Since
+  // the garbage of a page shrinks as its live bytes grow, this order also
+  // approximates the order of descending reclaimed bytes per cost. Costs
+  // above twice the page size all end up in the last partition.
   const size_t npartitions_shift = 11;
   const size_t npartitions = (size_t)1 << npartitions_shift;
-  const size_t partition_size = _page_size >> npartitions_shift;
+  const size_t partition_size = (_page_size * 2) >> npartitions_shift;
   const size_t partition_size_shift = exact_log2(partition_size);
   const size_t npages = _registered_pages.size();
 
@@ -74,7 +88,7 @@ void ZRelocationSetSelectorGroup::semi_sort() {
   memset(partitions, 0, sizeof(partitions));
   ZArrayIterator<ZPage*> iter1(&_registered_pages);
   for (ZPage* page; iter1.next(&page);) {
-    const size_t index = page->live_bytes() >> partition_size_shift;
+    const size_t index = MIN2(cost(page) >> partition_size_shift, npartitions - 1);
     partitions[index]++;
   }
 
@@ -89,14 +103,14 @@ void ZRelocationSetSelectorGroup::semi_sort() {
   // Sort pages into partitions
   ZArrayIterator<ZPage*> iter2(&_registered_pages);
   for (ZPage* page; iter2.next(&page);) {
-    const size_t index = page->live_bytes() >> partition_size_shift;
+    const size_t index = MIN2(cost(page) >> partition_size_shift, npartitions - 1);
     const size_t finger = partitions[index]++;
     assert(_sorted_pages[finger] == NULL, "Invalid finger");
     _sorted_pages[finger] = page;
   }
 }
 
-void ZRelocationSetSelectorGroup::select() {
+void ZRelocationSetSelectorGroup::select(size_t* budget) {
   if (_page_size == 0) {
     // Page type disabled
     return;
@@ -104,18 +118,30 @@ void ZRelocationSetSelectorGroup::select() {
 
   // Calculate the number of pages to relocate by successively including pages in
   // a candidate relocation set and calculate the maximum space requirement for
-  // their live objects.
+  // their live objects. The candidate relocation set is never grown beyond
+  // the relocation cost budget.
   const size_t npages = _registered_pages.size();
   size_t selected_from = 0;
   size_t selected_to = 0;
   size_t selected_from_size = 0;
+  size_t selected_from_cost = 0;
   size_t from_size = 0;
+  size_t from_cost = 0;
 
   semi_sort();
 
   for (size_t from = 1; from <= npages; from++) {
+    ZPage* const page = _sorted_pages[from - 1];
+    if (from_cost + cost(page) > *budget) {
+      // Over budget
+      log_trace(gc, reloc)("Candidate Relocation Set (%s Pages): " SIZE_FORMAT " over budget",
+                           _name, from);
+      break;
+    }
+
     // Add page to the candidate relocation set
-    from_size += _sorted_pages[from - 1]->live_bytes();
+    from_size += page->live_bytes();
+    from_cost += cost(page);
 
     // Calculate the maximum number of pages needed by the candidate relocation set.
     // By subtracting the object size limit from the pages size we get the maximum
@@ -134,6 +160,7 @@ void ZRelocationSetSelectorGroup::select() {
       selected_from = from;
       selected_to = to;
       selected_from_size = from_size;
+      selected_from_cost = from_cost;
     }
 
     log_trace(gc, reloc)("Candidate Relocation Set (%s Pages): "
@@ -144,8 +171,12 @@ void ZRelocationSetSelectorGroup::select() {
   // Finalize selection
   _nselected = selected_from;
 
+  // Consume budget
+  *budget -= selected_from_cost;
+
   // Update statistics
   _relocating = selected_from_size;
+  _cost = selected_from_cost;
   for (size_t i = _nselected; i < npages; i++) {
     ZPage* const page = _sorted_pages[i];
     _fragmentation += page->size() - page->live_bytes();
@@ -167,6 +198,10 @@ size_t ZRelocationSetSelectorGroup::relocating() const {
   return _relocating;
 }
 
+size_t ZRelocationSetSelectorGroup::cost() const {
+  return _cost;
+}
+
 size_t ZRelocationSetSelectorGroup::fragmentation() const {
   return _fragmentation;
 }
@@ -175,6 +210,7 @@ ZRelocationSetSelector::ZRelocationSetSelector() :
     _small("Small", ZPageSizeSmall, ZObjectSizeLimitSmall),
     _medium("Medium", ZPageSizeMedium, ZObjectSizeLimitMedium),
     _live(0),
+    _live_old(0),
     _garbage(0),
     _fragmentation(0) {}
 
@@ -193,22 +229,65 @@ void ZRelocationSetSelector::register_live_page(ZPage* page) {
 
   _live += live;
   _garbage += garbage;
+
+  if (page->is_old()) {
+    _live_old += live;
+  }
 }
 
 void ZRelocationSetSelector::register_garbage_page(ZPage* page) {
   _garbage += page->size();
 }
 
+size_t ZRelocationSetSelector::calculate_budget(double rate_avg, double rate_sd,
+                                                double time_until_oom, size_t min_budget) {
+  // The relocation set should not be larger than what the workers can
+  // relocate before the Java threads run out of free memory, given the
+  // max allocation rate. The relocation rate is a moving average, from
+  // which we deduct one sigma to account for the relocation rate variance.
+  const double min_rate = MAX2(rate_avg - rate_sd, 0.0);
+  const double budget = MIN2(min_rate * MAX2(time_until_oom, 0.0), (double)(SIZE_MAX / 2));
+
+  // Relocating is what makes memory available again when the Java threads
+  // are about to run out of it, so always allow some amount of relocation.
+  return MAX2((size_t)budget, min_budget);
+}
+
+size_t ZRelocationSetSelector::budget() const {
+  if (!ZRelocationBudget ||
+      !ZStatRelocation::is_rate_trustable() ||
+      !ZStatCycle::is_normalized_duration_trustable()) {
+    // No budget
+    return SIZE_MAX;
+  }
+
+  const AbsSeq& rate = ZStatRelocation::rate();
+  const double time_until_oom = ZDirector::time_until_oom();
+  const size_t min_budget = (size_t)(ZHeap::heap()->soft_max_capacity() * ZRelocationBudgetMinPercent / 100.0);
+  const size_t budget = calculate_budget(rate.davg(), rate.dsd(), time_until_oom, min_budget);
+
+  log_debug(gc, reloc)("Relocation Budget: " SIZE_FORMAT "MB, RelocationRate: %.3fMB/s, TimeUntilOOM: %.3fs",
+                       budget / M, rate.davg() / M, time_until_oom);
+
+  return budget;
+}
+
 void ZRelocationSetSelector::select(ZRelocationSet* relocation_set) {
   // Select pages to relocate. The resulting relocation set will be
   // sorted such that medium pages comes first, followed by small
-  // pages. Pages within each page group will be semi-sorted by live
-  // bytes in ascending order. Relocating pages in this order allows
-  // us to start reclaiming memory more quickly.
+  // pages. Pages within each page group will be semi-sorted by
+  // relocation cost in ascending order. Relocating pages in this
+  // order allows us to start reclaiming memory more quickly.
+  size_t remaining = budget();
 
   // Select pages from each group
-  _medium.select();
-  _small.select();
+  _medium.select(&remaining);
+  _small.select(&remaining);
+
+  if (ZGenerationalPages) {
+    log_debug(gc, reloc)("Live Bytes: " SIZE_FORMAT "M young, " SIZE_FORMAT "M old",
+                         (_live - _live_old) / M, _live_old / M);
+  }
 
   // Populate relocation set
   relocation_set->populate(_medium.selected(), _medium.nselected(),
@@ -219,6 +298,10 @@ size_t ZRelocationSetSelector::live() const {
   return _live;
 }
 
+size_t ZRelocationSetSelector::live_old() const {
+  return _live_old;
+}
+
 size_t ZRelocationSetSelector::garbage() const {
   return _garbage;
 }
@@ -227,6 +310,10 @@ size_t ZRelocationSetSelector::relocating() const {
   return _small.relocating() + _medium.relocating();
 }
 
+size_t ZRelocationSetSelector::cost() const {
+  return _small.cost() + _medium.cost();
+}
+
 size_t ZRelocationSetSelector::fragmentation() const {
   return _fragmentation + _small.fragmentation() + _medium.fragmentation();
 }
@@ -32,6 +32,11 @@ class ZRelocationSet;
 
 class ZRelocationSetSelectorGroup {
 private:
+  // Relocation cost of an object on top of copying its bytes, such as
+  // allocating the to-space copy and inserting the forwarding entry,
+  // expressed in bytes of copying.
+  static const size_t object_cost = 32;
+
   const char* const _name;
   const size_t      _page_size;
   const size_t      _object_size_limit;
@@ -41,8 +46,11 @@ private:
   ZPage**           _sorted_pages;
   size_t            _nselected;
   size_t            _relocating;
+  size_t            _cost;
   size_t            _fragmentation;
 
+  static size_t cost(const ZPage* page);
+
   void semi_sort();
 
 public:
@@ -52,11 +60,12 @@ public:
   ~ZRelocationSetSelectorGroup();
 
   void register_live_page(ZPage* page, size_t garbage);
-  void select();
+  void select(size_t* budget);
 
   ZPage* const* selected() const;
   size_t nselected() const;
   size_t relocating() const;
+  size_t cost() const;
   size_t fragmentation() const;
 };
 
@@ -65,19 +74,30 @@ private:
   ZRelocationSetSelectorGroup _small;
   ZRelocationSetSelectorGroup _medium;
   size_t                      _live;
+  size_t                      _live_old;
   size_t                      _garbage;
   size_t                      _fragmentation;
 
+  size_t budget() const;
+
 public:
   ZRelocationSetSelector();
 
+  // Relocation cost budget for a relocation rate with the given average and
+  // standard deviation (in bytes per second) and the time until OOM (in
+  // seconds). The budget is never smaller than min_budget.
+  static size_t calculate_budget(double rate_avg, double rate_sd,
+                                 double time_until_oom, size_t min_budget);
+
   void register_live_page(ZPage* page);
   void register_garbage_page(ZPage* page);
   void select(ZRelocationSet* relocation_set);
 
   size_t live() const;
+  size_t live_old() const;
   size_t garbage() const;
   size_t relocating() const;
+  size_t cost() const;
   size_t fragmentation() const;
 };
 
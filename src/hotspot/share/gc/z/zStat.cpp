@@ -1126,15 +1126,34 @@ void ZStatMark::print() {
 //
 // Stat relocation
 //
-size_t ZStatRelocation::_relocating;
-bool ZStatRelocation::_success;
+size_t       ZStatRelocation::_relocating;
+size_t       ZStatRelocation::_cost;
+bool         ZStatRelocation::_success;
+TruncatedSeq ZStatRelocation::_rate;
 
-void ZStatRelocation::set_at_select_relocation_set(size_t relocating) {
+void ZStatRelocation::set_at_select_relocation_set(size_t relocating, size_t cost) {
   _relocating = relocating;
+  _cost = cost;
 }
 
-void ZStatRelocation::set_at_relocate_end(bool success) {
+void ZStatRelocation::set_at_relocate_end(bool success, double duration) {
   _success = success;
+
+  // Only complete relocations of a non-trivial relocation set say
+  // anything about the rate at which the workers relocate objects
+  if (success && _cost > 0 && duration > 0.0) {
+    _rate.add(_cost / duration);
+  }
+}
+
+bool ZStatRelocation::is_rate_trustable() {
+  // The relocation rate is considered trustable if we have
+  // completed at least three relocations with a sampled rate
+  return _rate.num() >= 3;
+}
+
+const AbsSeq& ZStatRelocation::rate() {
+  return _rate;
 }
 
 void ZStatRelocation::print() {
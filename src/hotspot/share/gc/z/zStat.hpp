@@ -418,12 +418,17 @@ public:
 //
 class ZStatRelocation : public AllStatic {
 private:
-  static size_t _relocating;
-  static bool   _success;
+  static size_t       _relocating;
+  static size_t       _cost;
+  static bool         _success;
+  static TruncatedSeq _rate; // Cost/s
 
 public:
-  static void set_at_select_relocation_set(size_t relocating);
-  static void set_at_relocate_end(bool success);
+  static void set_at_select_relocation_set(size_t relocating, size_t cost);
+  static void set_at_relocate_end(bool success, double duration);
+
+  static bool is_rate_trustable();
+  static const AbsSeq& rate();
 
   static void print();
 };
@@ -53,12 +53,38 @@ bool ZUncommitter::idle(uint64_t timeout) {
   }
 }
 
+bool ZUncommitter::is_memory_pressure() const {
+  if (ZUncommitPressureLimit == 0) {
+    // Disabled
+    return false;
+  }
+
+  // The available and physical memory are both subject to
+  // the memory limit of the container, if there is one.
+  const julong available = os::available_memory();
+  const julong limit = os::physical_memory() / 100 * ZUncommitPressureLimit;
+
+  log_trace(gc, heap)("Uncommit Available Memory: " JULONG_FORMAT "M, Pressure Limit: " JULONG_FORMAT "M",
+                      available / M, limit / M);
+
+  return available < limit;
+}
+
 void ZUncommitter::run_service() {
   for (;;) {
+    // Under memory pressure, uncommit all unused memory regardless
+    // of for how long it has been unused, and check again soon.
+    const bool pressure = is_memory_pressure();
+    const uint64_t delay = pressure ? 0 : ZUncommitDelay;
+
     // Try uncommit unused memory
-    const uint64_t timeout = ZHeap::heap()->uncommit(ZUncommitDelay);
+    uint64_t timeout = ZHeap::heap()->uncommit(delay);
+    if (ZUncommitPressureLimit > 0) {
+      // Sample memory pressure at least once per second
+      timeout = MIN2<uint64_t>(timeout, 1);
+    }
 
-    log_trace(gc, heap)("Uncommit Timeout: " UINT64_FORMAT "s", timeout);
+    log_trace(gc, heap)("Uncommit Timeout: " UINT64_FORMAT "s%s", timeout, pressure ? " (Memory Pressure)" : "");
 
     // Idle until next attempt
     if (!idle(timeout)) {
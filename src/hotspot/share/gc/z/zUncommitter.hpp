@@ -33,6 +33,7 @@ private:
   bool    _stop;
 
   bool idle(uint64_t timeout);
+  bool is_memory_pressure() const;
 
 protected:
   virtual void run_service();
@@ -49,10 +49,28 @@
   experimental(double, ZFragmentationLimit, 25.0,                           \
           "Maximum allowed heap fragmentation")                             \
                                                                             \
+  experimental(bool, ZRelocationBudget, true,                               \
+          "Limit the relocation set to what can be relocated before the "   \
+          "Java threads run out of free memory")                            \
+                                                                            \
+  experimental(double, ZRelocationBudgetMinPercent, 5.0,                    \
+          "Minimum relocation budget, in percent of the soft max heap "     \
+          "capacity")                                                       \
+          range(0.0, 100.0)                                                 \
+                                                                            \
+  experimental(bool, ZGenerationalPages, false,                             \
+          "Relocate surviving objects into separate old pages instead "     \
+          "of sharing pages with newly allocated objects")                  \
+                                                                            \
   experimental(size_t, ZMarkStackSpaceLimit, 8*G,                           \
           "Maximum number of bytes allocated for mark stacks")              \
           range(32*M, 1024*G)                                               \
                                                                             \
+  experimental(uint, ZMarkPrefetchDistance, 8,                              \
+          "Number of popped mark stack entries to prefetch ahead of "       \
+          "marking and following them (0 means disabled)")                  \
+          range(0, 32)                                                      \
+                                                                            \
   experimental(uint, ZCollectionInterval, 0,                                \
           "Force GC at a fixed time interval (in seconds)")                 \
                                                                             \
@@ -63,6 +81,12 @@
           "Uncommit memory if it has been unused for the specified "        \
           "amount of time (in seconds)")                                    \
                                                                             \
+  experimental(uintx, ZUncommitPressureLimit, 0,                            \
+          "Uncommit unused memory without delay when the available "        \
+          "system or container memory falls below the specified "           \
+          "percentage of the physical memory (0 means disabled)")           \
+          range(0, 100)                                                     \
+                                                                            \
   diagnostic(uint, ZStatisticsInterval, 10,                                 \
           "Time between statistics print outs (in seconds)")                \
           range(1, (uint)-1)                                                \
@@ -515,6 +515,12 @@ void Bytecodes::initialize() {
   def(_fast_iload          , "fast_iload"          , "bi"   , NULL    , T_INT    ,  1, false, _iload);
   def(_fast_iload2         , "fast_iload2"         , "bi_i" , NULL    , T_INT    ,  2, false, _iload);
   def(_fast_icaload        , "fast_icaload"        , "bi_"  , NULL    , T_INT    ,  0, false, _iload);
+  def(_fast_iload2_if_icmpeq, "fast_iload2_if_icmpeq", "bi_i___", NULL  , T_VOID   ,  0, false, _iload);
+  def(_fast_iload2_if_icmpne, "fast_iload2_if_icmpne", "bi_i___", NULL  , T_VOID   ,  0, false, _iload);
+  def(_fast_iload2_if_icmplt, "fast_iload2_if_icmplt", "bi_i___", NULL  , T_VOID   ,  0, false, _iload);
+  def(_fast_iload2_if_icmpge, "fast_iload2_if_icmpge", "bi_i___", NULL  , T_VOID   ,  0, false, _iload);
+  def(_fast_iload2_if_icmpgt, "fast_iload2_if_icmpgt", "bi_i___", NULL  , T_VOID   ,  0, false, _iload);
+  def(_fast_iload2_if_icmple, "fast_iload2_if_icmple", "bi_i___", NULL  , T_VOID   ,  0, false, _iload);
 
   // Faster method invocation.
   def(_fast_invokevfinal   , "fast_invokevfinal"   , "bJJ"  , NULL    , T_ILLEGAL, -1, true, _invokevirtual   );
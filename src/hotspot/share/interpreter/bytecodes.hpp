@@ -273,6 +273,13 @@ class Bytecodes: AllStatic {
     _fast_iload           ,
     _fast_iload2          ,
     _fast_icaload         ,
+    // iload, iload, if_icmp<cond>; same order as _if_icmpeq.._if_icmple
+    _fast_iload2_if_icmpeq,
+    _fast_iload2_if_icmpne,
+    _fast_iload2_if_icmplt,
+    _fast_iload2_if_icmpge,
+    _fast_iload2_if_icmpgt,
+    _fast_iload2_if_icmple,
 
     _fast_invokevfinal    ,
     _fast_linearswitch    ,
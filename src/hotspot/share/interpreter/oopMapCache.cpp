@@ -434,7 +434,17 @@ inline unsigned int OopMapCache::hash_value_for(const methodHandle& method, int
 
 OopMapCacheEntry* volatile OopMapCache::_old_entries = NULL;
 
-OopMapCache::OopMapCache() {
+int OopMapCache::size_for(int method_count) {
+  // Two slots per method, rounded up to a power of 2.
+  int size = _min_size;
+  while (size < 2 * method_count && size < (int)OopMapCacheMaxSize) {
+    size *= 2;
+  }
+  return size;
+}
+
+OopMapCache::OopMapCache(int method_count) : _size(size_for(method_count)) {
+  assert(is_power_of_2(_size), "must be a power of 2");
   _array  = NEW_C_HEAP_ARRAY(OopMapCacheEntry*, _size, mtClass);
   for(int i = 0; i < _size; i++) _array[i] = NULL;
 }
@@ -449,11 +459,11 @@ OopMapCache::~OopMapCache() {
 }
 
 OopMapCacheEntry* OopMapCache::entry_at(int i) const {
-  return Atomic::load_acquire(&(_array[i % _size]));
+  return Atomic::load_acquire(&(_array[i & (_size - 1)]));
 }
 
 bool OopMapCache::put_at(int i, OopMapCacheEntry* entry, OopMapCacheEntry* old) {
-  return Atomic::cmpxchg(&_array[i % _size], old, entry) == old;
+  return Atomic::cmpxchg(&_array[i & (_size - 1)], old, entry) == old;
 }
 
 void OopMapCache::flush() {
@@ -147,12 +147,15 @@ class InterpreterOopMap: ResourceObj {
 class OopMapCache : public CHeapObj<mtClass> {
  static OopMapCacheEntry* volatile _old_entries;
  private:
-  enum { _size        = 32,     // Use fixed size for now
+  enum { _min_size    = 32,     // size for classes with few methods
          _probe_depth = 3       // probe depth in case of collisions
   };
 
+  const int                    _size;   // power of 2
   OopMapCacheEntry* volatile * _array;
 
+  static int size_for(int method_count);
+
   unsigned int hash_value_for(const methodHandle& method, int bci) const;
   OopMapCacheEntry* entry_at(int i) const;
   bool put_at(int i, OopMapCacheEntry* entry, OopMapCacheEntry* old);
@@ -162,7 +165,9 @@ class OopMapCache : public CHeapObj<mtClass> {
   void flush();
 
  public:
-  OopMapCache();
+  // The cache gets more slots for classes with many methods, since all
+  // the interpreted frames of the methods of one class share one cache.
+  OopMapCache(int method_count);
   ~OopMapCache();                                // free up memory
 
   // flush cache entry is occupied by an obsolete method
@@ -485,6 +485,12 @@ void TemplateTable::initialize() {
   def(Bytecodes::_fast_iload          , ubcp|____|____|____, vtos, itos, fast_iload          ,  _       );
   def(Bytecodes::_fast_iload2         , ubcp|____|____|____, vtos, itos, fast_iload2         ,  _       );
   def(Bytecodes::_fast_icaload        , ubcp|____|____|____, vtos, itos, fast_icaload        ,  _       );
+  def(Bytecodes::_fast_iload2_if_icmpeq, ubcp|disp|clvm|____, vtos, vtos, fast_iload2_if_icmp, equal        );
+  def(Bytecodes::_fast_iload2_if_icmpne, ubcp|disp|clvm|____, vtos, vtos, fast_iload2_if_icmp, not_equal    );
+  def(Bytecodes::_fast_iload2_if_icmplt, ubcp|disp|clvm|____, vtos, vtos, fast_iload2_if_icmp, less         );
+  def(Bytecodes::_fast_iload2_if_icmpge, ubcp|disp|clvm|____, vtos, vtos, fast_iload2_if_icmp, greater_equal);
+  def(Bytecodes::_fast_iload2_if_icmpgt, ubcp|disp|clvm|____, vtos, vtos, fast_iload2_if_icmp, greater      );
+  def(Bytecodes::_fast_iload2_if_icmple, ubcp|disp|clvm|____, vtos, vtos, fast_iload2_if_icmp, less_equal   );
 
   def(Bytecodes::_fast_invokevfinal   , ubcp|disp|clvm|____, vtos, vtos, fast_invokevfinal   , f2_byte      );
 
@@ -141,6 +141,7 @@ class TemplateTable: AllStatic {
   static void fast_iload();
   static void fast_iload2();
   static void fast_icaload();
+  static void fast_iload2_if_icmp(Condition cc);
   static void lload();
   static void fload();
   static void dload();
@@ -118,7 +118,7 @@ void BFSClosure::closure_impl(const oop* reference, const oop pointee) {
   assert(reference != NULL, "invariant");
   assert(UnifiedOop::dereference(reference) == pointee, "invariant");
 
-  if (GranularTimer::is_finished()) {
+  if (GranularTimer::is_finished() || _edge_store->has_all_chains()) {
      return;
   }
 
@@ -184,6 +184,10 @@ void BFSClosure::step_frontier() const {
 }
 
 bool BFSClosure::is_complete() const {
+  if (_edge_store->has_all_chains()) {
+    log_completed_frontier();
+    return true;
+  }
   if (_edge_queue->bottom() < _next_frontier_idx) {
     return false;
   }
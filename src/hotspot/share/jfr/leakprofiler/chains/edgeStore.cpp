@@ -42,7 +42,7 @@ void StoredEdge::operator=(const StoredEdge& edge) {
 
 traceid EdgeStore::_edge_id_counter = 0;
 
-EdgeStore::EdgeStore() : _edges(NULL) {
+EdgeStore::EdgeStore() : _edges(NULL), _nof_leak_candidates(max_uintx), _nof_leak_chains(0) {
   _edges = new EdgeHashTable(this);
 }
 
@@ -256,6 +256,7 @@ void EdgeStore::put_chain(const Edge* chain, size_t length) {
   assert(chain->distance_to_root() + 1 == length, "invariant");
   StoredEdge* const leak_context_edge = associate_leak_context_with_candidate(chain);
   assert(leak_context_edge != NULL, "invariant");
+  ++_nof_leak_chains;
   assert(leak_context_edge->parent() == NULL, "invariant");
 
   if (1 == length) {
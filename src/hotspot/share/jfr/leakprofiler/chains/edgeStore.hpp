@@ -72,6 +72,8 @@ class EdgeStore : public CHeapObj<mtTracing> {
  private:
   static traceid _edge_id_counter;
   EdgeHashTable* _edges;
+  size_t _nof_leak_candidates;
+  size_t _nof_leak_chains;
 
   // Hash table callbacks
   void on_link(EdgeEntry* entry);
@@ -103,6 +105,11 @@ class EdgeStore : public CHeapObj<mtTracing> {
   bool is_empty() const;
   traceid get_id(const Edge* edge) const;
   void put_chain(const Edge* chain, size_t length);
+
+  // The root set search can stop early once every
+  // marked sample object has been given a chain.
+  void set_nof_leak_candidates(size_t count) { _nof_leak_candidates = count; }
+  bool has_all_chains() const { return _nof_leak_chains >= _nof_leak_candidates; }
 };
 
 #endif // SHARE_JFR_LEAKPROFILER_CHAINS_EDGESTORE_HPP
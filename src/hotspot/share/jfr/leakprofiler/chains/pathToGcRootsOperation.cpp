@@ -100,10 +100,13 @@ void PathToGcRootsOperation::doit() {
   // Save the original markWord for the potential leak objects,
   // to be restored on function exit
   ObjectSampleMarker marker;
-  if (ObjectSampleCheckpoint::save_mark_words(_sampler, marker, _emit_all) == 0) {
+  const int nof_candidates = ObjectSampleCheckpoint::save_mark_words(_sampler, marker, _emit_all);
+  if (nof_candidates == 0) {
     // no valid samples to process
     return;
   }
+  // Stop searching once all candidates are reachable through a chain
+  _edge_store->set_nof_leak_candidates((size_t)nof_candidates);
 
   // Necessary condition for attempting a root set iteration
   Universe::heap()->ensure_parsability(false);
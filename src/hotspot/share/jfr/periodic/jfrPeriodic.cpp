@@ -56,6 +56,8 @@
 #include "runtime/globals.hpp"
 #include "runtime/os.hpp"
 #include "runtime/os_perf.hpp"
+#include "runtime/startupTimeline.hpp"
+#include "runtime/synchronizer.hpp"
 #include "runtime/thread.inline.hpp"
 #include "runtime/sweeper.hpp"
 #include "runtime/vmThread.hpp"
@@ -404,6 +406,10 @@ TRACE_REQUEST_FUNC(InitialSystemProperty) {
   }
 }
 
+TRACE_REQUEST_FUNC(StartupPhase) {
+  StartupTimeline::send_events();
+}
+
 TRACE_REQUEST_FUNC(ThreadAllocationStatistics) {
   ResourceMark rm;
   int initial_size = Threads::number_of_threads();
@@ -457,6 +463,15 @@ TRACE_REQUEST_FUNC(JavaThreadStatistics) {
   event.commit();
 }
 
+TRACE_REQUEST_FUNC(ObjectMonitorStatistics) {
+  EventObjectMonitorStatistics event;
+  event.set_population(ObjectSynchronizer::population());
+  event.set_freeCount(ObjectSynchronizer::free_count());
+  event.set_inflations(ObjectSynchronizer::inflation_count());
+  event.set_deflations(ObjectSynchronizer::deflation_count());
+  event.commit();
+}
+
 TRACE_REQUEST_FUNC(ClassLoadingStatistics) {
   EventClassLoadingStatistics event;
   event.set_loadedClassCount(ClassLoadingService::loaded_class_count());
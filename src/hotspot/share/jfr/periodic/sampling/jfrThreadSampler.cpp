@@ -358,6 +358,21 @@ static bool is_excluded(JavaThread* thread) {
   return thread->is_hidden_from_external_view() || thread->in_deopt_handler() || thread->jfr_thread_local()->is_excluded();
 }
 
+// A thread that has not used any CPU time since the sampler last looked at it
+// is in Java only on paper, e.g. preempted. Suspending it would record the
+// same stack again and bias the samples towards threads that do not run.
+static bool has_run_since_last_sample(JavaThread* thread) {
+  const jlong cpu_time = os::thread_cpu_time(thread);
+  if (cpu_time < 0) {
+    // Not supported, sample as usual.
+    return true;
+  }
+  JfrThreadLocal* const tl = thread->jfr_thread_local();
+  const jlong last = tl->sampled_cpu_time();
+  tl->set_sampled_cpu_time(cpu_time);
+  return cpu_time != last;
+}
+
 bool JfrThreadSampleClosure::do_sample_thread(JavaThread* thread, JfrStackFrame* frames, u4 max_frames, JfrSampleType type) {
   assert(Threads_lock->owned_by_self(), "Holding the thread table lock.");
   if (is_excluded(thread)) {
@@ -367,7 +382,8 @@ bool JfrThreadSampleClosure::do_sample_thread(JavaThread* thread, JfrStackFrame*
   bool ret = false;
   thread->set_trace_flag();  // Provides StoreLoad, needed to keep read of thread state from floating up.
   if (JAVA_SAMPLE == type) {
-    if (thread_state_in_java(thread)) {
+    if (thread_state_in_java(thread) &&
+        (!JfrSampleRunningThreadsOnly || has_run_since_last_sample(thread))) {
       ret = sample_thread_in_java(thread, frames, max_frames);
     }
   } else {
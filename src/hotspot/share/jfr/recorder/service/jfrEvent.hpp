@@ -160,27 +160,28 @@ class JfrEvent {
       // most likely a pending OOM
       return;
     }
+    traceid stack_trace_id = 0;
+    if (T::hasStackTrace && is_stacktrace_enabled()) {
+      stack_trace_id = tl->has_cached_stack_trace() ? tl->cached_stack_trace_id() :
+                                                      JfrStackTraceRepository::record(event_thread);
+    }
     JfrNativeEventWriter writer(buffer, event_thread);
-    writer.write<u8>(T::eventId);
+    // The header is at most five integers, make room for them all at once
+    if (!writer.ensure_integers(5)) {
+      return;
+    }
+    writer.write_unchecked<u8>(T::eventId);
     assert(_start_time != 0, "invariant");
-    writer.write(_start_time);
+    writer.write_unchecked(_start_time);
     if (!(T::isInstant || T::isRequestable) || T::hasCutoff) {
       assert(_end_time != 0, "invariant");
-      writer.write(_end_time - _start_time);
+      writer.write_unchecked(_end_time - _start_time);
     }
     if (T::hasThread) {
-      writer.write(tl->thread_id());
+      writer.write_unchecked(tl->thread_id());
     }
     if (T::hasStackTrace) {
-      if (is_stacktrace_enabled()) {
-        if (tl->has_cached_stack_trace()) {
-          writer.write(tl->cached_stack_trace_id());
-        } else {
-          writer.write(JfrStackTraceRepository::record(event_thread));
-        }
-      } else {
-        writer.write<traceid>(0);
-      }
+      writer.write_unchecked(stack_trace_id);
     }
     // payload
     static_cast<T*>(this)->writeData(writer);
@@ -28,12 +28,14 @@
 #include "jfr/recorder/repository/jfrChunkWriter.hpp"
 #include "jfr/recorder/stacktrace/jfrStackTraceRepository.hpp"
 #include "jfr/support/jfrThreadLocal.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "utilities/globalCounter.inline.hpp"
 
 static JfrStackTraceRepository* _instance = NULL;
 
 JfrStackTraceRepository::JfrStackTraceRepository() : _next_id(0), _entries(0) {
-  memset(_table, 0, sizeof(_table));
+  memset((void*)_table, 0, sizeof(_table));
 }
 
 JfrStackTraceRepository& JfrStackTraceRepository::instance() {
@@ -77,6 +79,18 @@ bool JfrStackTraceRepository::is_modified() const {
   return last_id != _next_id;
 }
 
+// Detach all buckets and wait for the lookups that may still walk them.
+// Traces added from now on go to the emptied table.
+JfrStackTrace** JfrStackTraceRepository::unlink_all() {
+  assert_lock_strong(JfrStacktrace_lock);
+  JfrStackTrace** const lists = NEW_C_HEAP_ARRAY(JfrStackTrace*, TABLE_SIZE, mtTracing);
+  for (u4 i = 0; i < TABLE_SIZE; ++i) {
+    lists[i] = Atomic::xchg(&_table[i], (JfrStackTrace*)NULL);
+  }
+  GlobalCounter::write_synchronize();
+  return lists;
+}
+
 size_t JfrStackTraceRepository::write(JfrChunkWriter& sw, bool clear) {
   if (_entries == 0) {
     return 0;
@@ -84,23 +98,35 @@ size_t JfrStackTraceRepository::write(JfrChunkWriter& sw, bool clear) {
   MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
   assert(_entries > 0, "invariant");
   int count = 0;
-  for (u4 i = 0; i < TABLE_SIZE; ++i) {
-    JfrStackTrace* stacktrace = _table[i];
-    while (stacktrace != NULL) {
-      JfrStackTrace* next = const_cast<JfrStackTrace*>(stacktrace->next());
-      if (stacktrace->should_write()) {
-        stacktrace->write(sw);
-        ++count;
+  if (!clear) {
+    for (u4 i = 0; i < TABLE_SIZE; ++i) {
+      const JfrStackTrace* stacktrace = Atomic::load_acquire(&_table[i]);
+      while (stacktrace != NULL) {
+        if (stacktrace->should_write()) {
+          stacktrace->write(sw);
+          ++count;
+        }
+        stacktrace = stacktrace->next();
       }
-      if (clear) {
+    }
+  } else {
+    JfrStackTrace** const lists = unlink_all();
+    u4 removed = 0;
+    for (u4 i = 0; i < TABLE_SIZE; ++i) {
+      JfrStackTrace* stacktrace = lists[i];
+      while (stacktrace != NULL) {
+        JfrStackTrace* next = const_cast<JfrStackTrace*>(stacktrace->next());
+        if (stacktrace->should_write()) {
+          stacktrace->write(sw);
+          ++count;
+        }
         delete stacktrace;
+        ++removed;
+        stacktrace = next;
       }
-      stacktrace = next;
     }
-  }
-  if (clear) {
-    memset(_table, 0, sizeof(_table));
-    _entries = 0;
+    FREE_C_HEAP_ARRAY(JfrStackTrace*, lists);
+    Atomic::sub(&_entries, removed);
   }
   last_id = _next_id;
   return count;
@@ -111,18 +137,20 @@ size_t JfrStackTraceRepository::clear() {
   if (_entries == 0) {
     return 0;
   }
+  JfrStackTrace** const lists = unlink_all();
+  u4 removed = 0;
   for (u4 i = 0; i < TABLE_SIZE; ++i) {
-    JfrStackTrace* stacktrace = _table[i];
+    JfrStackTrace* stacktrace = lists[i];
     while (stacktrace != NULL) {
       JfrStackTrace* next = const_cast<JfrStackTrace*>(stacktrace->next());
       delete stacktrace;
+      ++removed;
       stacktrace = next;
     }
   }
-  memset(_table, 0, sizeof(_table));
-  const size_t processed = _entries;
-  _entries = 0;
-  return processed;
+  FREE_C_HEAP_ARRAY(JfrStackTrace*, lists);
+  Atomic::sub(&_entries, removed);
+  return removed;
 }
 
 traceid JfrStackTraceRepository::record(Thread* thread, int skip /* 0 */) {
@@ -173,26 +201,56 @@ void JfrStackTraceRepository::record_and_cache(JavaThread* thread, int skip /* 0
   }
 }
 
-traceid JfrStackTraceRepository::add_trace(const JfrStackTrace& stacktrace) {
-  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
-  const size_t index = stacktrace._hash % TABLE_SIZE;
-  const JfrStackTrace* table_entry = _table[index];
+static traceid atomic_inc(traceid volatile* const dest) {
+  traceid compare_value;
+  traceid exchange_value;
+  do {
+    compare_value = *dest;
+    exchange_value = compare_value + 1;
+  } while (Atomic::cmpxchg(dest, compare_value, exchange_value) != compare_value);
+  return exchange_value;
+}
 
-  while (table_entry != NULL) {
-    if (table_entry->equals(stacktrace)) {
-      return table_entry->id();
+const JfrStackTrace* JfrStackTraceRepository::find_trace(const JfrStackTrace* head, const JfrStackTrace& stacktrace) {
+  for (const JfrStackTrace* entry = head; entry != NULL; entry = entry->next()) {
+    if (entry->equals(stacktrace)) {
+      return entry;
     }
-    table_entry = table_entry->next();
+  }
+  return NULL;
+}
+
+traceid JfrStackTraceRepository::add_trace(const JfrStackTrace& stacktrace) {
+  const size_t index = stacktrace._hash % TABLE_SIZE;
+  GlobalCounter::CriticalSection cs(Thread::current());
+  JfrStackTrace* head = Atomic::load_acquire(&_table[index]);
+  const JfrStackTrace* table_entry = find_trace(head, stacktrace);
+  if (table_entry != NULL) {
+    return table_entry->id();
   }
 
   if (!stacktrace.have_lineno()) {
     return 0;
   }
 
-  traceid id = ++_next_id;
-  _table[index] = new JfrStackTrace(id, stacktrace, _table[index]);
-  ++_entries;
-  return id;
+  JfrStackTrace* const new_entry = new JfrStackTrace(atomic_inc(&_next_id), stacktrace, head);
+  while (true) {
+    JfrStackTrace* const prev = Atomic::cmpxchg(&_table[index], head, new_entry);
+    if (prev == head) {
+      Atomic::inc(&_entries);
+      return new_entry->id();
+    }
+    // Lost a race, the same trace may just have been added by another thread.
+    // The bucket may also have been unlinked and refilled in the meantime, so
+    // the whole of its current list is searched.
+    table_entry = find_trace(prev, stacktrace);
+    if (table_entry != NULL) {
+      delete new_entry;
+      return table_entry->id();
+    }
+    head = prev;
+    new_entry->set_next(head);
+  }
 }
 
 // invariant is that the entry to be resolved actually exists in the table
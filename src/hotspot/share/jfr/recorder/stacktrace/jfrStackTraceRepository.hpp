@@ -44,9 +44,12 @@ class JfrStackTraceRepository : public JfrCHeapObj {
 
  private:
   static const u4 TABLE_SIZE = 2053;
-  JfrStackTrace* _table[TABLE_SIZE];
-  traceid _next_id;
-  u4 _entries;
+  // Lookups and insertions are lock-free. JfrStacktrace_lock serializes
+  // write() and clear(), which unlink the entries and delete them once
+  // all concurrent lookups are done (GlobalCounter).
+  JfrStackTrace* volatile _table[TABLE_SIZE];
+  volatile traceid _next_id;
+  volatile u4 _entries;
 
   JfrStackTraceRepository();
   static JfrStackTraceRepository& instance();
@@ -59,6 +62,8 @@ class JfrStackTraceRepository : public JfrCHeapObj {
   size_t clear();
 
   const JfrStackTrace* lookup(unsigned int hash, traceid id) const;
+  JfrStackTrace** unlink_all();
+  static const JfrStackTrace* find_trace(const JfrStackTrace* head, const JfrStackTrace& stacktrace);
 
   traceid add_trace(const JfrStackTrace& stacktrace);
   static traceid add(const JfrStackTrace& stacktrace);
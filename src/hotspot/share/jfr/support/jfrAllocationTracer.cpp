@@ -23,17 +23,48 @@
 */
 
 #include "precompiled.hpp"
+#include "jfr/jfrEvents.hpp"
 #include "jfr/leakprofiler/leakProfiler.hpp"
 #include "jfr/support/jfrAllocationTracer.hpp"
 #include "jfr/support/jfrThreadLocal.hpp"
-#include "runtime/thread.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/thread.inline.hpp"
+#include "runtime/threadHeapSampler.hpp"
 
-JfrAllocationTracer::JfrAllocationTracer(HeapWord* obj, size_t alloc_size, Thread* thread) : _tl(NULL) {
+static void send_allocation_sample(const Klass* klass, size_t alloc_size, Thread* thread) {
+  if (!EventObjectAllocationSample::is_enabled()) {
+    return;
+  }
+  JfrThreadLocal* const tl = thread->jfr_thread_local();
+  // Includes the current allocation, which has already been accounted for.
+  const jlong allocated_bytes = thread->cooked_allocated_bytes();
+  if (tl->heap_bytes_until_sample() == 0) {
+    // First sample for this thread, start counting from this allocation.
+    tl->set_heap_bytes_at_sample(allocated_bytes - (jlong)alloc_size);
+    tl->set_heap_bytes_until_sample(ThreadHeapSampler::geometric_interval(JfrObjectAllocationSampleInterval));
+  }
+  const jlong weight = allocated_bytes - tl->heap_bytes_at_sample();
+  if (weight < (jlong)tl->heap_bytes_until_sample()) {
+    return;
+  }
+  tl->set_heap_bytes_at_sample(allocated_bytes);
+  tl->set_heap_bytes_until_sample(ThreadHeapSampler::geometric_interval(JfrObjectAllocationSampleInterval));
+
+  EventObjectAllocationSample event;
+  if (event.should_commit()) {
+    event.set_objectClass(klass);
+    event.set_weight((u8)weight);
+    event.commit();
+  }
+}
+
+JfrAllocationTracer::JfrAllocationTracer(const Klass* klass, HeapWord* obj, size_t alloc_size, Thread* thread) : _tl(NULL) {
   if (LeakProfiler::is_running()) {
     assert(thread->is_Java_thread(), "invariant");
     _tl = thread->jfr_thread_local();
     LeakProfiler::sample(obj, alloc_size, (JavaThread*)thread);
   }
+  send_allocation_sample(klass, alloc_size, thread);
 }
 
 JfrAllocationTracer::~JfrAllocationTracer() {
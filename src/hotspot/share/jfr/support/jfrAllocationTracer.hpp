@@ -28,12 +28,19 @@
 #include "memory/allocation.hpp"
 
 class JfrThreadLocal;
+class Klass;
 
+// Feeds the leak profiler and emits ObjectAllocationSample events on the
+// allocation slow paths. A thread takes a sample once it has allocated a
+// geometrically distributed number of bytes with mean
+// JfrObjectAllocationSampleInterval; the weight of a sample is the number of
+// bytes the thread allocated since its previous sample, so per stack trace and
+// class the weights add up to an estimate of the bytes allocated there.
 class JfrAllocationTracer : public StackObj {
  private:
   JfrThreadLocal* _tl;
  public:
-  JfrAllocationTracer(HeapWord* obj, size_t alloc_size, Thread* thread);
+  JfrAllocationTracer(const Klass* klass, HeapWord* obj, size_t alloc_size, Thread* thread);
   ~JfrAllocationTracer();
 };
 
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "jfr/jfrEvents.hpp"
+#include "jfr/support/jfrNativeAllocationSampler.hpp"
+#include "jfr/support/jfrThreadLocal.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/thread.inline.hpp"
+#include "runtime/threadHeapSampler.hpp"
+
+void JfrNativeAllocationSampler::sample(JavaThread* thread, void* address, size_t size) {
+  if (address == NULL || !EventNativeAllocationSample::is_enabled()) {
+    return;
+  }
+  JfrThreadLocal* const tl = thread->jfr_thread_local();
+  if (tl->native_bytes_until_sample() == 0) {
+    tl->set_native_bytes_until_sample(ThreadHeapSampler::geometric_interval(JfrNativeAllocationSampleInterval));
+  }
+  const size_t allocated = tl->native_bytes_since_sample() + size;
+  if (allocated < tl->native_bytes_until_sample()) {
+    tl->set_native_bytes_since_sample(allocated);
+    return;
+  }
+  tl->set_native_bytes_since_sample(0);
+  tl->set_native_bytes_until_sample(ThreadHeapSampler::geometric_interval(JfrNativeAllocationSampleInterval));
+
+  EventNativeAllocationSample event;
+  if (event.should_commit()) {
+    event.set_address((u8)(uintptr_t)address);
+    event.set_allocationSize(size);
+    event.set_weight(allocated);
+    event.commit();
+  }
+}
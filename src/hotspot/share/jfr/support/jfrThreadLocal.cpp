@@ -52,6 +52,11 @@ JfrThreadLocal::JfrThreadLocal() :
   _user_time(0),
   _cpu_time(0),
   _wallclock_time(os::javaTimeNanos()),
+  _sampled_cpu_time(-1),
+  _native_bytes_since_sample(0),
+  _native_bytes_until_sample(0),
+  _heap_bytes_at_sample(0),
+  _heap_bytes_until_sample(0),
   _stack_trace_hash(0),
   _stackdepth(0),
   _entering_suspend_flag(0),
@@ -47,6 +47,11 @@ class JfrThreadLocal {
   jlong _user_time;
   jlong _cpu_time;
   jlong _wallclock_time;
+  jlong _sampled_cpu_time;
+  size_t _native_bytes_since_sample;
+  size_t _native_bytes_until_sample;
+  jlong _heap_bytes_at_sample;
+  size_t _heap_bytes_until_sample;
   unsigned int _stack_trace_hash;
   mutable u4 _stackdepth;
   volatile jint _entering_suspend_flag;
@@ -192,6 +197,50 @@ class JfrThreadLocal {
     _wallclock_time = wallclock_time;
   }
 
+  // CPU time of the thread when the sampler last considered it.
+  // Only accessed by the sampler thread.
+  jlong sampled_cpu_time() const {
+    return _sampled_cpu_time;
+  }
+
+  void set_sampled_cpu_time(jlong cpu_time) {
+    _sampled_cpu_time = cpu_time;
+  }
+
+  // JfrNativeAllocationSampler state.
+  size_t native_bytes_since_sample() const {
+    return _native_bytes_since_sample;
+  }
+
+  void set_native_bytes_since_sample(size_t bytes) {
+    _native_bytes_since_sample = bytes;
+  }
+
+  size_t native_bytes_until_sample() const {
+    return _native_bytes_until_sample;
+  }
+
+  void set_native_bytes_until_sample(size_t bytes) {
+    _native_bytes_until_sample = bytes;
+  }
+
+  // JfrAllocationTracer state.
+  jlong heap_bytes_at_sample() const {
+    return _heap_bytes_at_sample;
+  }
+
+  void set_heap_bytes_at_sample(jlong bytes) {
+    _heap_bytes_at_sample = bytes;
+  }
+
+  size_t heap_bytes_until_sample() const {
+    return _heap_bytes_until_sample;
+  }
+
+  void set_heap_bytes_until_sample(size_t bytes) {
+    _heap_bytes_until_sample = bytes;
+  }
+
   traceid trace_id() const {
     return _trace_id;
   }
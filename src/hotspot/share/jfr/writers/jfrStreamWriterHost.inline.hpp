@@ -107,6 +107,12 @@ void StreamWriterHost<Adapter, AP>::flush() {
 
 template <typename Adapter, typename AP>
 void StreamWriterHost<Adapter, AP>::write_unbuffered(const void* buf, size_t len) {
+  if (len <= this->available_size()) {
+    // Copying into the buffer is cheaper than flushing it and writing the
+    // data separately, and the data goes out with the next flush.
+    MemoryWriterHost<Adapter, AP>::bytes(this->current_pos(), buf, len);
+    return;
+  }
   this->flush();
   assert(0 == this->used_offset(), "can only seek from beginning");
   while (len > 0) {
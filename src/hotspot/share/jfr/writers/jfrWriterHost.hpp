@@ -97,6 +97,12 @@ class WriterHost : public WriterPolicyImpl {
   template <typename T>
   void write_be_at_offset(T value, int64_t offset);
   int64_t reserve(size_t size);
+  // Batch encoding: ensure_integers(n) makes room for n integers up front,
+  // after which up to n write_unchecked() calls skip the per-field checks.
+  static const size_t max_integer_size = sizeof(u8) + 1;
+  bool ensure_integers(size_t count);
+  template <typename T>
+  void write_unchecked(T value);
 };
 
 #endif // SHARE_JFR_WRITERS_JFRWRITERHOST_HPP
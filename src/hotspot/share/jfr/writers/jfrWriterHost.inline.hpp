@@ -175,6 +175,20 @@ inline u1* WriterHost<BE, IE, WriterPolicyImpl>::ensure_size(size_t requested) {
   return this->current_pos();
 }
 
+template <typename BE, typename IE, typename WriterPolicyImpl>
+inline bool WriterHost<BE, IE, WriterPolicyImpl>::ensure_integers(size_t count) {
+  return ensure_size(count * max_integer_size) != NULL;
+}
+
+template <typename BE, typename IE, typename WriterPolicyImpl>
+template <typename T>
+inline void WriterHost<BE, IE, WriterPolicyImpl>::write_unchecked(T value) {
+  STATIC_ASSERT(sizeof(T) < max_integer_size);
+  assert(this->is_valid(), "invariant");
+  assert(this->available_size() >= max_integer_size, "invariant");
+  this->set_current_pos(write(&value, 1, this->current_pos()));
+}
+
 template <typename BE, typename IE, typename WriterPolicyImpl>
 template <typename T>
 inline void WriterHost<BE, IE, WriterPolicyImpl>::write(T value) {
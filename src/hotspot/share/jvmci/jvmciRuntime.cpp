@@ -1410,6 +1410,21 @@ JVMCI::CodeInstallResult JVMCIRuntime::register_method(JVMCIEnv* JVMCIENV,
     nmethod_mirror_index = -1;
   }
 
+  // Encoding the dependencies and collecting the oops that keep the
+  // embedded metadata alive depend only on the installed code, so do it
+  // before taking the locks below. Compile_lock also blocks class loading
+  // (SystemDictionary::add_to_hierarchy), and with many compiler threads
+  // installing code the time it is held matters.
+  dependencies->encode_content_bytes();
+  code_buffer->finalize_oop_references(method);
+
+  // Record the dependencies for the current compile in the log
+  if (LogCompilation) {
+    for (Dependencies::DepStream deps(dependencies); deps.next(); ) {
+      deps.log_dependency();
+    }
+  }
+
   JVMCI::CodeInstallResult result;
   {
     // To prevent compile queue updates.
@@ -1419,16 +1434,6 @@ JVMCI::CodeInstallResult JVMCIRuntime::register_method(JVMCIEnv* JVMCIENV,
     // and invalidating our dependencies until we install this method.
     MutexLocker ml(Compile_lock);
 
-    // Encode the dependencies now, so we can check them right away.
-    dependencies->encode_content_bytes();
-
-    // Record the dependencies for the current compile in the log
-    if (LogCompilation) {
-      for (Dependencies::DepStream deps(dependencies); deps.next(); ) {
-        deps.log_dependency();
-      }
-    }
-
     // Check for {class loads, evolution, breakpoints} during compilation
     result = validate_compile_task_dependencies(dependencies, JVMCIENV->compile_state(), &failure_detail);
     if (result != JVMCI::ok) {
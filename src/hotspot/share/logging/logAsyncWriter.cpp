@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "logging/log.hpp"
+#include "logging/logAsyncWriter.hpp"
+#include "logging/logDecorations.hpp"
+#include "logging/logFileOutput.hpp"
+#include "memory/allocation.inline.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/os.hpp"
+#include "utilities/align.hpp"
+
+LogAsyncWriter* volatile LogAsyncWriter::_instance = NULL;
+
+LogAsyncWriter::LogAsyncWriter(size_t capacity) :
+  NonJavaThread(),
+  _buffer(NEW_C_HEAP_ARRAY(char, capacity, mtLogging)),
+  _capacity(capacity),
+  _head(0),
+  _tail(0),
+  _end(0),
+  _wrapped(false),
+  _enabled(true),
+  _buffer_lock(1),
+  _write_lock(1),
+  _work(0) {
+}
+
+void LogAsyncWriter::initialize() {
+  if (!AsyncLogFileOutput) {
+    return;
+  }
+  assert(_instance == NULL, "initialized twice");
+  LogAsyncWriter* writer = new LogAsyncWriter(align_down(AsyncLogBufferSize, BytesPerLong));
+  if (os::create_thread(writer, os::os_thread)) {
+    os::start_thread(writer);
+    Atomic::release_store(&_instance, writer);
+    log_debug(logging)("Asynchronous log file output enabled, buffer size: " SIZE_FORMAT, AsyncLogBufferSize);
+  } else {
+    // Keep writing synchronously.
+    log_warning(logging)("Failed to start the AsyncLog Thread, log file output stays synchronous");
+  }
+}
+
+// Returns the space for a record of the given size, or NULL if the buffer
+// has no contiguous free space that large.
+char* LogAsyncWriter::reserve(size_t size) {
+  if (is_empty()) {
+    _head = _tail = 0;
+  }
+  if (!_wrapped) {
+    if (_capacity - _tail >= size) {
+      char* result = _buffer + _tail;
+      _tail += size;
+      return result;
+    }
+    if (_head >= size) {
+      // Continue at the start of the buffer; the writer returns to it
+      // once it reaches _end.
+      _end = _tail;
+      _wrapped = true;
+      _tail = size;
+      return _buffer;
+    }
+  } else if (_head - _tail >= size) {
+    char* result = _buffer + _tail;
+    _tail += size;
+    return result;
+  }
+  return NULL;
+}
+
+bool LogAsyncWriter::buffer(LogFileOutput* output, const char* decorations, const char* msg) {
+  size_t decorations_len = strlen(decorations);
+  size_t msg_len = strlen(msg);
+  size_t size = align_up(sizeof(Record) + decorations_len + msg_len + 1, BytesPerLong);
+
+  _buffer_lock.wait();
+  if (!_enabled) {
+    _buffer_lock.signal();
+    return false;
+  }
+  bool was_empty = is_empty();
+  Record* record = (Record*)reserve(size);
+  if (record == NULL) {
+    output->count_async_dropped();
+    _buffer_lock.signal();
+    return true;
+  }
+  record->_output = output;
+  record->_size = size;
+  char* line = (char*)record->line();
+  memcpy(line, decorations, decorations_len);
+  memcpy(line + decorations_len, msg, msg_len + 1);
+  _buffer_lock.signal();
+
+  if (was_empty) {
+    _work.signal();
+  }
+  return true;
+}
+
+// Write everything buffered so far. The buffer lock is only held to find
+// the records to write, so the logging threads never wait for the I/O.
+// The caller holds _write_lock.
+void LogAsyncWriter::write_buffered() {
+  while (true) {
+    _buffer_lock.wait();
+    if (is_empty()) {
+      _buffer_lock.signal();
+      return;
+    }
+    size_t start = _head;
+    size_t limit = _wrapped ? _end : _tail;
+    _buffer_lock.signal();
+
+    // Records in [start, limit) are not touched by the logging threads
+    // until _head has moved past them.
+    for (size_t pos = start; pos < limit;) {
+      Record* record = (Record*)(_buffer + pos);
+      record->_output->write_async_line(record->line());
+      pos += record->_size;
+    }
+
+    _buffer_lock.wait();
+    _head = limit;
+    if (_wrapped && _head == _end) {
+      _head = 0;
+      _wrapped = false;
+    }
+    _buffer_lock.signal();
+  }
+}
+
+void LogAsyncWriter::run() {
+  while (true) {
+    _work.wait();
+    _write_lock.wait();
+    write_buffered();
+    _write_lock.signal();
+  }
+}
+
+bool LogAsyncWriter::enqueue(LogFileOutput* output, const LogDecorations& decorations, const char* msg) {
+  LogAsyncWriter* writer = Atomic::load_acquire(&_instance);
+  if (writer == NULL) {
+    return false;
+  }
+  // The decorations are formatted here, since they refer to the state of
+  // the logging thread at the time of the log call.
+  char decorations_buf[LogDecorations::DecorationsBufferSize];
+  output->format_decorations(decorations, decorations_buf, sizeof(decorations_buf));
+  return writer->buffer(output, decorations_buf, msg);
+}
+
+void LogAsyncWriter::flush() {
+  LogAsyncWriter* writer = Atomic::load_acquire(&_instance);
+  if (writer != NULL) {
+    writer->_write_lock.wait();
+    writer->write_buffered();
+    writer->_write_lock.signal();
+  }
+}
+
+void LogAsyncWriter::stop() {
+  LogAsyncWriter* writer = Atomic::load_acquire(&_instance);
+  if (writer != NULL) {
+    writer->_buffer_lock.wait();
+    writer->_enabled = false;
+    writer->_buffer_lock.signal();
+    flush();
+  }
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_LOGGING_LOGASYNCWRITER_HPP
+#define SHARE_LOGGING_LOGASYNCWRITER_HPP
+
+#include "runtime/semaphore.hpp"
+#include "runtime/thread.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class LogDecorations;
+class LogFileOutput;
+
+// Asynchronous writing of the log file outputs (AsyncLogFileOutput).
+//
+// A logging thread formats its line, decorations included, into a bounded
+// ring buffer and returns without doing any I/O. The AsyncLog Thread writes
+// the buffered lines to their files in the order they were logged. A line
+// that does not fit into the buffer is dropped and counted, and the number
+// of dropped lines is reported in the output before its next line.
+class LogAsyncWriter : public NonJavaThread {
+ private:
+  // Buffer entry header, followed by the NUL terminated line.
+  struct Record {
+    LogFileOutput* _output;
+    size_t         _size;     // Entry size including the header, aligned.
+
+    const char* line() const { return (const char*)(this + 1); }
+  };
+
+  static LogAsyncWriter* volatile _instance;
+
+  // The buffer holds records in [_head, _tail), or in [_head, _end) followed
+  // by [0, _tail) once the writing position has wrapped around.
+  char*   _buffer;
+  size_t  _capacity;
+  size_t  _head;
+  size_t  _tail;
+  size_t  _end;
+  bool    _wrapped;
+  bool    _enabled;
+
+  Semaphore _buffer_lock;   // Protects the ring buffer state.
+  Semaphore _write_lock;    // Serializes the writing of the buffered lines.
+  Semaphore _work;          // Signalled when lines have been buffered.
+
+  LogAsyncWriter(size_t capacity);
+
+  bool is_empty() const { return !_wrapped && _head == _tail; }
+  char* reserve(size_t size);
+  bool buffer(LogFileOutput* output, const char* decorations, const char* msg);
+  void write_buffered();
+
+ public:
+  virtual void run();
+  virtual char* name() const { return (char*)"AsyncLog Thread"; }
+
+  // Start the AsyncLog Thread if AsyncLogFileOutput is set.
+  static void initialize();
+
+  // Queue a line for the output. Returns false if asynchronous logging is
+  // not active, in which case the caller writes the line itself.
+  static bool enqueue(LogFileOutput* output, const LogDecorations& decorations, const char* msg);
+
+  // Write all lines buffered so far before returning.
+  static void flush();
+
+  // Flush and write all later lines synchronously.
+  static void stop();
+};
+
+#endif // SHARE_LOGGING_LOGASYNCWRITER_HPP
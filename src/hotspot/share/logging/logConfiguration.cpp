@@ -24,6 +24,7 @@
 #include "precompiled.hpp"
 #include "jvm.h"
 #include "logging/log.hpp"
+#include "logging/logAsyncWriter.hpp"
 #include "logging/logConfiguration.hpp"
 #include "logging/logDecorations.hpp"
 #include "logging/logDecorators.hpp"
@@ -111,6 +112,7 @@ void LogConfiguration::initialize(jlong vm_start_time) {
 }
 
 void LogConfiguration::finalize() {
+  LogAsyncWriter::stop();
   for (size_t i = _n_outputs; i > 0; i--) {
     disable_output(i - 1);
   }
@@ -210,6 +212,8 @@ void LogConfiguration::delete_output(size_t idx) {
   // Swap places with the last output and shrink the array
   _outputs[idx] = _outputs[--_n_outputs];
   _outputs = REALLOC_C_HEAP_ARRAY(LogOutput*, _outputs, _n_outputs, mtLogging);
+  // Write the lines still buffered for the output before it goes away.
+  LogAsyncWriter::flush();
   delete output;
 }
 
@@ -138,7 +138,7 @@ char* LogDecorations::create_level_decoration(char* pos) {
 }
 
 char* LogDecorations::create_tags_decoration(char* pos) {
-  int written = _tagset.label(pos, DecorationsBufferSize - (pos - _decorations_buffer));
+  int written = jio_snprintf(pos, DecorationsBufferSize - (pos - _decorations_buffer), "%s", _tagset.decoration_label());
   ASSERT_AND_RETURN(written, pos)
 }
 
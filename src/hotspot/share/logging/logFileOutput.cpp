@@ -24,6 +24,7 @@
 #include "precompiled.hpp"
 #include "jvm.h"
 #include "logging/log.hpp"
+#include "logging/logAsyncWriter.hpp"
 #include "logging/logConfiguration.hpp"
 #include "logging/logFileOutput.hpp"
 #include "memory/allocation.inline.hpp"
@@ -46,7 +47,7 @@ LogFileOutput::LogFileOutput(const char* name)
     : LogFileStreamOutput(NULL), _name(os::strdup_check_oom(name, mtLogging)),
       _file_name(NULL), _archive_name(NULL), _current_file(0),
       _file_count(DefaultFileCount), _is_default_file_count(true), _archive_name_len(0),
-      _rotate_size(DefaultFileSize), _current_size(0), _rotation_semaphore(1) {
+      _rotate_size(DefaultFileSize), _current_size(0), _rotation_semaphore(1), _async_dropped(0) {
   assert(strstr(name, Prefix) == name, "invalid output name '%s': missing prefix: %s", name, Prefix);
   _file_name = make_file_name(name + strlen(Prefix), _pid_str, _vm_start_time_str);
 }
@@ -290,6 +291,10 @@ int LogFileOutput::write(const LogDecorations& decorations, const char* msg) {
     return 0;
   }
 
+  if (LogAsyncWriter::enqueue(this, decorations, msg)) {
+    return 0;
+  }
+
   _rotation_semaphore.wait();
   int written = LogFileStreamOutput::write(decorations, msg);
   _current_size += written;
@@ -308,6 +313,15 @@ int LogFileOutput::write(LogMessageBuffer::Iterator msg_iterator) {
     return 0;
   }
 
+  for (; !msg_iterator.is_at_end(); msg_iterator++) {
+    if (!LogAsyncWriter::enqueue(this, msg_iterator.decorations(), msg_iterator.message())) {
+      break;
+    }
+  }
+  if (msg_iterator.is_at_end()) {
+    return 0;
+  }
+
   _rotation_semaphore.wait();
   int written = LogFileStreamOutput::write(msg_iterator);
   _current_size += written;
@@ -320,6 +334,27 @@ int LogFileOutput::write(LogMessageBuffer::Iterator msg_iterator) {
   return written;
 }
 
+void LogFileOutput::write_async_line(const char* line) {
+  if (_stream == NULL) {
+    return;
+  }
+
+  _rotation_semaphore.wait();
+  int written = 0;
+  size_t dropped = Atomic::xchg(&_async_dropped, (size_t)0);
+  if (dropped > 0) {
+    written += jio_fprintf(_stream, "[" SIZE_FORMAT " log lines dropped, async log buffer full]\n", dropped);
+  }
+  written += jio_fprintf(_stream, "%s\n", line);
+  fflush(_stream);
+  _current_size += written;
+
+  if (should_rotate()) {
+    rotate();
+  }
+  _rotation_semaphore.signal();
+}
+
 void LogFileOutput::archive() {
   assert(_archive_name != NULL && _archive_name_len > 0, "Rotation must be configured before using this function.");
   int ret = jio_snprintf(_archive_name, _archive_name_len, "%s.%0*u",
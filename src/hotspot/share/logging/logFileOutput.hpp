@@ -25,6 +25,7 @@
 #define SHARE_LOGGING_LOGFILEOUTPUT_HPP
 
 #include "logging/logFileStreamOutput.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/semaphore.hpp"
 #include "utilities/globalDefinitions.hpp"
 
@@ -63,6 +64,9 @@ class LogFileOutput : public LogFileStreamOutput {
   // Semaphore used for synchronizing file rotations and writes
   Semaphore _rotation_semaphore;
 
+  // Lines dropped by the AsyncLog Thread since the last written one
+  volatile size_t _async_dropped;
+
   void archive();
   void rotate();
   bool parse_options(const char* options, outputStream* errstream);
@@ -88,6 +92,10 @@ class LogFileOutput : public LogFileStreamOutput {
   virtual void force_rotate();
   virtual void describe(outputStream* out);
 
+  // Support for LogAsyncWriter
+  void write_async_line(const char* line);
+  void count_async_dropped() { Atomic::inc(&_async_dropped); }
+
   virtual const char* name() const {
     return _name;
   }
@@ -53,6 +53,10 @@ class LogFileStreamOutput : public LogOutput {
   int write_decorations(const LogDecorations& decorations);
 
  public:
+  // Format the decorations as write() prints them, including the space
+  // before the message. The result is truncated to fit the buffer.
+  void format_decorations(const LogDecorations& decorations, char* buf, size_t len);
+
   virtual int write(const LogDecorations& decorations, const char* msg);
   virtual int write(LogMessageBuffer::Iterator msg_iterator);
 };
@@ -32,11 +32,14 @@
 #include "logging/logTagSet.hpp"
 #include "logging/logTagSetDescriptions.hpp"
 #include "memory/allocation.inline.hpp"
+#include "runtime/os.hpp"
 #include "utilities/ostream.hpp"
 
 LogTagSet*  LogTagSet::_list      = NULL;
 size_t      LogTagSet::_ntagsets  = 0;
 
+static const size_t TagSetBufferSize = 128;
+
 // This constructor is called only during static initialization.
 // See the declaration in logTagSet.hpp for more information.
 LogTagSet::LogTagSet(PrefixWriter prefix_writer, LogTagType t0, LogTagType t1, LogTagType t2, LogTagType t3, LogTagType t4)
@@ -48,6 +51,11 @@ LogTagSet::LogTagSet(PrefixWriter prefix_writer, LogTagType t0, LogTagType t1, L
   _tag[4] = t4;
   for (_ntags = 0; _ntags < LogTag::MaxTags && _tag[_ntags] != LogTag::__NO_TAG; _ntags++) {
   }
+  // Every logged line with the tags decoration needs the label, format it
+  // only once.
+  char buf[TagSetBufferSize];
+  label(buf, sizeof(buf));
+  _label = os::strdup_check_oom(buf, mtLogging);
   _list = this;
   _ntagsets++;
 
@@ -138,8 +146,6 @@ void LogTagSet::vwrite(LogLevelType level, const char* fmt, va_list args) {
   va_end(saved_args);
 }
 
-static const size_t TagSetBufferSize = 128;
-
 void LogTagSet::describe_tagsets(outputStream* out) {
   out->print_cr("Described tag sets:");
   for (const LogTagSetDescription* d = tagset_descriptions; d->tagset != NULL; d++) {
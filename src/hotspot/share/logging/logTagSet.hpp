@@ -44,6 +44,7 @@ class LogTagSet {
   LogTagSet* const _next;
   size_t _ntags;
   LogTagType _tag[LogTag::MaxTags];
+  const char* _label;   // The tags decoration, formatted once.
 
   LogOutputList _output_list;
   LogDecorators _decorators;
@@ -107,6 +108,11 @@ class LogTagSet {
   void update_decorators(const LogDecorators& decorator = LogDecorators::None);
 
   int label(char *buf, size_t len, const char* separator = ",") const;
+
+  // The label with the default separator, as used for the tags decoration.
+  const char* decoration_label() const {
+    return _label;
+  }
   bool has_output(const LogOutput* output);
 
   // The implementation of this function is put here to ensure
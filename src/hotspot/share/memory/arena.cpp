@@ -27,10 +27,12 @@
 #include "memory/allocation.inline.hpp"
 #include "memory/metaspaceShared.hpp"
 #include "memory/resourceArea.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/os.hpp"
 #include "runtime/task.hpp"
 #include "runtime/threadCritical.hpp"
 #include "services/memTracker.hpp"
+#include "utilities/align.hpp"
 #include "utilities/ostream.hpp"
 
 //--------------------------------------------------------------------------------------
@@ -174,6 +176,48 @@ class ChunkPoolCleaner : public PeriodicTask {
    }
 };
 
+//--------------------------------------------------------------------------------------
+// Mapped chunks
+//
+// Large chunks, typically made by big compilations, are mapped directly
+// instead of being malloc'ed. This returns their memory to the OS as soon
+// as they are freed, instead of leaving the C heap grown and fragmented
+// once the compilation is done.
+
+static volatile size_t _mapped_length = 0;
+
+size_t Chunk::mapped_length() {
+  return Atomic::load(&_mapped_length);
+}
+
+static size_t mapped_chunk_bytes(size_t bytes) {
+  return align_up(bytes, os::vm_page_size());
+}
+
+static void* allocate_mapped_chunk(size_t bytes, AllocFailType alloc_failmode) {
+  size_t mapped_bytes = mapped_chunk_bytes(bytes);
+  char* p = os::reserve_memory(mapped_bytes, NULL, 0, mtChunk);
+  if (p != NULL && !os::commit_memory(p, mapped_bytes, false)) {
+    os::release_memory(p, mapped_bytes);
+    p = NULL;
+  }
+  if (p == NULL && alloc_failmode == AllocFailStrategy::EXIT_OOM) {
+    vm_exit_out_of_memory(bytes, OOM_MMAP_ERROR, "Chunk::new");
+  }
+  if (p != NULL) {
+    Atomic::add(&_mapped_length, bytes - Chunk::aligned_overhead_size());
+  }
+  return p;
+}
+
+static void free_mapped_chunk(Chunk* c) {
+  size_t mapped_bytes = mapped_chunk_bytes(c->length() + Chunk::aligned_overhead_size());
+  Atomic::sub(&_mapped_length, c->length());
+  if (!os::release_memory((char*)c, mapped_bytes)) {
+    fatal("Failed to release mapped chunk " PTR_FORMAT, p2i(c));
+  }
+}
+
 //--------------------------------------------------------------------------------------
 // Chunk implementation
 
@@ -190,6 +234,9 @@ void* Chunk::operator new (size_t requested_size, AllocFailType alloc_failmode,
    case Chunk::init_size:   return ChunkPool::small_pool()->allocate(bytes, alloc_failmode);
    case Chunk::tiny_size:   return ChunkPool::tiny_pool()->allocate(bytes, alloc_failmode);
    default: {
+     if (length >= Chunk::mapped_size) {
+       return allocate_mapped_chunk(bytes, alloc_failmode);
+     }
      void* p = os::malloc(bytes, mtChunk, CALLER_PC);
      if (p == NULL && alloc_failmode == AllocFailStrategy::EXIT_OOM) {
        vm_exit_out_of_memory(bytes, OOM_MALLOC_ERROR, "Chunk::new");
@@ -207,8 +254,12 @@ void Chunk::operator delete(void* p) {
    case Chunk::init_size:   ChunkPool::small_pool()->free(c); break;
    case Chunk::tiny_size:   ChunkPool::tiny_pool()->free(c); break;
    default:
-     ThreadCritical tc;  // Free chunks under TC lock so that NMT adjustment is stable.
-     os::free(c);
+     if (c->length() >= Chunk::mapped_size) {
+       free_mapped_chunk(c);
+     } else {
+       ThreadCritical tc;  // Free chunks under TC lock so that NMT adjustment is stable.
+       os::free(c);
+     }
   }
 }
 
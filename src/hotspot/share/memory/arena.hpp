@@ -66,7 +66,8 @@ class Chunk: CHeapObj<mtChunk> {
     init_size  =  1*K  - slack, // Size of first chunk (normal aka small)
     medium_size= 10*K  - slack, // Size of medium-sized chunk
     size       = 32*K  - slack, // Default size of an Arena chunk (following the first)
-    non_pool_size = init_size + 32 // An initial size which is not one of above
+    non_pool_size = init_size + 32, // An initial size which is not one of above
+    mapped_size = 256*K         // Chunks at least this large are mapped, not malloc'ed
   };
 
   void chop();                  // Chop this chunk
@@ -74,6 +75,10 @@ class Chunk: CHeapObj<mtChunk> {
   static size_t aligned_overhead_size(void) { return ARENA_ALIGN(sizeof(Chunk)); }
   static size_t aligned_overhead_size(size_t byte_size) { return ARENA_ALIGN(byte_size); }
 
+  // Total length of the mapped chunks in use. They count towards the arena
+  // sizes, but are tracked as virtual memory and not as mtChunk malloc.
+  static size_t mapped_length();
+
   size_t length() const         { return _len;  }
   Chunk* next() const           { return _next;  }
   void set_next(Chunk* n)       { _next = n;  }
@@ -31,6 +31,7 @@
 #include "classfile/symbolTable.hpp"
 #include "classfile/systemDictionaryShared.hpp"
 #include "classfile/altHashing.hpp"
+#include "gc/shared/workgroup.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "logging/logMessage.hpp"
@@ -1500,6 +1501,33 @@ char* FileMapInfo::map_relocation_bitmap(size_t& bitmap_size) {
   return bitmap_base;
 }
 
+// Relocate the pointers marked in the ptrmap in parallel. The workers claim
+// fixed size chunks of the bitmap, which correspond to disjoint ranges of
+// the mapped archive.
+class SharedDataRelocationTask : public AbstractGangTask {
+  BitMapView*                 _ptrmap;
+  SharedDataRelocator<false>* _patcher;
+  volatile size_t             _next_chunk;
+
+ public:
+  static const size_t chunk_size_in_bits = 64 * K;
+
+  SharedDataRelocationTask(BitMapView* ptrmap, SharedDataRelocator<false>* patcher) :
+    AbstractGangTask("Shared Data Relocation"),
+    _ptrmap(ptrmap),
+    _patcher(patcher),
+    _next_chunk(0) {}
+
+  void work(uint worker_id) {
+    const size_t size = _ptrmap->size();
+    for (size_t beg = Atomic::add(&_next_chunk, chunk_size_in_bits) - chunk_size_in_bits;
+         beg < size;
+         beg = Atomic::add(&_next_chunk, chunk_size_in_bits) - chunk_size_in_bits) {
+      _ptrmap->iterate(_patcher, beg, MIN2(beg + chunk_size_in_bits, size));
+    }
+  }
+};
+
 bool FileMapInfo::relocate_pointers(intx addr_delta) {
   log_debug(cds, reloc)("runtime archive relocation start");
   size_t bitmap_size;
@@ -1532,7 +1560,20 @@ bool FileMapInfo::relocate_pointers(intx addr_delta) {
 
     SharedDataRelocator<false> patcher((address*)patch_base, (address*)patch_end, valid_old_base, valid_old_end,
                                        valid_new_base, valid_new_end, addr_delta);
-    ptrmap.iterate(&patcher);
+
+    // The heap is initialized before the archive is mapped, so its workers
+    // can be borrowed. No GC can happen yet.
+    WorkGang* workers = ParallelArchiveRelocation ? Universe::heap()->get_safepoint_workers() : NULL;
+    size_t num_chunks = align_up(ptrmap_size_in_bits, SharedDataRelocationTask::chunk_size_in_bits) /
+                        SharedDataRelocationTask::chunk_size_in_bits;
+    if (workers != NULL && num_chunks > 1) {
+      uint num_workers = (uint)MIN2(num_chunks, (size_t)workers->total_workers());
+      log_debug(cds, reloc)("relocating with %u workers", num_workers);
+      SharedDataRelocationTask task(&ptrmap, &patcher);
+      workers->run_task(&task, num_workers);
+    } else {
+      ptrmap.iterate(&patcher);
+    }
 
     if (!os::unmap_memory(bitmap_base, bitmap_size)) {
       fatal("os::unmap_memory of relocation bitmap failed");
@@ -48,6 +48,11 @@ CodeHeap::CodeHeap(const char* name, const int code_blob_type)
   _last_insert_point            = NULL;
   _freelist_segments            = 0;
   _freelist_length              = 0;
+  _freelist_max_length          = 0;
+  _freelist_searches            = 0;
+  _freelist_search_steps        = 0;
+  _freelist_search_ticks        = 0;
+  _freelist_search_max_ticks    = 0;
   _max_allocated_capacity       = 0;
   _blob_count                   = 0;
   _nmethod_count                = 0;
@@ -285,7 +290,12 @@ void* CodeHeap::allocate(size_t instance_size) {
 
   // First check if we can satisfy request from freelist
   NOT_PRODUCT(verify());
+  jlong search_start = os::elapsed_counter();
   HeapBlock* block = search_freelist(number_of_segments);
+  jlong search_ticks = os::elapsed_counter() - search_start;
+  _freelist_searches++;
+  _freelist_search_ticks += search_ticks;
+  _freelist_search_max_ticks = MAX2(_freelist_search_max_ticks, search_ticks);
   NOT_PRODUCT(verify());
 
   if (block != NULL) {
@@ -591,6 +601,7 @@ bool CodeHeap::merge_right(FreeBlock* a) {
     // Merge block a to include the following block.
     a->set_length(a->length() + a->link()->length());
     a->set_link(a->link()->link());
+    _freelist_max_length = MAX2(_freelist_max_length, a->length());
 
     // Update the segment map and invalidate block contents.
     mark_segmap_as_used(follower, segment_for(a) + a->length(), true);
@@ -606,15 +617,73 @@ bool CodeHeap::merge_right(FreeBlock* a) {
 }
 
 
+// Give the free block at the top of the heap back to the unallocated space
+// beyond _next_segment, together with a free block directly below it. Later
+// allocations can then use that space together with the committed space that
+// is still unallocated (or with the space added by expanding the heap),
+// instead of leaving a free block that is too small for them at the top.
+void CodeHeap::release_top_block(HeapBlock* b) {
+  size_t bseg = segment_for(b);
+  assert(bseg + b->length() == _next_segment, "must be the top block");
+  clear(bseg, _next_segment);
+  _next_segment = bseg;
+
+  if (_next_segment == 0 || _freelist == NULL) {
+    return;
+  }
+  FreeBlock* below = (FreeBlock*)find_block_for(address_for(_next_segment - 1));
+  if (below == NULL || !below->free()) {
+    return;
+  }
+  // Free blocks are always merged, so 'below' is the last entry of the
+  // address ordered free list.
+  FreeBlock* prev = NULL;
+  FreeBlock* cur  = _freelist;
+  if ((_last_insert_point != NULL) && (_last_insert_point < below)) {
+    _last_insert_point = (FreeBlock*)find_block_for(_last_insert_point);
+    if ((_last_insert_point != NULL) && _last_insert_point->free() && (_last_insert_point < below)) {
+      prev = _last_insert_point;
+      cur  = prev->link();
+    }
+  }
+  while (cur != below) {
+    assert(cur != NULL, "top free block must be on the free list");
+    prev = cur;
+    cur  = cur->link();
+  }
+  assert(below->link() == NULL, "must be the last free block");
+  if (prev == NULL) {
+    _freelist = NULL;
+  } else {
+    prev->set_link(NULL);
+  }
+  if (_last_insert_point == below) {
+    _last_insert_point = prev;
+  }
+  _freelist_length--;
+  _freelist_segments -= below->length();
+
+  size_t below_seg = segment_for(below);
+  clear(below_seg, _next_segment);
+  _next_segment = below_seg;
+}
+
 void CodeHeap::add_to_freelist(HeapBlock* a) {
   FreeBlock* b = (FreeBlock*)a;
   size_t  bseg = segment_for(b);
+
+  if (bseg + b->length() == _next_segment) {
+    release_top_block(b);
+    return;
+  }
+
   _freelist_length++;
 
   assert(b != _freelist, "cannot be removed twice");
 
   // Mark as free and update free space count
   _freelist_segments += b->length();
+  _freelist_max_length = MAX2(_freelist_max_length, b->length());
   b->set_free();
   invalidate(bseg, bseg + b->length(), sizeof(FreeBlock));
 
@@ -672,11 +741,22 @@ HeapBlock* CodeHeap::search_freelist(size_t length) {
 
   length = length < CodeCacheMinBlockLength ? CodeCacheMinBlockLength : length;
 
+  // No free block is large enough. This is the common case when the
+  // free list is fragmented, so avoid walking it.
+  if (length > _freelist_max_length) {
+    return NULL;
+  }
+
   // Search for best-fitting block
+  size_t max_length = 0;
+  julong steps = 0;
   while(cur != NULL) {
     size_t cur_length = cur->length();
-    if (cur_length == length) {
-      // We have a perfect fit
+    max_length = MAX2(max_length, cur_length);
+    steps++;
+    if ((cur_length >= length) && (cur_length - length < CodeCacheMinBlockLength)) {
+      // We have a perfect fit, or one that would not leave a usable
+      // free block behind and is used as a whole anyway.
       found_block  = cur;
       found_prev   = prev;
       found_length = cur_length;
@@ -691,6 +771,11 @@ HeapBlock* CodeHeap::search_freelist(size_t length) {
     prev = cur;
     cur  = cur->link();
   }
+  _freelist_search_steps += steps;
+  if (cur == NULL) {
+    // The whole list was searched, so the upper bound can be made exact.
+    _freelist_max_length = max_length;
+  }
 
   if (found_block == NULL) {
     // None found
@@ -95,6 +95,11 @@ class CodeHeap : public CHeapObj<mtCode> {
   FreeBlock*   _last_insert_point;               // last insert point in add_to_freelist
   size_t       _freelist_segments;               // No. of segments in freelist
   int          _freelist_length;
+  size_t       _freelist_max_length;             // Upper bound of the largest free block length (in segments)
+  julong       _freelist_searches;               // No. of freelist searches
+  julong       _freelist_search_steps;           // No. of freelist elements visited by all searches
+  jlong        _freelist_search_ticks;           // Total time spent searching the freelist
+  jlong        _freelist_search_max_ticks;       // Longest freelist search
   size_t       _max_allocated_capacity;          // Peak capacity that was allocated during lifetime of the heap
 
   const char*  _name;                            // Name of the CodeHeap
@@ -132,6 +137,7 @@ class CodeHeap : public CHeapObj<mtCode> {
   FreeBlock* following_block(FreeBlock* b);
   void insert_after(FreeBlock* a, FreeBlock* b);
   bool merge_right (FreeBlock* a);
+  void release_top_block(HeapBlock* b);
 
   // Toplevel freelist management
   void add_to_freelist(HeapBlock* b);
@@ -199,6 +205,12 @@ class CodeHeap : public CHeapObj<mtCode> {
   size_t allocated_in_freelist() const           { return _freelist_segments * CodeCacheSegmentSize; }
   int    freelist_length()       const           { return _freelist_length; } // number of elements in the freelist
 
+  // Freelist search statistics, for CodeHeapState
+  julong freelist_searches()         const       { return _freelist_searches; }
+  julong freelist_search_steps()     const       { return _freelist_search_steps; }
+  jlong  freelist_search_ticks()     const       { return _freelist_search_ticks; }
+  jlong  freelist_search_max_ticks() const       { return _freelist_search_max_ticks; }
+
   // returns the first block or NULL
   virtual void* first() const                    { return next_used(first_block()); }
   // returns the next block given a block p or NULL
@@ -28,11 +28,14 @@
 #include "classfile/moduleEntry.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/workgroup.hpp"
 #include "memory/heapInspection.hpp"
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
 #include "oops/oop.inline.hpp"
 #include "oops/reflectionAccessorImplKlassHelper.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/os.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/macros.hpp"
@@ -231,6 +234,33 @@ bool KlassInfoTable::record_instance(const oop obj) {
   }
 }
 
+class KlassInfoTable::MergeClosure : public KlassInfoClosure {
+ private:
+  KlassInfoTable* _dest;
+  size_t _missed_count;
+ public:
+  MergeClosure(KlassInfoTable* dest) : _dest(dest), _missed_count(0) {}
+
+  void do_cinfo(KlassInfoEntry* cie) {
+    KlassInfoEntry* elt = _dest->lookup(cie->klass());
+    if (elt != NULL) {
+      elt->set_count(elt->count() + cie->count());
+      elt->set_words(elt->words() + cie->words());
+      _dest->_size_of_instances_in_words += cie->words();
+    } else {
+      _missed_count += cie->count();
+    }
+  }
+
+  size_t missed_count() const { return _missed_count; }
+};
+
+size_t KlassInfoTable::merge(KlassInfoTable* table) {
+  MergeClosure closure(this);
+  table->iterate(&closure);
+  return closure.missed_count();
+}
+
 void KlassInfoTable::iterate(KlassInfoClosure* cic) {
   assert(_buckets != NULL, "Allocation failure should have been caught");
   for (int index = 0; index < _num_buckets; index++) {
@@ -715,15 +745,86 @@ class RecordInstanceClosure : public ObjectClosure {
   }
 };
 
-size_t HeapInspection::populate_table(KlassInfoTable* cit, BoolObjectClosure *filter) {
+// Each worker counts the objects it visits in a table of its own and merges
+// it into the shared table when done. A worker that cannot allocate its
+// table records straight into the shared table instead.
+class ParHeapInspectTask : public AbstractGangTask {
+ private:
+  ParallelObjectIterator* _poi;
+  KlassInfoTable* _shared_cit;
+  BoolObjectClosure* _filter;
+  volatile size_t _missed_count;
+  Mutex _mutex;
+
+  class LockedRecordInstanceClosure : public ObjectClosure {
+   private:
+    RecordInstanceClosure* _ric;
+    Mutex* _mutex;
+   public:
+    LockedRecordInstanceClosure(RecordInstanceClosure* ric, Mutex* mutex) :
+      _ric(ric), _mutex(mutex) {}
+
+    void do_object(oop obj) {
+      MutexLocker x(_mutex, Mutex::_no_safepoint_check_flag);
+      _ric->do_object(obj);
+    }
+  };
+
+ public:
+  ParHeapInspectTask(ParallelObjectIterator* poi, KlassInfoTable* shared_cit, BoolObjectClosure* filter) :
+      AbstractGangTask("Iterating heap"),
+      _poi(poi),
+      _shared_cit(shared_cit),
+      _filter(filter),
+      _missed_count(0),
+      _mutex(Mutex::leaf, "Parallel heap iteration data merge lock", true,
+             Mutex::_safepoint_check_never) {}
+
+  size_t missed_count() const { return _missed_count; }
+
+  virtual void work(uint worker_id) {
+    size_t missed_count = 0;
+    KlassInfoTable cit(false);
+    if (!cit.allocation_failed()) {
+      RecordInstanceClosure ric(&cit, _filter);
+      _poi->object_iterate(&ric, worker_id);
+      MutexLocker x(&_mutex, Mutex::_no_safepoint_check_flag);
+      missed_count = ric.missed_count() + _shared_cit->merge(&cit);
+    } else {
+      RecordInstanceClosure ric(_shared_cit, _filter);
+      LockedRecordInstanceClosure locked(&ric, &_mutex);
+      _poi->object_iterate(&locked, worker_id);
+      missed_count = ric.missed_count();
+    }
+    Atomic::add(&_missed_count, missed_count);
+  }
+};
+
+size_t HeapInspection::populate_table(KlassInfoTable* cit, BoolObjectClosure *filter, uint parallel_thread_num) {
   ResourceMark rm;
 
+  if (parallel_thread_num != 1) {
+    CollectedHeap* heap = Universe::heap();
+    WorkGang* gang = heap->get_safepoint_workers();
+    if (gang != NULL) {
+      uint num_threads = (parallel_thread_num == 0) ? gang->active_workers()
+                                                    : MIN2(parallel_thread_num, gang->total_workers());
+      ParallelObjectIterator* poi = (num_threads > 1) ? heap->parallel_object_iterator(num_threads) : NULL;
+      if (poi != NULL) {
+        ParHeapInspectTask task(poi, cit, filter);
+        gang->run_task(&task, num_threads);
+        delete poi;
+        return task.missed_count();
+      }
+    }
+  }
+
   RecordInstanceClosure ric(cit, filter);
   Universe::heap()->object_iterate(&ric);
   return ric.missed_count();
 }
 
-void HeapInspection::heap_inspection(outputStream* st) {
+void HeapInspection::heap_inspection(outputStream* st, uint parallel_thread_num) {
   ResourceMark rm;
 
   if (_print_help) {
@@ -747,7 +848,7 @@ void HeapInspection::heap_inspection(outputStream* st) {
   KlassInfoTable cit(_print_class_stats);
   if (!cit.allocation_failed()) {
     // populate table with object allocation info
-    size_t missed_count = populate_table(&cit);
+    size_t missed_count = populate_table(&cit, NULL, parallel_thread_num);
     if (missed_count != 0) {
       st->print_cr("WARNING: Ran out of C-heap; undercounted " SIZE_FORMAT
                    " total instances in data below",
@@ -247,11 +247,15 @@ class KlassInfoTable: public StackObj {
   KlassInfoEntry* lookup(Klass* k); // allocates if not found!
 
   class AllClassesFinder;
+  class MergeClosure;
 
  public:
   KlassInfoTable(bool add_all_classes);
   ~KlassInfoTable();
   bool record_instance(const oop obj);
+  // Add the counts of the given table to this one. Returns the number of
+  // instances that could not be added for lack of C-heap.
+  size_t merge(KlassInfoTable* table);
   void iterate(KlassInfoClosure* cic);
   bool allocation_failed() { return _buckets == NULL; }
   size_t size_of_instances_in_words() const;
@@ -358,8 +362,11 @@ class HeapInspection : public StackObj {
                  bool print_class_stats, const char *columns) :
       _csv_format(csv_format), _print_help(print_help),
       _print_class_stats(print_class_stats), _columns(columns) {}
-  void heap_inspection(outputStream* st) NOT_SERVICES_RETURN;
-  size_t populate_table(KlassInfoTable* cit, BoolObjectClosure* filter = NULL) NOT_SERVICES_RETURN_(0);
+  // parallel_thread_num is the number of threads iterating the heap if the
+  // collector supports parallel iteration; 0 lets the VM decide.
+  void heap_inspection(outputStream* st, uint parallel_thread_num = 1) NOT_SERVICES_RETURN;
+  size_t populate_table(KlassInfoTable* cit, BoolObjectClosure* filter = NULL,
+                        uint parallel_thread_num = 1) NOT_SERVICES_RETURN_(0);
   static void find_instances_at_safepoint(Klass* k, GrowableArray<oop>* result) NOT_SERVICES_RETURN;
  private:
   void iterate_over_heap(KlassInfoTable* cit, BoolObjectClosure* filter = NULL);
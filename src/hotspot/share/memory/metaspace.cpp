@@ -42,6 +42,7 @@
 #include "oops/compressedOops.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/init.hpp"
+#include "runtime/startupTimeline.hpp"
 #include "services/memTracker.hpp"
 #include "utilities/copy.hpp"
 #include "utilities/debug.hpp"
@@ -1201,6 +1202,7 @@ void Metaspace::global_initialize() {
   } else if (UseSharedSpaces) {
     // If any of the archived space fails to map, UseSharedSpaces
     // is reset to false.
+    StartupTimelineMark stm("Map shared archive");
     MetaspaceShared::initialize_runtime_shared_and_meta_spaces();
     class_space_inited = UseSharedSpaces;
   }
@@ -35,6 +35,7 @@
 #include "memory/metaspace/occupancyMap.hpp"
 #include "memory/metaspace/virtualSpaceNode.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/ostream.hpp"
@@ -136,6 +137,10 @@ bool ChunkManager::attempt_to_coalesce_around_chunk(Metachunk* chunk, ChunkIndex
   ChunkList* const list = free_chunks(target_chunk_type);
   list->return_chunk_at_head(p_new_chunk);
 
+  if (target_chunk_type == MediumIndex) {
+    release_free_chunk_memory(p_new_chunk);
+  }
+
   // And adjust ChunkManager:: _free_chunks_count (_free_chunks_total
   // should not have changed, because the size of the space should be the same)
   _free_chunks_count -= num_chunks_removed;
@@ -576,6 +581,10 @@ void ChunkManager::return_single_chunk(Metachunk* chunk) {
   // Chunk has been added; update counters.
   account_for_added_chunk(chunk);
 
+  if (index == MediumIndex || index == HumongousIndex) {
+    release_free_chunk_memory(chunk);
+  }
+
   // Attempt coalesce returned chunks with its neighboring chunks:
   // if this chunk is small or special, attempt to coalesce to a medium chunk.
   if (index == SmallIndex || index == SpecializedIndex) {
@@ -601,6 +610,26 @@ void ChunkManager::return_single_chunk(Metachunk* chunk) {
 
 }
 
+void ChunkManager::release_free_chunk_memory(Metachunk* chunk) {
+  assert_lock_strong(MetaspaceExpand_lock);
+  assert(chunk->is_tagged_free(), "Chunk should be free.");
+
+  if (!MetaspaceReleaseFreeChunkMemory || chunk->container()->is_pre_committed()) {
+    return;
+  }
+
+  // Keep the page holding the chunk header: it links the chunk into its
+  // freelist or, for humongous chunks, into the dictionary tree.
+  const size_t page_size = os::vm_page_size();
+  char* const start = align_up((char*)chunk + sizeof(TreeChunk<Metachunk, FreeList<Metachunk> >), page_size);
+  char* const end = align_down((char*)chunk + chunk->word_size() * BytesPerWord, page_size);
+  if (start < end) {
+    os::free_memory(start, pointer_delta(end, start, 1), page_size);
+    log_trace(gc, metaspace, freelist)("%s: released " SIZE_FORMAT " bytes of free chunk at " PTR_FORMAT ".",
+        (is_class() ? "class space" : "metaspace"), pointer_delta(end, start, 1), p2i(chunk));
+  }
+}
+
 void ChunkManager::return_chunk_list(Metachunk* chunks) {
   if (chunks == NULL) {
     return;
@@ -96,6 +96,11 @@ class ChunkManager : public CHeapObj<mtInternal> {
   // Note that this chunk is supposed to be removed from the freelist right away.
   Metachunk* split_chunk(size_t target_chunk_word_size, Metachunk* chunk);
 
+  // With MetaspaceReleaseFreeChunkMemory, give the pages backing the payload
+  // of a free medium or humongous chunk back to the operating system. The
+  // memory stays committed; the pages are faulted in again on reuse.
+  void release_free_chunk_memory(Metachunk* chunk);
+
  public:
 
   ChunkManager(bool is_class);
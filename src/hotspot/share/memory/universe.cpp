@@ -70,6 +70,7 @@
 #include "runtime/java.hpp"
 #include "runtime/javaCalls.hpp"
 #include "runtime/sharedRuntime.hpp"
+#include "runtime/startupTimeline.hpp"
 #include "runtime/synchronizer.hpp"
 #include "runtime/thread.inline.hpp"
 #include "runtime/timerTrace.hpp"
@@ -643,6 +644,7 @@ jint universe_init() {
             "oop size is not not a multiple of HeapWord size");
 
   TraceTime timer("Genesis", TRACETIME_LOG(Info, startuptime));
+  StartupTimelineMark stm("Genesis");
 
   JavaClasses::compute_hard_coded_offsets();
 
@@ -714,6 +716,7 @@ jint universe_init() {
 }
 
 jint Universe::initialize_heap() {
+  StartupTimelineMark stm("Initialize heap");
   assert(_collectedHeap == NULL, "Heap already created");
   _collectedHeap = GCConfig::arguments()->create_heap();
   jint status = _collectedHeap->initialize();
@@ -839,6 +842,7 @@ void Universe::initialize_known_methods(TRAPS) {
 }
 
 void universe2_init() {
+  StartupTimelineMark stm("Create primordial classes");
   EXCEPTION_MARK;
   Universe::genesis(CATCH);
 }
@@ -269,6 +269,38 @@ namespace AccessInternal {
     static FunctionPointerT resolve_barrier() {
       return resolve_barrier_rt();
     }
+
+#ifdef HARDWIRED_BARRIER_SET
+    typedef BarrierSet::GetType<BarrierSet::HARDWIRED_BARRIER_SET>::type HardwiredBarrierSet;
+
+    template <DecoratorSet ds>
+    static typename EnableIf<
+      HasDecorator<ds, INTERNAL_VALUE_IS_OOP>::value,
+      FunctionPointerT>::type
+    resolve_barrier_gc_hardwired() {
+      return PostRuntimeDispatch<typename HardwiredBarrierSet::template AccessBarrier<ds>,
+                                 barrier_type, ds>::oop_access_barrier;
+    }
+
+    template <DecoratorSet ds>
+    static typename EnableIf<
+      !HasDecorator<ds, INTERNAL_VALUE_IS_OOP>::value,
+      FunctionPointerT>::type
+    resolve_barrier_gc_hardwired() {
+      return PostRuntimeDispatch<typename HardwiredBarrierSet::template AccessBarrier<ds>,
+                                 barrier_type, ds>::access_barrier;
+    }
+
+    // Resolved at compile time, except for the use of compressed oops
+    static inline FunctionPointerT resolve_barrier_hardwired() {
+      if (UseCompressedOops) {
+        const DecoratorSet expanded_decorators = decorators | INTERNAL_RT_USE_COMPRESSED_OOPS;
+        return resolve_barrier_gc_hardwired<expanded_decorators>();
+      } else {
+        return resolve_barrier_gc_hardwired<decorators>();
+      }
+    }
+#endif
   };
 
   // Step 5.a: Barrier resolution
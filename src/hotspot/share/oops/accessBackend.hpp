@@ -458,6 +458,20 @@ namespace AccessInternal {
   // accessor resolution function gets called for each access. Upon first invocation,
   // it resolves which accessor to be used in future invocations and patches the
   // function pointer to this new accessor.
+  //
+  // When the build hardwires the barrier set (see barrierSetConfig.hpp), the accessor
+  // of that barrier set is selected at compile time instead, and only the use of
+  // compressed oops is checked at runtime. The accesses can then be inlined.
+
+#ifdef HARDWIRED_BARRIER_SET
+  template <DecoratorSet decorators, typename FunctionPointerT, BarrierType barrier_type>
+  struct BarrierResolver;
+
+#define RUNTIME_DISPATCH_FUNC(func, barrier_type) \
+  (BarrierResolver<decorators, func_t, barrier_type>::resolve_barrier_hardwired())
+#else
+#define RUNTIME_DISPATCH_FUNC(func, barrier_type) (func)
+#endif
 
   template <DecoratorSet decorators, typename T, BarrierType type>
   struct RuntimeDispatch: AllStatic {};
@@ -470,7 +484,7 @@ namespace AccessInternal {
     static void store_init(void* addr, T value);
 
     static inline void store(void* addr, T value) {
-      _store_func(addr, value);
+      RUNTIME_DISPATCH_FUNC(_store_func, BARRIER_STORE)(addr, value);
     }
   };
 
@@ -482,7 +496,7 @@ namespace AccessInternal {
     static void store_at_init(oop base, ptrdiff_t offset, T value);
 
     static inline void store_at(oop base, ptrdiff_t offset, T value) {
-      _store_at_func(base, offset, value);
+      RUNTIME_DISPATCH_FUNC(_store_at_func, BARRIER_STORE_AT)(base, offset, value);
     }
   };
 
@@ -494,7 +508,7 @@ namespace AccessInternal {
     static T load_init(void* addr);
 
     static inline T load(void* addr) {
-      return _load_func(addr);
+      return RUNTIME_DISPATCH_FUNC(_load_func, BARRIER_LOAD)(addr);
     }
   };
 
@@ -506,7 +520,7 @@ namespace AccessInternal {
     static T load_at_init(oop base, ptrdiff_t offset);
 
     static inline T load_at(oop base, ptrdiff_t offset) {
-      return _load_at_func(base, offset);
+      return RUNTIME_DISPATCH_FUNC(_load_at_func, BARRIER_LOAD_AT)(base, offset);
     }
   };
 
@@ -518,7 +532,7 @@ namespace AccessInternal {
     static T atomic_cmpxchg_init(void* addr, T compare_value, T new_value);
 
     static inline T atomic_cmpxchg(void* addr, T compare_value, T new_value) {
-      return _atomic_cmpxchg_func(addr, compare_value, new_value);
+      return RUNTIME_DISPATCH_FUNC(_atomic_cmpxchg_func, BARRIER_ATOMIC_CMPXCHG)(addr, compare_value, new_value);
     }
   };
 
@@ -530,7 +544,7 @@ namespace AccessInternal {
     static T atomic_cmpxchg_at_init(oop base, ptrdiff_t offset, T compare_value, T new_value);
 
     static inline T atomic_cmpxchg_at(oop base, ptrdiff_t offset, T compare_value, T new_value) {
-      return _atomic_cmpxchg_at_func(base, offset, compare_value, new_value);
+      return RUNTIME_DISPATCH_FUNC(_atomic_cmpxchg_at_func, BARRIER_ATOMIC_CMPXCHG_AT)(base, offset, compare_value, new_value);
     }
   };
 
@@ -542,7 +556,7 @@ namespace AccessInternal {
     static T atomic_xchg_init(void* addr, T new_value);
 
     static inline T atomic_xchg(void* addr, T new_value) {
-      return _atomic_xchg_func(addr, new_value);
+      return RUNTIME_DISPATCH_FUNC(_atomic_xchg_func, BARRIER_ATOMIC_XCHG)(addr, new_value);
     }
   };
 
@@ -554,7 +568,7 @@ namespace AccessInternal {
     static T atomic_xchg_at_init(oop base, ptrdiff_t offset, T new_value);
 
     static inline T atomic_xchg_at(oop base, ptrdiff_t offset, T new_value) {
-      return _atomic_xchg_at_func(base, offset, new_value);
+      return RUNTIME_DISPATCH_FUNC(_atomic_xchg_at_func, BARRIER_ATOMIC_XCHG_AT)(base, offset, new_value);
     }
   };
 
@@ -570,9 +584,9 @@ namespace AccessInternal {
     static inline bool arraycopy(arrayOop src_obj, size_t src_offset_in_bytes, T* src_raw,
                                  arrayOop dst_obj, size_t dst_offset_in_bytes, T* dst_raw,
                                  size_t length) {
-      return _arraycopy_func(src_obj, src_offset_in_bytes, src_raw,
-                             dst_obj, dst_offset_in_bytes, dst_raw,
-                             length);
+      return RUNTIME_DISPATCH_FUNC(_arraycopy_func, BARRIER_ARRAYCOPY)(src_obj, src_offset_in_bytes, src_raw,
+                                                                       dst_obj, dst_offset_in_bytes, dst_raw,
+                                                                       length);
     }
   };
 
@@ -584,7 +598,7 @@ namespace AccessInternal {
     static void clone_init(oop src, oop dst, size_t size);
 
     static inline void clone(oop src, oop dst, size_t size) {
-      _clone_func(src, dst, size);
+      RUNTIME_DISPATCH_FUNC(_clone_func, BARRIER_CLONE)(src, dst, size);
     }
   };
 
@@ -596,10 +610,12 @@ namespace AccessInternal {
     static oop resolve_init(oop obj);
 
     static inline oop resolve(oop obj) {
-      return _resolve_func(obj);
+      return RUNTIME_DISPATCH_FUNC(_resolve_func, BARRIER_RESOLVE)(obj);
     }
   };
 
+#undef RUNTIME_DISPATCH_FUNC
+
   // Initialize the function pointers to point to the resolving function.
   template <DecoratorSet decorators, typename T>
   typename AccessFunction<decorators, T, BARRIER_STORE>::type
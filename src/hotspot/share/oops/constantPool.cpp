@@ -404,6 +404,9 @@ void ConstantPool::remove_unshareable_info() {
       int resolved_klass_index = kslot.resolved_klass_index();
       int name_index = kslot.name_index();
       assert(tag_at(name_index).is_symbol(), "sanity");
+      if (can_archive_resolved_klass(resolved_klasses()->at(resolved_klass_index))) {
+        continue;
+      }
       resolved_klasses()->at_put(resolved_klass_index, NULL);
       tag_at_put(index, JVM_CONSTANT_UnresolvedClass);
       assert(klass_name_at(index) == symbol_at(name_index), "sanity");
@@ -414,6 +417,23 @@ void ConstantPool::remove_unshareable_info() {
   }
 }
 
+// A class entry that refers to the pool holder itself or one of its super
+// types resolves to the same class whenever the archived pool holder is
+// used: the archived class is only loaded if its super types are the
+// archived ones, and resolving these entries neither loads nor initializes
+// anything. Such entries can stay resolved in the archive.
+bool ConstantPool::can_archive_resolved_klass(Klass* resolved_klass) const {
+  assert(Arguments::is_dumping_archive(), "dump time only");
+  InstanceKlass* holder = pool_holder();
+  if (resolved_klass == NULL || !resolved_klass->is_instance_klass()) {
+    return false;
+  }
+  if (resolved_klass == holder || holder->is_subclass_of(resolved_klass)) {
+    return true;
+  }
+  return resolved_klass->is_interface() && holder->implements_interface(resolved_klass);
+}
+
 int ConstantPool::cp_to_object_index(int cp_index) {
   // this is harder don't do this so much.
   int i = reference_map()->find(cp_index);
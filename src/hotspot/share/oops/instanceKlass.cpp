@@ -1375,7 +1375,7 @@ void InstanceKlass::mask_for(const methodHandle& method, int bci,
     MutexLocker x(OopMapCacheAlloc_lock);
     // Check if _oop_map_cache was allocated while we were waiting for this lock
     if ((oop_map_cache = _oop_map_cache) == NULL) {
-      oop_map_cache = new OopMapCache();
+      oop_map_cache = new OopMapCache(methods()->length());
       // Ensure _oop_map_cache is stable, since it is examined without a lock
       Atomic::release_store(&_oop_map_cache, oop_map_cache);
     }
@@ -2163,6 +2163,10 @@ int InstanceKlass::mark_dependent_nmethods(KlassDepChange& changes) {
   return dependencies().mark_dependent_nmethods(changes);
 }
 
+bool InstanceKlass::has_dependent_nmethods() {
+  return dependencies().has_dependent_nmethods();
+}
+
 void InstanceKlass::add_dependent_nmethod(nmethod* nm) {
   dependencies().add_dependent_nmethod(nm);
 }
@@ -2248,6 +2252,11 @@ bool InstanceKlass::supers_have_passed_fingerprint_checks() {
   return true;
 }
 
+bool InstanceKlass::claim_pending_aot_methods() {
+  return _has_pending_aot_methods &&
+         Atomic::cmpxchg(&_has_pending_aot_methods, true, false);
+}
+
 bool InstanceKlass::should_store_fingerprint(bool is_unsafe_anonymous) {
 #if INCLUDE_AOT
   // We store the fingerprint into the InstanceKlass only in the following 2 cases:
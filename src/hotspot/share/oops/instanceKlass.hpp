@@ -209,6 +209,7 @@ class InstanceKlass: public Klass {
   // _misc_flags.
   bool            _is_marked_dependent;  // used for marking during flushing and deoptimization
   bool            _is_being_redefined;   // used for locking redefinition
+  bool            _has_pending_aot_methods; // AOT code found but not published yet (AOTLazyLoading)
 
   // The low two bits of _misc_flags contains the kind field.
   // This can be used to quickly discriminate among the four kinds of
@@ -765,6 +766,11 @@ public:
   }
   bool supers_have_passed_fingerprint_checks();
 
+  bool has_pending_aot_methods() const         { return _has_pending_aot_methods; }
+  void set_has_pending_aot_methods(bool value) { _has_pending_aot_methods = value; }
+  // Returns true for the one thread that gets to publish the pending methods.
+  bool claim_pending_aot_methods();
+
   static bool should_store_fingerprint(bool is_unsafe_anonymous);
   bool should_store_fingerprint() const { return should_store_fingerprint(is_unsafe_anonymous()); }
   bool has_stored_fingerprint() const;
@@ -959,6 +965,7 @@ public:
   // maintenance of deoptimization dependencies
   inline DependencyContext dependencies();
   int  mark_dependent_nmethods(KlassDepChange& changes);
+  bool has_dependent_nmethods();
   void add_dependent_nmethod(nmethod* nm);
   void remove_dependent_nmethod(nmethod* nm);
   void clean_dependency_context();
@@ -162,6 +162,7 @@ class Klass : public Metadata {
   jlong    _last_biased_lock_bulk_revocation_time;
   markWord _prototype_header;   // Used when biased locking is both enabled and disabled for this type
   jint     _biased_lock_revocation_count;
+  jint     _biased_lock_bulk_rebias_count;
 
   // vtable length
   int _vtable_len;
@@ -643,6 +644,9 @@ protected:
   // Atomically increments biased_lock_revocation_count and returns updated value
   int atomic_incr_biased_lock_revocation_count();
   void set_biased_lock_revocation_count(int val) { _biased_lock_revocation_count = (jint) val; }
+  // Number of bulk rebias operations on this type, only updated at safepoints
+  int  biased_lock_bulk_rebias_count() const { return (int) _biased_lock_bulk_rebias_count; }
+  void incr_biased_lock_bulk_rebias_count() { _biased_lock_bulk_rebias_count++; }
   jlong last_biased_lock_bulk_revocation_time() { return _last_biased_lock_bulk_revocation_time; }
   void  set_last_biased_lock_bulk_revocation_time(jlong cur_time) { _last_biased_lock_bulk_revocation_time = cur_time; }
 
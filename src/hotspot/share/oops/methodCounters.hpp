@@ -65,8 +65,10 @@ class MethodCounters : public Metadata {
   int               _invoke_mask;                         // per-method Tier0InvokeNotifyFreqLog
   int               _backedge_mask;                       // per-method Tier0BackedgeNotifyFreqLog
 #ifdef TIERED
-  float             _rate;                        // Events (invocation and backedge counter increments) per millisecond
+  // _prev_time comes first so that it does not need padding after the
+  // ints above, and _rate and the levels share the last word.
   jlong             _prev_time;                   // Previous time the rate was acquired
+  float             _rate;                        // Events (invocation and backedge counter increments) per millisecond
   u1                _highest_comp_level;          // Highest compile level this method has ever seen.
   u1                _highest_osr_comp_level;      // Same for OSR level
 #endif
@@ -77,8 +79,8 @@ class MethodCounters : public Metadata {
 #endif
                                     _nmethod_age(INT_MAX)
 #ifdef TIERED
-                                 , _rate(0),
-                                   _prev_time(0),
+                                 , _prev_time(0),
+                                   _rate(0),
                                    _highest_comp_level(0),
                                    _highest_osr_comp_level(0)
 #endif
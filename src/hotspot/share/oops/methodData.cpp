@@ -39,6 +39,7 @@
 #include "runtime/deoptimization.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/orderAccess.hpp"
+#include "runtime/os.hpp"
 #include "runtime/safepointVerifiers.hpp"
 #include "utilities/align.hpp"
 #include "utilities/copy.hpp"
@@ -1332,12 +1333,30 @@ void MethodData::init() {
   _nof_decompiles = 0;
   _nof_overflow_recompiles = 0;
   _nof_overflow_traps = 0;
+  _deopt_storm_recompiles = 0;
+  _deopt_storm_start = 0;
   clear_escape_info();
   assert(sizeof(_trap_hist) % sizeof(HeapWord) == 0, "align");
   Copy::zero_to_words((HeapWord*) &_trap_hist,
                       sizeof(_trap_hist) / sizeof(HeapWord));
 }
 
+uint MethodData::record_deopt_storm_recompile() {
+  // There is a benign race here, like for the other trap counters.
+  const jlong now = os::javaTimeMillis();
+  if (now - _deopt_storm_start > DeoptStormWindow) {
+    _deopt_storm_start = now;
+    _deopt_storm_recompiles = 0;
+  }
+  const uint recompiles = ++_deopt_storm_recompiles;
+  if (recompiles < (uint)DeoptStormRecompileLimit) {
+    return 0;
+  }
+  _deopt_storm_start = now;
+  _deopt_storm_recompiles = 0;
+  return recompiles;
+}
+
 // Get a measure of how much mileage the method has on it.
 int MethodData::mileage_of(Method* method) {
   int mileage = 0;
@@ -2018,7 +2018,7 @@ public:
 
   // Whole-method sticky bits and flags
   enum {
-    _trap_hist_limit    = 25 JVMCI_ONLY(+5),   // decoupled from Deoptimization::Reason_LIMIT
+    _trap_hist_limit    = 26 JVMCI_ONLY(+5),   // decoupled from Deoptimization::Reason_LIMIT
     _trap_hist_mask     = max_jubyte,
     _extra_data_count   = 4     // extra DataLayout headers, for trap history
   }; // Public flag values
@@ -2026,6 +2026,8 @@ private:
   uint _nof_decompiles;             // count of all nmethod removals
   uint _nof_overflow_recompiles;    // recompile count, excluding recomp. bits
   uint _nof_overflow_traps;         // trap count, excluding _trap_hist
+  uint  _deopt_storm_recompiles;    // recompiles since _deopt_storm_start
+  jlong _deopt_storm_start;         // start of the deoptimization storm window in ms
   union {
     intptr_t _align;
     u1 _array[JVMCI_ONLY(2 *) _trap_hist_limit];
@@ -2377,6 +2379,18 @@ public:
     }
   }
 
+  // Make trap_count(reason) report an overflow, so the compilers treat the
+  // reason as having trapped too often in this method.
+  void saturate_trap_count(int reason) {
+    assert((uint)reason < JVMCI_ONLY(2*) _trap_hist_limit, "oob");
+    _trap_hist._array[reason] = _trap_hist_mask;
+  }
+
+  // Count a recompilation caused by a trap in this method. Returns the
+  // number of recompilations if they reach DeoptStormRecompileLimit within
+  // DeoptStormWindow, and 0 otherwise.
+  uint record_deopt_storm_recompile();
+
   uint overflow_trap_count() const {
     return _nof_overflow_traps;
   }
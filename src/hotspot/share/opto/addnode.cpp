@@ -854,6 +854,10 @@ Node *MinINode::Ideal(PhaseGVN *phase, bool can_reshape) {
   Node *r = in(2);
   // Transform  MinI1( MinI2(a,b), c)  into  MinI1( a, MinI2(b,c) )
   // to force a right-spline graph for the rest of MinINode::Ideal().
+  // Keep the chain of unrolled reduction candidates intact for SuperWord.
+  if (is_reduction()) {
+    return NULL;
+  }
   if( l->Opcode() == Op_MinI ) {
     assert( l != l->in(1), "dead loop in MinINode::Ideal" );
     r = phase->transform(new MinINode(l->in(2),r));
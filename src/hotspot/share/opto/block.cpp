@@ -1608,7 +1608,9 @@ void PhaseBlockLayout::merge_traces(bool fall_thru_only) {
     } else if (e->state() == CFGEdge::open) {
       // Append traces, even without a fall-thru connection.
       // But leave root entry at the beginning of the block list.
-      if (targ_trace != trace(_cfg.get_root_block())) {
+      // Keep cold traces out of the hot ones, see reorder_traces().
+      if (targ_trace != trace(_cfg.get_root_block()) &&
+          !(BlockLayoutSplitColdTraces && is_cold(targ_trace) && !is_cold(src_trace))) {
         e->set_state(CFGEdge::connected);
         src_trace->append(targ_trace);
         union_traces(src_trace, targ_trace);
@@ -1640,6 +1642,31 @@ void PhaseBlockLayout::reorder_traces(int count) {
   // Sort the new trace list by frequency
   qsort(new_traces + 1, new_count - 1, sizeof(new_traces[0]), trace_frequency_order);
 
+  if (BlockLayoutSplitColdTraces) {
+    // Move the cold traces behind all other traces, keeping their order,
+    // so the hot code of the method is contiguous. The trace of connector
+    // blocks stays last.
+    Trace** cold_traces = NEW_ARENA_ARRAY(area, Trace*, new_count);
+    int cold_count = 0;
+    int hot_count = 1;
+    int end = new_count;
+    if (new_count > 1 && new_traces[new_count - 1]->first_block()->is_connector()) {
+      end--;
+    }
+    for (int i = 1; i < end; i++) {
+      Trace* tr = new_traces[i];
+      if (is_cold(tr)) {
+        cold_traces[cold_count++] = tr;
+      } else {
+        new_traces[hot_count++] = tr;
+      }
+    }
+    for (int i = 0; i < cold_count; i++) {
+      new_traces[hot_count++] = cold_traces[i];
+    }
+    assert(hot_count == end, "lost traces");
+  }
+
   // Patch up the successor blocks
   _cfg.clear_blocks();
   for (int i = 0; i < new_count; i++) {
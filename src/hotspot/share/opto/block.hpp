@@ -885,6 +885,9 @@ class PhaseBlockLayout : public Phase {
   void merge_traces(bool loose_connections);
   void reorder_traces(int count);
   void union_traces(Trace* from, Trace* to);
+
+  // A trace is cold if it starts with an uncommon block
+  bool is_cold(Trace* tr) { return _cfg.is_uncommon(tr->first_block()); }
 };
 
 #endif // SHARE_OPTO_BLOCK_HPP
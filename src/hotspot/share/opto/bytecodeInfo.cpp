@@ -673,6 +673,17 @@ float InlineTree::compute_callee_frequency( int caller_bci ) const {
   return freq;
 }
 
+// The MethodHandle trees built by StringConcatFactory call the mix, prepend
+// and newString helpers of java.lang.StringConcatHelper from lambda forms.
+// Those helpers only size and copy the arguments into the single result
+// array; the calls they make should not be charged against the inline depth
+// or a concatenation with many arguments ends up with out-of-line copies.
+static bool is_string_concat_helper(ciMethod* m) {
+  ciInstanceKlass* holder = m->holder();
+  return holder->name() == ciSymbol::java_lang_StringConcatHelper() &&
+         holder->uses_default_loader();
+}
+
 //------------------------------build_inline_tree_for_callee-------------------
 InlineTree *InlineTree::build_inline_tree_for_callee( ciMethod* callee_method, JVMState* caller_jvms, int caller_bci) {
   float recur_frequency = _site_invoke_ratio * compute_callee_frequency(caller_bci);
@@ -688,6 +699,8 @@ InlineTree *InlineTree::build_inline_tree_for_callee( ciMethod* callee_method, J
     } else if (callee_method->is_method_handle_intrinsic() ||
                callee_method->is_compiled_lambda_form()) {
       max_inline_level_adjust += 1;  // don't count method handle calls from java.lang.invoke implementation
+    } else if (is_string_concat_helper(caller_jvms->method())) {
+      max_inline_level_adjust += 1;  // don't count the sizing and copying helpers of indy string concat
     }
     if (max_inline_level_adjust != 0 && C->print_inlining() && (Verbose || WizardMode)) {
       CompileTask::print_inline_indent(inline_level());
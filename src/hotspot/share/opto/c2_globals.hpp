@@ -144,6 +144,12 @@
   diagnostic(bool, PrintOptoAssembly, false,                                \
           "Print New compiler assembly output")                             \
                                                                             \
+  diagnostic(intx, C2PhaseTimesThreshold, 1000,                             \
+          "With -Xlog:jit+compilation=debug, log the time spent in each "   \
+          "phase of C2 compilations taking longer than the given number "   \
+          "of milliseconds")                                                \
+          range(0, max_jint)                                                \
+                                                                            \
   develop_pd(bool, OptoPeephole,                                            \
           "Apply peephole optimizations after register allocation")         \
                                                                             \
@@ -216,6 +222,10 @@
   product(bool, UseCountedLoopSafepoints, false,                            \
           "Force counted loops to keep a safepoint")                        \
                                                                             \
+  product(bool, UseLongLoopNests, false,                                     \
+          "Turn loops with a long induction variable into a loop nest "     \
+          "with an int counted inner loop")                                 \
+                                                                            \
   product(bool, UseLoopPredicate, true,                                     \
           "Generate a predicate to select fast/slow loop versions")         \
                                                                             \
@@ -241,6 +251,11 @@
   develop(bool, OptoCoalesce, true,                                         \
           "Use Conservative Copy Coalescing in the Register Allocator")     \
                                                                             \
+  experimental(uintx, OptoCoalesceMaxLiveRanges, 40000,                     \
+          "Skip Conservative Copy Coalescing in the Register Allocator if " \
+          "there are more live ranges. 0 means no limit")                   \
+          range(0, max_juint)                                               \
+                                                                            \
   develop(bool, UseUniqueSubclasses, true,                                  \
           "Narrow an abstract reference to the unique concrete subclass")   \
                                                                             \
@@ -491,6 +506,12 @@
   product(bool, EliminateNestedLocks, true,                                 \
           "Eliminate nested locks of the same object when possible")        \
                                                                             \
+  product(intx, LoopLockCoarseningLimit, 0,                                 \
+          "Unroll counted loops that lock the same loop invariant object "  \
+          "in every iteration up to this many times, so that the locks of " \
+          "adjacent iterations are coarsened. 0 or 1 disables")             \
+          range(0, max_jint)                                                \
+                                                                            \
   notproduct(bool, PrintLockStatistics, false,                              \
           "Print precise statistics on the dynamic lock usage")             \
                                                                             \
@@ -580,6 +601,10 @@
   product(bool, BlockLayoutRotateLoops, true,                               \
           "Allow back branches to be fall throughs in the block layout")    \
                                                                             \
+  experimental(bool, BlockLayoutSplitColdTraces, false,                     \
+          "Place traces starting with an uncommon block (uncommon traps, "  \
+          "slow paths) after all other traces in the block layout")         \
+                                                                            \
   diagnostic(bool, InlineReflectionGetCallerClass, true,                    \
           "inline sun.reflect.Reflection.getCallerClass(), known to be "    \
           "part of base library DLL")                                       \
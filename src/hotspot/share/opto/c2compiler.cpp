@@ -211,6 +211,12 @@ bool C2Compiler::is_intrinsic_supported(const methodHandle& method, bool is_virt
   case vmIntrinsics::_copyMemory:
     if (StubRoutines::unsafe_arraycopy() == NULL) return false;
     break;
+  case vmIntrinsics::_copySwapMemory:
+    if (StubRoutines::unsafe_copyswap() == NULL) return false;
+    break;
+  case vmIntrinsics::_setMemory:
+    if (StubRoutines::unsafe_setmemory() == NULL) return false;
+    break;
   case vmIntrinsics::_encodeISOArray:
   case vmIntrinsics::_encodeByteISOArray:
     if (!Matcher::match_rule_supported(Op_EncodeISOArray)) return false;
@@ -629,6 +635,11 @@ bool C2Compiler::is_intrinsic_supported(const methodHandle& method, bool is_virt
   case vmIntrinsics::_montgomeryMultiply:
   case vmIntrinsics::_montgomerySquare:
   case vmIntrinsics::_vectorizedMismatch:
+  case vmIntrinsics::_hashCodeB:
+  case vmIntrinsics::_hashCodeC:
+  case vmIntrinsics::_hashCodeI:
+  case vmIntrinsics::_hashCodeL:
+  case vmIntrinsics::_hashCodeU:
   case vmIntrinsics::_ghash_processBlocks:
   case vmIntrinsics::_base64_encodeBlock:
   case vmIntrinsics::_updateCRC32:
@@ -662,6 +662,13 @@ private:
   // Init LRG caching of degree, numregs.  Init lo_degree list.
   void cache_lrg_info( );
 
+  // Conservative coalescing is skipped for huge numbers of live ranges
+  // since its cost grows faster than the number of live ranges.
+  bool do_conservative_coalesce() const {
+    return OptoCoalesce && (OptoCoalesceMaxLiveRanges == 0 ||
+                            _lrg_map.max_lrg_id() <= OptoCoalesceMaxLiveRanges);
+  }
+
   // Simplify the IFG by removing LRGs of low degree
   void Simplify();
 
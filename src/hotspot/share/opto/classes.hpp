@@ -380,6 +380,8 @@ macro(MinV)
 macro(MaxV)
 macro(MinReductionV)
 macro(MaxReductionV)
+macro(MinReductionVI)
+macro(MaxReductionVI)
 macro(LoadVector)
 macro(StoreVector)
 macro(Pack)
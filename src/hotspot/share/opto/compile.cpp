@@ -35,6 +35,7 @@
 #include "compiler/oopMap.hpp"
 #include "gc/shared/barrierSet.hpp"
 #include "gc/shared/c2/barrierSetC2.hpp"
+#include "logging/log.hpp"
 #include "memory/resourceArea.hpp"
 #include "opto/addnode.hpp"
 #include "opto/block.hpp"
@@ -658,6 +659,7 @@ Compile::Compile( ciEnv* ci_env, C2Compiler* compiler, ciMethod* target, int osr
                   _directive(directive),
                   _log(ci_env->log()),
                   _failure_reason(NULL),
+                  _phase_times_start(0),
                   _congraph(NULL),
 #ifndef PRODUCT
                   _printer(IdealGraphPrinter::printer()),
@@ -711,6 +713,12 @@ Compile::Compile( ciEnv* ci_env, C2Compiler* compiler, ciMethod* target, int osr
   TraceTime t1("Total compilation time", &_t_totalCompilation, CITime, CITimeVerbose);
   TraceTime t2(NULL, &_t_methodCompilation, CITime, false);
 
+  if (log_is_enabled(Debug, jit, compilation)) {
+    memset(_phase_times, 0, sizeof(_phase_times));
+    memset(_phase_names, 0, sizeof(_phase_names));
+    _phase_times_start = os::elapsed_counter();
+  }
+
 #if defined(SUPPORT_ASSEMBLY) || defined(SUPPORT_ABSTRACT_ASSEMBLY)
   bool print_opto_assembly = directive->PrintOptoAssemblyOption;
   // We can always print a disassembly, either abstract (hex dump) or
@@ -952,6 +960,28 @@ Compile::Compile( ciEnv* ci_env, C2Compiler* compiler, ciMethod* target, int osr
     if (log() != NULL) // Print code cache state into compiler log
       log()->code_cache_state();
   }
+  if (records_phase_times()) {
+    log_phase_times();
+  }
+}
+
+// Log where a slow compilation spent its time, so that the phases
+// dominating the compilation of huge methods can be identified.
+void Compile::log_phase_times() {
+  jlong total = os::elapsed_counter() - _phase_times_start;
+  if (TimeHelper::counter_to_millis(total) < C2PhaseTimesThreshold) {
+    return;
+  }
+  ResourceMark rm;
+  log_debug(jit, compilation)("C2 compilation %d of %s took %.3f s, %d nodes",
+                              compile_id(), method()->name()->as_utf8(),
+                              TimeHelper::counter_to_seconds(total), unique());
+  for (int i = 0; i < Phase::max_phase_timers; i++) {
+    if (_phase_names[i] != NULL) {
+      log_debug(jit, compilation)("  %-24s %7.3f s", _phase_names[i],
+                                  TimeHelper::counter_to_seconds(_phase_times[i]));
+    }
+  }
 }
 
 //------------------------------Compile----------------------------------------
@@ -994,6 +1024,7 @@ Compile::Compile( ciEnv* ci_env,
     _directive(directive),
     _log(ci_env->log()),
     _failure_reason(NULL),
+    _phase_times_start(0),
     _congraph(NULL),
 #ifndef PRODUCT
     _printer(NULL),
@@ -3366,6 +3397,8 @@ void Compile::final_graph_reshaping_main_switch(Node* n, Final_Reshape_Counts& f
   case Op_MulReductionVD:
   case Op_MinReductionV:
   case Op_MaxReductionV:
+  case Op_MinReductionVI:
+  case Op_MaxReductionVI:
     break;
 
   case Op_PackB:
@@ -3936,8 +3969,14 @@ void Compile::record_failure(const char* reason) {
 
 Compile::TracePhase::TracePhase(const char* name, elapsedTimer* accumulator)
   : TraceTime(name, accumulator, CITime, CITimeVerbose),
-    _phase_name(name), _dolog(CITimeVerbose)
+    _phase_name(name), _dolog(CITimeVerbose), _phase_id(-1), _phase_start(0)
 {
+  Compile* current = Compile::current();
+  if (current != NULL && current->records_phase_times() &&
+      accumulator >= Phase::timers && accumulator < Phase::timers + Phase::max_phase_timers) {
+    _phase_id = (int)(accumulator - Phase::timers);
+    _phase_start = os::elapsed_counter();
+  }
   if (_dolog) {
     C = Compile::current();
     _log = C->log();
@@ -3955,6 +3994,9 @@ Compile::TracePhase::TracePhase(const char* name, elapsedTimer* accumulator)
 Compile::TracePhase::~TracePhase() {
 
   C = Compile::current();
+  if (_phase_id >= 0) {
+    C->record_phase_time(_phase_id, _phase_name, os::elapsed_counter() - _phase_start);
+  }
   if (_dolog) {
     _log = C->log();
   } else {
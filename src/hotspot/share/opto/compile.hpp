@@ -182,6 +182,8 @@ class Compile : public Phase {
     CompileLog* _log;
     const char* _phase_name;
     bool _dolog;
+    int   _phase_id;
+    jlong _phase_start;
    public:
     TracePhase(const char* name, elapsedTimer* accumulator);
     ~TracePhase();
@@ -425,6 +427,9 @@ class Compile : public Phase {
   DirectiveSet*         _directive;             // Compiler directive
   CompileLog*           _log;                   // from CompilerThread
   const char*           _failure_reason;        // for record_failure/failing pattern
+  jlong                 _phase_times_start;     // Start of the compilation if phase times are recorded, else 0
+  jlong                 _phase_times[Phase::max_phase_timers]; // Elapsed counter ticks per phase
+  const char*           _phase_names[Phase::max_phase_timers];
   GrowableArray<CallGenerator*>* _intrinsics;   // List of intrinsics.
   GrowableArray<Node*>* _macro_nodes;           // List of nodes which need to be expanded before matching.
   GrowableArray<Node*>* _predicate_opaqs;       // List of Opaque1 nodes for the loop predicates.
@@ -871,6 +876,14 @@ class Compile : public Phase {
   Arena*      comp_arena()           { return &_comp_arena; }
   ciEnv*      env() const            { return _env; }
   CompileLog* log() const            { return _log; }
+
+  // Per compilation phase times, see TracePhase and C2PhaseTimesThreshold.
+  bool records_phase_times() const   { return _phase_times_start != 0; }
+  void record_phase_time(int id, const char* name, jlong ticks) {
+    _phase_times[id] += ticks;
+    _phase_names[id] = name;
+  }
+  void log_phase_times();
   bool        failing() const        { return _env->failing() || _failure_reason != NULL; }
   const char* failure_reason() const { return (_env->failing()) ? _env->failure_reason() : _failure_reason; }
 
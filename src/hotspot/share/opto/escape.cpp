@@ -253,6 +253,21 @@ bool ConnectionGraph::compute_escape() {
     }
   }
 
+#ifndef PRODUCT
+  if (PrintEliminateAllocations) {
+    // Report non-escaping allocations which can't be scalar replaced.
+    for (int next = 0; next < java_objects_worklist.length(); ++next) {
+      JavaObjectNode* ptn = java_objects_worklist.at(next);
+      Node* n = ptn->ideal_node();
+      if (ptn->escape_state() == PointsToNode::NoEscape && !ptn->scalar_replaceable() &&
+          n->is_Allocate()) {
+        tty->print("NotScalar (%s)", ptn->not_scalar_replaceable_reason());
+        n->dump();
+      }
+    }
+  }
+#endif
+
 #ifdef ASSERT
   if (VerifyConnectionGraph) {
     // Verify that graph is complete - no new edges could be added or needed.
@@ -832,7 +847,7 @@ void ConnectionGraph::add_call_node(CallNode* call) {
     add_java_object(call, es);
     PointsToNode* ptn = ptnode_adr(call_idx);
     if (!scalar_replaceable && ptn->scalar_replaceable()) {
-      ptn->set_scalar_replaceable(false);
+      ptn->set_not_scalar_replaceable(NOT_PRODUCT("array length is not constant"));
     }
   } else if (call->is_CallStaticJava()) {
     // Call nodes could be different types:
@@ -863,7 +878,7 @@ void ConnectionGraph::add_call_node(CallNode* call) {
       assert(strncmp(name, "_multianewarray", 15) == 0, "TODO: add failed case check");
       // Returns a newly allocated unescaped object.
       add_java_object(call, PointsToNode::NoEscape);
-      ptnode_adr(call_idx)->set_scalar_replaceable(false);
+      ptnode_adr(call_idx)->set_not_scalar_replaceable(NOT_PRODUCT("multianewarray"));
     } else if (meth->is_boxing_method()) {
       // Returns boxing object
       PointsToNode::EscapeState es;
@@ -885,7 +900,7 @@ void ConnectionGraph::add_call_node(CallNode* call) {
         // Mark it as NoEscape so that objects referenced by
         // it's fields will be marked as NoEscape at least.
         add_java_object(call, PointsToNode::NoEscape);
-        ptnode_adr(call_idx)->set_scalar_replaceable(false);
+        ptnode_adr(call_idx)->set_not_scalar_replaceable(NOT_PRODUCT("allocated by a call"));
       } else {
         // Determine whether any arguments are returned.
         const TypeTuple* d = call->tf()->domain();
@@ -1680,7 +1695,7 @@ void ConnectionGraph::adjust_scalar_replaceable_state(JavaObjectNode* jobj) {
       FieldNode* field = use->as_Field();
       assert(field->is_oop() && field->scalar_replaceable(), "sanity");
       if (field->offset() == Type::OffsetBot) {
-        jobj->set_scalar_replaceable(false);
+        jobj->set_not_scalar_replaceable(NOT_PRODUCT("stored at unknown offset"));
         return;
       }
       // 2. An object is not scalar replaceable if the field into which it is
@@ -1689,7 +1704,7 @@ void ConnectionGraph::adjust_scalar_replaceable_state(JavaObjectNode* jobj) {
         for (BaseIterator i(field); i.has_next(); i.next()) {
           PointsToNode* base = i.get();
           if (base == null_obj) {
-            jobj->set_scalar_replaceable(false);
+            jobj->set_not_scalar_replaceable(NOT_PRODUCT("stored into field with null base"));
             return;
           }
         }
@@ -1701,8 +1716,8 @@ void ConnectionGraph::adjust_scalar_replaceable_state(JavaObjectNode* jobj) {
       PointsToNode* ptn = j.get();
       if (ptn->is_JavaObject() && ptn != jobj) {
         // Mark all objects.
-        jobj->set_scalar_replaceable(false);
-         ptn->set_scalar_replaceable(false);
+        jobj->set_not_scalar_replaceable(NOT_PRODUCT(use->ideal_node()->is_Phi() ? "merged with other object at Phi" : "merged with other object"));
+         ptn->set_not_scalar_replaceable(NOT_PRODUCT(use->ideal_node()->is_Phi() ? "merged with other object at Phi" : "merged with other object"));
       }
     }
     if (!jobj->scalar_replaceable()) {
@@ -1722,7 +1737,7 @@ void ConnectionGraph::adjust_scalar_replaceable_state(JavaObjectNode* jobj) {
     // 4. An object is not scalar replaceable if it has a field with unknown
     // offset (array's element is accessed in loop).
     if (offset == Type::OffsetBot) {
-      jobj->set_scalar_replaceable(false);
+      jobj->set_not_scalar_replaceable(NOT_PRODUCT("has field with unknown offset"));
       return;
     }
     // 5. Currently an object is not scalar replaceable if a LoadStore node
@@ -1737,14 +1752,14 @@ void ConnectionGraph::adjust_scalar_replaceable_state(JavaObjectNode* jobj) {
         n->in(AddPNode::Address)->Opcode() == Op_CheckCastPP) {
       assert(n->in(AddPNode::Address)->bottom_type()->isa_rawptr(), "raw address so raw cast expected");
       assert(_igvn->type(n->in(AddPNode::Address)->in(1))->isa_oopptr(), "cast pattern at unsafe access expected");
-      jobj->set_scalar_replaceable(false);
+      jobj->set_not_scalar_replaceable(NOT_PRODUCT("is used as base of mixed unsafe access"));
       return;
     }
 
     for (DUIterator_Fast imax, i = n->fast_outs(imax); i < imax; i++) {
       Node* u = n->fast_out(i);
       if (u->is_LoadStore() || (u->is_Mem() && u->as_Mem()->is_mismatched_access())) {
-        jobj->set_scalar_replaceable(false);
+        jobj->set_not_scalar_replaceable(NOT_PRODUCT(u->is_LoadStore() ? "is used in LoadStore" : "is used in mismatched access"));
         return;
       }
     }
@@ -1773,8 +1788,8 @@ void ConnectionGraph::adjust_scalar_replaceable_state(JavaObjectNode* jobj) {
         // this field's base by now.
         if (base->is_JavaObject() && base != jobj) {
           // Mark all bases.
-          jobj->set_scalar_replaceable(false);
-          base->set_scalar_replaceable(false);
+          jobj->set_not_scalar_replaceable(NOT_PRODUCT("field may point to more than one object"));
+          base->set_not_scalar_replaceable(NOT_PRODUCT("field may point to more than one object"));
         }
       }
     }
@@ -3492,8 +3507,13 @@ void PointsToNode::dump(bool print_state) const {
     EscapeState es = escape_state();
     EscapeState fields_es = fields_escape_state();
     tty->print("%s(%s) ", esc_names[(int)es], esc_names[(int)fields_es]);
-    if (nt == PointsToNode::JavaObject && !this->scalar_replaceable())
-      tty->print("NSR ");
+    if (nt == PointsToNode::JavaObject && !this->scalar_replaceable()) {
+      if (_not_scalar_replaceable_reason != NULL) {
+        tty->print("NSR(%s) ", _not_scalar_replaceable_reason);
+      } else {
+        tty->print("NSR ");
+      }
+    }
   }
   if (is_Field()) {
     FieldNode* f = (FieldNode*)this;
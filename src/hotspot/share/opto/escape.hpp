@@ -141,6 +141,10 @@ class PointsToNode : public ResourceObj {
   const int           _idx;  // Cached ideal node's _idx
   const uint         _pidx;  // Index of this node
 
+#ifndef PRODUCT
+  const char* _not_scalar_replaceable_reason; // Why the object is not scalar replaceable
+#endif
+
 public:
   typedef enum {
     UnknownType = 0,
@@ -200,12 +204,15 @@ public:
   void set_arraycopy_dst()       { _flags |= ArraycopyDst; }
 
   bool     scalar_replaceable() const { return (_flags & ScalarReplaceable) != 0;}
-  void set_scalar_replaceable(bool v) {
-    if (v)
-      _flags |= ScalarReplaceable;
-    else
-      _flags &= ~ScalarReplaceable;
+  // The first reason recorded is kept; it is printed by dump() and
+  // by -XX:+PrintEliminateAllocations.
+  void set_not_scalar_replaceable(NOT_PRODUCT(const char* reason)) {
+    NOT_PRODUCT(if (scalar_replaceable()) _not_scalar_replaceable_reason = reason;)
+    _flags &= ~ScalarReplaceable;
   }
+#ifndef PRODUCT
+  const char* not_scalar_replaceable_reason() const { return _not_scalar_replaceable_reason; }
+#endif
 
   int edge_count()              const { return _edges.length(); }
   PointsToNode* edge(int e)     const { return _edges.at(e); }
@@ -247,7 +254,7 @@ public:
   JavaObjectNode(ConnectionGraph *CG, Node* n, EscapeState es):
     PointsToNode(CG, n, es, JavaObject) {
       if (es > NoEscape)
-        set_scalar_replaceable(false);
+        set_not_scalar_replaceable(NOT_PRODUCT("escapes"));
     }
 };
 
@@ -614,7 +621,11 @@ inline PointsToNode::PointsToNode(ConnectionGraph *CG, Node* n, EscapeState es,
   _fields_escape((u1)es),
   _node(n),
   _idx(n->_idx),
-  _pidx(CG->next_pidx()) {
+  _pidx(CG->next_pidx())
+#ifndef PRODUCT
+  , _not_scalar_replaceable_reason(NULL)
+#endif
+{
   assert(n != NULL && es != UnknownEscape, "sanity");
 }
 
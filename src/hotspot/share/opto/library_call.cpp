@@ -257,6 +257,8 @@ class LibraryCallKit : public GraphKit {
   bool inline_unsafe_writeback0();
   bool inline_unsafe_writebackSync0(bool is_pre);
   bool inline_unsafe_copyMemory();
+  bool inline_unsafe_copySwapMemory();
+  bool inline_unsafe_setMemory();
   bool inline_native_currentThread();
 
   bool inline_native_time_funcs(address method, const char* funcName);
@@ -328,6 +330,7 @@ class LibraryCallKit : public GraphKit {
   bool inline_montgomeryMultiply();
   bool inline_montgomerySquare();
   bool inline_vectorizedMismatch();
+  bool inline_array_hashcode(vmIntrinsics::ID id);
   bool inline_fma(vmIntrinsics::ID id);
   bool inline_character_compare(vmIntrinsics::ID id);
   bool inline_fp_min_max(vmIntrinsics::ID id);
@@ -764,6 +767,8 @@ bool LibraryCallKit::try_to_inline(int predicate) {
   case vmIntrinsics::_writebackPostSync0:       return inline_unsafe_writebackSync0(false);
   case vmIntrinsics::_allocateInstance:         return inline_unsafe_allocate();
   case vmIntrinsics::_copyMemory:               return inline_unsafe_copyMemory();
+  case vmIntrinsics::_copySwapMemory:           return inline_unsafe_copySwapMemory();
+  case vmIntrinsics::_setMemory:                return inline_unsafe_setMemory();
   case vmIntrinsics::_getLength:                return inline_native_getLength();
   case vmIntrinsics::_copyOf:                   return inline_array_copyOf(false);
   case vmIntrinsics::_copyOfRange:              return inline_array_copyOf(true);
@@ -848,6 +853,13 @@ bool LibraryCallKit::try_to_inline(int predicate) {
   case vmIntrinsics::_vectorizedMismatch:
     return inline_vectorizedMismatch();
 
+  case vmIntrinsics::_hashCodeB:
+  case vmIntrinsics::_hashCodeC:
+  case vmIntrinsics::_hashCodeI:
+  case vmIntrinsics::_hashCodeL:
+  case vmIntrinsics::_hashCodeU:
+    return inline_array_hashcode(intrinsic_id());
+
   case vmIntrinsics::_ghash_processBlocks:
     return inline_ghash_processBlocks();
   case vmIntrinsics::_base64_encodeBlock:
@@ -4214,6 +4226,89 @@ bool LibraryCallKit::inline_unsafe_copyMemory() {
   return true;
 }
 
+//----------------------inline_unsafe_copySwapMemory-------------------------
+// private native void Unsafe.copySwapMemory0(Object srcBase, long srcOffset, Object destBase, long destOffset, long bytes, long elemSize);
+bool LibraryCallKit::inline_unsafe_copySwapMemory() {
+  if (callee()->is_static())  return false;  // caller must have the capability!
+  null_check_receiver();  // null-check receiver
+  if (stopped())  return true;
+
+  C->set_has_unsafe_access(true);  // Mark eventual nmethod as "unsafe".
+
+  Node* src_ptr   =         argument(1);   // type: oop
+  Node* src_off   = ConvL2X(argument(2));  // type: long
+  Node* dst_ptr   =         argument(4);   // type: oop
+  Node* dst_off   = ConvL2X(argument(5));  // type: long
+  Node* size      = ConvL2X(argument(7));  // type: long
+  Node* elem_size = ConvL2X(argument(9));  // type: long, checked by the caller
+
+  src_ptr = access_resolve(src_ptr, ACCESS_READ);
+  dst_ptr = access_resolve(dst_ptr, ACCESS_WRITE);
+  Node* src = make_unsafe_address(src_ptr, src_off, ACCESS_READ);
+  Node* dst = make_unsafe_address(dst_ptr, dst_off, ACCESS_WRITE);
+
+  // Conservatively insert a memory barrier on all memory slices.
+  // Do not let writes of the copy source or destination float below the copy.
+  insert_mem_bar(Op_MemBarCPUOrder);
+
+  Node* thread = _gvn.transform(new ThreadLocalNode());
+  Node* doing_unsafe_access_addr = basic_plus_adr(top(), thread, in_bytes(JavaThread::doing_unsafe_access_offset()));
+  store_to_memory(control(), doing_unsafe_access_addr, intcon(1), T_BYTE, Compile::AliasIdxRaw, MemNode::unordered);
+
+  make_runtime_call(RC_LEAF|RC_NO_FP,
+                    OptoRuntime::unsafe_copyswap_Type(),
+                    StubRoutines::unsafe_copyswap(),
+                    "unsafe_copyswap",
+                    TypeRawPtr::BOTTOM,
+                    src, dst, size XTOP, elem_size XTOP);
+
+  store_to_memory(control(), doing_unsafe_access_addr, intcon(0), T_BYTE, Compile::AliasIdxRaw, MemNode::unordered);
+
+  // Do not let reads of the copy destination float above the copy.
+  insert_mem_bar(Op_MemBarCPUOrder);
+
+  return true;
+}
+
+//----------------------inline_unsafe_setMemory-------------------------
+// private native void Unsafe.setMemory0(Object base, long offset, long bytes, byte value);
+bool LibraryCallKit::inline_unsafe_setMemory() {
+  if (callee()->is_static())  return false;  // caller must have the capability!
+  null_check_receiver();  // null-check receiver
+  if (stopped())  return true;
+
+  C->set_has_unsafe_access(true);  // Mark eventual nmethod as "unsafe".
+
+  Node* dst_ptr =         argument(1);   // type: oop
+  Node* dst_off = ConvL2X(argument(2));  // type: long
+  Node* size    = ConvL2X(argument(4));  // type: long
+  Node* value   =         argument(6);   // type: byte
+
+  dst_ptr = access_resolve(dst_ptr, ACCESS_WRITE);
+  Node* dst = make_unsafe_address(dst_ptr, dst_off, ACCESS_WRITE);
+
+  // Do not let writes of the destination float below the fill.
+  insert_mem_bar(Op_MemBarCPUOrder);
+
+  Node* thread = _gvn.transform(new ThreadLocalNode());
+  Node* doing_unsafe_access_addr = basic_plus_adr(top(), thread, in_bytes(JavaThread::doing_unsafe_access_offset()));
+  store_to_memory(control(), doing_unsafe_access_addr, intcon(1), T_BYTE, Compile::AliasIdxRaw, MemNode::unordered);
+
+  make_runtime_call(RC_LEAF|RC_NO_FP,
+                    OptoRuntime::unsafe_setmemory_Type(),
+                    StubRoutines::unsafe_setmemory(),
+                    "unsafe_setmemory",
+                    TypeRawPtr::BOTTOM,
+                    dst, size XTOP, value);
+
+  store_to_memory(control(), doing_unsafe_access_addr, intcon(0), T_BYTE, Compile::AliasIdxRaw, MemNode::unordered);
+
+  // Do not let reads of the destination float above the fill.
+  insert_mem_bar(Op_MemBarCPUOrder);
+
+  return true;
+}
+
 //------------------------clone_coping-----------------------------------
 // Helper function for inline_native_clone.
 void LibraryCallKit::copy_to_clone(Node* obj, Node* alloc_obj, Node* obj_size, bool is_array) {
@@ -5356,6 +5451,81 @@ bool LibraryCallKit::inline_vectorizedMismatch() {
   return true;
 }
 
+//-------------inline_array_hashcode------------------------------
+// int java.util.Arrays.hashCode(byte[]/char[]/int[] a)
+// int java.lang.StringLatin1.hashCode(byte[] value)
+// int java.lang.StringUTF16.hashCode(byte[] value)
+bool LibraryCallKit::inline_array_hashcode(vmIntrinsics::ID id) {
+  assert(UseVectorizedHashCodeIntrinsic, "not implemented on this platform");
+  assert(callee()->signature()->size() == 1, "hashCode has 1 parameter");
+
+  BasicType ary_elem;      // element type of the array argument
+  BasicType hash_elem;     // element type read by the stub
+  int initial_value = 1;   // Arrays.hashCode starts from 1, String.hashCode from 0
+  switch (id) {
+  case vmIntrinsics::_hashCodeB: ary_elem = T_BYTE; hash_elem = T_BYTE;    break;
+  case vmIntrinsics::_hashCodeC: ary_elem = T_CHAR; hash_elem = T_CHAR;    break;
+  case vmIntrinsics::_hashCodeI: ary_elem = T_INT;  hash_elem = T_INT;     break;
+  case vmIntrinsics::_hashCodeL: ary_elem = T_BYTE; hash_elem = T_BOOLEAN; initial_value = 0; break;
+  case vmIntrinsics::_hashCodeU: ary_elem = T_BYTE; hash_elem = T_CHAR;    initial_value = 0; break;
+  default:
+    fatal_unexpected_iid(id);
+    return false;
+  }
+
+  const char* stubName;
+  address stubAddr = StubRoutines::select_hashcode_function(hash_elem, stubName);
+  if (stubAddr == NULL) {
+    return false; // Intrinsic's stub is not implemented on this platform
+  }
+
+  Node* ary = argument(0);
+  const TypeAryPtr* top_ary = ary->Value(&_gvn)->isa_aryptr();
+  if (top_ary == NULL || top_ary->klass() == NULL) {
+    // failed array check
+    return false;
+  }
+
+  // Arrays.hashCode returns 0 for a null array. The String helpers are only
+  // called with the (non-null) value array of a String.
+  RegionNode* region = new RegionNode(3);
+  PhiNode*    phi    = new PhiNode(region, TypeInt::INT);
+  if (initial_value == 1) {
+    Node* null_ctl = top();
+    ary = null_check_oop(ary, &null_ctl);
+    region->init_req(1, null_ctl);
+    phi   ->init_req(1, intcon(0));
+  } else {
+    ary = null_check(ary);
+  }
+  if (stopped()) {
+    // The array is always null.
+    set_control(_gvn.transform(region));
+    set_result(_gvn.transform(phi));
+    return true;
+  }
+
+  ary = access_resolve(ary, ACCESS_READ);
+  Node* ary_start = array_element_address(ary, intcon(0), ary_elem);
+  Node* length = load_array_length(ary);
+  if (id == vmIntrinsics::_hashCodeU) {
+    // Two bytes per char
+    length = _gvn.transform(new RShiftINode(length, intcon(1)));
+  }
+
+  Node* call = make_runtime_call(RC_LEAF|RC_NO_FP, OptoRuntime::array_hashcode_Type(),
+                                 stubAddr, stubName, TypeAryPtr::get_array_body_type(ary_elem),
+                                 ary_start, length, intcon(initial_value));
+  Node* hash = _gvn.transform(new ProjNode(call, TypeFunc::Parms));
+
+  region->init_req(2, control());
+  phi   ->init_req(2, hash);
+  set_control(_gvn.transform(region));
+  record_for_igvn(region);
+  set_result(_gvn.transform(phi));
+  return true;
+}
+
 /**
  * Calculate CRC32 for byte.
  * int java.util.zip.CRC32.update(int crc, int b)
@@ -24,6 +24,8 @@
 
 #include "precompiled.hpp"
 #include "compiler/compileLog.hpp"
+#include "gc/shared/barrierSet.hpp"
+#include "gc/shared/c2/barrierSetC2.hpp"
 #include "memory/allocation.inline.hpp"
 #include "opto/addnode.hpp"
 #include "opto/callnode.hpp"
@@ -844,11 +846,25 @@ bool IdealLoopTree::policy_unroll(PhaseIdealLoop *phase) {
   uint body_size = _body.size();
   // Key test to unroll loop in CRC32 java code
   int xors_in_loop = 0;
+  // Locks of a loop invariant object, see below
+  int invariant_locks = 0;
   // Also count ModL, DivL and MulL which expand mightly
   for (uint k = 0; k < _body.size(); k++) {
     Node* n = _body.at(k);
     switch (n->Opcode()) {
       case Op_XorI: xors_in_loop++; break; // CRC32 java code
+      case Op_Lock: {
+        LockNode* lock = n->as_Lock();
+        if (!lock->is_eliminated()) {
+          BarrierSetC2* bs = BarrierSet::barrier_set()->barrier_set_c2();
+          Node* obj = bs->step_over_gc_barrier(lock->obj_node());
+          Node* obj_ctrl = phase->has_ctrl(obj) ? phase->get_ctrl(obj) : obj;
+          if (!is_member(phase->get_loop(obj_ctrl))) {
+            invariant_locks++;
+          }
+        }
+        break;
+      }
       case Op_ModL: body_size += 30; break;
       case Op_DivL: body_size += 30; break;
       case Op_MulL: body_size += 10; break;
@@ -909,6 +925,17 @@ bool IdealLoopTree::policy_unroll(PhaseIdealLoop *phase) {
     if ((cl->is_subword_loop() || xors_in_loop >= 4) && body_size < 4u * LoopUnrollLimit) {
       return phase->may_require_nodes(estimate);
     }
+    // A loop that locks and unlocks the same object in every iteration
+    // (a synchronized collection filled in a loop) is worth unrolling
+    // even if it is large: once the copies of the body are adjacent,
+    // LockNode::Ideal coarsens the unlock at the end of one copy with the
+    // lock at the start of the next.  The unroll count bounds how long
+    // the lock is held without being released.
+    if (EliminateLocks && invariant_locks > 0 &&
+        future_unroll_cnt <= LoopLockCoarseningLimit &&
+        body_size < 4u * LoopUnrollLimit) {
+      return phase->may_require_nodes(estimate);
+    }
     return false; // Loop too big.
   }
 
@@ -2089,6 +2116,60 @@ void PhaseIdealLoop::do_maximally_unroll(IdealLoopTree *loop, Node_List &old_new
   }
 }
 
+Node* PhaseIdealLoop::convert_cmove_to_min_max(Node* cmov, Node* phi) {
+  if (cmov->Opcode() != Op_CMoveI || cmov->is_reduction()) {
+    return NULL;
+  }
+  Node* bol = cmov->in(CMoveNode::Condition);
+  if (!bol->is_Bool() || bol->in(1)->Opcode() != Op_CmpI) {
+    return NULL;
+  }
+
+  // Match (a < b) ? a : b and its variants
+  Node* a = bol->in(1)->in(1);
+  Node* b = bol->in(1)->in(2);
+  Node* if_true = cmov->in(CMoveNode::IfTrue);
+  Node* if_false = cmov->in(CMoveNode::IfFalse);
+  bool true_is_a;
+  if (if_true == a && if_false == b) {
+    true_is_a = true;
+  } else if (if_true == b && if_false == a) {
+    true_is_a = false;
+  } else {
+    return NULL;
+  }
+  if (a != phi && b != phi) {
+    return NULL;
+  }
+
+  bool is_min;
+  switch (bol->as_Bool()->_test._test) {
+    case BoolTest::lt:
+    case BoolTest::le:
+      is_min = true_is_a;
+      break;
+    case BoolTest::gt:
+    case BoolTest::ge:
+      is_min = !true_is_a;
+      break;
+    default:
+      return NULL;
+  }
+
+  // Min and Max nodes have fewer optimizations than CMove, only convert
+  // when the resulting reduction can be vectorized.
+  if (!Matcher::match_rule_supported(is_min ? Op_MinReductionVI : Op_MaxReductionVI)) {
+    return NULL;
+  }
+
+  // Keep the phi as the first input, as expected for reductions
+  Node* other = (a == phi) ? b : a;
+  Node* min_max = is_min ? (Node*)new MinINode(phi, other) : (Node*)new MaxINode(phi, other);
+  register_new_node(min_max, get_ctrl(cmov));
+  _igvn.replace_node(cmov, min_max);
+  return min_max;
+}
+
 void PhaseIdealLoop::mark_reductions(IdealLoopTree *loop) {
   if (SuperWordReductions == false) return;
 
@@ -2107,6 +2188,12 @@ void PhaseIdealLoop::mark_reductions(IdealLoopTree *loop) {
       if (def_node != NULL) {
         Node* n_ctrl = get_ctrl(def_node);
         if (n_ctrl != NULL && loop->is_member(get_loop(n_ctrl))) {
+          // Math.min/max(int) are intrinsified as CMoveI, look through them.
+          Node* min_max = convert_cmove_to_min_max(def_node, phi);
+          if (min_max != NULL) {
+            def_node = min_max;
+          }
+
           // Now test it to see if it fits the standard pattern for a reduction operator.
           int opc = def_node->Opcode();
           if (opc != ReductionNode::opcode(opc, def_node->bottom_type()->basic_type())
@@ -3781,3 +3868,99 @@ bool PhaseIdealLoop::intrinsify_fill(IdealLoopTree* lpt) {
 
   return true;
 }
+
+// Return true if the address computation n uses iv, looking through the
+// few nodes that usually compute a scaled array index.
+static bool address_uses_iv(Node* n, Node* iv, int depth) {
+  if (n == iv) {
+    return true;
+  }
+  if (depth == 0) {
+    return false;
+  }
+  switch (n->Opcode()) {
+  case Op_AddP:
+    return address_uses_iv(n->in(AddPNode::Address), iv, depth - 1) ||
+           address_uses_iv(n->in(AddPNode::Offset), iv, depth - 1);
+  case Op_ConvI2L:
+  case Op_CastII:
+    return address_uses_iv(n->in(1), iv, depth - 1);
+  case Op_LShiftI:
+  case Op_LShiftL:
+    return address_uses_iv(n->in(1), iv, depth - 1);
+  case Op_AddI:
+  case Op_AddL:
+  case Op_SubI:
+  case Op_SubL:
+    return address_uses_iv(n->in(1), iv, depth - 1) ||
+           address_uses_iv(n->in(2), iv, depth - 1);
+  default:
+    return false;
+  }
+}
+
+//------------------------------find_row_load----------------------------------
+// Return a load of a row of a loop invariant array of arrays indexed by the
+// induction variable of this innermost counted loop, if there is one. If the
+// enclosing loop is counted too, the nest walks the array in column order:
+// every inner iteration touches a different row, which defeats the caches
+// and SuperWord. Interchanging the loops is left to the programmer, so this
+// is only reported (-XX:+TraceLoopOpts, -XX:+LogCompilation).
+Node* IdealLoopTree::find_row_load() const {
+  CountedLoopNode* cl = _head->as_CountedLoop();
+  Node* iv = cl->phi();
+  if (iv == NULL) {
+    return NULL;
+  }
+  for (uint i = 0; i < _body.size(); i++) {
+    Node* n = _body.at(i);
+    if (!n->is_Load() || (n->Opcode() != Op_LoadP && n->Opcode() != Op_LoadN)) {
+      continue;
+    }
+    const TypePtr* row_type = n->bottom_type()->make_ptr();
+    if (row_type == NULL || row_type->isa_aryptr() == NULL) {
+      continue;
+    }
+    Node* adr = n->in(MemNode::Address);
+    if (!adr->is_AddP()) {
+      continue;
+    }
+    Node* base = adr->in(AddPNode::Base);
+    if (base->is_top() || !is_invariant(base) ||
+        _phase->igvn().type(base)->isa_aryptr() == NULL) {
+      continue;
+    }
+    if (address_uses_iv(adr, iv, 6)) {
+      return n;
+    }
+  }
+  return NULL;
+}
+
+void PhaseIdealLoop::report_column_order_nests() {
+  for (LoopTreeIterator iter(_ltree_root); !iter.done(); iter.next()) {
+    IdealLoopTree* lpt = iter.current();
+    if (!lpt->is_counted() || !lpt->is_innermost() ||
+        lpt->_parent == NULL || !lpt->_parent->is_counted()) {
+      continue;
+    }
+    CountedLoopNode* cl = lpt->_head->as_CountedLoop();
+    if (!cl->is_normal_loop() && !cl->is_main_loop()) {
+      continue;
+    }
+    Node* row_load = lpt->find_row_load();
+    if (row_load == NULL) {
+      continue;
+    }
+#ifndef PRODUCT
+    if (TraceLoopOpts) {
+      tty->print("ColumnOrderNest ");
+      lpt->dump_head();
+    }
+#endif
+    if (C->log() != NULL) {
+      C->log()->elem("column_order_nest loop='%d' outer_loop='%d' row_load='%d'",
+                     cl->_idx, lpt->_parent->_head->_idx, row_load->_idx);
+    }
+  }
+}
@@ -32,11 +32,13 @@
 #include "memory/resourceArea.hpp"
 #include "opto/addnode.hpp"
 #include "opto/callnode.hpp"
+#include "opto/castnode.hpp"
 #include "opto/connode.hpp"
 #include "opto/convertnode.hpp"
 #include "opto/divnode.hpp"
 #include "opto/idealGraphPrinter.hpp"
 #include "opto/loopnode.hpp"
+#include "opto/movenode.hpp"
 #include "opto/mulnode.hpp"
 #include "opto/rootnode.hpp"
 #include "opto/superword.hpp"
@@ -895,6 +897,247 @@ bool PhaseIdealLoop::is_counted_loop(Node* x, IdealLoopTree*& loop) {
   return true;
 }
 
+//----------------------create_long_loop_nest---------------------------------
+// Recognize an innermost loop with a long induction variable, a constant
+// int stride and a loop invariant limit:
+//
+//   for (long i = init; i < limit; i += stride) { body(i); }
+//
+// and turn it into a loop nest whose inner loop has an int induction
+// variable, so that is_counted_loop() accepts it in the next round of loop
+// opts and range check elimination, unrolling and SuperWord apply:
+//
+//   for (long i = init; i < limit; ) {
+//     int iters = (int)MIN2(MAX2(limit - i, 0), max_jint - 2 * stride);
+//     int j = 0;
+//     do { body(i + j); j += stride; } while (j < iters);
+//     i += j;
+//   }
+//
+// The inner exit test implies the original one, which is kept as the exit
+// test of the outer loop. The inner loop so never runs an iteration the
+// original loop would not have run, and exiting it early only costs an
+// extra trip around the outer loop.
+bool PhaseIdealLoop::create_long_loop_nest(Node* x, IdealLoopTree* &loop) {
+  if (!UseLongLoopNests || x->Opcode() != Op_Loop || x->req() != 3 ||
+      loop->_irreducible || loop->_child != NULL) {
+    return false;
+  }
+  Node* init_control = x->in(LoopNode::EntryControl);
+  Node* back_control = x->in(LoopNode::LoopBackControl);
+  if (init_control == NULL || back_control == NULL ||
+      init_control->is_top() || back_control->is_top()) {
+    return false;
+  }
+
+  // The exit test must be at the end of the body: a safepoint between the
+  // exit test and the loop head would be at the wrong place once the loop
+  // is split in two.
+  uint back_op = back_control->Opcode();
+  if (back_op != Op_IfTrue && back_op != Op_IfFalse) {
+    return false;
+  }
+  Node* iff = back_control->in(0);
+  if (!iff->is_If() || iff->outcnt() != 2 || get_loop(iff) != loop || !iff->in(1)->is_Bool()) {
+    return false;
+  }
+  BoolNode* test = iff->in(1)->as_Bool();
+  BoolTest::mask bt = test->_test._test;
+  if (back_op == Op_IfFalse) {
+    bt = BoolTest(bt).negate();
+  }
+  Node* cmp = test->in(1);
+  if (cmp->Opcode() != Op_CmpL) {
+    return false;
+  }
+
+  Node* iv = cmp->in(1);
+  Node* limit = cmp->in(2);
+  if (!is_member(loop, get_ctrl(iv))) {
+    swap(iv, limit);
+    bt = BoolTest(bt).commute();
+  }
+  if (is_member(loop, get_ctrl(limit)) || !is_member(loop, get_ctrl(iv))) {
+    return false;
+  }
+
+  // The test is on either the phi or the increment of the phi.
+  bool test_on_phi = iv->is_Phi();
+  Node* incr = test_on_phi ? iv->in(LoopNode::LoopBackControl) : iv;
+  if (incr == NULL || incr->Opcode() != Op_AddL) {
+    return false;
+  }
+  Node* xphi = incr->in(1);
+  Node* stride = incr->in(2);
+  if (!stride->is_Con()) {
+    swap(xphi, stride);
+  }
+  if (!stride->is_Con() || !xphi->is_Phi() || xphi->in(0) != x || xphi->req() != 3 ||
+      (test_on_phi && xphi != iv) || xphi->in(LoopNode::LoopBackControl) != incr) {
+    return false;
+  }
+  PhiNode* phi = xphi->as_Phi();
+
+  jlong stride_con = stride->get_long();
+  if (stride_con == 0 || ABS(stride_con) > max_jint / 4) {
+    return false;
+  }
+  if (!((stride_con > 0 && (bt == BoolTest::lt || bt == BoolTest::le)) ||
+        (stride_con < 0 && (bt == BoolTest::gt || bt == BoolTest::ge)))) {
+    return false;
+  }
+
+  // ---- Build the outer loop ----
+  Node* sfpt = iff->in(0);
+  if (sfpt->Opcode() != Op_SafePoint || get_loop(sfpt) != loop) {
+    sfpt = NULL;
+  }
+  ProjNode* exit_branch = iff->as_If()->proj_out(back_op == Op_IfFalse);
+
+  Node* inner_exit_branch = exit_branch->clone();
+  IfNode* outer_test = new IfNode(inner_exit_branch, test, iff->as_If()->_prob, iff->as_If()->_fcnt);
+  Node* outer_back = back_control->clone();
+  outer_back->set_req(0, outer_test);
+  Node* outer_tail = outer_back;
+  if (sfpt != NULL) {
+    // The inner loop may become a counted loop without a safepoint, so
+    // the outer loop needs one of its own. The state at the safepoint is
+    // the one at the end of the last inner iteration.
+    outer_tail = sfpt->clone();
+    outer_tail->set_req(0, outer_back);
+  }
+  LoopNode* outer_head = new LoopNode(init_control, outer_tail);
+
+  IdealLoopTree* outer_ilt = new IdealLoopTree(this, outer_head, outer_tail);
+  IdealLoopTree* parent = loop->_parent;
+  IdealLoopTree* sibling = parent->_child;
+  if (sibling == loop) {
+    parent->_child = outer_ilt;
+  } else {
+    while (sibling->_next != loop) {
+      sibling = sibling->_next;
+    }
+    sibling->_next = outer_ilt;
+  }
+  outer_ilt->_next = loop->_next;
+  outer_ilt->_parent = parent;
+  outer_ilt->_child = loop;
+  outer_ilt->_nest = loop->_nest;
+  loop->_parent = outer_ilt;
+  loop->_next = NULL;
+  loop->_nest++;
+
+  _igvn.register_new_node_with_optimizer(outer_head);
+  set_loop(outer_head, outer_ilt);
+  set_idom(outer_head, init_control, dom_depth(init_control) + 1);
+  _igvn.replace_input_of(x, LoopNode::EntryControl, outer_head);
+  set_idom(x, outer_head, dom_depth(outer_head) + 1);
+
+  register_control(inner_exit_branch, outer_ilt, iff);
+  register_control(outer_test, outer_ilt, inner_exit_branch);
+  register_control(outer_back, outer_ilt, outer_test);
+  if (sfpt != NULL) {
+    register_control(outer_tail, outer_ilt, outer_back);
+  }
+  _igvn.replace_input_of(exit_branch, 0, outer_test);
+  set_idom(exit_branch, outer_test, dom_depth(outer_test) + 1);
+
+  // The other phis of the loop get an outer loop phi that carries their
+  // value from one inner loop to the next.
+  Node_List phis;
+  for (DUIterator_Fast imax, i = x->fast_outs(imax); i < imax; i++) {
+    Node* u = x->fast_out(i);
+    if (u->is_Phi() && u != phi) {
+      phis.push(u);
+    }
+  }
+  for (uint i = 0; i < phis.size(); i++) {
+    Node* u = phis.at(i);
+    Node* clone = u->clone();
+    clone->set_req(0, outer_head);
+    register_new_node(clone, outer_head);
+    _igvn.replace_input_of(u, LoopNode::EntryControl, clone);
+  }
+  Node* outer_phi = phi->clone();
+  outer_phi->set_req(0, outer_head);
+  register_new_node(outer_phi, outer_head);
+
+  // ---- Compute the number of inner iterations ----
+  // Leave room for is_counted_loop() to adjust the limit of a test on the
+  // phi by the stride without overflowing.
+  jlong iters_max = max_jint - 2 * ABS(stride_con);
+  Node* zero = _igvn.longcon(0);
+  Node* cap = _igvn.longcon(iters_max);
+  set_ctrl(zero, C->root());
+  set_ctrl(cap, C->root());
+  Node* diff = (stride_con > 0) ? new SubLNode(limit, outer_phi) : new SubLNode(outer_phi, limit);
+  register_new_node(diff, outer_head);
+  // The difference may overflow; it is then negative and clamped to 0,
+  // which makes the inner loop exit after one iteration.
+  Node* cmp_zero = new CmpLNode(diff, zero);
+  register_new_node(cmp_zero, outer_head);
+  Node* bol_zero = new BoolNode(cmp_zero, BoolTest::lt);
+  register_new_node(bol_zero, outer_head);
+  Node* at_least_zero = CMoveNode::make(NULL, bol_zero, diff, zero, TypeLong::LONG);
+  register_new_node(at_least_zero, outer_head);
+  Node* cmp_cap = new CmpLNode(at_least_zero, cap);
+  register_new_node(cmp_cap, outer_head);
+  Node* bol_cap = new BoolNode(cmp_cap, BoolTest::gt);
+  register_new_node(bol_cap, outer_head);
+  Node* iters_long = CMoveNode::make(NULL, bol_cap, at_least_zero, cap, TypeLong::make(0, iters_max, Type::WidenMin));
+  register_new_node(iters_long, outer_head);
+  Node* int_zero = _igvn.intcon(0);
+  set_ctrl(int_zero, C->root());
+  Node* iters = new ConvL2INode(iters_long);
+  register_new_node(iters, outer_head);
+  // ConvL2I does not narrow the type of its input, while is_counted_loop()
+  // needs to see that the limit can not overflow with the stride added.
+  iters = new CastIINode(iters, TypeInt::make(0, (jint)iters_max, Type::WidenMin));
+  register_new_node(iters, outer_head);
+  if (stride_con < 0) {
+    iters = new SubINode(int_zero, iters);
+    register_new_node(iters, outer_head);
+  }
+
+  // ---- Build the int induction variable of the inner loop ----
+  Node* int_stride = _igvn.intcon((jint)stride_con);
+  set_ctrl(int_stride, C->root());
+  PhiNode* inner_phi = PhiNode::make(x, int_zero, TypeInt::INT);
+  Node* inner_incr = new AddINode(inner_phi, int_stride);
+  inner_phi->set_req(LoopNode::LoopBackControl, inner_incr);
+  register_new_node(inner_phi, x);
+  register_new_node(inner_incr, x);
+  Node* inner_cmp = new CmpINode(test_on_phi ? (Node*)inner_phi : inner_incr, iters);
+  register_new_node(inner_cmp, x);
+  // inner_bt is the condition to stay in the loop, as bt is.
+  BoolTest::mask inner_bt = (back_op == Op_IfTrue) ? bt : BoolTest(bt).negate();
+  Node* inner_bol = new BoolNode(inner_cmp, inner_bt);
+  register_new_node(inner_bol, x);
+  _igvn.replace_input_of(iff, 1, inner_bol);
+
+  // ---- Express the long induction variable with the int one ----
+  Node* iv_phi = new AddLNode(outer_phi, new ConvI2LNode(inner_phi));
+  register_new_node(iv_phi->in(2), x);
+  register_new_node(iv_phi, x);
+  Node* iv_incr = new AddLNode(outer_phi, new ConvI2LNode(inner_incr));
+  register_new_node(iv_incr->in(2), x);
+  register_new_node(iv_incr, x);
+  // The uses of the old increment include the outer phi's backedge and
+  // the outer exit test.
+  _igvn.replace_node(incr, iv_incr);
+  _igvn.replace_node(phi, iv_phi);
+
+  C->set_major_progress();
+#ifndef PRODUCT
+  if (TraceLoopOpts) {
+    tty->print("LongLoopNest ");
+    loop->dump_head();
+  }
+#endif
+  loop = outer_ilt;
+  return true;
+}
+
 //----------------------exact_limit-------------------------------------------
 Node* PhaseIdealLoop::exact_limit( IdealLoopTree *loop ) {
   assert(loop->_head->is_CountedLoop(), "");
@@ -2412,6 +2655,7 @@ void IdealLoopTree::counted_loop( PhaseIdealLoop *phase ) {
   }
 
   IdealLoopTree* loop = this;
+  bool long_loop_nest = false;
   if (_head->is_CountedLoop() ||
       phase->is_counted_loop(_head, loop)) {
 
@@ -2427,6 +2671,10 @@ void IdealLoopTree::counted_loop( PhaseIdealLoop *phase ) {
     // Look for induction variables
     phase->replace_parallel_iv(this);
 
+  } else if (_parent != NULL && phase->create_long_loop_nest(_head, loop)) {
+    // The inner loop of the nest is recognized as a counted loop in the
+    // next round of loop opts. Keep its safepoint until then.
+    long_loop_nest = true;
   } else if (_parent != NULL && !_irreducible) {
     // Not a counted loop. Keep one safepoint.
     bool keep_one_sfpt = true;
@@ -2434,7 +2682,7 @@ void IdealLoopTree::counted_loop( PhaseIdealLoop *phase ) {
   }
 
   // Recursively
-  assert(loop->_child != this || (loop->_head->as_Loop()->is_OuterStripMinedLoop() && _head->as_CountedLoop()->is_strip_mined()), "what kind of loop was added?");
+  assert(loop->_child != this || long_loop_nest || (loop->_head->as_Loop()->is_OuterStripMinedLoop() && _head->as_CountedLoop()->is_strip_mined()), "what kind of loop was added?");
   assert(loop->_child != this || (loop->_child->_child == NULL && loop->_child->_next == NULL), "would miss some loops");
   if (loop->_child && loop->_child != this) loop->_child->counted_loop(phase);
   if (loop->_next)  loop->_next ->counted_loop(phase);
@@ -3110,6 +3358,11 @@ void PhaseIdealLoop::build_and_optimize(LoopOptsMode mode) {
      C->set_major_progress();
   }
 
+  // Report loop nests walking arrays of arrays in column order.
+  if ((TraceLoopOpts || C->log() != NULL) && C->has_loops() && !C->major_progress()) {
+    report_column_order_nests();
+  }
+
   // Convert scalar to superword operations at the end of all loop opts.
   if (UseSuperWord && C->has_loops() && !C->major_progress()) {
     // SuperWord transform
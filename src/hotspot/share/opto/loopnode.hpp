@@ -655,6 +655,9 @@ public:
 
   void remove_main_post_loops(CountedLoopNode *cl, PhaseIdealLoop *phase);
 
+  // Find a row load of an array of arrays indexed by the loop's iv
+  Node* find_row_load() const;
+
 #ifndef PRODUCT
   void dump_head() const;       // Dump loop head only
   void dump() const;            // Dump this loop recursively
@@ -1027,6 +1030,8 @@ public:
   virtual Node* transform(Node* n) { return 0; }
 
   bool is_counted_loop(Node* n, IdealLoopTree* &loop);
+  bool create_long_loop_nest(Node* x, IdealLoopTree* &loop);
+  void report_column_order_nests();
   IdealLoopTree* create_outer_strip_mined_loop(BoolNode *test, Node *cmp, Node *init_control,
                                                IdealLoopTree* loop, float cl_prob, float le_fcnt,
                                                Node*& entry_control, Node*& iffalse);
@@ -1120,6 +1125,10 @@ public:
   // Mark vector reduction candidates before loop unrolling
   void mark_reductions( IdealLoopTree *loop );
 
+  // Convert a CMoveI computing the min or max of phi and another value
+  // into a MinI/MaxI reduction candidate. Returns NULL if not possible.
+  Node* convert_cmove_to_min_max(Node* cmov, Node* phi);
+
   // Return true if exp is a constant times an induction var
   bool is_scaled_iv(Node* exp, Node* iv, int* p_scale);
 
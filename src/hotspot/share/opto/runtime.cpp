@@ -779,6 +779,46 @@ const TypeFunc* OptoRuntime::array_fill_Type() {
   return TypeFunc::make(domain, range);
 }
 
+const TypeFunc* OptoRuntime::unsafe_setmemory_Type() {
+  const Type** fields;
+  int argp = TypeFunc::Parms;
+  // create input type (domain): pointer, size_t, byte
+  fields = TypeTuple::fields(3 LP64_ONLY( + 1));
+  fields[argp++] = TypePtr::NOTNULL;
+  fields[argp++] = TypeX_X;               // size in bytes (size_t)
+  LP64_ONLY(fields[argp++] = Type::HALF); // other half of long length
+  fields[argp++] = TypeInt::BYTE;
+  const TypeTuple *domain = TypeTuple::make(argp, fields);
+
+  // create result type
+  fields = TypeTuple::fields(1);
+  fields[TypeFunc::Parms+0] = NULL; // void
+  const TypeTuple *range = TypeTuple::make(TypeFunc::Parms, fields);
+
+  return TypeFunc::make(domain, range);
+}
+
+const TypeFunc* OptoRuntime::unsafe_copyswap_Type() {
+  const Type** fields;
+  int argp = TypeFunc::Parms;
+  // create input type (domain): pointer, pointer, size_t, size_t
+  fields = TypeTuple::fields(4 LP64_ONLY( + 2));
+  fields[argp++] = TypePtr::NOTNULL;
+  fields[argp++] = TypePtr::NOTNULL;
+  fields[argp++] = TypeX_X;               // size in bytes (size_t)
+  LP64_ONLY(fields[argp++] = Type::HALF); // other half of long length
+  fields[argp++] = TypeX_X;               // element size in bytes (size_t)
+  LP64_ONLY(fields[argp++] = Type::HALF); // other half of long length
+  const TypeTuple *domain = TypeTuple::make(argp, fields);
+
+  // create result type
+  fields = TypeTuple::fields(1);
+  fields[TypeFunc::Parms+0] = NULL; // void
+  const TypeTuple *range = TypeTuple::make(TypeFunc::Parms, fields);
+
+  return TypeFunc::make(domain, range);
+}
+
 // for aescrypt encrypt/decrypt operations, just three pointers returning void (length is constant)
 const TypeFunc* OptoRuntime::aescrypt_block_Type() {
   // create input type (domain)
@@ -1131,6 +1171,26 @@ const TypeFunc* OptoRuntime::vectorizedMismatch_Type() {
   return TypeFunc::make(domain, range);
 }
 
+// int array_hashcode(address ary, int length, int initial_value)
+const TypeFunc* OptoRuntime::array_hashcode_Type() {
+  // create input type (domain)
+  int num_args = 3;
+  int argcnt = num_args;
+  const Type** fields = TypeTuple::fields(argcnt);
+  int argp = TypeFunc::Parms;
+  fields[argp++] = TypePtr::NOTNULL;    // ary
+  fields[argp++] = TypeInt::INT;        // length, number of elements
+  fields[argp++] = TypeInt::INT;        // initial_value
+  assert(argp == TypeFunc::Parms + argcnt, "correct decoding");
+  const TypeTuple* domain = TypeTuple::make(TypeFunc::Parms + argcnt, fields);
+
+  // return hash (int)
+  fields = TypeTuple::fields(1);
+  fields[TypeFunc::Parms + 0] = TypeInt::INT;
+  const TypeTuple* range = TypeTuple::make(TypeFunc::Parms + 1, fields);
+  return TypeFunc::make(domain, range);
+}
+
 // GHASH block processing
 const TypeFunc* OptoRuntime::ghash_processBlocks_Type() {
     int argcnt = 4;
@@ -273,6 +273,9 @@ private:
 
   static const TypeFunc* array_fill_Type();
 
+  static const TypeFunc* unsafe_setmemory_Type();
+  static const TypeFunc* unsafe_copyswap_Type();
+
   static const TypeFunc* aescrypt_block_Type();
   static const TypeFunc* cipherBlockChaining_aescrypt_Type();
   static const TypeFunc* electronicCodeBook_aescrypt_Type();
@@ -290,6 +293,7 @@ private:
   static const TypeFunc* mulAdd_Type();
 
   static const TypeFunc* vectorizedMismatch_Type();
+  static const TypeFunc* array_hashcode_Type();
 
   static const TypeFunc* ghash_processBlocks_Type();
   static const TypeFunc* base64_encodeBlock_Type();
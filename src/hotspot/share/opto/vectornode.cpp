@@ -640,6 +640,14 @@ int ReductionNode::opcode(int opc, BasicType bt) {
       assert(bt == T_DOUBLE, "must be");
       vopc = Op_MaxReductionV;
       break;
+    case Op_MinI:
+      assert(bt == T_INT, "must be");
+      vopc = Op_MinReductionVI;
+      break;
+    case Op_MaxI:
+      assert(bt == T_INT, "must be");
+      vopc = Op_MaxReductionVI;
+      break;
     // TODO: add MulL for targets that support it
     default:
       break;
@@ -666,6 +674,8 @@ ReductionNode* ReductionNode::make(int opc, Node *ctrl, Node* n1, Node* n2, Basi
   case Op_MulReductionVD: return new MulReductionVDNode(ctrl, n1, n2);
   case Op_MinReductionV: return new MinReductionVNode(ctrl, n1, n2);
   case Op_MaxReductionV: return new MaxReductionVNode(ctrl, n1, n2);
+  case Op_MinReductionVI: return new MinReductionVINode(ctrl, n1, n2);
+  case Op_MaxReductionVI: return new MaxReductionVINode(ctrl, n1, n2);
   default:
     fatal("Missed vector creation for '%s'", NodeClassNames[vopc]);
     return NULL;
@@ -675,6 +675,26 @@ public:
   }
 };
 
+//------------------------------MinReductionVINode-----------------------------
+// Vector min int as a reduction
+class MinReductionVINode : public ReductionNode {
+public:
+  MinReductionVINode(Node *ctrl, Node* in1, Node* in2) : ReductionNode(ctrl, in1, in2) {}
+  virtual int Opcode() const;
+  virtual const Type* bottom_type() const { return TypeInt::INT; }
+  virtual uint ideal_reg() const { return Op_RegI; }
+};
+
+//------------------------------MaxReductionVINode-----------------------------
+// Vector max int as a reduction
+class MaxReductionVINode : public ReductionNode {
+public:
+  MaxReductionVINode(Node *ctrl, Node* in1, Node* in2) : ReductionNode(ctrl, in1, in2) {}
+  virtual int Opcode() const;
+  virtual const Type* bottom_type() const { return TypeInt::INT; }
+  virtual uint ideal_reg() const { return Op_RegI; }
+};
+
 //================================= M E M O R Y ===============================
 
 //------------------------------LoadVectorNode---------------------------------
@@ -3071,18 +3071,19 @@ JNI_ENTRY(void, jni_GetStringUTFRegion(JNIEnv *env, jstring string, jsize start,
 JNI_END
 
 static oop lock_gc_or_pin_object(JavaThread* thread, jobject obj) {
-  if (Universe::heap()->supports_object_pinning()) {
-    const oop o = JNIHandles::resolve_non_null(obj);
+  const oop o = JNIHandles::resolve_non_null(obj);
+  if (Universe::heap()->can_pin_object(o)) {
     return Universe::heap()->pin_object(thread, o);
   } else {
     GCLocker::lock_critical(thread);
+    // Resolve again, lock_critical() may have blocked for a GC.
     return JNIHandles::resolve_non_null(obj);
   }
 }
 
 static void unlock_gc_or_unpin_object(JavaThread* thread, jobject obj) {
-  if (Universe::heap()->supports_object_pinning()) {
-    const oop o = JNIHandles::resolve_non_null(obj);
+  const oop o = JNIHandles::resolve_non_null(obj);
+  if (Universe::heap()->can_pin_object(o)) {
     return Universe::heap()->unpin_object(thread, o);
   } else {
     GCLocker::unlock_critical(thread);
@@ -810,9 +810,13 @@ JvmtiEnvBase::get_stack_trace(JavaThread *java_thread,
 #ifdef ASSERT
   uint32_t debug_bits = 0;
 #endif
+  // Handshake closures run in the target thread itself, or in the VM thread
+  // on behalf of a blocked target thread.
   assert((SafepointSynchronize::is_at_safepoint() ||
+          java_thread == Thread::current() ||
+          Thread::current()->is_VM_thread() ||
           java_thread->is_thread_fully_suspended(false, &debug_bits)),
-         "at safepoint or target thread is suspended");
+         "at safepoint, in handshake, current thread or target thread is suspended");
   int count = 0;
   if (java_thread->has_last_Java_frame()) {
     RegisterMap reg_map(java_thread);
@@ -1562,12 +1566,11 @@ VM_GetCurrentContendedMonitor::doit() {
 }
 
 void
-VM_GetStackTrace::doit() {
-  _result = JVMTI_ERROR_THREAD_NOT_ALIVE;
-  ThreadsListHandle tlh;
-  if (_java_thread != NULL && tlh.includes(_java_thread)
-      && !_java_thread->is_exiting() && _java_thread->threadObj() != NULL) {
-    _result = ((JvmtiEnvBase *)_env)->get_stack_trace(_java_thread,
+GetStackTraceClosure::do_thread(Thread *target) {
+  assert(target->is_Java_thread(), "just checking");
+  JavaThread *jt = (JavaThread *)target;
+  if (!jt->is_exiting() && jt->threadObj() != NULL) {
+    _result = ((JvmtiEnvBase *)_env)->get_stack_trace(jt,
                                                       _start_depth, _max_count,
                                                       _frame_buffer, _count_ptr);
   }
@@ -1521,13 +1521,10 @@ void JvmtiExport::post_resource_exhausted(jint resource_exhausted_flags, const c
 }
 
 void JvmtiExport::post_method_entry(JavaThread *thread, Method* method, frame current_frame) {
-  HandleMark hm(thread);
-  methodHandle mh(thread, method);
-
   EVT_TRIG_TRACE(JVMTI_EVENT_METHOD_ENTRY, ("[%s] Trg Method Entry triggered %s.%s",
                      JvmtiTrace::safe_get_thread_name(thread),
-                     (mh() == NULL) ? "NULL" : mh()->klass_name()->as_C_string(),
-                     (mh() == NULL) ? "NULL" : mh()->name()->as_C_string() ));
+                     (method == NULL) ? "NULL" : method->klass_name()->as_C_string(),
+                     (method == NULL) ? "NULL" : method->name()->as_C_string() ));
 
   JvmtiThreadState* state = thread->jvmti_thread_state();
   if (state == NULL || !state->is_interp_only_mode()) {
@@ -1537,7 +1534,11 @@ void JvmtiExport::post_method_entry(JavaThread *thread, Method* method, frame cu
 
   state->incr_cur_stack_depth();
 
+  // interp_only_mode is also used for FramePop and SingleStep, so only
+  // set up handles when there is a method entry event to post
   if (state->is_enabled(JVMTI_EVENT_METHOD_ENTRY)) {
+    HandleMark hm(thread);
+    methodHandle mh(thread, method);
     JvmtiEnvThreadStateIterator it(state);
     for (JvmtiEnvThreadState* ets = it.first(); ets != NULL; ets = it.next(ets)) {
       if (ets->is_enabled(JVMTI_EVENT_METHOD_ENTRY)) {
@@ -1559,13 +1560,10 @@ void JvmtiExport::post_method_entry(JavaThread *thread, Method* method, frame cu
 }
 
 void JvmtiExport::post_method_exit(JavaThread *thread, Method* method, frame current_frame) {
-  HandleMark hm(thread);
-  methodHandle mh(thread, method);
-
   EVT_TRIG_TRACE(JVMTI_EVENT_METHOD_EXIT, ("[%s] Trg Method Exit triggered %s.%s",
                      JvmtiTrace::safe_get_thread_name(thread),
-                     (mh() == NULL) ? "NULL" : mh()->klass_name()->as_C_string(),
-                     (mh() == NULL) ? "NULL" : mh()->name()->as_C_string() ));
+                     (method == NULL) ? "NULL" : method->klass_name()->as_C_string(),
+                     (method == NULL) ? "NULL" : method->name()->as_C_string() ));
 
   JvmtiThreadState *state = thread->jvmti_thread_state();
   if (state == NULL || !state->is_interp_only_mode()) {
@@ -1578,7 +1576,10 @@ void JvmtiExport::post_method_exit(JavaThread *thread, Method* method, frame cur
   bool exception_exit = state->is_exception_detected() && !state->is_exception_caught();
 
 
+  // as for method entry, only set up handles when an event is posted
   if (state->is_enabled(JVMTI_EVENT_METHOD_EXIT)) {
+    HandleMark hm(thread);
+    methodHandle mh(thread, method);
     Handle result;
     jvalue value;
     value.j = 0L;
@@ -1627,6 +1628,8 @@ void JvmtiExport::post_method_exit(JavaThread *thread, Method* method, frame cur
         // we have a NotifyFramePop entry for this frame.
         // now check that this env/thread wants this event
         if (ets->is_enabled(JVMTI_EVENT_FRAME_POP)) {
+          HandleMark hm(thread);
+          methodHandle mh(thread, method);
           EVT_TRACE(JVMTI_EVENT_FRAME_POP, ("[%s] Evt Frame Pop sent %s.%s",
                                             JvmtiTrace::safe_get_thread_name(thread),
                                             (mh() == NULL) ? "NULL" : mh()->klass_name()->as_C_string(),
@@ -227,6 +227,7 @@ void VM_RedefineClasses::doit() {
   ClassLoaderDataGraph::classes_do(&adjust_and_clean_metadata);
 
   // JSR-292 support
+  SystemDictionary::clear_method_handle_invokers();
   if (_any_class_has_resolved_methods) {
     bool trace_name_printed = false;
     ResolvedMethodTable::adjust_method_entries(&trace_name_printed);
@@ -3427,6 +3428,27 @@ void VM_RedefineClasses::set_new_constant_pool(
 // must be cleaned.
 
 // Adjust cpools and vtables closure
+// The vtable, itable and default methods of a class only hold methods
+// of the class itself, of its superclasses and of its interfaces. If
+// none of them is being redefined, there are no old methods to clean
+// out of these tables. Classes being redefined by another, concurrent
+// redefinition are also seen as being redefined; adjusting them is
+// harmless.
+static bool is_in_redefined_hierarchy(InstanceKlass* ik) {
+  for (InstanceKlass* k = ik; k != NULL; k = k->java_super()) {
+    if (k->is_being_redefined()) {
+      return true;
+    }
+  }
+  Array<InstanceKlass*>* interfaces = ik->transitive_interfaces();
+  for (int i = 0; i < interfaces->length(); i++) {
+    if (interfaces->at(i)->is_being_redefined()) {
+      return true;
+    }
+  }
+  return false;
+}
+
 void VM_RedefineClasses::AdjustAndCleanMetadata::do_klass(Klass* k) {
 
   // This is a very busy routine. We don't want too much tracing
@@ -3470,13 +3492,15 @@ void VM_RedefineClasses::AdjustAndCleanMetadata::do_klass(Klass* k) {
 
     // Adjust all vtables, default methods and itables, to clean out old methods.
     ResourceMark rm(_thread);
-    if (ik->vtable_length() > 0) {
-      ik->vtable().adjust_method_entries(&trace_name_printed);
-      ik->adjust_default_methods(&trace_name_printed);
-    }
+    if (is_in_redefined_hierarchy(ik)) {
+      if (ik->vtable_length() > 0) {
+        ik->vtable().adjust_method_entries(&trace_name_printed);
+        ik->adjust_default_methods(&trace_name_printed);
+      }
 
-    if (ik->itable_length() > 0) {
-      ik->itable().adjust_method_entries(&trace_name_printed);
+      if (ik->itable_length() > 0) {
+        ik->itable().adjust_method_entries(&trace_name_printed);
+      }
     }
 
     // The constant pools in other classes (other_cp) can refer to
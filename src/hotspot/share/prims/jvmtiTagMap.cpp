@@ -150,6 +150,7 @@ class JvmtiTagHashmap : public CHeapObj<mtInternal> {
   float _load_factor;                   // load factor as a % of the size
   int _resize_threshold;                // computed threshold to trigger resizing.
   bool _resizing_enabled;               // indicates if hashmap can resize
+  bool _rehash_needed;                  // indicates if objects have moved
 
   int _trace_threshold;                 // threshold for trace messages
 
@@ -169,6 +170,7 @@ class JvmtiTagHashmap : public CHeapObj<mtInternal> {
     _load_factor = load_factor;
     _resize_threshold = (int)(_load_factor * _size);
     _resizing_enabled = true;
+    _rehash_needed = false;
     size_t s = initial_size * sizeof(JvmtiTagHashmapEntry*);
     _table = (JvmtiTagHashmapEntry**)os::malloc(s, mtInternal);
     if (_table == NULL) {
@@ -245,6 +247,68 @@ class JvmtiTagHashmap : public CHeapObj<mtInternal> {
 
     // compute new resize threshold
     _resize_threshold = (int)(_load_factor * _size);
+
+    // all entries have been hashed with their current address
+    _rehash_needed = false;
+  }
+
+  // re-hash the entries of objects that have moved since they were added
+  // and move them to their new location.
+  void rehash() {
+    int moved = 0;
+    JvmtiTagHashmapEntry* delayed_add = NULL;
+
+    for (int pos = 0; pos < _size; ++pos) {
+      JvmtiTagHashmapEntry* entry = _table[pos];
+      JvmtiTagHashmapEntry* prev = NULL;
+
+      while (entry != NULL) {
+        JvmtiTagHashmapEntry* next = entry->next();
+        unsigned int new_pos = hash(entry->object_peek());
+        if (new_pos != (unsigned int)pos) {
+          if (prev == NULL) {
+            _table[pos] = next;
+          } else {
+            prev->set_next(next);
+          }
+          if (new_pos < (unsigned int)pos) {
+            entry->set_next(_table[new_pos]);
+            _table[new_pos] = entry;
+          } else {
+            // Delay adding this entry to it's new position as we'd end up
+            // hitting it again during this iteration.
+            entry->set_next(delayed_add);
+            delayed_add = entry;
+          }
+          moved++;
+        } else {
+          prev = entry;
+        }
+        entry = next;
+      }
+    }
+
+    // Re-add all the entries which were kept aside
+    while (delayed_add != NULL) {
+      JvmtiTagHashmapEntry* next = delayed_add->next();
+      unsigned int pos = hash(delayed_add->object_peek());
+      delayed_add->set_next(_table[pos]);
+      _table[pos] = delayed_add;
+      delayed_add = next;
+    }
+
+    _rehash_needed = false;
+
+    log_debug(jvmti, objecttagging)("(%d entries, %d rehashed)", _entry_count, moved);
+  }
+
+  // Entries are hashed by object address. The GC only records that objects
+  // have moved (see JvmtiTagMap::do_weak_oops) and the entries are rehashed
+  // by the next lookup, outside of the GC pause.
+  void rehash_if_needed() {
+    if (_rehash_needed) {
+      rehash();
+    }
   }
 
 
@@ -312,6 +376,7 @@ class JvmtiTagHashmap : public CHeapObj<mtInternal> {
 
   // find an entry in the hashmap, returns NULL if not found.
   inline JvmtiTagHashmapEntry* find(oop key) {
+    rehash_if_needed();
     unsigned int h = hash(key);
     JvmtiTagHashmapEntry* entry = _table[h];
     while (entry != NULL) {
@@ -327,6 +392,7 @@ class JvmtiTagHashmap : public CHeapObj<mtInternal> {
   // add a new entry to hashmap
   inline void add(oop key, JvmtiTagHashmapEntry* entry) {
     assert(key != NULL, "checking");
+    rehash_if_needed();
     assert(find(key) == NULL, "duplicate detected");
     unsigned int h = hash(key);
     JvmtiTagHashmapEntry* anchor = _table[h];
@@ -352,6 +418,7 @@ class JvmtiTagHashmap : public CHeapObj<mtInternal> {
 
   // remove an entry with the given key.
   inline JvmtiTagHashmapEntry* remove(oop key) {
+    rehash_if_needed();
     unsigned int h = hash(key);
     JvmtiTagHashmapEntry* entry = _table[h];
     JvmtiTagHashmapEntry* prev = NULL;
@@ -388,6 +455,8 @@ class JvmtiTagHashmapEntryClosure {
 
 // iterate over all entries in the hashmap
 void JvmtiTagHashmap::entry_iterate(JvmtiTagHashmapEntryClosure* closure) {
+  // do_entry may remove entries, which needs them at their current location
+  rehash_if_needed();
   for (int i=0; i<_size; i++) {
     JvmtiTagHashmapEntry* entry = _table[i];
     JvmtiTagHashmapEntry* prev = NULL;
@@ -3337,8 +3406,6 @@ void JvmtiTagMap::do_weak_oops(BoolObjectClosure* is_alive, OopClosure* f) {
   JvmtiTagHashmapEntry** table = hashmap->table();
   int size = hashmap->size();
 
-  JvmtiTagHashmapEntry* delayed_add = NULL;
-
   for (int pos = 0; pos < size; ++pos) {
     JvmtiTagHashmapEntry* entry = table[pos];
     JvmtiTagHashmapEntry* prev = NULL;
@@ -3364,45 +3431,24 @@ void JvmtiTagMap::do_weak_oops(BoolObjectClosure* is_alive, OopClosure* f) {
 
         ++freed;
       } else {
+        oop old_oop = entry->object_peek();
         f->do_oop(entry->object_addr());
-        oop new_oop = entry->object_peek();
 
-        // if the object has moved then re-hash it and move its
-        // entry to its new location.
-        unsigned int new_pos = JvmtiTagHashmap::hash(new_oop, size);
-        if (new_pos != (unsigned int)pos) {
-          if (prev == NULL) {
-            table[pos] = next;
-          } else {
-            prev->set_next(next);
-          }
-          if (new_pos < (unsigned int)pos) {
-            entry->set_next(table[new_pos]);
-            table[new_pos] = entry;
-          } else {
-            // Delay adding this entry to it's new position as we'd end up
-            // hitting it again during this iteration.
-            entry->set_next(delayed_add);
-            delayed_add = entry;
-          }
+        // if the object has moved then its entry is no longer at the
+        // location for its address; leave the rehashing to the next
+        // lookup instead of doing it in the GC pause.
+        if (entry->object_peek() != old_oop) {
           moved++;
-        } else {
-          // object didn't move
-          prev = entry;
         }
+        prev = entry;
       }
 
       entry = next;
     }
   }
 
-  // Re-add all the entries which were kept aside
-  while (delayed_add != NULL) {
-    JvmtiTagHashmapEntry* next = delayed_add->next();
-    unsigned int pos = JvmtiTagHashmap::hash(delayed_add->object_peek(), size);
-    delayed_add->set_next(table[pos]);
-    table[pos] = delayed_add;
-    delayed_add = next;
+  if (moved > 0) {
+    hashmap->_rehash_needed = true;
   }
 
   log_debug(jvmti, objecttagging)("(%d->%d, %d freed, %d total moves)",
@@ -51,6 +51,7 @@
 #include "runtime/reflection.hpp"
 #include "runtime/safepointVerifiers.hpp"
 #include "runtime/signature.hpp"
+#include "runtime/startupTimeline.hpp"
 #include "runtime/stubRoutines.hpp"
 #include "utilities/exceptions.hpp"
 
@@ -82,6 +83,7 @@ void MethodHandles::generate_adapters() {
 
   ResourceMark rm;
   TraceTime timer("MethodHandles adapters generation", TRACETIME_LOG(Info, startuptime));
+  StartupTimelineMark stm("MethodHandles adapters generation");
   _adapter_code = MethodHandlesAdapterBlob::create(adapter_code_size);
   CodeBuffer code(_adapter_code);
   MethodHandlesAdapterGenerator g(&code);
@@ -1497,22 +1499,22 @@ JVM_END
 // deallocate their dependency information.
 JVM_ENTRY(void, MHN_clearCallSiteContext(JNIEnv* env, jobject igcls, jobject context_jh)) {
   Handle context(THREAD, JNIHandles::resolve_non_null(context_jh));
+  uint64_t deopt_ticket = 0;
   {
     // Walk all nmethods depending on this call site.
     MutexLocker mu1(Compile_lock, thread);
 
-    int marked = 0;
-    {
-      NoSafepointVerifier nsv;
-      MutexLocker mu2(CodeCache_lock, Mutex::_no_safepoint_check_flag);
-      DependencyContext deps = java_lang_invoke_MethodHandleNatives_CallSiteContext::vmdependencies(context());
-      marked = deps.remove_all_dependents();
-    }
-    if (marked > 0) {
+    NoSafepointVerifier nsv;
+    MutexLocker mu2(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+    DependencyContext deps = java_lang_invoke_MethodHandleNatives_CallSiteContext::vmdependencies(context());
+    if (deps.remove_all_dependents() > 0) {
       // At least one nmethod has been marked for deoptimization
-      Deoptimization::deoptimize_all_marked();
+      deopt_ticket = Deoptimization::register_marked_nmethods();
     }
   }
+  if (deopt_ticket != 0) {
+    Deoptimization::deoptimize_marked_nmethods(deopt_ticket);
+  }
 }
 JVM_END
 
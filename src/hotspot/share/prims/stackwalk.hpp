@@ -56,7 +56,7 @@ public:
   virtual int     bci()=0;
 
   virtual void    fill_frame(int index, objArrayHandle  frames_array,
-                             const methodHandle& method, TRAPS)=0;
+                             Method* method, TRAPS)=0;
 
   void setup_magic_on_entry(objArrayHandle frames_array);
   bool check_magic(objArrayHandle frames_array);
@@ -87,7 +87,7 @@ public:
   int bci()        { return _vfst.bci(); }
 
   void fill_frame(int index, objArrayHandle  frames_array,
-                  const methodHandle& method, TRAPS);
+                  Method* method, TRAPS);
 };
 
 class LiveFrameStream : public BaseFrameStream {
@@ -117,7 +117,7 @@ public:
   int bci()        { return _jvf->bci(); }
 
   void fill_frame(int index, objArrayHandle  frames_array,
-                  const methodHandle& method, TRAPS);
+                  Method* method, TRAPS);
 };
 
 class StackWalk : public AllStatic {
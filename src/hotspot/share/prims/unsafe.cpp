@@ -52,6 +52,9 @@
 #include "utilities/copy.hpp"
 #include "utilities/dtrace.hpp"
 #include "utilities/macros.hpp"
+#if INCLUDE_JFR
+#include "jfr/support/jfrNativeAllocationSampler.hpp"
+#endif
 
 /**
  * Implementation of the jdk.internal.misc.Unsafe class
@@ -362,6 +365,7 @@ UNSAFE_ENTRY(jlong, Unsafe_AllocateMemory0(JNIEnv *env, jobject unsafe, jlong si
 
   sz = align_up(sz, HeapWordSize);
   void* x = os::malloc(sz, mtOther);
+  JFR_ONLY(JfrNativeAllocationSampler::sample(thread, x, sz);)
 
   return addr_to_java(x);
 } UNSAFE_END
@@ -372,6 +376,7 @@ UNSAFE_ENTRY(jlong, Unsafe_ReallocateMemory0(JNIEnv *env, jobject unsafe, jlong
   sz = align_up(sz, HeapWordSize);
 
   void* x = os::realloc(p, sz, mtOther);
+  JFR_ONLY(JfrNativeAllocationSampler::sample(thread, x, sz);)
 
   return addr_to_java(x);
 } UNSAFE_END
@@ -387,8 +392,14 @@ UNSAFE_ENTRY(void, Unsafe_SetMemory0(JNIEnv *env, jobject unsafe, jobject obj, j
 
   oop base = JNIHandles::resolve(obj);
   void* p = index_oop_from_field_offset_long(base, offset);
-
-  Copy::fill_to_memory_atomic(p, sz, value);
+  {
+    GuardUnsafeAccess guard(thread);
+    if (StubRoutines::unsafe_setmemory() != NULL) {
+      StubRoutines::UnsafeSetMemory_stub()(p, sz, value);
+    } else {
+      Copy::fill_to_memory_atomic(p, sz, value);
+    }
+  }
 } UNSAFE_END
 
 UNSAFE_ENTRY(void, Unsafe_CopyMemory0(JNIEnv *env, jobject unsafe, jobject srcObj, jlong srcOffset, jobject dstObj, jlong dstOffset, jlong size)) {
@@ -354,6 +354,13 @@ static HeuristicsResult update_heuristics(oop o) {
   }
 
   if (revocation_count == BiasedLockingBulkRebiasThreshold) {
+    // A type that keeps needing bulk rebias operations is handed off
+    // between threads all the time; stop biasing it rather than paying
+    // for another safepoint every BiasedLockingDecayTime.
+    if (BiasedLockingBulkRebiasLimit > 0 &&
+        k->biased_lock_bulk_rebias_count() >= BiasedLockingBulkRebiasLimit) {
+      return HR_BULK_REVOKE;
+    }
     return HR_BULK_REBIAS;
   }
 
@@ -393,6 +400,7 @@ void BiasedLocking::bulk_revoke_at_safepoint(oop o, bool bulk_rebias, JavaThread
       // and reset the header to the unbiased state, which will
       // implicitly cause all existing biases to be revoked
       if (klass->prototype_header().has_bias_pattern()) {
+        klass->incr_biased_lock_bulk_rebias_count();
         int prev_epoch = klass->prototype_header().bias_epoch();
         klass->set_prototype_header(klass->prototype_header().incr_bias_epoch());
         int cur_epoch = klass->prototype_header().bias_epoch();
@@ -37,6 +37,8 @@
 #include "interpreter/bytecode.hpp"
 #include "interpreter/interpreter.hpp"
 #include "interpreter/oopMapCache.hpp"
+#include "jfr/jfrEvents.hpp"
+#include "logging/log.hpp"
 #include "memory/allocation.inline.hpp"
 #include "memory/oopFactory.hpp"
 #include "memory/resourceArea.hpp"
@@ -830,6 +832,31 @@ void Deoptimization::deoptimize_all_marked() {
   }
 }
 
+volatile uint64_t Deoptimization::_deoptimize_requested = 0;
+volatile uint64_t Deoptimization::_deoptimize_completed = 0;
+
+uint64_t Deoptimization::register_marked_nmethods() {
+  // Serialized by the CodeCache_lock, under which the nmethods were marked.
+  assert_lock_strong(CodeCache_lock);
+  uint64_t ticket = _deoptimize_requested + 1;
+  Atomic::store(&_deoptimize_requested, ticket);
+  return ticket;
+}
+
+void Deoptimization::deoptimize_marked_nmethods(uint64_t ticket) {
+  assert(!Compile_lock->owned_by_self(), "batches must not be serialized by Compile_lock");
+  MutexLocker ml(DeoptimizeBatch_lock);
+  if (Atomic::load(&_deoptimize_completed) >= ticket) {
+    // A batch that started after our nmethods were marked has deoptimized them.
+    return;
+  }
+  // Every request registered up to now has marked its nmethods already,
+  // so this batch handles all of them.
+  uint64_t batch = Atomic::load(&_deoptimize_requested);
+  deoptimize_all_marked();
+  Atomic::release_store(&_deoptimize_completed, batch);
+}
+
 Deoptimization::DeoptAction Deoptimization::_unloaded_action
   = Deoptimization::Action_reinterpret;
 
@@ -1652,6 +1679,37 @@ void Deoptimization::load_class_by_index(const constantPoolHandle& constant_pool
   }
 }
 
+// A method is in a deoptimization storm when traps in it caused
+// DeoptStormRecompileLimit recompilations within DeoptStormWindow, which the
+// per-bytecode and per-method cutoffs only stop after hundreds of cycles.
+// Only the type speculation traps count. The reason of the trap that
+// completes the storm is then recorded as having trapped too often in the
+// method, so the compilers stop making the failing speculation there. The
+// recorded count stays in the MethodData.
+static void record_deoptimization_storm(MethodData* trap_mdo, const methodHandle& method, int trap_bci,
+                                        Deoptimization::DeoptReason reason) {
+  const uint recompiles = trap_mdo->record_deopt_storm_recompile();
+  if (recompiles == 0) {
+    return;
+  }
+  trap_mdo->saturate_trap_count(reason);
+
+  if (log_is_enabled(Info, jit, deoptimization)) {
+    ResourceMark rm;
+    log_info(jit, deoptimization)("Deoptimization storm in %s @ %d: %u recompilations, disabling %s",
+                                  method->name_and_sig_as_C_string(), trap_bci, recompiles,
+                                  Deoptimization::trap_reason_name(reason));
+  }
+  EventDeoptimizationStorm event;
+  if (event.should_commit()) {
+    event.set_method(method());
+    event.set_bci(trap_bci);
+    event.set_reason(Deoptimization::trap_reason_name(reason));
+    event.set_recompiles(recompiles);
+    event.commit();
+  }
+}
+
 JRT_ENTRY(void, Deoptimization::uncommon_trap_inner(JavaThread* thread, jint trap_request)) {
   HandleMark hm;
 
@@ -2047,6 +2105,11 @@ JRT_ENTRY(void, Deoptimization::uncommon_trap_inner(JavaThread* thread, jint tra
           pdata->set_trap_state(tstate1);
       }
 
+      if (DeoptStormRecompileLimit > 0 && update_trap_state && trap_mdo != NULL &&
+          reason_is_speculate(reason)) {
+        record_deoptimization_storm(trap_mdo, profiled_method, trap_bci, reason);
+      }
+
 #if INCLUDE_RTM_OPT
       // Restart collecting RTM locking abort statistic if the method
       // is recompiled for a reason other than RTM state change.
@@ -2330,6 +2393,7 @@ const char* Deoptimization::_trap_reason_name[] = {
   "rtm_state_change",
   "unstable_if",
   "unstable_fused_if",
+  "profiled_receiver_check",
 #if INCLUDE_JVMCI
   "aliasing",
   "transfer_to_interpreter",
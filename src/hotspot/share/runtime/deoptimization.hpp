@@ -87,6 +87,7 @@ class Deoptimization : AllStatic {
     Reason_rtm_state_change,      // rtm state change detected
     Reason_unstable_if,           // a branch predicted always false was taken
     Reason_unstable_fused_if,     // fused two ifs that had each one untaken branch. One is now taken.
+    Reason_profiled_receiver_check, // saw unexpected receiver class at a call bound by C1 to the profiled receiver
 #if INCLUDE_JVMCI
     Reason_aliasing,              // optimistic assumption about aliasing failed
     Reason_transfer_to_interpreter, // explicit transferToInterpreter()
@@ -139,7 +140,20 @@ class Deoptimization : AllStatic {
 
   static void deoptimize_all_marked();
 
+  // Batched deoptimization. A caller marks nmethods for deoptimization under
+  // the CodeCache_lock and takes a ticket with register_marked_nmethods().
+  // Later, without holding the Compile_lock, it passes the ticket to
+  // deoptimize_marked_nmethods(). That call returns at once when a concurrent
+  // batch has already handled those marks. Otherwise it deoptimizes
+  // everything marked so far in one handshake, covering the requests of all
+  // the other threads that have registered marks by then.
+  static uint64_t register_marked_nmethods();
+  static void deoptimize_marked_nmethods(uint64_t ticket);
+
  private:
+  static volatile uint64_t _deoptimize_requested;
+  static volatile uint64_t _deoptimize_completed;
+
   // Checks all compiled methods. Invalid methods are deleted and
   // corresponding activations are deoptimized.
   static int deoptimize_dependents();
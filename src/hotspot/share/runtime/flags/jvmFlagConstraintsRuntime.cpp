@@ -140,3 +140,14 @@ JVMFlag::Error ThreadLocalHandshakesConstraintFunc(bool value, bool verbose) {
   }
   return JVMFlag::SUCCESS;
 }
+
+JVMFlag::Error OopMapCacheMaxSizeConstraintFunc(uintx value, bool verbose) {
+  if (!is_power_of_2(value)) {
+    JVMFlag::printError(verbose,
+                        "OopMapCacheMaxSize (" UINTX_FORMAT ") must be "
+                        "power of 2\n",
+                        value);
+    return JVMFlag::VIOLATES_CONSTRAINT;
+  }
+  return JVMFlag::SUCCESS;
+}
@@ -46,5 +46,7 @@ JVMFlag::Error PerfDataSamplingIntervalFunc(intx value, bool verbose);
 
 JVMFlag::Error ThreadLocalHandshakesConstraintFunc(bool value, bool verbose);
 
+JVMFlag::Error OopMapCacheMaxSizeConstraintFunc(uintx value, bool verbose);
+
 
 #endif // SHARE_RUNTIME_FLAGS_JVMFLAGCONSTRAINTSRUNTIME_HPP
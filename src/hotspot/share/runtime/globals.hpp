@@ -370,6 +370,10 @@ const size_t minimumSymbolTableSize = 1024;
   diagnostic(bool, UseVectorizedMismatchIntrinsic, false,                   \
           "Enables intrinsification of ArraysSupport.vectorizedMismatch()") \
                                                                             \
+  diagnostic(bool, UseVectorizedHashCodeIntrinsic, false,                   \
+          "Enables intrinsification of Arrays.hashCode() for byte, char "   \
+          "and int arrays and of the String hashCode() helpers")            \
+                                                                            \
   diagnostic(ccstrlist, DisableIntrinsic, "",                               \
          "do not expand intrinsics whose (internal) names appear here")     \
                                                                             \
@@ -542,6 +546,12 @@ const size_t minimumSymbolTableSize = 1024;
           "directory) of the dump file (defaults to java_pid<pid>.hprof "   \
           "in the working directory)")                                      \
                                                                             \
+  manageable(intx, HeapDumpGzipLevel, 0,                                    \
+          "When HeapDumpOnOutOfMemoryError, HeapDumpBeforeFullGC or "       \
+          "HeapDumpAfterFullGC is on, the gzip compression level of the "   \
+          "dump file. 0 (the default) disables compression")                \
+          range(0, 9)                                                       \
+                                                                            \
   develop(bool, BreakAtWarning, false,                                      \
           "Execute breakpoint upon encountering VM warning")                \
                                                                             \
@@ -674,6 +684,10 @@ const size_t minimumSymbolTableSize = 1024;
   product(bool, ClassUnloadingWithConcurrentMark, true,                     \
           "Do unloading of classes with a concurrent marking cycle")        \
                                                                             \
+  experimental(bool, ConcurrentClassLoaderDataPurge, false,                 \
+          "Let the ServiceThread delete unloaded class loader data and "    \
+          "purge metaspace after a Serial or Parallel GC pause")            \
+                                                                            \
   develop(bool, DisableStartThread, false,                                  \
           "Disable starting of additional Java threads "                    \
           "(for debugging only)")                                           \
@@ -758,6 +772,10 @@ const size_t minimumSymbolTableSize = 1024;
   product(bool, CheckJNICalls, false,                                       \
           "Verify all arguments to JNI calls")                              \
                                                                             \
+  experimental(bool, UseJNIGlobalHandleCache, false,                        \
+          "Allocate JNI global handles from a small per-thread cache that " \
+          "is refilled in bulk from the global handle storage")             \
+                                                                            \
   product(bool, UseFastJNIAccessors, true,                                  \
           "Use optimized versions of Get<Primitive>Field")                  \
                                                                             \
@@ -792,6 +810,12 @@ const size_t minimumSymbolTableSize = 1024;
           "(Deprecated) Allocate nonstatic fields in gaps "                 \
           "between previous fields")                                        \
                                                                             \
+  diagnostic(bool, CompactFieldsInSuperGaps, false,                         \
+          "Allocate nonstatic fields in the alignment gaps left in the "    \
+          "field layout of the superclasses, and static fields in the "     \
+          "alignment gap before static long/double fields. "                \
+          "Only used with CompactFields")                                   \
+                                                                            \
   notproduct(bool, PrintFieldLayout, false,                                 \
           "Print field layout for each class")                              \
                                                                             \
@@ -839,6 +863,12 @@ const size_t minimumSymbolTableSize = 1024;
           range(500, max_intx)                                              \
           constraint(BiasedLockingDecayTimeFunc,AfterErgo)                  \
                                                                             \
+  experimental(intx, BiasedLockingBulkRebiasLimit, 8,                       \
+          "Number of bulk rebias operations on a type after which biased "  \
+          "locking is disabled for that type instead of rebiasing again. "  \
+          "0 means no limit")                                               \
+          range(0, max_intx)                                                \
+                                                                            \
   product(bool, ExitOnOutOfMemoryError, false,                              \
           "JVM exits on the first occurrence of an out-of-memory error")    \
                                                                             \
@@ -907,6 +937,17 @@ const size_t minimumSymbolTableSize = 1024;
   develop(bool, TraceCompiledIC, false,                                     \
           "Trace changes of compiled IC")                                   \
                                                                             \
+  experimental(uintx, OopMapCacheMaxSize, 512,                              \
+          "Maximum number of entries of the per-class cache of "            \
+          "interpreter oop maps used by stack scanning")                    \
+          range(32, 64*K)                                                   \
+          constraint(OopMapCacheMaxSizeConstraintFunc,AtParse)              \
+                                                                            \
+  experimental(uintx, InlineCacheBufferMaxSize, 160*K,                      \
+          "Maximum size in bytes the inline cache buffer grows to when "    \
+          "it runs out of transition stubs")                                \
+          range(10*K, 8*M)                                                  \
+                                                                            \
   develop(bool, FLSVerifyDictionary, false,                                 \
           "Do lots of (expensive) FLS dictionary verification")             \
                                                                             \
@@ -1011,6 +1052,17 @@ const size_t minimumSymbolTableSize = 1024;
   diagnostic(bool, TraceCompilerThreads, false,                             \
              "Trace creation and removal of compiler threads")              \
                                                                             \
+  product(uintx, CompilerCPUBudget, 0,                                      \
+          "Percentage of the CPUs available to the process the compiler "  \
+          "threads may use; compilations are delayed once it is used up "  \
+          "(0 means no limit)")                                             \
+          range(0, 100)                                                     \
+                                                                            \
+  product(uintx, CompilerCPUBudgetWindow, 1000,                             \
+          "Length of the window (in ms) CompilerCPUBudget is measured "    \
+          "over")                                                           \
+          range(1, max_jint)                                                \
+                                                                            \
   develop(bool, InjectCompilerCreationFailure, false,                       \
           "Inject thread creation failures for "                            \
           "UseDynamicNumberOfCompilerThreads")                              \
@@ -1097,6 +1149,11 @@ const size_t minimumSymbolTableSize = 1024;
   product(bool, UseCodeAging, true,                                         \
           "Insert counter to detect warm methods")                          \
                                                                             \
+  experimental(bool, UseNMethodEntryBarrierAging, false,                    \
+          "Use the nmethod entry barriers armed by ZGC to find the "        \
+          "nmethods in use, instead of scanning the thread stacks at "      \
+          "every safepoint")                                                \
+                                                                            \
   diagnostic(bool, StressCodeAging, false,                                  \
           "Start with counters compiled in")                                \
                                                                             \
@@ -1142,6 +1199,14 @@ const size_t minimumSymbolTableSize = 1024;
           "If LogVMOutput or LogCompilation is on, save VM output to "      \
           "this file [default: ./hotspot_pid%p.log] (%p replaced with pid)")\
                                                                             \
+  experimental(bool, AsyncLogFileOutput, false,                             \
+          "Write unified logging file outputs from a background thread, "  \
+          "dropping lines when its buffer is full")                         \
+                                                                            \
+  experimental(size_t, AsyncLogBufferSize, 2*M,                             \
+          "Size of the buffer used with AsyncLogFileOutput")                \
+          range(4*K, 512*M)                                                 \
+                                                                            \
   product(ccstr, ErrorFile, NULL,                                           \
           "If an error occurs, save the error data to this file "           \
           "[default: ./hs_err_pid%p.log] (%p replaced with pid)")           \
@@ -1569,6 +1634,17 @@ const size_t minimumSymbolTableSize = 1024;
           "Limit on traps (of one kind) at a particular BCI")               \
           range(0, max_jint)                                                \
                                                                             \
+  product(intx, DeoptStormRecompileLimit, 0,                                \
+          "Number of recompilations caused by type speculation traps "      \
+          "in a method within DeoptStormWindow that disables the "          \
+          "speculation of the last trap in the method (0 means no limit)")  \
+          range(0, max_jint)                                                \
+                                                                            \
+  product(intx, DeoptStormWindow, 60000,                                    \
+          "Length of the window (in ms) in which recompilations count "    \
+          "towards DeoptStormRecompileLimit")                               \
+          range(1, max_jint)                                                \
+                                                                            \
   experimental(intx, SpecTrapLimitExtraEntries,  3,                         \
           "Extra method data trap entries for speculation")                 \
                                                                             \
@@ -1598,6 +1674,11 @@ const size_t minimumSymbolTableSize = 1024;
           "is done to reduce Metaspace usage")                              \
           constraint(MetaspaceSizeConstraintFunc,AfterErgo)                 \
                                                                             \
+  experimental(bool, MetaspaceReleaseFreeChunkMemory, false,                \
+          "Give the memory of medium and humongous Metaspace chunks back "  \
+          "to the operating system when they are freed by class "          \
+          "unloading, without uncommitting it")                             \
+                                                                            \
   product(size_t, MaxMetaspaceSize, max_uintx,                              \
           "Maximum size of Metaspaces (in bytes)")                          \
           constraint(MaxMetaspaceSizeConstraintFunc,AfterErgo)              \
@@ -1766,6 +1847,11 @@ const size_t minimumSymbolTableSize = 1024;
   experimental(ccstrlist, AOTLibrary, NULL,                                 \
           "AOT library")                                                    \
                                                                             \
+  experimental(bool, AOTLazyLoading, false,                                 \
+          "Publish the AOT code of a class when the interpreter first "     \
+          "reports one of its methods to the compilation policy, instead "  \
+          "of when the class is linked")                                    \
+                                                                            \
   experimental(bool, PrintAOT, false,                                       \
           "Print used AOT klasses and methods")                             \
                                                                             \
@@ -1848,6 +1934,13 @@ const size_t minimumSymbolTableSize = 1024;
   product(bool, DumpReplayDataOnError, true,                                \
           "Record replay data for crashing compiler threads")               \
                                                                             \
+  experimental(ccstr, ProfileSnapshotDumpFile, NULL,                        \
+          "Write the profiles of hot methods to this file at VM exit")      \
+                                                                            \
+  experimental(ccstr, ProfileSnapshotReplayFile, NULL,                      \
+          "Seed method profiles from this file, written by an earlier run " \
+          "with ProfileSnapshotDumpFile or Compiler.profile_snapshot")      \
+                                                                            \
   product(bool, CICompilerCountPerCPU, false,                               \
           "1 compiler thread for log(N CPUs)")                              \
                                                                             \
@@ -2156,6 +2249,13 @@ const size_t minimumSymbolTableSize = 1024;
           "given timeout in milliseconds")                                  \
           range(0, max_intx)                                                \
                                                                             \
+  experimental(intx, TieredCompileTaskRescanInterval, 5,                    \
+          "Select compile tasks among the hottest tasks found by the last " \
+          "full scan of a long compile queue and the tasks added since, "   \
+          "rescanning the whole queue at most every given number of "       \
+          "milliseconds. 0 scans the whole queue for every selection")      \
+          range(0, max_intx)                                                \
+                                                                            \
   product(intx, TieredStopAtLevel, 4,                                       \
           "Stop at given compilation level")                                \
           range(0, 4)                                                       \
@@ -2247,6 +2347,11 @@ const size_t minimumSymbolTableSize = 1024;
           range(PeriodicTask::min_interval, max_jint)                       \
           constraint(PerfDataSamplingIntervalFunc, AfterErgo)               \
                                                                             \
+  experimental(bool, PerfDataStripedCounters, false,                        \
+          "Keep the values of PerfData counters that are updated by many "  \
+          "threads at once in per-processor stripes, summed up by the "     \
+          "StatSampler")                                                    \
+                                                                            \
   product(bool, PerfDisableSharedMem, false,                                \
           "Store performance data in standard memory")                      \
                                                                             \
@@ -2281,6 +2386,13 @@ const size_t minimumSymbolTableSize = 1024;
   product(bool, StartAttachListener, false,                                 \
           "Always start Attach Listener at VM startup")                     \
                                                                             \
+  product(bool, AttachListenerStreamOutput, false,                          \
+          "Send the output of each command of a jcmd request to the "       \
+          "client once the command completes, where the platform "          \
+          "supports it. The result code is then sent ahead of the first "   \
+          "output, so a failure of a later command is only reported in "    \
+          "the output")                                                     \
+                                                                            \
   product(bool, EnableDynamicAgentLoading, true,                            \
           "Allow tools to load agents with the attach mechanism")           \
                                                                             \
@@ -2337,6 +2449,10 @@ const size_t minimumSymbolTableSize = 1024;
   diagnostic(bool, VerifyMethodHandles, trueInDebug,                        \
           "perform extra checks when constructing method handles")          \
                                                                             \
+  diagnostic(bool, ShareMethodHandleInvokers, true,                         \
+          "share the invokers linked for MethodHandle.invoke and "          \
+          "invokeExact call sites across class loaders")                    \
+                                                                            \
   diagnostic(bool, ShowHiddenFrames, false,                                 \
           "show method handle implementation frames (usually hidden)")      \
                                                                             \
@@ -2438,6 +2554,10 @@ const size_t minimumSymbolTableSize = 1024;
            "do not map the archive")                                        \
            range(0, 2)                                                      \
                                                                             \
+  diagnostic(bool, ParallelArchiveRelocation, true,                         \
+          "Use the GC worker threads to relocate the pointers of a CDS "    \
+          "archive that is mapped at an alternative address")               \
+                                                                            \
   experimental(size_t, ArrayAllocatorMallocLimit,                           \
           SOLARIS_ONLY(64*K) NOT_SOLARIS((size_t)-1),                       \
           "Allocation less than this value will be allocated "              \
@@ -2513,6 +2633,20 @@ const size_t minimumSymbolTableSize = 1024;
   JFR_ONLY(product(ccstr, StartFlightRecording, NULL,                       \
           "Start flight recording with options"))                           \
                                                                             \
+  JFR_ONLY(experimental(bool, JfrSampleRunningThreadsOnly, false,           \
+          "Only take execution samples of threads that used CPU time "      \
+          "since they were last considered by the sampler"))                \
+                                                                            \
+  JFR_ONLY(experimental(size_t, JfrNativeAllocationSampleInterval, 512*K,   \
+          "Average number of bytes allocated through Unsafe by a thread "   \
+          "between two NativeAllocationSample events")                      \
+          range(0, max_uintx))                                              \
+                                                                            \
+  JFR_ONLY(experimental(size_t, JfrObjectAllocationSampleInterval, 1*M,     \
+          "Average number of heap bytes allocated by a thread between two " \
+          "ObjectAllocationSample events")                                  \
+          range(0, max_uintx))                                              \
+                                                                            \
   experimental(bool, UseFastUnorderedTimeStamps, false,                     \
           "Use platform unstable time where supported for timestamps only")
 
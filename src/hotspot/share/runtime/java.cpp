@@ -33,6 +33,7 @@
 #include "code/codeCache.hpp"
 #include "compiler/compileBroker.hpp"
 #include "compiler/compilerOracle.hpp"
+#include "compiler/profileSnapshot.hpp"
 #include "interpreter/bytecodeHistogram.hpp"
 #include "jfr/jfrEvents.hpp"
 #include "jfr/support/jfrThreadId.hpp"
@@ -40,6 +41,7 @@
 #include "jvmci/jvmci.hpp"
 #endif
 #include "logging/log.hpp"
+#include "logging/logAsyncWriter.hpp"
 #include "logging/logStream.hpp"
 #include "memory/oopFactory.hpp"
 #include "memory/resourceArea.hpp"
@@ -496,8 +498,13 @@ void before_exit(JavaThread* thread) {
   }
 #endif
 
+  if (ProfileSnapshotDumpFile != NULL) {
+    ProfileSnapshot::dump(ProfileSnapshotDumpFile, tty);
+  }
+
   print_statistics();
   Universe::heap()->print_tracing_info();
+  LogAsyncWriter::flush();
 
   { MutexLocker ml(BeforeExit_lock);
     _before_exit_status = BEFORE_EXIT_DONE;
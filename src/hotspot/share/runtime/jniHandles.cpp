@@ -104,6 +104,28 @@ static void report_handle_allocation_failure(AllocFailType alloc_failmode,
   }
 }
 
+oop* JNIHandles::allocate_global_entry(Thread* thread) {
+  if (!UseJNIGlobalHandleCache) {
+    return global_handles()->allocate();
+  }
+  JNIGlobalHandleCache* cache = thread->global_handle_cache();
+  if (cache->_count == 0) {
+    cache->_count = global_handles()->allocate(cache->_entries, JNIGlobalHandleCache::capacity);
+    if (cache->_count == 0) {
+      return NULL;
+    }
+  }
+  return cache->_entries[--cache->_count];
+}
+
+void JNIHandles::release_global_handle_cache(Thread* thread) {
+  JNIGlobalHandleCache* cache = thread->global_handle_cache();
+  if (cache->_count > 0) {
+    global_handles()->release(cache->_entries, cache->_count);
+    cache->_count = 0;
+  }
+}
+
 jobject JNIHandles::make_global(Handle obj, AllocFailType alloc_failmode) {
   assert(!Universe::heap()->is_gc_active(), "can't extend the root set during GC");
   assert(!current_thread_in_native(), "must not be in native");
@@ -111,7 +133,7 @@ jobject JNIHandles::make_global(Handle obj, AllocFailType alloc_failmode) {
   if (!obj.is_null()) {
     // ignore null handles
     assert(oopDesc::is_oop(obj()), "not an oop");
-    oop* ptr = global_handles()->allocate();
+    oop* ptr = allocate_global_entry(Thread::current());
     // Return NULL on allocation failure.
     if (ptr != NULL) {
       assert(*ptr == NULL, "invariant");
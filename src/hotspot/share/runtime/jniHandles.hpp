@@ -55,6 +55,10 @@ class JNIHandles : AllStatic {
   // this header file and thread.hpp.
   static bool current_thread_in_native();
 
+  // Allocate an entry for a global handle, from the thread's cache
+  // with UseJNIGlobalHandleCache.
+  static oop* allocate_global_entry(Thread* thread);
+
  public:
   // Low tag bit in jobject used to distinguish a jweak.  jweak is
   // type equivalent to jobject, but there are places where we need to
@@ -124,6 +128,26 @@ class JNIHandles : AllStatic {
   static void weak_oops_do(BoolObjectClosure* is_alive, OopClosure* f);
   // Traversal of weak global handles.
   static void weak_oops_do(OopClosure* f);
+
+  // Return the entries cached by the thread to the global handle storage.
+  static void release_global_handle_cache(Thread* thread);
+};
+
+// Per-thread cache of entries of the global handle storage.  The cache is
+// refilled with a bulk OopStorage allocation, so that threads creating many
+// global handles take the storage's allocation lock once per refill rather
+// than once per handle.  Cached entries are allocated in the storage, but
+// hold NULL until they are handed out.
+class JNIGlobalHandleCache {
+  friend class JNIHandles;
+
+  static const size_t capacity = 16;
+
+  oop*   _entries[capacity];
+  size_t _count;
+
+ public:
+  JNIGlobalHandleCache() : _count(0) {}
 };
 
 
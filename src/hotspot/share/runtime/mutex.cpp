@@ -28,6 +28,7 @@
 #include "runtime/mutex.hpp"
 #include "runtime/osThread.hpp"
 #include "runtime/safepointMechanism.inline.hpp"
+#include "runtime/startupTimeline.hpp"
 #include "runtime/thread.inline.hpp"
 #include "utilities/events.hpp"
 #include "utilities/macros.hpp"
@@ -71,6 +72,7 @@ void Mutex::check_no_safepoint_state(Thread* thread) {
 #endif // ASSERT
 
 void Mutex::lock_contended(Thread* self) {
+  StartupTimelineBlockedMark stbm(self);
   Mutex *in_flight_mutex = NULL;
   DEBUG_ONLY(int retry_cnt = 0;)
   bool is_active_Java_thread = self->is_active_Java_thread();
@@ -180,12 +180,12 @@ class ObjectMonitor {
       }                                          \
     } while (0)
 
-  static PerfCounter * _sync_ContendedLockAttempts;
-  static PerfCounter * _sync_FutileWakeups;
-  static PerfCounter * _sync_Parks;
-  static PerfCounter * _sync_Notifications;
-  static PerfCounter * _sync_Inflations;
-  static PerfCounter * _sync_Deflations;
+  static PerfStripedCounter * _sync_ContendedLockAttempts;
+  static PerfStripedCounter * _sync_FutileWakeups;
+  static PerfStripedCounter * _sync_Parks;
+  static PerfStripedCounter * _sync_Notifications;
+  static PerfStripedCounter * _sync_Inflations;
+  static PerfStripedCounter * _sync_Deflations;
   static PerfLongVariable * _sync_MonExtant;
 
   static int Knob_SpinLimit;
@@ -1753,6 +1753,9 @@ bool os::release_memory(char* addr, size_t bytes) {
 }
 
 void os::pretouch_memory(void* start, void* end, size_t page_size) {
+  if (pd_pretouch_memory(start, end, page_size)) {
+    return;
+  }
   for (volatile char *p = (char*)start; p < (char*)end; p += page_size) {
     *p = 0;
   }
@@ -143,6 +143,9 @@ class os: AllStatic {
   static bool   pd_unmap_memory(char *addr, size_t bytes);
   static void   pd_free_memory(char *addr, size_t bytes, size_t alignment_hint);
   static void   pd_realign_memory(char *addr, size_t bytes, size_t alignment_hint);
+  // Back the range with memory in one step if the OS supports it; returns
+  // false if the caller has to touch the pages itself.
+  static bool   pd_pretouch_memory(void* start, void* end, size_t page_size);
 
   static size_t page_size_for_region(size_t region_size, size_t min_pages, bool must_be_aligned);
 
@@ -799,6 +802,11 @@ class os: AllStatic {
   // System loadavg support.  Returns -1 if load average cannot be obtained.
   static int loadavg(double loadavg[], int nelem);
 
+  // Page faults of the process so far. Returns false if they cannot be
+  // obtained. Platforms that do not tell minor and major faults apart
+  // report all of them as minor faults.
+  static bool page_faults(jlong* minor, jlong* major);
+
   // Amount beyond the callee frame size that we bang the stack.
   static int extra_bang_size_in_bytes();
 
@@ -27,6 +27,7 @@
 #include "classfile/vmSymbols.hpp"
 #include "logging/log.hpp"
 #include "memory/allocation.inline.hpp"
+#include "memory/padded.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/java.hpp"
@@ -216,6 +217,18 @@ void PerfLongVariant::sample() {
   }
 }
 
+void PerfStripedCounter::inc_striped(jlong val) {
+  _stripes[os::processor_id() & _mask]._value += val;
+}
+
+jlong PerfStripedCounter::take_sample() {
+  jlong sum = 0;
+  for (uint i = 0; i <= _mask; i++) {
+    sum += _stripes[i]._value;
+  }
+  return sum;
+}
+
 PerfByteArray::PerfByteArray(CounterNS ns, const char* namep, Units u,
                              Variability v, jint length)
                             : PerfData(ns, namep, u, v), _length(length) {
@@ -566,6 +579,30 @@ PerfLongCounter* PerfDataManager::create_long_counter(CounterNS ns,
   return p;
 }
 
+PerfStripedCounter* PerfDataManager::create_striped_counter(CounterNS ns,
+                                                            const char* name,
+                                                            PerfData::Units u,
+                                                            TRAPS) {
+
+  if (!UsePerfData) return NULL;
+
+  PerfStripedCounter* sc = new PerfStripedCounter();
+
+  if (PerfDataStripedCounters) {
+    uint stripes = 1;
+    while (stripes < (uint)os::processor_count() && stripes < 64) {
+      stripes <<= 1;
+    }
+    sc->_stripes = PaddedArray<PerfStripedCounter::Stripe, mtInternal>::create_unfreeable(stripes);
+    sc->_mask = stripes - 1;
+    sc->_counter = create_long_counter(ns, name, u, (PerfSampleHelper*)sc, CHECK_NULL);
+  } else {
+    sc->_counter = create_long_counter(ns, name, u, (jlong)0, CHECK_NULL);
+  }
+
+  return sc;
+}
+
 PerfDataList::PerfDataList(int length) {
 
   _set = new(ResourceObj::C_HEAP, mtInternal) PerfDataArray(length, true);
@@ -26,6 +26,7 @@
 #define SHARE_RUNTIME_PERFDATA_HPP
 
 #include "memory/allocation.hpp"
+#include "memory/padded.hpp"
 #include "runtime/perfMemory.hpp"
 #include "runtime/timer.hpp"
 
@@ -462,6 +463,38 @@ class PerfLongCounter : public PerfLongVariant {
 
 typedef PerfLongCounter PerfCounter;
 
+/*
+ * The PerfStripedCounter class keeps the value of a PerfCounter that is
+ * updated by many threads at once in per-processor stripes, each on its own
+ * cache line, so that the updates do not all hit the same cache line. The
+ * StatSampler periodic task writes the sum of the stripes into the PerfData
+ * memory region, so the counter has the same layout as any other PerfCounter
+ * and jstat sees it unchanged, only up to PerfDataSamplingInterval old.
+ * Without PerfDataStripedCounters the updates go to the PerfCounter.
+ */
+class PerfStripedCounter : public PerfLongSampleHelper {
+
+  friend class PerfDataManager; // for access to private constructor
+
+  private:
+    struct Stripe {
+      jlong _value;
+      Stripe() : _value(0) { }
+    };
+
+    PerfCounter* _counter;
+    PaddedEnd<Stripe>* _stripes;
+    uint _mask;
+
+    PerfStripedCounter() : _counter(NULL), _stripes(NULL), _mask(0) { }
+
+    void inc_striped(jlong val);
+
+  public:
+    inline void inc(jlong val = 1);
+    jlong take_sample();
+};
+
 /*
  * The PerfLongVariable class, and its alias PerfVariable, implement
  * a PerfData subtype that holds a jlong data value that can
@@ -872,6 +905,11 @@ class PerfDataManager : AllStatic {
       return create_long_counter(ns, name, u, sh, THREAD);
     }
 
+    static PerfStripedCounter* create_striped_counter(CounterNS ns,
+                                                      const char* name,
+                                                      PerfData::Units u,
+                                                      TRAPS);
+
     static void destroy();
     static bool has_PerfData() { return _has_PerfData; }
 };
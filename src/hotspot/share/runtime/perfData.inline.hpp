@@ -57,6 +57,14 @@ inline int PerfDataManager::constants_count() {
   return _constants->length();
 }
 
+inline void PerfStripedCounter::inc(jlong val) {
+  if (_stripes == NULL) {
+    _counter->inc(val);
+  } else {
+    inc_striped(val);
+  }
+}
+
 inline bool PerfDataManager::exists(const char* name) {
   if (_all != NULL) {
     return _all->contains(name);
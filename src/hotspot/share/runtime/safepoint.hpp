@@ -265,6 +265,7 @@ private:
   static VM_Operation::VMOp_Type _current_type;
   static jlong     _max_sync_time;
   static jlong     _max_vmop_time;
+  static jlong     _max_cleanup_time;
   static uint64_t  _op_count[VM_Operation::VMOp_Terminating];
 
   static void statistics_log();
@@ -23,6 +23,7 @@
  */
 
 #include "precompiled.hpp"
+#include "classfile/classLoaderDataGraph.hpp"
 #include "classfile/protectionDomainCache.hpp"
 #include "classfile/stringTable.hpp"
 #include "classfile/symbolTable.hpp"
@@ -105,6 +106,7 @@ void ServiceThread::service_thread_entry(JavaThread* jt, TRAPS) {
     bool thread_id_table_work = false;
     bool protection_domain_table_work = false;
     bool oopstorage_work = false;
+    bool cldg_purge_work = false;
     JvmtiDeferredEvent jvmti_event;
     {
       // Need state transition ThreadBlockInVM so that this thread
@@ -131,7 +133,8 @@ void ServiceThread::service_thread_entry(JavaThread* jt, TRAPS) {
               (resolved_method_table_work = ResolvedMethodTable::has_work()) |
               (thread_id_table_work = ThreadIdTable::has_work()) |
               (protection_domain_table_work = SystemDictionary::pd_cache_table()->has_work()) |
-              (oopstorage_work = OopStorage::has_cleanup_work_and_reset())
+              (oopstorage_work = OopStorage::has_cleanup_work_and_reset()) |
+              (cldg_purge_work = ClassLoaderDataGraph::has_purge_work())
              ) == 0) {
         // Wait until notified that there is some work to do.
         ml.wait();
@@ -183,6 +186,10 @@ void ServiceThread::service_thread_entry(JavaThread* jt, TRAPS) {
     if (oopstorage_work) {
       cleanup_oopstorages();
     }
+
+    if (cldg_purge_work) {
+      ClassLoaderDataGraph::do_deferred_purge();
+    }
   }
 }
 
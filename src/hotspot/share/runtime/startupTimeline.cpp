@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "classfile/classLoaderDataGraph.inline.hpp"
+#include "jfr/jfrEvents.hpp"
+#include "logging/log.hpp"
+#include "logging/logStream.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/os.hpp"
+#include "runtime/startupTimeline.hpp"
+#include "runtime/thread.hpp"
+#include "utilities/ostream.hpp"
+
+StartupTimeline::Phase StartupTimeline::_phases[StartupTimeline::MaxPhases];
+int                    StartupTimeline::_num_phases = 0;
+uint                   StartupTimeline::_depth = 0;
+uint                   StartupTimeline::_num_dropped = 0;
+bool                   StartupTimeline::_recording = false;
+volatile bool          StartupTimeline::_finished = false;
+Thread*                StartupTimeline::_thread = NULL;
+jlong                  StartupTimeline::_blocked = 0;
+
+void StartupTimeline::Sample::take() {
+  _time = FastTicks::now();
+  // On several platforms the thread CPU time is read through Thread::current(),
+  // so it is left out until the VM creating thread has been attached.
+  _cpu_time = (os::is_thread_cpu_time_supported() && Thread::current_or_null() != NULL) ?
+              os::current_thread_cpu_time() : -1;
+  _classes = ClassLoaderDataGraph::num_instance_classes();
+  if (!os::page_faults(&_minor_faults, &_major_faults)) {
+    _minor_faults = -1;
+    _major_faults = -1;
+  }
+  _blocked = StartupTimeline::_blocked;
+}
+
+double StartupTimeline::Phase::wall_time_ms() const {
+  return (_end._time - _begin._time).seconds() * MILLIUNITS;
+}
+
+jlong StartupTimeline::Phase::cpu_time_ns() const {
+  if (_begin._cpu_time < 0 || _end._cpu_time < 0) {
+    return 0;
+  }
+  return _end._cpu_time - _begin._cpu_time;
+}
+
+double StartupTimeline::Phase::cpu_time_ms() const {
+  return (double)cpu_time_ns() / NANOSECS_PER_MILLISEC;
+}
+
+size_t StartupTimeline::Phase::classes_loaded() const {
+  return _end._classes - _begin._classes;
+}
+
+jlong StartupTimeline::Phase::minor_faults() const {
+  if (_begin._minor_faults < 0 || _end._minor_faults < 0) {
+    return 0;
+  }
+  return _end._minor_faults - _begin._minor_faults;
+}
+
+jlong StartupTimeline::Phase::major_faults() const {
+  if (_begin._major_faults < 0 || _end._major_faults < 0) {
+    return 0;
+  }
+  return _end._major_faults - _begin._major_faults;
+}
+
+jlong StartupTimeline::Phase::blocked_time_ns() const {
+  return (jlong)((double)(_end._blocked - _begin._blocked) * NANOSECS_PER_SEC / os::elapsed_frequency());
+}
+
+int StartupTimeline::begin_phase(const char* name) {
+  if (!_recording) {
+    return -1;
+  }
+  if (_thread == NULL) {
+    // The VM creating thread is attached only after the timeline has started.
+    _thread = Thread::current_or_null();
+  }
+  uint depth = _depth++;
+  if (_num_phases == MaxPhases) {
+    _num_dropped++;
+    return -1;
+  }
+  Phase* phase = &_phases[_num_phases];
+  phase->_name = name;
+  phase->_depth = depth;
+  phase->_begin.take();
+  return _num_phases++;
+}
+
+void StartupTimeline::end_phase(int index) {
+  if (!_recording) {
+    return;
+  }
+  assert(_depth > 0, "unbalanced startup phases");
+  _depth--;
+  if (index >= 0) {
+    assert(_phases[index]._depth == _depth, "unbalanced startup phases");
+    _phases[index]._end.take();
+  }
+}
+
+void StartupTimeline::initialize() {
+  assert(!_recording, "already started");
+  _num_phases = 0;
+  _num_dropped = 0;
+  _depth = 0;
+  _recording = true;
+  begin_phase("Create VM");
+}
+
+void StartupTimeline::finish() {
+  assert(_recording && _depth == 1, "unbalanced startup phases");
+  end_phase(0);
+  _recording = false;
+  Atomic::release_store(&_finished, true);
+
+  LogTarget(Info, startuptime, phases) lt;
+  if (lt.is_enabled()) {
+    LogStream ls(lt);
+    print_on(&ls);
+  }
+}
+
+void StartupTimeline::abort() {
+  if (!_recording) {
+    return;
+  }
+  _recording = false;
+  _depth = 0;
+  _thread = NULL;
+}
+
+void StartupTimeline::print_on(outputStream* st) {
+  st->print_cr("Startup timeline (wall time, cpu time, classes loaded, minor/major page faults, blocked time):");
+  for (int i = 0; i < _num_phases; i++) {
+    const Phase& phase = _phases[i];
+    const int indent = (int)phase._depth * 2;
+    st->print_cr("%*s%-*s %10.3fms cpu %10.3fms classes " SIZE_FORMAT_W(6)
+                 " faults " JLONG_FORMAT "/" JLONG_FORMAT " blocked %.3fms",
+                 indent, "", MAX2(40 - indent, 0), phase._name,
+                 phase.wall_time_ms(), phase.cpu_time_ms(), phase.classes_loaded(),
+                 phase.minor_faults(), phase.major_faults(),
+                 (double)phase.blocked_time_ns() / NANOSECS_PER_MILLISEC);
+  }
+  if (_num_dropped > 0) {
+    st->print_cr("%u more phases were not recorded", _num_dropped);
+  }
+}
+
+void StartupTimeline::send_events() {
+#if INCLUDE_JFR
+  if (!Atomic::load_acquire(&_finished)) {
+    return;
+  }
+  for (int i = 0; i < _num_phases; i++) {
+    const Phase& phase = _phases[i];
+    EventStartupPhase event(UNTIMED);
+    event.set_starttime(phase._begin._time);
+    event.set_endtime(phase._end._time);
+    event.set_name(phase._name);
+    event.set_depth(phase._depth);
+    event.set_cpuTime(phase.cpu_time_ns());
+    event.set_loadedClassCount(phase.classes_loaded());
+    event.set_minorPageFaults(phase.minor_faults());
+    event.set_majorPageFaults(phase.major_faults());
+    event.set_blockedTime(phase.blocked_time_ns());
+    event.commit();
+  }
+#endif
+}
+
+StartupTimelineBlockedMark::StartupTimelineBlockedMark(Thread* thread) :
+  _start(StartupTimeline::is_recording(thread) ? os::elapsed_counter() : 0) {
+}
+
+StartupTimelineBlockedMark::~StartupTimelineBlockedMark() {
+  if (_start != 0) {
+    StartupTimeline::_blocked += os::elapsed_counter() - _start;
+  }
+}
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_RUNTIME_STARTUPTIMELINE_HPP
+#define SHARE_RUNTIME_STARTUPTIMELINE_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "utilities/ticks.hpp"
+
+class outputStream;
+class Thread;
+
+// The startup timeline records the nested phases of Threads::create_vm, as
+// run by the thread that creates the VM. For every phase it records the wall
+// clock and the CPU time of that thread, the number of classes loaded, the
+// page faults of the process and the time the thread was blocked on
+// contended VM locks. The CPU time is only sampled once the thread has been
+// attached, so phases that begin earlier report no CPU time.
+//
+// The timeline is printed with -Xlog:startuptime+phases once the VM has been
+// created. It is also sent as StartupPhase events with every JFR chunk, so
+// that a recording sees it no matter when it was started.
+class StartupTimeline : AllStatic {
+  friend class StartupTimelineMark;
+  friend class StartupTimelineBlockedMark;
+
+ public:
+  static const int MaxPhases = 64;
+
+ private:
+  class Sample {
+   public:
+    FastTicks _time;
+    jlong     _cpu_time;      // nanoseconds, -1 if not supported or not attached
+    size_t    _classes;
+    jlong     _minor_faults;  // -1 if not supported
+    jlong     _major_faults;
+    jlong     _blocked;       // os::elapsed_counter() ticks
+
+    void take();
+  };
+
+  class Phase {
+   public:
+    const char* _name;
+    uint        _depth;
+    Sample      _begin;
+    Sample      _end;
+
+    double wall_time_ms() const;
+    double cpu_time_ms() const;
+    jlong  cpu_time_ns() const;
+    size_t classes_loaded() const;
+    jlong  minor_faults() const;
+    jlong  major_faults() const;
+    jlong  blocked_time_ns() const;
+  };
+
+  static Phase         _phases[MaxPhases];
+  static int           _num_phases;
+  static uint          _depth;
+  static uint          _num_dropped;
+  static bool          _recording;
+  static volatile bool _finished;
+  static Thread*       _thread;
+  static jlong         _blocked;
+
+  static int begin_phase(const char* name);
+  static void end_phase(int index);
+
+  static bool is_recording(Thread* thread) {
+    return _recording && thread == _thread;
+  }
+
+ public:
+  // Start the timeline with the root phase, which spans the VM creation.
+  static void initialize();
+  // End the root phase and print the timeline.
+  static void finish();
+  // Stop the timeline without publishing it, if VM creation failed.
+  static void abort();
+
+  static void print_on(outputStream* st);
+
+  // Send the phases as JFR events, once the VM has been created.
+  static void send_events();
+};
+
+// Records a phase of the startup timeline while it is in scope.
+class StartupTimelineMark : public StackObj {
+  int _index;
+ public:
+  StartupTimelineMark(const char* name) : _index(StartupTimeline::begin_phase(name)) {}
+  ~StartupTimelineMark() { StartupTimeline::end_phase(_index); }
+};
+
+// Aborts the startup timeline on scope exit unless it has been finished, so
+// that an early error return from VM creation does not leave it recording.
+class StartupTimelineAbortMark : public StackObj {
+ public:
+  ~StartupTimelineAbortMark() { StartupTimeline::abort(); }
+};
+
+// Accounts the time the VM creating thread waits for a contended lock to the
+// startup timeline. Does nothing for other threads and after VM creation.
+class StartupTimelineBlockedMark : public StackObj {
+  jlong _start;
+ public:
+  StartupTimelineBlockedMark(Thread* thread);
+  ~StartupTimelineBlockedMark();
+};
+
+#endif // SHARE_RUNTIME_STARTUPTIMELINE_HPP
@@ -31,6 +31,7 @@
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/timerTrace.hpp"
 #include "runtime/sharedRuntime.hpp"
+#include "runtime/startupTimeline.hpp"
 #include "runtime/stubRoutines.hpp"
 #include "utilities/align.hpp"
 #include "utilities/copy.hpp"
@@ -119,6 +120,8 @@ address StubRoutines::_data_cache_writeback_sync         = NULL;
 address StubRoutines::_checkcast_arraycopy               = NULL;
 address StubRoutines::_checkcast_arraycopy_uninit        = NULL;
 address StubRoutines::_unsafe_arraycopy                  = NULL;
+address StubRoutines::_unsafe_setmemory                  = NULL;
+address StubRoutines::_unsafe_copyswap                   = NULL;
 address StubRoutines::_generic_arraycopy                 = NULL;
 
 address StubRoutines::_jbyte_fill;
@@ -160,6 +163,11 @@ address StubRoutines::_montgomerySquare = NULL;
 
 address StubRoutines::_vectorizedMismatch = NULL;
 
+address StubRoutines::_jbyte_hashcode = NULL;
+address StubRoutines::_jubyte_hashcode = NULL;
+address StubRoutines::_jchar_hashcode = NULL;
+address StubRoutines::_jint_hashcode = NULL;
+
 address StubRoutines::_dexp = NULL;
 address StubRoutines::_dlog = NULL;
 address StubRoutines::_dlog10 = NULL;
@@ -215,6 +223,7 @@ void StubRoutines::initialize1() {
   if (_code1 == NULL) {
     ResourceMark rm;
     TraceTime timer("StubRoutines generation 1", TRACETIME_LOG(Info, startuptime));
+    StartupTimelineMark stm("StubRoutines generation 1");
     _code1 = BufferBlob::create("StubRoutines (1)", code_size1);
     if (_code1 == NULL) {
       vm_exit_out_of_memory(code_size1, OOM_MALLOC_ERROR, "CodeCache: no room for StubRoutines (1)");
@@ -302,6 +311,7 @@ void StubRoutines::initialize2() {
   if (_code2 == NULL) {
     ResourceMark rm;
     TraceTime timer("StubRoutines generation 2", TRACETIME_LOG(Info, startuptime));
+    StartupTimelineMark stm("StubRoutines generation 2");
     _code2 = BufferBlob::create("StubRoutines (2)", code_size2);
     if (_code2 == NULL) {
       vm_exit_out_of_memory(code_size2, OOM_MALLOC_ERROR, "CodeCache: no room for StubRoutines (2)");
@@ -530,6 +540,28 @@ address StubRoutines::select_fill_function(BasicType t, bool aligned, const char
 #undef RETURN_STUB
 }
 
+address StubRoutines::select_hashcode_function(BasicType t, const char* &name) {
+#define RETURN_STUB(xxx_hashcode) { \
+  name = #xxx_hashcode; \
+  return StubRoutines::xxx_hashcode(); }
+
+  switch (t) {
+  case T_BYTE:
+    RETURN_STUB(jbyte_hashcode);
+  case T_BOOLEAN:
+    RETURN_STUB(jubyte_hashcode);
+  case T_CHAR:
+    RETURN_STUB(jchar_hashcode);
+  case T_INT:
+    RETURN_STUB(jint_hashcode);
+  default:
+    // Currently unsupported
+    return NULL;
+  }
+
+#undef RETURN_STUB
+}
+
 // constants for computing the copy function
 enum {
   COPYFUNC_UNALIGNED = 0,
@@ -198,6 +198,8 @@ class StubRoutines: AllStatic {
   // these are recommended but optional:
   static address _checkcast_arraycopy, _checkcast_arraycopy_uninit;
   static address _unsafe_arraycopy;
+  static address _unsafe_setmemory;
+  static address _unsafe_copyswap;
   static address _generic_arraycopy;
 
   static address _jbyte_fill;
@@ -242,6 +244,12 @@ class StubRoutines: AllStatic {
 
   static address _vectorizedMismatch;
 
+  // Polynomial (31 * h + x) hash of an array range
+  static address _jbyte_hashcode;
+  static address _jubyte_hashcode;
+  static address _jchar_hashcode;
+  static address _jint_hashcode;
+
   static address _dexp;
   static address _dlog;
   static address _dlog10;
@@ -377,6 +385,15 @@ class StubRoutines: AllStatic {
   typedef void (*UnsafeArrayCopyStub)(const void* src, void* dst, size_t count);
   static UnsafeArrayCopyStub UnsafeArrayCopy_stub()         { return CAST_TO_FN_PTR(UnsafeArrayCopyStub,  _unsafe_arraycopy); }
 
+  static address unsafe_setmemory()     { return _unsafe_setmemory; }
+  static address unsafe_copyswap()      { return _unsafe_copyswap; }
+
+  typedef void (*UnsafeSetMemoryStub)(void* dst, size_t count, jbyte value);
+  static UnsafeSetMemoryStub UnsafeSetMemory_stub()         { return CAST_TO_FN_PTR(UnsafeSetMemoryStub,  _unsafe_setmemory); }
+
+  typedef void (*UnsafeCopySwapStub)(const void* src, void* dst, size_t count, size_t elem_size);
+  static UnsafeCopySwapStub UnsafeCopySwap_stub()           { return CAST_TO_FN_PTR(UnsafeCopySwapStub,  _unsafe_copyswap); }
+
   static address generic_arraycopy()   { return _generic_arraycopy; }
 
   static address jbyte_fill()          { return _jbyte_fill; }
@@ -417,6 +434,14 @@ class StubRoutines: AllStatic {
 
   static address vectorizedMismatch()  { return _vectorizedMismatch; }
 
+  static address jbyte_hashcode()      { return _jbyte_hashcode; }
+  static address jubyte_hashcode()     { return _jubyte_hashcode; }
+  static address jchar_hashcode()      { return _jchar_hashcode; }
+  static address jint_hashcode()       { return _jint_hashcode; }
+
+  // T_BOOLEAN selects the stub that reads the elements as unsigned bytes.
+  static address select_hashcode_function(BasicType t, const char* &name);
+
   static address dexp()                { return _dexp; }
   static address dlog()                { return _dlog; }
   static address dlog10()              { return _dlog10; }
@@ -28,6 +28,7 @@
 #include "code/icBuffer.hpp"
 #include "code/nmethod.hpp"
 #include "compiler/compileBroker.hpp"
+#include "gc/shared/barrierSet.hpp"
 #include "gc/shared/collectedHeap.hpp"
 #include "gc/shared/workgroup.hpp"
 #include "jfr/jfrEvents.hpp"
@@ -193,6 +194,20 @@ int NMethodSweeper::hotness_counter_reset_val() {
   }
   return _hotness_counter_reset_val;
 }
+
+// Only ZGC arms the entry barriers of all nmethods at every cycle. Other
+// GCs with entry barriers do not, so their hits can not replace the stack
+// scans.
+bool NMethodSweeper::ages_with_entry_barriers() {
+  return UseNMethodEntryBarrierAging && UseZGC && BarrierSet::barrier_set()->barrier_set_nmethod() != NULL;
+}
+
+// Called on the first entry of an nmethod after the GC armed its barrier.
+void NMethodSweeper::record_entry_barrier_hit(nmethod* nm) {
+  if (ages_with_entry_barriers()) {
+    nm->set_hotness_counter(hotness_counter_reset_val());
+  }
+}
 bool NMethodSweeper::wait_for_stack_scanning() {
   return _current.end();
 }
@@ -307,6 +322,10 @@ CodeBlobClosure* NMethodSweeper::prepare_reset_hotness_counters() {
     }
   }
 
+  if (ages_with_entry_barriers()) {
+    // Used nmethods are found by their entry barrier instead
+    return NULL;
+  }
   return &set_hotness_closure;
 }
 
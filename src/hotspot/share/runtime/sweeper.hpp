@@ -120,6 +120,11 @@ class NMethodSweeper : public AllStatic {
   static void force_sweep();
 
   static int hotness_counter_reset_val();
+  // True if the nmethod entry barriers armed by the GC at every cycle keep
+  // the hotness counters up to date, so that the stacks do not need to be
+  // scanned at every safepoint for that.
+  static bool ages_with_entry_barriers();
+  static void record_entry_barrier_hit(nmethod* nm);
   static void report_state_change(nmethod* nm);
   static void possibly_enable_sweeper();
   static void possibly_flush(nmethod* nm);
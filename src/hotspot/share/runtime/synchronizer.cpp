@@ -42,6 +42,7 @@
 #include "runtime/objectMonitor.hpp"
 #include "runtime/objectMonitor.inline.hpp"
 #include "runtime/osThread.hpp"
+#include "runtime/perfData.inline.hpp"
 #include "runtime/safepointVerifiers.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/stubRoutines.hpp"
@@ -124,12 +125,16 @@ ObjectMonitor* volatile ObjectSynchronizer::g_free_list = NULL;
 // Global ObjectMonitor in-use list. When a JavaThread is exiting,
 // ObjectMonitors on its per-thread in-use list are prepended here.
 ObjectMonitor* volatile ObjectSynchronizer::g_om_in_use_list = NULL;
-int ObjectSynchronizer::g_om_in_use_count = 0;  // # on g_om_in_use_list
+volatile int ObjectSynchronizer::g_om_in_use_count = 0;  // # on g_om_in_use_list
 
-static volatile intptr_t gListLock = 0;   // protects global monitor lists
+// Serializes removals from g_free_list, see take_from_g_free_list()
+static volatile int g_free_list_take_lock = 0;
 static volatile int g_om_free_count = 0;  // # on g_free_list
 static volatile int g_om_population = 0;  // # Extant -- in circulation
 
+static volatile size_t g_om_inflation_count = 0;  // # inflations since VM start
+static volatile size_t g_om_deflation_count = 0;  // # deflations since VM start
+
 #define CHAINMARKER (cast_to_oop<intptr_t>(-1))
 
 
@@ -964,8 +969,10 @@ void ObjectSynchronizer::list_oops_do(ObjectMonitor* list, OopClosure* f) {
 // STW-time -- disassociates idle monitors from objects.  Such
 // scavenged monitors are returned to the g_free_list.
 //
-// The global list is protected by gListLock.  All the critical sections
-// are short and operate in constant-time.
+// The global lists are lock-free. Monitors are prepended to them with a
+// CAS on the list head. Removals from g_free_list are serialized by
+// g_free_list_take_lock and the other removals only happen at a safepoint,
+// so the list heads cannot suffer from A-B-A.
 //
 // ObjectMonitors reside in type-stable memory (TSM) and are immortal.
 //
@@ -1010,6 +1017,49 @@ static void InduceScavenge(Thread* self, const char * Whence) {
   }
 }
 
+// Prepend the list of monitors from 'list' to 'tail' to g_free_list.
+void ObjectSynchronizer::prepend_to_g_free_list(ObjectMonitor* list, ObjectMonitor* tail, int count) {
+  for (;;) {
+    ObjectMonitor* cur = Atomic::load(&g_free_list);
+    tail->_next_om = cur;
+    if (Atomic::cmpxchg(&g_free_list, cur, list) == cur) {
+      break;
+    }
+  }
+  Atomic::add(&g_om_free_count, count);
+}
+
+// Prepend the list of monitors from 'list' to 'tail' to g_om_in_use_list.
+void ObjectSynchronizer::prepend_to_g_om_in_use_list(ObjectMonitor* list, ObjectMonitor* tail, int count) {
+  for (;;) {
+    ObjectMonitor* cur = Atomic::load(&g_om_in_use_list);
+    tail->_next_om = cur;
+    if (Atomic::cmpxchg(&g_om_in_use_list, cur, list) == cur) {
+      break;
+    }
+  }
+  Atomic::add(&g_om_in_use_count, count);
+}
+
+// Take the first monitor from g_free_list, or return NULL if the list is
+// empty. The caller must hold g_free_list_take_lock. Concurrent prepends
+// may replace the list head, but the monitor 'take' cannot be removed and
+// prepended again while we are looking at it, so 'next' is still its
+// successor if the CAS succeeds.
+ObjectMonitor* ObjectSynchronizer::take_from_g_free_list() {
+  for (;;) {
+    ObjectMonitor* take = Atomic::load_acquire(&g_free_list);
+    if (take == NULL) {
+      return NULL;
+    }
+    ObjectMonitor* next = take->_next_om;
+    if (Atomic::cmpxchg(&g_free_list, take, next) == take) {
+      Atomic::dec(&g_om_free_count);
+      return take;
+    }
+  }
+}
+
 ObjectMonitor* ObjectSynchronizer::om_alloc(Thread* self) {
   // A large MAXPRIVATE value reduces both list lock contention
   // and list coherency traffic, but also tends to increase the
@@ -1025,7 +1075,7 @@ ObjectMonitor* ObjectSynchronizer::om_alloc(Thread* self) {
     // Threads will attempt to allocate first from their local list, then
     // from the global list, and only after those attempts fail will the thread
     // attempt to instantiate new monitors.   Thread-local free lists take
-    // heat off the gListLock and improve allocation latency, as well as reducing
+    // heat off the global list and improve allocation latency, as well as reducing
     // coherency traffic on the shared global list.
     m = self->om_free_list;
     if (m != NULL) {
@@ -1039,24 +1089,23 @@ ObjectMonitor* ObjectSynchronizer::om_alloc(Thread* self) {
     }
 
     // 2: try to allocate from the global g_free_list
-    // CONSIDER: use muxTry() instead of muxAcquire().
-    // If the muxTry() fails then drop immediately into case 3.
     // If we're using thread-local free lists then try
     // to reprovision the caller's free list.
-    if (g_free_list != NULL) {
+    if (Atomic::load(&g_free_list) != NULL) {
       // Reprovision the thread's om_free_list.
       // Use bulk transfers to reduce the allocation rate and heat
-      // on various locks.
-      Thread::muxAcquire(&gListLock, "om_alloc(1)");
-      for (int i = self->om_free_provision; --i >= 0 && g_free_list != NULL;) {
-        g_om_free_count--;
-        ObjectMonitor* take = g_free_list;
-        g_free_list = take->_next_om;
+      // on the global list.
+      Thread::SpinAcquire(&g_free_list_take_lock, "om_alloc(1)");
+      for (int i = self->om_free_provision; --i >= 0;) {
+        ObjectMonitor* take = take_from_g_free_list();
+        if (take == NULL) {
+          break;
+        }
         guarantee(take->object() == NULL, "invariant");
         take->Recycle();
         om_release(self, take, false);
       }
-      Thread::muxRelease(&gListLock);
+      Thread::SpinRelease(&g_free_list_take_lock);
       self->om_free_provision += 1 + (self->om_free_provision/2);
       if (self->om_free_provision > MAXPRIVATE) self->om_free_provision = MAXPRIVATE;
 
@@ -1109,24 +1158,23 @@ ObjectMonitor* ObjectSynchronizer::om_alloc(Thread* self) {
     // block in hand.  This avoids some lock traffic and redundant
     // list activity.
 
-    // Acquire the gListLock to manipulate g_block_list and g_free_list.
-    // An Oyama-Taura-Yonezawa scheme might be more efficient.
-    Thread::muxAcquire(&gListLock, "om_alloc(2)");
-    g_om_population += _BLOCKSIZE-1;
-    g_om_free_count += _BLOCKSIZE-1;
+    Atomic::add(&g_om_population, _BLOCKSIZE - 1);
 
     // Add the new block to the list of extant blocks (g_block_list).
     // The very first ObjectMonitor in a block is reserved and dedicated.
     // It serves as blocklist "next" linkage.
-    temp[0]._next_om = g_block_list;
-    // There are lock-free uses of g_block_list so make sure that
-    // the previous stores happen before we update g_block_list.
-    Atomic::release_store(&g_block_list, temp);
+    // There are lock-free uses of g_block_list so the CAS also makes sure
+    // that the previous stores happen before we update g_block_list.
+    for (;;) {
+      PaddedObjectMonitor* cur = Atomic::load(&g_block_list);
+      temp[0]._next_om = cur;
+      if (Atomic::cmpxchg(&g_block_list, cur, temp) == cur) {
+        break;
+      }
+    }
 
     // Add the new string of ObjectMonitors to the global free list
-    temp[_BLOCKSIZE - 1]._next_om = g_free_list;
-    g_free_list = temp + 1;
-    Thread::muxRelease(&gListLock);
+    prepend_to_g_free_list(temp + 1, &temp[_BLOCKSIZE - 1], _BLOCKSIZE - 1);
   }
 }
 
@@ -1197,7 +1245,7 @@ void ObjectSynchronizer::om_flush(Thread* self) {
   if (free_list != NULL) {
     ObjectMonitor* s;
     // The thread is going away. Set 'free_tail' to the last per-thread free
-    // monitor which will be linked to g_free_list below under the gListLock.
+    // monitor which will be linked to g_free_list below.
     stringStream ss;
     for (s = free_list; s != NULL; s = s->_next_om) {
       free_count++;
@@ -1218,7 +1266,7 @@ void ObjectSynchronizer::om_flush(Thread* self) {
     // The thread is going away, however the ObjectMonitors on the
     // om_in_use_list may still be in-use by other threads. Link
     // them to in_use_tail, which will be linked into the global
-    // in-use list g_om_in_use_list below, under the gListLock.
+    // in-use list g_om_in_use_list below.
     ObjectMonitor *cur_om;
     for (cur_om = in_use_list; cur_om != NULL; cur_om = cur_om->_next_om) {
       in_use_tail = cur_om;
@@ -1230,21 +1278,14 @@ void ObjectSynchronizer::om_flush(Thread* self) {
     self->om_in_use_count = 0;
   }
 
-  Thread::muxAcquire(&gListLock, "om_flush");
   if (free_tail != NULL) {
-    free_tail->_next_om = g_free_list;
-    g_free_list = free_list;
-    g_om_free_count += free_count;
+    prepend_to_g_free_list(free_list, free_tail, free_count);
   }
 
   if (in_use_tail != NULL) {
-    in_use_tail->_next_om = g_om_in_use_list;
-    g_om_in_use_list = in_use_list;
-    g_om_in_use_count += in_use_count;
+    prepend_to_g_om_in_use_list(in_use_list, in_use_tail, in_use_count);
   }
 
-  Thread::muxRelease(&gListLock);
-
   LogStreamHandle(Debug, monitorinflation) lsh_debug;
   LogStreamHandle(Info, monitorinflation) lsh_info;
   LogStream* ls = NULL;
@@ -1416,6 +1457,7 @@ ObjectMonitor* ObjectSynchronizer::inflate(Thread* self,
       // Hopefully the performance counters are allocated on distinct cache lines
       // to avoid false sharing on MP systems ...
       OM_PERFDATA_OP(Inflations, inc());
+      Atomic::inc(&g_om_inflation_count);
       if (log_is_enabled(Trace, monitorinflation)) {
         ResourceMark rm(self);
         lsh.print_cr("inflate(has_locker): object=" INTPTR_FORMAT ", mark="
@@ -1463,6 +1505,7 @@ ObjectMonitor* ObjectSynchronizer::inflate(Thread* self,
     // Hopefully the performance counters are allocated on distinct
     // cache lines to avoid false sharing on MP systems ...
     OM_PERFDATA_OP(Inflations, inc());
+    Atomic::inc(&g_om_inflation_count);
     if (log_is_enabled(Trace, monitorinflation)) {
       ResourceMark rm(self);
       lsh.print_cr("inflate(neutral): object=" INTPTR_FORMAT ", mark="
@@ -1559,7 +1602,6 @@ bool ObjectSynchronizer::deflate_monitor(ObjectMonitor* mid, oop obj,
 
 // Walk a given monitor list, and deflate idle monitors
 // The given list could be a per-thread list or a global list
-// Caller acquires gListLock as needed.
 //
 // In the case of parallel processing of thread local monitor lists,
 // work is done by Threads::parallel_threads_do() which ensures that
@@ -1606,7 +1648,7 @@ void ObjectSynchronizer::prepare_deflate_idle_monitors(DeflateMonitorCounters* c
   counters->n_in_circulation = 0;      // extant
   counters->n_scavenged = 0;           // reclaimed (global and per-thread)
   counters->per_thread_scavenged = 0;  // per-thread scavenge total
-  counters->per_thread_times = 0.0;    // per-thread scavenge times
+  counters->per_thread_ticks = 0;      // per-thread scavenge times
 }
 
 void ObjectSynchronizer::deflate_idle_monitors(DeflateMonitorCounters* counters) {
@@ -1621,10 +1663,8 @@ void ObjectSynchronizer::deflate_idle_monitors(DeflateMonitorCounters* counters)
     timer.start();
   }
 
-  // Prevent om_flush from changing mids in Thread dtor's during deflation
-  // And in case the vm thread is acquiring a lock during a safepoint
-  // See e.g. 6320749
-  Thread::muxAcquire(&gListLock, "deflate_idle_monitors");
+  // om_flush() cannot run during a safepoint, so g_om_in_use_list is only
+  // changed by us here.
 
   // Note: the thread-local monitors lists get deflated in
   // a separate pass. See deflate_thread_local_monitors().
@@ -1634,20 +1674,19 @@ void ObjectSynchronizer::deflate_idle_monitors(DeflateMonitorCounters* counters)
   if (g_om_in_use_list) {
     counters->n_in_circulation += g_om_in_use_count;
     deflated_count = deflate_monitor_list((ObjectMonitor **)&g_om_in_use_list, &free_head_p, &free_tail_p);
-    g_om_in_use_count -= deflated_count;
-    counters->n_scavenged += deflated_count;
-    counters->n_in_use += g_om_in_use_count;
+    Atomic::sub(&g_om_in_use_count, deflated_count);
+    Atomic::add(&counters->n_scavenged, deflated_count);
+    Atomic::add(&counters->n_in_use, g_om_in_use_count);
   }
 
   if (free_head_p != NULL) {
     // Move the deflated ObjectMonitors back to the global free list.
-    guarantee(free_tail_p != NULL && counters->n_scavenged > 0, "invariant");
+    // The VM thread may concurrently take monitors from it, see 6320749.
+    guarantee(free_tail_p != NULL && deflated_count > 0, "invariant");
     assert(free_tail_p->_next_om == NULL, "invariant");
     // constant-time list splice - prepend scavenged segment to g_free_list
-    free_tail_p->_next_om = g_free_list;
-    g_free_list = free_head_p;
+    prepend_to_g_free_list(free_head_p, free_tail_p, deflated_count);
   }
-  Thread::muxRelease(&gListLock);
   timer.stop();
 
   LogStreamHandle(Debug, monitorinflation) lsh_debug;
@@ -1668,20 +1707,20 @@ void ObjectSynchronizer::finish_deflate_idle_monitors(DeflateMonitorCounters* co
   // monitors. Note: if the work is split among more than one
   // worker thread, then the reported time will likely be more
   // than a beginning to end measurement of the phase.
-  log_info(safepoint, cleanup)("deflating per-thread idle monitors, %3.7f secs, monitors=%d", counters->per_thread_times, counters->per_thread_scavenged);
+  log_info(safepoint, cleanup)("deflating per-thread idle monitors, %3.7f secs, monitors=%d",
+                               TimeHelper::counter_to_seconds(counters->per_thread_ticks),
+                               counters->per_thread_scavenged);
 
-  g_om_free_count += counters->n_scavenged;
+  g_om_deflation_count += counters->n_scavenged;
 
   if (log_is_enabled(Debug, monitorinflation)) {
     // exit_globals()'s call to audit_and_print_stats() is done
     // at the Info level.
     ObjectSynchronizer::audit_and_print_stats(false /* on_exit */);
   } else if (log_is_enabled(Info, monitorinflation)) {
-    Thread::muxAcquire(&gListLock, "finish_deflate_idle_monitors");
     log_info(monitorinflation)("g_om_population=%d, g_om_in_use_count=%d, "
                                "g_om_free_count=%d", g_om_population,
                                g_om_in_use_count, g_om_free_count);
-    Thread::muxRelease(&gListLock);
   }
 
   Atomic::store(&_forceMonitorScavenge, 0);    // Reset
@@ -1707,14 +1746,12 @@ void ObjectSynchronizer::deflate_thread_local_monitors(Thread* thread, DeflateMo
 
   int deflated_count = deflate_monitor_list(thread->om_in_use_list_addr(), &free_head_p, &free_tail_p);
 
-  Thread::muxAcquire(&gListLock, "deflate_thread_local_monitors");
-
-  // Adjust counters
-  counters->n_in_circulation += thread->om_in_use_count;
+  // Adjust counters, other worker threads may be deflating concurrently
+  Atomic::add(&counters->n_in_circulation, thread->om_in_use_count);
   thread->om_in_use_count -= deflated_count;
-  counters->n_scavenged += deflated_count;
-  counters->n_in_use += thread->om_in_use_count;
-  counters->per_thread_scavenged += deflated_count;
+  Atomic::add(&counters->n_scavenged, deflated_count);
+  Atomic::add(&counters->n_in_use, thread->om_in_use_count);
+  Atomic::add(&counters->per_thread_scavenged, deflated_count);
 
   if (free_head_p != NULL) {
     // Move the deflated ObjectMonitors back to the global free list.
@@ -1722,17 +1759,12 @@ void ObjectSynchronizer::deflate_thread_local_monitors(Thread* thread, DeflateMo
     assert(free_tail_p->_next_om == NULL, "invariant");
 
     // constant-time list splice - prepend scavenged segment to g_free_list
-    free_tail_p->_next_om = g_free_list;
-    g_free_list = free_head_p;
+    prepend_to_g_free_list(free_head_p, free_tail_p, deflated_count);
   }
 
   timer.stop();
-  // Safepoint logging cares about cumulative per_thread_times and
-  // we'll capture most of the cost, but not the muxRelease() which
-  // should be cheap.
-  counters->per_thread_times += timer.seconds();
-
-  Thread::muxRelease(&gListLock);
+  // Safepoint logging cares about cumulative per_thread_ticks.
+  Atomic::add(&counters->per_thread_ticks, timer.ticks());
 
   LogStreamHandle(Debug, monitorinflation) lsh_debug;
   LogStreamHandle(Info, monitorinflation) lsh_info;
@@ -1747,6 +1779,22 @@ void ObjectSynchronizer::deflate_thread_local_monitors(Thread* thread, DeflateMo
   }
 }
 
+int ObjectSynchronizer::population() {
+  return Atomic::load(&g_om_population);
+}
+
+int ObjectSynchronizer::free_count() {
+  return Atomic::load(&g_om_free_count);
+}
+
+size_t ObjectSynchronizer::inflation_count() {
+  return Atomic::load(&g_om_inflation_count);
+}
+
+size_t ObjectSynchronizer::deflation_count() {
+  return Atomic::load(&g_om_deflation_count);
+}
+
 // Monitor cleanup on JavaThread::exit
 
 // Iterate through monitor cache and attempt to release thread's monitors
@@ -1784,9 +1832,9 @@ void ObjectSynchronizer::release_monitors_owned_by_thread(TRAPS) {
   assert(THREAD == JavaThread::current(), "must be current Java thread");
   NoSafepointVerifier nsv;
   ReleaseJavaMonitorsClosure rjmc(THREAD);
-  Thread::muxAcquire(&gListLock, "release_monitors_owned_by_thread");
+  // g_block_list is walked lock-free and monitors are only deflated at
+  // a safepoint, which cannot happen here.
   ObjectSynchronizer::monitors_iterate(&rjmc);
-  Thread::muxRelease(&gListLock);
   THREAD->clear_pending_exception();
 }
 
@@ -1840,11 +1888,6 @@ void ObjectSynchronizer::audit_and_print_stats(bool on_exit) {
   }
   assert(ls != NULL, "sanity check");
 
-  if (!on_exit) {
-    // Not at VM exit so grab the global list lock.
-    Thread::muxAcquire(&gListLock, "audit_and_print_stats");
-  }
-
   // Log counts for the global and per-thread monitor lists:
   int chk_om_population = log_monitor_list_counts(ls);
   int error_cnt = 0;
@@ -1868,10 +1911,6 @@ void ObjectSynchronizer::audit_and_print_stats(bool on_exit) {
   // Check g_free_list and g_om_free_count:
   chk_global_free_list_and_count(ls, &error_cnt);
 
-  if (!on_exit) {
-    Thread::muxRelease(&gListLock);
-  }
-
   ls->print_cr("Checking per-thread lists:");
 
   for (JavaThreadIteratorWithHandle jtiwh; JavaThread *jt = jtiwh.next(); ) {
@@ -2086,11 +2125,6 @@ void ObjectSynchronizer::chk_per_thread_in_use_list_and_count(JavaThread *jt,
 // indicate the associated object and its type.
 void ObjectSynchronizer::log_in_use_monitor_details(outputStream * out,
                                                     bool on_exit) {
-  if (!on_exit) {
-    // Not at VM exit so grab the global list lock.
-    Thread::muxAcquire(&gListLock, "log_in_use_monitor_details");
-  }
-
   stringStream ss;
   if (g_om_in_use_count > 0) {
     out->print_cr("In-use global monitor info:");
@@ -2113,10 +2147,6 @@ void ObjectSynchronizer::log_in_use_monitor_details(outputStream * out,
     }
   }
 
-  if (!on_exit) {
-    Thread::muxRelease(&gListLock);
-  }
-
   out->print_cr("In-use per-thread monitor info:");
   out->print_cr("(B -> is_busy, H -> has hash code, L -> lock status)");
   out->print_cr("%18s  %18s  %s  %18s  %18s",
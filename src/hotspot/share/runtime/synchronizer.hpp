@@ -37,11 +37,11 @@ class ThreadsList;
 typedef PaddedEnd<ObjectMonitor, DEFAULT_CACHE_LINE_SIZE> PaddedObjectMonitor;
 
 struct DeflateMonitorCounters {
-  int n_in_use;              // currently associated with objects
-  int n_in_circulation;      // extant
-  int n_scavenged;           // reclaimed (global and per-thread)
-  int per_thread_scavenged;  // per-thread scavenge total
-  double per_thread_times;   // per-thread scavenge times
+  volatile int n_in_use;              // currently associated with objects
+  volatile int n_in_circulation;      // extant
+  volatile int n_scavenged;           // reclaimed (global and per-thread)
+  volatile int per_thread_scavenged;  // per-thread scavenge total
+  volatile jlong per_thread_ticks;    // per-thread scavenge times
 };
 
 class ObjectSynchronizer : AllStatic {
@@ -130,6 +130,12 @@ class ObjectSynchronizer : AllStatic {
   static void prepare_deflate_idle_monitors(DeflateMonitorCounters* counters);
   static void finish_deflate_idle_monitors(DeflateMonitorCounters* counters);
 
+  // Monitor population statistics, reported by JFR
+  static int    population();
+  static int    free_count();
+  static size_t inflation_count();
+  static size_t deflation_count();
+
   // For a given monitor list: global or per-thread, deflate idle monitors
   static int deflate_monitor_list(ObjectMonitor** list_p,
                                   ObjectMonitor** free_head_p,
@@ -175,7 +181,12 @@ class ObjectSynchronizer : AllStatic {
   // monitors they inflated need to be scanned for deflation
   static ObjectMonitor* volatile g_om_in_use_list;
   // count of entries in g_om_in_use_list
-  static int g_om_in_use_count;
+  static volatile int g_om_in_use_count;
+
+  // Lock-free list operations on the global lists
+  static void prepend_to_g_free_list(ObjectMonitor* list, ObjectMonitor* tail, int count);
+  static void prepend_to_g_om_in_use_list(ObjectMonitor* list, ObjectMonitor* tail, int count);
+  static ObjectMonitor* take_from_g_free_list();
 
   // Process oops in all global used monitors (i.e. moribund thread's monitors)
   static void global_used_oops_do(OopClosure* f);
@@ -44,6 +44,7 @@
 #include "jfr/jfrEvents.hpp"
 #include "jvmtifiles/jvmtiEnv.hpp"
 #include "logging/log.hpp"
+#include "logging/logAsyncWriter.hpp"
 #include "logging/logConfiguration.hpp"
 #include "logging/logStream.hpp"
 #include "memory/allocation.inline.hpp"
@@ -88,6 +89,7 @@
 #include "runtime/safepointMechanism.inline.hpp"
 #include "runtime/safepointVerifiers.hpp"
 #include "runtime/sharedRuntime.hpp"
+#include "runtime/startupTimeline.hpp"
 #include "runtime/statSampler.hpp"
 #include "runtime/stubRoutines.hpp"
 #include "runtime/sweeper.hpp"
@@ -280,6 +282,9 @@ Thread::Thread() {
   _hashStateZ = 0x8767;    // (int)(3579807591LL & 0xffff) ;
   _hashStateW = 273326509;
 
+  _symbol_region_top = NULL;
+  _symbol_region_end = NULL;
+
   _OnTrap   = 0;
   _Stalled  = 0;
   _TypeTag  = 0x2BAD;
@@ -445,6 +450,9 @@ Thread::~Thread() {
   }
 #endif // INCLUDE_NMT
 
+  // Return the unused cached global handle entries.
+  JNIHandles::release_global_handle_cache(this);
+
   // deallocate data structures
   delete resource_area();
   // since the handle marks are using the handle area, we have to deallocated the root
@@ -1676,6 +1684,7 @@ void JavaThread::initialize() {
   _is_method_handle_return = 0;
   _jvmti_thread_state= NULL;
   _should_post_on_exceptions_flag = JNI_FALSE;
+  _profile_sample_countdown = 0;
   _interp_only_mode    = 0;
   _special_runtime_exit_condition = _no_async_condition;
   _pending_async_exception = NULL;
@@ -3615,6 +3624,7 @@ void Threads::possibly_parallel_threads_do(bool is_par, ThreadClosure* tc) {
 //     fields in, out, and err. Set up java signal handlers, OS-specific
 //     system settings, and thread group of the main thread.
 static void call_initPhase1(TRAPS) {
+  StartupTimelineMark stm("Initialize system properties");
   Klass* klass =  SystemDictionary::resolve_or_fail(vmSymbols::java_lang_System(), true, CHECK);
   JavaValue result(T_VOID);
   JavaCalls::call_static(&result, klass, vmSymbols::initPhase1_name(),
@@ -3634,6 +3644,7 @@ static void call_initPhase1(TRAPS) {
 //     After phase 2, The VM will begin search classes from -Xbootclasspath/a.
 static void call_initPhase2(TRAPS) {
   TraceTime timer("Initialize module system", TRACETIME_LOG(Info, startuptime));
+  StartupTimelineMark stm("Initialize module system");
 
   Klass* klass = SystemDictionary::resolve_or_fail(vmSymbols::java_lang_System(), true, CHECK);
 
@@ -3657,6 +3668,7 @@ static void call_initPhase2(TRAPS) {
 //     and system class loader may be a custom class loaded from -Xbootclasspath/a,
 //     other modules or the application's classpath.
 static void call_initPhase3(TRAPS) {
+  StartupTimelineMark stm("Initialize security manager and system class loader");
   Klass* klass = SystemDictionary::resolve_or_fail(vmSymbols::java_lang_System(), true, CHECK);
   JavaValue result(T_VOID);
   JavaCalls::call_static(&result, klass, vmSymbols::initPhase3_name(),
@@ -3665,6 +3677,7 @@ static void call_initPhase3(TRAPS) {
 
 void Threads::initialize_java_lang_classes(JavaThread* main_thread, TRAPS) {
   TraceTime timer("Initialize java.lang classes", TRACETIME_LOG(Info, startuptime));
+  StartupTimelineMark stm("Initialize java.lang classes");
 
   if (EagerXrunInit && Arguments::init_libraries_at_startup()) {
     create_vm_init_libraries();
@@ -3732,6 +3745,7 @@ void Threads::initialize_java_lang_classes(JavaThread* main_thread, TRAPS) {
 
 void Threads::initialize_jsr292_core_classes(TRAPS) {
   TraceTime timer("Initialize java.lang.invoke classes", TRACETIME_LOG(Info, startuptime));
+  StartupTimelineMark stm("Initialize java.lang.invoke classes");
 
   initialize_class(vmSymbols::java_lang_invoke_MethodHandle(), CHECK);
   initialize_class(vmSymbols::java_lang_invoke_ResolvedMethodName(), CHECK);
@@ -3812,6 +3826,11 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
   jint os_init_2_result = os::init_2();
   if (os_init_2_result != JNI_OK) return os_init_2_result;
 
+  // Start the startup timeline, now that the thread CPU time is available
+  StartupTimeline::initialize();
+  // Stops the timeline if VM creation fails below
+  StartupTimelineAbortMark stam;
+
 #ifdef CAN_SHOW_REGISTERS_ON_ASSERT
   // Initialize assert poison page mechanism.
   if (ShowRegistersOnAssert) {
@@ -3835,6 +3854,7 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
 
   // Launch -agentlib/-agentpath and converted -Xrun agents
   if (Arguments::init_agents_at_startup()) {
+    StartupTimelineMark stm("Launch agents");
     create_vm_init_agents();
   }
 
@@ -3843,7 +3863,9 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
   _number_of_non_daemon_threads = 0;
 
   // Initialize global data structures and create system classes in heap
-  vm_init_globals();
+  { StartupTimelineMark stm("Initialize VM globals");
+    vm_init_globals();
+  }
 
 #if INCLUDE_JVMCI
   if (JVMCICounterSize > 0) {
@@ -3879,7 +3901,10 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
   ObjectMonitor::Initialize();
 
   // Initialize global modules
-  jint status = init_globals();
+  jint status;
+  { StartupTimelineMark stm("Initialize global modules");
+    status = init_globals();
+  }
   if (status != JNI_OK) {
     main_thread->smr_delete();
     *canTryAgain = false; // don't let caller call JNI_CreateJavaVM again
@@ -3903,6 +3928,7 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
 
   // Create the VMThread
   { TraceTime timer("Start VMThread", TRACETIME_LOG(Info, startuptime));
+    StartupTimelineMark stm("Start VMThread");
 
     VMThread::create();
     Thread* vmthread = VMThread::vm_thread();
@@ -3959,6 +3985,7 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
   set_init_completed();
 
   LogConfiguration::post_initialize();
+  LogAsyncWriter::initialize();
   Metaspace::post_initialize();
 
   HOTSPOT_VM_INIT_END();
@@ -4007,11 +4034,13 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
     }
   }
 #endif
-  CompileBroker::compilation_init_phase1(CHECK_JNI_ERR);
-  // Postpone completion of compiler initialization to after JVMCI
-  // is initialized to avoid timeouts of blocking compilations.
-  if (JVMCI_ONLY(!force_JVMCI_intialization) NOT_JVMCI(true)) {
-    CompileBroker::compilation_init_phase2();
+  { StartupTimelineMark stm("Initialize compilers");
+    CompileBroker::compilation_init_phase1(CHECK_JNI_ERR);
+    // Postpone completion of compiler initialization to after JVMCI
+    // is initialized to avoid timeouts of blocking compilations.
+    if (JVMCI_ONLY(!force_JVMCI_intialization) NOT_JVMCI(true)) {
+      CompileBroker::compilation_init_phase2();
+    }
   }
 #endif
 
@@ -4065,7 +4094,9 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
   JFR_ONLY(Jfr::on_create_vm_3();)
 
 #if INCLUDE_MANAGEMENT
-  Management::initialize(THREAD);
+  { StartupTimelineMark stm("Initialize management");
+    Management::initialize(THREAD);
+  }
 
   if (HAS_PENDING_EXCEPTION) {
     // management agent fails to start possibly due to
@@ -4107,6 +4138,7 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
   }
 
   create_vm_timer.end();
+  StartupTimeline::finish();
 #ifdef ASSERT
   _vm_complete = true;
 #endif
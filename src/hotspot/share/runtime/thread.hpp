@@ -177,6 +177,7 @@ class Thread: public ThreadShadow {
   friend class SafeThreadsListPtr;  // for _threads_list_ptr, cmpxchg_threads_hazard_ptr(), {dec_,inc_,}nested_threads_hazard_ptr_cnt(), {g,s}et_threads_hazard_ptr(), inc_nested_handle_cnt(), tag_hazard_ptr() access
   friend class ScanHazardPtrGatherProtectedThreadsClosure;  // for cmpxchg_threads_hazard_ptr(), get_threads_hazard_ptr(), is_hazard_ptr_tagged() access
   friend class ScanHazardPtrGatherThreadsListClosure;  // for get_threads_hazard_ptr(), untag_hazard_ptr() access
+  friend class ScanHazardPtrMatchThreadsListClosure;  // for get_threads_hazard_ptr(), untag_hazard_ptr() access
   friend class ScanHazardPtrPrintMatchingThreadsClosure;  // for get_threads_hazard_ptr(), is_hazard_ptr_tagged() access
   friend class ThreadsSMRSupport;  // for _nested_threads_hazard_ptr_cnt, _threads_hazard_ptr, _threads_list_ptr access
 
@@ -336,6 +337,9 @@ class Thread: public ThreadShadow {
   // One-element thread local free list
   JNIHandleBlock* _free_handle_block;
 
+  // Preallocated global handle entries, see JNIHandles::make_global
+  JNIGlobalHandleCache _global_handle_cache;
+
   // Point to the last handle mark
   HandleMark* _last_handle_mark;
 
@@ -397,6 +401,9 @@ class Thread: public ThreadShadow {
 
   ThreadStatisticalInfo _statistical_info;      // Statistics about the thread
 
+  char* _symbol_region_top;                     // Region of the symbol arena this
+  char* _symbol_region_end;                     // thread allocates permanent symbols from
+
   JFR_ONLY(DEFINE_THREAD_LOCAL_FIELD_JFR;)      // Thread-local data for jfr
 
   int   _vm_operation_started_count;            // VM_Operation support
@@ -588,6 +595,7 @@ class Thread: public ThreadShadow {
   void set_active_handles(JNIHandleBlock* block) { _active_handles = block; }
   JNIHandleBlock* free_handle_block() const      { return _free_handle_block; }
   void set_free_handle_block(JNIHandleBlock* block) { _free_handle_block = block; }
+  JNIGlobalHandleCache* global_handle_cache()    { return &_global_handle_cache; }
 
   // Internal handle support
   HandleArea* handle_area() const                { return _handle_area; }
@@ -613,6 +621,13 @@ class Thread: public ThreadShadow {
 
   ThreadStatisticalInfo& statistical_info() { return _statistical_info; }
 
+  char* symbol_region_top() const { return _symbol_region_top; }
+  char* symbol_region_end() const { return _symbol_region_end; }
+  void set_symbol_region(char* top, char* end) {
+    _symbol_region_top = top;
+    _symbol_region_end = end;
+  }
+
   JFR_ONLY(DEFINE_THREAD_LOCAL_ACCESSOR_JFR;)
 
   bool is_trace_suspend()               { return (_suspend_flags & _trace_flag) != 0; }
@@ -2011,6 +2026,14 @@ class JavaThread: public Thread {
   int   should_post_on_exceptions_flag()  { return _should_post_on_exceptions_flag; }
   void  set_should_post_on_exceptions_flag(int val)  { _should_post_on_exceptions_flag = val; }
 
+  // Counts down the receiver type profile updates skipped by C1 profiled
+  // code when C1ProfileReceiverSampleRate > 1
+ private:
+  int    _profile_sample_countdown;
+
+ public:
+  static ByteSize profile_sample_countdown_offset() { return byte_offset_of(JavaThread, _profile_sample_countdown); }
+
  private:
   ThreadStatistics *_thread_stat;
 
@@ -47,7 +47,7 @@ class ThreadHeapSampler {
 
   static double fast_log2(const double& d);
   static bool init_log_table();
-  uint64_t next_random(uint64_t rnd);
+  static uint64_t next_random(uint64_t rnd);
 
  public:
   ThreadHeapSampler() : _bytes_until_sample(0) {
@@ -62,6 +62,10 @@ class ThreadHeapSampler {
 
   void check_for_sampling(oop obj, size_t size_in_bytes, size_t bytes_allocated_before);
 
+  // A geometrically distributed number of bytes with the given mean, for
+  // sampling allocations as a Poisson process.
+  static size_t geometric_interval(size_t mean);
+
   static void set_sampling_interval(int sampling_interval);
   static int get_sampling_interval();
 };
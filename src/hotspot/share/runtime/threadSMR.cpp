@@ -319,6 +319,30 @@ class ScanHazardPtrGatherThreadsListClosure : public ThreadClosure {
   }
 };
 
+// Closure to determine if the specified ThreadsList is referenced by a
+// hazard ptr.
+//
+class ScanHazardPtrMatchThreadsListClosure : public ThreadClosure {
+ private:
+  ThreadsList *_list;
+  bool _found;
+ public:
+  ScanHazardPtrMatchThreadsListClosure(ThreadsList *list) : _list(list), _found(false) {}
+
+  bool found() const { return _found; }
+
+  virtual void do_thread(Thread* thread) {
+    assert_locked_or_safepoint(Threads_lock);
+
+    if (_found || thread == NULL) return;
+    ThreadsList *threads = thread->get_threads_hazard_ptr();
+    // As in ScanHazardPtrGatherThreadsListClosure, ignore the tag.
+    if (Thread::untag_hazard_ptr(threads) == _list) {
+      _found = true;
+    }
+  }
+};
+
 // Closure to print JavaThreads that have a hazard ptr (ThreadsList
 // reference) that contains an indirect reference to a specific JavaThread.
 //
@@ -571,28 +595,87 @@ void SafeThreadsListPtr::verify_hazard_ptr_scanned() {
 #endif
 }
 
-// 'entries + 1' so we always have at least one entry.
+// The JavaThread array of one or more ThreadsLists. A ThreadsList made
+// by add_thread() shares the array of the ThreadsList it was made from
+// when nothing has been appended to the array since and there is room
+// for one more entry. Readers of the older ThreadsList never look beyond
+// its length, so they are not affected by the append. Only used with
+// the Threads_lock held or at a safepoint.
+class ThreadsListStorage : public CHeapObj<mtThread> {
+ public:
+  JavaThread** const _threads;
+  const uint _capacity;
+  uint _used;
+  uint _ref_count;
+
+  // 'capacity + 1' so we always have at least one entry.
+  ThreadsListStorage(uint capacity, uint used) :
+    _threads(NEW_C_HEAP_ARRAY(JavaThread*, capacity + 1, mtThread)),
+    _capacity(capacity),
+    _used(used),
+    _ref_count(0)
+  {
+    _threads[used] = NULL;  // Make sure the extra entry is NULL.
+  }
+
+  ~ThreadsListStorage() {
+    FREE_C_HEAP_ARRAY(JavaThread*, _threads);
+  }
+
+  // Leave room to add as many JavaThreads as there already are before
+  // the array has to be copied again.
+  static uint capacity_for(uint length) {
+    return MAX2(length * 2, 8u);
+  }
+};
+
 ThreadsList::ThreadsList(int entries) :
   _length(entries),
   _next_list(NULL),
-  _threads(NEW_C_HEAP_ARRAY(JavaThread*, entries + 1, mtThread)),
+  _storage(new ThreadsListStorage(entries, entries)),
+  _threads(_storage->_threads),
   _nested_handle_cnt(0)
 {
-  *(JavaThread**)(_threads + entries) = NULL;  // Make sure the extra entry is NULL.
+  _storage->_ref_count++;
+}
+
+ThreadsList::ThreadsList(ThreadsListStorage* storage, uint entries) :
+  _length(entries),
+  _next_list(NULL),
+  _storage(storage),
+  _threads(storage->_threads),
+  _nested_handle_cnt(0)
+{
+  assert(entries <= storage->_used, "sanity");
+  storage->_ref_count++;
 }
 
 ThreadsList::~ThreadsList() {
-  FREE_C_HEAP_ARRAY(JavaThread*, _threads);
+  if (--_storage->_ref_count == 0) {
+    delete _storage;
+  }
 }
 
 // Add a JavaThread to a ThreadsList. The returned ThreadsList is a
-// new copy of the specified ThreadsList with the specified JavaThread
-// appended to the end.
+// new ThreadsList with the specified JavaThread appended to the end of
+// the specified ThreadsList.
 ThreadsList *ThreadsList::add_thread(ThreadsList *list, JavaThread *java_thread) {
   const uint index = list->_length;
   const uint new_length = index + 1;
   const uint head_length = index;
-  ThreadsList *const new_list = new ThreadsList(new_length);
+  ThreadsListStorage *const storage = list->_storage;
+
+  // An empty list is never shared: JavaThreadIterator::first() reads
+  // its extra NULL entry.
+  if (index > 0 && storage->_used == index && index < storage->_capacity) {
+    storage->_threads[index] = java_thread;
+    storage->_threads[new_length] = NULL;
+    storage->_used = new_length;
+    return new ThreadsList(storage, new_length);
+  }
+
+  ThreadsList *const new_list = new ThreadsList(new ThreadsListStorage(ThreadsListStorage::capacity_for(new_length), new_length),
+                                                new_length);
 
   if (head_length > 0) {
     Copy::disjoint_words((HeapWord*)list->_threads, (HeapWord*)new_list->_threads, head_length);
@@ -673,7 +756,8 @@ ThreadsList *ThreadsList::remove_thread(ThreadsList* list, JavaThread* java_thre
   const uint new_length = list->_length - 1;
   const uint head_length = index;
   const uint tail_length = (new_length >= index) ? (new_length - index) : 0;
-  ThreadsList *const new_list = new ThreadsList(new_length);
+  ThreadsList *const new_list = new ThreadsList(new ThreadsListStorage(ThreadsListStorage::capacity_for(new_length), new_length),
+                                                new_length);
 
   if (head_length > 0) {
     Copy::disjoint_words((HeapWord*)list->_threads, (HeapWord*)new_list->_threads, head_length);
@@ -807,6 +891,29 @@ void ThreadsSMRSupport::free_list(ThreadsList* threads) {
     }
   }
 
+  if (threads->next_list() == NULL) {
+    // Common case: no older ThreadsList is still waiting to be freed, so
+    // check the hazard ptrs for this one ThreadsList without gathering
+    // them into a hash table first.
+    ScanHazardPtrMatchThreadsListClosure scan_cl(threads);
+    threads_do(&scan_cl);
+    OrderAccess::acquire(); // Must order reads of hazard ptr before reads of
+                            // nested reference counters
+
+    if (!scan_cl.found() && threads->_nested_handle_cnt == 0) {
+      _to_delete_list = NULL;
+      log_debug(thread, smr)("tid=" UINTX_FORMAT ": ThreadsSMRSupport::free_list: threads=" INTPTR_FORMAT " is freed.", os::current_thread_id(), p2i(threads));
+      delete threads;
+      if (EnableThreadSMRStatistics) {
+        _java_thread_list_free_cnt++;
+        _to_delete_list_cnt--;
+      }
+    } else {
+      log_debug(thread, smr)("tid=" UINTX_FORMAT ": ThreadsSMRSupport::free_list: threads=" INTPTR_FORMAT " is not freed.", os::current_thread_id(), p2i(threads));
+    }
+    return;
+  }
+
   // Hash table size should be first power of two higher than twice the length of the ThreadsList
   int hash_table_size = MIN2((int)get_java_thread_list()->length(), 32) << 1;
   hash_table_size--;
@@ -156,6 +156,8 @@ class ThreadsSMRSupport : AllStatic {
   static void print_info_on(const Thread* thread, outputStream* st);
 };
 
+class ThreadsListStorage;
+
 // A fast list of JavaThreads.
 //
 class ThreadsList : public CHeapObj<mtThread> {
@@ -165,9 +167,12 @@ class ThreadsList : public CHeapObj<mtThread> {
 
   const uint _length;
   ThreadsList* _next_list;
+  ThreadsListStorage *const _storage;
   JavaThread *const *const _threads;
   volatile intx _nested_handle_cnt;
 
+  ThreadsList(ThreadsListStorage* storage, uint entries);
+
   template <class T>
   void threads_do_dispatch(T *cl, JavaThread *const thread) const;
 
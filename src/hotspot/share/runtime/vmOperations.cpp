@@ -213,6 +213,18 @@ VM_FindDeadlocks::~VM_FindDeadlocks() {
   }
 }
 
+bool VM_FindDeadlocks::doit_prologue() {
+  // Skip the safepoint if no thread is currently blocked in a way that
+  // could be part of a deadlock. Reading the park blockers requires the
+  // requesting thread to be a JavaThread in the VM.
+  Thread* thread = Thread::current();
+  if (!thread->is_Java_thread() || ((JavaThread*)thread)->thread_state() != _thread_in_vm) {
+    return true;
+  }
+  ThreadsListHandle tlh;
+  return ThreadService::may_have_deadlocks(tlh.list(), _concurrent_locks);
+}
+
 void VM_FindDeadlocks::doit() {
   // Update the hazard ptr in the originating thread to the current
   // list of threads. This VM operation needs the current list of
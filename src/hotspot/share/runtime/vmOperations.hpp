@@ -71,6 +71,7 @@
   template(ZMarkEnd)                              \
   template(ZRelocateStart)                        \
   template(ZVerify)                               \
+  template(EpsilonCollect)                        \
   template(HandshakeOneThread)                    \
   template(HandshakeAllThreads)                   \
   template(HandshakeFallback)                     \
@@ -84,7 +85,6 @@
   template(GetOwnedMonitorInfo)                   \
   template(GetObjectMonitorUsage)                 \
   template(GetCurrentContendedMonitor)            \
-  template(GetStackTrace)                         \
   template(GetMultipleStackTraces)                \
   template(GetAllStackTraces)                     \
   template(GetThreadListStackTraces)              \
@@ -393,6 +393,7 @@ class VM_FindDeadlocks: public VM_Operation {
 
   DeadlockCycle* result()      { return _deadlocks; };
   VMOp_Type type() const       { return VMOp_FindDeadlocks; }
+  bool doit_prologue();
   void doit();
 };
 
@@ -196,13 +196,62 @@ static jint thread_dump(AttachOperation* op, outputStream* out) {
   return JNI_OK;
 }
 
+// The output stream of an attach operation. With AttachListenerStreamOutput,
+// the output buffered so far can be sent to the client before the operation
+// completes. This is only done at points where the attach listener thread
+// can safely block on the client: in the VM, outside of any VM operation and
+// holding no locks. Output produced inside a VM operation, such as a thread
+// dump or a class histogram, is always buffered until the operation completes.
+class AttachOutputStream : public bufferedStream {
+ private:
+  AttachOperation* _op;
+
+ public:
+  AttachOutputStream(AttachOperation* op) : bufferedStream(), _op(op) {}
+
+  // Send the output buffered so far, if the platform supports it.
+  void stream() {
+    if (AttachListenerStreamOutput && size() > 0 && _op->stream(this)) {
+      reset();
+    }
+  }
+};
+
 // A jcmd attach operation request was received, which will now
 // dispatch to the diagnostic commands used for serviceability functions.
 static jint jcmd(AttachOperation* op, outputStream* out) {
   Thread* THREAD = Thread::current();
   // All the supplied jcmd arguments are stored as a single
   // string (op->arg(0)). This is parsed by the Dcmd framework.
-  DCmd::parse_and_execute(DCmd_Source_AttachAPI, out, op->arg(0), ' ', THREAD);
+  if (!AttachListenerStreamOutput) {
+    DCmd::parse_and_execute(DCmd_Source_AttachAPI, out, op->arg(0), ' ', THREAD);
+  } else {
+    // Execute the command lines one at a time, and send the output of each
+    // to the client before the next one is run. The output of the last one
+    // is sent with the result code when the operation completes.
+    const char* cmdline = op->arg(0);
+    while (cmdline != NULL && cmdline[0] != '\0') {
+      ResourceMark rm(THREAD);
+      const char* end = strchr(cmdline, '\n');
+      size_t len = (end != NULL) ? (size_t)(end - cmdline) : strlen(cmdline);
+      CmdLine line(cmdline, len, false);
+      if (line.is_stop()) {
+        break;
+      }
+      char* single = NEW_RESOURCE_ARRAY(char, len + 1);
+      strncpy(single, cmdline, len);
+      single[len] = '\0';
+      DCmd::parse_and_execute(DCmd_Source_AttachAPI, out, single, ' ', THREAD);
+      if (HAS_PENDING_EXCEPTION) {
+        break;
+      }
+      if (end == NULL) {
+        break;
+      }
+      ((AttachOutputStream*)out)->stream();
+      cmdline = end + 1;
+    }
+  }
   if (HAS_PENDING_EXCEPTION) {
     java_lang_Throwable::print(PENDING_EXCEPTION, out);
     out->cr();
@@ -248,6 +297,7 @@ jint dump_heap(AttachOperation* op, outputStream* out) {
 // Input arguments :-
 //   arg0: "-live" or "-all"
 //   arg1: Name of the dump file or NULL
+//   arg2: Number of threads iterating the heap, 0 or empty lets the VM decide
 static jint heap_inspection(AttachOperation* op, outputStream* out) {
   bool live_objects_only = true;   // default is true to retain the behavior before this change is made
   outputStream* os = out;   // if path not specified or path is NULL, use out
@@ -261,6 +311,18 @@ static jint heap_inspection(AttachOperation* op, outputStream* out) {
     live_objects_only = strcmp(arg0, "-live") == 0;
   }
 
+  uint parallel_thread_num = 0;
+  const char* num_str = op->arg(2);
+  if (num_str != NULL && num_str[0] != '\0') {
+    char* end;
+    long num = strtol(num_str, &end, 10);
+    if (*end != '\0' || num < 0) {
+      out->print_cr("Invalid parallel thread number: [%s]", num_str);
+      return JNI_ERR;
+    }
+    parallel_thread_num = (uint)MIN2(num, (long)max_juint);
+  }
+
   const char* path = op->arg(1);
   if (path != NULL) {
     if (path[0] == '\0') {
@@ -276,7 +338,7 @@ static jint heap_inspection(AttachOperation* op, outputStream* out) {
     }
   }
 
-  VM_GC_HeapInspection heapop(os, live_objects_only /* request full gc */);
+  VM_GC_HeapInspection heapop(os, live_objects_only /* request full gc */, parallel_thread_num);
   VMThread::execute(&heapop);
   if (os != NULL && os != out) {
     out->print_cr("Heap inspection file created: %s", path);
@@ -373,7 +435,7 @@ static void attach_listener_thread_entry(JavaThread* thread, TRAPS) {
     }
 
     ResourceMark rm;
-    bufferedStream st;
+    AttachOutputStream st(op);
     jint res = JNI_OK;
 
     // handle special detachall operation
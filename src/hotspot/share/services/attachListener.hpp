@@ -187,6 +187,14 @@ class AttachOperation: public CHeapObj<mtInternal> {
     }
   }
 
+  // send the result data buffered so far to the client before the operation
+  // completes. The first call sends JNI_OK as the result code, so the reply
+  // has the same format as when it is sent by complete(). Only called by the
+  // attach listener thread where it can block, in the VM and outside of any
+  // VM operation. Returns false if the platform cannot stream result data, in
+  // which case it stays buffered until complete() is called.
+  virtual bool stream(bufferedStream* result_stream) { return false; }
+
   // complete operation by sending result code and any result data to the client
   virtual void complete(jint result, bufferedStream* result_stream) = 0;
 };
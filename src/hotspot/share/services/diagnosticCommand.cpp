@@ -28,6 +28,7 @@
 #include "classfile/classLoaderStats.hpp"
 #include "compiler/compileBroker.hpp"
 #include "compiler/directivesParser.hpp"
+#include "compiler/profileSnapshot.hpp"
 #include "gc/shared/gcVMOperations.hpp"
 #include "memory/metaspace/metaspaceDCmd.hpp"
 #include "memory/resourceArea.hpp"
@@ -38,6 +39,7 @@
 #include "runtime/fieldDescriptor.inline.hpp"
 #include "runtime/flags/jvmFlag.hpp"
 #include "runtime/handles.inline.hpp"
+#include "runtime/handshake.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/javaCalls.hpp"
 #include "runtime/os.hpp"
@@ -105,6 +107,7 @@ void DCmdRegistrant::register_dcmds(){
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<JVMTIDataDumpDCmd>(full_export, true, false));
 #endif // INCLUDE_JVMTI
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ThreadDumpDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ThreadSampleDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ClassLoaderStatsDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ClassLoaderHierarchyDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CompileQueueDCmd>(full_export, true, false));
@@ -117,6 +120,7 @@ void DCmdRegistrant::register_dcmds(){
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CompilerDirectivesAddDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CompilerDirectivesRemoveDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CompilerDirectivesClearDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ProfileSnapshotDCmd>(full_export, true, false));
 
   // Enhanced JMX Agent Support
   // These commands won't be exported via the DiagnosticCommandMBean until an
@@ -506,17 +510,37 @@ HeapDumpDCmd::HeapDumpDCmd(outputStream* output, bool heap) :
                            DCmdWithParser(output, heap),
   _filename("filename","Name of the dump file", "STRING",true),
   _all("-all", "Dump all objects, including unreachable objects",
-       "BOOLEAN", false, "false") {
+       "BOOLEAN", false, "false"),
+  _gzip("-gz", "If specified, the heap dump is written in gzipped format "
+               "using the given compression level. 0 (the default) writes an "
+               "uncompressed dump, 1 (recommended) is the fastest, 9 the "
+               "strongest compression.", "INT", false, "0"),
+  _parallel("-parallel", "Number of threads dumping the heap objects, if the "
+                         "garbage collector supports it. 0 lets the VM decide.",
+            "INT", false, "0") {
   _dcmdparser.add_dcmd_option(&_all);
+  _dcmdparser.add_dcmd_option(&_gzip);
+  _dcmdparser.add_dcmd_option(&_parallel);
   _dcmdparser.add_dcmd_argument(&_filename);
 }
 
 void HeapDumpDCmd::execute(DCmdSource source, TRAPS) {
+  jlong level = _gzip.value();
+  if (level < 0 || level > 9) {
+    output()->print_cr("Compression level out of range (0-9): " JLONG_FORMAT, level);
+    return;
+  }
+  jlong parallel = _parallel.value();
+  if (parallel < 0) {
+    output()->print_cr("Invalid number of dump threads: " JLONG_FORMAT, parallel);
+    return;
+  }
+
   // Request a full GC before heap dump if _all is false
   // This helps reduces the amount of unreachable objects in the dump
   // and makes it easier to browse.
   HeapDumper dumper(!_all.value() /* request GC if _all is false*/);
-  dumper.dump(_filename.value(), output());
+  dumper.dump(_filename.value(), output(), (int)level, (uint)parallel);
 }
 
 int HeapDumpDCmd::num_arguments() {
@@ -533,13 +557,23 @@ int HeapDumpDCmd::num_arguments() {
 ClassHistogramDCmd::ClassHistogramDCmd(outputStream* output, bool heap) :
                                        DCmdWithParser(output, heap),
   _all("-all", "Inspect all objects, including unreachable objects",
-       "BOOLEAN", false, "false") {
+       "BOOLEAN", false, "false"),
+  _parallel("-parallel", "Number of threads iterating the heap, if the "
+                         "garbage collector supports it. 0 lets the VM decide.",
+            "INT", false, "0") {
   _dcmdparser.add_dcmd_option(&_all);
+  _dcmdparser.add_dcmd_option(&_parallel);
 }
 
 void ClassHistogramDCmd::execute(DCmdSource source, TRAPS) {
+  jlong parallel = _parallel.value();
+  if (parallel < 0) {
+    output()->print_cr("Invalid number of threads: " JLONG_FORMAT, parallel);
+    return;
+  }
   VM_GC_HeapInspection heapop(output(),
-                              !_all.value() /* request full gc if false */);
+                              !_all.value() /* request full gc if false */,
+                              (uint)parallel);
   VMThread::execute(&heapop);
 }
 
@@ -640,6 +674,36 @@ int ThreadDumpDCmd::num_arguments() {
   }
 }
 
+// Each Java thread prints its own stack when it reaches its next safepoint
+// poll, or the VM thread prints it for a thread that is already blocked, so
+// several threads may be sampled at the same time.
+class ThreadSampleClosure : public ThreadClosure {
+private:
+  outputStream* _out;
+  Mutex _lock;
+
+public:
+  ThreadSampleClosure(outputStream* out) :
+    _out(out), _lock(Mutex::leaf, "ThreadSample_lock", true, Mutex::_safepoint_check_never) {}
+
+  void do_thread(Thread* th) {
+    assert(th->is_Java_thread(), "sanity");
+    JavaThread* jt = (JavaThread*)th;
+    ResourceMark rm;
+    stringStream ss;
+    jt->print_on(&ss);
+    jt->print_stack_on(&ss);
+    ss.cr();
+    MutexLocker ml(&_lock, Mutex::_no_safepoint_check_flag);
+    _out->print_raw(ss.as_string(), ss.size());
+  }
+};
+
+void ThreadSampleDCmd::execute(DCmdSource source, TRAPS) {
+  ThreadSampleClosure tsc(output());
+  Handshake::execute(&tsc);
+}
+
 // Enhanced JMX Agent support
 
 JMXStartRemoteDCmd::JMXStartRemoteDCmd(outputStream *output, bool heap_allocated) :
@@ -1033,6 +1097,27 @@ void CompilerDirectivesRemoveDCmd::execute(DCmdSource source, TRAPS) {
 void CompilerDirectivesClearDCmd::execute(DCmdSource source, TRAPS) {
   DirectivesStack::clear();
 }
+
+ProfileSnapshotDCmd::ProfileSnapshotDCmd(outputStream* output, bool heap) :
+                     DCmdWithParser(output, heap),
+  _filename("filename", "Name of the profile snapshot file", "STRING", true) {
+  _dcmdparser.add_dcmd_argument(&_filename);
+}
+
+void ProfileSnapshotDCmd::execute(DCmdSource source, TRAPS) {
+  ProfileSnapshot::dump(_filename.value(), output());
+}
+
+int ProfileSnapshotDCmd::num_arguments() {
+  ResourceMark rm;
+  ProfileSnapshotDCmd* dcmd = new ProfileSnapshotDCmd(NULL, false);
+  if (dcmd != NULL) {
+    DCmdMark mark(dcmd);
+    return dcmd->_dcmdparser.num_arguments();
+  } else {
+    return 0;
+  }
+}
 #if INCLUDE_SERVICES
 ClassHierarchyDCmd::ClassHierarchyDCmd(outputStream* output, bool heap) :
                                        DCmdWithParser(output, heap),
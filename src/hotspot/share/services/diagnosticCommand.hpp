@@ -330,6 +330,8 @@ class HeapDumpDCmd : public DCmdWithParser {
 protected:
   DCmdArgument<char*> _filename;
   DCmdArgument<bool>  _all;
+  DCmdArgument<jlong> _gzip;
+  DCmdArgument<jlong> _parallel;
 public:
   HeapDumpDCmd(outputStream* output, bool heap);
   static const char* name() {
@@ -356,6 +358,7 @@ public:
 class ClassHistogramDCmd : public DCmdWithParser {
 protected:
   DCmdArgument<bool> _all;
+  DCmdArgument<jlong> _parallel;
 public:
   ClassHistogramDCmd(outputStream* output, bool heap);
   static const char* name() {
@@ -464,6 +467,26 @@ public:
   virtual void execute(DCmdSource source, TRAPS);
 };
 
+class ThreadSampleDCmd : public DCmd {
+public:
+  ThreadSampleDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
+  static const char* name() { return "Thread.sample"; }
+  static const char* description() {
+    return "Print all threads with stacktraces, each taken by a handshake with "
+           "that thread instead of at a global safepoint.";
+  }
+  static const char* impact() {
+    return "Low: Depends on the number of threads.";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", NULL};
+    return p;
+  }
+  static int num_arguments() { return 0; }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 // Enhanced JMX Agent support
 
 class JMXStartRemoteDCmd : public DCmdWithParser {
@@ -754,6 +777,30 @@ public:
   virtual void execute(DCmdSource source, TRAPS);
 };
 
+class ProfileSnapshotDCmd : public DCmdWithParser {
+protected:
+  DCmdArgument<char*> _filename;
+public:
+  ProfileSnapshotDCmd(outputStream* output, bool heap);
+  static const char* name() {
+    return "Compiler.profile_snapshot";
+  }
+  static const char* description() {
+    return "Write the profiles of hot methods to a file, to be loaded "
+           "with -XX:ProfileSnapshotReplayFile.";
+  }
+  static const char* impact() {
+    return "Medium: Depends on the number of loaded methods.";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", NULL};
+    return p;
+  }
+  static int num_arguments();
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 ///////////////////////////////////////////////////////////////////////
 //
 // jcmd command support for symbol table, string table and system dictionary dumping:
@@ -24,6 +24,7 @@
 
 #include "precompiled.hpp"
 #include "jvm.h"
+#include "classfile/classLoader.hpp"
 #include "classfile/classLoaderData.inline.hpp"
 #include "classfile/classLoaderDataGraph.hpp"
 #include "classfile/javaClasses.inline.hpp"
@@ -32,6 +33,7 @@
 #include "classfile/vmSymbols.hpp"
 #include "gc/shared/gcLocker.hpp"
 #include "gc/shared/gcVMOperations.hpp"
+#include "gc/shared/workgroup.hpp"
 #include "memory/allocation.inline.hpp"
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
@@ -55,6 +57,10 @@
 #include "utilities/macros.hpp"
 #include "utilities/ostream.hpp"
 
+#ifndef O_BINARY       // if defined (Win32) use binary files.
+#define O_BINARY 0     // otherwise do nothing.
+#endif
+
 /*
  * HPROF binary format - description copied from:
  *   src/share/demo/jvmti/hprof/hprof_io.c
@@ -376,6 +382,39 @@ enum {
   INITIAL_CLASS_COUNT = 200
 };
 
+// Entry points in the zip library used to gzip the dump file
+
+typedef size_t (*GZipBound_t)(size_t in_len);
+typedef size_t (*GZipFully_t)(char* in, size_t in_len, char* out, size_t out_len,
+                              int level, char** pmsg);
+
+static GZipBound_t GZipBound = NULL;
+static GZipFully_t GZipFully = NULL;
+
+// Looks up the gzip entry points, returns false if they are not available.
+static bool load_gzip_library() {
+  if (GZipFully == NULL) {
+    void* handle = ClassLoader::zip_library_handle();
+    if (handle == NULL) {
+      return false;
+    }
+    GZipBound = CAST_TO_FN_PTR(GZipBound_t, os::dll_lookup(handle, "ZIP_GZip_Bound"));
+    GZipFully = CAST_TO_FN_PTR(GZipFully_t, os::dll_lookup(handle, "ZIP_GZip_Fully"));
+  }
+  return GZipBound != NULL && GZipFully != NULL;
+}
+
+// Returns the (C heap allocated) name of the idx'th part file of the
+// dump at path. Parts are merged into the dump file when the dump is done.
+static char* dump_part_path(const char* path, uint idx) {
+  const size_t len = strlen(path) + 12; // ".p" + digits + '\0'
+  char* part_path = (char*)os::malloc(len, mtInternal);
+  if (part_path != NULL) {
+    jio_snprintf(part_path, len, "%s.p%u", path, idx);
+  }
+  return part_path;
+}
+
 // Supports I/O operations on a dump file
 
 class DumpWriter : public StackObj {
@@ -395,6 +434,15 @@ class DumpWriter : public StackObj {
 
   char* _error;   // error message when I/O fails
 
+  // gzip compression level, 0 if the file is not compressed. A compressed
+  // file is a sequence of gzip members, one per flushed buffer, and can
+  // only be appended to. The current dump segment is kept in the buffer
+  // until its length has been fixed up, growing the buffer if needed.
+  int _gzip_level;
+  char* _gzip_buffer;   // receives the compressed members
+  size_t _gzip_size;
+  julong _bytes_compressed; // number of uncompressed bytes written so far
+
   void set_file_descriptor(int fd)              { _fd = fd; }
   int file_descriptor() const                   { return _fd; }
 
@@ -407,9 +455,12 @@ class DumpWriter : public StackObj {
 
   // all I/O go through this function
   void write_internal(void* s, size_t len);
+  void write_to_file(const void* s, size_t len);
+  void close_on_error(const char* error);
+  bool grow_buffer(size_t min_size);
 
  public:
-  DumpWriter(const char* path);
+  DumpWriter(const char* path, bool rewrite_existing = false, int gzip_level = 0);
   ~DumpWriter();
 
   void close();
@@ -435,6 +486,24 @@ class DumpWriter : public StackObj {
   jlong current_offset();
   void seek_to_offset(jlong pos);
 
+  bool is_compressed() const            { return _gzip_level > 0; }
+  int gzip_level() const                { return _gzip_level; }
+
+  // true if the current segment of a compressed file takes up enough of
+  // the buffer to be ended at the next sub-record boundary
+  bool is_segment_buffer_full() const   { return is_compressed() && position() >= buffer_size() / 2; }
+
+  // true if len more bytes can be buffered without flushing
+  bool fits_in_buffer(size_t len) const { return position() + len < buffer_size(); }
+
+  // overwrites the u4 at the given offset of a compressed file, which
+  // must not have been flushed yet
+  void write_u4_at(jlong off, u4 x);
+
+  // appends the contents of the file at path as is, which must have been
+  // written with the same compression level
+  void append_file(const char* path);
+
   // writer functions
   void write_raw(void* s, size_t len);
   void write_u1(u1 x)                   { write_raw((void*)&x, 1); }
@@ -447,7 +516,7 @@ class DumpWriter : public StackObj {
   void write_id(u4 x);
 };
 
-DumpWriter::DumpWriter(const char* path) {
+DumpWriter::DumpWriter(const char* path, bool rewrite_existing, int gzip_level) {
   // try to allocate an I/O buffer of io_buffer_size. If there isn't
   // sufficient memory then reduce size until we can allocate something.
   _size = io_buffer_size;
@@ -462,11 +531,33 @@ DumpWriter::DumpWriter(const char* path) {
   _error = NULL;
   _bytes_written = 0L;
   _dump_start = (jlong)-1;
-  _fd = os::create_binary_file(path, false);    // don't replace existing file
+  _gzip_level = 0;
+  _gzip_buffer = NULL;
+  _gzip_size = 0;
+  _bytes_compressed = 0;
+  _fd = os::create_binary_file(path, rewrite_existing);
 
   // if the open failed we record the error
   if (_fd < 0) {
     _error = (char*)os::strdup(os::strerror(errno));
+    return;
+  }
+
+  if (gzip_level > 0) {
+    assert(GZipFully != NULL, "gzip library must be loaded");
+    if (_buffer == NULL) {
+      close_on_error("Unable to allocate the I/O buffer");
+      return;
+    }
+    // the compressed members are written from a buffer big enough to hold
+    // a member for a full (or, without a buffer, a single chunk of) input
+    _gzip_size = GZipBound(MAX2(_size, (size_t)io_buffer_size));
+    _gzip_buffer = (char*)os::malloc(_gzip_size, mtInternal);
+    if (_gzip_buffer == NULL) {
+      close_on_error("Unable to allocate the compression buffer");
+      return;
+    }
+    _gzip_level = gzip_level;
   }
 }
 
@@ -476,6 +567,7 @@ DumpWriter::~DumpWriter() {
     close();
   }
   if (_buffer != NULL) os::free(_buffer);
+  if (_gzip_buffer != NULL) os::free(_gzip_buffer);
   if (_error != NULL) os::free(_error);
 }
 
@@ -497,7 +589,7 @@ void DumpWriter::set_dump_start(jlong pos) {
 julong DumpWriter::current_record_length() {
   if (is_open()) {
     // calculate the size of the dump record
-    julong dump_end = bytes_written() + bytes_unwritten();
+    julong dump_end = is_compressed() ? (julong)current_offset() : bytes_written() + bytes_unwritten();
     assert(dump_end == (size_t)current_offset(), "checking");
     julong dump_len = dump_end - dump_start() - 4;
     return dump_len;
@@ -505,10 +597,52 @@ julong DumpWriter::current_record_length() {
   return 0;
 }
 
-// write directly to the file
+// records the error and closes the file
+void DumpWriter::close_on_error(const char* error) {
+  set_error(error);
+  os::close(file_descriptor());
+  set_file_descriptor(-1);
+}
+
+// grows the buffer of a compressed file to hold at least min_size bytes
+bool DumpWriter::grow_buffer(size_t min_size) {
+  size_t new_size = MAX2(2 * buffer_size(), min_size);
+  char* new_buffer = (char*)os::realloc(buffer(), new_size, mtInternal);
+  if (new_buffer == NULL) {
+    close_on_error("Unable to grow the I/O buffer");
+    return false;
+  }
+  _buffer = new_buffer;
+  _size = new_size;
+  return true;
+}
+
+// write directly to the file, compressing the bytes if requested
 void DumpWriter::write_internal(void* s, size_t len) {
+  if (!is_compressed()) {
+    write_to_file(s, len);
+    return;
+  }
+  _bytes_compressed += len;
+  char* pos = (char*)s;
+  while (is_open() && len > 0) {
+    // compress at most one buffer worth of input into each gzip member
+    size_t in_len = MIN2(len, (size_t)io_buffer_size);
+    char* msg = NULL;
+    size_t out_len = GZipFully(pos, in_len, _gzip_buffer, _gzip_size, _gzip_level, &msg);
+    if (out_len == 0) {
+      close_on_error(msg != NULL ? msg : "Compression failed");
+      return;
+    }
+    write_to_file(_gzip_buffer, out_len);
+    pos += in_len;
+    len -= in_len;
+  }
+}
+
+void DumpWriter::write_to_file(const void* s, size_t len) {
   if (is_open()) {
-    const char* pos = (char*)s;
+    const char* pos = (const char*)s;
     ssize_t n = 0;
     while (len > 0) {
       uint tmp = (uint)MIN2(len, (size_t)UINT_MAX);
@@ -516,9 +650,7 @@ void DumpWriter::write_internal(void* s, size_t len) {
 
       if (n < 0) {
         // EINTR cannot happen here, os::write will take care of that
-        set_error(os::strerror(errno));
-        os::close(file_descriptor());
-        set_file_descriptor(-1);
+        close_on_error(os::strerror(errno));
         return;
       }
 
@@ -532,9 +664,16 @@ void DumpWriter::write_internal(void* s, size_t len) {
 // write raw bytes
 void DumpWriter::write_raw(void* s, size_t len) {
   if (is_open()) {
-    // flush buffer to make room
+    // flush buffer to make room, unless it holds a compressed segment
+    // whose length is still to be fixed up
     if ((position() + len) >= buffer_size()) {
-      flush();
+      if (is_compressed() && dump_start() >= 0) {
+        if (!grow_buffer(position() + len + 1)) {
+          return;
+        }
+      } else {
+        flush();
+      }
     }
 
     // buffer not available or too big to buffer it
@@ -557,6 +696,10 @@ void DumpWriter::flush() {
 }
 
 jlong DumpWriter::current_offset() {
+  if (is_compressed()) {
+    // the offset into the uncompressed contents
+    return is_open() ? (jlong)(_bytes_compressed + position()) : (jlong)-1;
+  }
   if (is_open()) {
     // the offset is the file offset plus whatever we have buffered
     jlong offset = os::current_file_offset(file_descriptor());
@@ -569,6 +712,7 @@ jlong DumpWriter::current_offset() {
 
 void DumpWriter::seek_to_offset(jlong off) {
   assert(off >= 0, "bad offset");
+  assert(!is_compressed(), "cannot seek in compressed files");
 
   // need to flush before seeking
   flush();
@@ -580,6 +724,41 @@ void DumpWriter::seek_to_offset(jlong off) {
   }
 }
 
+void DumpWriter::write_u4_at(jlong off, u4 x) {
+  assert(is_compressed(), "use seek_to_offset for uncompressed files");
+  jlong pos = off - (jlong)_bytes_compressed;
+  assert(pos >= 0 && (size_t)pos + sizeof(u4) <= position(), "offset must be buffered");
+  Bytes::put_Java_u4((address)(buffer() + pos), x);
+}
+
+// appends the file at path, reading it through the internal buffer
+void DumpWriter::append_file(const char* path) {
+  flush();
+  if (!is_open()) {
+    return;
+  }
+  if (buffer() == NULL) {
+    close_on_error("No buffer available to merge the dump files");
+    return;
+  }
+  int fd = os::open(path, O_RDONLY | O_BINARY, 0);
+  if (fd < 0) {
+    close_on_error(os::strerror(errno));
+    return;
+  }
+  ssize_t n;
+  while ((n = os::read(fd, buffer(), (unsigned int)buffer_size())) > 0) {
+    write_to_file(buffer(), (size_t)n);
+    if (!is_open()) {
+      break;
+    }
+  }
+  if (n < 0 && is_open()) {
+    close_on_error(os::strerror(errno));
+  }
+  os::close(fd);
+}
+
 void DumpWriter::write_u2(u2 x) {
   u2 v;
   Bytes::put_Java_u2((address)&v, x);
@@ -681,9 +860,23 @@ class DumperSupport : AllStatic {
   // writes a HPROF_HEAP_DUMP_SEGMENT record
   static void write_dump_header(DumpWriter* writer);
 
+  // writes a HPROF_HEAP_DUMP_SEGMENT record of a known length
+  static void write_fixed_dump_header(DumpWriter* writer, u4 len);
+
   // fixes up the length of the current dump record
   static void write_current_dump_record_length(DumpWriter* writer);
 
+  // makes room in the buffer of a compressed dump for a sub-record of
+  // the given length
+  static void make_room_for_sub_record(DumpWriter* writer, size_t len);
+
+  // used on a sub-record boundary to start a new segment if the current
+  // one exceeds the threshold
+  static void check_segment_length(DumpWriter* writer);
+
+  // writes the HPROF_HEAP_DUMP_END record
+  static void write_dump_end(DumpWriter* writer);
+
   // fixes up the current dump record and writes HPROF_HEAP_DUMP_END record
   static void end_of_dump(DumpWriter* writer);
 
@@ -1139,6 +1332,10 @@ int DumperSupport::calculate_array_max_length(DumpWriter* writer, arrayOop array
     warning("cannot dump array of type %s[] with length %d; truncating to length %d",
             type2name_tab[type], array->length(), length);
   }
+
+  if (writer->is_compressed()) {
+    make_room_for_sub_record(writer, header_size + length_in_bytes);
+  }
   return length;
 }
 
@@ -1413,24 +1610,19 @@ class StickyClassDumper : public KlassClosure {
 };
 
 
-class VM_HeapDumper;
-
 // Support class using when iterating over the heap.
 
 class HeapObjectDumper : public ObjectClosure {
  private:
-  VM_HeapDumper* _dumper;
   DumpWriter* _writer;
 
-  VM_HeapDumper* dumper()               { return _dumper; }
   DumpWriter* writer()                  { return _writer; }
 
   // used to indicate that a record has been writen
   void mark_end_of_record();
 
  public:
-  HeapObjectDumper(VM_HeapDumper* dumper, DumpWriter* writer) {
-    _dumper = dumper;
+  HeapObjectDumper(DumpWriter* writer) {
     _writer = writer;
   }
 
@@ -1466,6 +1658,45 @@ void HeapObjectDumper::do_object(oop o) {
   }
 }
 
+// Gang task dumping the heap objects in parallel. Each worker writes its
+// objects as HPROF_HEAP_DUMP_SEGMENT records into a part file of its
+// own, compressed like the dump file, which is appended to the dump file
+// after the VM operation.
+
+class HeapDumpSegmentTask : public AbstractGangTask {
+ private:
+  ParallelObjectIterator* _poi;
+  const char* _path;
+  int _gzip_level;
+  char** _errors;   // per worker error message, NULL if none
+
+ public:
+  HeapDumpSegmentTask(ParallelObjectIterator* poi, const char* path, int gzip_level, char** errors) :
+      AbstractGangTask("Heap Dump Segments"),
+      _poi(poi), _path(path), _gzip_level(gzip_level), _errors(errors) {}
+
+  virtual void work(uint worker_id) {
+    ResourceMark rm;
+    char* part_path = dump_part_path(_path, worker_id + 1);
+    if (part_path == NULL) {
+      _errors[worker_id] = os::strdup("Out of system memory");
+      return;
+    }
+    DumpWriter writer(part_path, true /* rewrite_existing */, _gzip_level);
+    os::free(part_path);
+    if (writer.is_open()) {
+      DumperSupport::write_dump_header(&writer);
+      HeapObjectDumper obj_dumper(&writer);
+      _poi->object_iterate(&obj_dumper, worker_id);
+      DumperSupport::write_current_dump_record_length(&writer);
+      writer.close();
+    }
+    if (writer.error() != NULL) {
+      _errors[worker_id] = os::strdup(writer.error());
+    }
+  }
+};
+
 // The VM operation that performs the heap dump
 class VM_HeapDumper : public VM_GC_Operation {
  private:
@@ -1478,6 +1709,10 @@ class VM_HeapDumper : public VM_GC_Operation {
   GrowableArray<Klass*>* _klass_map;
   ThreadStackTrace** _stack_traces;
   int _num_threads;
+  const char* _path;            // dump file, prefix of the segment part files
+  uint _num_dump_threads;       // requested number of dump threads, 0 lets the VM decide
+  uint _num_segments;           // number of segment part files written
+  char* _segment_error;         // first error writing a segment part file
 
   // accessors and setters
   static VM_HeapDumper* dumper()         {  assert(_global_dumper != NULL, "Error"); return _global_dumper; }
@@ -1518,8 +1753,14 @@ class VM_HeapDumper : public VM_GC_Operation {
   // HPROF_TRACE and HPROF_FRAME records
   void dump_stack_traces();
 
+  // HPROF_GC_INSTANCE_DUMP, HPROF_GC_OBJ_ARRAY_DUMP and HPROF_GC_PRIM_ARRAY_DUMP
+  // records, written into segment part files if the heap supports it
+  void dump_objects();
+  bool dump_objects_parallel();
+
  public:
-  VM_HeapDumper(DumpWriter* writer, bool gc_before_heap_dump, bool oome) :
+  VM_HeapDumper(DumpWriter* writer, const char* path, bool gc_before_heap_dump, bool oome,
+                uint num_dump_threads) :
     VM_GC_Operation(0 /* total collections,      dummy, ignored */,
                     GCCause::_heap_dump /* GC Cause */,
                     0 /* total full collections, dummy, ignored */,
@@ -1529,6 +1770,10 @@ class VM_HeapDumper : public VM_GC_Operation {
     _klass_map = new (ResourceObj::C_HEAP, mtInternal) GrowableArray<Klass*>(INITIAL_CLASS_COUNT, true);
     _stack_traces = NULL;
     _num_threads = 0;
+    _path = path;
+    _num_dump_threads = num_dump_threads;
+    _num_segments = 0;
+    _segment_error = NULL;
     if (oome) {
       assert(!Thread::current()->is_VM_thread(), "Dump from OutOfMemoryError cannot be called by the VMThread");
       // get OutOfMemoryError zero-parameter constructor
@@ -1550,12 +1795,18 @@ class VM_HeapDumper : public VM_GC_Operation {
       FREE_C_HEAP_ARRAY(ThreadStackTrace*, _stack_traces);
     }
     delete _klass_map;
+    if (_segment_error != NULL) {
+      os::free(_segment_error);
+    }
   }
 
   VMOp_Type type() const { return VMOp_HeapDumper; }
-  // used to mark sub-record boundary
-  void check_segment_length();
   void doit();
+
+  // number of segment part files to append to the dump file, in which
+  // case doit() has not yet written the HPROF_HEAP_DUMP_END record
+  uint num_segments() const      { return _num_segments; }
+  const char* segment_error() const { return _segment_error; }
 };
 
 VM_HeapDumper* VM_HeapDumper::_global_dumper = NULL;
@@ -1568,6 +1819,10 @@ bool VM_HeapDumper::skip_operation() const {
  // writes a HPROF_HEAP_DUMP_SEGMENT record
 void DumperSupport::write_dump_header(DumpWriter* writer) {
   if (writer->is_open()) {
+    if (writer->is_compressed()) {
+      // start the segment, which is fixed up in the buffer, at its beginning
+      writer->flush();
+    }
     writer->write_u1(HPROF_HEAP_DUMP_SEGMENT);
     writer->write_u4(0); // current ticks
 
@@ -1577,6 +1832,15 @@ void DumperSupport::write_dump_header(DumpWriter* writer) {
   }
 }
 
+// writes a HPROF_HEAP_DUMP_SEGMENT record that needs no fix up
+void DumperSupport::write_fixed_dump_header(DumpWriter* writer, u4 len) {
+  if (writer->is_open()) {
+    writer->write_u1(HPROF_HEAP_DUMP_SEGMENT);
+    writer->write_u4(0); // current ticks
+    writer->write_u4(len);
+  }
+}
+
 // fixes up the length of the current dump record
 void DumperSupport::write_current_dump_record_length(DumpWriter* writer) {
   if (writer->is_open()) {
@@ -1588,8 +1852,17 @@ void DumperSupport::write_current_dump_record_length(DumpWriter* writer) {
       warning("record is too large");
     }
 
-    // seek to the dump start and fix-up the length
     assert(writer->dump_start() >= 0, "no dump start recorded");
+    if (writer->is_compressed()) {
+      // the segment is still buffered, fix up the length there and
+      // compress the segment
+      writer->write_u4_at(writer->dump_start(), (u4)dump_len);
+      writer->set_dump_start((jlong)-1);
+      writer->flush();
+      return;
+    }
+
+    // seek to the dump start and fix-up the length
     writer->seek_to_offset(writer->dump_start());
     writer->write_u4((u4)dump_len);
 
@@ -1606,31 +1879,60 @@ void DumperSupport::write_current_dump_record_length(DumpWriter* writer) {
 
 // used on a sub-record boundary to check if we need to start a
 // new segment.
-void VM_HeapDumper::check_segment_length() {
-  if (writer()->is_open()) {
-    julong dump_len = writer()->current_record_length();
+void DumperSupport::check_segment_length(DumpWriter* writer) {
+  if (writer->is_open()) {
+    if (writer->dump_start() < 0) {
+      // the last sub-record was written in a segment of its own
+      write_dump_header(writer);
+      return;
+    }
+    julong dump_len = writer->current_record_length();
 
-    if (dump_len > 2UL*G) {
-      DumperSupport::write_current_dump_record_length(writer());
-      DumperSupport::write_dump_header(writer());
+    if (dump_len > 2UL*G || writer->is_segment_buffer_full()) {
+      write_current_dump_record_length(writer);
+      write_dump_header(writer);
     }
   }
 }
 
-// fixes up the current dump record and writes HPROF_HEAP_DUMP_END record
-void DumperSupport::end_of_dump(DumpWriter* writer) {
-  if (writer->is_open()) {
-    write_current_dump_record_length(writer);
+// The segments of a compressed dump are fixed up in the buffer, which is
+// grown rather than flushed while a segment is written. Ends the current
+// segment if the sub-record does not fit into the rest of the buffer, and
+// writes a sub-record too large for the buffer into a segment of its own.
+void DumperSupport::make_room_for_sub_record(DumpWriter* writer, size_t len) {
+  if (!writer->is_open() || writer->fits_in_buffer(len)) {
+    return;
+  }
+  write_current_dump_record_length(writer);
+  // sizeof(u1) + 2 * sizeof(u4)
+  if (writer->fits_in_buffer(1 + 2 * 4 + len)) {
+    write_dump_header(writer);
+  } else {
+    // the next sub-record boundary starts a new segment
+    write_fixed_dump_header(writer, (u4)len);
+  }
+}
 
+// writes the HPROF_HEAP_DUMP_END record
+void DumperSupport::write_dump_end(DumpWriter* writer) {
+  if (writer->is_open()) {
     writer->write_u1(HPROF_HEAP_DUMP_END);
     writer->write_u4(0);
     writer->write_u4(0);
   }
 }
 
+// fixes up the current dump record and writes HPROF_HEAP_DUMP_END record
+void DumperSupport::end_of_dump(DumpWriter* writer) {
+  if (writer->is_open()) {
+    write_current_dump_record_length(writer);
+    write_dump_end(writer);
+  }
+}
+
 // marks sub-record boundary
 void HeapObjectDumper::mark_end_of_record() {
-  dumper()->check_segment_length();
+  DumperSupport::check_segment_length(writer());
 }
 
 // writes a HPROF_LOAD_CLASS record for the class (and each of its
@@ -1670,6 +1972,7 @@ void VM_HeapDumper::do_load_class(Klass* k) {
 void VM_HeapDumper::do_class_dump(Klass* k) {
   if (k->is_instance_klass()) {
     DumperSupport::dump_class_and_array_classes(writer(), k);
+    DumperSupport::check_segment_length(writer());
   }
 }
 
@@ -1873,7 +2176,7 @@ void VM_HeapDumper::doit() {
     ClassLoaderDataGraph::classes_do(&locked_dump_class);
   }
   Universe::basic_type_classes_do(&do_basic_type_array_class_dump);
-  check_segment_length();
+  DumperSupport::check_segment_length(writer());
 
   // writes HPROF_GC_INSTANCE_DUMP records.
   // After each sub-record is written check_segment_length will be invoked
@@ -1881,24 +2184,23 @@ void VM_HeapDumper::doit() {
   // segment is started.
   // The HPROF_GC_CLASS_DUMP and HPROF_GC_INSTANCE_DUMP are the vast bulk
   // of the heap dump.
-  HeapObjectDumper obj_dumper(this, writer());
-  Universe::heap()->object_iterate(&obj_dumper);
+  dump_objects();
 
   // HPROF_GC_ROOT_THREAD_OBJ + frames + jni locals
   do_threads();
-  check_segment_length();
+  DumperSupport::check_segment_length(writer());
 
   // HPROF_GC_ROOT_MONITOR_USED
   MonitorUsedDumper mon_dumper(writer());
   ObjectSynchronizer::oops_do(&mon_dumper);
-  check_segment_length();
+  DumperSupport::check_segment_length(writer());
 
   // HPROF_GC_ROOT_JNI_GLOBAL
   JNIGlobalsDumper jni_dumper(writer());
   JNIHandles::oops_do(&jni_dumper);
   Universe::oops_do(&jni_dumper);  // technically not jni roots, but global roots
                                    // for things like preallocated throwable backtraces
-  check_segment_length();
+  DumperSupport::check_segment_length(writer());
 
   // HPROF_GC_ROOT_STICKY_CLASS
   // These should be classes in the NULL class loader data, and not all classes
@@ -1906,14 +2208,70 @@ void VM_HeapDumper::doit() {
   StickyClassDumper class_dumper(writer());
   ClassLoaderData::the_null_class_loader_data()->classes_do(&class_dumper);
 
-  // fixes up the length of the dump record and writes the HPROF_HEAP_DUMP_END record.
-  DumperSupport::end_of_dump(writer());
+  if (_num_segments == 0) {
+    // fixes up the length of the dump record and writes the HPROF_HEAP_DUMP_END record.
+    DumperSupport::end_of_dump(writer());
+  } else {
+    // the HPROF_HEAP_DUMP_END record follows the segment part files,
+    // which are appended by HeapDumper::dump()
+    DumperSupport::write_current_dump_record_length(writer());
+  }
 
   // Now we clear the global variables, so that a future dumper might run.
   clear_global_dumper();
   clear_global_writer();
 }
 
+void VM_HeapDumper::dump_objects() {
+  if (!dump_objects_parallel()) {
+    HeapObjectDumper obj_dumper(writer());
+    Universe::heap()->object_iterate(&obj_dumper);
+  }
+}
+
+// Dumps the objects into segment part files using the safepoint workers of
+// the GC. The part files are merged into the dump file once the VM operation
+// is done, outside of the safepoint unless the dump was requested by the VM
+// thread. Returns false if the heap does not support parallel iteration, or
+// only a single thread was requested.
+bool VM_HeapDumper::dump_objects_parallel() {
+  CollectedHeap* ch = Universe::heap();
+  WorkGang* gang = ch->get_safepoint_workers();
+  if (gang == NULL || _num_dump_threads == 1 || _path == NULL) {
+    return false;
+  }
+  uint num_threads = (_num_dump_threads == 0) ? gang->active_workers()
+                                              : MIN2(_num_dump_threads, gang->total_workers());
+  if (num_threads <= 1) {
+    return false;
+  }
+  ParallelObjectIterator* poi = ch->parallel_object_iterator(num_threads);
+  if (poi == NULL) {
+    return false;
+  }
+
+  char** errors = NEW_C_HEAP_ARRAY(char*, num_threads, mtInternal);
+  for (uint i = 0; i < num_threads; i++) {
+    errors[i] = NULL;
+  }
+  HeapDumpSegmentTask task(poi, _path, writer()->gzip_level(), errors);
+  gang->run_task(&task, num_threads);
+  delete poi;
+
+  _num_segments = num_threads;
+  for (uint i = 0; i < num_threads; i++) {
+    if (errors[i] != NULL) {
+      if (_segment_error == NULL) {
+        _segment_error = errors[i];
+      } else {
+        os::free(errors[i]);
+      }
+    }
+  }
+  FREE_C_HEAP_ARRAY(char*, errors);
+  return true;
+}
+
 void VM_HeapDumper::dump_stack_traces() {
   // write a HPROF_TRACE record without any frames to be referenced as object alloc sites
   DumperSupport::write_header(writer(), HPROF_TRACE, 3*sizeof(u4));
@@ -1968,9 +2326,25 @@ void VM_HeapDumper::dump_stack_traces() {
   }
 }
 
+// Appends the segment part files of the dump to writer, removing them, and
+// terminates the dump with a HPROF_HEAP_DUMP_END record.
+static void merge_dump_segments(DumpWriter* writer, const char* path, uint num_segments) {
+  for (uint i = 1; i <= num_segments; i++) {
+    char* part_path = dump_part_path(path, i);
+    if (part_path == NULL) {
+      continue;
+    }
+    writer->append_file(part_path);
+    remove(part_path);
+    os::free(part_path);
+  }
+  DumperSupport::write_dump_end(writer);
+}
+
 // dump the heap to given path.
-int HeapDumper::dump(const char* path, outputStream* out) {
+int HeapDumper::dump(const char* path, outputStream* out, int compression, uint num_dump_threads) {
   assert(path != NULL && strlen(path) > 0, "path missing");
+  assert(compression >= 0 && compression <= 9, "invalid compression level");
 
   // print message in interactive case
   if (out != NULL) {
@@ -1978,8 +2352,16 @@ int HeapDumper::dump(const char* path, outputStream* out) {
     timer()->start();
   }
 
+  if (compression > 0 && !load_gzip_library()) {
+    set_error((char*)"gzip compression is not available");
+    if (out != NULL) {
+      out->print_cr("Unable to create %s: %s", path, error());
+    }
+    return -1;
+  }
+
   // create the dump writer. If the file can be opened then bail
-  DumpWriter writer(path);
+  DumpWriter writer(path, false /* rewrite_existing */, compression);
   if (!writer.is_open()) {
     set_error(writer.error());
     if (out != NULL) {
@@ -1990,7 +2372,7 @@ int HeapDumper::dump(const char* path, outputStream* out) {
   }
 
   // generate the dump
-  VM_HeapDumper dumper(&writer, _gc_before_heap_dump, _oome);
+  VM_HeapDumper dumper(&writer, path, _gc_before_heap_dump, _oome, num_dump_threads);
   if (Thread::current()->is_VM_thread()) {
     assert(SafepointSynchronize::is_at_safepoint(), "Expected to be called at a safepoint");
     dumper.doit();
@@ -1998,9 +2380,16 @@ int HeapDumper::dump(const char* path, outputStream* out) {
     VMThread::execute(&dumper);
   }
 
+  if (dumper.num_segments() > 0) {
+    merge_dump_segments(&writer, path, dumper.num_segments());
+  }
+
   // close dump file and record any error that the writer may have encountered
   writer.close();
   set_error(writer.error());
+  if (error() == NULL && dumper.segment_error() != NULL) {
+    set_error((char*)dumper.segment_error());
+  }
 
   // print message in interactive case
   if (out != NULL) {
@@ -2009,11 +2398,11 @@ int HeapDumper::dump(const char* path, outputStream* out) {
       out->print_cr("Heap dump file created [" JULONG_FORMAT " bytes in %3.3f secs]",
                     writer.bytes_written(), timer()->seconds());
     } else {
-      out->print_cr("Dump file is incomplete: %s", writer.error());
+      out->print_cr("Dump file is incomplete: %s", error());
     }
   }
 
-  return (writer.error() == NULL) ? 0 : -1;
+  return (error() == NULL) ? 0 : -1;
 }
 
 // stop timer (if still active), and free any error string we might be holding
@@ -2071,7 +2460,7 @@ void HeapDumper::dump_heap(bool oome) {
   const int max_digit_chars = 20;
 
   const char* dump_file_name = "java_pid";
-  const char* dump_file_ext  = ".hprof";
+  const char* dump_file_ext  = (HeapDumpGzipLevel > 0) ? ".hprof.gz" : ".hprof";
 
   // The dump file defaults to java_pid<pid>.hprof in the current working
   // directory. HeapDumpPath=<file> can be used to specify an alternative
@@ -2138,6 +2527,6 @@ void HeapDumper::dump_heap(bool oome) {
 
   HeapDumper dumper(false /* no GC before heap dump */,
                     oome  /* pass along out-of-memory-error flag */);
-  dumper.dump(my_path, tty);
+  dumper.dump(my_path, tty, (int)HeapDumpGzipLevel);
   os::free(my_path);
 }
@@ -70,7 +70,10 @@ class HeapDumper : public StackObj {
 
   // dumps the heap to the specified file, returns 0 if success.
   // additional info is written to out if not NULL.
-  int dump(const char* path, outputStream* out = NULL);
+  // compression > 0 creates a gzipped file with the given compression level.
+  // num_dump_threads > 1 dumps the heap objects in parallel, if supported
+  // by the heap, and 0 lets the VM choose the number of threads.
+  int dump(const char* path, outputStream* out = NULL, int compression = 0, uint num_dump_threads = 0);
 
   // returns error message (resource allocated), or NULL if no error
   char* error_as_C_string() const;
@@ -22,6 +22,7 @@
  *
  */
 #include "precompiled.hpp"
+#include "memory/arena.hpp"
 
 #include "services/mallocSiteTable.hpp"
 #include "services/mallocTracker.hpp"
@@ -36,10 +37,21 @@ size_t MallocMemorySnapshot::total() const {
   for (int index = 0; index < mt_number_of_types; index ++) {
     amount += _malloc[index].malloc_size();
   }
-  amount += _tracking_header.size() + total_arena();
+  amount += _malloc_overhead + total_arena();
   return amount;
 }
 
+size_t MallocMemorySnapshot::compute_malloc_overhead() const {
+  size_t count = 0;
+  for (int index = 0; index < mt_number_of_types; index ++) {
+    // Thread stacks are recorded as malloc'd memory, but without a header
+    if (index != NMTUtil::flag_to_index(mtThreadStack)) {
+      count += _malloc[index].malloc_count();
+    }
+  }
+  return count * sizeof(MallocHeader);
+}
+
 // Total malloc'd memory used by arenas
 size_t MallocMemorySnapshot::total_arena() const {
   size_t amount = 0;
@@ -50,9 +62,13 @@ size_t MallocMemorySnapshot::total_arena() const {
 }
 
 // Make adjustment by subtracting chunks used by arenas
-// from total chunks to get total free chunk size
+// from total chunks to get total free chunk size. Mapped chunks
+// are not malloc'ed and are left out.
 void MallocMemorySnapshot::make_adjustment() {
   size_t arena_size = total_arena();
+  size_t mapped_length = Chunk::mapped_length();
+  // A mapped chunk is accounted before the arena grows by it.
+  arena_size = arena_size > mapped_length ? arena_size - mapped_length : 0;
   int chunk_idx = NMTUtil::flag_to_index(mtChunk);
   _malloc[chunk_idx].record_free(arena_size);
 }
@@ -69,7 +85,6 @@ void MallocHeader::release() const {
   if (MemTracker::tracking_level() <= NMT_minimal) return;
 
   MallocMemorySummary::record_free(size(), flags());
-  MallocMemorySummary::record_free_malloc_header(sizeof(MallocHeader));
   if (MemTracker::tracking_level() == NMT_detail) {
     MallocSiteTable::deallocation_at(size(), _bucket_idx, _pos_idx);
   }
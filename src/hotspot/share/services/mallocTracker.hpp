@@ -136,10 +136,17 @@ class MallocMemorySnapshot : public ResourceObj {
 
  private:
   MallocMemory      _malloc[mt_number_of_types];
-  MemoryCounter     _tracking_header;
+  // Memory used by the malloc tracking headers, as of the last copy_to().
+  // The headers all have the same size, so rather than update another
+  // counter shared by every malloc and free, their memory is derived from
+  // the malloc counts when a snapshot is taken.
+  size_t            _malloc_overhead;
 
+  size_t compute_malloc_overhead() const;
 
  public:
+  MallocMemorySnapshot() : _malloc_overhead(0) { }
+
   inline MallocMemory*  by_type(MEMFLAGS flags) {
     int index = NMTUtil::flag_to_index(flags);
     return &_malloc[index];
@@ -151,8 +158,8 @@ class MallocMemorySnapshot : public ResourceObj {
     return &_malloc[index];
   }
 
-  inline MemoryCounter* malloc_overhead() {
-    return &_tracking_header;
+  inline size_t malloc_overhead() const {
+    return _malloc_overhead;
   }
 
   // Total malloc'd memory amount
@@ -170,10 +177,10 @@ class MallocMemorySnapshot : public ResourceObj {
     // copy is going on, because their size is adjusted using this
     // buffer in make_adjustment().
     ThreadCritical tc;
-    s->_tracking_header = _tracking_header;
     for (int index = 0; index < mt_number_of_types; index ++) {
       s->_malloc[index] = _malloc[index];
     }
+    s->_malloc_overhead = s->compute_malloc_overhead();
   }
 
   // Make adjustment by subtracting chunks used by arenas
@@ -217,18 +224,9 @@ class MallocMemorySummary : AllStatic {
      s->make_adjustment();
    }
 
-   // Record memory used by malloc tracking header
-   static inline void record_new_malloc_header(size_t sz) {
-     as_snapshot()->malloc_overhead()->allocate(sz);
-   }
-
-   static inline void record_free_malloc_header(size_t sz) {
-     as_snapshot()->malloc_overhead()->deallocate(sz);
-   }
-
    // The memory used by malloc tracking headers
    static inline size_t tracking_overhead() {
-     return as_snapshot()->malloc_overhead()->size();
+     return as_snapshot()->compute_malloc_overhead();
    }
 
   static MallocMemorySnapshot* as_snapshot() {
@@ -283,7 +281,6 @@ class MallocHeader {
     }
 
     MallocMemorySummary::record_malloc(size, flags);
-    MallocMemorySummary::record_new_malloc_header(sizeof(MallocHeader));
   }
 
   inline size_t   size()  const { return _size; }
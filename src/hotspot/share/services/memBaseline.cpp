@@ -25,10 +25,12 @@
 
 #include "classfile/classLoaderDataGraph.inline.hpp"
 #include "memory/allocation.hpp"
+#include "memory/resourceArea.hpp"
 #include "runtime/safepoint.hpp"
 #include "runtime/thread.inline.hpp"
 #include "services/memBaseline.hpp"
 #include "services/memTracker.hpp"
+#include "utilities/resourceHash.hpp"
 
 /*
  * Sizes are sorted in descenting order for reporting
@@ -119,14 +121,21 @@ class VirtualMemoryAllocationWalker : public VirtualMemoryWalker {
  private:
   SortedLinkedList<ReservedMemoryRegion, compare_virtual_memory_base>
                 _virtual_memory_regions;
+  LinkedListNode<ReservedMemoryRegion>* _tail;
   size_t        _count;
 
  public:
-  VirtualMemoryAllocationWalker() : _count(0) { }
+  VirtualMemoryAllocationWalker() : _tail(NULL), _count(0) { }
 
   bool do_allocation_site(const ReservedMemoryRegion* rgn)  {
     if (rgn->size() >= MemBaseline::SIZE_THRESHOLD) {
-      if (_virtual_memory_regions.add(*rgn) != NULL) {
+      // The regions are walked in base address order, so append them
+      // at the tail rather than search for their position in the list.
+      assert(_tail == NULL || compare_virtual_memory_base(*_tail->peek(), *rgn) < 0, "Out of order");
+      LinkedListNode<ReservedMemoryRegion>* node = (_tail == NULL) ?
+        _virtual_memory_regions.add(*rgn) : _virtual_memory_regions.insert_after(*rgn, _tail);
+      if (node != NULL) {
+        _tail = node;
         _count ++;
         return true;
       } else {
@@ -210,20 +219,37 @@ int compare_allocation_site(const VirtualMemoryAllocationSite& s1,
   return s1.call_stack()->compare(*s2.call_stack());
 }
 
+unsigned call_stack_hash(const NativeCallStack* const& stack) {
+  return stack->hash();
+}
+
+bool call_stack_equals(const NativeCallStack* const& s1, const NativeCallStack* const& s2) {
+  return s1->equals(*s2);
+}
+
 bool MemBaseline::aggregate_virtual_memory_allocation_sites() {
   SortedLinkedList<VirtualMemoryAllocationSite, compare_allocation_site> allocation_sites;
 
+  // Index the sites by call stack, so that every region does not have
+  // to search the list of sites collected so far.
+  ResourceMark rm;
+  ResourceHashtable<const NativeCallStack*, VirtualMemoryAllocationSite*,
+                    call_stack_hash, call_stack_equals, 1031> sites_by_stack;
+
   VirtualMemoryAllocationIterator itr = virtual_memory_allocations();
   const ReservedMemoryRegion* rgn;
   VirtualMemoryAllocationSite* site;
   while ((rgn = itr.next()) != NULL) {
-    VirtualMemoryAllocationSite tmp(*rgn->call_stack(), rgn->flag());
-    site = allocation_sites.find(tmp);
-    if (site == NULL) {
+    VirtualMemoryAllocationSite** found = sites_by_stack.get(rgn->call_stack());
+    if (found != NULL) {
+      site = *found;
+    } else {
+      VirtualMemoryAllocationSite tmp(*rgn->call_stack(), rgn->flag());
       LinkedListNode<VirtualMemoryAllocationSite>* node =
         allocation_sites.add(tmp);
       if (node == NULL) return false;
       site = node->data();
+      sites_by_stack.put(site->call_stack(), site);
     }
     site->reserve_memory(rgn->size());
     site->commit_memory(rgn->committed_size());
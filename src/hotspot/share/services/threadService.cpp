@@ -355,6 +355,40 @@ void ThreadService::reset_contention_time_stat(JavaThread* thread) {
   }
 }
 
+// Returns false if no deadlock can possibly be found by
+// find_deadlocks_at_safepoint(), without requiring a safepoint.
+// A deadlock involves at least one thread blocked on an ObjectMonitor
+// (whose owner may not be findable), or at least two threads blocked on
+// raw monitors or on JSR-166 synchronizers owned by another thread.
+// Threads that are deadlocked stay blocked, so a deadlock that exists
+// now cannot be missed by racing with threads that are making progress.
+bool ThreadService::may_have_deadlocks(ThreadsList * t_list, bool concurrent_locks) {
+  Klass* aos_klass = SystemDictionary::java_util_concurrent_locks_AbstractOwnableSynchronizer_klass();
+  int blocked_on_other = 0;
+  JavaThreadIterator jti(t_list);
+  for (JavaThread* jt = jti.first(); jt != NULL; jt = jti.next()) {
+    if (jt->current_pending_monitor() != NULL) {
+      return true;
+    }
+    if (jt->current_pending_raw_monitor() != NULL) {
+      blocked_on_other++;
+    } else if (concurrent_locks) {
+      oop blocker = jt->current_park_blocker();
+      if (blocker != NULL && (aos_klass == NULL || blocker->is_a(aos_klass))) {
+        oop owner = (aos_klass == NULL) ? (oop)NULL :
+          java_util_concurrent_locks_AbstractOwnableSynchronizer::get_owner_threadObj(blocker);
+        if (aos_klass == NULL || (owner != NULL && owner != jt->threadObj())) {
+          blocked_on_other++;
+        }
+      }
+    }
+    if (blocked_on_other > 1) {
+      return true;
+    }
+  }
+  return false;
+}
+
 // Find deadlocks involving raw monitors, object monitors and concurrent locks
 // if concurrent_locks is true.
 DeadlockCycle* ThreadService::find_deadlocks_at_safepoint(ThreadsList * t_list, bool concurrent_locks) {
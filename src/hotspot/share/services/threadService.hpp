@@ -112,6 +112,8 @@ public:
   static void   reset_contention_time_stat(JavaThread* thread);
 
   static DeadlockCycle*       find_deadlocks_at_safepoint(ThreadsList * t_list, bool object_monitors_only);
+  // Concurrent pre-check for find_deadlocks_at_safepoint().
+  static bool                 may_have_deadlocks(ThreadsList * t_list, bool concurrent_locks);
 
   // GC support
   static void   oops_do(OopClosure* f);
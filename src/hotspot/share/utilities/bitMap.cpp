@@ -29,6 +29,7 @@
 #include "utilities/bitMap.inline.hpp"
 #include "utilities/copy.hpp"
 #include "utilities/debug.hpp"
+#include "utilities/population_count.hpp"
 
 STATIC_ASSERT(sizeof(BitMap::bm_word_t) == BytesPerWord); // "Implementation assumption."
 
@@ -631,52 +632,46 @@ bool BitMap::iterate(BitMapClosure* blk, idx_t leftOffset, idx_t rightOffset) {
   return true;
 }
 
-const BitMap::idx_t* BitMap::_pop_count_table = NULL;
-
-void BitMap::init_pop_count_table() {
-  if (_pop_count_table == NULL) {
-    BitMap::idx_t *table = NEW_C_HEAP_ARRAY(idx_t, 256, mtInternal);
-    for (uint i = 0; i < 256; i++) {
-      table[i] = num_set_bits(i);
-    }
-
-    if (!Atomic::replace_if_null(&_pop_count_table, table)) {
-      guarantee(_pop_count_table != NULL, "invariant");
-      FREE_C_HEAP_ARRAY(idx_t, table);
-    }
-  }
+// Counts a whole word at a time instead of looking up each byte in a table.
+BitMap::idx_t BitMap::count_one_bits_in_word(bm_word_t w) {
+  idx_t bits = population_count((uint32_t)w);
+#ifdef _LP64
+  bits += population_count((uint32_t)(w >> 32));
+#endif
+  return bits;
 }
 
-BitMap::idx_t BitMap::num_set_bits(bm_word_t w) {
-  idx_t bits = 0;
-
-  while (w != 0) {
-    while ((w & 1) == 0) {
-      w >>= 1;
-    }
-    bits++;
-    w >>= 1;
+BitMap::idx_t BitMap::count_one_bits_within_word(idx_t beg, idx_t end) const {
+  if (beg != end) {
+    bm_word_t mask = ~inverted_bit_mask_for_range(beg, end);
+    return count_one_bits_in_word(map(word_index(beg)) & mask);
   }
-  return bits;
+  return 0;
 }
 
-BitMap::idx_t BitMap::num_set_bits_from_table(unsigned char c) {
-  assert(_pop_count_table != NULL, "precondition");
-  return _pop_count_table[c];
+BitMap::idx_t BitMap::count_one_bits() const {
+  return count_one_bits(0, size());
 }
 
-BitMap::idx_t BitMap::count_one_bits() const {
-  init_pop_count_table(); // If necessary.
-  idx_t sum = 0;
-  typedef unsigned char uchar;
-  for (idx_t i = 0; i < size_in_words(); i++) {
-    bm_word_t w = map()[i];
-    for (size_t j = 0; j < sizeof(bm_word_t); j++) {
-      sum += num_set_bits_from_table(uchar(w & 255));
-      w >>= 8;
+BitMap::idx_t BitMap::count_one_bits(idx_t beg, idx_t end) const {
+  verify_range(beg, end);
+
+  idx_t beg_full_word = word_index_round_up(beg);
+  idx_t end_full_word = word_index(end);
+
+  if (beg_full_word < end_full_word) {
+    // The range includes at least one full word.
+    idx_t sum = count_one_bits_within_word(beg, bit_index(beg_full_word));
+    for (idx_t i = beg_full_word; i < end_full_word; i++) {
+      sum += count_one_bits_in_word(map(i));
     }
+    return sum + count_one_bits_within_word(bit_index(end_full_word), end);
+  } else {
+    // The range spans at most 2 partial words.
+    idx_t boundary = MIN2(bit_index(beg_full_word), end);
+    return count_one_bits_within_word(beg, boundary) +
+           count_one_bits_within_word(boundary, end);
   }
-  return sum;
 }
 
 void BitMap::print_on_error(outputStream* st, const char* prefix) const {
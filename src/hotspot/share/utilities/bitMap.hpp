@@ -134,10 +134,8 @@ class BitMap {
   void verify_range(idx_t beg_index, idx_t end_index) const NOT_DEBUG_RETURN;
 
   // Statistics.
-  static const idx_t* _pop_count_table;
-  static void init_pop_count_table();
-  static idx_t num_set_bits(bm_word_t w);
-  static idx_t num_set_bits_from_table(unsigned char c);
+  static idx_t count_one_bits_in_word(bm_word_t w);
+  idx_t count_one_bits_within_word(idx_t beg, idx_t end) const;
 
   // Allocation Helpers.
 
@@ -293,6 +291,9 @@ class BitMap {
   // Returns the number of bits set in the bitmap.
   idx_t count_one_bits() const;
 
+  // Returns the number of bits set within [beg, end).
+  idx_t count_one_bits(idx_t beg, idx_t end) const;
+
   // Set operations.
   void set_union(const BitMap& bits);
   void set_difference(const BitMap& bits);
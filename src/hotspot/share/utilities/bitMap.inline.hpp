@@ -210,6 +210,12 @@ inline BitMap::idx_t BitMap::get_next_bit_impl(idx_t l_index, idx_t r_index) con
       idx_t limit = aligned_right
         ? word_index(r_index)
         : (word_index(r_index - 1) + 1); // Align up, knowing r_index > 0.
+      // Sparse maps have long runs of uninteresting words; test them two
+      // at a time to halve the number of loop branches on such runs.
+      while ((index + 2 < limit) &&
+             (((map(index + 1) ^ flip) | (map(index + 2) ^ flip)) == 0)) {
+        index += 2;
+      }
       while (++index < limit) {
         cword = map(index) ^ flip;
         if (cword != 0) {
@@ -319,6 +319,12 @@ class ConcurrentHashTable : public CHeapObj<F> {
   bool internal_insert(Thread* thread, LOOKUP_FUNC& lookup_f, const VALUE& value,
                        bool* grow_hint, bool* clean_hint);
 
+  // Inserts several values in one critical section.
+  template <typename LOOKUP_FUNC>
+  size_t internal_insert_batch(Thread* thread, LOOKUP_FUNC* lookups,
+                               const VALUE* values, size_t count,
+                               bool* inserted, bool* grow_hint);
+
   // Returns true if an item matching LOOKUP_FUNC is removed.
   // Calls DELETE_FUNC before destroying the node.
   template <typename LOOKUP_FUNC, typename DELETE_FUNC>
@@ -415,6 +421,20 @@ class ConcurrentHashTable : public CHeapObj<F> {
     return internal_insert(thread, lookup_f, value, grow_hint, clean_hint);
   }
 
+  // Inserts values[i] using lookups[i] for 0 <= i < count, with a single
+  // critical section for the whole batch instead of one per value. A value
+  // whose bucket is concurrently updated or resized is retried with a plain
+  // insert. If inserted is not NULL inserted[i] is set to true if values[i]
+  // was inserted and false if a duplicate was found. Returns the number of
+  // inserted values.
+  template <typename LOOKUP_FUNC>
+  size_t insert_batch(Thread* thread, LOOKUP_FUNC* lookups, const VALUE* values,
+                      size_t count, bool* inserted = NULL,
+                      bool* grow_hint = NULL) {
+    return internal_insert_batch(thread, lookups, values, count, inserted,
+                                 grow_hint);
+  }
+
   // This does a fast unsafe insert and can thus only be used when there is no
   // risk for a duplicates and no other threads uses this table.
   bool unsafe_insert(const VALUE& value);
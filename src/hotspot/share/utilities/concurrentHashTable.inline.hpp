@@ -930,6 +930,68 @@ inline bool ConcurrentHashTable<CONFIG, F>::
   return ret;
 }
 
+template <typename CONFIG, MEMFLAGS F>
+template <typename LOOKUP_FUNC>
+inline size_t ConcurrentHashTable<CONFIG, F>::
+  internal_insert_batch(Thread* thread, LOOKUP_FUNC* lookups,
+                        const VALUE* values, size_t count,
+                        bool* inserted, bool* grow_hint)
+{
+  size_t num_inserted = 0;
+  bool grow = false;
+  size_t i = 0;
+  while (i < count) {
+    bool contended = false;
+    {
+      ScopedCS cs(thread, this); /* protected the table/bucket */
+      for (; i < count; i++) {
+        bool clean = false;
+        size_t loops = 0;
+        Bucket* bucket = get_bucket(lookups[i].get_hash());
+        Node* first_at_start = bucket->first();
+        Node* old = get_node(bucket, lookups[i], &clean, &loops);
+        grow = grow || loops > _grow_hint;
+        bool ret = false;
+        if (old == NULL) {
+          Node* new_node = Node::create_node(values[i], first_at_start);
+          if (!bucket->cas_first(new_node, first_at_start)) {
+            // The bucket may be locked by a resize or a bulk operation, which
+            // could be waiting for this critical section; leave it and let
+            // the plain insert do the retrying.
+            Node::destroy_node(new_node);
+            contended = true;
+            break; /* leave critical section */
+          }
+          JFR_ONLY(_stats_rate.add();)
+          ret = true;
+          num_inserted++;
+        }
+        if (inserted != NULL) {
+          inserted[i] = ret;
+        }
+      }
+    } /* leave critical section */
+    if (contended) {
+      bool grow_i = false;
+      bool ret = internal_insert(thread, lookups[i], values[i], &grow_i, NULL);
+      grow = grow || grow_i;
+      if (ret) {
+        num_inserted++;
+      }
+      if (inserted != NULL) {
+        inserted[i] = ret;
+      }
+      i++;
+    }
+  }
+
+  if (grow_hint != NULL) {
+    *grow_hint = grow;
+  }
+
+  return num_inserted;
+}
+
 template <typename CONFIG, MEMFLAGS F>
 template <typename FUNC>
 inline bool ConcurrentHashTable<CONFIG, F>::
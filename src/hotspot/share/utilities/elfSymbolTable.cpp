@@ -29,9 +29,11 @@
 #include "memory/allocation.inline.hpp"
 #include "utilities/elfFuncDescTable.hpp"
 #include "utilities/elfSymbolTable.hpp"
+#include "utilities/quickSort.hpp"
 
 ElfSymbolTable::ElfSymbolTable(FILE* const file, Elf_Shdr& shdr) :
-  _next(NULL), _fd(file), _section(file, shdr) {
+  _next(NULL), _fd(file), _section(file, shdr), _func_index(NULL),
+  _func_index_length(0), _max_func_size(0), _func_index_built(false) {
   assert(file != NULL, "null file handle");
   _status = _section.status();
 
@@ -41,22 +43,28 @@ ElfSymbolTable::ElfSymbolTable(FILE* const file, Elf_Shdr& shdr) :
 }
 
 ElfSymbolTable::~ElfSymbolTable() {
+  if (_func_index != NULL) {
+    os::free(_func_index);
+  }
   if (_next != NULL) {
     delete _next;
   }
 }
 
+address ElfSymbolTable::symbol_address(const Elf_Sym* sym, ElfFuncDescTable* funcDescTable) {
+  if (funcDescTable != NULL && funcDescTable->get_index() == sym->st_shndx) {
+    // We need to go another step trough the function descriptor table (currently PPC64 only)
+    return funcDescTable->lookup(sym->st_value);
+  } else {
+    return (address)sym->st_value;
+  }
+}
+
 bool ElfSymbolTable::compare(const Elf_Sym* sym, address addr, int* stringtableIndex, int* posIndex, int* offset, ElfFuncDescTable* funcDescTable) {
   if (STT_FUNC == ELF_ST_TYPE(sym->st_info)) {
     Elf_Word st_size = sym->st_size;
     const Elf_Shdr* shdr = _section.section_header();
-    address sym_addr;
-    if (funcDescTable != NULL && funcDescTable->get_index() == sym->st_shndx) {
-      // We need to go another step trough the function descriptor table (currently PPC64 only)
-      sym_addr = funcDescTable->lookup(sym->st_value);
-    } else {
-      sym_addr = (address)sym->st_value;
-    }
+    address sym_addr = symbol_address(sym, funcDescTable);
     if (sym_addr <= addr && (Elf_Word)(addr - sym_addr) < st_size) {
       *offset = (int)(addr - sym_addr);
       *posIndex = sym->st_name;
@@ -67,6 +75,77 @@ bool ElfSymbolTable::compare(const Elf_Sym* sym, address addr, int* stringtableI
   return false;
 }
 
+int ElfSymbolTable::compare_func_index_entries(const FuncIndexEntry& e1, const FuncIndexEntry& e2) {
+  return e1._addr < e2._addr ? -1 : (e1._addr > e2._addr ? 1 : 0);
+}
+
+void ElfSymbolTable::build_func_index(const Elf_Sym* symbols, int count, ElfFuncDescTable* funcDescTable) {
+  assert(!_func_index_built, "built only once");
+  _func_index_built = true;
+
+  int length = 0;
+  for (int index = 0; index < count; index++) {
+    if (STT_FUNC == ELF_ST_TYPE(symbols[index].st_info) && symbols[index].st_size > 0) {
+      length++;
+    }
+  }
+  if (length == 0) {
+    return;
+  }
+
+  // Not enough memory for the index is okay, we walk the section instead.
+  FuncIndexEntry* func_index = (FuncIndexEntry*)os::malloc(length * sizeof(FuncIndexEntry), mtInternal);
+  if (func_index == NULL) {
+    return;
+  }
+
+  int pos = 0;
+  for (int index = 0; index < count; index++) {
+    const Elf_Sym* sym = &symbols[index];
+    if (STT_FUNC == ELF_ST_TYPE(sym->st_info) && sym->st_size > 0) {
+      func_index[pos]._addr = symbol_address(sym, funcDescTable);
+      func_index[pos]._size = sym->st_size;
+      func_index[pos]._name = sym->st_name;
+      _max_func_size = MAX2(_max_func_size, (size_t)sym->st_size);
+      pos++;
+    }
+  }
+  QuickSort::sort(func_index, length, compare_func_index_entries, false);
+  _func_index = func_index;
+  _func_index_length = length;
+}
+
+bool ElfSymbolTable::lookup_in_func_index(address addr, int* stringtableIndex, int* posIndex, int* offset) {
+  // Find the last function starting at or before addr.
+  int low = 0;
+  int high = _func_index_length;
+  while (low < high) {
+    int mid = low + (high - low) / 2;
+    if (_func_index[mid]._addr <= addr) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+
+  // Functions can overlap, so check every function that starts close enough
+  // before addr to still contain it.
+  for (int index = low - 1; index >= 0; index--) {
+    const FuncIndexEntry* entry = &_func_index[index];
+    size_t distance = addr - entry->_addr;
+    if (distance >= _max_func_size) {
+      break;
+    }
+    if (distance < entry->_size) {
+      *offset = (int)distance;
+      *posIndex = entry->_name;
+      *stringtableIndex = _section.section_header()->sh_link;
+      return true;
+    }
+  }
+  return false;
+}
+
 bool ElfSymbolTable::lookup(address addr, int* stringtableIndex, int* posIndex, int* offset, ElfFuncDescTable* funcDescTable) {
   assert(stringtableIndex, "null string table index pointer");
   assert(posIndex, "null string table offset pointer");
@@ -81,6 +160,12 @@ bool ElfSymbolTable::lookup(address addr, int* stringtableIndex, int* posIndex,
   Elf_Sym* symbols = (Elf_Sym*)_section.section_data();
 
   if (symbols != NULL) {
+    if (!_func_index_built) {
+      build_func_index(symbols, count, funcDescTable);
+    }
+    if (_func_index != NULL) {
+      return lookup_in_func_index(addr, stringtableIndex, posIndex, offset);
+    }
     for (int index = 0; index < count; index ++) {
       if (compare(&symbols[index], addr, stringtableIndex, posIndex, offset, funcDescTable)) {
         return true;
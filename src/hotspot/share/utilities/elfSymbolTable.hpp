@@ -37,6 +37,10 @@
  * Whenever possible, it will load all symbols from the corresponding section
  * of the elf file into memory. Otherwise, it will walk the section in file
  * to look up the symbol that nearest the given address.
+ *
+ * When the symbols are in memory, the first lookup also builds an index of
+ * the function symbols sorted by address, so that later lookups are a binary
+ * search instead of a walk over the whole section.
  */
 class ElfSymbolTable: public CHeapObj<mtInternal> {
   friend class ElfFile;
@@ -50,6 +54,20 @@ private:
   ElfSection      _section;
 
   NullDecoder::decoder_status _status;
+
+  // A function symbol, with its address resolved.
+  struct FuncIndexEntry {
+    address   _addr;
+    size_t    _size;
+    Elf_Word  _name;
+  };
+
+  // Function symbols sorted by address, NULL if not built or if building
+  // it failed, in which case the section is walked.
+  FuncIndexEntry* _func_index;
+  int             _func_index_length;
+  size_t          _max_func_size;
+  bool            _func_index_built;
 public:
   ElfSymbolTable(FILE* const file, Elf_Shdr& shdr);
   ~ElfSymbolTable();
@@ -63,6 +81,11 @@ private:
   void set_next(ElfSymbolTable* next) { _next = next; }
 
   bool compare(const Elf_Sym* sym, address addr, int* stringtableIndex, int* posIndex, int* offset, ElfFuncDescTable* funcDescTable);
+
+  static int compare_func_index_entries(const FuncIndexEntry& e1, const FuncIndexEntry& e2);
+  address symbol_address(const Elf_Sym* sym, ElfFuncDescTable* funcDescTable);
+  void build_func_index(const Elf_Sym* symbols, int count, ElfFuncDescTable* funcDescTable);
+  bool lookup_in_func_index(address addr, int* stringtableIndex, int* posIndex, int* offset);
 };
 
 #endif // !_WINDOWS and !__APPLE__
@@ -129,30 +129,26 @@ void UnloadingEventLog::log(Thread* thread, InstanceKlass* ik) {
   if (!should_log()) return;
 
   double timestamp = fetch_timestamp();
-  // Unloading events are single threaded.
-  int index = compute_log_index();
-  _records[index].thread = thread;
-  _records[index].timestamp = timestamp;
-  stringStream st(_records[index].data.buffer(),
-                  _records[index].data.size());
+  size_t seq = begin_event(thread, timestamp);
+  stringStream st(record(seq).data.buffer(),
+                  record(seq).data.size());
   st.print("Unloading class " INTPTR_FORMAT " ", p2i(ik));
   ik->name()->print_value_on(&st);
+  end_event(seq);
 }
 
 void ExceptionsEventLog::log(Thread* thread, Handle h_exception, const char* message, const char* file, int line) {
   if (!should_log()) return;
 
   double timestamp = fetch_timestamp();
-  MutexLocker ml(&_mutex, Mutex::_no_safepoint_check_flag);
-  int index = compute_log_index();
-  _records[index].thread = thread;
-  _records[index].timestamp = timestamp;
-  stringStream st(_records[index].data.buffer(),
-                  _records[index].data.size());
+  size_t seq = begin_event(thread, timestamp);
+  stringStream st(record(seq).data.buffer(),
+                  record(seq).data.size());
   st.print("Exception <");
   h_exception->print_value_on(&st);
   st.print("%s%s> (" INTPTR_FORMAT ") \n"
            "thrown [%s, line %d]",
            message ? ": " : "", message ? message : "",
            p2i(h_exception()), file, line);
+  end_event(seq);
 }
@@ -26,7 +26,9 @@
 #define SHARE_UTILITIES_EVENTS_HPP
 
 #include "memory/allocation.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/orderAccess.hpp"
 #include "runtime/thread.hpp"
 #include "utilities/formatBuffer.hpp"
 #include "utilities/globalDefinitions.hpp"
@@ -78,50 +80,71 @@ class EventLog : public CHeapObj<mtInternal> {
 // providing a more featureful log function if the existing copy
 // semantics aren't appropriate.  The name is used as the label of the
 // log when it is dumped during a crash.
+//
+// Logging is lock-free so that it stays cheap when many threads log
+// at once. A writer claims the next event number with an atomic
+// increment and writes the record in the slot for that number. Each
+// record carries the number of the event it holds, which is published
+// once the record is complete, so readers skip records that are being
+// written. A writer that laps the whole ring buffer while another one
+// is still writing the same slot can leave a torn record; that is
+// acceptable for diagnostic output.
 template <class T> class EventLogBase : public EventLog {
   template <class X> class EventRecord : public CHeapObj<mtInternal> {
    public:
+    // Event number plus one, or 0 while the record is being written.
+    volatile size_t seq;
     double  timestamp;
     Thread* thread;
     X       data;
   };
 
  protected:
-  Mutex           _mutex;
   // Name is printed out as a header.
   const char*     _name;
   // Handle is a short specifier used to select this particular event log
   // for printing (see VM.events command).
   const char*     _handle;
   int             _length;
-  int             _index;
-  int             _count;
+  // Number of events logged so far.
+  volatile size_t _next;
   EventRecord<T>* _records;
 
  public:
   EventLogBase<T>(const char* name, const char* handle, int length = LogEventsBufferEntries):
-    _mutex(Mutex::event, name, true, Mutex::_safepoint_check_never),
     _name(name),
     _handle(handle),
     _length(length),
-    _index(0),
-    _count(0) {
+    _next(0) {
     _records = new EventRecord<T>[length];
+    for (int i = 0; i < length; i++) {
+      _records[i].seq = 0;
+    }
   }
 
   double fetch_timestamp() {
     return os::elapsedTime();
   }
 
-  // move the ring buffer to next open slot and return the index of
-  // the slot to use for the current message.  Should only be called
-  // while mutex is held.
-  int compute_log_index() {
-    int index = _index;
-    if (_count < _length) _count++;
-    _index++;
-    if (_index >= _length) _index = 0;
-    return index;
+  EventRecord<T>& record(size_t seq) {
+    return _records[seq % _length];
+  }
+
+  // Claim the slot for a new event and return the event number. The
+  // data of the record must be written next, then the record is
+  // published with end_event().
+  size_t begin_event(Thread* thread, double timestamp) {
+    size_t seq = Atomic::add(&_next, (size_t)1) - 1;
+    EventRecord<T>& r = record(seq);
+    r.seq = 0;
+    OrderAccess::storestore();
+    r.thread = thread;
+    r.timestamp = timestamp;
+    return seq;
+  }
+
+  void end_event(size_t seq) {
+    Atomic::release_store(&record(seq).seq, seq + 1);
   }
 
   bool should_log() {
@@ -173,11 +196,9 @@ class FormatStringEventLog : public EventLogBase< FormatStringLogMessage<bufsz>
     if (!this->should_log()) return;
 
     double timestamp = this->fetch_timestamp();
-    MutexLocker ml(&this->_mutex, Mutex::_no_safepoint_check_flag);
-    int index = this->compute_log_index();
-    this->_records[index].thread = thread;
-    this->_records[index].timestamp = timestamp;
-    this->_records[index].data.printv(format, ap);
+    size_t seq = this->begin_event(thread, timestamp);
+    this->record(seq).data.printv(format, ap);
+    this->end_event(seq);
   }
 
   void log(Thread* thread, const char* format, ...) ATTRIBUTE_PRINTF(3, 4) {
@@ -311,13 +332,7 @@ inline void Events::log_deopt_message(Thread* thread, const char* format, ...) {
 
 template <class T>
 inline void EventLogBase<T>::print_log_on(outputStream* out, int max) {
-  if (Thread::current_or_null() == NULL) {
-    // Not yet attached? Don't try to use locking
-    print_log_impl(out, max);
-  } else {
-    MutexLocker ml(&_mutex, Mutex::_no_safepoint_check_flag);
-    print_log_impl(out, max);
-  }
+  print_log_impl(out, max);
 }
 
 template <class T>
@@ -334,37 +349,27 @@ inline void EventLogBase<T>::print_names(outputStream* out) const {
 // Dump the ring buffer entries that current have entries.
 template <class T>
 inline void EventLogBase<T>::print_log_impl(outputStream* out, int max) {
-  out->print_cr("%s (%d events):", _name, _count);
-  if (_count == 0) {
+  size_t next = Atomic::load_acquire(&_next);
+  size_t count = MIN2(next, (size_t)_length);
+  out->print_cr("%s (" SIZE_FORMAT " events):", _name, count);
+  if (count == 0) {
     out->print_cr("No events");
     out->cr();
     return;
   }
 
   int printed = 0;
-  if (_count < _length) {
-    for (int i = 0; i < _count; i++) {
-      if (max > 0 && printed == max) {
-        break;
-      }
-      print(out, _records[i]);
-      printed ++;
-    }
-  } else {
-    for (int i = _index; i < _length; i++) {
-      if (max > 0 && printed == max) {
-        break;
-      }
-      print(out, _records[i]);
-      printed ++;
+  for (size_t seq = next - count; seq < next; seq++) {
+    if (max > 0 && printed == max) {
+      break;
     }
-    for (int i = 0; i < _index; i++) {
-      if (max > 0 && printed == max) {
-        break;
-      }
-      print(out, _records[i]);
-      printed ++;
+    EventRecord<T>& r = record(seq);
+    if (Atomic::load_acquire(&r.seq) != seq + 1) {
+      // Being written, or already replaced by a newer event.
+      continue;
     }
+    print(out, r);
+    printed ++;
   }
 
   if (printed == max) {
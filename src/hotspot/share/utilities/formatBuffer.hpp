@@ -85,6 +85,10 @@ FormatBuffer<bufsz>::FormatBuffer(FormatBufferDummy dummy, const char * format,
 template <size_t bufsz>
 FormatBuffer<bufsz>::FormatBuffer() : FormatBufferBase(_buffer) {
   _buf[0] = '\0';
+  // Formatting never writes anything but the terminator to the last
+  // byte, so the buffer stays terminated even while it is rewritten
+  // (see EventLogBase).
+  _buf[bufsz - 1] = '\0';
 }
 
 template <size_t bufsz>
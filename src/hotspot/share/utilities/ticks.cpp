@@ -62,10 +62,31 @@ uint64_t ElapsedCounterSource::nanoseconds(Type value) {
   return (uint64_t)conversion<ElapsedCounterSource, NANOUNITS>(value);
 }
 
+#if defined(X86) && !defined(ZERO)
+static bool fast_counter_initialized = false;
+static bool fast_counter_uses_rdtsc = false;
+
+static bool fast_counter_valid_rdtsc() {
+  if (!fast_counter_initialized) {
+    fast_counter_uses_rdtsc = Rdtsc::initialize();
+    fast_counter_initialized = true;
+  }
+  return fast_counter_uses_rdtsc;
+}
+#endif
+
+// Calibrate the fast counter from the main thread during VM startup, so that
+// it is ready before the first GC and the calibration, which may sleep, is
+// not done lazily by whatever thread happens to time something first.
+void ticks_init() {
+#if defined(X86) && !defined(ZERO)
+  fast_counter_valid_rdtsc();
+#endif
+}
+
 uint64_t FastUnorderedElapsedCounterSource::frequency() {
 #if defined(X86) && !defined(ZERO)
-  static bool valid_rdtsc = Rdtsc::initialize();
-  if (valid_rdtsc) {
+  if (fast_counter_valid_rdtsc()) {
     static const uint64_t freq = (uint64_t)Rdtsc::frequency();
     return freq;
   }
@@ -76,8 +97,7 @@ uint64_t FastUnorderedElapsedCounterSource::frequency() {
 
 FastUnorderedElapsedCounterSource::Type FastUnorderedElapsedCounterSource::now() {
 #if defined(X86) && !defined(ZERO)
-  static bool valid_rdtsc = Rdtsc::initialize();
-  if (valid_rdtsc) {
+  if (fast_counter_valid_rdtsc()) {
     return Rdtsc::elapsed_counter();
   }
 #endif
@@ -108,13 +128,7 @@ CompositeElapsedCounterSource::Type CompositeElapsedCounterSource::now() {
   CompositeTime ct;
   ct.val1 = ElapsedCounterSource::now();
 #if defined(X86) && !defined(ZERO)
-  static bool initialized = false;
-  static bool valid_rdtsc = false;
-  if (!initialized) {
-    valid_rdtsc = Rdtsc::initialize();
-    initialized = true;
-  }
-  if (valid_rdtsc) {
+  if (fast_counter_valid_rdtsc()) {
     ct.val2 = Rdtsc::elapsed_counter();
   }
 #endif
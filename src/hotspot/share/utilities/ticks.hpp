@@ -247,4 +247,12 @@ typedef TimeInstant<CounterRepresentation, ElapsedCounterSource> Ticks;
 typedef TimeInterval<CounterRepresentation, ElapsedCounterSource> Tickspan;
 #endif
 
+// Cheap time stamps for high frequency instrumentation such as the per
+// worker GC phase times. They read the invariant TSC if it is available
+// and UseFastUnorderedTimeStamps is enabled, and os::elapsed_counter()
+// otherwise. FastTicks are not comparable to Ticks; only use the difference
+// of two FastTicks taken by the same thread.
+typedef TimeInstant<CounterRepresentation, FastUnorderedElapsedCounterSource> FastTicks;
+typedef TimeInterval<CounterRepresentation, FastUnorderedElapsedCounterSource> FastTickspan;
+
 #endif // SHARE_UTILITIES_TICKS_HPP
@@ -79,6 +79,33 @@ Java_sun_nio_ch_EPoll_ctl(JNIEnv *env, jclass clazz, jint epfd,
     return (res == 0) ? 0 : errno;
 }
 
+/*
+ * Applies count interest updates with epoll_ctl in a single native call.
+ * The updates are stored at address as consecutive (opcode, fd, events)
+ * jint triples. Stops at the first update that fails, stores its errno in
+ * place of its events and returns its index; returns count if all updates
+ * were applied.
+ */
+JNIEXPORT jint JNICALL
+Java_sun_nio_ch_EPoll_ctlBatch(JNIEnv *env, jclass clazz, jint epfd,
+                               jlong address, jint count)
+{
+    jint *updates = jlong_to_ptr(address);
+    struct epoll_event event;
+    jint i;
+
+    for (i = 0; i < count; i++) {
+        jint *update = updates + 3 * i;
+        event.events = update[2];
+        event.data.fd = update[1];
+        if (epoll_ctl(epfd, (int)update[0], (int)update[1], &event) != 0) {
+            update[2] = errno;
+            return i;
+        }
+    }
+    return count;
+}
+
 JNIEXPORT jint JNICALL
 Java_sun_nio_ch_EPoll_wait(JNIEnv *env, jclass clazz, jint epfd,
                            jlong address, jint numfds, jint timeout)
@@ -73,6 +73,12 @@
 #define SPLASH_JAR_ENV_ENTRY "_JAVA_SPLASH_JAR"
 #define JDK_JAVA_OPTIONS "JDK_JAVA_OPTIONS"
 
+/*
+ * If set, names the file in which the launcher remembers the jar files
+ * found in class-path wildcard directories. See wildcard.c.
+ */
+#define JLI_CACHE_ENV_ENTRY "JDK_JAVA_LAUNCHER_CACHE"
+
 /*
  * Pointers to the needed JNI invocation API, initialized by LoadJavaVM.
  */
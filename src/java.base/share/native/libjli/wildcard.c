@@ -83,6 +83,11 @@
  * supporting the use of wildcards on the command line and in the
  * CLASSPATH environment variable.  We do not support the use of
  * wildcards by applications that embed the JVM.
+ *
+ * On Unix, if the environment variable JDK_JAVA_LAUNCHER_CACHE names a
+ * file, the jar files found in each wildcard directory are remembered
+ * in that file. A later launch then only needs to stat() the directory
+ * instead of reading it, as long as its modification time is unchanged.
  */
 
 #include <stddef.h>
@@ -98,6 +103,9 @@
 #else /* Unix */
 #include <unistd.h>
 #include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <time.h>
 #endif /* Unix */
 
 #if defined(_AIX)
@@ -250,23 +258,307 @@ wildcardConcat(const char *wildcard, const char *basename)
     return filename;
 }
 
+#ifndef _WIN32
+/*
+ * Wildcard expansion cache.
+ *
+ * A directory is identified by its device and inode number, so the
+ * cache does not depend on the current directory. An entry is valid
+ * as long as the modification time of the directory is unchanged.
+ * Directories modified within the last CACHE_RACY_SECONDS are not
+ * cached, since a further change within the granularity of the
+ * modification time would go unnoticed.
+ *
+ * The cache file is a sequence of entries of the form
+ *
+ *   <dev> <ino> <mtime> <count>
+ *   <jar file name>        (count lines)
+ *
+ * The entries used by the last launch come first. When the cache is
+ * full, the entries not used by the current launch are replaced. A
+ * file that does not have this form is ignored as a whole.
+ */
+#define CACHE_MAX_ENTRIES  64
+#define CACHE_RACY_SECONDS 2
+
+typedef struct CacheEntry_* CacheEntry;
+
+struct CacheEntry_
+{
+    dev_t dev;
+    ino_t ino;
+    time_t mtime;
+    int used;           /* looked up or updated by this launch */
+    JLI_List files;     /* jar file names, without the directory */
+};
+
+static CacheEntry cache[CACHE_MAX_ENTRIES];
+static int cacheSize = 0;
+static int cacheLoaded = 0;
+static int cacheDirty = 0;
+
+static const char *
+cacheFileName()
+{
+    const char *s = getenv(JLI_CACHE_ENV_ENTRY);
+    return (s != NULL && *s != '\0') ? s : NULL;
+}
+
+static void
+freeCacheEntry(CacheEntry e)
+{
+    JLI_List_free(e->files);
+    JLI_MemFree(e);
+}
+
+static void
+cacheReject()
+{
+    int i;
+    for (i = 0; i < cacheSize; i++)
+        freeCacheEntry(cache[i]);
+    cacheSize = 0;
+}
+
+static void
+cacheLoad()
+{
+    char line[MAXPATHLEN + 2];
+    struct stat st;
+    FILE *f;
+
+    cacheLoaded = 1;
+    f = fopen(cacheFileName(), "r");
+    if (f == NULL)
+        return;
+    if (fstat(fileno(f), &st) != 0 || !S_ISREG(st.st_mode)) {
+        fclose(f);
+        return;
+    }
+    while (cacheSize < CACHE_MAX_ENTRIES && fgets(line, sizeof(line), f) != NULL) {
+        unsigned long long dev, ino;
+        long long mtime;
+        int count, i;
+        size_t len;
+        CacheEntry e;
+
+        /* Each file name takes at least two bytes, so a count that the
+         * size of the file cannot hold means the file is corrupt. */
+        if ((len = JLI_StrLen(line)) == 0 || line[len - 1] != '\n' ||
+            sscanf(line, "%llu %llu %lld %d", &dev, &ino, &mtime, &count) != 4 ||
+            count < 0 || (unsigned long long) count > (unsigned long long) st.st_size / 2) {
+            cacheReject();
+            break;
+        }
+        e = NEW_(CacheEntry);
+        e->dev = (dev_t) dev;
+        e->ino = (ino_t) ino;
+        e->mtime = (time_t) mtime;
+        e->used = 0;
+        e->files = JLI_List_new(count + 1);
+        for (i = 0; i < count; i++) {
+            if (fgets(line, sizeof(line), f) == NULL ||
+                (len = JLI_StrLen(line)) <= 1 || line[len - 1] != '\n') {
+                /* Truncated or corrupt, ignore the file. */
+                freeCacheEntry(e);
+                cacheReject();
+                fclose(f);
+                return;
+            }
+            line[len - 1] = '\0';
+            JLI_List_add(e->files, JLI_StringDup(line));
+        }
+        cache[cacheSize++] = e;
+    }
+    fclose(f);
+}
+
+static void
+cacheSave()
+{
+    const char *cachefile = cacheFileName();
+    char *tmpfile;
+    FILE *f;
+    int fd, used, i, failed;
+    size_t j;
+
+    cacheDirty = 0;
+    /* Write a private file first, so concurrent launches see either
+     * the old or the new cache. Its name is predictable, so it must be
+     * created here rather than opened through an existing file or
+     * symbolic link. */
+    tmpfile = JLI_MemAlloc(JLI_StrLen(cachefile) + 16);
+    sprintf(tmpfile, "%s.%d", cachefile, (int) JLI_GetPid());
+    fd = open(tmpfile, O_WRONLY | O_CREAT | O_EXCL, 0666);
+    if (fd == -1) {
+        JLI_MemFree(tmpfile);
+        return;
+    }
+    f = fdopen(fd, "w");
+    if (f == NULL) {
+        close(fd);
+        unlink(tmpfile);
+        JLI_MemFree(tmpfile);
+        return;
+    }
+    for (used = 1; used >= 0; used--) {
+        for (i = 0; i < cacheSize; i++) {
+            CacheEntry e = cache[i];
+            if (e->used != used)
+                continue;
+            fprintf(f, "%llu %llu %lld %d\n",
+                    (unsigned long long) e->dev, (unsigned long long) e->ino,
+                    (long long) e->mtime, (int) e->files->size);
+            for (j = 0; j < e->files->size; j++)
+                fprintf(f, "%s\n", e->files->elements[j]);
+        }
+    }
+    failed = ferror(f);
+    failed = (fclose(f) != 0) || failed;
+    if (failed || rename(tmpfile, cachefile) != 0)
+        unlink(tmpfile);
+    JLI_MemFree(tmpfile);
+}
+
+/* stat() the directory that WildcardIterator_for() would open. */
+static int
+wildcardDirStat(const char *wildcard, struct stat *st)
+{
+    int wildlen = (int)JLI_StrLen(wildcard);
+    int rc;
+    if (wildlen < 2) {
+        rc = stat(".", st);
+    } else {
+        char *dirname = JLI_StringDup(wildcard);
+        dirname[wildlen - 1] = '\0';
+        rc = stat(dirname, st);
+        JLI_MemFree(dirname);
+    }
+    return rc == 0 && S_ISDIR(st->st_mode);
+}
+
+static CacheEntry
+cacheLookup(const struct stat *st)
+{
+    int i;
+    if (!cacheLoaded)
+        cacheLoad();
+    for (i = 0; i < cacheSize; i++) {
+        if (cache[i]->dev == st->st_dev && cache[i]->ino == st->st_ino)
+            return cache[i];
+    }
+    return NULL;
+}
+
+/*
+ * Returns the jar files of the wildcard's directory, or NULL if the
+ * cache has no valid entry for it.
+ */
+static JLI_List
+cacheGet(const char *wildcard, const struct stat *st)
+{
+    CacheEntry e = cacheLookup(st);
+    JLI_List fl;
+    size_t i;
+
+    if (e == NULL || e->mtime != st->st_mtime)
+        return NULL;
+    e->used = 1;
+    fl = JLI_List_new(e->files->size + 1);
+    for (i = 0; i < e->files->size; i++)
+        JLI_List_add(fl, wildcardConcat(wildcard, e->files->elements[i]));
+    return fl;
+}
+
+/* Remembers the jar file names of a directory. Takes over names. */
+static void
+cachePut(const struct stat *st, JLI_List names)
+{
+    CacheEntry e;
+    size_t i;
+    int slot;
+
+    if (time(NULL) - st->st_mtime < CACHE_RACY_SECONDS) {
+        JLI_List_free(names);
+        return;
+    }
+    for (i = 0; i < names->size; i++) {
+        if (JLI_StrChr(names->elements[i], '\n') != NULL) {
+            /* Cannot be stored in the cache file. */
+            JLI_List_free(names);
+            return;
+        }
+    }
+
+    e = cacheLookup(st);
+    if (e != NULL) {
+        JLI_List_free(e->files);
+    } else {
+        if (cacheSize < CACHE_MAX_ENTRIES) {
+            slot = cacheSize++;
+        } else {
+            for (slot = 0; slot < cacheSize && cache[slot]->used; slot++)
+                ;
+            if (slot == cacheSize) {
+                JLI_List_free(names);
+                return;
+            }
+            freeCacheEntry(cache[slot]);
+        }
+        e = NEW_(CacheEntry);
+        e->dev = st->st_dev;
+        e->ino = st->st_ino;
+        cache[slot] = e;
+    }
+    e->mtime = st->st_mtime;
+    e->used = 1;
+    e->files = names;
+    cacheDirty = 1;
+}
+#endif /* Unix */
+
 static JLI_List
 wildcardFileList(const char *wildcard)
 {
     const char *basename;
-    JLI_List fl = JLI_List_new(16);
-    WildcardIterator it = WildcardIterator_for(wildcard);
+    JLI_List fl;
+    WildcardIterator it;
+#ifndef _WIN32
+    struct stat st;
+    JLI_List names = NULL;
+
+    if (cacheFileName() != NULL && wildcardDirStat(wildcard, &st)) {
+        fl = cacheGet(wildcard, &st);
+        if (fl != NULL)
+            return fl;
+        names = JLI_List_new(16);
+    }
+#endif /* Unix */
 
+    fl = JLI_List_new(16);
+    it = WildcardIterator_for(wildcard);
     if (it == NULL)
     {
         JLI_List_free(fl);
+#ifndef _WIN32
+        JLI_List_free(names);
+#endif /* Unix */
         return NULL;
     }
 
     while ((basename = WildcardIterator_next(it)) != NULL)
-        if (isJarFileName(basename))
+        if (isJarFileName(basename)) {
             JLI_List_add(fl, wildcardConcat(wildcard, basename));
+#ifndef _WIN32
+            if (names != NULL)
+                JLI_List_add(names, JLI_StringDup(basename));
+#endif /* Unix */
+        }
     WildcardIterator_close(it);
+#ifndef _WIN32
+    if (names != NULL)
+        cachePut(&st, names);
+#endif /* Unix */
     return fl;
 }
 
@@ -319,6 +611,10 @@ JLI_WildcardExpandClasspath(const char *classpath)
     expanded = FileList_expandWildcards(fl) ?
         JLI_List_join(fl, PATH_SEPARATOR) : classpath;
     JLI_List_free(fl);
+#ifndef _WIN32
+    if (cacheDirty)
+        cacheSave();
+#endif /* Unix */
     if (getenv(JLDEBUG_ENV_ENTRY) != 0)
         printf("Expanded wildcards:\n"
                "    before: \"%s\"\n"
@@ -1391,6 +1391,11 @@ ZIP_Read(jzfile *zip, jzentry *entry, jlong pos, void *buf, jint len)
  */
 #define BUF_SIZE 4096
 
+/* The maximum size of the buffer InflateFully reads compressed data into
+ * when the entry does not fit in a stack-allocated buffer.
+ */
+#define INFLATE_BUF_SIZE (64 * 1024)
+
 /*
  * This function is used by the runtime system to load compressed entries
  * from ZIP/JAR files specified in the class path. It is defined here
@@ -1404,7 +1409,9 @@ jboolean
 InflateFully(jzfile *zip, jzentry *entry, void *buf, char **msg)
 {
     z_stream strm;
-    char tmp[BUF_SIZE];
+    char stackbuf[BUF_SIZE];
+    char *tmp = stackbuf;
+    jint tmpsize = BUF_SIZE;
     jlong pos = 0;
     jlong count = entry->csize;
 
@@ -1421,11 +1428,24 @@ InflateFully(jzfile *zip, jzentry *entry, void *buf, char **msg)
         return JNI_FALSE;
     }
 
+    /* Read larger entries in fewer, bigger pieces, each of which costs a
+     * lock and a read of the zip file. Fall back to the stack buffer if
+     * there is no memory.
+     */
+    if (count > BUF_SIZE) {
+        jint size = count > INFLATE_BUF_SIZE ? INFLATE_BUF_SIZE : (jint)count;
+        char *heapbuf = malloc(size);
+        if (heapbuf != NULL) {
+            tmp = heapbuf;
+            tmpsize = size;
+        }
+    }
+
     strm.next_out = buf;
     strm.avail_out = (uInt)entry->size;
 
     while (count > 0) {
-        jint n = count > (jlong)sizeof(tmp) ? (jint)sizeof(tmp) : (jint)count;
+        jint n = count > (jlong)tmpsize ? tmpsize : (jint)count;
         ZIP_Lock(zip);
         n = ZIP_Read(zip, entry, pos, tmp, n);
         ZIP_Unlock(zip);
@@ -1434,6 +1454,9 @@ InflateFully(jzfile *zip, jzentry *entry, void *buf, char **msg)
                 *msg = "inflateFully: Unexpected end of file";
             }
             inflateEnd(&strm);
+            if (tmp != stackbuf) {
+                free(tmp);
+            }
             return JNI_FALSE;
         }
         pos += n;
@@ -1448,6 +1471,9 @@ InflateFully(jzfile *zip, jzentry *entry, void *buf, char **msg)
                 if (count != 0 || strm.total_out != (uInt)entry->size) {
                     *msg = "inflateFully: Unexpected end of stream";
                     inflateEnd(&strm);
+                    if (tmp != stackbuf) {
+                        free(tmp);
+                    }
                     return JNI_FALSE;
                 }
                 break;
@@ -1458,6 +1484,9 @@ InflateFully(jzfile *zip, jzentry *entry, void *buf, char **msg)
     }
 
     inflateEnd(&strm);
+    if (tmp != stackbuf) {
+        free(tmp);
+    }
     return JNI_TRUE;
 }
 
@@ -1589,3 +1618,58 @@ ZIP_InflateFully(void *inBuf, jlong inLen, void *outBuf, jlong outLen, char **pm
     inflateEnd(&strm);
     return JNI_TRUE;
 }
+
+/*
+ * Returns an upper bound of the size of a gzip member holding inLen bytes
+ * of input, i.e. the size of the output buffer ZIP_GZip_Fully needs.
+ */
+JNIEXPORT size_t
+ZIP_GZip_Bound(size_t inLen)
+{
+    /* deflateBound() plus the gzip header and trailer */
+    return (size_t)compressBound((uLong)inLen) + 18;
+}
+
+/*
+ * Compresses inLen bytes at inBuf into a complete, self-contained gzip
+ * member at outBuf. Returns the size of the member, or 0 with *pmsg set
+ * on failure. Several members can be concatenated to a valid gzip file.
+ */
+JNIEXPORT size_t
+ZIP_GZip_Fully(char *inBuf, size_t inLen, char *outBuf, size_t outLen,
+               int level, char **pmsg)
+{
+    z_stream strm;
+    size_t result = 0;
+    memset(&strm, 0, sizeof(z_stream));
+
+    *pmsg = 0; /* Reset error message */
+
+    /* window bits of 15 + 16 request a gzip header and trailer */
+    if (deflateInit2(&strm, level, Z_DEFLATED, MAX_WBITS + 16, 8,
+                     Z_DEFAULT_STRATEGY) != Z_OK) {
+        *pmsg = "ZIP_GZip_Fully: could not initialize deflater";
+        return 0;
+    }
+
+    strm.next_out = (Bytef *) outBuf;
+    strm.avail_out = (uInt)outLen;
+    strm.next_in = (Bytef *) inBuf;
+    strm.avail_in = (uInt)inLen;
+
+    switch (deflate(&strm, Z_FINISH)) {
+        case Z_STREAM_END:
+            result = (size_t)strm.total_out;
+            break;
+        case Z_OK:
+        case Z_BUF_ERROR:
+            *pmsg = "ZIP_GZip_Fully: output buffer too small";
+            break;
+        default:
+            *pmsg = "ZIP_GZip_Fully: internal error";
+            break;
+    }
+
+    deflateEnd(&strm);
+    return result;
+}
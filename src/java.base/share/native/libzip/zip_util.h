@@ -284,4 +284,11 @@ jzentry * ZIP_GetEntry2(jzfile *zip, char *name, jint ulen, jboolean addSlash);
 JNIEXPORT jboolean
 ZIP_InflateFully(void *inBuf, jlong inLen, void *outBuf, jlong outLen, char **pmsg);
 
+JNIEXPORT size_t
+ZIP_GZip_Bound(size_t inLen);
+
+JNIEXPORT size_t
+ZIP_GZip_Fully(char *inBuf, size_t inLen, char *outBuf, size_t outLen,
+               int level, char **pmsg);
+
 #endif /* !_ZIP_H_ */
@@ -227,8 +227,7 @@ Java_java_net_Inet6AddressImpl_lookupAllHostAddr(JNIEnv *env, jobject this,
     jobjectArray ret = NULL;
     const char *hostname;
     int error = 0;
-    struct addrinfo hints, *res = NULL, *resNew = NULL, *last = NULL,
-        *iterator;
+    struct addrinfo *res = NULL, *resNew = NULL, *last = NULL, *iterator;
 
     initInetAddressIDs(env);
     JNU_CHECK_EXCEPTION_RETURN(env, NULL);
@@ -240,12 +239,7 @@ Java_java_net_Inet6AddressImpl_lookupAllHostAddr(JNIEnv *env, jobject this,
     hostname = JNU_GetStringPlatformChars(env, host, JNI_FALSE);
     CHECK_NULL_RETURN(hostname, NULL);
 
-    // try once, with our static buffer
-    memset(&hints, 0, sizeof(hints));
-    hints.ai_flags = AI_CANONNAME;
-    hints.ai_family = AF_UNSPEC;
-
-    error = getaddrinfo(hostname, NULL, &hints, &res);
+    error = NET_GetAddrInfo(hostname, AF_UNSPEC, &res);
 
     if (error) {
 #if defined(MACOSX)
@@ -405,7 +399,7 @@ cleanupAndReturn:
         free(last);
     }
     if (res != NULL) {
-        freeaddrinfo(res);
+        NET_ReleaseAddrInfo(res);
     }
     return ret;
 }
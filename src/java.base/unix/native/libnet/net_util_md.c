@@ -26,6 +26,7 @@
 #include <errno.h>
 #include <net/if.h>
 #include <netinet/tcp.h> // defines TCP_NODELAY
+#include <pthread.h>
 #include <stdlib.h>
 #include <string.h>
 #include <sys/ioctl.h>
@@ -388,6 +389,120 @@ void NET_ThrowUnknownHostExceptionWithGaiError(JNIEnv *env,
     }
 }
 
+/*
+ * Host name lookups for InetAddressImpl.lookupAllHostAddr.
+ *
+ * When several threads look up the same host name at the same time, for
+ * instance because its entry in the InetAddress cache just expired, only
+ * the first one calls getaddrinfo(). The others wait for its result and
+ * share it, so a slow resolver does not hold one lookup per thread.
+ * Only lookups in progress are shared; a later lookup always queries
+ * the resolver again, the caching is left to InetAddress.
+ */
+typedef struct _hostLookup {
+    struct _hostLookup *next;
+    char *hostname;
+    int family;
+    int done;
+    int error;
+    struct addrinfo *res;
+    int refs;                   /* threads using this lookup */
+} hostLookup;
+
+static pthread_mutex_t hostLookupLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t hostLookupDone = PTHREAD_COND_INITIALIZER;
+static hostLookup *hostLookups = NULL;
+
+/* Called with hostLookupLock held. */
+static void releaseHostLookup(hostLookup *l) {
+    hostLookup **p;
+    if (--l->refs > 0) {
+        return;
+    }
+    for (p = &hostLookups; *p != l; p = &(*p)->next)
+        ;
+    *p = l->next;
+    if (l->res != NULL) {
+        freeaddrinfo(l->res);
+    }
+    free(l->hostname);
+    free(l);
+}
+
+/*
+ * Looks up hostname with getaddrinfo() and AI_CANONNAME, sharing the
+ * result with concurrent lookups of the same name and family. Returns
+ * the getaddrinfo() error code. If the lookup succeeded the result must
+ * be released with NET_ReleaseAddrInfo().
+ */
+int NET_GetAddrInfo(const char *hostname, int family, struct addrinfo **res) {
+    struct addrinfo hints;
+    hostLookup *l;
+    int error;
+
+    pthread_mutex_lock(&hostLookupLock);
+    for (l = hostLookups; l != NULL; l = l->next) {
+        if (!l->done && l->family == family && strcmp(l->hostname, hostname) == 0) {
+            break;
+        }
+    }
+    if (l != NULL) {
+        l->refs++;
+        while (!l->done) {
+            pthread_cond_wait(&hostLookupDone, &hostLookupLock);
+        }
+    } else {
+        memset(&hints, 0, sizeof(hints));
+        hints.ai_flags = AI_CANONNAME;
+        hints.ai_family = family;
+
+        l = (hostLookup *) calloc(1, sizeof(hostLookup));
+        if (l == NULL || (l->hostname = strdup(hostname)) == NULL) {
+            // Cannot share it, just do the lookup.
+            pthread_mutex_unlock(&hostLookupLock);
+            free(l);
+            return getaddrinfo(hostname, NULL, &hints, res);
+        }
+        l->family = family;
+        l->refs = 1;
+        l->next = hostLookups;
+        hostLookups = l;
+        pthread_mutex_unlock(&hostLookupLock);
+
+        error = getaddrinfo(hostname, NULL, &hints, &l->res);
+
+        pthread_mutex_lock(&hostLookupLock);
+        if (error != 0) {
+            l->res = NULL;
+        }
+        l->error = error;
+        l->done = 1;
+        pthread_cond_broadcast(&hostLookupDone);
+    }
+    error = l->error;
+    *res = l->res;
+    if (error != 0) {
+        releaseHostLookup(l);
+    }
+    pthread_mutex_unlock(&hostLookupLock);
+    return error;
+}
+
+void NET_ReleaseAddrInfo(struct addrinfo *res) {
+    hostLookup *l;
+    pthread_mutex_lock(&hostLookupLock);
+    for (l = hostLookups; l != NULL; l = l->next) {
+        if (l->res == res) {
+            releaseHostLookup(l);
+            pthread_mutex_unlock(&hostLookupLock);
+            return;
+        }
+    }
+    pthread_mutex_unlock(&hostLookupLock);
+    // Not shared, see NET_GetAddrInfo.
+    freeaddrinfo(res);
+}
+
 #if defined(_AIX)
 
 /* Initialize stubs for blocking I/O workarounds (see src/solaris/native/java/net/linux_close.c) */
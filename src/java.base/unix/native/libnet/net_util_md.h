@@ -94,6 +94,8 @@ int NET_Poll(struct pollfd *ufds, unsigned int nfds, int timeout);
 void NET_ThrowUnknownHostExceptionWithGaiError(JNIEnv *env,
                                                const char* hostname,
                                                int gai_error);
+int NET_GetAddrInfo(const char *hostname, int family, struct addrinfo **res);
+void NET_ReleaseAddrInfo(struct addrinfo *res);
 void NET_ThrowByNameWithLastError(JNIEnv *env, const char *name,
                                   const char *defaultDetail);
 void NET_SetTrafficClass(SOCKETADDRESS *sa, int trafficClass);
@@ -39,6 +39,9 @@
 #include "nio_util.h"
 #include <limits.h>
 
+/* Maximum number of datagrams moved by one readBatch0 or writeBatch0 call */
+#define MAX_BATCH 64
+
 JNIEXPORT jint JNICALL
 Java_sun_nio_ch_DatagramDispatcher_read0(JNIEnv *env, jclass clazz,
                          jobject fdo, jlong address, jint len)
@@ -117,3 +120,89 @@ Java_sun_nio_ch_DatagramDispatcher_writev0(JNIEnv *env, jclass clazz,
     }
     return convertLongReturnVal(env, (jlong)result, JNI_FALSE);
 }
+
+/*
+ * Receives up to count datagrams on a connected socket, one into each of
+ * the iovecs at address, and stores the length of each datagram in the
+ * jint array at lengths. On Linux the datagrams are received with a single
+ * recvmmsg call that blocks, if at all, only for the first one. Returns the
+ * number of datagrams received.
+ */
+JNIEXPORT jint JNICALL
+Java_sun_nio_ch_DatagramDispatcher_readBatch0(JNIEnv *env, jclass clazz,
+                              jobject fdo, jlong address, jint count,
+                              jlong lengths)
+{
+    jint fd = fdval(env, fdo);
+    struct iovec *iov = (struct iovec *)jlong_to_ptr(address);
+    jint *lens = (jint *)jlong_to_ptr(lengths);
+    int result;
+#if defined(__linux__)
+    struct mmsghdr msgs[MAX_BATCH];
+    int i;
+
+    if (count > MAX_BATCH) {
+        count = MAX_BATCH;
+    }
+    memset(msgs, 0, count * sizeof(struct mmsghdr));
+    for (i = 0; i < count; i++) {
+        msgs[i].msg_hdr.msg_iov = &iov[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    result = recvmmsg(fd, msgs, count, MSG_WAITFORONE, NULL);
+    for (i = 0; i < result; i++) {
+        lens[i] = (jint)msgs[i].msg_len;
+    }
+#else
+    result = recv(fd, iov[0].iov_base, iov[0].iov_len, 0);
+    if (result >= 0) {
+        lens[0] = result;
+        result = 1;
+    }
+#endif
+    if (result < 0 && errno == ECONNREFUSED) {
+        JNU_ThrowByName(env, JNU_JAVANETPKG "PortUnreachableException", 0);
+        return -2;
+    }
+    return convertReturnVal(env, result, JNI_TRUE);
+}
+
+/*
+ * Sends up to count datagrams on a connected socket, one from each of the
+ * iovecs at address. On Linux the datagrams are sent with a single
+ * sendmmsg call. Returns the number of datagrams sent.
+ */
+JNIEXPORT jint JNICALL
+Java_sun_nio_ch_DatagramDispatcher_writeBatch0(JNIEnv *env, jclass clazz,
+                               jobject fdo, jlong address, jint count)
+{
+    jint fd = fdval(env, fdo);
+    struct iovec *iov = (struct iovec *)jlong_to_ptr(address);
+    int result;
+#if defined(__linux__)
+    struct mmsghdr msgs[MAX_BATCH];
+    int i;
+
+    if (count > MAX_BATCH) {
+        count = MAX_BATCH;
+    }
+    memset(msgs, 0, count * sizeof(struct mmsghdr));
+    for (i = 0; i < count; i++) {
+        msgs[i].msg_hdr.msg_iov = &iov[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    result = sendmmsg(fd, msgs, count, 0);
+#else
+    result = send(fd, iov[0].iov_base, iov[0].iov_len, 0);
+    if (result >= 0) {
+        result = 1;
+    }
+#endif
+    if (result < 0 && errno == ECONNREFUSED) {
+        JNU_ThrowByName(env, JNU_JAVANETPKG "PortUnreachableException", 0);
+        return -2;
+    }
+    return convertReturnVal(env, result, JNI_FALSE);
+}
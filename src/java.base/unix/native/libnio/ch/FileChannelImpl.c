@@ -282,3 +282,75 @@ Java_sun_nio_ch_FileChannelImpl_transferTo0(JNIEnv *env, jobject this,
 #endif
 }
 
+
+/*
+ * Transfers up to count bytes from srcFDO, typically a socket, to the file
+ * at position. On Linux the bytes are moved with splice through a pipe so
+ * they are not copied through a user-space buffer. Returns
+ * IOS_UNSUPPORTED_CASE if the source cannot be spliced so the caller can
+ * fall back to a buffered copy.
+ */
+JNIEXPORT jlong JNICALL
+Java_sun_nio_ch_FileChannelImpl_transferFrom0(JNIEnv *env, jobject this,
+                                              jobject srcFDO, jobject dstFDO,
+                                              jlong position, jlong count)
+{
+#if defined(__linux__)
+    jint srcFD = fdval(env, srcFDO);
+    jint dstFD = fdval(env, dstFDO);
+    loff_t offset = (loff_t)position;
+    ssize_t n, left;
+    int pipefd[2];
+
+    if (pipe2(pipefd, O_CLOEXEC) != 0) {
+        JNU_ThrowIOExceptionWithLastError(env, "Transfer failed");
+        return IOS_THROWN;
+    }
+
+    n = splice(srcFD, NULL, pipefd[1], NULL, (size_t)count,
+               SPLICE_F_MOVE);
+    if (n < 0) {
+        int err = errno;
+        close(pipefd[0]);
+        close(pipefd[1]);
+        if (err == EAGAIN)
+            return IOS_UNAVAILABLE;
+        if (err == EINVAL)
+            return IOS_UNSUPPORTED_CASE;
+        if (err == EINTR)
+            return IOS_INTERRUPTED;
+        errno = err;
+        JNU_ThrowIOExceptionWithLastError(env, "Transfer failed");
+        return IOS_THROWN;
+    }
+
+    /* The bytes have been consumed from the source, so they must all reach
+     * the file; a failure here is reported rather than retried.
+     */
+    left = n;
+    while (left > 0) {
+        ssize_t m = splice(pipefd[0], NULL, dstFD, &offset, (size_t)left,
+                           SPLICE_F_MOVE);
+        if (m < 0) {
+            if (errno == EINTR)
+                continue;
+            break;
+        }
+        left -= m;
+    }
+    if (left > 0) {
+        int err = errno;
+        close(pipefd[0]);
+        close(pipefd[1]);
+        errno = err;
+        JNU_ThrowIOExceptionWithLastError(env, "Transfer failed");
+        return IOS_THROWN;
+    }
+
+    close(pipefd[0]);
+    close(pipefd[1]);
+    return n;
+#else
+    return IOS_UNSUPPORTED_CASE;
+#endif
+}
@@ -114,12 +114,15 @@ Java_sun_nio_ch_IOUtil_write1(JNIEnv *env, jclass cl, jint fd, jbyte b)
 JNIEXPORT jboolean JNICALL
 Java_sun_nio_ch_IOUtil_drain(JNIEnv *env, jclass cl, jint fd)
 {
-    char buf[16];
+    /* Large enough that a busy selector's wakeup pipe, which gets a byte
+       per wakeup, is usually drained with a single read. */
+    char buf[128];
     int tn = 0;
 
     for (;;) {
         int n = read(fd, buf, sizeof(buf));
-        tn += n;
+        if (n > 0)
+            tn += n;
         if ((n < 0) && (errno != EAGAIN && errno != EWOULDBLOCK))
             JNU_ThrowIOExceptionWithLastError(env, "Drain");
         if (n == (int)sizeof(buf))
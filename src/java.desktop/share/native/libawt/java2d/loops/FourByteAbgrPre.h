@@ -145,6 +145,11 @@ typedef jubyte  FourByteAbgrPreDataType;
             (pRas)[4*(x)+1] = (jubyte) ((argb) >> 0); \
             (pRas)[4*(x)+2] = (jubyte) ((argb) >> 8); \
             (pRas)[4*(x)+3] = (jubyte) ((argb) >> 16); \
+        } else if (((argb) >> 24) == 0) { \
+            (pRas)[4*(x)+0] = 0; \
+            (pRas)[4*(x)+1] = 0; \
+            (pRas)[4*(x)+2] = 0; \
+            (pRas)[4*(x)+3] = 0; \
         } else { \
             jint a, r, g, b; \
             ExtractIntDcmComponents1234(argb, a, r, g, b); \
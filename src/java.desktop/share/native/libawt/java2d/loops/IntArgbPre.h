@@ -123,6 +123,8 @@ typedef jint    IntArgbPreDataType;
     do { \
         if ((((argb) >> 24) + 1) == 0) { \
             (pRas)[x] = (argb); \
+        } else if (((argb) >> 24) == 0) { \
+            (pRas)[x] = 0; \
         } else { \
             jint a, r, g, b; \
             ExtractIntDcmComponents1234(argb, a, r, g, b); \
@@ -138,12 +140,16 @@ typedef jint    IntArgbPreDataType;
 
 #define StoreIntArgbPreFrom4ByteArgb(pRas, PREFIX, x, a, r, g, b) \
     do { \
-        if ((a) != 0xff) { \
-            (r) = MUL8(a, r); \
-            (g) = MUL8(a, g); \
-            (b) = MUL8(a, b); \
+        if ((a) == 0) { \
+            (pRas)[x] = 0; \
+        } else { \
+            if ((a) != 0xff) { \
+                (r) = MUL8(a, r); \
+                (g) = MUL8(a, g); \
+                (b) = MUL8(a, b); \
+            } \
+            (pRas)[x] = ComposeIntDcmComponents1234(a, r, g, b); \
         } \
-        (pRas)[x] = ComposeIntDcmComponents1234(a, r, g, b); \
     } while (0)
 
 #define CopyIntArgbPreToIntArgbPre(pRGB, i, PREFIX, pRow, x) \
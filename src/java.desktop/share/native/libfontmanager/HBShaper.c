@@ -25,6 +25,7 @@
 
 #include <jni_util.h>
 #include <stdlib.h>
+#include <string.h>
 #include "hb.h"
 #include "hb-jdk.h"
 #include "hb-ot.h"
@@ -215,6 +216,8 @@ JDKFontInfo*
     fi->fontStrike = fontStrike;
     fi->nativeFont = pNativeFont;
     fi->aat = aat;
+    /* 0xffffffff is never looked up, see hb_jdk_get_glyph_h_advance */
+    memset(fi->advanceGlyphs, 0xff, sizeof(fi->advanceGlyphs));
     (*env)->GetFloatArrayRegion(env, matrix, 0, 4, fi->matrix);
     fi->ptSize = ptSize;
     fi->xPtSize = euclidianDistance(fi->matrix[0], fi->matrix[1]);
@@ -260,7 +263,7 @@ JNIEXPORT jboolean JNICALL Java_sun_font_SunLayoutEngine_shape
      hb_glyph_info_t *glyphInfo;
      hb_glyph_position_t *glyphPos;
      hb_direction_t direction = HB_DIRECTION_LTR;
-     hb_feature_t *features = NULL;
+     hb_feature_t features[2];
      int featureCount = 0;
      char* kern = (flags & TYPO_KERN) ? "kern" : "-kern";
      char* liga = (flags & TYPO_LIGA) ? "liga" : "-liga";
@@ -302,11 +305,8 @@ JNIEXPORT jboolean JNICALL Java_sun_font_SunLayoutEngine_shape
 
      hb_buffer_add_utf16(buffer, chars, len, offset, limit-offset);
 
-     features = calloc(2, sizeof(hb_feature_t));
-     if (features) {
-         hb_feature_from_string(kern, -1, &features[featureCount++]);
-         hb_feature_from_string(liga, -1, &features[featureCount++]);
-     }
+     hb_feature_from_string(kern, -1, &features[featureCount++]);
+     hb_feature_from_string(liga, -1, &features[featureCount++]);
 
      hb_shape_full(hbfont, buffer, features, featureCount, 0);
      glyphCount = hb_buffer_get_length(buffer);
@@ -320,7 +320,6 @@ JNIEXPORT jboolean JNICALL Java_sun_font_SunLayoutEngine_shape
      hb_buffer_destroy (buffer);
      hb_font_destroy(hbfont);
      free((void*)jdkFontInfo);
-     if (features != NULL) free(features);
      (*env)->ReleaseCharArrayElements(env, text, chars, JNI_ABORT);
      return ret;
 }
@@ -101,6 +101,11 @@ hb_jdk_get_glyph_h_advance (hb_font_t *font HB_UNUSED,
     }
 
     JDKFontInfo *jdkFontInfo = (JDKFontInfo*)font_data;
+    unsigned int slot = glyph & (HB_JDK_ADVANCE_CACHE_SIZE - 1);
+    if (jdkFontInfo->advanceGlyphs[slot] == glyph) {
+        return jdkFontInfo->advances[slot];
+    }
+
     JNIEnv* env = jdkFontInfo->env;
     jobject fontStrike = jdkFontInfo->fontStrike;
     jobject pt = env->CallObjectMethod(fontStrike,
@@ -113,7 +118,9 @@ hb_jdk_get_glyph_h_advance (hb_font_t *font HB_UNUSED,
     fadv *= jdkFontInfo->devScale;
     env->DeleteLocalRef(pt);
 
-    return HBFloatToFixed(fadv);
+    jdkFontInfo->advanceGlyphs[slot] = glyph;
+    jdkFontInfo->advances[slot] = HBFloatToFixed(fadv);
+    return jdkFontInfo->advances[slot];
 }
 
 static hb_position_t
@@ -34,6 +34,10 @@
 extern "C" {
 #endif
 
+// Number of horizontal advances remembered during one shape() call.
+// Must be a power of 2.
+#define HB_JDK_ADVANCE_CACHE_SIZE 256
+
 typedef struct JDKFontInfo_Struct {
     JNIEnv* env;
     jobject font2D;
@@ -45,6 +49,10 @@ typedef struct JDKFontInfo_Struct {
     float yPtSize;
     float devScale; // How much applying the full glyph tx scales x distance.
     jboolean aat;
+    // Direct-mapped cache of horizontal advances, so a glyph that occurs
+    // more than once in a run costs only one upcall to the strike.
+    hb_codepoint_t advanceGlyphs[HB_JDK_ADVANCE_CACHE_SIZE];
+    hb_position_t advances[HB_JDK_ADVANCE_CACHE_SIZE];
 } JDKFontInfo;
 
 
@@ -1849,6 +1849,28 @@ Java_com_sun_imageio_plugins_jpeg_JPEGImageReader_setOutColorSpace
 
 }
 
+/*
+ * Decode and discard up to count scanlines. The upsampler produces up to
+ * max_v_samp_factor rows per pass, so asking for that many at a time
+ * saves a trip through the decompression controllers for each row.
+ * rows must hold max_v_samp_factor scanlines. If the decoder returns no
+ * lines, the input ended before the image did, which is signaled as an
+ * error rather than asking for the same lines again.
+ */
+static void skipScanlines(imageIODataPtr data, j_decompress_ptr cinfo,
+                          JSAMPARRAY rows, int count)
+{
+    while ((data->abortFlag == JNI_FALSE) && (count > 0)) {
+        int n = (count < cinfo->max_v_samp_factor)
+            ? count : cinfo->max_v_samp_factor;
+        JDIMENSION read = jpeg_read_scanlines(cinfo, rows, n);
+        if (read == 0) {
+            ERREXIT(cinfo, JERR_INPUT_EOF);
+        }
+        count -= read;
+    }
+}
+
 JNIEXPORT jboolean JNICALL
 Java_com_sun_imageio_plugins_jpeg_JPEGImageReader_readImage
     (JNIEnv *env,
@@ -1875,6 +1897,7 @@ Java_com_sun_imageio_plugins_jpeg_JPEGImageReader_readImage
 
     struct jpeg_source_mgr *src;
     JSAMPROW scanLinePtr = NULL;
+    JSAMPROW skipRows[MAX_SAMP_FACTOR];
     jint bands[MAX_BANDS];
     int i;
     jint *body;
@@ -2045,8 +2068,11 @@ Java_com_sun_imageio_plugins_jpeg_JPEGImageReader_readImage
         return data->abortFlag;
     }
 
-    // Allocate a 1-scanline buffer
-    scanLinePtr = (JSAMPROW)malloc(cinfo->image_width*cinfo->output_components);
+    // Allocate a buffer with one scanline for each row produced by an
+    // upsampler pass; only the first one is used for lines we keep.
+    scanLinePtr = (JSAMPROW)malloc((size_t)cinfo->max_v_samp_factor
+                                   * cinfo->image_width
+                                   * cinfo->output_components);
     if (scanLinePtr == NULL) {
         RELEASE_ARRAYS(env, data, src->next_input_byte);
         JNU_ThrowByName( env,
@@ -2054,6 +2080,10 @@ Java_com_sun_imageio_plugins_jpeg_JPEGImageReader_readImage
                          "Reading JPEG Stream");
         return data->abortFlag;
     }
+    for (i = 0; i < cinfo->max_v_samp_factor; i++) {
+        skipRows[i] = scanLinePtr
+            + (size_t)i * cinfo->image_width * cinfo->output_components;
+    }
 
     // loop over progressive passes
     done = FALSE;
@@ -2084,10 +2114,8 @@ Java_com_sun_imageio_plugins_jpeg_JPEGImageReader_readImage
         }
 
         // Skip until the first interesting line
-        while ((data->abortFlag == JNI_FALSE)
-               && ((jint)cinfo->output_scanline < sourceYStart)) {
-            jpeg_read_scanlines(cinfo, &scanLinePtr, 1);
-        }
+        skipScanlines(data, cinfo, skipRows,
+                      sourceYStart - (jint)cinfo->output_scanline);
 
         scanlineLimit = sourceYStart+sourceHeight;
         pixelLimit = scanLinePtr
@@ -2153,9 +2181,7 @@ Java_com_sun_imageio_plugins_jpeg_JPEGImageReader_readImage
             if (skipLines > linesLeft) {
                 skipLines = linesLeft;
             }
-            for(i = 0; i < skipLines; i++) {
-                jpeg_read_scanlines(cinfo, &scanLinePtr, 1);
-            }
+            skipScanlines(data, cinfo, skipRows, skipLines);
         }
         if (progressive) {
             jpeg_finish_output(cinfo); // Increments pass counter
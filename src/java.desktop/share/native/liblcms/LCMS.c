@@ -622,6 +622,14 @@ JNIEXPORT void JNICALL Java_sun_java2d_cmm_lcms_LCMS_colorConvert
 
     if (srcAtOnce && dstAtOnce) {
         cmsDoTransform(sTrans, inputRow, outputRow, width * height);
+    } else if (srcNextRowOffset >= 0 && dstNextRowOffset >= 0) {
+        /* All rows in one call, so the transform is set up once rather
+         * than once per row. The plane sizes match what cmsDoTransform
+         * uses for a single row. LCMS keeps line strides unsigned.
+         */
+        cmsDoTransformLineStride(sTrans, inputRow, outputRow, width, height,
+                                 srcNextRowOffset, dstNextRowOffset,
+                                 width, width);
     } else {
         for (i = 0; i < height; i++) {
             cmsDoTransform(sTrans, inputRow, outputRow, width);
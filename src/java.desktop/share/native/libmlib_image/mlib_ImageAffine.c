@@ -75,6 +75,13 @@
 #include "mlib_ImageCheck.h"
 #include "mlib_ImageAffine.h"
 
+#ifndef _WIN32
+#define MLIB_AFFINE_THREADS
+#include <pthread.h>
+#include <stddef.h>
+#include <unistd.h>
+#endif /* _WIN32 */
+
 
 /***************************************************************/
 #define BUFF_SIZE  600
@@ -130,6 +137,98 @@ const type_affine_fun mlib_AffineFunArr_bc[] = {
 #define MAX_T_IND  3
 #endif /* i386 ( do not perform the coping by mlib_d64 data type for x86 ) */
 
+/***************************************************************/
+/*
+ * Bilinear and bicubic transforms with at least AFFINE_BAND_PIXELS
+ * destination pixels are split into bands of rows, each filtered on its
+ * own thread. The filter functions only read the edge tables in param
+ * and write their own rows of dst, so the bands are independent.
+ */
+#define AFFINE_BAND_PIXELS  (1 << 20)
+#define AFFINE_MAX_BANDS    8
+
+typedef struct {
+  type_affine_fun   fun;
+  mlib_affine_param param;
+  mlib_status       res;
+} mlib_affine_band;
+
+static void *mlib_ImageAffine_band(void *arg)
+{
+  mlib_affine_band *band = (mlib_affine_band *) arg;
+
+  band->res = band->fun(&band->param);
+  return NULL;
+}
+
+static mlib_status mlib_ImageAffine_bands(type_affine_fun   fun,
+                                          mlib_affine_param *param)
+{
+#ifdef MLIB_AFFINE_THREADS
+  mlib_affine_band bands[AFFINE_MAX_BANDS];
+  pthread_t tids[AFFINE_MAX_BANDS];
+  mlib_s32 started[AFFINE_MAX_BANDS];
+  mlib_s32 rows = param->yFinish - param->yStart + 1;
+  mlib_s32 nbands, i, y;
+  mlib_u8 *dstData;
+  long ncpu;
+  mlib_status res = MLIB_SUCCESS;
+
+  if (rows < 2 || (mlib_d64) rows * param->max_xsize < AFFINE_BAND_PIXELS)
+    return fun(param);
+
+  ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+  nbands = (ncpu < AFFINE_MAX_BANDS) ? (mlib_s32) ncpu : AFFINE_MAX_BANDS;
+
+  if (nbands > rows)
+    nbands = rows;
+
+  if (nbands < 2)
+    return fun(param);
+
+  /* dstData addresses the row before yStart, see CLIP */
+  y = param->yStart;
+  dstData = param->dstData;
+  for (i = 0; i < nbands; i++) {
+    mlib_s32 n = rows / nbands + (i < rows % nbands ? 1 : 0);
+
+    bands[i].fun = fun;
+    bands[i].param = *param;
+    bands[i].param.yStart = y;
+    bands[i].param.yFinish = y + n - 1;
+    bands[i].param.dstData = dstData;
+    y += n;
+    dstData += (ptrdiff_t) n * param->dstYStride;
+  }
+
+  for (i = 1; i < nbands; i++) {
+    started[i] = pthread_create(&tids[i], NULL, mlib_ImageAffine_band,
+                                &bands[i]) == 0;
+  }
+
+  mlib_ImageAffine_band(&bands[0]);
+
+  for (i = 1; i < nbands; i++) {
+    if (started[i]) {
+      pthread_join(tids[i], NULL);
+    }
+    else {
+      /* no thread for this band, do it here */
+      mlib_ImageAffine_band(&bands[i]);
+    }
+  }
+
+  for (i = 0; i < nbands; i++) {
+    if (bands[i].res != MLIB_SUCCESS)
+      res = bands[i].res;
+  }
+
+  return res;
+#else
+  return fun(param);
+#endif /* MLIB_AFFINE_THREADS */
+}
+
 /***************************************************************/
 mlib_status mlib_ImageAffine_alltypes(mlib_image       *dst,
                                       const mlib_image *src,
@@ -227,13 +326,15 @@ mlib_status mlib_ImageAffine_alltypes(mlib_image       *dst,
 
       case MLIB_BILINEAR:
 
-        res = mlib_AffineFunArr_bl[4 * t_ind + (nchan - 1)] (param);
+        res = mlib_ImageAffine_bands(mlib_AffineFunArr_bl[4 * t_ind + (nchan - 1)],
+                                     param);
         break;
 
       case MLIB_BICUBIC:
       case MLIB_BICUBIC2:
 
-        res = mlib_AffineFunArr_bc[4 * t_ind + (nchan - 1)] (param);
+        res = mlib_ImageAffine_bands(mlib_AffineFunArr_bc[4 * t_ind + (nchan - 1)],
+                                     param);
         break;
     }
 
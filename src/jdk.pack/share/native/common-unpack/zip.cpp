@@ -83,6 +83,19 @@ void jar::init(unpacker* u_) {
   u->jarout = this;
 }
 
+void jar::free() {
+  central_directory.free();
+  deflated.free();
+#ifndef NO_ZLIB
+  if (zstream != null) {
+    deflateEnd((z_stream*) zstream);
+    mtrace('f', zstream, 0);
+    ::free(zstream);
+    zstream = null;
+  }
+#endif
+}
+
 // Write data to the ZIP output stream.
 void jar::write_data(void* buff, size_t len) {
   while (len > 0) {
@@ -458,14 +471,26 @@ uLong jar::get_dostime(int modtime) {
 bool jar::deflate_bytes(bytes& head, bytes& tail) {
   int len = (int)(head.len + tail.len);
 
-  z_stream zs;
-  BYTES_OF(zs).clear();
-
-  // NOTE: the window size should always be -MAX_WBITS normally -15.
-  // unzip/zipup.c and java/Deflater.c
-
-  int error = deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
-                           -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+  // The deflater state is a few hundred kilobytes, so it is created for
+  // the first entry and reset, rather than rebuilt, for each later one.
+  int error;
+  if (zstream == null) {
+    z_stream* zsp = NEW(z_stream, 1);
+
+    // NOTE: the window size should always be -MAX_WBITS normally -15.
+    // unzip/zipup.c and java/Deflater.c
+
+    error = deflateInit2(zsp, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
+                         -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+    if (error == Z_OK) {
+      zstream = zsp;
+    } else {
+      mtrace('f', zsp, 0);
+      ::free(zsp);
+    }
+  } else {
+    error = deflateReset((z_stream*) zstream);
+  }
   if (error != Z_OK) {
     switch (error) {
     case Z_MEM_ERROR:
@@ -482,6 +507,7 @@ bool jar::deflate_bytes(bytes& head, bytes& tail) {
     }
     return false;
   }
+  z_stream& zs = *(z_stream*) zstream;
 
   deflated.empty();
   zs.next_out  = (uchar*) deflated.grow(add_size(len, (len/2)));
@@ -514,15 +540,12 @@ bool jar::deflate_bytes(bytes& head, bytes& tail) {
       // Even if compressed size is bigger than uncompressed, write it
       PRINTCR((2, "deflate compressed data %d -> %d\n", len, zs.total_out));
       deflated.b.len = zs.total_out;
-      deflateEnd(&zs);
       return true;
     }
     PRINTCR((2, "deflate expanded data %d -> %d\n", len, zs.total_out));
-    deflateEnd(&zs);
     return false;
   }
 
-  deflateEnd(&zs);
   PRINTCR((2, "Error: deflate error deflate did not finish error=%d\n",error));
   return false;
 }
@@ -45,6 +45,7 @@ struct jar {
   uint        central_directory_count;
   uint        output_file_offset;
   fillbytes   deflated;  // temporary buffer
+  void*       zstream;   // deflater state, reset between entries
 
   // pointer to outer unpacker, for error checks etc.
   unpacker* u;
@@ -59,10 +60,7 @@ struct jar {
 
   void init(unpacker* u_);
 
-  void free() {
-    central_directory.free();
-    deflated.free();
-  }
+  void free();
 
   void reset() {
     free();
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef GTEST_BENCHMARKHELPER_INLINE_HPP
+#define GTEST_BENCHMARKHELPER_INLINE_HPP
+
+#include "memory/allocation.hpp"
+#include "runtime/os.hpp"
+#include "runtime/semaphore.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "utilities/ostream.hpp"
+#include "utilities/quickSort.hpp"
+#include "threadHelper.inline.hpp"
+#include "unittest.hpp"
+
+// Timing support for BENCHMARK_VM. An operation is a functor called as
+// op(thread, worker_id, index), where index counts the calls made by one
+// worker over the whole run, so it can be used to derive unique keys.
+// Each worker runs BenchmarkWarmupSamples untimed samples followed by
+// BenchmarkSamples timed samples of ops_per_sample calls each. All workers
+// are released together, and the VM thread is blocked for the duration
+// of the run so that no safepoint disturbs the measurement.
+
+const uint BenchmarkWarmupSamples = 20;
+const uint BenchmarkSamples = 100;
+const uint BenchmarkMaxThreads = 4;
+
+static uint benchmark_thread_count() {
+  return MAX2(1U, MIN2(BenchmarkMaxThreads, (uint)os::processor_count()));
+}
+
+template <typename OP>
+class BenchmarkThread : public JavaTestThread {
+  OP& _op;
+  uint _worker_id;
+  size_t _ops_per_sample;
+  Semaphore* _start;
+  jlong* _samples;
+
+  void run_sample(size_t base) {
+    for (size_t i = 0; i < _ops_per_sample; i++) {
+      _op(this, _worker_id, base + i);
+    }
+  }
+
+public:
+  BenchmarkThread(Semaphore* post, Semaphore* start, OP& op, uint worker_id,
+                  size_t ops_per_sample, jlong* samples)
+    : JavaTestThread(post), _op(op), _worker_id(worker_id),
+      _ops_per_sample(ops_per_sample), _start(start), _samples(samples) {
+  }
+  virtual ~BenchmarkThread() {}
+
+  virtual void main_run() {
+    _start->wait();
+    size_t base = 0;
+    for (uint s = 0; s < BenchmarkWarmupSamples; s++) {
+      run_sample(base);
+      base += _ops_per_sample;
+    }
+    for (uint s = 0; s < BenchmarkSamples; s++) {
+      jlong start = os::javaTimeNanos();
+      run_sample(base);
+      _samples[s] = os::javaTimeNanos() - start;
+      base += _ops_per_sample;
+    }
+  }
+};
+
+static int benchmark_compare_samples(jlong a, jlong b) {
+  return (a < b) ? -1 : ((a > b) ? 1 : 0);
+}
+
+static void benchmark_report(const char* name, uint nthreads,
+                             size_t ops_per_sample, jlong* samples) {
+  const size_t count = (size_t)nthreads * BenchmarkSamples;
+  QuickSort::sort(samples, count, benchmark_compare_samples, false);
+
+  jlong total = 0;
+  for (size_t i = 0; i < count; i++) {
+    total += samples[i];
+  }
+  const double ops = (double)ops_per_sample;
+  const double p50 = samples[(count - 1) * 50 / 100] / ops;
+  const double p90 = samples[(count - 1) * 90 / 100] / ops;
+  const double p99 = samples[(count - 1) * 99 / 100] / ops;
+  const double max = samples[count - 1] / ops;
+  // All workers run concurrently, so the aggregate throughput is the
+  // number of workers times the throughput of an average sample.
+  const double mean_sample = (double)total / count;
+  const double ops_per_sec = nthreads * ops * NANOSECS_PER_SEC / MAX2(mean_sample, 1.0);
+
+  tty->print_cr("[benchmark] %s threads=%u ns/op p50=%.1f p90=%.1f p99=%.1f max=%.1f ops/s=%.0f",
+                name, nthreads, p50, p90, p99, max, ops_per_sec);
+
+  if (unittest_benchmark_json != NULL) {
+    fileStream out(unittest_benchmark_json, "a");
+    ASSERT_TRUE(out.is_open()) << "can not open " << unittest_benchmark_json;
+    out.print_cr("{\"benchmark\":\"%s\",\"threads\":%u,\"ops_per_sample\":" SIZE_FORMAT
+                 ",\"samples\":%u,\"p50_ns\":%.1f,\"p90_ns\":%.1f,\"p99_ns\":%.1f"
+                 ",\"max_ns\":%.1f,\"ops_per_sec\":%.0f}",
+                 name, nthreads, ops_per_sample, BenchmarkSamples,
+                 p50, p90, p99, max, ops_per_sec);
+  }
+}
+
+// Run op on nthreads workers and report the time per call.
+template <typename OP>
+static void run_benchmark(const char* name, OP& op, uint nthreads, size_t ops_per_sample) {
+  Semaphore post;
+  Semaphore start;
+  jlong* samples = NEW_C_HEAP_ARRAY(jlong, (size_t)nthreads * BenchmarkSamples, mtTest);
+
+  VMThreadBlocker* blocker = new VMThreadBlocker();
+  blocker->doit();
+  blocker->ready();
+
+  for (uint i = 0; i < nthreads; i++) {
+    BenchmarkThread<OP>* bt =
+      new BenchmarkThread<OP>(&post, &start, op, i, ops_per_sample,
+                              samples + (size_t)i * BenchmarkSamples);
+    bt->doit();
+  }
+  start.signal(nthreads);
+  for (uint i = 0; i < nthreads; i++) {
+    post.wait();
+  }
+
+  blocker->release();
+
+  benchmark_report(name, nthreads, ops_per_sample, samples);
+  FREE_C_HEAP_ARRAY(jlong, samples);
+}
+
+#endif // include guard
@@ -85,3 +85,16 @@ TEST_VM(code, dependency_context) {
   test_remove_dependent_nmethod(1);
   test_remove_dependent_nmethod(2);
 }
+
+TEST_VM(code, dependency_context_has_dependents) {
+  TestDependencyContext c;
+  DependencyContext depContext = c.dependencies();
+  ASSERT_TRUE(depContext.has_dependent_nmethods());
+
+  depContext.remove_dependent_nmethod(&c._nmethods[0]);
+  depContext.remove_dependent_nmethod(&c._nmethods[1]);
+  ASSERT_TRUE(depContext.has_dependent_nmethods());
+
+  depContext.remove_dependent_nmethod(&c._nmethods[2]);
+  ASSERT_FALSE(depContext.has_dependent_nmethods());
+}
@@ -147,3 +147,38 @@ TEST_VM(G1AdaptiveIHOPControl, simple) {
 
   EXPECT_GT(threshold, settled_ihop3);
 }
+
+// @requires UseG1GC
+TEST_VM(G1AdaptiveIHOPControl, allocation_burst) {
+  // Test requires G1
+  if (!UseG1GC) {
+    return;
+  }
+
+  const size_t initial_threshold = 45;
+  const size_t young_size = 10;
+  const size_t target_size = 100;
+
+  G1Predictions pred(0.95);
+  G1AdaptiveIHOPControl ctrl(initial_threshold, &pred, 0, 0);
+  ctrl.update_target_occupancy(target_size);
+
+  // Settle on a low allocation rate.
+  const size_t alloc_time = 2;
+  const size_t alloc_amount = 10;
+  const size_t marking_time = 2;
+  const size_t settled_ihop = target_size
+          - (young_size + alloc_amount / alloc_time * marking_time);
+
+  test_update(&ctrl, alloc_time, alloc_amount, young_size, marking_time);
+  EXPECT_EQ(settled_ihop, ctrl.get_conc_mark_start_threshold());
+
+  // A single sample with a much higher allocation rate must take
+  // effect immediately, not only after the prediction caught up.
+  const size_t burst_amount = 30;
+  const size_t burst_ihop = target_size
+          - (young_size + burst_amount / alloc_time * marking_time);
+
+  ctrl.update_allocation_info(alloc_time, burst_amount, young_size);
+  EXPECT_LE(ctrl.get_conc_mark_start_threshold(), burst_ihop);
+}
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "gc/g1/sparsePRT.hpp"
+#include "unittest.hpp"
+
+// Fill the entries of num_regions regions until they overflow and return the
+// number of cards that could be added per region.
+static int fill_until_overflow(SparsePRT* sprt, int num_regions) {
+  int added = -1;
+  for (int r = 0; r < num_regions; r++) {
+    int cards = 0;
+    while (sprt->add_card((RegionIdx_t)r, (CardIdx_t)(cards * 3 + r))) {
+      cards++;
+    }
+    if (added == -1) {
+      added = cards;
+    } else {
+      EXPECT_EQ(added, cards);
+    }
+  }
+  return added;
+}
+
+TEST_VM(SparsePRT, capacity_per_table) {
+  SparsePRT small(4);
+  SparsePRT medium(32);
+
+  // Both tables must expand a few times.
+  const int num_regions = 20;
+  int small_cards = fill_until_overflow(&small, num_regions);
+  int medium_cards = fill_until_overflow(&medium, num_regions);
+
+  ASSERT_GT(small_cards, 0);
+  ASSERT_GT(medium_cards, small_cards);
+  ASSERT_EQ((size_t)(small_cards * num_regions), small.occupied());
+  ASSERT_EQ((size_t)(medium_cards * num_regions), medium.occupied());
+  ASSERT_LT(small.mem_size(), medium.mem_size());
+
+  for (int r = 0; r < num_regions; r++) {
+    SparsePRTEntry* e = medium.get_entry((RegionIdx_t)r);
+    ASSERT_TRUE(e != NULL);
+    ASSERT_EQ(medium_cards, e->num_valid_cards());
+    for (int c = 0; c < medium_cards; c++) {
+      ASSERT_TRUE(medium.contains_card((RegionIdx_t)r, (CardIdx_t)(c * 3 + r)));
+    }
+    ASSERT_FALSE(medium.contains_card((RegionIdx_t)r, (CardIdx_t)(medium_cards * 3 + r)));
+  }
+
+  ASSERT_TRUE(medium.delete_entry(0));
+  ASSERT_EQ((size_t)(medium_cards * (num_regions - 1)), medium.occupied());
+  medium.clear();
+  ASSERT_EQ(0u, medium.occupied());
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/cardTable.hpp"
+#include "unittest.hpp"
+
+typedef CardTable::CardValue CardValue;
+
+static const size_t ncards = 8 * CardTable::clean_card_block_size;
+
+class FindFirstNonCleanCardTest : public ::testing::Test {
+protected:
+  intptr_t _storage[ncards / BytesPerWord];
+
+  CardValue* cards() {
+    return (CardValue*)_storage;
+  }
+
+  void clean_all() {
+    memset(_storage, CardTable::clean_card_val(), sizeof(_storage));
+  }
+};
+
+TEST_VM_F(FindFirstNonCleanCardTest, all_clean) {
+  clean_all();
+  for (size_t start = 0; start < ncards; start++) {
+    for (size_t end = start; end <= ncards; end++) {
+      ASSERT_EQ(cards() + end, CardTable::find_first_non_clean_card(cards() + start, cards() + end));
+    }
+  }
+}
+
+TEST_VM_F(FindFirstNonCleanCardTest, single_dirty) {
+  for (size_t dirty = 0; dirty < ncards; dirty++) {
+    clean_all();
+    cards()[dirty] = CardTable::dirty_card_val();
+    for (size_t start = 0; start < ncards; start += 3) {
+      const size_t end = ncards;
+      CardValue* const expected = (start <= dirty) ? cards() + dirty : cards() + end;
+      ASSERT_EQ(expected, CardTable::find_first_non_clean_card(cards() + start, cards() + end));
+    }
+  }
+}
+
+TEST_VM_F(FindFirstNonCleanCardTest, dirty_beyond_end) {
+  for (size_t dirty = 1; dirty < ncards; dirty++) {
+    clean_all();
+    cards()[dirty] = CardTable::dirty_card_val();
+    ASSERT_EQ(cards() + dirty, CardTable::find_first_non_clean_card(cards(), cards() + dirty));
+  }
+}
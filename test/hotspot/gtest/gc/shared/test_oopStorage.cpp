@@ -399,6 +399,44 @@ TEST_VM_F(OopStorageTest, allocate_many) {
   }
 }
 
+TEST_VM_F(OopStorageTest, bulk_allocation) {
+  static const size_t max_entries = 1000;
+  static const size_t small_request = 5;
+  oop* entries[max_entries] = {};
+
+  AllocationList& allocation_list = TestAccess::allocation_list(_storage);
+
+  // A large request takes all the entries of a fresh block, making it full.
+  size_t allocated = _storage.allocate(entries, max_entries);
+  ASSERT_NE(0u, allocated);
+  EXPECT_GE(max_entries, allocated);
+  EXPECT_EQ(allocated, _storage.allocation_count());
+  EXPECT_EQ(1u, _storage.block_count());
+  EXPECT_TRUE(is_list_empty(allocation_list));
+  for (size_t i = 0; i < allocated; ++i) {
+    ASSERT_TRUE(entries[i] != NULL);
+    EXPECT_TRUE(*entries[i] == NULL);
+  }
+
+  // Small requests return the surplus to the block, so the next small
+  // request is served from the same block.
+  size_t total = allocated;
+  for (unsigned i = 0; i < 2; ++i) {
+    size_t n = _storage.allocate(entries + total, small_request);
+    EXPECT_EQ(small_request, n);
+    total += n;
+    EXPECT_EQ(total, _storage.allocation_count());
+    EXPECT_EQ(total, total_allocation_count(_storage));
+    EXPECT_EQ(2u, _storage.block_count());
+  }
+
+  for (size_t i = 0; i < total; ++i) {
+    release_entry(_storage, entries[i]);
+  }
+  EXPECT_EQ(0u, _storage.allocation_count());
+  EXPECT_EQ(0u, total_allocation_count(_storage));
+}
+
 TEST_VM_F(OopStorageTestWithAllocation, random_release) {
   static const size_t step = 11;
   ASSERT_NE(0u, _max_entries % step); // max_entries and step are mutually prime
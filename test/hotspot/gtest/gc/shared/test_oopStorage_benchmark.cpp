@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/oopStorage.inline.hpp"
+#include "runtime/mutex.hpp"
+#include "benchmarkHelper.inline.hpp"
+#include "unittest.hpp"
+
+// Pairs of allocate and release from all workers, with a set of entries
+// kept live so that the storage has more than one block to choose from.
+class OopStorageAllocateReleaseOp {
+  OopStorage* _storage;
+public:
+  OopStorageAllocateReleaseOp(OopStorage* storage) : _storage(storage) {}
+  void operator()(Thread* thread, uint worker_id, size_t i) {
+    oop* entry = _storage->allocate();
+    assert(entry != NULL, "allocation failed");
+    _storage->release(entry);
+  }
+};
+
+const size_t BenchmarkLiveEntries = 10000;
+
+BENCHMARK_VM(OopStorage, allocate_release) {
+  Mutex allocate_mutex(Mutex::leaf, "bench_OopStorage_allocate",
+                       false, Mutex::_safepoint_check_never);
+  Mutex active_mutex(Mutex::leaf - 1, "bench_OopStorage_active",
+                     false, Mutex::_safepoint_check_never);
+  OopStorage storage("Benchmark Storage", &allocate_mutex, &active_mutex);
+
+  oop** live = NEW_C_HEAP_ARRAY(oop*, BenchmarkLiveEntries, mtTest);
+  for (size_t i = 0; i < BenchmarkLiveEntries; i++) {
+    live[i] = storage.allocate();
+  }
+  for (uint nthreads = 1; nthreads <= benchmark_thread_count(); nthreads *= 2) {
+    OopStorageAllocateReleaseOp op(&storage);
+    run_benchmark("OopStorage.allocate_release", op, nthreads, 1000);
+  }
+  storage.release(live, BenchmarkLiveEntries);
+  FREE_C_HEAP_ARRAY(oop*, live);
+}
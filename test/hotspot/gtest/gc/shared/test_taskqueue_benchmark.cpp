@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/taskqueue.inline.hpp"
+#include "benchmarkHelper.inline.hpp"
+#include "unittest.hpp"
+
+typedef GenericTaskQueue<uintptr_t, mtTest> BenchmarkTaskQueue;
+typedef GenericTaskQueueSet<BenchmarkTaskQueue, mtTest> BenchmarkTaskQueueSet;
+
+// Every worker pushes a task onto its own queue and then takes one back,
+// preferring to steal it from another worker's queue, so the owner end
+// and the stealing end of the queues are exercised at the same time.
+class TaskQueueStealOp {
+  BenchmarkTaskQueueSet* _queues;
+public:
+  TaskQueueStealOp(BenchmarkTaskQueueSet* queues) : _queues(queues) {}
+  void operator()(Thread* thread, uint worker_id, size_t i) {
+    BenchmarkTaskQueue* queue = _queues->queue(worker_id);
+    uintptr_t task = (uintptr_t)i;
+    if (!queue->push(task)) {
+      // Full because the other workers have been slow to steal.
+      queue->pop_local(task);
+      queue->push(task);
+    }
+    if (!_queues->steal(worker_id, task)) {
+      queue->pop_local(task);
+    }
+  }
+};
+
+BENCHMARK_VM(TaskQueue, steal) {
+  const uint nthreads = benchmark_thread_count();
+  BenchmarkTaskQueueSet queues(nthreads);
+  for (uint i = 0; i < nthreads; i++) {
+    BenchmarkTaskQueue* queue = new BenchmarkTaskQueue();
+    queue->initialize();
+    queues.register_queue(i, queue);
+  }
+  TaskQueueStealOp op(&queues);
+  run_benchmark("TaskQueue.push_steal", op, nthreads, 10000);
+  for (uint i = 0; i < nthreads; i++) {
+    delete queues.queue(i);
+  }
+}
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+#include "precompiled.hpp"
+#include "gc/shared/workerPolicy.hpp"
+#include "unittest.hpp"
+
+TEST(WorkerPolicy, calc_workers_for_work) {
+  // At least one worker, even without work.
+  EXPECT_EQ(1u, WorkerPolicy::calc_workers_for_work(8, 0, 100));
+  EXPECT_EQ(1u, WorkerPolicy::calc_workers_for_work(8, 1, 100));
+  EXPECT_EQ(1u, WorkerPolicy::calc_workers_for_work(8, 100, 100));
+
+  // Partial amounts of work round up.
+  EXPECT_EQ(2u, WorkerPolicy::calc_workers_for_work(8, 101, 100));
+  EXPECT_EQ(5u, WorkerPolicy::calc_workers_for_work(8, 450, 100));
+
+  // Never more than the given maximum.
+  EXPECT_EQ(8u, WorkerPolicy::calc_workers_for_work(8, 1000, 100));
+  EXPECT_EQ(8u, WorkerPolicy::calc_workers_for_work(8, SIZE_MAX, 1));
+  EXPECT_EQ(8u, WorkerPolicy::calc_workers_for_work(8, SIZE_MAX, 100));
+}
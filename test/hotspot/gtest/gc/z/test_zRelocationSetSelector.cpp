@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "gc/z/zRelocationSetSelector.hpp"
+#include "unittest.hpp"
+
+TEST(ZRelocationSetSelectorTest, budget_from_rate) {
+  // 100MB/s minus one sigma of 20MB/s, for 2 seconds
+  const size_t budget = ZRelocationSetSelector::calculate_budget(100.0 * M, 20.0 * M, 2.0, 0);
+  EXPECT_EQ(160 * M, budget);
+}
+
+TEST(ZRelocationSetSelectorTest, budget_minimum_when_oom_is_near) {
+  const size_t min_budget = 64 * M;
+  EXPECT_EQ(min_budget, ZRelocationSetSelector::calculate_budget(100.0 * M, 20.0 * M, 0.0, min_budget));
+  EXPECT_EQ(min_budget, ZRelocationSetSelector::calculate_budget(100.0 * M, 20.0 * M, -1.0, min_budget));
+  EXPECT_EQ(min_budget, ZRelocationSetSelector::calculate_budget(100.0 * M, 20.0 * M, 0.1, min_budget));
+}
+
+TEST(ZRelocationSetSelectorTest, budget_minimum_with_rate_variance) {
+  // A standard deviation larger than the average leaves no rate
+  const size_t min_budget = 8 * M;
+  EXPECT_EQ(min_budget, ZRelocationSetSelector::calculate_budget(10.0 * M, 20.0 * M, 10.0, min_budget));
+  EXPECT_EQ((size_t)0, ZRelocationSetSelector::calculate_budget(10.0 * M, 20.0 * M, 10.0, 0));
+}
+
+TEST(ZRelocationSetSelectorTest, budget_clamped) {
+  const size_t budget = ZRelocationSetSelector::calculate_budget(1.0e30, 0.0, 1.0e30, 0);
+  EXPECT_GE(budget, SIZE_MAX / 2);
+  EXPECT_LT(budget, SIZE_MAX);
+}
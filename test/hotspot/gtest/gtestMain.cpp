@@ -46,6 +46,10 @@ const static bool DEFAULT_SPAWN_IN_NEW_THREAD = true;
 const static bool DEFAULT_SPAWN_IN_NEW_THREAD = false;
 #endif
 
+// Set by -benchmark and -benchmark-json=<file>, see BENCHMARK_VM.
+bool unittest_benchmark_mode = false;
+const char* unittest_benchmark_json = NULL;
+
 static bool is_prefix(const char* prefix, const char* str) {
   return strncmp(str, prefix, strlen(prefix)) == 0;
 }
@@ -157,6 +161,17 @@ static bool get_spawn_new_main_thread_arg(int argc, char** argv) {
   return DEFAULT_SPAWN_IN_NEW_THREAD;
 }
 
+static void get_benchmark_args(int argc, char** argv) {
+  for (int i = 0; i < argc; i++) {
+    if (is_prefix("-benchmark-json=", argv[i])) {
+      unittest_benchmark_mode = true;
+      unittest_benchmark_json = argv[i] + strlen("-benchmark-json=");
+    } else if (strcmp(argv[i], "-benchmark") == 0) {
+      unittest_benchmark_mode = true;
+    }
+  }
+}
+
 static int num_args_to_skip(char* arg) {
   if (strcmp(arg, "-jdk") == 0) {
     return 2; // skip the argument after -jdk as well
@@ -170,6 +185,9 @@ static int num_args_to_skip(char* arg) {
   if (is_prefix("-new-thread", arg)) {
     return 1;
   }
+  if (is_prefix("-benchmark", arg)) {
+    return 1;
+  }
   return 0;
 }
 
@@ -237,6 +255,7 @@ static void runUnitTestsInner(int argc, char** argv) {
   sprintf_s(envString, len, "%s=%s", java_home_var, java_home);
   _putenv(envString);
 #endif // _WIN32
+  get_benchmark_args(argc, argv);
   argv = remove_test_runner_arguments(&argc, argv);
 
   if (is_vmassert_test || is_othervm_test) {
@@ -24,7 +24,9 @@
 #include "precompiled.hpp"
 #include "jvm.h"
 #include "logTestUtils.inline.hpp"
+#include "logging/logDecorations.hpp"
 #include "logging/logFileOutput.hpp"
+#include "logging/logTagSet.hpp"
 #include "memory/resourceArea.hpp"
 #include "runtime/os.hpp"
 #include "unittest.hpp"
@@ -178,3 +180,34 @@ TEST_VM(LogFileOutput, invalid_file) {
     << "missing expected error message, received msg: %s" << ss.as_string();
   delete_empty_directory("tmplogdir");
 }
+
+// The decorations formatted for the AsyncLog Thread match the ones written
+// by synchronous logging, and are truncated to fit the buffer.
+TEST_VM(LogFileOutput, format_decorations) {
+  const LogTagSet& tagset = LogTagSetMapping<LOG_TAGS(logging)>::tagset();
+  LogDecorators decorators;
+  ASSERT_TRUE(decorators.parse("level,tags"));
+  LogDecorations decorations(LogLevel::Info, tagset, decorators);
+
+  {
+    LogFileOutput fo(name);
+    LogFileOutput::set_file_name_parameters(0);
+    ResourceMark rm;
+    stringStream ss;
+    ASSERT_TRUE(fo.initialize("", &ss)) << ss.as_string();
+    fo.set_decorators(decorators);
+
+    char buf[LogDecorations::DecorationsBufferSize];
+    fo.format_decorations(decorations, buf, sizeof(buf));
+    EXPECT_STREQ("[info][logging] ", buf);
+
+    char small[10];
+    fo.format_decorations(decorations, small, sizeof(small));
+    EXPECT_STREQ("[info]", small);
+
+    fo.set_decorators(LogDecorators::None);
+    fo.format_decorations(decorations, buf, sizeof(buf));
+    EXPECT_STREQ("", buf);
+    remove(fo.cur_log_file_name());
+  }
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "memory/arena.hpp"
+#include "benchmarkHelper.inline.hpp"
+#include "unittest.hpp"
+
+// Every worker allocates from an arena of its own, and empties it every
+// BenchmarkArenaResetInterval allocations, so the cost of getting and
+// returning chunks is included in the measurement.
+const size_t BenchmarkArenaResetInterval = 1024;
+
+class ArenaAllocOp {
+  Arena** _arenas;
+  size_t _size;
+public:
+  ArenaAllocOp(Arena** arenas, size_t size) : _arenas(arenas), _size(size) {}
+  void operator()(Thread* thread, uint worker_id, size_t i) {
+    Arena* arena = _arenas[worker_id];
+    void* p = arena->Amalloc(_size);
+    assert(p != NULL, "allocation failed");
+    if ((i % BenchmarkArenaResetInterval) == BenchmarkArenaResetInterval - 1) {
+      arena->destruct_contents();
+    }
+  }
+};
+
+static void benchmark_arena(const char* name, size_t size) {
+  const uint nthreads = benchmark_thread_count();
+  Arena* arenas[BenchmarkMaxThreads];
+  for (uint i = 0; i < nthreads; i++) {
+    arenas[i] = new Arena(mtTest);
+  }
+  ArenaAllocOp op(arenas, size);
+  run_benchmark(name, op, nthreads, 10000);
+  for (uint i = 0; i < nthreads; i++) {
+    delete arenas[i];
+  }
+}
+
+BENCHMARK_VM(Arena, alloc_small) {
+  benchmark_arena("Arena.Amalloc.16", 16);
+}
+
+BENCHMARK_VM(Arena, alloc_large) {
+  benchmark_arena("Arena.Amalloc.512", 512);
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "code/codeBlob.hpp"
+#include "memory/heap.hpp"
+#include "memory/virtualspace.hpp"
+#include "runtime/os.hpp"
+#include "unittest.hpp"
+
+static const size_t heap_size = 1 * M;
+
+static size_t block_size(int segments) {
+  return segments * CodeCacheSegmentSize - CodeHeap::header_size();
+}
+
+TEST_VM(CodeHeap, free_top_block) {
+  ReservedCodeSpace rs(heap_size, os::vm_allocation_granularity(), false);
+  ASSERT_TRUE(rs.is_reserved());
+  CodeHeap heap("test", CodeBlobType::All);
+  ASSERT_TRUE(heap.reserve(rs, heap_size, CodeCacheSegmentSize));
+
+  void* a = heap.allocate(block_size(8));
+  void* b = heap.allocate(block_size(8));
+  ASSERT_TRUE(a != NULL && b != NULL);
+  ASSERT_EQ(16, heap.allocated_segments());
+
+  // Freeing the top block returns it to the unallocated space
+  heap.deallocate(b);
+  EXPECT_EQ(8, heap.allocated_segments());
+  EXPECT_EQ(0, heap.freelist_length());
+
+  // and the next allocation is placed right behind 'a' again
+  void* c = heap.allocate(block_size(16));
+  EXPECT_EQ(b, c);
+  EXPECT_EQ(24, heap.allocated_segments());
+
+  rs.release();
+}
+
+TEST_VM(CodeHeap, free_top_block_below_free_block) {
+  ReservedCodeSpace rs(heap_size, os::vm_allocation_granularity(), false);
+  ASSERT_TRUE(rs.is_reserved());
+  CodeHeap heap("test", CodeBlobType::All);
+  ASSERT_TRUE(heap.reserve(rs, heap_size, CodeCacheSegmentSize));
+
+  void* a = heap.allocate(block_size(8));
+  void* b = heap.allocate(block_size(8));
+  void* c = heap.allocate(block_size(8));
+  ASSERT_TRUE(a != NULL && b != NULL && c != NULL);
+
+  heap.deallocate(b);
+  EXPECT_EQ(24, heap.allocated_segments());
+  EXPECT_EQ(1, heap.freelist_length());
+
+  // The free block below the top block is released together with it
+  heap.deallocate(c);
+  EXPECT_EQ(8, heap.allocated_segments());
+  EXPECT_EQ(0, heap.freelist_length());
+  EXPECT_EQ(0u, heap.allocated_in_freelist());
+
+  void* d = heap.allocate(block_size(24));
+  EXPECT_EQ(b, d);
+
+  rs.release();
+}
+
+TEST_VM(CodeHeap, freelist_search_skipped_when_no_block_fits) {
+  ReservedCodeSpace rs(heap_size, os::vm_allocation_granularity(), false);
+  ASSERT_TRUE(rs.is_reserved());
+  CodeHeap heap("test", CodeBlobType::All);
+  ASSERT_TRUE(heap.reserve(rs, heap_size, CodeCacheSegmentSize));
+
+  void* a = heap.allocate(block_size(8));
+  void* b = heap.allocate(block_size(8));
+  void* c = heap.allocate(block_size(8));
+  ASSERT_TRUE(a != NULL && b != NULL && c != NULL);
+  heap.deallocate(b);
+  ASSERT_EQ(1, heap.freelist_length());
+
+  // Too large for the free block: the free list is not walked
+  julong steps = heap.freelist_search_steps();
+  void* d = heap.allocate(block_size(16));
+  EXPECT_TRUE(d != NULL);
+  EXPECT_EQ(steps, heap.freelist_search_steps());
+  EXPECT_EQ(1, heap.freelist_length());
+
+  // A block that fits is still found on the free list
+  void* e = heap.allocate(block_size(8));
+  EXPECT_EQ(b, e);
+  EXPECT_EQ(0, heap.freelist_length());
+
+  rs.release();
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "runtime/stubRoutines.hpp"
+#include "unittest.hpp"
+
+typedef jint (*hashcode_stub_t)(const void* ary, jint cnt, jint result);
+
+static const int max_length = 100;
+
+template <typename T, typename U>
+static jint scalar_hashcode(const T* ary, int cnt, jint result) {
+  juint h = (juint)result;
+  for (int i = 0; i < cnt; i++) {
+    h = 31 * h + (juint)(jint)(U)ary[i];
+  }
+  return (jint)h;
+}
+
+template <typename T, typename U>
+static void test_hashcode(BasicType t) {
+  const char* name;
+  address stub = StubRoutines::select_hashcode_function(t, name);
+  if (stub == NULL) {
+    return; // not available on this platform
+  }
+  hashcode_stub_t hashcode = CAST_TO_FN_PTR(hashcode_stub_t, stub);
+
+  T ary[max_length];
+  for (int i = 0; i < max_length; i++) {
+    // Cover the values that differ between signed and unsigned loads
+    ary[i] = (T)(i * 0x9e3779b9u + 0x80);
+  }
+  for (int start = 0; start < 3; start++) {
+    for (int cnt = 0; start + cnt <= max_length; cnt++) {
+      ASSERT_EQ((scalar_hashcode<T, U>(ary + start, cnt, 1)), hashcode(ary + start, cnt, 1))
+        << name << " start " << start << " cnt " << cnt;
+      ASSERT_EQ((scalar_hashcode<T, U>(ary + start, cnt, 0)), hashcode(ary + start, cnt, 0))
+        << name << " start " << start << " cnt " << cnt;
+    }
+  }
+}
+
+TEST_VM(StubRoutines, jbyte_hashcode) {
+  test_hashcode<jbyte, jbyte>(T_BYTE);
+}
+
+TEST_VM(StubRoutines, jubyte_hashcode) {
+  test_hashcode<jbyte, jubyte>(T_BOOLEAN);
+}
+
+TEST_VM(StubRoutines, jchar_hashcode) {
+  test_hashcode<jchar, jchar>(T_CHAR);
+}
+
+TEST_VM(StubRoutines, jint_hashcode) {
+  test_hashcode<jint, jint>(T_INT);
+}
@@ -96,6 +96,25 @@
                                                                     \
   void test_ ## category ## _ ## name ## _()
 
+// Benchmarks are only run when the launcher is given -benchmark; otherwise
+// they show up as trivially passing tests so that the code keeps compiling
+// and the filter names stay stable. The results are printed and, with
+// -benchmark-json=<file>, appended to the given file as one JSON object
+// per line. See benchmarkHelper.inline.hpp for the timing loop.
+extern bool unittest_benchmark_mode;
+extern const char* unittest_benchmark_json;
+
+#define BENCHMARK_VM(category, name)                                \
+  static void benchmark_ ## category ## _ ## name ## _();           \
+                                                                    \
+  TEST_VM(category, CONCAT(name, _benchmark)) {                     \
+    if (unittest_benchmark_mode) {                                  \
+      benchmark_ ## category ## _ ## name ## _();                   \
+    }                                                               \
+  }                                                                 \
+                                                                    \
+  void benchmark_ ## category ## _ ## name ## _()
+
 #ifdef ASSERT
 #define TEST_VM_ASSERT(category, name)                              \
   static void test_  ## category ## _ ## name ## _();               \
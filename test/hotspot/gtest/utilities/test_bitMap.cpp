@@ -130,3 +130,23 @@ TEST_VM(BitMap, reinitialize) {
   BitMapTest::testReinitialize(BitMapTest::BITMAP_SIZE >> 3);
   BitMapTest::testReinitialize(BitMapTest::BITMAP_SIZE);
 }
+
+TEST_VM(BitMap, count_one_bits) {
+  ResourceMark rm;
+  const BitMap::idx_t size = BitMapTest::BITMAP_SIZE + 3;
+  ResourceBitMap map(size);
+  for (BitMap::idx_t i = 0; i < size; i += 3) {
+    map.set_bit(i);
+  }
+  map.set_range(200, 300);
+  EXPECT_EQ(map.count_one_bits(0, size), map.count_one_bits());
+  for (BitMap::idx_t beg = 0; beg < size; beg += 7) {
+    BitMap::idx_t expected = 0;
+    for (BitMap::idx_t end = beg; end <= size; end++) {
+      EXPECT_EQ(expected, map.count_one_bits(beg, end)) << "[" << beg << ", " << end << ")";
+      if (end < size && map.at(end)) {
+        expected++;
+      }
+    }
+  }
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "utilities/bitMap.inline.hpp"
+#include "benchmarkHelper.inline.hpp"
+#include "unittest.hpp"
+
+const BitMap::idx_t BenchmarkBitMapSize = 1024 * 1024;
+
+// Look for the next set bit from a pseudo-random position in a map whose
+// bits are set at the given stride, so each search scans stride / 2 bits
+// on average.
+class BitMapSearchOp {
+  const BitMap* _map;
+public:
+  BitMapSearchOp(const BitMap* map) : _map(map) {}
+  void operator()(Thread* thread, uint worker_id, size_t i) {
+    BitMap::idx_t start = (BitMap::idx_t)((i * 40503 + worker_id) % BenchmarkBitMapSize);
+    BitMap::idx_t found = _map->get_next_one_offset(start);
+    assert(found <= BenchmarkBitMapSize, "out of range");
+  }
+};
+
+static void benchmark_bitmap_search(const char* name, BitMap::idx_t stride) {
+  CHeapBitMap map(BenchmarkBitMapSize, mtTest);
+  for (BitMap::idx_t bit = 0; bit < BenchmarkBitMapSize; bit += stride) {
+    map.set_bit(bit);
+  }
+  BitMapSearchOp op(&map);
+  run_benchmark(name, op, benchmark_thread_count(), 10000);
+}
+
+BENCHMARK_VM(BitMap, search_dense) {
+  benchmark_bitmap_search("BitMap.get_next_one_offset.dense", 17);
+}
+
+BENCHMARK_VM(BitMap, search_sparse) {
+  benchmark_bitmap_search("BitMap.get_next_one_offset.sparse", 4099);
+}
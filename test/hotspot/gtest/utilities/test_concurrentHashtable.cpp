@@ -127,6 +127,27 @@ static void cht_get_insert(Thread* thr) {
   delete cht;
 }
 
+static void cht_insert_batch(Thread* thr) {
+  SimpleTestTable* cht = new SimpleTestTable();
+  SimpleTestLookup stl(0x3);
+  EXPECT_TRUE(cht->insert(thr, stl, (uintptr_t)0x3)) << "Insert unique value failed.";
+  SimpleTestLookup lookups[] = { SimpleTestLookup(0x1), SimpleTestLookup(0x2),
+                                 SimpleTestLookup(0x3), SimpleTestLookup(0x4),
+                                 SimpleTestLookup(0x2) };
+  uintptr_t values[] = { 0x1, 0x2, 0x3, 0x4, 0x2 };
+  bool inserted[5];
+  EXPECT_EQ(cht->insert_batch(thr, lookups, values, 5, inserted), (size_t)3) << "Wrong number of inserted values.";
+  EXPECT_TRUE(inserted[0]) << "Unique value not inserted.";
+  EXPECT_TRUE(inserted[1]) << "Unique value not inserted.";
+  EXPECT_FALSE(inserted[2]) << "Value already in table inserted.";
+  EXPECT_TRUE(inserted[3]) << "Unique value not inserted.";
+  EXPECT_FALSE(inserted[4]) << "Duplicate in batch inserted.";
+  for (uintptr_t val = 0x1; val <= 0x4; val++) {
+    cht_find(thr, cht, val);
+  }
+  delete cht;
+}
+
 static bool getinsert_bulkdelete_eval(uintptr_t* val) {
   EXPECT_TRUE(*val > 0 && *val < 4) << "Val wrong for this test.";
   return (*val & 0x1); // Delete all values ending with first bit set.
@@ -378,6 +399,10 @@ TEST_VM(ConcurrentHashTable, basic_insert) {
   nomt_test_doer(cht_insert);
 }
 
+TEST_VM(ConcurrentHashTable, basic_insert_batch) {
+  nomt_test_doer(cht_insert_batch);
+}
+
 TEST_VM(ConcurrentHashTable, basic_get_insert) {
   nomt_test_doer(cht_get_insert);
 }
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "runtime/thread.hpp"
+#include "utilities/concurrentHashTable.inline.hpp"
+#include "benchmarkHelper.inline.hpp"
+#include "unittest.hpp"
+
+struct BenchmarkPointer : public AllStatic {
+  typedef uintptr_t Value;
+  static uintx get_hash(const Value& value, bool* dead_hash) {
+    return (uintx)value;
+  }
+  static void* allocate_node(size_t size, const Value& value) {
+    return ::malloc(size);
+  }
+  static void free_node(void* memory, const Value& value) {
+    ::free(memory);
+  }
+};
+
+typedef ConcurrentHashTable<BenchmarkPointer, mtInternal> BenchmarkTable;
+
+struct BenchmarkLookup {
+  uintptr_t _val;
+  BenchmarkLookup(uintptr_t val) : _val(val) {}
+  uintx get_hash() {
+    // Spread consecutive keys over the buckets.
+    return (uintx)(_val * 0x9E3779B97F4A7C15ULL);
+  }
+  bool equals(const uintptr_t* value, bool* is_dead) {
+    return _val == *value;
+  }
+};
+
+struct BenchmarkFound {
+  uintptr_t _found;
+  BenchmarkFound() : _found(0) {}
+  void operator()(uintptr_t* value) {
+    _found = *value;
+  }
+};
+
+const size_t BenchmarkTableLogSize = 16;
+const uintptr_t BenchmarkTableEntries = 1 << BenchmarkTableLogSize;
+
+// Each worker inserts keys of its own, so every insert adds a node.
+class CHTInsertOp {
+  BenchmarkTable* _table;
+public:
+  CHTInsertOp(BenchmarkTable* table) : _table(table) {}
+  void operator()(Thread* thread, uint worker_id, size_t i) {
+    uintptr_t key = ((uintptr_t)(worker_id + 1) << (BitsPerWord / 2)) | (uintptr_t)i;
+    BenchmarkLookup lookup(key);
+    _table->insert(thread, lookup, key);
+  }
+};
+
+class CHTLookupOp {
+  BenchmarkTable* _table;
+public:
+  CHTLookupOp(BenchmarkTable* table) : _table(table) {}
+  void operator()(Thread* thread, uint worker_id, size_t i) {
+    uintptr_t key = (uintptr_t)((i * 7 + worker_id) % BenchmarkTableEntries) + 1;
+    BenchmarkLookup lookup(key);
+    BenchmarkFound found;
+    _table->get(thread, lookup, found);
+  }
+};
+
+BENCHMARK_VM(ConcurrentHashTable, insert) {
+  for (uint nthreads = 1; nthreads <= benchmark_thread_count(); nthreads *= 2) {
+    BenchmarkTable* table = new BenchmarkTable(BenchmarkTableLogSize);
+    CHTInsertOp op(table);
+    run_benchmark("ConcurrentHashTable.insert", op, nthreads, 100);
+    delete table;
+  }
+}
+
+BENCHMARK_VM(ConcurrentHashTable, lookup) {
+  Thread* thread = Thread::current();
+  BenchmarkTable* table = new BenchmarkTable(BenchmarkTableLogSize);
+  for (uintptr_t key = 1; key <= BenchmarkTableEntries; key++) {
+    BenchmarkLookup lookup(key);
+    table->insert(thread, lookup, key);
+  }
+  for (uint nthreads = 1; nthreads <= benchmark_thread_count(); nthreads *= 2) {
+    CHTLookupOp op(table);
+    run_benchmark("ConcurrentHashTable.lookup", op, nthreads, 10000);
+  }
+  delete table;
+}
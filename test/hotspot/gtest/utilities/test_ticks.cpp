@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "runtime/os.hpp"
+#include "unittest.hpp"
+#include "utilities/ticks.hpp"
+
+TEST_VM(FastTicks, agrees_with_elapsed_counter) {
+  const jlong wait_ns = 20 * NANOSECS_PER_MILLISEC;
+
+  const Ticks start = Ticks::now();
+  const FastTicks fast_start = FastTicks::now();
+  while ((Ticks::now() - start).nanoseconds() < (uint64_t)wait_ns) {
+    // Spin so that both clocks keep running on the same CPU as far as possible.
+  }
+  const FastTickspan fast = FastTicks::now() - fast_start;
+  const Tickspan elapsed = Ticks::now() - start;
+
+  EXPECT_GT(fast, FastTickspan());
+  // The calibration of the fast counter is not exact, so only check that the
+  // two time sources agree roughly.
+  EXPECT_GE(fast.seconds(), elapsed.seconds() / 2);
+  EXPECT_LE(fast.seconds(), elapsed.seconds() * 2);
+}
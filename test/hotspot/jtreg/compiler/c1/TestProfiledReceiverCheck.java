@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+/*
+ * @test
+ * @summary C1 binds a call site with a monomorphic receiver profile to the
+ *          profiled receiver's method, deoptimizes when another receiver
+ *          shows up and does not speculate again after that.
+ * @requires vm.compiler1.enabled & vm.flavor == "server" & vm.opt.TieredStopAtLevel == null
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ * @build sun.hotspot.WhiteBox
+ * @run driver ClassFileInstaller sun.hotspot.WhiteBox
+ *                                sun.hotspot.WhiteBox$WhiteBoxPermission
+ * @run main/othervm -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *                   -Xbatch -XX:+TieredCompilation -XX:TieredStopAtLevel=3
+ *                   -XX:CompileCommand=compileonly,compiler.c1.TestProfiledReceiverCheck::test
+ *                   compiler.c1.TestProfiledReceiverCheck speculate
+ * @run main/othervm -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *                   -Xbatch -XX:+TieredCompilation -XX:TieredStopAtLevel=3
+ *                   -XX:CompileCommand=compileonly,compiler.c1.TestProfiledReceiverCheck::test
+ *                   -XX:-C1InlineProfiledReceiver
+ *                   compiler.c1.TestProfiledReceiverCheck noSpeculation
+ */
+
+package compiler.c1;
+
+import java.lang.reflect.Method;
+
+import sun.hotspot.WhiteBox;
+
+public class TestProfiledReceiverCheck {
+
+    static final WhiteBox WB = WhiteBox.getWhiteBox();
+    static final int COMP_LEVEL_SIMPLE = 1;
+
+    static abstract class Base {
+        abstract int value();
+    }
+
+    static class A extends Base {
+        int value() { return 1; }
+    }
+
+    static class B extends Base {
+        int value() { return 2; }
+    }
+
+    static final A a = new A();
+    // loaded and initialized so that CHA cannot bind the call
+    static final B b = new B();
+
+    static int test(Base base) {
+        return base.value();
+    }
+
+    static void check(Base base, int expected) {
+        int r = test(base);
+        if (r != expected) {
+            throw new RuntimeException("test(" + base.getClass().getSimpleName() + ") = " + r +
+                                       ", expected " + expected);
+        }
+    }
+
+    static void compileAtLevel1(Method m) {
+        WB.deoptimizeMethod(m);
+        if (!WB.enqueueMethodForCompilation(m, COMP_LEVEL_SIMPLE) ||
+            WB.getMethodCompilationLevel(m) != COMP_LEVEL_SIMPLE) {
+            throw new RuntimeException("could not compile " + m + " at level 1");
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        boolean speculate = args[0].equals("speculate");
+        Method m = TestProfiledReceiverCheck.class.getDeclaredMethod("test", Base.class);
+
+        // Collect a monomorphic receiver profile
+        for (int i = 0; i < 20_000; i++) {
+            check(a, 1);
+        }
+
+        compileAtLevel1(m);
+        check(a, 1);
+        if (!WB.isMethodCompiled(m)) {
+            throw new RuntimeException("deoptimized with the profiled receiver");
+        }
+
+        // Another receiver fails the speculative check, if there is one
+        check(b, 2);
+        if (WB.isMethodCompiled(m) == speculate) {
+            throw new RuntimeException(speculate ? "not deoptimized by an unexpected receiver"
+                                                 : "deoptimized without speculation");
+        }
+
+        // The recompiled code keeps the virtual call
+        compileAtLevel1(m);
+        check(b, 2);
+        check(a, 1);
+        if (!WB.isMethodCompiled(m)) {
+            throw new RuntimeException("deoptimized again after recompilation");
+        }
+    }
+}
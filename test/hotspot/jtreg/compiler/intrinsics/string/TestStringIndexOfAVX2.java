@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+/*
+ * @test
+ * @summary Check the AVX2 String.indexOf intrinsic for Latin-1 strings
+ *          against a reference search.
+ * @requires os.arch == "amd64" | os.arch == "x86_64"
+ * @requires vm.cpu.features ~= ".*avx2.*"
+ * @run main/othervm -XX:UseAVX=2 -XX:-TieredCompilation -Xbatch -XX:-UseOnStackReplacement
+ *                   compiler.intrinsics.string.TestStringIndexOfAVX2
+ */
+
+package compiler.intrinsics.string;
+
+import java.util.Random;
+
+public class TestStringIndexOfAVX2 {
+
+    static int test(String s, String pattern) {
+        return s.indexOf(pattern);
+    }
+
+    static int reference(String s, String pattern) {
+        outer:
+        for (int i = 0; i + pattern.length() <= s.length(); i++) {
+            for (int j = 0; j < pattern.length(); j++) {
+                if (s.charAt(i + j) != pattern.charAt(j)) {
+                    continue outer;
+                }
+            }
+            return i;
+        }
+        return -1;
+    }
+
+    static String randomLatin1(Random r, int length, int alphabet) {
+        char[] c = new char[length];
+        for (int i = 0; i < length; i++) {
+            c[i] = (char)('a' + r.nextInt(alphabet));
+        }
+        return new String(c);
+    }
+
+    static void check(String s, String pattern) {
+        int expected = reference(s, pattern);
+        int actual = test(s, pattern);
+        if (actual != expected) {
+            throw new RuntimeException("\"" + s + "\".indexOf(\"" + pattern + "\") = " + actual +
+                                       ", expected " + expected);
+        }
+    }
+
+    public static void main(String[] args) {
+        Random r = new Random(42);
+        for (int iter = 0; iter < 200_000; iter++) {
+            int length = r.nextInt(100);
+            // small alphabets make the first and last characters match often
+            String s = randomLatin1(r, length, 1 + r.nextInt(4));
+            String pattern;
+            if (length > 0 && r.nextBoolean()) {
+                int start = r.nextInt(length);
+                pattern = s.substring(start, start + r.nextInt(Math.min(length - start, 40) + 1));
+            } else {
+                pattern = randomLatin1(r, r.nextInt(40), 1 + r.nextInt(4));
+            }
+            check(s, pattern);
+        }
+        // Latin-1 characters above 0x7f
+        check("été à ÿþÿþý", "ÿþý");
+        check("ÿÿÿÿÿÿÿÿÿÿÿÿÿÿÿÿÿ", "ÿþ");
+    }
+}
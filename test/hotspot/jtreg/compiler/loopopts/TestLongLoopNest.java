@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+/*
+ * @test
+ * @summary Loops with a long induction variable turned into loop nests
+ *          must compute the same results as the original loops
+ *
+ * @run main/othervm -XX:-TieredCompilation -Xbatch -XX:-UseOnStackReplacement
+ *                   -XX:+UseLongLoopNests
+ *                   compiler.loopopts.TestLongLoopNest
+ * @run main/othervm -XX:-TieredCompilation -Xbatch -XX:-UseOnStackReplacement
+ *                   -XX:-UseLongLoopNests
+ *                   compiler.loopopts.TestLongLoopNest
+ */
+
+package compiler.loopopts;
+
+public class TestLongLoopNest {
+
+    private static final int ITERATIONS = 20_000;
+
+    static long upLt(long init, long limit) {
+        long sum = 0;
+        for (long i = init; i < limit; i++) {
+            sum += i;
+        }
+        return sum;
+    }
+
+    static long upLe(long init, long limit) {
+        long sum = 0;
+        for (long i = init; i <= limit; i += 3) {
+            sum += i;
+        }
+        return sum;
+    }
+
+    static long downGt(long init, long limit) {
+        long sum = 0;
+        for (long i = init; i > limit; i--) {
+            sum += i;
+        }
+        return sum;
+    }
+
+    static long downGe(long init, long limit) {
+        long sum = 0;
+        for (long i = init; i >= limit; i -= 7) {
+            sum += i;
+        }
+        return sum;
+    }
+
+    // A large stride so that the inner loop only runs a few iterations
+    // and the outer loop is taken many times.
+    static long largeStrideUp(long init, long limit) {
+        long sum = 0;
+        for (long i = init; i < limit; i += (1 << 24)) {
+            sum += i ^ (sum >>> 3);
+        }
+        return sum;
+    }
+
+    static long largeStrideDown(long init, long limit) {
+        long sum = 0;
+        for (long i = init; i >= limit; i -= (1 << 24)) {
+            sum += i ^ (sum >>> 3);
+        }
+        return sum;
+    }
+
+    // The exit test is on the loop phi rather than on the increment.
+    static long lastValue(long init, long limit) {
+        long i = init;
+        long last = 0;
+        while (i < limit) {
+            last = i;
+            i += 5;
+        }
+        return last * 31 + i;
+    }
+
+    static long earlyExit(long init, long limit, long stop, int[] a) {
+        long sum = 0;
+        for (long i = init; i < limit; i++) {
+            if (i == stop) {
+                return sum * 31 + i;
+            }
+            sum += a[(int)(i & (a.length - 1))];
+        }
+        return -sum;
+    }
+
+    interface Loop {
+        long run();
+    }
+
+    static void check(String name, Loop loop) {
+        // The first run is interpreted: OSR is off and the method was
+        // not invoked before.
+        long expected = loop.run();
+        for (int i = 0; i < ITERATIONS; i++) {
+            long result = loop.run();
+            if (result != expected) {
+                throw new RuntimeException(name + ": expected " + expected + " but got " + result);
+            }
+        }
+    }
+
+    public static void main(String[] args) {
+        int[] a = new int[64];
+        for (int i = 0; i < a.length; i++) {
+            a[i] = i * 17 + 3;
+        }
+
+        check("upLt", () -> upLt(-500, 500));
+        check("upLt empty", () -> upLt(500, -500) + upLt(-500, 500));
+        check("upLt max", () -> upLt(Long.MAX_VALUE - 1000, Long.MAX_VALUE));
+        check("upLe", () -> upLe(-1000, 1000));
+        check("upLe max", () -> upLe(Long.MAX_VALUE - 1003, Long.MAX_VALUE - 3));
+        check("upLe min", () -> upLe(Long.MIN_VALUE, Long.MIN_VALUE + 1000));
+        check("downGt", () -> downGt(500, -500));
+        check("downGt min", () -> downGt(Long.MIN_VALUE + 1000, Long.MIN_VALUE));
+        check("downGe", () -> downGe(1000, -1000));
+        check("downGe min", () -> downGe(Long.MIN_VALUE + 1007, Long.MIN_VALUE + 7));
+        check("downGe max", () -> downGe(Long.MAX_VALUE, Long.MAX_VALUE - 1000));
+        check("largeStrideUp", () -> largeStrideUp(-(1L << 35), 1L << 35));
+        check("largeStrideUp max", () -> largeStrideUp(Long.MAX_VALUE - (1L << 36), Long.MAX_VALUE - (1L << 24)));
+        check("largeStrideDown", () -> largeStrideDown(1L << 35, -(1L << 35)));
+        check("largeStrideDown min", () -> largeStrideDown(Long.MIN_VALUE + (1L << 36), Long.MIN_VALUE + (1L << 24)));
+        check("largeStrideUp wide", () -> largeStrideUp(Long.MIN_VALUE / 2, Long.MIN_VALUE / 2 + (1L << 36)));
+        check("lastValue", () -> lastValue(-1000, 1000));
+        check("lastValue max", () -> lastValue(Long.MAX_VALUE - 1000, Long.MAX_VALUE - 5));
+        check("earlyExit", () -> earlyExit(-1000, 1000, 123, a));
+        check("earlyExit none", () -> earlyExit(-1000, 1000, 5000, a));
+        check("earlyExit first", () -> earlyExit(-1000, 1000, -1000, a));
+    }
+}
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+/*
+ * @test
+ * @summary Locks coarsened across the iterations of an unrolled loop must
+ *          still exclude other threads, and the loop must compute the same result
+ *
+ * @run main/othervm -XX:-TieredCompilation -XX:-BackgroundCompilation
+ *                   -XX:LoopLockCoarseningLimit=4
+ *                   compiler.loopopts.TestLoopLockCoarsening
+ * @run main/othervm -XX:-TieredCompilation -XX:-BackgroundCompilation
+ *                   -XX:LoopLockCoarseningLimit=8
+ *                   compiler.loopopts.TestLoopLockCoarsening
+ * @run main/othervm -XX:-TieredCompilation -XX:-BackgroundCompilation
+ *                   -XX:LoopLockCoarseningLimit=0
+ *                   compiler.loopopts.TestLoopLockCoarsening
+ */
+
+package compiler.loopopts;
+
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.atomic.AtomicBoolean;
+
+public class TestLoopLockCoarsening {
+
+    private static final int THREADS = 4;
+    private static final int ITERATIONS = 2_000;
+    private static final int LOOP_COUNT = 1_000;
+
+    private final Object lock = new Object();
+    private int counter;
+    private int holders;
+    private final AtomicBoolean overlap = new AtomicBoolean();
+
+    // The lock is taken for each iteration of a counted loop on a loop
+    // invariant object. The body is large enough to only be unrolled for
+    // lock coarsening.
+    void addAll(int[] values) {
+        for (int i = 0; i < values.length; i++) {
+            synchronized (lock) {
+                if (++holders != 1) {
+                    overlap.set(true);
+                }
+                int v = values[i];
+                v = v * 31 + (v >>> 3);
+                v = v ^ (v << 7);
+                v = v * 17 + (v >>> 11);
+                counter += (v & 1) + 1;
+                holders--;
+            }
+        }
+    }
+
+    static int expected(int[] values) {
+        int sum = 0;
+        for (int value : values) {
+            int v = value;
+            v = v * 31 + (v >>> 3);
+            v = v ^ (v << 7);
+            v = v * 17 + (v >>> 11);
+            sum += (v & 1) + 1;
+        }
+        return sum;
+    }
+
+    public static void main(String[] args) throws Exception {
+        int[] values = new int[LOOP_COUNT];
+        for (int i = 0; i < values.length; i++) {
+            values[i] = i * 0x9E3779B9;
+        }
+        int perCall = expected(values);
+
+        TestLoopLockCoarsening test = new TestLoopLockCoarsening();
+        CountDownLatch start = new CountDownLatch(1);
+        Thread[] threads = new Thread[THREADS];
+        for (int t = 0; t < THREADS; t++) {
+            threads[t] = new Thread(() -> {
+                try {
+                    start.await();
+                } catch (InterruptedException e) {
+                    throw new RuntimeException(e);
+                }
+                for (int i = 0; i < ITERATIONS; i++) {
+                    test.addAll(values);
+                }
+            });
+            threads[t].start();
+        }
+
+        // Contend for the lock from outside the loop as well.
+        start.countDown();
+        long acquired = 0;
+        while (threads[0].isAlive()) {
+            synchronized (test.lock) {
+                if (test.holders != 0) {
+                    test.overlap.set(true);
+                }
+                acquired++;
+            }
+            Thread.yield();
+        }
+        for (Thread t : threads) {
+            t.join();
+        }
+
+        if (test.overlap.get()) {
+            throw new RuntimeException("Two threads held the lock at the same time");
+        }
+        long expected = (long) perCall * THREADS * ITERATIONS;
+        if (test.counter != expected) {
+            throw new RuntimeException("Expected counter " + expected + " but got " + test.counter);
+        }
+        System.out.println("Lock acquired " + acquired + " times by the main thread");
+    }
+}
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+/*
+ * @test
+ * @summary Test writing a profile snapshot and seeding the profiles of a
+ *          later run with it, including snapshots with malformed entries.
+ * @requires vm.flavor == "server"
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ * @run driver compiler.profiling.TestProfileSnapshot
+ */
+
+package compiler.profiling;
+
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.nio.file.Paths;
+import java.util.List;
+
+import jdk.test.lib.Asserts;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestProfileSnapshot {
+
+    static final String WORKLOAD = Workload.class.getName();
+
+    public static void main(String[] args) throws Exception {
+        Path snapshot = Paths.get("profile-snapshot.txt");
+        testDump(snapshot);
+        testReplay(snapshot);
+        testMalformed(Paths.get("malformed-snapshot.txt"));
+    }
+
+    static OutputAnalyzer run(String... options) throws Exception {
+        String[] args = new String[options.length + 3];
+        args[0] = "-XX:+UnlockExperimentalVMOptions";
+        args[1] = "-XX:+TieredCompilation";
+        System.arraycopy(options, 0, args, 2, options.length);
+        args[args.length - 1] = WORKLOAD;
+        OutputAnalyzer output = new OutputAnalyzer(ProcessTools.createJavaProcessBuilder(args).start());
+        output.shouldHaveExitValue(0);
+        return output;
+    }
+
+    static void testDump(Path snapshot) throws Exception {
+        Files.deleteIfExists(snapshot);
+        run("-XX:ProfileSnapshotDumpFile=" + snapshot);
+
+        List<String> lines = Files.readAllLines(snapshot);
+        Asserts.assertTrue(lines.get(0).startsWith("# method "), "missing format comment");
+        String hot = null;
+        for (String line : lines.subList(1, lines.size())) {
+            String[] tokens = line.split(" ");
+            Asserts.assertEquals(tokens[0], "method", "bad entry: " + line);
+            // method <klass> <name> <signature> <invocations> <backedges> [<bci> <tag> <count1> <count2>]*
+            Asserts.assertGTE(tokens.length, 6, "bad entry: " + line);
+            Asserts.assertEquals((tokens.length - 6) % 4, 0, "bad entry: " + line);
+            for (int i = 4; i < tokens.length; i++) {
+                Long.parseLong(tokens[i]);
+            }
+            if (tokens[1].equals(WORKLOAD.replace('.', '/')) && tokens[2].equals("hot")) {
+                hot = line;
+            }
+        }
+        Asserts.assertNotNull(hot, "hot method not in the snapshot");
+        String[] tokens = hot.split(" ");
+        Asserts.assertGT(Integer.parseInt(tokens[4]), 0, "no invocations recorded: " + hot);
+        Asserts.assertGT(tokens.length, 6, "no branch profile recorded: " + hot);
+    }
+
+    static void testReplay(Path snapshot) throws Exception {
+        OutputAnalyzer output = run("-XX:ProfileSnapshotReplayFile=" + snapshot,
+                                    "-Xlog:jit+compilation=debug");
+        output.shouldMatch("Loaded [1-9][0-9]* method profiles from " + snapshot);
+        output.shouldContain("Seeded profile of " + WORKLOAD + ".hot(I)I");
+        output.shouldNotContain("Ignoring malformed entry");
+    }
+
+    static void testMalformed(Path snapshot) throws Exception {
+        String klass = WORKLOAD.replace('.', '/');
+        Files.write(snapshot, List.of(
+            "# comment",
+            "",
+            "unknown " + klass + " hot (I)I 1 1",      // 3: unknown command
+            "method " + klass + " hot (I)I 1",         // 4: missing backedge count
+            "method " + klass + " hot",                // 5: missing signature
+            "method " + klass + " hot (I)I 1 1 0 2 3", // 6: incomplete record
+            "method " + klass + " hot (I)I 1 1 x",     // 7: trailing garbage
+            "method " + klass + " hot (I)I 1 one",     // 8: bad count
+            "method " + klass + " hot (I)I 100 0"));   // 9
+        OutputAnalyzer output = run("-XX:ProfileSnapshotReplayFile=" + snapshot,
+                                    "-Xlog:jit+compilation=debug");
+        for (int line = 3; line <= 8; line++) {
+            output.shouldContain("Ignoring malformed entry at " + snapshot + ":" + line);
+        }
+        output.shouldNotContain("Ignoring malformed entry at " + snapshot + ":9");
+        output.shouldContain("Loaded 1 method profiles from " + snapshot);
+    }
+
+    public static class Workload {
+        static int sink;
+
+        static int hot(int i) {
+            int r = 0;
+            for (int j = 0; j < 10; j++) {
+                if ((i & 1) == 0) {
+                    r += j;
+                } else {
+                    r -= j;
+                }
+            }
+            return r;
+        }
+
+        public static void main(String[] args) {
+            for (int i = 0; i < 200_000; i++) {
+                sink += hot(i);
+            }
+        }
+    }
+}
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+/*
+ * @test
+ * @summary Select tasks from long compile queues with and without the
+ *          candidates cached by the last full queue scan, and check that
+ *          the queues still drain.
+ * @requires vm.flavor == "server" & vm.opt.TieredStopAtLevel == null
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ * @build sun.hotspot.WhiteBox
+ * @run driver ClassFileInstaller sun.hotspot.WhiteBox
+ *                                sun.hotspot.WhiteBox$WhiteBoxPermission
+ * @run main/othervm -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+TieredCompilation -XX:CICompilerCount=2
+ *                   -XX:TieredCompileTaskRescanInterval=0
+ *                   compiler.tiered.TestCompileTaskCandidates
+ * @run main/othervm -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+TieredCompilation -XX:CICompilerCount=2
+ *                   -XX:TieredCompileTaskRescanInterval=5
+ *                   compiler.tiered.TestCompileTaskCandidates
+ * @run main/othervm -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+TieredCompilation -XX:CICompilerCount=2
+ *                   -XX:TieredCompileTaskRescanInterval=1000
+ *                   compiler.tiered.TestCompileTaskCandidates
+ */
+
+package compiler.tiered;
+
+import java.io.InputStream;
+import java.lang.reflect.Method;
+
+import sun.hotspot.WhiteBox;
+
+public class TestCompileTaskCandidates {
+
+    static final WhiteBox WB = WhiteBox.getWhiteBox();
+
+    // Enough copies of Worker.work() to queue more tasks than
+    // 4 * CompileQueue::max_candidates at once.
+    static final int COPIES = 200;
+    static final int ROUNDS = 20_000;
+    static final long DRAIN_TIMEOUT = 60_000;
+
+    public static class Worker {
+        public static int work(int x) {
+            int r = 0;
+            for (int i = 0; i < 8; i++) {
+                r += ((x + i) & 1) == 0 ? i : -i;
+            }
+            return r;
+        }
+    }
+
+    // Defines a copy of Worker, so that each loader has a method of its own.
+    static class CopyLoader extends ClassLoader {
+        private final byte[] bytes;
+
+        CopyLoader(byte[] bytes) {
+            super(TestCompileTaskCandidates.class.getClassLoader());
+            this.bytes = bytes;
+        }
+
+        @Override
+        protected Class<?> loadClass(String name, boolean resolve) throws ClassNotFoundException {
+            synchronized (getClassLoadingLock(name)) {
+                if (!name.equals(Worker.class.getName())) {
+                    return super.loadClass(name, resolve);
+                }
+                Class<?> c = findLoadedClass(name);
+                if (c == null) {
+                    c = defineClass(name, bytes, 0, bytes.length);
+                }
+                return c;
+            }
+        }
+    }
+
+    static int expected(int x) {
+        int r = 0;
+        for (int i = 0; i < 8; i++) {
+            r += ((x + i) & 1) == 0 ? i : -i;
+        }
+        return r;
+    }
+
+    public static void main(String[] args) throws Exception {
+        byte[] bytes;
+        String resource = Worker.class.getName().replace('.', '/') + ".class";
+        try (InputStream in = TestCompileTaskCandidates.class.getClassLoader().getResourceAsStream(resource)) {
+            bytes = in.readAllBytes();
+        }
+
+        Method[] work = new Method[COPIES];
+        for (int i = 0; i < COPIES; i++) {
+            Class<?> c = Class.forName(Worker.class.getName(), true, new CopyLoader(bytes));
+            work[i] = c.getMethod("work", int.class);
+        }
+
+        // Make all the copies hot at the same time
+        for (int round = 0; round < ROUNDS; round++) {
+            for (int i = 0; i < COPIES; i++) {
+                int x = round + i;
+                int r = (Integer)work[i].invoke(null, x);
+                if (r != expected(x)) {
+                    throw new RuntimeException("copy " + i + ": work(" + x + ") = " + r +
+                                               ", expected " + expected(x));
+                }
+            }
+        }
+
+        // Selection must neither lose nor keep tasks forever
+        long start = System.currentTimeMillis();
+        while (queuedTasks() > 0) {
+            if (System.currentTimeMillis() - start > DRAIN_TIMEOUT) {
+                throw new RuntimeException("compile queues did not drain, " + queuedTasks() + " tasks left");
+            }
+            Thread.sleep(100);
+        }
+    }
+
+    static int queuedTasks() {
+        return WB.getCompileQueueSize(1) + WB.getCompileQueueSize(4);
+    }
+}
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+/*
+ * @test
+ * @summary Int min/max reductions vectorized by SuperWord must compute the
+ *          same results as the scalar loops
+ * @requires vm.compiler2.enabled
+ *
+ * @run main/othervm -XX:-TieredCompilation -Xbatch -XX:-UseOnStackReplacement
+ *                   compiler.vectorization.TestIntMinMaxReduction
+ * @run main/othervm -XX:-TieredCompilation -Xbatch -XX:-UseOnStackReplacement
+ *                   -XX:MaxVectorSize=8
+ *                   compiler.vectorization.TestIntMinMaxReduction
+ * @run main/othervm -XX:-TieredCompilation -Xbatch -XX:-UseOnStackReplacement
+ *                   -XX:-SuperWordReductions
+ *                   compiler.vectorization.TestIntMinMaxReduction
+ */
+
+/*
+ * @test
+ * @requires vm.compiler2.enabled
+ * @requires os.arch == "x86" | os.arch == "i386" | os.arch == "amd64" | os.arch == "x86_64"
+ *
+ * @run main/othervm -XX:-TieredCompilation -Xbatch -XX:-UseOnStackReplacement
+ *                   -XX:UseAVX=0 compiler.vectorization.TestIntMinMaxReduction
+ * @run main/othervm -XX:-TieredCompilation -Xbatch -XX:-UseOnStackReplacement
+ *                   -XX:UseAVX=0 -XX:MaxVectorSize=8
+ *                   compiler.vectorization.TestIntMinMaxReduction
+ * @run main/othervm -XX:-TieredCompilation -Xbatch -XX:-UseOnStackReplacement
+ *                   -XX:UseAVX=1 compiler.vectorization.TestIntMinMaxReduction
+ * @run main/othervm -XX:-TieredCompilation -Xbatch -XX:-UseOnStackReplacement
+ *                   -XX:UseAVX=2 compiler.vectorization.TestIntMinMaxReduction
+ */
+
+package compiler.vectorization;
+
+import java.util.Random;
+
+public class TestIntMinMaxReduction {
+
+    private static final int ITERATIONS = 20_000;
+
+    static int mathMin(int[] a, int init) {
+        int m = init;
+        for (int i = 0; i < a.length; i++) {
+            m = Math.min(m, a[i]);
+        }
+        return m;
+    }
+
+    static int mathMax(int[] a, int init) {
+        int m = init;
+        for (int i = 0; i < a.length; i++) {
+            m = Math.max(m, a[i]);
+        }
+        return m;
+    }
+
+    static int ifMin(int[] a, int init) {
+        int m = init;
+        for (int i = 0; i < a.length; i++) {
+            if (a[i] < m) {
+                m = a[i];
+            }
+        }
+        return m;
+    }
+
+    static int ifMax(int[] a, int init) {
+        int m = init;
+        for (int i = 0; i < a.length; i++) {
+            if (a[i] > m) {
+                m = a[i];
+            }
+        }
+        return m;
+    }
+
+    static int ternaryMinOfSum(int[] a, int[] b, int init) {
+        int m = init;
+        for (int i = 0; i < a.length; i++) {
+            int v = a[i] + b[i];
+            m = (v < m) ? v : m;
+        }
+        return m;
+    }
+
+    static int minAndMax(int[] a) {
+        int min = Integer.MAX_VALUE;
+        int max = Integer.MIN_VALUE;
+        for (int i = 0; i < a.length; i++) {
+            min = Math.min(min, a[i]);
+            max = Math.max(max, a[i]);
+        }
+        return max - min;
+    }
+
+    // Reference results, computed on longs so that they are not taken for
+    // int reductions.
+    static int refMin(int[] a, long init) {
+        long m = init;
+        for (int v : a) {
+            if (v < m) {
+                m = v;
+            }
+        }
+        return (int) m;
+    }
+
+    static int refMax(int[] a, long init) {
+        long m = init;
+        for (int v : a) {
+            if (v > m) {
+                m = v;
+            }
+        }
+        return (int) m;
+    }
+
+    interface Reduction {
+        int run();
+    }
+
+    static void check(String name, int expected, Reduction r) {
+        for (int i = 0; i < ITERATIONS; i++) {
+            int result = r.run();
+            if (result != expected) {
+                throw new RuntimeException(name + ": expected " + expected + " but got " + result);
+            }
+        }
+    }
+
+    public static void main(String[] args) {
+        Random random = new Random(42);
+        // Lengths that leave remainders for every vector size.
+        int[] lengths = { 1, 2, 3, 7, 31, 1000, 1021 };
+        for (int len : lengths) {
+            int[] a = new int[len];
+            int[] b = new int[len];
+            for (int i = 0; i < len; i++) {
+                a[i] = random.nextInt();
+                b[i] = random.nextInt(1000) - 500;
+            }
+            // Extremes in the last element, which is left to the post loop
+            // or the last vector depending on the vector size.
+            int[] extremes = a.clone();
+            extremes[len - 1] = (len % 2 == 0) ? Integer.MIN_VALUE : Integer.MAX_VALUE;
+
+            int[] sums = new int[len];
+            for (int i = 0; i < len; i++) {
+                sums[i] = b[i] + b[i];
+            }
+
+            String suffix = " (length " + len + ")";
+            check("mathMin" + suffix, refMin(a, Integer.MAX_VALUE), () -> mathMin(a, Integer.MAX_VALUE));
+            check("mathMin init" + suffix, refMin(a, -17), () -> mathMin(a, -17));
+            check("mathMax" + suffix, refMax(a, Integer.MIN_VALUE), () -> mathMax(a, Integer.MIN_VALUE));
+            check("mathMax init" + suffix, refMax(a, 17), () -> mathMax(a, 17));
+            check("ifMin" + suffix, refMin(a, Integer.MAX_VALUE), () -> ifMin(a, Integer.MAX_VALUE));
+            check("ifMax" + suffix, refMax(a, Integer.MIN_VALUE), () -> ifMax(a, Integer.MIN_VALUE));
+            check("ifMin extremes" + suffix, refMin(extremes, 0), () -> ifMin(extremes, 0));
+            check("ifMax extremes" + suffix, refMax(extremes, 0), () -> ifMax(extremes, 0));
+            check("ternaryMinOfSum" + suffix, refMin(sums, 1), () -> ternaryMinOfSum(b, b, 1));
+            check("minAndMax" + suffix,
+                  refMax(extremes, Integer.MIN_VALUE) - refMin(extremes, Integer.MAX_VALUE),
+                  () -> minAndMax(extremes));
+        }
+    }
+}
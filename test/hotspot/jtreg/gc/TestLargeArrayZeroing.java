@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+package gc;
+
+/*
+ * @test TestLargeArrayZeroing
+ * @summary Large primitive arrays must be zeroed when zeroing is done in chunks
+ *          with safepoints in between.
+ * @run main/othervm -Xmx256m -XX:ArrayZeroingChunkSize=4096 gc.TestLargeArrayZeroing
+ * @run main/othervm -Xmx256m -XX:ArrayZeroingChunkSize=0 gc.TestLargeArrayZeroing
+ */
+
+public class TestLargeArrayZeroing {
+    static final int LENGTH = 4 * 1024 * 1024;
+    static final int ITERATIONS = 50;
+
+    static volatile boolean done;
+    static long[] garbage;
+
+    public static void main(String[] args) throws Exception {
+        // Keep requesting safepoints while the arrays are cleared.
+        Thread gc = new Thread(() -> {
+            while (!done) {
+                System.gc();
+            }
+        });
+        gc.start();
+
+        try {
+            for (int i = 0; i < ITERATIONS; i++) {
+                // Leave non-zero memory behind for the next allocation.
+                garbage = new long[LENGTH];
+                java.util.Arrays.fill(garbage, -1L);
+                garbage = null;
+
+                long[] array = new long[LENGTH];
+                for (int j = 0; j < LENGTH; j++) {
+                    if (array[j] != 0) {
+                        throw new RuntimeException("Element " + j + " is not zero: " + array[j]);
+                    }
+                }
+            }
+        } finally {
+            done = true;
+            gc.join();
+        }
+    }
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package gc;
+
+/*
+ * @test TestTLABRefillBurst
+ * @summary Check that ResizeTLABPromptly grows the TLAB of a thread that
+ *          allocates much faster than its allocation history says, and only then
+ * @key gc
+ * @requires vm.gc.Serial
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ * @run driver gc.TestTLABRefillBurst
+ */
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestTLABRefillBurst {
+
+    private static final String BURST = "TLAB refill burst";
+
+    private static OutputAnalyzer run(String... flags) throws Exception {
+        String[] common = {
+            "-XX:+UseSerialGC",
+            "-Xmx256m",
+            "-Xmn128m",
+            "-XX:+ResizeTLAB",
+            "-XX:TLABSize=2k",
+            "-Xlog:gc+tlab=trace",
+        };
+        String[] arguments = new String[common.length + flags.length + 2];
+        System.arraycopy(common, 0, arguments, 0, common.length);
+        System.arraycopy(flags, 0, arguments, common.length, flags.length);
+        arguments[arguments.length - 2] = Allocate.class.getName();
+        arguments[arguments.length - 1] = Integer.toString(32 * 1024 * 1024);
+
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(arguments);
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        return output;
+    }
+
+    public static void main(String[] args) throws Exception {
+        // The main thread takes thousands of small TLABs while only a
+        // small part of eden is used.
+        run("-XX:+ResizeTLABPromptly").shouldContain(BURST);
+        run("-XX:-ResizeTLABPromptly").shouldNotContain(BURST);
+
+        // A thread that allocates little never runs past its expected
+        // number of refills.
+        OutputAnalyzer output = run("-XX:+ResizeTLABPromptly", "-XX:TLABSize=1m");
+        output.shouldNotContain(BURST);
+    }
+
+    static class Allocate {
+        public static Object sink;
+
+        public static void main(String[] args) {
+            long bytes = Long.parseLong(args[0]);
+            for (long allocated = 0; allocated < bytes; allocated += 64) {
+                sink = new byte[48];
+            }
+        }
+    }
+}
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package gc.epsilon;
+
+/**
+ * @test TestSlidingGC
+ * @key gc
+ * @requires vm.gc.Epsilon & !vm.graal.enabled
+ * @summary Epsilon sliding GC keeps a fragmented live set intact over several compactions
+ *
+ * @run main/othervm -Xmx64m -Xlog:gc -XX:+UnlockExperimentalVMOptions -XX:+UnlockDiagnosticVMOptions
+ *                   -XX:+UseEpsilonGC -XX:+EpsilonSlidingGC -XX:+VerifyBeforeGC -XX:+VerifyAfterGC
+ *                   gc.epsilon.TestSlidingGC
+ *
+ * @run main/othervm -Xmx64m -Xlog:gc -XX:+UnlockExperimentalVMOptions -XX:+UnlockDiagnosticVMOptions
+ *                   -XX:+UseEpsilonGC -XX:+EpsilonSlidingGC -XX:+VerifyBeforeGC -XX:+VerifyAfterGC
+ *                   -XX:-UseTLAB
+ *                   gc.epsilon.TestSlidingGC
+ *
+ * @run main/othervm -Xmx64m -Xlog:gc -XX:+UnlockExperimentalVMOptions -XX:+UnlockDiagnosticVMOptions
+ *                   -XX:+UseEpsilonGC -XX:+EpsilonSlidingGC -XX:+VerifyBeforeGC -XX:+VerifyAfterGC
+ *                   -XX:-UseCompressedOops
+ *                   gc.epsilon.TestSlidingGC
+ */
+
+import java.lang.management.GarbageCollectorMXBean;
+import java.lang.management.ManagementFactory;
+import java.util.Random;
+
+public class TestSlidingGC {
+
+    static final int LIVE_NODES = 100_000;
+    static final int MIN_COLLECTIONS = 5;
+
+    static class Node {
+        final int id;
+        final byte[] payload;
+        Node next;
+
+        Node(int id, int size) {
+            this.id = id;
+            this.payload = new byte[size];
+            for (int i = 0; i < size; i++) {
+                payload[i] = (byte) (id + i);
+            }
+        }
+
+        void verify() {
+            for (int i = 0; i < payload.length; i++) {
+                if (payload[i] != (byte) (id + i)) {
+                    throw new IllegalStateException("Node " + id + " is corrupted at " + i);
+                }
+            }
+        }
+    }
+
+    static Object sink;
+
+    static long collections() {
+        long count = 0;
+        for (GarbageCollectorMXBean bean : ManagementFactory.getGarbageCollectorMXBeans()) {
+            count += Math.max(0, bean.getCollectionCount());
+        }
+        return count;
+    }
+
+    public static void main(String[] args) {
+        Random rnd = new Random(42);
+        long before = collections();
+
+        // Interleave the live set with garbage, so that every compaction
+        // has to slide most of the live objects down.
+        Node[] live = new Node[LIVE_NODES];
+        for (int i = 0; i < LIVE_NODES; i++) {
+            live[i] = new Node(i, rnd.nextInt(64));
+            sink = new byte[rnd.nextInt(256)];
+            if (i > 0) {
+                live[i - 1].next = live[i];
+            }
+        }
+        Node head = live[0];
+
+        for (int round = 0; round < 2 * MIN_COLLECTIONS; round++) {
+            // Drop a random part of the live set, and fill the heap until
+            // the allocation failure triggers a collection.
+            for (int i = 0; i < LIVE_NODES / 10; i++) {
+                int idx = rnd.nextInt(LIVE_NODES);
+                live[idx] = new Node(idx, rnd.nextInt(64));
+            }
+            long target = collections() + 1;
+            while (collections() < target) {
+                for (int i = 0; i < 100; i++) {
+                    sink = new byte[rnd.nextInt(4096)];
+                }
+            }
+            if (round % 2 == 0) {
+                System.gc();
+            }
+
+            for (int i = 0; i < LIVE_NODES; i++) {
+                if (live[i].id != i) {
+                    throw new IllegalStateException("Node " + i + " has id " + live[i].id);
+                }
+                live[i].verify();
+            }
+        }
+
+        // The original nodes are all still reachable through their chain
+        int chained = 0;
+        for (Node n = head; n != null; n = n.next) {
+            if (n.id != chained) {
+                throw new IllegalStateException("Node " + chained + " has id " + n.id);
+            }
+            n.verify();
+            chained++;
+        }
+        if (chained != LIVE_NODES) {
+            throw new IllegalStateException("Chain has " + chained + " nodes, expected " + LIVE_NODES);
+        }
+
+        long done = collections() - before;
+        if (done < MIN_COLLECTIONS) {
+            throw new IllegalStateException("Expected at least " + MIN_COLLECTIONS + " collections, got " + done);
+        }
+    }
+}
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package gc.epsilon;
+
+/**
+ * @test TestSlidingGCClassUnloading
+ * @key gc
+ * @requires vm.gc.Epsilon & !vm.graal.enabled
+ * @summary Epsilon sliding GC keeps classes of unreachable class loaders, and their mirrors usable
+ *
+ * @run main/othervm -Xmx64m -Xlog:gc -XX:+UnlockExperimentalVMOptions -XX:+UnlockDiagnosticVMOptions
+ *                   -XX:+UseEpsilonGC -XX:+EpsilonSlidingGC -XX:+VerifyBeforeGC -XX:+VerifyAfterGC
+ *                   -XX:+ClassUnloading
+ *                   gc.epsilon.TestSlidingGCClassUnloading
+ *
+ * @run main/othervm -Xmx64m -Xlog:gc -XX:+UnlockExperimentalVMOptions -XX:+UnlockDiagnosticVMOptions
+ *                   -XX:+UseEpsilonGC -XX:+EpsilonSlidingGC -XX:+VerifyBeforeGC -XX:+VerifyAfterGC
+ *                   -XX:-ClassUnloading
+ *                   gc.epsilon.TestSlidingGCClassUnloading
+ */
+
+import java.io.InputStream;
+import java.lang.ref.WeakReference;
+import java.lang.reflect.Method;
+import java.util.ArrayList;
+import java.util.List;
+
+public class TestSlidingGCClassUnloading {
+
+    static final int LOADERS = 200;
+    static final int ROUNDS = 5;
+
+    public static class Payload {
+        static Object data;
+        static int id;
+
+        public static void init(int value) {
+            id = value;
+            data = new int[] { value, value + 1 };
+        }
+
+        public static boolean check(int value) {
+            int[] arr = (int[]) data;
+            return id == value && arr[0] == value && arr[1] == value + 1;
+        }
+    }
+
+    // Defines its own copy of Payload instead of delegating to its parent
+    static class PayloadLoader extends ClassLoader {
+        PayloadLoader() {
+            super(TestSlidingGCClassUnloading.class.getClassLoader());
+        }
+
+        @Override
+        protected Class<?> loadClass(String name, boolean resolve) throws ClassNotFoundException {
+            if (!name.equals(Payload.class.getName())) {
+                return super.loadClass(name, resolve);
+            }
+            synchronized (getClassLoadingLock(name)) {
+                Class<?> c = findLoadedClass(name);
+                if (c == null) {
+                    String resource = name.replace('.', '/') + ".class";
+                    try (InputStream in = getParent().getResourceAsStream(resource)) {
+                        byte[] bytes = in.readAllBytes();
+                        c = defineClass(name, bytes, 0, bytes.length);
+                    } catch (Exception e) {
+                        throw new ClassNotFoundException(name, e);
+                    }
+                }
+                return c;
+            }
+        }
+    }
+
+    static Object sink;
+
+    static Class<?> loadPayload(int value) throws Exception {
+        Class<?> c = Class.forName(Payload.class.getName(), true, new PayloadLoader());
+        if (c == Payload.class) {
+            throw new IllegalStateException("Payload was not loaded by its own loader");
+        }
+        c.getMethod("init", int.class).invoke(null, value);
+        return c;
+    }
+
+    static void check(Class<?> c, int value) throws Exception {
+        Method m = c.getMethod("check", int.class);
+        if (!(Boolean) m.invoke(null, value)) {
+            throw new IllegalStateException("Payload " + value + " is corrupted");
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        List<Class<?>> kept = new ArrayList<>();
+        List<WeakReference<Class<?>>> dropped = new ArrayList<>();
+
+        for (int round = 0; round < ROUNDS; round++) {
+            for (int i = 0; i < LOADERS; i++) {
+                int value = round * LOADERS + i;
+                Class<?> c = loadPayload(value);
+                if (i % 2 == 0) {
+                    kept.add(c);
+                } else {
+                    dropped.add(new WeakReference<>(c));
+                }
+                // Interleave the class mirrors and loaders with garbage
+                sink = new byte[1024 * (i % 16)];
+            }
+
+            System.gc();
+
+            for (int i = 0; i < kept.size(); i++) {
+                int r = i / (LOADERS / 2);
+                check(kept.get(i), r * LOADERS + 2 * (i % (LOADERS / 2)));
+            }
+        }
+
+        // The sliding GC does not unload classes: everything reachable from
+        // the class loader data graph stays alive, and has to remain usable.
+        for (int i = 0; i < dropped.size(); i++) {
+            Class<?> c = dropped.get(i).get();
+            if (c == null) {
+                throw new IllegalStateException("Class of unreachable loader was unloaded");
+            }
+            int r = i / (LOADERS / 2);
+            check(c, r * LOADERS + 2 * (i % (LOADERS / 2)) + 1);
+        }
+    }
+}
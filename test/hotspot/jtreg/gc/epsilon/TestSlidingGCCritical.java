@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package gc.epsilon;
+
+/**
+ * @test TestSlidingGCCritical
+ * @key gc
+ * @requires vm.gc.Epsilon & !vm.graal.enabled
+ * @summary Epsilon sliding GC does not move arrays and strings held in JNI critical regions
+ *
+ * @run main/othervm/native -Xmx64m -Xlog:gc -XX:+UnlockExperimentalVMOptions -XX:+UnlockDiagnosticVMOptions
+ *                          -XX:+UseEpsilonGC -XX:+EpsilonSlidingGC -XX:+VerifyBeforeGC -XX:+VerifyAfterGC
+ *                          gc.epsilon.TestSlidingGCCritical
+ */
+
+import java.lang.management.GarbageCollectorMXBean;
+import java.lang.management.ManagementFactory;
+import java.util.Random;
+
+public class TestSlidingGCCritical {
+
+    static {
+        System.loadLibrary("TestSlidingGCCritical");
+    }
+
+    // Fill the array with value, in a JNI critical region, and check that
+    // it still holds it before leaving the region.
+    static native boolean fillCritical(byte[] array, byte value);
+
+    // Sum the characters of the string, in a JNI critical region.
+    static native long sumCritical(String str);
+
+    static final int DURATION_MS = 10_000;
+    static final int MIN_COLLECTIONS = 5;
+
+    static volatile boolean done;
+    static volatile Throwable failure;
+    static Object sink;
+
+    static long collections() {
+        long count = 0;
+        for (GarbageCollectorMXBean bean : ManagementFactory.getGarbageCollectorMXBeans()) {
+            count += Math.max(0, bean.getCollectionCount());
+        }
+        return count;
+    }
+
+    static Thread startCriticalUser(int id) {
+        Thread t = new Thread(() -> {
+            try {
+                byte[] array = new byte[256 * 1024];
+                StringBuilder sb = new StringBuilder();
+                for (int i = 0; i < 10_000; i++) {
+                    sb.append((char) ('a' + (i + id) % 26));
+                }
+                String str = sb.toString();
+                long sum = 0;
+                for (int i = 0; i < str.length(); i++) {
+                    sum += str.charAt(i);
+                }
+
+                byte value = 0;
+                while (!done) {
+                    value++;
+                    if (!fillCritical(array, value)) {
+                        throw new IllegalStateException("Array changed in a critical region");
+                    }
+                    for (int i = 0; i < array.length; i++) {
+                        if (array[i] != value) {
+                            throw new IllegalStateException("Array is corrupted at " + i);
+                        }
+                    }
+                    if (sumCritical(str) != sum) {
+                        throw new IllegalStateException("String is corrupted");
+                    }
+                }
+            } catch (Throwable e) {
+                failure = e;
+            }
+        });
+        t.setName("Critical User " + id);
+        t.start();
+        return t;
+    }
+
+    public static void main(String[] args) throws Exception {
+        long before = collections();
+
+        Thread[] users = new Thread[] { startCriticalUser(1), startCriticalUser(2) };
+
+        // Fill the heap with garbage interleaved with the arrays of the
+        // critical users, so that collections want to move their arrays.
+        Random rnd = new Random(42);
+        long start = System.currentTimeMillis();
+        while (System.currentTimeMillis() - start < DURATION_MS && failure == null) {
+            for (int i = 0; i < 1000; i++) {
+                sink = new byte[rnd.nextInt(4096)];
+            }
+        }
+
+        done = true;
+        for (Thread t : users) {
+            t.join();
+        }
+        if (failure != null) {
+            throw new RuntimeException("Critical user failed", failure);
+        }
+
+        System.gc();
+        long count = collections() - before;
+        if (count < MIN_COLLECTIONS) {
+            throw new IllegalStateException("Expected at least " + MIN_COLLECTIONS + " collections, got " + count);
+        }
+    }
+}
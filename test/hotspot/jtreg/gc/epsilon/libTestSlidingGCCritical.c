@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include <jni.h>
+
+JNIEXPORT jboolean JNICALL
+Java_gc_epsilon_TestSlidingGCCritical_fillCritical(JNIEnv* env, jclass clz, jbyteArray arr, jbyte value) {
+  jsize size = (*env)->GetArrayLength(env, arr);
+  jbyte* p = (*env)->GetPrimitiveArrayCritical(env, arr, NULL);
+  jboolean result = JNI_TRUE;
+  jsize i;
+  for (i = 0; i < size; i++) {
+    p[i] = value;
+  }
+  for (i = 0; i < size; i++) {
+    if (p[i] != value) {
+      result = JNI_FALSE;
+    }
+  }
+  (*env)->ReleasePrimitiveArrayCritical(env, arr, p, 0);
+  return result;
+}
+
+JNIEXPORT jlong JNICALL
+Java_gc_epsilon_TestSlidingGCCritical_sumCritical(JNIEnv* env, jclass clz, jstring str) {
+  jsize len = (*env)->GetStringLength(env, str);
+  const jchar* s = (*env)->GetStringCritical(env, str, NULL);
+  jlong sum = 0;
+  jsize i;
+  for (i = 0; i < len; i++) {
+    sum += s[i];
+  }
+  (*env)->ReleaseStringCritical(env, str, s);
+  return sum;
+}
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package gc.g1;
+
+/*
+ * @test TestConcurrentUncommit
+ * @summary Shrink the heap with G1UncommitConcurrently, expand it again
+ *          before and after the service thread uncommitted the memory, and
+ *          verify the heap around every GC.
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ * @run driver gc.g1.TestConcurrentUncommit
+ */
+
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.List;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestConcurrentUncommit {
+
+    private static final String[] COMMON_OPTS = new String[] {
+        "-XX:+UseG1GC",
+        "-Xms8m",
+        "-Xmx256m",
+        "-XX:G1HeapRegionSize=1m",
+        "-XX:MinHeapFreeRatio=10",
+        "-XX:MaxHeapFreeRatio=11",
+        "-XX:-ExplicitGCInvokesConcurrent",
+        "-XX:+G1UncommitConcurrently",
+        "-XX:+UnlockDiagnosticVMOptions",
+        "-XX:+VerifyBeforeGC",
+        "-XX:+VerifyAfterGC",
+        "-Xlog:gc+heap=trace",
+    };
+
+    private static OutputAnalyzer run(String... opts) throws Exception {
+        List<String> args = new ArrayList<>();
+        Collections.addAll(args, COMMON_OPTS);
+        Collections.addAll(args, opts);
+        args.add(Workload.class.getName());
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(args.toArray(new String[0]));
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        System.out.println(output.getStdout());
+        output.shouldHaveExitValue(0);
+        return output;
+    }
+
+    public static void main(String[] args) throws Exception {
+        // The service thread only wakes up once at startup in this run, so
+        // the regions removed by the shrink are still inactive when the heap
+        // expands again and are reactivated.
+        OutputAnalyzer output = run("-XX:G1ConcRefinementServiceIntervalMillis=600000");
+        output.shouldContain("Reactivated inactive regions");
+        output.shouldNotContain("Uncommitted");
+
+        // With the default interval the service thread uncommits the memory
+        // while the workload waits, and the expansion commits it again.
+        output = run();
+        output.shouldMatch("Uncommitted [1-9][0-9]* regions");
+    }
+
+    static class Workload {
+        private static final int REGION_SIZE = 1024 * 1024;
+        private static final int NUM_ARRAYS = 128;
+
+        public static Object[] live;
+
+        private static void allocate() {
+            live = new Object[NUM_ARRAYS];
+            for (int i = 0; i < NUM_ARRAYS; i++) {
+                live[i] = new byte[REGION_SIZE / 2];
+            }
+        }
+
+        public static void main(String[] args) throws Exception {
+            for (int i = 0; i < 3; i++) {
+                // Expand the heap.
+                allocate();
+                System.gc();
+                // Shrink it.
+                live = null;
+                System.gc();
+                Thread.sleep(2000);
+            }
+            // Expand once more and collect with the reused regions in use.
+            allocate();
+            System.gc();
+        }
+    }
+}
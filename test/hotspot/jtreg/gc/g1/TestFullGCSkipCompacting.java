@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package gc.g1;
+
+/*
+ * @test TestFullGCSkipCompacting
+ * @summary Test that G1 full GC leaves densely live regions in place and keeps the heap valid.
+ * @key gc
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ * @run driver gc.g1.TestFullGCSkipCompacting
+ */
+
+import java.util.ArrayList;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestFullGCSkipCompacting {
+    private static final String SKIP_PATTERN = "Skip compacting region \\d+ \\(\\w+\\), \\d+ live words";
+
+    public static void main(String[] args) throws Exception {
+        OutputAnalyzer output = runTest("-XX:+G1FullGCSkipCompactingLiveRegions");
+        output.shouldHaveExitValue(0);
+        output.shouldMatch(SKIP_PATTERN);
+        output.shouldContain("Verifying After GC");
+
+        output = runTest("-XX:-G1FullGCSkipCompactingLiveRegions");
+        output.shouldHaveExitValue(0);
+        output.shouldNotMatch(SKIP_PATTERN);
+        output.shouldContain("Verifying After GC");
+    }
+
+    private static OutputAnalyzer runTest(String flag) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder("-XX:+UseG1GC",
+                                                                  "-Xmx128m",
+                                                                  "-XX:G1HeapRegionSize=1m",
+                                                                  "-XX:+UnlockExperimentalVMOptions",
+                                                                  flag,
+                                                                  "-XX:+UnlockDiagnosticVMOptions",
+                                                                  "-XX:+VerifyBeforeGC",
+                                                                  "-XX:+VerifyAfterGC",
+                                                                  "-Xlog:gc,gc+region=debug,gc+verify=info",
+                                                                  GCTest.class.getName());
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        System.out.println(output.getStdout());
+        return output;
+    }
+
+    static class GCTest {
+        private static final int OBJ_SIZE = 1024;
+        private static final int OBJ_COUNT = 32 * 1024;
+
+        public static void main(String[] args) {
+            ArrayList<byte[]> live = new ArrayList<>(OBJ_COUNT);
+            for (int i = 0; i < OBJ_COUNT; i++) {
+                live.add(newArray(i));
+            }
+
+            // All regions are densely live and are left in place.
+            System.gc();
+            check(live);
+
+            // Punch holes into the second half so that those regions are compacted,
+            // while the first half is left in place again.
+            for (int i = OBJ_COUNT / 2; i < OBJ_COUNT; i += 2) {
+                live.set(i, null);
+            }
+            System.gc();
+            check(live);
+        }
+
+        private static byte[] newArray(int seed) {
+            byte[] a = new byte[OBJ_SIZE];
+            for (int i = 0; i < OBJ_SIZE; i++) {
+                a[i] = (byte)(seed + i);
+            }
+            return a;
+        }
+
+        private static void check(ArrayList<byte[]> live) {
+            for (int i = 0; i < live.size(); i++) {
+                byte[] a = live.get(i);
+                if (a == null) {
+                    continue;
+                }
+                for (int j = 0; j < OBJ_SIZE; j++) {
+                    if (a[j] != (byte)(i + j)) {
+                        throw new IllegalStateException("Incorrect data in array " + i + " at " + j);
+                    }
+                }
+            }
+        }
+    }
+}
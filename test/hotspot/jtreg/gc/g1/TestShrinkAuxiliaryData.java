@@ -60,14 +60,17 @@ public class TestShrinkAuxiliaryData {
     };
 
     private final int hotCardTableSize;
+    private final String[] extraOpts;
 
-    protected TestShrinkAuxiliaryData(int hotCardTableSize) {
+    protected TestShrinkAuxiliaryData(int hotCardTableSize, String... extraOpts) {
         this.hotCardTableSize = hotCardTableSize;
+        this.extraOpts = extraOpts;
     }
 
     protected void test() throws Exception {
         ArrayList<String> vmOpts = new ArrayList<>();
         Collections.addAll(vmOpts, initialOpts);
+        Collections.addAll(vmOpts, extraOpts);
 
         int maxCacheSize = Math.max(0, Math.min(31, getMaxCacheSize()));
         if (maxCacheSize < hotCardTableSize) {
@@ -153,7 +156,12 @@ public class TestShrinkAuxiliaryData {
 
     static class ShrinkAuxiliaryDataTest {
 
-        public static void main(String[] args) throws IOException {
+        // With G1UncommitConcurrently the service thread uncommits the
+        // memory some time after the shrinking GC.
+        private static final int UNCOMMIT_POLL_MS = 100;
+        private static final int UNCOMMIT_POLL_COUNT = 100;
+
+        public static void main(String[] args) throws Exception {
 
             ShrinkAuxiliaryDataTest testCase = new ShrinkAuxiliaryDataTest();
 
@@ -220,7 +228,7 @@ public class TestShrinkAuxiliaryData {
 
         private final List<GarbageObject> garbage = new ArrayList<>();
 
-        public void test() throws IOException {
+        public void test() throws Exception {
 
             MemoryUsage muFull, muFree, muAuxDataFull, muAuxDataFree;
             float auxFull, auxFree;
@@ -242,12 +250,21 @@ public class TestShrinkAuxiliaryData {
             deallocate();
             System.gc();
 
-            muFree = ManagementFactory.getMemoryMXBean().getHeapMemoryUsage();
-            muAuxDataFree = WhiteBox.getWhiteBox().g1AuxiliaryMemoryUsage();
+            int polls = 0;
+            while (true) {
+                muFree = ManagementFactory.getMemoryMXBean().getHeapMemoryUsage();
+                muAuxDataFree = WhiteBox.getWhiteBox().g1AuxiliaryMemoryUsage();
 
-            numUsedRegions = WhiteBox.getWhiteBox().g1NumMaxRegions()
-                    - WhiteBox.getWhiteBox().g1NumFreeRegions();
-            auxFree = (float)muAuxDataFree.getUsed() / numUsedRegions;
+                numUsedRegions = WhiteBox.getWhiteBox().g1NumMaxRegions()
+                        - WhiteBox.getWhiteBox().g1NumFreeRegions();
+                auxFree = (float)muAuxDataFree.getUsed() / numUsedRegions;
+
+                if (muFree.getCommitted() >= muFull.getCommitted() || auxFree <= auxFull
+                        || ++polls > UNCOMMIT_POLL_COUNT) {
+                    break;
+                }
+                Thread.sleep(UNCOMMIT_POLL_MS);
+            }
 
             System.out.format("Free aux data ratio= %f, regions max= %d, used= %d\n",
                     auxFree, WhiteBox.getWhiteBox().g1NumMaxRegions(), numUsedRegions
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+/* @test TestConcurrentHumongousMoves
+ * @summary Test that concurrent cycles move humongous objects in a fragmented heap
+ * @key gc
+ * @requires vm.gc.Shenandoah & !vm.graal.enabled
+ *
+ * @run main/othervm -Xmx512m -XX:+UnlockDiagnosticVMOptions -XX:+UnlockExperimentalVMOptions
+ *      -XX:+UseShenandoahGC -XX:ShenandoahGCHeuristics=aggressive -XX:ShenandoahRegionSize=1m
+ *      -XX:+ShenandoahHumongousMoves -XX:+ShenandoahConcurrentHumongousMoves
+ *      -XX:+ShenandoahVerify
+ *      TestConcurrentHumongousMoves
+ *
+ * @run main/othervm -Xmx512m -XX:+UnlockDiagnosticVMOptions -XX:+UnlockExperimentalVMOptions
+ *      -XX:+UseShenandoahGC -XX:ShenandoahGCHeuristics=aggressive -XX:ShenandoahRegionSize=1m
+ *      -XX:+ShenandoahHumongousMoves -XX:+ShenandoahConcurrentHumongousMoves
+ *      -XX:+ShenandoahVerify -XX:+ShenandoahOOMDuringEvacALot
+ *      TestConcurrentHumongousMoves
+ *
+ * @run main/othervm -Xmx512m -XX:+UnlockDiagnosticVMOptions -XX:+UnlockExperimentalVMOptions
+ *      -XX:+UseShenandoahGC -XX:ShenandoahRegionSize=1m
+ *      -XX:+ShenandoahHumongousMoves -XX:+ShenandoahConcurrentHumongousMoves
+ *      -XX:+ShenandoahVerify
+ *      TestConcurrentHumongousMoves
+ */
+
+import java.util.Random;
+
+public class TestConcurrentHumongousMoves {
+
+    private static final int NUM_RUNS   = 200;
+    private static final int SLOTS      = 64;
+    private static final int SMALL_SIZE = 64 * 1024;
+
+    // Spans two 1M regions, leaving most of the second one free
+    private static final int HUMONGOUS_SIZE = 300 * 1024;
+
+    private static int[][] humongous = new int[SLOTS][];
+    private static int[]   seeds     = new int[SLOTS];
+    private static Object[] small    = new Object[SLOTS * 16];
+
+    public static void main(String[] args) {
+        Random r = new Random(42);
+        for (int run = 0; run < NUM_RUNS; run++) {
+            // Interleave humongous arrays with small objects, then drop random
+            // ones of both kinds so free regions are scattered around the
+            // surviving humongous objects.
+            for (int i = 0; i < SLOTS; i++) {
+                if (humongous[i] == null || r.nextInt(4) == 0) {
+                    int seed = r.nextInt();
+                    humongous[i] = newArray(HUMONGOUS_SIZE, seed);
+                    seeds[i] = seed;
+                }
+                for (int j = 0; j < 16; j++) {
+                    int idx = r.nextInt(small.length);
+                    small[idx] = (r.nextInt(2) == 0) ? new byte[SMALL_SIZE] : null;
+                }
+            }
+
+            for (int i = 0; i < SLOTS; i++) {
+                if (r.nextInt(3) == 0) {
+                    humongous[i] = null;
+                }
+            }
+
+            // A humongous allocation needing a run longer than most of the
+            // fragmented free space.
+            int[] large = newArray(HUMONGOUS_SIZE * 8, run);
+            checkArray(large, HUMONGOUS_SIZE * 8, run);
+
+            for (int i = 0; i < SLOTS; i++) {
+                if (humongous[i] != null) {
+                    checkArray(humongous[i], HUMONGOUS_SIZE, seeds[i]);
+                }
+            }
+        }
+    }
+
+    private static int[] newArray(int size, int seed) {
+        int[] a = new int[size];
+        Random r = new Random(seed);
+        for (int i = 0; i < size; i++) {
+            a[i] = r.nextInt();
+        }
+        return a;
+    }
+
+    private static void checkArray(int[] array, int size, int seed) {
+        if (array.length != size) {
+            throw new IllegalStateException("Illegal array length: " + array.length + ", but expected " + size);
+        }
+        Random r = new Random(seed);
+        for (int i = 0; i < size; i++) {
+            int actual = array[i];
+            int expected = r.nextInt();
+            if (actual != expected) {
+                throw new IllegalStateException("Incorrect array data: " + actual + ", but expected " + expected);
+            }
+        }
+    }
+}
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+package gc.stress.pauses;
+
+import java.io.FileWriter;
+import java.io.PrintWriter;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.Collections;
+import java.util.List;
+import java.util.Map;
+import java.util.TreeMap;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import jdk.test.lib.Asserts;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+/**
+ * Runs each of the GCPausesWorkload workloads in a VM of its own with the
+ * given collector, and collects the pause times from the gc log and the
+ * phase times from the gc+phases log. The results are printed and written
+ * as JSON to gc-pauses-<name>.json in the working directory (or the file
+ * given by the gc.pauses.report property) so that runs of different
+ * collectors, or of builds before and after a change, can be compared.
+ *
+ * The gc.pauses.duration property sets the measured time per workload in
+ * milliseconds, and gc.pauses.workloads a comma-separated subset of them.
+ */
+public class GCPauses {
+    private static final String[] WORKLOADS = {
+        "alloc-16m", "alloc-128m", "alloc-max",
+        "graph-list", "graph-tree", "graph-wide",
+        "humongous", "references"
+    };
+
+    // [gc] GC(3) Pause Young (Normal) (G1 Evacuation Pause) 24M->4M(256M) 3.456ms
+    // [gc,phases] GC(0) Pause Mark Start 0.123ms
+    private static final Pattern PAUSE =
+        Pattern.compile("\\[gc(?:,phases)?\\s*\\].* GC\\(\\d+\\) (Pause [A-Za-z ]*[A-Za-z]).* (\\d+(?:\\.\\d+)?)ms$");
+    // [gc,phases] GC(0)   Pre Evacuate Collection Set: 0.1ms
+    // [gc,phases] GC(0) Concurrent Mark 12.345ms
+    private static final Pattern PHASE =
+        Pattern.compile("\\[gc,phases\\s*\\].* GC\\(\\d+\\) +([A-Za-z][A-Za-z ()/-]*?):? (\\d+(?:\\.\\d+)?)ms$");
+
+    private static class Samples {
+        private final List<Double> values = new ArrayList<>();
+
+        void add(double value) {
+            values.add(value);
+        }
+
+        private double percentile(List<Double> sorted, int p) {
+            return sorted.get((sorted.size() - 1) * p / 100);
+        }
+
+        String toJson() {
+            List<Double> sorted = new ArrayList<>(values);
+            Collections.sort(sorted);
+            double total = 0;
+            for (double v : sorted) {
+                total += v;
+            }
+            return String.format("{\"count\":%d,\"total_ms\":%.3f,\"p50_ms\":%.3f,\"p90_ms\":%.3f,\"p99_ms\":%.3f,\"max_ms\":%.3f}",
+                                 sorted.size(), total, percentile(sorted, 50), percentile(sorted, 90),
+                                 percentile(sorted, 99), sorted.get(sorted.size() - 1));
+        }
+    }
+
+    private static String toJson(Map<String, Samples> map) {
+        StringBuilder sb = new StringBuilder("{");
+        for (Map.Entry<String, Samples> e : map.entrySet()) {
+            if (sb.length() > 1) {
+                sb.append(',');
+            }
+            sb.append('"').append(e.getKey()).append("\":").append(e.getValue().toJson());
+        }
+        return sb.append('}').toString();
+    }
+
+    private static String runWorkload(String name, String workload, long durationMs, String[] gcFlags) throws Exception {
+        List<String> args = new ArrayList<>();
+        args.add("-Xbootclasspath/a:.");
+        args.add("-XX:+UnlockDiagnosticVMOptions");
+        args.add("-XX:+UnlockExperimentalVMOptions");
+        args.add("-XX:+WhiteBoxAPI");
+        args.add("-Xms512m");
+        args.add("-Xmx512m");
+        args.add("-Xlog:gc,gc+phases=debug");
+        args.addAll(Arrays.asList(gcFlags));
+        args.add(GCPausesWorkload.class.getName());
+        args.add(workload);
+        args.add(Long.toString(durationMs));
+
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(args.toArray(new String[0]));
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+
+        Map<String, Samples> pauses = new TreeMap<>();
+        Map<String, Samples> phases = new TreeMap<>();
+        boolean measuring = false;
+        for (String line : output.getStdout().split("\\R")) {
+            if (line.equals(GCPausesWorkload.BEGIN_MARKER)) {
+                measuring = true;
+            } else if (line.equals(GCPausesWorkload.END_MARKER)) {
+                measuring = false;
+            }
+            if (!measuring) {
+                continue;
+            }
+            Matcher m = PAUSE.matcher(line);
+            if (m.find()) {
+                pauses.computeIfAbsent(m.group(1), k -> new Samples()).add(Double.parseDouble(m.group(2)));
+                continue;
+            }
+            m = PHASE.matcher(line);
+            if (m.find()) {
+                phases.computeIfAbsent(m.group(1).trim(), k -> new Samples()).add(Double.parseDouble(m.group(2)));
+            }
+        }
+        Asserts.assertFalse(pauses.isEmpty(), "No pauses recorded for " + workload + " with " + name);
+
+        return String.format("{\"gc\":\"%s\",\"workload\":\"%s\",\"duration_ms\":%d,\"pauses\":%s,\"phases\":%s}",
+                             name, workload, durationMs, toJson(pauses), toJson(phases));
+    }
+
+    public static void run(String name, String... gcFlags) throws Exception {
+        long durationMs = Long.getLong("gc.pauses.duration", 5000);
+        String[] workloads = WORKLOADS;
+        String selected = System.getProperty("gc.pauses.workloads");
+        if (selected != null) {
+            workloads = selected.split(",");
+        }
+        String report = System.getProperty("gc.pauses.report", "gc-pauses-" + name + ".json");
+
+        try (PrintWriter out = new PrintWriter(new FileWriter(report))) {
+            for (String workload : workloads) {
+                String result = runWorkload(name, workload, durationMs, gcFlags);
+                System.out.println(result);
+                out.println(result);
+            }
+        }
+    }
+}
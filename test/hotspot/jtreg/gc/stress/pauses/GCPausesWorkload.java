@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+package gc.stress.pauses;
+
+import java.lang.ref.PhantomReference;
+import java.lang.ref.Reference;
+import java.lang.ref.ReferenceQueue;
+import java.lang.ref.SoftReference;
+import java.lang.ref.WeakReference;
+import java.util.Random;
+
+import sun.hotspot.WhiteBox;
+
+/**
+ * Synthetic workloads for GCPauses, run in a separate VM, one workload
+ * per VM. Every workload first builds its live set, then triggers a full
+ * GC through WhiteBox so that all collectors start the measured phase from
+ * the same heap state, prints the begin marker, and churns for the given
+ * number of milliseconds. Pauses logged before the marker are not reported.
+ */
+public class GCPausesWorkload {
+    private static final WhiteBox WB = WhiteBox.getWhiteBox();
+
+    public static final String BEGIN_MARKER = "GCPausesWorkload: measurement begins";
+    public static final String END_MARKER = "GCPausesWorkload: measurement ends";
+
+    private static final Random RANDOM = new Random(4711);
+
+    // Handed to the caller so that the JIT can not remove the allocations.
+    public static Object sink;
+
+    public static void main(String[] args) throws Exception {
+        String workload = args[0];
+        long durationMs = Long.parseLong(args[1]);
+
+        Runnable step;
+        switch (workload) {
+            case "alloc-16m":      step = allocationRate(16 * 1024 * 1024); break;
+            case "alloc-128m":     step = allocationRate(128 * 1024 * 1024); break;
+            case "alloc-max":      step = allocationRate(0); break;
+            case "graph-list":     step = linkedList(1_000_000); break;
+            case "graph-tree":     step = binaryTree(19); break;
+            case "graph-wide":     step = wideArrays(1024, 1024); break;
+            case "humongous":      step = humongousChurn(); break;
+            case "references":     step = references(200_000); break;
+            default: throw new IllegalArgumentException("Unknown workload " + workload);
+        }
+
+        WB.fullGC();
+        System.out.println(BEGIN_MARKER);
+        long end = System.nanoTime() + durationMs * 1_000_000L;
+        while (System.nanoTime() < end) {
+            step.run();
+        }
+        System.out.println(END_MARKER);
+    }
+
+    // Short-lived 1k arrays with a 16M window of survivors, at the given
+    // number of bytes per second or as fast as possible.
+    private static Runnable allocationRate(long bytesPerSecond) {
+        final int size = 1024;
+        final Object[] window = new Object[16 * 1024];
+        final long start = System.nanoTime();
+        return new Runnable() {
+            private long allocated;
+            private int next;
+
+            public void run() {
+                for (int i = 0; i < 1024; i++) {
+                    window[next] = new byte[size];
+                    next = (next + 1) % window.length;
+                }
+                allocated += 1024 * size;
+                if (bytesPerSecond > 0) {
+                    long due = start + allocated * 1_000_000_000L / bytesPerSecond;
+                    long ahead = due - System.nanoTime();
+                    if (ahead > 1_000_000L) {
+                        sleep(ahead / 1_000_000L);
+                    }
+                }
+            }
+        };
+    }
+
+    private static class Node {
+        Node next;
+        Node left;
+        Node right;
+        final long payload;
+
+        Node(long payload) {
+            this.payload = payload;
+        }
+    }
+
+    // A long chain of nodes of which a random node is replaced by a new one
+    // in every step, along with 1024 short-lived nodes. The index array used
+    // to pick the node also references every node of the chain, so this
+    // measures a large live set of small objects with old-to-young pointers,
+    // not a chain that marking has to follow sequentially.
+    private static Runnable linkedList(int length) {
+        final Node[] nodes = new Node[length];
+        for (int i = 0; i < length; i++) {
+            nodes[i] = new Node(i);
+            if (i > 0) {
+                nodes[i - 1].next = nodes[i];
+            }
+        }
+        sink = nodes[0];
+        return () -> {
+            int at = 1 + RANDOM.nextInt(length - 2);
+            Node replacement = new Node(at);
+            replacement.next = nodes[at + 1];
+            nodes[at - 1].next = replacement;
+            nodes[at] = replacement;
+            for (int i = 0; i < 1024; i++) {
+                sink = new Node(i);
+            }
+        };
+    }
+
+    private static Node buildTree(int depth) {
+        Node node = new Node(depth);
+        if (depth > 0) {
+            node.left = buildTree(depth - 1);
+            node.right = buildTree(depth - 1);
+        }
+        return node;
+    }
+
+    // A balanced tree that marking can process in parallel; a random
+    // small subtree is rebuilt in every step.
+    private static Runnable binaryTree(int depth) {
+        final Node root = buildTree(depth);
+        return () -> {
+            Node node = root;
+            for (int level = depth; level > 6; level--) {
+                node = RANDOM.nextBoolean() ? node.left : node.right;
+            }
+            node.left = buildTree(5);
+        };
+    }
+
+    // Many old reference arrays that are updated with young objects, which
+    // exercises the card table or remembered sets.
+    private static Runnable wideArrays(int arrays, int width) {
+        final Object[][] roots = new Object[arrays][];
+        for (int i = 0; i < arrays; i++) {
+            roots[i] = new Object[width];
+        }
+        return () -> {
+            for (int i = 0; i < 1024; i++) {
+                Object[] array = roots[RANDOM.nextInt(arrays)];
+                array[RANDOM.nextInt(width)] = new long[4];
+            }
+        };
+    }
+
+    // Large arrays that live for a few steps. With G1 they span two regions;
+    // other collectors get arrays of 1/64 of the maximum heap size, so that
+    // the window of 16 arrays keeps a quarter of the heap live.
+    private static Runnable humongousChurn() {
+        final int size;
+        if (WB.getBooleanVMFlag("UseG1GC")) {
+            size = 2 * WB.g1RegionSize();
+        } else {
+            size = (int) Math.min(Runtime.getRuntime().maxMemory() / 64, Integer.MAX_VALUE - 8);
+        }
+        final Object[] window = new Object[16];
+        return new Runnable() {
+            private int next;
+
+            public void run() {
+                window[next] = new byte[size];
+                next = (next + 1) % window.length;
+                for (int i = 0; i < 64; i++) {
+                    sink = new byte[1024];
+                }
+            }
+        };
+    }
+
+    // Soft, weak and phantom references whose referents die in a young
+    // collection triggered every few steps, and the references are polled
+    // from the queue like a cache would.
+    private static Runnable references(int count) {
+        final ReferenceQueue<Object> queue = new ReferenceQueue<>();
+        final Reference<?>[] refs = new Reference<?>[count];
+        final Object[] strong = new Object[count / 4];
+        return new Runnable() {
+            private int next;
+            private int steps;
+
+            public void run() {
+                for (int i = 0; i < 1024; i++) {
+                    Object referent = new Node(next);
+                    switch (next % 3) {
+                        case 0:  refs[next] = new WeakReference<>(referent, queue); break;
+                        case 1:  refs[next] = new SoftReference<>(referent, queue); break;
+                        default: refs[next] = new PhantomReference<>(referent, queue); break;
+                    }
+                    if (next % 8 == 0) {
+                        strong[(next / 8) % strong.length] = referent;
+                    }
+                    next = (next + 1) % count;
+                }
+                while (queue.poll() != null) {
+                    // Drain the queue.
+                }
+                if (++steps % 64 == 0) {
+                    WB.youngGC();
+                }
+            }
+        };
+    }
+
+    private static void sleep(long ms) {
+        try {
+            Thread.sleep(ms);
+        } catch (InterruptedException e) {
+            throw new RuntimeException(e);
+        }
+    }
+}
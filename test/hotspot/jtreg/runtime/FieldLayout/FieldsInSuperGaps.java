@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+/*
+ * @test
+ * @summary Fields allocated into the alignment gaps of their superclasses
+ *          (CompactFieldsInSuperGaps) must not overlap and must keep their values
+ * @modules java.base/jdk.internal.misc
+ * @run main/othervm -XX:+UnlockDiagnosticVMOptions -XX:+CompactFieldsInSuperGaps
+ *                   -XX:+UseCompressedOops -XX:+UseCompressedClassPointers
+ *                   FieldsInSuperGaps gaps
+ * @run main/othervm -XX:+UnlockDiagnosticVMOptions -XX:+CompactFieldsInSuperGaps
+ *                   -XX:-UseCompressedOops -XX:-UseCompressedClassPointers
+ *                   FieldsInSuperGaps gaps
+ * @run main/othervm -XX:+UnlockDiagnosticVMOptions -XX:-CompactFieldsInSuperGaps
+ *                   FieldsInSuperGaps
+ */
+
+import java.lang.reflect.Field;
+import java.lang.reflect.Modifier;
+import java.util.ArrayList;
+import java.util.List;
+
+import jdk.internal.misc.Unsafe;
+
+public class FieldsInSuperGaps {
+    private static final Unsafe U = Unsafe.getUnsafe();
+
+    static class A {
+        long a1;
+        byte a2;
+    }
+
+    static class B extends A {
+        byte b1;
+        short b2;
+        int b3;
+        Object b4;
+        long b5;
+    }
+
+    static class C extends B {
+        boolean c1;
+        char c2;
+        float c3;
+        byte c4;
+    }
+
+    static class D {
+        short d1;
+    }
+
+    static class E extends D {
+        int e1;
+        short e2;
+        byte e3;
+        byte e4;
+        Object e5;
+    }
+
+    static class F {
+        int f1;
+    }
+
+    static class G extends F {
+        long g1;
+        int g2;
+        double g3;
+        byte g4;
+    }
+
+    static class Statics {
+        static Object s1;
+        static byte s2;
+        static long s3;
+        static short s4;
+        static int s5;
+        static double s6;
+        static boolean s7;
+        static char s8;
+        static float s9;
+    }
+
+    static int sizeOf(Class<?> type) {
+        if (type == long.class || type == double.class) return 8;
+        if (type == int.class || type == float.class) return 4;
+        if (type == short.class || type == char.class) return 2;
+        if (type == byte.class || type == boolean.class) return 1;
+        return U.arrayIndexScale(Object[].class);
+    }
+
+    static List<Field> fields(Class<?> c, boolean statics) {
+        List<Field> result = new ArrayList<>();
+        for (Class<?> k = c; k != Object.class; k = k.getSuperclass()) {
+            for (Field f : k.getDeclaredFields()) {
+                if (Modifier.isStatic(f.getModifiers()) == statics) {
+                    f.setAccessible(true);
+                    result.add(f);
+                }
+            }
+            if (statics) {
+                break;
+            }
+        }
+        return result;
+    }
+
+    static long offset(Field f) {
+        return Modifier.isStatic(f.getModifiers()) ? U.staticFieldOffset(f) : U.objectFieldOffset(f);
+    }
+
+    static void checkLayout(Class<?> c, List<Field> fields) {
+        for (Field f : fields) {
+            long off = offset(f);
+            int size = sizeOf(f.getType());
+            if (off % size != 0) {
+                throw new RuntimeException(c.getName() + "." + f.getName() + " at " + off + " is not aligned");
+            }
+            for (Field g : fields) {
+                long goff = offset(g);
+                if (f != g && off < goff + sizeOf(g.getType()) && goff < off + size) {
+                    throw new RuntimeException(c.getName() + ": " + f.getName() + " at " + off +
+                                               " overlaps " + g.getName() + " at " + goff);
+                }
+            }
+        }
+    }
+
+    static Object value(Class<?> type, int seed) {
+        if (type == long.class) return 0x0102030405060708L * seed;
+        if (type == double.class) return seed * 1.5;
+        if (type == int.class) return 0x01020304 * seed;
+        if (type == float.class) return seed * 2.5f;
+        if (type == short.class) return (short) (0x0102 * seed);
+        if (type == char.class) return (char) (0x0203 * seed);
+        if (type == byte.class) return (byte) (seed * 3);
+        if (type == boolean.class) return (seed & 1) == 1;
+        return "value " + seed;
+    }
+
+    // Write a distinct value to every field, then read them all back, so
+    // that a field written over another one is found.
+    static void checkValues(Object o, List<Field> fields) throws Exception {
+        int seed = 1;
+        for (Field f : fields) {
+            f.set(o, value(f.getType(), seed++));
+        }
+        seed = 1;
+        for (Field f : fields) {
+            Object expected = value(f.getType(), seed++);
+            if (!expected.equals(f.get(o))) {
+                throw new RuntimeException(f.getName() + ": expected " + expected + " but got " + f.get(o));
+            }
+        }
+    }
+
+    static void check(Class<?> c) throws Exception {
+        List<Field> fields = fields(c, false);
+        checkLayout(c, fields);
+        checkValues(c.getDeclaredConstructor().newInstance(), fields);
+    }
+
+    public static void main(String[] args) throws Exception {
+        check(A.class);
+        check(B.class);
+        check(C.class);
+        check(D.class);
+        check(E.class);
+        check(F.class);
+        check(G.class);
+
+        List<Field> statics = fields(Statics.class, true);
+        checkLayout(Statics.class, statics);
+        checkValues(null, statics);
+
+        if (args.length > 0 && args[0].equals("gaps")) {
+            // The first byte field of B goes right after the trailing byte of A.
+            long a2 = U.objectFieldOffset(A.class.getDeclaredField("a2"));
+            long b1 = U.objectFieldOffset(B.class.getDeclaredField("b1"));
+            if (b1 != a2 + 1) {
+                throw new RuntimeException("B.b1 at " + b1 + " not allocated after A.a2 at " + a2);
+            }
+        }
+    }
+}
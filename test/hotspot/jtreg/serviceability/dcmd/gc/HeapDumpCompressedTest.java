@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+/*
+ * @test
+ * @summary Test of the GC.heap_dump -gz option: the dump is compressed while
+ *          it is written and decompresses to a well formed HPROF file
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ * @run main/othervm -XX:+UseSerialGC HeapDumpCompressedTest
+ * @run main/othervm -XX:+UseG1GC -XX:ParallelGCThreads=4 HeapDumpCompressedTest
+ * @run main/othervm -XX:+UseG1GC -XX:ParallelGCThreads=4 HeapDumpCompressedTest -parallel=1
+ */
+
+import java.io.BufferedInputStream;
+import java.io.DataInputStream;
+import java.io.EOFException;
+import java.io.File;
+import java.io.FileInputStream;
+import java.io.FileOutputStream;
+import java.io.IOException;
+import java.io.InputStream;
+import java.io.OutputStream;
+import java.util.zip.GZIPInputStream;
+
+import jdk.test.lib.Asserts;
+import jdk.test.lib.dcmd.PidJcmdExecutor;
+import jdk.test.lib.hprof.HprofParser;
+import jdk.test.lib.process.OutputAnalyzer;
+
+public class HeapDumpCompressedTest {
+
+    static final int HPROF_UTF8              = 0x01;
+    static final int HPROF_LOAD_CLASS        = 0x02;
+    static final int HPROF_FRAME             = 0x04;
+    static final int HPROF_TRACE             = 0x05;
+    static final int HPROF_HEAP_DUMP_SEGMENT = 0x1C;
+    static final int HPROF_HEAP_DUMP_END     = 0x2C;
+
+    // larger than the 8M buffer of the dump writer, so dumped in a segment of its own
+    static byte[] largeArray = new byte[16 * 1024 * 1024];
+    // enough small objects to fill the buffer several times
+    static Object[] smallObjects = new Object[1024 * 1024];
+
+    public static void main(String[] args) throws Exception {
+        for (int i = 0; i < smallObjects.length; i++) {
+            smallObjects[i] = new int[i % 16];
+        }
+        String options = (args.length > 0) ? args[0] : "";
+
+        File dump = new File("heap-" + ProcessHandle.current().pid() + ".hprof.gz");
+        for (int level : new int[] { 1, 9 }) {
+            dump.delete();
+            OutputAnalyzer output = new PidJcmdExecutor().execute("GC.heap_dump -gz=" + level + " " +
+                                                                  options + " " + dump.getAbsolutePath());
+            output.shouldContain("Heap dump file created");
+            output.shouldNotContain("Dump file is incomplete");
+
+            Asserts.assertTrue(dump.exists(), "no dump file");
+            File[] parts = dump.getAbsoluteFile().getParentFile().listFiles(
+                (dir, name) -> name.startsWith(dump.getName() + ".p"));
+            Asserts.assertEquals(parts.length, 0, "part files left over");
+
+            checkGZipMagic(dump);
+            File hprof = new File(dump.getName().replace(".gz", ""));
+            decompress(dump, hprof);
+            checkRecords(hprof);
+            HprofParser.parse(hprof);
+            hprof.delete();
+        }
+        dump.delete();
+
+        OutputAnalyzer output = new PidJcmdExecutor().execute("GC.heap_dump -gz=10 " + dump.getAbsolutePath());
+        output.shouldContain("Compression level out of range");
+        Asserts.assertFalse(dump.exists(), "dump written with invalid compression level");
+
+        Asserts.assertNotNull(largeArray);
+    }
+
+    static void checkGZipMagic(File f) throws IOException {
+        try (InputStream in = new FileInputStream(f)) {
+            Asserts.assertEquals(in.read(), 0x1f, "bad gzip magic");
+            Asserts.assertEquals(in.read(), 0x8b, "bad gzip magic");
+        }
+    }
+
+    // GZIPInputStream reads all the gzip members of the file
+    static void decompress(File from, File to) throws IOException {
+        try (InputStream in = new GZIPInputStream(new FileInputStream(from));
+             OutputStream out = new FileOutputStream(to)) {
+            in.transferTo(out);
+        }
+    }
+
+    // Walks the top level records, which only works if the segment lengths
+    // have been fixed up correctly.
+    static void checkRecords(File f) throws IOException {
+        try (DataInputStream in = new DataInputStream(new BufferedInputStream(new FileInputStream(f)))) {
+            StringBuilder header = new StringBuilder();
+            int c;
+            while ((c = in.read()) > 0) {
+                header.append((char)c);
+            }
+            Asserts.assertEquals(header.toString(), "JAVA PROFILE 1.0.2", "bad header");
+            in.readInt();  // identifier size
+            in.readLong(); // time stamp
+
+            int segments = 0;
+            boolean end = false;
+            while (true) {
+                int tag;
+                try {
+                    tag = in.readUnsignedByte();
+                } catch (EOFException e) {
+                    break;
+                }
+                Asserts.assertFalse(end, "record after HPROF_HEAP_DUMP_END");
+                in.readInt(); // time
+                long length = in.readInt() & 0xffffffffL;
+                switch (tag) {
+                    case HPROF_UTF8:
+                    case HPROF_LOAD_CLASS:
+                    case HPROF_FRAME:
+                    case HPROF_TRACE:
+                        break;
+                    case HPROF_HEAP_DUMP_SEGMENT:
+                        segments++;
+                        break;
+                    case HPROF_HEAP_DUMP_END:
+                        Asserts.assertEquals(length, 0L, "bad HPROF_HEAP_DUMP_END length");
+                        end = true;
+                        break;
+                    default:
+                        throw new RuntimeException("unexpected record tag " + tag +
+                                                   ", segment length not fixed up?");
+                }
+                in.skipNBytes(length);
+            }
+            Asserts.assertTrue(end, "dump does not end with HPROF_HEAP_DUMP_END");
+            Asserts.assertGT(segments, 2, "expected the buffer to be flushed in several segments");
+        }
+    }
+}
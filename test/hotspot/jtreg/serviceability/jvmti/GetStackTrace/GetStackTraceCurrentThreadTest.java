@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary Checks JVMTI GetStackTrace of the current thread, and of another
+ *          thread that runs Java code and executes the handshake itself
+ * @compile GetStackTraceCurrentThreadTest.java
+ * @run main/othervm/native -agentlib:GetStackTraceCurrentThreadTest GetStackTraceCurrentThreadTest
+ */
+
+public class GetStackTraceCurrentThreadTest {
+
+    static {
+        try {
+            System.loadLibrary("GetStackTraceCurrentThreadTest");
+        } catch (UnsatisfiedLinkError ule) {
+            System.err.println("Could not load GetStackTraceCurrentThreadTest library");
+            System.err.println("java.library.path: "
+                    + System.getProperty("java.library.path"));
+            throw ule;
+        }
+    }
+
+    // Returns 0 if the stack trace of the thread contains the method.
+    private static native int checkStackTrace(Thread thread, String methodName);
+
+    private static volatile boolean stop;
+    private static volatile boolean spinning;
+
+    public static void main(String[] args) throws Exception {
+        testCurrentThread();
+        testOtherThread();
+    }
+
+    private static void testCurrentThread() {
+        for (int i = 0; i < 100; i++) {
+            if (checkStackTrace(Thread.currentThread(), "testCurrentThread") != 0) {
+                throw new RuntimeException("FAILED: testCurrentThread not in own stack trace");
+            }
+        }
+    }
+
+    private static void spin() {
+        spinning = true;
+        while (!stop) {
+            // Stay in Java code so that the thread runs the handshake itself.
+        }
+    }
+
+    private static void testOtherThread() throws Exception {
+        Thread t = new Thread(GetStackTraceCurrentThreadTest::spin);
+        t.start();
+        while (!spinning) {
+            Thread.sleep(10);
+        }
+        try {
+            for (int i = 0; i < 100; i++) {
+                if (checkStackTrace(t, "spin") != 0) {
+                    throw new RuntimeException("FAILED: spin not in stack trace of the other thread");
+                }
+            }
+        } finally {
+            stop = true;
+            t.join();
+        }
+    }
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "jvmti.h"
+#include "jni.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PASSED 0
+#define FAILED 2
+
+#define MAX_FRAMES 32
+
+static jvmtiEnv *jvmti;
+
+static void ShowErrorMessage(jvmtiEnv *jvmti, jvmtiError errCode, const char *message) {
+    char *errMsg;
+    jvmtiError result;
+
+    result = (*jvmti)->GetErrorName(jvmti, errCode, &errMsg);
+    if (result == JVMTI_ERROR_NONE) {
+        fprintf(stderr, "%s: %s (%d)\n", message, errMsg, errCode);
+        (*jvmti)->Deallocate(jvmti, (unsigned char *)errMsg);
+    } else {
+        fprintf(stderr, "%s (%d)\n", message, errCode);
+    }
+}
+
+JNIEXPORT jint JNICALL
+Agent_OnLoad(JavaVM *jvm, char *options, void *reserved) {
+    jint res = (*jvm)->GetEnv(jvm, (void **) &jvmti, JVMTI_VERSION_9);
+    if (res != JNI_OK || jvmti == NULL) {
+        fprintf(stderr, "Error: wrong result of a valid call to GetEnv!\n");
+        return JNI_ERR;
+    }
+    return JNI_OK;
+}
+
+JNIEXPORT jint JNICALL
+Java_GetStackTraceCurrentThreadTest_checkStackTrace(JNIEnv *env, jclass cls,
+                                                    jthread thread, jstring methodName) {
+    jvmtiFrameInfo frames[MAX_FRAMES];
+    jvmtiError err;
+    jint count;
+    jint status = FAILED;
+    jint i;
+    const char *expected;
+
+    err = (*jvmti)->GetStackTrace(jvmti, thread, 0, MAX_FRAMES, frames, &count);
+    if (err != JVMTI_ERROR_NONE) {
+        ShowErrorMessage(jvmti, err, "checkStackTrace: error in JVMTI GetStackTrace");
+        return FAILED;
+    }
+
+    expected = (*env)->GetStringUTFChars(env, methodName, NULL);
+    if (expected == NULL) {
+        return FAILED;
+    }
+
+    for (i = 0; i < count && status != PASSED; i++) {
+        char *name;
+        err = (*jvmti)->GetMethodName(jvmti, frames[i].method, &name, NULL, NULL);
+        if (err != JVMTI_ERROR_NONE) {
+            ShowErrorMessage(jvmti, err, "checkStackTrace: error in JVMTI GetMethodName");
+            break;
+        }
+        if (strcmp(name, expected) == 0) {
+            status = PASSED;
+        }
+        (*jvmti)->Deallocate(jvmti, (unsigned char *)name);
+    }
+
+    if (status != PASSED) {
+        fprintf(stderr, "checkStackTrace: FAIL: %s not found in %d frames\n", expected, count);
+    }
+    (*env)->ReleaseStringUTFChars(env, methodName, expected);
+    return status;
+}
+
+#ifdef __cplusplus
+}
+#endif
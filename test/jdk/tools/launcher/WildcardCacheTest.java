@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+/**
+ * @test
+ * @summary Class path wildcard expansion cache (JDK_JAVA_LAUNCHER_CACHE)
+ * @requires os.family != "windows"
+ * @modules jdk.compiler
+ *          jdk.zipfs
+ * @build TestHelper
+ * @run main WildcardCacheTest
+ */
+import java.io.File;
+import java.io.IOException;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.nio.file.attribute.FileTime;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.concurrent.TimeUnit;
+
+public class WildcardCacheTest extends TestHelper {
+    private static final String CACHE_ENV = "JDK_JAVA_LAUNCHER_CACHE";
+    private static final String MESSAGE = "Hello from the wildcard jar";
+
+    private static final Path libDir = Path.of("wildcardlib");
+    private static final Path cacheFile = Path.of("wildcard.cache").toAbsolutePath();
+    private static final Map<String, String> env = new HashMap<>();
+
+    static void init() throws IOException {
+        Files.createDirectories(libDir);
+        File jar = libDir.resolve("foo.jar").toFile();
+        createJar(jar, new File("Foo"),
+                  "public static void main(String... args) {",
+                  "    System.out.println(\"" + MESSAGE + "\");",
+                  "}");
+        new File("Foo.class").delete();
+        // Directories modified within the last seconds are not cached.
+        Files.setLastModifiedTime(libDir, FileTime.fromMillis(System.currentTimeMillis() - 3_600_000));
+        env.put(CACHE_ENV, cacheFile.toString());
+    }
+
+    private static TestResult launch() {
+        return doExec(env, javaCmd, "-cp", libDir + File.separator + "*", "Foo");
+    }
+
+    private static String entry(int count) throws IOException {
+        return Long.toUnsignedString((Long) Files.getAttribute(libDir, "unix:dev")) + " " +
+               Long.toUnsignedString((Long) Files.getAttribute(libDir, "unix:ino")) + " " +
+               Files.getLastModifiedTime(libDir).to(TimeUnit.SECONDS) + " " +
+               count + "\n";
+    }
+
+    private static void check(TestResult tr) {
+        tr.checkPositive();
+        tr.contains(MESSAGE);
+        if (!tr.testStatus) {
+            System.out.println(tr);
+        }
+    }
+
+    private static void checkCacheIsValid() throws IOException {
+        List<String> lines = Files.readAllLines(cacheFile);
+        if (lines.size() != 2 || !(lines.get(0) + "\n").equals(entry(1)) || !lines.get(1).equals("foo.jar")) {
+            throw new RuntimeException("Unexpected cache file content: " + lines);
+        }
+    }
+
+    @Test
+    void testCreate() throws IOException {
+        Files.deleteIfExists(cacheFile);
+        check(launch());
+        checkCacheIsValid();
+        // A second launch uses the entry.
+        check(launch());
+        checkCacheIsValid();
+    }
+
+    @Test
+    void testCacheIsUsed() throws IOException {
+        // An entry for the directory is taken as is, without reading it.
+        Files.writeString(cacheFile, entry(1) + "bar.jar\n");
+        TestResult tr = launch();
+        tr.checkNegative();
+        tr.notContains(MESSAGE);
+        if (!tr.testStatus) {
+            System.out.println(tr);
+        }
+    }
+
+    @Test
+    void testCountTooLarge() throws IOException {
+        // The count can not fit in the file, so the file is rejected.
+        Files.writeString(cacheFile, entry(Integer.MAX_VALUE) + "bar.jar\n");
+        check(launch());
+        checkCacheIsValid();
+        Files.writeString(cacheFile, entry(1000) + "bar.jar\n");
+        check(launch());
+        checkCacheIsValid();
+    }
+
+    @Test
+    void testCorrupt() throws IOException {
+        String[] corrupt = {
+            entry(-1) + "bar.jar\n",
+            entry(2) + "bar.jar\n",
+            entry(1) + "bar.jar",
+            entry(1) + "\n",
+            "garbage\n" + entry(1) + "bar.jar\n",
+            entry(1) + "bar.jar\n" + "1 2 3\n",
+        };
+        for (String content : corrupt) {
+            Files.writeString(cacheFile, content);
+            check(launch());
+            checkCacheIsValid();
+        }
+    }
+
+    @Test
+    void testSymlink() throws IOException {
+        // The cache is replaced by a new file, never written through a link.
+        Path victim = Path.of("victim").toAbsolutePath();
+        Files.writeString(victim, "victim\n");
+        Files.deleteIfExists(cacheFile);
+        Files.createSymbolicLink(cacheFile, victim);
+        check(launch());
+        if (Files.isSymbolicLink(cacheFile) || !Files.readString(victim).equals("victim\n")) {
+            throw new RuntimeException("Cache file written through a symbolic link");
+        }
+        checkCacheIsValid();
+    }
+
+    public static void main(String... args) throws Exception {
+        init();
+        WildcardCacheTest a = new WildcardCacheTest();
+        a.run(args);
+        if (testExitValue > 0) {
+            System.out.println("Total of " + testExitValue + " failed");
+            System.exit(1);
+        } else {
+            System.out.println("All tests pass");
+        }
+    }
+}